@@ -34,9 +34,25 @@ rapids_find_package(CUDAToolkit REQUIRED
   INSTALL_EXPORT_SET ${PROJECT_NAME}-core-exports
 )
 
-rapids_find_package(ZLIB
+rapids_find_package(gRPC REQUIRED
+  GLOBAL_TARGETS gRPC::grpc++
   BUILD_EXPORT_SET ${PROJECT_NAME}-core-exports
   INSTALL_EXPORT_SET ${PROJECT_NAME}-core-exports
+  FIND_ARGS CONFIG
+)
+
+# zlib for gzip-encoded HTTP request bodies in HttpServer
+rapids_find_package(ZLIB REQUIRED
+  BUILD_EXPORT_SET ${PROJECT_NAME}-core-exports
+  INSTALL_EXPORT_SET ${PROJECT_NAME}-core-exports
+)
+
+# zstd for the inline-compressed ('.zst') output of WriteToFileStage
+rapids_find_package(zstd REQUIRED
+  GLOBAL_TARGETS zstd::libzstd_shared
+  BUILD_EXPORT_SET ${PROJECT_NAME}-core-exports
+  INSTALL_EXPORT_SET ${PROJECT_NAME}-core-exports
+  FIND_ARGS CONFIG
 )
 
 if(MORPHEUS_BUILD_BENCHMARKS)
@@ -11,11 +11,12 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-from . import common
-from . import llm
-from . import messages
-from . import modules
-from . import stages
+# Submodules are imported lazily (PEP 562): each one executes hundreds of pybind11 registrations on import, and
+# eagerly importing all five costs seconds of cold start that short-lived CLI invocations never earn back. Both
+# `import morpheus._lib.messages` and `morpheus._lib.messages` attribute access load only that submodule.
+
+import importlib
+import typing
 
 __all__ = [
     "common",
@@ -24,3 +25,23 @@ __all__ = [
     "modules",
     "stages",
 ]
+
+if typing.TYPE_CHECKING:
+    from . import common
+    from . import llm
+    from . import messages
+    from . import modules
+    from . import stages
+
+
+def __getattr__(name: str):
+    if name in __all__:
+        module = importlib.import_module(f".{name}", __name__)
+        globals()[name] = module
+        return module
+
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+
+
+def __dir__() -> typing.List[str]:
+    return sorted(set(globals()) | set(__all__))
@@ -0,0 +1,220 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/kafka_source.hpp"
+#include "morpheus/types.hpp"  // for TensorIndex
+
+#include <benchmark/benchmark.h>
+#include <librdkafka/rdkafkacpp.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace morpheus;
+
+/**
+ * @brief Replays a canned payload as if it had been fetched from a broker. Only the accessors the ingest path
+ * touches return real data; everything else is stubbed to the values librdkafka reports for locally produced
+ * messages.
+ */
+class MockKafkaMessage : public RdKafka::Message
+{
+  public:
+    MockKafkaMessage(RdKafka::ErrorCode err, std::shared_ptr<const std::string> payload, std::int64_t offset) :
+      m_err(err),
+      m_payload(std::move(payload)),
+      m_offset(offset)
+    {}
+
+    std::string errstr() const override
+    {
+        return RdKafka::err2str(m_err);
+    }
+    RdKafka::ErrorCode err() const override
+    {
+        return m_err;
+    }
+    RdKafka::Topic* topic() const override
+    {
+        return nullptr;
+    }
+    std::string topic_name() const override
+    {
+        return "bench_topic";
+    }
+    std::int32_t partition() const override
+    {
+        return 0;
+    }
+    void* payload() const override
+    {
+        return m_payload ? const_cast<char*>(m_payload->data()) : nullptr;
+    }
+    std::size_t len() const override
+    {
+        return m_payload ? m_payload->size() : 0;
+    }
+    const std::string* key() const override
+    {
+        return nullptr;
+    }
+    const void* key_pointer() const override
+    {
+        return nullptr;
+    }
+    std::size_t key_len() const override
+    {
+        return 0;
+    }
+    std::int64_t offset() const override
+    {
+        return m_offset;
+    }
+    RdKafka::MessageTimestamp timestamp() const override
+    {
+        return {};
+    }
+    void* msg_opaque() const override
+    {
+        return nullptr;
+    }
+    std::int64_t latency() const override
+    {
+        return -1;
+    }
+    struct rd_kafka_message_s* c_ptr() override
+    {
+        return nullptr;
+    }
+    RdKafka::Message::Status status() const override
+    {
+        return RdKafka::Message::MSG_STATUS_NOT_PERSISTED;
+    }
+    RdKafka::Headers* headers() override
+    {
+        return nullptr;
+    }
+    RdKafka::Headers* headers(RdKafka::ErrorCode* err) override
+    {
+        return nullptr;
+    }
+    std::int32_t broker_id() const override
+    {
+        return -1;
+    }
+
+  private:
+    RdKafka::ErrorCode m_err;
+    std::shared_ptr<const std::string> m_payload;
+    std::int64_t m_offset;
+};
+
+/**
+ * @brief In-process stand-in for `RdKafka::KafkaConsumer::consume`, replaying canned JSON payloads. The replay
+ * rate is shaped by `messages_per_poll`: each burst hands back that many messages and then reports a timeout,
+ * the same pattern a live consumer shows when its locally fetched queue drains and the loop falls back to a
+ * timed wait on the broker.
+ */
+class MockKafkaConsumer
+{
+  public:
+    MockKafkaConsumer(std::vector<std::shared_ptr<const std::string>> payloads, std::size_t messages_per_poll) :
+      m_payloads(std::move(payloads)),
+      m_messages_per_poll(messages_per_poll)
+    {}
+
+    std::unique_ptr<RdKafka::Message> consume(long max_wait_ms)
+    {
+        if (m_served_in_burst >= m_messages_per_poll)
+        {
+            m_served_in_burst = 0;
+            return std::make_unique<MockKafkaMessage>(RdKafka::ERR__TIMED_OUT, nullptr, -1);
+        }
+
+        ++m_served_in_burst;
+        const auto& payload = m_payloads[m_offset % m_payloads.size()];
+
+        return std::make_unique<MockKafkaMessage>(RdKafka::ERR_NO_ERROR, payload, m_offset++);
+    }
+
+  private:
+    std::vector<std::shared_ptr<const std::string>> m_payloads;
+    std::size_t m_messages_per_poll;
+    std::size_t m_served_in_burst{0};
+    std::int64_t m_offset{0};
+};
+
+std::vector<std::shared_ptr<const std::string>> make_canned_payloads(std::size_t count)
+{
+    std::vector<std::shared_ptr<const std::string>> payloads;
+    payloads.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        payloads.push_back(std::make_shared<const std::string>(
+            R"({"event_id": )" + std::to_string(i) + R"(, "user": "user_)" + std::to_string(i % 64) +
+            R"(", "score": 0.)" + std::to_string(i % 100) + "}"));
+    }
+
+    return payloads;
+}
+
+// Drives the stage's real consume/process loop (`accumulate_batch` + `process_batch`) against the mock
+// consumer, covering the pre-parse filter, batch accumulation and the device-side JSON parse without a broker.
+// range(0) is the batch size target, range(1) the burst size per poll.
+void BM_KafkaSource_ConsumeProcess(benchmark::State& state)
+{
+    const auto batch_size    = static_cast<TensorIndex>(state.range(0));
+    const auto msgs_per_poll = static_cast<std::size_t>(state.range(1));
+    const auto batch_timeout = 50U;
+
+    KafkaSourceStage stage(
+        batch_size, "bench_topic", batch_timeout, std::map<std::string, std::string>{}, true /*disable_commit*/);
+
+    MockKafkaConsumer consumer(make_canned_payloads(1024), msgs_per_poll);
+    KafkaSourceStage::consume_fn_t consume_fn = [&consumer](long max_wait_ms) {
+        return consumer.consume(max_wait_ms);
+    };
+
+    std::size_t rows_processed = 0;
+
+    for (auto _ : state)
+    {
+        auto message_batch = stage.accumulate_batch(consume_fn);
+        auto meta          = stage.process_batch(std::move(message_batch));
+
+        rows_processed += meta->count();
+        benchmark::DoNotOptimize(meta);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(rows_processed));
+}
+BENCHMARK(BM_KafkaSource_ConsumeProcess)
+    ->Args({1024, 256})
+    ->Args({4096, 256})
+    ->Args({4096, 1024})
+    ->Args({16384, 4096})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
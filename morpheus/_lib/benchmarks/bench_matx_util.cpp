@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "./bench_utils.hpp"
+
+#include "morpheus/objects/dev_mem_info.hpp"
+#include "morpheus/objects/dtype.hpp"
+#include "morpheus/types.hpp"  // for ShapeType, TensorIndex
+#include "morpheus/utilities/matx_util.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+namespace {
+
+constexpr morpheus::TensorIndex NumColumns = 8;
+
+}  // namespace
+
+static void BM_MatxUtil_Threshold(benchmark::State& state)
+{
+    using namespace morpheus;
+
+    const auto rows = static_cast<TensorIndex>(state.range(0));
+    auto buffer     = bench::make_random_float_buffer(static_cast<std::size_t>(rows) * NumColumns);
+
+    DevMemInfo input{buffer, DType(TypeId::FLOAT32), {rows, NumColumns}, {NumColumns, 1}};
+
+    for (auto _ : state)
+    {
+        auto output = MatxUtil::threshold(input, 0.5, false);
+        benchmark::DoNotOptimize(output);
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows * NumColumns);
+}
+BENCHMARK(BM_MatxUtil_Threshold)->Range(1 << 10, 1 << 20);
+
+static void BM_MatxUtil_ThresholdByRow(benchmark::State& state)
+{
+    using namespace morpheus;
+
+    const auto rows = static_cast<TensorIndex>(state.range(0));
+    auto buffer     = bench::make_random_float_buffer(static_cast<std::size_t>(rows) * NumColumns);
+
+    DevMemInfo input{buffer, DType(TypeId::FLOAT32), {rows, NumColumns}, {NumColumns, 1}};
+
+    for (auto _ : state)
+    {
+        auto output = MatxUtil::threshold(input, 0.5, true);
+        benchmark::DoNotOptimize(output);
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows * NumColumns);
+}
+BENCHMARK(BM_MatxUtil_ThresholdByRow)->Range(1 << 10, 1 << 20);
+
+static void BM_MatxUtil_ReduceMax(benchmark::State& state)
+{
+    using namespace morpheus;
+
+    const auto rows = static_cast<TensorIndex>(state.range(0));
+    auto buffer     = bench::make_random_float_buffer(static_cast<std::size_t>(rows) * NumColumns);
+
+    DevMemInfo input{buffer, DType(TypeId::FLOAT32), {rows, NumColumns}, {NumColumns, 1}};
+
+    // Reduce pairs of rows, the shape produced by tokenizing with a stride of half the sequence length
+    ShapeType seq_ids(rows);
+    for (TensorIndex i = 0; i < rows; ++i)
+    {
+        seq_ids[i] = i / 2;
+    }
+
+    const ShapeType output_shape{(rows + 1) / 2, NumColumns};
+
+    for (auto _ : state)
+    {
+        auto output = MatxUtil::reduce_max(input, seq_ids, 0, output_shape);
+        benchmark::DoNotOptimize(output);
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows * NumColumns);
+}
+BENCHMARK(BM_MatxUtil_ReduceMax)->Range(1 << 10, 1 << 20);
+
+static void BM_MatxUtil_Cast(benchmark::State& state)
+{
+    using namespace morpheus;
+
+    const auto rows = static_cast<TensorIndex>(state.range(0));
+    auto buffer     = bench::make_random_float_buffer(static_cast<std::size_t>(rows) * NumColumns);
+
+    DevMemInfo input{buffer, DType(TypeId::FLOAT32), {rows, NumColumns}, {NumColumns, 1}};
+
+    for (auto _ : state)
+    {
+        auto output = MatxUtil::cast(input, TypeId::FLOAT64);
+        benchmark::DoNotOptimize(output);
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows * NumColumns);
+}
+BENCHMARK(BM_MatxUtil_Cast)->Range(1 << 10, 1 << 20);
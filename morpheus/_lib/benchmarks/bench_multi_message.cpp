@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "./bench_utils.hpp"
+
+#include "morpheus/messages/multi.hpp"
+#include "morpheus/types.hpp"  // for RangeType, TensorIndex
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>  // for min
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+static void BM_MultiMessage_CopyRanges(benchmark::State& state)
+{
+    using namespace morpheus;
+
+    const auto rows = static_cast<TensorIndex>(state.range(0));
+    auto meta       = bench::make_synthetic_meta(static_cast<std::size_t>(rows));
+    auto message    = std::make_shared<MultiMessage>(meta);
+
+    // Select every other block of 64 rows, the shape FilterDetectionsStage produces for bursty hits
+    std::vector<RangeType> ranges;
+    TensorIndex num_selected = 0;
+    for (TensorIndex start = 0; start < rows; start += 128)
+    {
+        const auto stop = std::min(start + 64, rows);
+        ranges.emplace_back(start, stop);
+        num_selected += stop - start;
+    }
+
+    for (auto _ : state)
+    {
+        auto copied = message->copy_ranges(ranges, num_selected);
+        benchmark::DoNotOptimize(copied);
+    }
+
+    state.SetItemsProcessed(state.iterations() * num_selected);
+}
+BENCHMARK(BM_MultiMessage_CopyRanges)->Range(1 << 10, 1 << 18);
+
+static void BM_MultiMessage_GetSlice(benchmark::State& state)
+{
+    using namespace morpheus;
+
+    const auto rows = static_cast<TensorIndex>(state.range(0));
+    auto meta       = bench::make_synthetic_meta(static_cast<std::size_t>(rows));
+    auto message    = std::make_shared<MultiMessage>(meta);
+
+    for (auto _ : state)
+    {
+        auto sliced = message->get_slice(rows / 4, (rows * 3) / 4);
+        benchmark::DoNotOptimize(sliced);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (rows / 2));
+}
+BENCHMARK(BM_MultiMessage_GetSlice)->Range(1 << 10, 1 << 18);
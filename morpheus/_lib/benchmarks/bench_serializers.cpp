@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "./bench_utils.hpp"
+
+#include "morpheus/io/serializers.hpp"
+#include "morpheus/messages/meta.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+static void BM_Serializers_DfToCsv(benchmark::State& state)
+{
+    using namespace morpheus;
+
+    const auto rows = static_cast<std::size_t>(state.range(0));
+    auto meta       = bench::make_synthetic_meta(rows);
+
+    for (auto _ : state)
+    {
+        auto csv = df_to_csv(meta->get_info(), true);
+        benchmark::DoNotOptimize(csv);
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+BENCHMARK(BM_Serializers_DfToCsv)->Range(1 << 10, 1 << 18);
+
+static void BM_Serializers_DfToJson(benchmark::State& state)
+{
+    using namespace morpheus;
+
+    const auto rows = static_cast<std::size_t>(state.range(0));
+    auto meta       = bench::make_synthetic_meta(rows);
+
+    for (auto _ : state)
+    {
+        auto json = df_to_json(meta->get_info());
+        benchmark::DoNotOptimize(json);
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+BENCHMARK(BM_Serializers_DfToJson)->Range(1 << 10, 1 << 18);
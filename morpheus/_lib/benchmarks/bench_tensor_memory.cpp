@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "./bench_utils.hpp"
+
+#include "morpheus/messages/memory/tensor_memory.hpp"
+#include "morpheus/objects/dtype.hpp"
+#include "morpheus/objects/tensor.hpp"
+#include "morpheus/types.hpp"  // for TensorIndex
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <utility>  // for move
+
+namespace {
+
+constexpr morpheus::TensorIndex NumColumns = 8;
+
+}  // namespace
+
+static void BM_TensorMemory_SetGetTensor(benchmark::State& state)
+{
+    using namespace morpheus;
+
+    const auto rows = static_cast<TensorIndex>(state.range(0));
+    auto buffer     = bench::make_random_float_buffer(static_cast<std::size_t>(rows) * NumColumns);
+
+    TensorMemory memory{rows};
+
+    for (auto _ : state)
+    {
+        memory.set_tensor("probs",
+                          Tensor::create(buffer, DType(TypeId::FLOAT32), {rows, NumColumns}, {NumColumns, 1}));
+
+        auto& tensor = memory.get_tensor("probs");
+        benchmark::DoNotOptimize(tensor);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TensorMemory_SetGetTensor)->Range(1 << 10, 1 << 18);
+
+static void BM_TensorMemory_GetSlice(benchmark::State& state)
+{
+    using namespace morpheus;
+
+    const auto rows = static_cast<TensorIndex>(state.range(0));
+    auto buffer     = bench::make_random_float_buffer(static_cast<std::size_t>(rows) * NumColumns);
+
+    TensorMemory memory{rows};
+    memory.set_tensor("probs", Tensor::create(buffer, DType(TypeId::FLOAT32), {rows, NumColumns}, {NumColumns, 1}));
+
+    for (auto _ : state)
+    {
+        auto sliced = memory.get_tensor("probs").slice({rows / 4, 0}, {(rows * 3) / 4, NumColumns});
+        benchmark::DoNotOptimize(sliced);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TensorMemory_GetSlice)->Range(1 << 10, 1 << 18);
@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "./bench_utils.hpp"
+
+#include "morpheus/messages/meta.hpp"
+
+#include <cuda_runtime.h>  // for cudaMemcpy
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
+#include <pybind11/embed.h>
+#include <pybind11/pybind11.h>
+#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
+
+#include <cstdlib>  // for rand
+#include <sstream>
+#include <utility>  // for move
+#include <vector>
+
+namespace morpheus::bench {
+
+std::shared_ptr<morpheus::MessageMeta> make_synthetic_meta(std::size_t rows)
+{
+    static const std::vector<std::string> random_strings = {"field1", "test123", "abc", "xyz", "123", "foo", "bar"};
+
+    auto sstream = std::stringstream();
+    sstream << "int_col,float_col,str_col\n";
+
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        sstream << std::rand() % 100 << "," << std::rand() % 100 << "." << std::rand() % 100 << ","
+                << random_strings[std::rand() % random_strings.size()] << "\n";
+    }
+
+    pybind11::gil_scoped_acquire gil;
+    auto mod_cudf = pybind11::module_::import("cudf");
+
+    auto py_string = pybind11::str(sstream.str());
+    auto py_buffer = pybind11::buffer(pybind11::bytes(py_string));
+    auto dataframe = mod_cudf.attr("read_csv")(py_buffer);
+
+    return MessageMeta::create_from_python(std::move(dataframe));
+}
+
+std::shared_ptr<rmm::device_buffer> make_random_float_buffer(std::size_t count)
+{
+    std::vector<float> host(count);
+    for (auto& value : host)
+    {
+        value = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
+    }
+
+    auto buffer = std::make_shared<rmm::device_buffer>(count * sizeof(float), rmm::cuda_stream_per_thread);
+    MRC_CHECK_CUDA(cudaMemcpy(buffer->data(), host.data(), buffer->size(), cudaMemcpyHostToDevice));
+
+    return buffer;
+}
+
+}  // namespace morpheus::bench
@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/types.hpp"  // for TensorIndex
+
+#include <rmm/device_buffer.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace morpheus {
+class MessageMeta;
+}
+
+namespace morpheus::bench {
+
+/**
+ * @brief Builds a python-backed MessageMeta with `rows` rows of synthetic int32/float32/string columns, the same
+ * shape of data the test utilities use. Requires the embedded interpreter started by the benchmark main.
+ */
+std::shared_ptr<morpheus::MessageMeta> make_synthetic_meta(std::size_t rows);
+
+/**
+ * @brief Fills a device buffer with `count` uniform random floats in [0, 1).
+ */
+std::shared_ptr<rmm::device_buffer> make_random_float_buffer(std::size_t count);
+
+}  // namespace morpheus::bench
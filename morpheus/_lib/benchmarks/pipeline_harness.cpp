@@ -0,0 +1,225 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * End-to-end pipeline harness: assembles a real stage graph in pure C++ and replays a dataset through it,
+ * reporting steady-state throughput and per-window latency percentiles without any Python in the data path.
+ * Latency is measured from when a window enters the mock inference node until its serialized output reaches the
+ * sink, the post-inference span that Python E2E runs cannot isolate from the GIL.
+ *
+ * Graph: FileSource -> Deserialize -> Preallocate -> (mock inference) -> AddClassifications -> Serialize -> sink
+ *
+ * The mock inference node stands in for Triton: it attaches a preallocated random probabilities tensor to each
+ * window, so the numbers isolate the library's overhead from the model's. Usage:
+ *
+ *     benchmark_pipeline_harness DATA_FILE [REPEAT] [BATCH_SIZE]
+ */
+
+#include "morpheus/messages/memory/response_memory.hpp"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/messages/multi.hpp"
+#include "morpheus/messages/multi_response.hpp"
+#include "morpheus/objects/dtype.hpp"
+#include "morpheus/objects/tensor.hpp"
+#include "morpheus/stages/add_classification.hpp"
+#include "morpheus/stages/deserialize.hpp"
+#include "morpheus/stages/file_source.hpp"
+#include "morpheus/stages/preallocate.hpp"
+#include "morpheus/stages/serialize.hpp"
+#include "morpheus/types.hpp"  // for TensorIndex
+#include "morpheus/utilities/cudf_util.hpp"
+
+#include <cuda_runtime.h>  // for cudaMemcpy
+#include <mrc/options/engine_groups.hpp>
+#include <mrc/options/options.hpp>
+#include <mrc/options/topology.hpp>
+#include <mrc/pipeline/executor.hpp>
+#include <mrc/pipeline/pipeline.hpp>
+#include <mrc/runnable/types.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pybind11/embed.h>
+#include <pybind11/gil.h>
+#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
+#include <rmm/device_buffer.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <algorithm>  // for sort
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>  // for atoi, rand
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>  // for move
+#include <vector>
+
+namespace {
+
+using clock_t   = std::chrono::steady_clock;
+using latency_t = std::chrono::duration<double, std::milli>;
+
+constexpr morpheus::TensorIndex NumLabels = 4;
+
+double percentile(std::vector<double>& sorted_values, double fraction)
+{
+    if (sorted_values.empty())
+    {
+        return 0.0;
+    }
+
+    const auto idx = static_cast<std::size_t>(fraction * static_cast<double>(sorted_values.size() - 1));
+
+    return sorted_values[idx];
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    using namespace morpheus;
+
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " DATA_FILE [REPEAT] [BATCH_SIZE]\n";
+        return 1;
+    }
+
+    const std::string data_file{argv[1]};
+    const int repeat            = argc > 2 ? std::atoi(argv[2]) : 10;
+    const TensorIndex batch_size = argc > 3 ? std::atoi(argv[3]) : 256;
+
+    // MessageMeta conversions need the interpreter and the cudf helpers even though no stage runs Python code
+    pybind11::scoped_interpreter interpreter;
+    CudfHelper::load();
+    pybind11::gil_scoped_release release;
+
+    // One random probabilities buffer shared by every window emitted by the mock inference node
+    std::vector<float> host_probs(static_cast<std::size_t>(batch_size) * NumLabels);
+    for (auto& value : host_probs)
+    {
+        value = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
+    }
+
+    auto probs_buffer =
+        std::make_shared<rmm::device_buffer>(host_probs.size() * sizeof(float), rmm::cuda_stream_per_thread);
+    cudaMemcpy(probs_buffer->data(), host_probs.data(), probs_buffer->size(), cudaMemcpyHostToDevice);
+
+    std::map<std::size_t, std::string> idx2label;
+    std::vector<std::tuple<std::string, TypeId>> needed_columns;
+    for (std::size_t i = 0; i < static_cast<std::size_t>(NumLabels); ++i)
+    {
+        auto label = "label_" + std::to_string(i);
+        idx2label[i] = label;
+        needed_columns.emplace_back(label, TypeId::BOOL8);
+    }
+
+    std::mutex stamp_mutex;
+    std::deque<clock_t::time_point> stamps;
+    std::vector<double> latencies_ms;
+    std::size_t messages_received = 0;
+    std::size_t rows_received     = 0;
+    clock_t::time_point first_message;
+    clock_t::time_point last_message;
+
+    auto init_wrapper = [&](mrc::segment::Builder& builder) {
+        auto source      = builder.construct_object<FileSourceStage>("file_source", data_file, repeat);
+        auto deserialize = builder.construct_object<DeserializeStage<MultiMessage>>(
+            "deserialize", batch_size, true, nullptr);
+        auto preallocate =
+            builder.construct_object<PreallocateStage<MultiMessage>>("preallocate", needed_columns);
+
+        auto mock_inference = builder.make_node<std::shared_ptr<MultiMessage>, std::shared_ptr<MultiResponseMessage>>(
+            "mock_inference", rxcpp::operators::map([&](std::shared_ptr<MultiMessage> msg) {
+                {
+                    std::lock_guard<std::mutex> guard(stamp_mutex);
+                    stamps.push_back(clock_t::now());
+                }
+
+                auto memory = std::make_shared<ResponseMemory>(msg->mess_count);
+                memory->set_tensor(
+                    "probs",
+                    Tensor::create(probs_buffer, DType(TypeId::FLOAT32), {msg->mess_count, NumLabels}, {NumLabels, 1}));
+
+                return std::make_shared<MultiResponseMessage>(msg->meta, msg->mess_offset, msg->mess_count, memory);
+            }));
+
+        auto add_class = builder.construct_object<AddClassificationsStage>("add_class", idx2label, 0.5F);
+        auto serialize = builder.construct_object<SerializeStage>(
+            "serialize", std::vector<std::string>{}, std::vector<std::string>{}, true);
+
+        auto sink = builder.make_sink<std::shared_ptr<MessageMeta>>("sink", [&](std::shared_ptr<MessageMeta> meta) {
+            const auto now = clock_t::now();
+
+            clock_t::time_point start;
+            {
+                std::lock_guard<std::mutex> guard(stamp_mutex);
+                start = stamps.front();
+                stamps.pop_front();
+            }
+
+            if (messages_received == 0)
+            {
+                first_message = now;
+            }
+
+            ++messages_received;
+            rows_received += meta->count();
+            last_message = now;
+            latencies_ms.push_back(latency_t(now - start).count());
+        });
+
+        builder.make_edge(source, deserialize);
+        builder.make_edge(deserialize, preallocate);
+        builder.make_edge(preallocate, mock_inference);
+        builder.make_edge(mock_inference, add_class);
+        builder.make_edge(add_class, serialize);
+        builder.make_edge(serialize, sink);
+    };
+
+    auto pipeline = mrc::make_pipeline();
+    pipeline->make_segment("main", init_wrapper);
+
+    auto options = std::make_shared<mrc::Options>();
+    options->topology().user_cpuset("0-1");
+    options->topology().restrict_gpus(true);
+    options->engine_factories().set_default_engine_type(mrc::runnable::EngineType::Thread);
+
+    mrc::Executor executor(options);
+    executor.register_pipeline(std::move(pipeline));
+    executor.start();
+    executor.join();
+
+    const auto wall_seconds = std::chrono::duration<double>(last_message - first_message).count();
+
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+
+    std::cout << "messages:       " << messages_received << "\n"
+              << "rows:           " << rows_received << "\n"
+              << "wall time:      " << wall_seconds << " s\n"
+              << "throughput:     " << (wall_seconds > 0 ? static_cast<double>(rows_received) / wall_seconds : 0.0)
+              << " rows/s\n"
+              << "latency p50:    " << percentile(latencies_ms, 0.50) << " ms\n"
+              << "latency p95:    " << percentile(latencies_ms, 0.95) << " ms\n"
+              << "latency p99:    " << percentile(latencies_ms, 0.99) << " ms\n";
+
+    return 0;
+}
@@ -20,21 +20,27 @@ add_library(morpheus
   src/io/data_loader_registry.cpp
   src/io/data_loader.cpp
   src/io/deserializers.cpp
+  src/io/gds.cpp
   src/io/loaders/file.cpp
   src/io/loaders/grpc.cpp
   src/io/loaders/lambda.cpp
   src/io/loaders/payload.cpp
   src/io/loaders/rest.cpp
+  src/io/parquet_writer.cpp
   src/io/serializers.cpp
   src/llm/input_map.cpp
   src/llm/llm_context.cpp
+  src/llm/llm_embedding_node.cpp
   src/llm/llm_engine.cpp
   src/llm/llm_node_runner.cpp
   src/llm/llm_node.cpp
+  src/llm/llm_retriever_node.cu
   src/llm/llm_task_handler_runner.cpp
   src/llm/llm_task.cpp
+src/llm/llm_task_handler.cpp
   src/llm/utils.cpp
   src/messages/control.cpp
+  src/messages/convert.cpp
   src/messages/memory/inference_memory_fil.cpp
   src/messages/memory/inference_memory_nlp.cpp
   src/messages/memory/inference_memory.cpp
@@ -51,6 +57,9 @@ add_library(morpheus
   src/messages/multi_tensor.cpp
   src/messages/multi.cpp
   src/modules/data_loader_module.cpp
+  src/modules/hash_partition_module.cpp
+  src/objects/arrow_data_table.cpp
+  src/objects/cpp_data_table.cpp
   src/objects/data_table.cpp
   src/objects/dev_mem_info.cpp
   src/objects/dtype.cpp
@@ -62,26 +71,49 @@ add_library(morpheus
   src/objects/rmm_tensor.cpp
   src/objects/table_info.cpp
   src/objects/tensor_object.cpp
+  src/objects/tensor_object.cu
   src/objects/tensor.cpp
   src/objects/wrapped_tensor.cpp
   src/stages/add_classification.cpp
   src/stages/add_scores_stage_base.cpp
   src/stages/add_scores.cpp
+  src/stages/dedupe.cpp
   src/stages/deserialize.cpp
+  src/stages/directory_source.cpp
+  src/stages/enrichment.cpp
   src/stages/file_source.cpp
   src/stages/filter_detection.cpp
+  src/stages/groupby_window.cpp
   src/stages/http_server_source_stage.cpp
+  src/stages/ipc_sink.cpp
+  src/stages/ipc_source.cpp
+  src/stages/kafka_sink.cpp
   src/stages/kafka_source.cpp
+  src/stages/mock_inference.cpp
+  src/stages/prefilter.cpp
   src/stages/preprocess_fil.cpp
   src/stages/preprocess_nlp.cpp
+  src/stages/regex_extract.cpp
   src/stages/serialize.cpp
+  src/stages/trigger.cpp
   src/stages/triton_inference.cpp
   src/stages/write_to_file.cpp
+  src/utilities/buffer_pool.cpp
+  src/utilities/cuda_graph.cpp
   src/utilities/cudf_util.cpp
   src/utilities/cupy_util.cpp
+  src/utilities/device_util.cpp
+  src/utilities/edge_gauges.cpp
+  src/utilities/gpu_sampler.cpp
   src/utilities/http_server.cpp
   src/utilities/matx_util.cu
+  src/utilities/memory_arena.cpp
+  src/utilities/memory_telemetry.cpp
+  src/utilities/metrics_exporter.cpp
+  src/utilities/pinned_memory.cpp
   src/utilities/python_util.cpp
+  src/utilities/stage_latency.cpp
+  src/utilities/stream_pool.cpp
   src/utilities/string_util.cpp
   src/utilities/table_util.cpp
   src/utilities/tensor_util.cpp
@@ -89,10 +121,19 @@ add_library(morpheus
 
 add_library(${PROJECT_NAME}::morpheus ALIAS morpheus)
 
+# PUBLIC so the header-only stages (deserialize, preallocate, ...) see the same setting as the library
+target_compile_definitions(morpheus
+  PUBLIC
+    $<$<BOOL:${MORPHEUS_ENABLE_NVTX}>:MORPHEUS_ENABLE_NVTX>
+)
+
 target_link_libraries(morpheus
   PRIVATE
+    CUDA::nvml
+    gRPC::grpc++
     matx::matx
-    $<$<CONFIG:Debug>:ZLIB::ZLIB>
+    zstd::libzstd_shared
+    ZLIB::ZLIB
   PUBLIC
     $<TARGET_NAME_IF_EXISTS:conda_env>
     cudf::cudf
@@ -13,10 +13,23 @@ __all__ = [
     "FileTypes",
     "FilterSource",
     "HttpServer",
+    "MetricsExporter",
     "Tensor",
     "TypeId",
+    "create_memory_arena",
     "determine_file_type",
+    "edge_gauge_stats",
+    "gpu_utilization_samples",
+    "gpu_utilization_stats",
+    "install_memory_telemetry",
+    "memory_arena_stats",
     "read_file_to_df",
+    "reset_edge_gauge_stats",
+    "reset_stage_latency_stats",
+    "stage_latency_stats",
+    "stage_memory_stats",
+    "start_gpu_sampler",
+    "stop_gpu_sampler",
     "typeid_to_numpy_str",
     "write_df_to_file"
 ]
@@ -25,11 +38,13 @@ __all__ = [
 class FiberQueue():
     def __enter__(self) -> FiberQueue: ...
     def __exit__(self, arg0: object, arg1: object, arg2: object) -> None: ...
-    def __init__(self, max_size: int) -> None: ...
+    def __init__(self, max_size: int, lock_free: bool = False) -> None: ...
     def close(self) -> None: ...
     def get(self, block: bool = True, timeout: float = 0.0) -> object: ...
+    def get_all(self, max_n: int, block: bool = True, timeout: float = 0.0) -> list: ...
     def is_closed(self) -> bool: ...
     def put(self, item: object, block: bool = True, timeout: float = 0.0) -> None: ...
+    def put_all(self, items: list, block: bool = True, timeout: float = 0.0) -> None: ...
     pass
 class FileTypes():
     """
@@ -44,6 +59,8 @@ class FileTypes():
       CSV
 
       PARQUET
+
+      ARROW
     """
     def __eq__(self, other: object) -> bool: ...
     def __getstate__(self) -> int: ...
@@ -64,11 +81,12 @@ class FileTypes():
         """
         :type: int
         """
+    ARROW: morpheus._lib.common.FileTypes # value = <FileTypes.ARROW: 4>
     Auto: morpheus._lib.common.FileTypes # value = <FileTypes.Auto: 0>
     CSV: morpheus._lib.common.FileTypes # value = <FileTypes.CSV: 2>
     JSON: morpheus._lib.common.FileTypes # value = <FileTypes.JSON: 1>
     PARQUET: morpheus._lib.common.FileTypes # value = <FileTypes.PARQUET: 3>
-    __members__: dict # value = {'Auto': <FileTypes.Auto: 0>, 'JSON': <FileTypes.JSON: 1>, 'CSV': <FileTypes.CSV: 2>, 'PARQUET': <FileTypes.PARQUET: 3>}
+    __members__: dict # value = {'Auto': <FileTypes.Auto: 0>, 'JSON': <FileTypes.JSON: 1>, 'CSV': <FileTypes.CSV: 2>, 'PARQUET': <FileTypes.PARQUET: 3>, 'ARROW': <FileTypes.ARROW: 4>}
     pass
 class FilterSource():
     """
@@ -114,6 +132,15 @@ class HttpServer():
     def start(self) -> None: ...
     def stop(self) -> None: ...
     pass
+class MetricsExporter():
+    def __enter__(self) -> MetricsExporter: ...
+    def __exit__(self, arg0: object, arg1: object, arg2: object) -> None: ...
+    def __init__(self, bind_address: str = '127.0.0.1', port: int = 9105, endpoint: str = '/metrics', num_threads: int = 1) -> None: ...
+    def is_running(self) -> bool: ...
+    def render(self) -> str: ...
+    def start(self) -> None: ...
+    def stop(self) -> None: ...
+    pass
 class Tensor():
     @staticmethod
     def from_cupy(arg0: object) -> Tensor: ...
@@ -190,10 +217,34 @@ class TypeId():
     UINT8: morpheus._lib.common.TypeId # value = <TypeId.UINT8: 5>
     __members__: dict # value = {'EMPTY': <TypeId.EMPTY: 0>, 'INT8': <TypeId.INT8: 1>, 'INT16': <TypeId.INT16: 2>, 'INT32': <TypeId.INT32: 3>, 'INT64': <TypeId.INT64: 4>, 'UINT8': <TypeId.UINT8: 5>, 'UINT16': <TypeId.UINT16: 6>, 'UINT32': <TypeId.UINT32: 7>, 'UINT64': <TypeId.UINT64: 8>, 'FLOAT32': <TypeId.FLOAT32: 9>, 'FLOAT64': <TypeId.FLOAT64: 10>, 'BOOL8': <TypeId.BOOL8: 11>, 'STRING': <TypeId.STRING: 12>}
     pass
+def create_memory_arena(name: str, budget_bytes: int = 0) -> None:
+    pass
 def determine_file_type(filename: str) -> FileTypes:
     pass
+def edge_gauge_stats() -> typing.Dict[str, typing.Dict[str, float]]:
+    pass
+def gpu_utilization_samples() -> typing.List[typing.Dict[str, float]]:
+    pass
+def gpu_utilization_stats() -> typing.Dict[str, float]:
+    pass
+def install_memory_telemetry() -> None:
+    pass
+def memory_arena_stats() -> typing.Dict[str, typing.Dict[str, float]]:
+    pass
 def read_file_to_df(filename: str, file_type: FileTypes = FileTypes.Auto) -> object:
     pass
+def reset_edge_gauge_stats() -> None:
+    pass
+def reset_stage_latency_stats() -> None:
+    pass
+def stage_latency_stats() -> typing.Dict[str, typing.Dict[str, float]]:
+    pass
+def stage_memory_stats() -> typing.Dict[str, typing.Dict[str, float]]:
+    pass
+def start_gpu_sampler(interval_ms: int = 100, device_index: int = 0) -> bool:
+    pass
+def stop_gpu_sampler() -> None:
+    pass
 def typeid_to_numpy_str(arg0: TypeId) -> str:
     pass
 def write_df_to_file(df: object, filename: str, file_type: FileTypes = FileTypes.Auto, **kwargs) -> None:
@@ -28,8 +28,13 @@
 #include "morpheus/objects/filter_source.hpp"
 #include "morpheus/objects/tensor_object.hpp"  // for TensorObject
 #include "morpheus/objects/wrapped_tensor.hpp"
-#include "morpheus/utilities/cudf_util.hpp"
+#include "morpheus/utilities/edge_gauges.hpp"  // for EdgeGaugeRegistry
+#include "morpheus/utilities/gpu_sampler.hpp"  // for GpuUtilizationSampler
 #include "morpheus/utilities/http_server.hpp"
+#include "morpheus/utilities/memory_arena.hpp"      // for MemoryArenaRegistry
+#include "morpheus/utilities/memory_telemetry.hpp"  // for StageMemoryRegistry, install_memory_telemetry
+#include "morpheus/utilities/metrics_exporter.hpp"  // for MetricsExporter
+#include "morpheus/utilities/stage_latency.hpp"     // for LatencyRegistry
 #include "morpheus/version.hpp"
 
 #include <mrc/utils/string_utils.hpp>
@@ -37,10 +42,14 @@
 #include <pybind11/attr.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/pytypes.h>  // for return_value_policy::reference
+#include <pybind11/stl.h>      // for map conversions in stage_latency_stats
 
+#include <chrono>  // for milliseconds
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace morpheus {
 namespace py = pybind11;
@@ -54,9 +63,6 @@ PYBIND11_MODULE(common, _module)
            :toctree: _generate
         )pbdoc";
 
-    // Load the cudf helpers
-    CudfHelper::load();
-
     LoaderRegistry::register_factory_fn(
         "file", [](nlohmann::json config) { return std::make_unique<FileDataLoader>(config); }, false);
     LoaderRegistry::register_factory_fn(
@@ -74,9 +80,19 @@ PYBIND11_MODULE(common, _module)
         .def_static("from_cupy", &TensorObjectInterfaceProxy::from_cupy, py::keep_alive<0, 1>());
 
     py::class_<FiberQueue, std::shared_ptr<FiberQueue>>(_module, "FiberQueue")
-        .def(py::init<>(&FiberQueueInterfaceProxy::init), py::arg("max_size"))
+        .def(py::init<>(&FiberQueueInterfaceProxy::init), py::arg("max_size"), py::arg("lock_free") = false)
         .def("get", &FiberQueueInterfaceProxy::get, py::arg("block") = true, py::arg("timeout") = 0.0)
+        .def("get_all",
+             &FiberQueueInterfaceProxy::get_all,
+             py::arg("max_n"),
+             py::arg("block")   = true,
+             py::arg("timeout") = 0.0)
         .def("put", &FiberQueueInterfaceProxy::put, py::arg("item"), py::arg("block") = true, py::arg("timeout") = 0.0)
+        .def("put_all",
+             &FiberQueueInterfaceProxy::put_all,
+             py::arg("items"),
+             py::arg("block")   = true,
+             py::arg("timeout") = 0.0)
         .def("close", &FiberQueueInterfaceProxy::close)
         .def("is_closed", &FiberQueueInterfaceProxy::is_closed)
         .def("__enter__", &FiberQueueInterfaceProxy::enter, py::return_value_policy::reference)
@@ -104,7 +120,8 @@ PYBIND11_MODULE(common, _module)
         .value("Auto", FileTypes::Auto)
         .value("JSON", FileTypes::JSON)
         .value("CSV", FileTypes::CSV)
-        .value("PARQUET", FileTypes::PARQUET);
+        .value("PARQUET", FileTypes::PARQUET)
+        .value("ARROW", FileTypes::ARROW);
 
     _module.def("typeid_to_numpy_str", [](TypeId tid) { return DType(tid).type_str(); });
 
@@ -116,6 +133,92 @@ PYBIND11_MODULE(common, _module)
                 py::arg("filename"),
                 py::arg("file_type") = FileTypes::Auto);
 
+    _module.def(
+        "stage_latency_stats",
+        []() { return LatencyRegistry::instance().all_stats(); },
+        "Aggregated per-stage latency histograms, keyed by stage name. Each entry reports count, mean_us, p50_us, "
+        "p95_us, p99_us and max_us.");
+    _module.def(
+        "reset_stage_latency_stats",
+        []() { LatencyRegistry::instance().reset_all(); },
+        "Reset all per-stage latency histograms, starting a new measurement window.");
+
+    _module.def(
+        "edge_gauge_stats",
+        []() { return EdgeGaugeRegistry::instance().all_stats(); },
+        "Gauges for the bounded queues between pipeline threads, keyed by edge name. Each entry reports depth, "
+        "high_water, enqueued and blocked_ms; the saturated edge is the one whose depth sits at its bound and "
+        "whose blocked_ms keeps growing.");
+    _module.def(
+        "reset_edge_gauge_stats",
+        []() { EdgeGaugeRegistry::instance().reset_all(); },
+        "Reset the high-water marks and blocked-time accumulators of all edge gauges, starting a new measurement "
+        "window. Current depths are left alone.");
+
+    _module.def("install_memory_telemetry",
+                &install_memory_telemetry,
+                "Wrap the current RMM device resource so device allocations are attributed to the active stage. "
+                "Idempotent; call after the final RMM resource is configured and before the pipeline starts.");
+    _module.def(
+        "stage_memory_stats",
+        []() { return StageMemoryRegistry::instance().all_stats(); },
+        "Per-stage device-memory counters, keyed by stage name. Each entry reports current_bytes, peak_bytes, "
+        "total_bytes and allocation_count; allocations made outside any stage scope appear under '(untagged)'. "
+        "Empty unless install_memory_telemetry() has been called.");
+
+    _module.def(
+        "create_memory_arena",
+        [](const std::string& name, std::size_t budget_bytes) {
+            MemoryArenaRegistry::instance().get_or_create(name, budget_bytes);
+        },
+        py::arg("name"),
+        py::arg("budget_bytes") = 0,
+        "Create (or look up) a named RMM arena sub-allocator with an independent budget. Pipelines sharing a "
+        "process each carve their allocations out of their own arena, so one pipeline's burst cannot fragment "
+        "or exhaust the pool for the others. The budget only applies on first creation; 0 leaves it unbounded.");
+    _module.def(
+        "memory_arena_stats",
+        []() { return MemoryArenaRegistry::instance().all_stats(); },
+        "Per-arena device-memory counters, keyed by arena name. Each entry reports current_bytes, peak_bytes, "
+        "total_bytes, allocation_count and budget_bytes.");
+
+    _module.def(
+        "start_gpu_sampler",
+        [](std::size_t interval_ms, unsigned int device_index) {
+            return GpuUtilizationSampler::instance().start(std::chrono::milliseconds(interval_ms), device_index);
+        },
+        py::arg("interval_ms")  = 100,
+        py::arg("device_index") = 0,
+        "Start the NVML-based GPU utilization sampler, recording SM occupancy, memory-controller utilization and "
+        "PCIe throughput on the same clock as the per-stage telemetry. Returns False when NVML is unavailable, in "
+        "which case the pipeline runs unsampled.");
+    _module.def(
+        "stop_gpu_sampler",
+        []() { GpuUtilizationSampler::instance().stop(); },
+        "Stop the GPU utilization sampler. Recorded samples remain readable until the sampler is started again.");
+    _module.def(
+        "gpu_utilization_stats",
+        []() { return GpuUtilizationSampler::instance().stats(); },
+        "Summary of the recorded GPU utilization timeline: sample_count plus mean and peak values for SM percent, "
+        "memory-controller percent and PCIe RX/TX MB/s.");
+    _module.def(
+        "gpu_utilization_samples",
+        []() {
+            std::vector<std::map<std::string, double>> rows;
+            for (const auto& sample : GpuUtilizationSampler::instance().samples())
+            {
+                rows.push_back({{"timestamp_ms", static_cast<double>(sample.timestamp_ms)},
+                                {"sm_percent", sample.sm_percent},
+                                {"memory_percent", sample.memory_percent},
+                                {"pcie_rx_mbs", sample.pcie_rx_mbs},
+                                {"pcie_tx_mbs", sample.pcie_tx_mbs}});
+            }
+
+            return rows;
+        },
+        "Raw GPU utilization timeline, oldest sample first. Timestamps are steady-clock milliseconds, directly "
+        "comparable with the stage latency and edge gauge measurement windows.");
+
     py::enum_<FilterSource>(
         _module, "FilterSource", "Enum to indicate which source the FilterDetectionsStage should operate on.")
         .value("Auto", FilterSource::Auto)
@@ -138,6 +241,19 @@ PYBIND11_MODULE(common, _module)
         .def("__enter__", &HttpServerInterfaceProxy::enter, py::return_value_policy::reference)
         .def("__exit__", &HttpServerInterfaceProxy::exit);
 
+    py::class_<MetricsExporter, std::shared_ptr<MetricsExporter>>(_module, "MetricsExporter")
+        .def(py::init<>(&MetricsExporterInterfaceProxy::init),
+             py::arg("bind_address") = "127.0.0.1",
+             py::arg("port")         = 9105,
+             py::arg("endpoint")     = "/metrics",
+             py::arg("num_threads")  = 1)
+        .def("start", &MetricsExporterInterfaceProxy::start)
+        .def("stop", &MetricsExporterInterfaceProxy::stop)
+        .def("is_running", &MetricsExporterInterfaceProxy::is_running)
+        .def("render", &MetricsExporterInterfaceProxy::render)
+        .def("__enter__", &MetricsExporterInterfaceProxy::enter, py::return_value_policy::reference)
+        .def("__exit__", &MetricsExporterInterfaceProxy::exit);
+
     _module.attr("__version__") =
         MRC_CONCAT_STR(morpheus_VERSION_MAJOR << "." << morpheus_VERSION_MINOR << "." << morpheus_VERSION_PATCH);
 }
@@ -10,5 +10,6 @@ __all__ = [
 
 
 class DocaSourceStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, nic_pci_address: str, gpu_pci_address: str) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, nic_pci_address: str, gpu_pci_address: str, rx_queue_count: int = 1, persistent_kernel: bool = False, flow_table_snapshot_interval: int = 0, lcores: str = '', socket_mem: str = '') -> None: ...
+    def get_capture_stats(self) -> typing.Dict[str, int]: ...
     pass
@@ -27,3 +27,6 @@ uint32_t const PACKET_RX_TIMEOUT_NS = 5000;
 uint32_t const MAX_PKT_RECEIVE = PACKETS_PER_BLOCK;
 uint32_t const MAX_PKT_SIZE    = 8192;
 uint32_t const MAX_PKT_NUM     = 65536;
+
+// Slot count of the GPU-resident flow table, must be a power of two
+uint32_t const FLOW_TABLE_CAPACITY = 65536;
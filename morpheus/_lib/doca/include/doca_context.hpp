@@ -47,7 +47,7 @@ struct DocaContext
     std::unique_ptr<RTEContext> m_rte_context;
 
   public:
-    DocaContext(std::string nic_addr, std::string gpu_addr);
+    DocaContext(std::string nic_addr, std::string gpu_addr, RTEOptions rte_options = {});
     ~DocaContext();
 
     doca_gpu* gpu();
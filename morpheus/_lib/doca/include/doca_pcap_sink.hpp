@@ -0,0 +1,98 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/io/gds.hpp"  // for GDSFileHandle
+#include "morpheus/messages/meta.hpp"
+
+#include <mrc/segment/builder.hpp>
+#include <pymrc/node.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <sys/types.h>  // for off_t
+
+namespace morpheus {
+
+#pragma GCC visibility push(default)
+
+/**
+ * @brief Archives the packet tables emitted by `DocaSourceStage` to a pcapng file, writing the captured bytes
+ * straight from device memory via cuFile (GPUDirect Storage) when available.
+ *
+ * Each packet becomes an Enhanced Packet Block: the block headers are assembled on the host and written through
+ * a buffered descriptor, while the packet bytes are written from the table's device buffer into their file
+ * offsets through the registered cuFile handle, so the payloads never bounce through host memory. When GDS is
+ * unavailable (no driver, unsupported filesystem) the sink falls back to copying the bytes to the host once per
+ * table and writing everything host-side.
+ *
+ * The receive kernels parse L2-L4 headers into their own columns and do not retain the raw frames, so the
+ * archived bytes are the captured payloads (post snap-length); the interface block is tagged LINKTYPE_USER0 to
+ * make that explicit. Messages without the packet schema (e.g. flow table snapshots sharing the source's
+ * output) pass through unarchived. The stage forwards every message unchanged, so it sits on the analytic path
+ * without consuming it.
+ */
+class DocaPcapSinkStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new DocaPcapSinkStage.
+     *
+     * @param filename : pcapng file to create; an existing file is truncated
+     */
+    DocaPcapSinkStage(std::string const& filename);
+
+    ~DocaPcapSinkStage() override;
+
+  private:
+    subscribe_fn_t build();
+
+    void write_packet_table(MessageMeta& meta);
+    void write_host(const void* data, std::size_t size, off_t file_offset);
+    void close();
+
+    std::string m_filename;
+    int m_fd{-1};          // buffered descriptor for the block headers and the fallback path
+    off_t m_file_offset{0};
+
+    GDSFileHandle m_gds;
+};
+
+/****** DocaPcapSinkStageInterfaceProxy***********************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct DocaPcapSinkStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a DocaPcapSinkStage, and return the result.
+     */
+    static std::shared_ptr<mrc::segment::Object<DocaPcapSinkStage>> init(mrc::segment::Builder& builder,
+                                                                         std::string const& name,
+                                                                         std::string const& filename);
+};
+
+#pragma GCC visibility pop
+
+}  // namespace morpheus
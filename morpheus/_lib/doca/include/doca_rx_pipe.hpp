@@ -21,6 +21,7 @@
 #include "doca_rx_queue.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace morpheus::doca {
 
@@ -32,19 +33,19 @@ namespace morpheus::doca {
  * TCP/UDP as well as other types of filtering is done with GPUNetIO. Eventually packets will be
  * placed in a Receive Queue at which point they can be read using a Semaphore.
  *
- * In this implementation, a single Root Pipe is connected to a single TCP-filtering Pipe which is
- * then connected to the given Receive Queue.
+ * In this implementation, a single Root Pipe is connected to a single TCP-filtering Pipe which
+ * RSS-distributes matching packets across the given Receive Queues.
  */
 struct DocaRxPipe
 {
   private:
     std::shared_ptr<DocaContext> m_context;
-    std::shared_ptr<DocaRxQueue> m_rxq;
+    std::vector<std::shared_ptr<DocaRxQueue>> m_rxq;
     doca_flow_pipe* m_pipe;
     doca_flow_pipe* m_root_pipe;
 
   public:
-    DocaRxPipe(std::shared_ptr<DocaContext> context, std::shared_ptr<DocaRxQueue> rxq);
+    DocaRxPipe(std::shared_ptr<DocaContext> context, std::vector<std::shared_ptr<DocaRxQueue>> rxq);
     ~DocaRxPipe();
 };
 
@@ -22,16 +22,32 @@
 #include <mrc/segment/builder.hpp>
 #include <pymrc/node.hpp>
 
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
+
+namespace rmm {
+
+template <typename T>
+class device_uvector;
+
+}  // namespace rmm
 
 namespace morpheus {
 
 namespace doca {
 
+struct CaptureStats;
 struct DocaContext;
 struct DocaRxQueue;
 struct DocaRxPipe;
 struct DocaSemaphore;
+struct FlowRecord;
+
+template <typename T>
+struct DocaMem;
 
 }  // namespace doca
 
@@ -40,6 +56,27 @@ struct DocaSemaphore;
 /**
  * @brief Receives a firehose of raw packets from a GPUNetIO-enabled device.
  *
+ * Packets are RSS-distributed across `rx_queue_count` receive queue / semaphore pairs, each drained by its own
+ * GPU kernel, and the per-queue results are merged into a single packet table per emission. Line-rate capture on
+ * 100Gbps links requires at least 4 queues.
+ *
+ * With `persistent_kernel` enabled each queue is drained by a single long-running kernel that polls the DOCA
+ * semaphore in device code, removing the per-burst launch latency that dominates at small burst sizes.
+ *
+ * With `flow_table_snapshot_interval` > 0 the kernels additionally maintain a GPU-resident flow table keyed by
+ * the packet 5-tuple, and every N emitted packet tables a snapshot of the per-flow statistics is emitted on the
+ * same output as an additional MessageMeta. This replaces host-side flow accounting, which costs a full extra
+ * pass over the packet table.
+ *
+ * The receive kernels accumulate capture counters (packets, payload bytes, bursts, full bursts, semaphore-full
+ * and host-stall events) in host-visible memory; `get_capture_stats()` reads them without touching the hot path,
+ * so capture loss can be alerted on by polling.
+ *
+ * With `snap_length` > 0 the kernels copy only the first N payload bytes per packet into the emitted table;
+ * header fields are parsed from the packet buffer either way, so netflow-style pipelines that only need L2-L4
+ * headers can snap aggressively. Flows flagged via `flag_flow()` are exempt and keep their full payloads, which
+ * requires flow accounting to be enabled. 0 captures every payload in full.
+ *
  * Tested only on ConnectX 6-Dx with a single GPU on the same NUMA node running firmware 24.35.2000
  */
 class DocaSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<MessageMeta>>
@@ -49,15 +86,43 @@ class DocaSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<MessageM
     using typename base_t::source_type_t;
     using typename base_t::subscriber_fn_t;
 
-    DocaSourceStage(std::string const& nic_pci_address, std::string const& gpu_pci_address);
+    DocaSourceStage(std::string const& nic_pci_address,
+                    std::string const& gpu_pci_address,
+                    uint16_t rx_queue_count = 1,
+                    bool persistent_kernel  = false,
+                    uint32_t flow_table_snapshot_interval = 0,
+                    uint32_t snap_length                  = 0,
+                    std::string const& lcores             = "",
+                    std::string const& socket_mem         = "");
+
+    /**
+     * @brief Reads the device-side capture counters. Safe to call at any time from any thread; counters are
+     * cumulative since capture start.
+     */
+    std::map<std::string, uint64_t> get_capture_stats() const;
+
+    /**
+     * @brief Marks a flow (host byte order tuple, as reported by the flow snapshots) for full-payload capture,
+     * exempting it from the snap length. A flow not yet seen can be flagged ahead of its first packet. Requires
+     * `flow_table_snapshot_interval` > 0.
+     */
+    void flag_flow(std::string const& src_ip, std::string const& dst_ip, uint16_t src_port, uint16_t dst_port);
 
   private:
     subscriber_fn_t build();
 
+    bool m_persistent_kernel{false};
+    uint32_t m_flow_table_snapshot_interval{0};
+    uint32_t m_snap_length{0};
+
     std::shared_ptr<morpheus::doca::DocaContext> m_context;
-    std::shared_ptr<morpheus::doca::DocaRxQueue> m_rxq;
+    std::vector<std::shared_ptr<morpheus::doca::DocaRxQueue>> m_rxq;
     std::shared_ptr<morpheus::doca::DocaRxPipe> m_rxpipe;
-    std::shared_ptr<morpheus::doca::DocaSemaphore> m_semaphore;
+    std::vector<std::shared_ptr<morpheus::doca::DocaSemaphore>> m_semaphore;
+    std::shared_ptr<morpheus::doca::DocaMem<morpheus::doca::CaptureStats>> m_capture_stats;
+
+    // Allocated in the constructor (not lazily in build()) so flag_flow() works before capture starts
+    std::shared_ptr<rmm::device_uvector<morpheus::doca::FlowRecord>> m_flow_table;
 };
 
 /****** DocaSourceStageInterfaceProxy***********************/
@@ -72,7 +137,27 @@ struct DocaSourceStageInterfaceProxy
     static std::shared_ptr<mrc::segment::Object<DocaSourceStage>> init(mrc::segment::Builder& builder,
                                                                        std::string const& name,
                                                                        std::string const& nic_pci_address,
-                                                                       std::string const& gpu_pci_address);
+                                                                       std::string const& gpu_pci_address,
+                                                                       uint16_t rx_queue_count,
+                                                                       bool persistent_kernel,
+                                                                       uint32_t flow_table_snapshot_interval,
+                                                                       uint32_t snap_length,
+                                                                       std::string const& lcores,
+                                                                       std::string const& socket_mem);
+
+    /**
+     * @brief Read the stage's device-side capture counters as a name -> value map.
+     */
+    static std::map<std::string, uint64_t> get_capture_stats(mrc::segment::Object<DocaSourceStage>& self);
+
+    /**
+     * @brief Mark a flow for full-payload capture, exempting it from the snap length.
+     */
+    static void flag_flow(mrc::segment::Object<DocaSourceStage>& self,
+                          std::string const& src_ip,
+                          std::string const& dst_ip,
+                          uint16_t src_port,
+                          uint16_t dst_port);
 };
 
 #pragma GCC visibility pop
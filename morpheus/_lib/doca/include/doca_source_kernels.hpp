@@ -19,6 +19,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <doca_eth_rxq.h>
 #include <doca_flow.h>
 #include <doca_gpunetio.h>
@@ -29,12 +30,43 @@
 
 namespace morpheus::doca {
 
-std::unique_ptr<cudf::column> gather_payload(
-    int32_t packet_count,
-    char* payload_buffer,
-    int32_t* payload_sizes,
-    rmm::cuda_stream_view stream        = cudf::detail::default_stream_value,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+/**
+ * @brief One slot of the GPU-resident flow table: a claimed 5-tuple plus its running counters. `key` is a
+ * 64-bit mix of the tuple used to claim the slot atomically; zero marks an empty slot. Counters are cumulative
+ * since capture start.
+ */
+struct FlowRecord
+{
+    unsigned long long key;
+    uint32_t src_ip;
+    uint32_t dst_ip;
+    uint16_t src_port;
+    uint16_t dst_port;
+    unsigned long long packet_count;
+    unsigned long long byte_count;
+    uint32_t first_timestamp;
+    uint32_t last_timestamp;
+    uint32_t tcp_flags_seen;
+    uint32_t last_seq;
+    uint32_t flagged;  // non-zero exempts the flow from snap-length truncation
+};
+
+/**
+ * @brief Device-side capture counters accumulated by the receive kernels with atomics, cumulative since
+ * capture start. Must live in host-visible memory (DOCA_GPU_MEM_GPU_CPU) so the host can poll it while
+ * kernels are resident. payload_bytes_received counts the bytes actually copied out, so it reflects the
+ * snap length when one is set. Burst occupancy is packets_received / (bursts_received * PACKETS_PER_BLOCK);
+ * full_bursts counts bursts that hit PACKETS_PER_BLOCK, where NIC-side drops become likely.
+ */
+struct CaptureStats
+{
+    unsigned long long packets_received;
+    unsigned long long payload_bytes_received;
+    unsigned long long bursts_received;
+    unsigned long long full_bursts;
+    unsigned long long sem_full_events;    // receive waited on a still-occupied semaphore slot
+    unsigned long long host_stall_events;  // persistent kernel waited on the host to release a burst
+};
 
 std::unique_ptr<cudf::column> integers_to_mac(
     cudf::column_view const& integers,
@@ -46,9 +78,9 @@ void packet_receive_kernel(doca_gpu_eth_rxq* rxq_info,
                            int32_t sem_count,
                            int32_t* sem_idx,
                            int32_t* packet_count_out,
-                           char* payload_buffer_out,
+                           char* payload_chars_out,
                            int32_t* payload_size_total_out,
-                           int32_t* payload_sizes_out,
+                           int32_t* payload_offsets_out,
                            int64_t* src_mac_out,
                            int64_t* dst_mac_out,
                            int64_t* src_ip_out,
@@ -59,10 +91,67 @@ void packet_receive_kernel(doca_gpu_eth_rxq* rxq_info,
                            int32_t* ether_type_out,
                            int32_t* next_proto_id_out,
                            uint32_t* timestamp_out,
+                           int32_t snap_len,
+                           FlowRecord* flow_table,
+                           CaptureStats* stats,
                            uint32_t* exit_condition,
                            cudaStream_t stream);
 
-void packet_gather_kernel(
-    int32_t packet_count, char* packet_buffer, int32_t* payload_sizes, char* payload_chars_out, cudaStream_t stream);
+/**
+ * @brief Launches a persistent receive kernel that polls the DOCA semaphore in device code and
+ * publishes each finished burst through `burst_ready`, avoiding a kernel launch per burst.
+ * `packet_count_out`, `payload_size_total_out` and `burst_ready` must be host-visible
+ * (DOCA_GPU_MEM_GPU_CPU); the host resets `burst_ready` to 0 once it has consumed the outputs.
+ * With `snap_len` > 0 only the first snap_len payload bytes per packet are copied out, except for
+ * flows flagged in the flow table which are captured in full. The kernel exits when
+ * `exit_condition` is raised.
+ */
+void packet_receive_persistent_kernel(doca_gpu_eth_rxq* rxq_info,
+                                      doca_gpu_semaphore_gpu* sem_in,
+                                      int32_t sem_count,
+                                      int32_t* sem_idx,
+                                      int32_t* packet_count_out,
+                                      char* payload_chars_out,
+                                      int32_t* payload_size_total_out,
+                                      int32_t* payload_offsets_out,
+                                      int64_t* src_mac_out,
+                                      int64_t* dst_mac_out,
+                                      int64_t* src_ip_out,
+                                      int64_t* dst_ip_out,
+                                      uint16_t* src_port_out,
+                                      uint16_t* dst_port_out,
+                                      int32_t* tcp_flags_out,
+                                      int32_t* ether_type_out,
+                                      int32_t* next_proto_id_out,
+                                      uint32_t* timestamp_out,
+                                      int32_t snap_len,
+                                      FlowRecord* flow_table,
+                                      CaptureStats* stats,
+                                      uint32_t* burst_ready,
+                                      uint32_t* exit_condition,
+                                      cudaStream_t stream);
+
+/**
+ * @brief Compacts the occupied flow table slots into a table of per-flow statistics. Column order:
+ * src_ip, dst_ip (ipv4 strings), src_port, dst_port, packets, bytes, first_timestamp, last_timestamp,
+ * tcp_flags_seen, last_seq.
+ */
+std::unique_ptr<cudf::table> flow_table_snapshot(
+    FlowRecord* flow_table,
+    int32_t capacity,
+    rmm::cuda_stream_view stream        = cudf::detail::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Marks one flow as flagged so the receive kernels capture its payloads in full even when a snap length
+ * is set. The tuple uses host byte order, matching the values the snapshot reports. A flow not yet in the table
+ * claims a slot, so flows can be flagged ahead of their first packet.
+ */
+void flow_table_flag(FlowRecord* flow_table,
+                     uint32_t src_ip,
+                     uint32_t dst_ip,
+                     uint16_t src_port,
+                     uint16_t dst_port,
+                     rmm::cuda_stream_view stream = cudf::detail::default_stream_value);
 
 }  // namespace morpheus::doca
@@ -15,12 +15,14 @@
  * limitations under the License.
  */
 
+#include "doca_pcap_sink.hpp"
 #include "doca_source.hpp"
 
 #include <mrc/segment/builder.hpp>  // IWYU pragma: keep
 #include <mrc/segment/object.hpp>
 #include <pybind11/attr.h>
 #include <pybind11/pybind11.h>  // for str_attr_accessor
+#include <pybind11/stl.h>       // IWYU pragma: keep
 #include <pymrc/utils.hpp>
 
 #include <memory>
@@ -41,7 +43,29 @@ PYBIND11_MODULE(doca, m)
              py::arg("builder"),
              py::arg("name"),
              py::arg("nic_pci_address"),
-             py::arg("gpu_pci_address"));
+             py::arg("gpu_pci_address"),
+             py::arg("rx_queue_count")               = 1,
+             py::arg("persistent_kernel")            = false,
+             py::arg("flow_table_snapshot_interval") = 0,
+             py::arg("snap_length")                  = 0,
+             py::arg("lcores")                       = "",
+             py::arg("socket_mem")                   = "")
+        .def("get_capture_stats", &DocaSourceStageInterfaceProxy::get_capture_stats)
+        .def("flag_flow",
+             &DocaSourceStageInterfaceProxy::flag_flow,
+             py::arg("src_ip"),
+             py::arg("dst_ip"),
+             py::arg("src_port"),
+             py::arg("dst_port"));
+
+    py::class_<mrc::segment::Object<DocaPcapSinkStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<DocaPcapSinkStage>>>(
+        m, "DocaPcapSinkStage", py::multiple_inheritance())
+        .def(py::init<>(&DocaPcapSinkStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("filename"));
 }
 
 }  // namespace morpheus
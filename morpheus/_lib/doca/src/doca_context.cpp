@@ -235,7 +235,7 @@ static doca_error_t get_dpdk_port_id_doca_dev(doca_dev* dev_input, uint16_t* por
     return DOCA_SUCCESS;
 }
 
-DocaContext::DocaContext(std::string nic_addr, std::string gpu_addr) : m_max_queue_count(1)
+DocaContext::DocaContext(std::string nic_addr, std::string gpu_addr, RTEOptions rte_options) : m_max_queue_count(1)
 {
     char* nic_addr_c = new char[nic_addr.size() + 1];
     char* gpu_addr_c = new char[gpu_addr.size() + 1];
@@ -246,7 +246,7 @@ DocaContext::DocaContext(std::string nic_addr, std::string gpu_addr) : m_max_que
     std::copy(nic_addr.begin(), nic_addr.end(), nic_addr_c);
     std::copy(gpu_addr.begin(), gpu_addr.end(), gpu_addr_c);
 
-    m_rte_context = std::make_unique<RTEContext>();
+    m_rte_context = std::make_unique<RTEContext>(std::move(rte_options));
 
     DOCA_TRY(parse_pci_addr(nic_addr_c, m_pci_bdf));
     DOCA_TRY(open_doca_device_with_pci(&m_pci_bdf, nullptr, &m_dev));
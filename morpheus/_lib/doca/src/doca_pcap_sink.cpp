@@ -0,0 +1,310 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "doca_pcap_sink.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <cuda_runtime.h>  // for cudaMemcpy
+#include <cudf/column/column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/types.hpp>
+#include <fcntl.h>  // for open, O_CREAT, O_TRUNC, O_WRONLY
+#include <glog/logging.h>
+#include <mrc/segment/builder.hpp>
+#include <unistd.h>  // for close, pwrite
+
+#include <cstring>  // for memcpy
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// pcapng block framing, all fields little-endian. The archived bytes are the captured payloads (the receive
+// kernels parse L2-L4 headers into their own columns and do not retain the raw frames), so the interface is
+// tagged with a user link type rather than claiming ethernet frames.
+constexpr uint32_t SECTION_HEADER_BLOCK  = 0x0A0D0D0A;
+constexpr uint32_t INTERFACE_DESCR_BLOCK = 0x00000001;
+constexpr uint32_t ENHANCED_PACKET_BLOCK = 0x00000006;
+constexpr uint32_t BYTE_ORDER_MAGIC      = 0x1A2B3C4D;
+constexpr uint16_t LINKTYPE_USER0        = 147;
+
+constexpr std::size_t EPB_HEADER_SIZE  = 28;  // up to and including the original length field
+constexpr std::size_t EPB_TRAILER_SIZE = 4;   // trailing copy of the total block length
+
+void put_u16(char* dst, uint16_t value)
+{
+    std::memcpy(dst, &value, sizeof(value));
+}
+
+void put_u32(char* dst, uint32_t value)
+{
+    std::memcpy(dst, &value, sizeof(value));
+}
+
+}  // namespace
+
+namespace morpheus {
+
+DocaPcapSinkStage::DocaPcapSinkStage(std::string const& filename) :
+  PythonNode(base_t::op_factory_from_sub_fn(build())),
+  m_filename(filename)
+{
+    m_fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (m_fd < 0)
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Failed to open pcapng output file: " << filename));
+    }
+
+    // Section header + interface description, written once up front
+    char preamble[48] = {};
+
+    put_u32(preamble + 0, SECTION_HEADER_BLOCK);
+    put_u32(preamble + 4, 28);
+    put_u32(preamble + 8, BYTE_ORDER_MAGIC);
+    put_u16(preamble + 12, 1);  // major version
+    put_u16(preamble + 14, 0);  // minor version
+    put_u32(preamble + 16, 0xFFFFFFFF);  // section length unknown
+    put_u32(preamble + 20, 0xFFFFFFFF);
+    put_u32(preamble + 24, 28);
+
+    put_u32(preamble + 28, INTERFACE_DESCR_BLOCK);
+    put_u32(preamble + 32, 20);
+    put_u16(preamble + 36, LINKTYPE_USER0);
+    put_u16(preamble + 38, 0);  // reserved
+    put_u32(preamble + 40, 0);  // snaplen unlimited; truncation is recorded per packet
+    put_u32(preamble + 44, 20);
+
+    this->write_host(preamble, sizeof(preamble), 0);
+    m_file_offset = sizeof(preamble);
+
+    // Registered after the descriptor above created the file. An invalid handle just means host-path writes.
+    m_gds = GDSFileHandle::open_write(filename);
+
+    if (!m_gds.valid())
+    {
+        LOG(INFO) << "GPUDirect Storage unavailable for '" << filename
+                  << "', packet archival will stage through host memory";
+    }
+}
+
+DocaPcapSinkStage::~DocaPcapSinkStage()
+{
+    this->close();
+}
+
+void DocaPcapSinkStage::close()
+{
+    m_gds.close();
+
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+void DocaPcapSinkStage::write_host(const void* data, std::size_t size, off_t file_offset)
+{
+    auto const* bytes = static_cast<const char*>(data);
+    std::size_t written = 0;
+
+    while (written < size)
+    {
+        auto result = ::pwrite(m_fd, bytes + written, size - written, file_offset + written);
+
+        if (result < 0)
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Failed writing pcapng file: " << m_filename));
+        }
+
+        written += result;
+    }
+}
+
+void DocaPcapSinkStage::write_packet_table(MessageMeta& meta)
+{
+    auto info  = meta.get_info();
+    auto names = info.get_column_names();
+
+    auto data_idx      = -1;
+    auto timestamp_idx = -1;
+
+    for (std::size_t i = 0; i < names.size(); i++)
+    {
+        if (names[i] == "data")
+        {
+            data_idx = static_cast<int>(i);
+        }
+        else if (names[i] == "timestamp")
+        {
+            timestamp_idx = static_cast<int>(i);
+        }
+    }
+
+    // Flow table snapshots (and anything else without the packet schema) pass through unarchived
+    if (data_idx < 0 || timestamp_idx < 0)
+    {
+        return;
+    }
+
+    auto const& data_col = info.get_column(data_idx);
+
+    if (data_col.type().id() != cudf::type_id::STRING || data_col.size() == 0)
+    {
+        return;
+    }
+
+    auto const packet_count = static_cast<std::size_t>(data_col.size());
+
+    auto const strings_col = cudf::strings_column_view{data_col};
+    auto const* chars_dev  = strings_col.chars().data<char>();
+
+    // Offsets and timestamps are small; pull them to the host to lay out the blocks
+    auto offsets    = std::vector<int32_t>(packet_count + 1);
+    auto timestamps = std::vector<uint32_t>(packet_count);
+
+    cudaMemcpy(offsets.data(),
+               strings_col.offsets().data<int32_t>(),
+               offsets.size() * sizeof(int32_t),
+               cudaMemcpyDeviceToHost);
+    cudaMemcpy(timestamps.data(),
+               info.get_column(timestamp_idx).data<uint32_t>(),
+               timestamps.size() * sizeof(uint32_t),
+               cudaMemcpyDeviceToHost);
+
+    // First pass: compute each block's position so the headers can be written in one host write and the
+    // packet bytes land at their final offsets
+    auto block_starts = std::vector<std::size_t>(packet_count);
+    std::size_t span_size = 0;
+
+    for (std::size_t i = 0; i < packet_count; i++)
+    {
+        auto const caplen = static_cast<std::size_t>(offsets[i + 1] - offsets[i]);
+        auto const padded = (caplen + 3) & ~std::size_t{3};
+
+        block_starts[i] = span_size;
+        span_size += EPB_HEADER_SIZE + padded + EPB_TRAILER_SIZE;
+    }
+
+    // Assemble the headers, padding and trailers with holes where the packet bytes go. In the host fallback
+    // the holes are filled before the single write below; with GDS they are filled from device memory after it.
+    auto span = std::vector<char>(span_size, 0);
+
+    for (std::size_t i = 0; i < packet_count; i++)
+    {
+        auto const caplen    = static_cast<std::size_t>(offsets[i + 1] - offsets[i]);
+        auto const padded    = (caplen + 3) & ~std::size_t{3};
+        auto const block_len = static_cast<uint32_t>(EPB_HEADER_SIZE + padded + EPB_TRAILER_SIZE);
+        auto const ts_usec   = static_cast<uint64_t>(timestamps[i]) * 1000;
+
+        char* block = span.data() + block_starts[i];
+
+        put_u32(block + 0, ENHANCED_PACKET_BLOCK);
+        put_u32(block + 4, block_len);
+        put_u32(block + 8, 0);  // interface id
+        put_u32(block + 12, static_cast<uint32_t>(ts_usec >> 32));
+        put_u32(block + 16, static_cast<uint32_t>(ts_usec));
+        put_u32(block + 20, static_cast<uint32_t>(caplen));
+        put_u32(block + 24, static_cast<uint32_t>(caplen));
+        put_u32(block + EPB_HEADER_SIZE + padded, block_len);
+    }
+
+    auto const total_bytes = static_cast<std::size_t>(offsets[packet_count]);
+    auto host_chars        = std::vector<char>();
+
+    if (!m_gds.valid() && total_bytes > 0)
+    {
+        host_chars.resize(total_bytes);
+        cudaMemcpy(host_chars.data(), chars_dev, total_bytes, cudaMemcpyDeviceToHost);
+
+        for (std::size_t i = 0; i < packet_count; i++)
+        {
+            auto const caplen = static_cast<std::size_t>(offsets[i + 1] - offsets[i]);
+
+            std::memcpy(span.data() + block_starts[i] + EPB_HEADER_SIZE, host_chars.data() + offsets[i], caplen);
+        }
+    }
+
+    this->write_host(span.data(), span.size(), m_file_offset);
+
+    if (m_gds.valid())
+    {
+        for (std::size_t i = 0; i < packet_count; i++)
+        {
+            auto const caplen = static_cast<std::size_t>(offsets[i + 1] - offsets[i]);
+
+            if (caplen == 0)
+            {
+                continue;
+            }
+
+            auto const file_pos = m_file_offset + static_cast<off_t>(block_starts[i] + EPB_HEADER_SIZE);
+
+            if (m_gds.valid() && m_gds.write(chars_dev + offsets[i], caplen, file_pos) == static_cast<ssize_t>(caplen))
+            {
+                continue;
+            }
+
+            // Drop to the host path for this and all subsequent packets; the blocks already laid out stay valid
+            if (m_gds.valid())
+            {
+                LOG(WARNING) << "cuFile write failed on '" << m_filename << "', falling back to host I/O";
+                m_gds.close();
+            }
+
+            if (host_chars.empty())
+            {
+                host_chars.resize(total_bytes);
+                cudaMemcpy(host_chars.data(), chars_dev, total_bytes, cudaMemcpyDeviceToHost);
+            }
+
+            this->write_host(host_chars.data() + offsets[i], caplen, file_pos);
+        }
+    }
+
+    m_file_offset += static_cast<off_t>(span_size);
+}
+
+DocaPcapSinkStage::subscribe_fn_t DocaPcapSinkStage::build()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t msg) {
+                this->write_packet_table(*msg);
+
+                output.on_next(std::move(msg));
+            },
+            [&](std::exception_ptr error_ptr) {
+                output.on_error(error_ptr);
+            },
+            [&]() {
+                output.on_completed();
+            }));
+    };
+}
+
+std::shared_ptr<mrc::segment::Object<DocaPcapSinkStage>> DocaPcapSinkStageInterfaceProxy::init(
+    mrc::segment::Builder& builder, std::string const& name, std::string const& filename)
+{
+    return builder.construct_object<DocaPcapSinkStage>(name, filename);
+}
+
+}  // namespace morpheus
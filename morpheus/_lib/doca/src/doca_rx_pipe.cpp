@@ -20,15 +20,23 @@
 #include <glog/logging.h>
 #include <netinet/in.h>
 
+#include <cstddef>
+#include <utility>
+#include <vector>
+
 namespace morpheus::doca {
 
-DocaRxPipe::DocaRxPipe(std::shared_ptr<DocaContext> context, std::shared_ptr<DocaRxQueue> rxq) :
+DocaRxPipe::DocaRxPipe(std::shared_ptr<DocaContext> context, std::vector<std::shared_ptr<DocaRxQueue>> rxq) :
   m_context(context),
-  m_rxq(rxq),
+  m_rxq(std::move(rxq)),
   m_pipe(nullptr)
 {
-    auto rss_queues = std::array<uint16_t, 1>();
-    doca_eth_rxq_get_flow_queue_id(rxq->rxq_info_cpu(), &(rss_queues[0]));
+    // RSS-distribute matching packets over every receive queue
+    auto rss_queues = std::vector<uint16_t>(m_rxq.size());
+    for (std::size_t i = 0; i < m_rxq.size(); i++)
+    {
+        doca_eth_rxq_get_flow_queue_id(m_rxq[i]->rxq_info_cpu(), &(rss_queues[i]));
+    }
 
     doca_flow_match match_mask{0};
     doca_flow_match match{};
@@ -39,8 +47,8 @@ DocaRxPipe::DocaRxPipe(std::shared_ptr<DocaContext> context, std::shared_ptr<Doc
     doca_flow_fwd fwd{};
     fwd.type            = DOCA_FLOW_FWD_RSS;
     fwd.rss_outer_flags = DOCA_FLOW_RSS_IPV4 | DOCA_FLOW_RSS_TCP;
-    fwd.rss_queues      = rss_queues.begin();
-    fwd.num_of_queues   = 1;
+    fwd.rss_queues      = rss_queues.data();
+    fwd.num_of_queues   = rss_queues.size();
 
     doca_flow_fwd miss_fwd{};
     miss_fwd.type = DOCA_FLOW_FWD_DROP;
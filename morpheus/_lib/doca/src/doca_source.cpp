@@ -24,25 +24,31 @@
 #include "doca_semaphore.hpp"
 #include "doca_source_kernels.hpp"
 
+#include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
-#include <cudf/copying.hpp>
-#include <cudf/filling.hpp>
-#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/strings/convert/convert_ipv4.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/table/table.hpp>
 #include <glog/logging.h>
 #include <mrc/segment/builder.hpp>
+#include <rmm/cuda_stream.hpp>
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rte_byteorder.h>
 
+#include <cstddef>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #define BE_IPV4_ADDR(a, b, c, d) (RTE_BE32((a << 24) + (b << 16) + (c << 8) + d)) /* Big endian conversion */
 
@@ -68,158 +74,563 @@ std::optional<uint32_t> ip_to_int(std::string const& ip_address)
     return std::nullopt;
 }
 
+namespace {
+
+/**
+ * @brief Column storage for one burst, laid out exactly as the emitted table: fixed-width fields at their row
+ * positions and payload bytes compacted behind an offsets array. Sized for a full burst so the extraction kernel
+ * can write into it directly.
+ */
+struct PacketTableBuffers
+{
+    PacketTableBuffers(rmm::cuda_stream_view stream) :
+      payload_chars_d(MAX_PKT_RECEIVE * MAX_PKT_SIZE, stream),
+      payload_offsets_d(MAX_PKT_RECEIVE + 1, stream),
+      src_mac_out_d(MAX_PKT_RECEIVE, stream),
+      dst_mac_out_d(MAX_PKT_RECEIVE, stream),
+      src_ip_out_d(MAX_PKT_RECEIVE, stream),
+      dst_ip_out_d(MAX_PKT_RECEIVE, stream),
+      src_port_out_d(MAX_PKT_RECEIVE, stream),
+      dst_port_out_d(MAX_PKT_RECEIVE, stream),
+      tcp_flags_out_d(MAX_PKT_RECEIVE, stream),
+      ether_type_out_d(MAX_PKT_RECEIVE, stream),
+      next_proto_id_out_d(MAX_PKT_RECEIVE, stream),
+      timestamp_out_d(MAX_PKT_RECEIVE, stream)
+    {}
+
+    rmm::device_uvector<char> payload_chars_d;
+    rmm::device_uvector<int32_t> payload_offsets_d;
+
+    rmm::device_uvector<int64_t> src_mac_out_d;
+    rmm::device_uvector<int64_t> dst_mac_out_d;
+    rmm::device_uvector<int64_t> src_ip_out_d;
+    rmm::device_uvector<int64_t> dst_ip_out_d;
+    rmm::device_uvector<uint16_t> src_port_out_d;
+    rmm::device_uvector<uint16_t> dst_port_out_d;
+    rmm::device_uvector<int32_t> tcp_flags_out_d;
+    rmm::device_uvector<int32_t> ether_type_out_d;
+    rmm::device_uvector<int32_t> next_proto_id_out_d;
+    rmm::device_uvector<uint32_t> timestamp_out_d;
+};
+
+/**
+ * @brief Per-queue kernel state, with a dedicated stream so all queues receive concurrently. The table buffers
+ * here are only written by the persistent kernel; the per-burst path allocates fresh ones per launch so they can
+ * be moved into the emitted columns.
+ */
+struct PacketReceiveBuffers
+{
+    PacketReceiveBuffers() :
+      semaphore_idx_d(0, stream),
+      packet_count_d(0, stream),
+      payload_size_total_d(0, stream),
+      table_buffers(stream.view())
+    {}
+
+    rmm::cuda_stream stream;
+
+    rmm::device_scalar<int32_t> semaphore_idx_d;
+    rmm::device_scalar<int32_t> packet_count_d;
+    rmm::device_scalar<int32_t> payload_size_total_d;
+
+    PacketTableBuffers table_buffers;
+};
+
+/**
+ * @brief Wraps one burst's populated buffers directly as the emitted columns. The extraction kernel already wrote
+ * the final column layout, so no gather pass or second materialization of the captured bytes is needed; the
+ * buffers are simply moved into the columns, sized to the rows actually received.
+ */
+std::unique_ptr<cudf::table> assemble_packet_table(PacketTableBuffers&& buffers,
+                                                   int32_t packet_count,
+                                                   int32_t payload_size_total)
+{
+    auto make_fixed_column = [packet_count](auto& data) {
+        using value_type = typename std::remove_reference_t<decltype(data)>::value_type;
+
+        return std::make_unique<cudf::column>(
+            cudf::data_type{cudf::type_to_id<value_type>()}, packet_count, data.release(), rmm::device_buffer{}, 0);
+    };
+
+    auto columns = std::vector<std::unique_ptr<cudf::column>>();
+    columns.reserve(11);
+
+    // mac and ip integers still go through their string conversions, these are type conversions rather than copies
+    auto src_mac_col = make_fixed_column(buffers.src_mac_out_d);
+    columns.emplace_back(morpheus::doca::integers_to_mac(src_mac_col->view()));
+
+    auto dst_mac_col = make_fixed_column(buffers.dst_mac_out_d);
+    columns.emplace_back(morpheus::doca::integers_to_mac(dst_mac_col->view()));
+
+    auto src_ip_col = make_fixed_column(buffers.src_ip_out_d);
+    columns.emplace_back(cudf::strings::integers_to_ipv4(src_ip_col->view()));
+
+    auto dst_ip_col = make_fixed_column(buffers.dst_ip_out_d);
+    columns.emplace_back(cudf::strings::integers_to_ipv4(dst_ip_col->view()));
+
+    columns.emplace_back(make_fixed_column(buffers.src_port_out_d));
+    columns.emplace_back(make_fixed_column(buffers.dst_port_out_d));
+    columns.emplace_back(make_fixed_column(buffers.tcp_flags_out_d));
+    columns.emplace_back(make_fixed_column(buffers.ether_type_out_d));
+    columns.emplace_back(make_fixed_column(buffers.next_proto_id_out_d));
+    columns.emplace_back(make_fixed_column(buffers.timestamp_out_d));
+
+    // The kernel wrote the offsets and compacted chars in one pass, wrap them as the strings children
+    auto offsets_col = std::make_unique<cudf::column>(cudf::data_type{cudf::type_id::INT32},
+                                                      packet_count + 1,
+                                                      buffers.payload_offsets_d.release(),
+                                                      rmm::device_buffer{},
+                                                      0);
+
+    auto chars_col = std::make_unique<cudf::column>(cudf::data_type{cudf::type_id::INT8},
+                                                    payload_size_total,
+                                                    buffers.payload_chars_d.release(),
+                                                    rmm::device_buffer{},
+                                                    0);
+
+    columns.emplace_back(cudf::make_strings_column(packet_count, std::move(offsets_col), std::move(chars_col), 0, {}));
+
+    return std::make_unique<cudf::table>(std::move(columns));
+}
+
+/**
+ * @brief Copies one burst out of a resident kernel's buffers and assembles the packet table. Used by the
+ * persistent mode, where the kernel keeps ownership of its output buffers between bursts.
+ */
+std::unique_ptr<cudf::table> copy_packet_table(PacketTableBuffers& kernel_buffers,
+                                               int32_t packet_count,
+                                               int32_t payload_size_total)
+{
+    auto stream = rmm::cuda_stream_default;
+
+    auto burst = PacketTableBuffers(stream);
+
+    auto copy_rows = [&stream](auto& dst, auto& src, std::size_t count) {
+        using value_type = typename std::remove_reference_t<decltype(dst)>::value_type;
+
+        cudaMemcpyAsync(dst.data(), src.data(), count * sizeof(value_type), cudaMemcpyDeviceToDevice, stream.value());
+    };
+
+    copy_rows(burst.payload_chars_d, kernel_buffers.payload_chars_d, payload_size_total);
+    copy_rows(burst.payload_offsets_d, kernel_buffers.payload_offsets_d, packet_count + 1);
+    copy_rows(burst.src_mac_out_d, kernel_buffers.src_mac_out_d, packet_count);
+    copy_rows(burst.dst_mac_out_d, kernel_buffers.dst_mac_out_d, packet_count);
+    copy_rows(burst.src_ip_out_d, kernel_buffers.src_ip_out_d, packet_count);
+    copy_rows(burst.dst_ip_out_d, kernel_buffers.dst_ip_out_d, packet_count);
+    copy_rows(burst.src_port_out_d, kernel_buffers.src_port_out_d, packet_count);
+    copy_rows(burst.dst_port_out_d, kernel_buffers.dst_port_out_d, packet_count);
+    copy_rows(burst.tcp_flags_out_d, kernel_buffers.tcp_flags_out_d, packet_count);
+    copy_rows(burst.ether_type_out_d, kernel_buffers.ether_type_out_d, packet_count);
+    copy_rows(burst.next_proto_id_out_d, kernel_buffers.next_proto_id_out_d, packet_count);
+    copy_rows(burst.timestamp_out_d, kernel_buffers.timestamp_out_d, packet_count);
+
+    return assemble_packet_table(std::move(burst), packet_count, payload_size_total);
+}
+
+/**
+ * @brief Merges the per-queue packet tables and wraps the result in a MessageMeta with the packet schema.
+ */
+std::shared_ptr<morpheus::MessageMeta> make_packet_meta(std::vector<std::unique_ptr<cudf::table>>&& per_queue_tables)
+{
+    // Merge the per-queue tables into a single packet table
+    auto merged_table = std::move(per_queue_tables.front());
+
+    if (per_queue_tables.size() > 1)
+    {
+        auto table_views = std::vector<cudf::table_view>();
+        table_views.reserve(per_queue_tables.size());
+
+        for (auto& table : per_queue_tables)
+        {
+            table_views.emplace_back(table->view());
+        }
+
+        merged_table = cudf::concatenate(table_views);
+    }
+
+    // assemble metadata
+    auto gathered_metadata = cudf::io::table_metadata();
+    gathered_metadata.schema_info.emplace_back("src_mac");
+    gathered_metadata.schema_info.emplace_back("dst_mac");
+    gathered_metadata.schema_info.emplace_back("src_ip");
+    gathered_metadata.schema_info.emplace_back("dst_ip");
+    gathered_metadata.schema_info.emplace_back("src_port");
+    gathered_metadata.schema_info.emplace_back("dst_port");
+    gathered_metadata.schema_info.emplace_back("tcp_flags");
+    gathered_metadata.schema_info.emplace_back("ether_type");
+    gathered_metadata.schema_info.emplace_back("next_proto");
+    gathered_metadata.schema_info.emplace_back("timestamp");
+    gathered_metadata.schema_info.emplace_back("data");
+
+    auto gathered_table_w_metadata =
+        cudf::io::table_with_metadata{std::move(merged_table), std::move(gathered_metadata)};
+
+    return morpheus::MessageMeta::create_from_cpp(std::move(gathered_table_w_metadata), 0);
+}
+
+/**
+ * @brief Parses a dotted-quad IPv4 string into host byte order, matching the tuple values the flow table
+ * stores and the snapshots report.
+ */
+std::optional<uint32_t> ip_to_host_order(std::string const& ip_address)
+{
+    uint8_t a, b, c, d;
+
+    if (sscanf(ip_address.c_str(), "%hhu.%hhu.%hhu.%hhu", &a, &b, &c, &d) != 4)
+    {
+        return std::nullopt;
+    }
+
+    return (static_cast<uint32_t>(a) << 24) | (static_cast<uint32_t>(b) << 16) | (static_cast<uint32_t>(c) << 8) | d;
+}
+
+/**
+ * @brief Snapshots the GPU flow table and wraps the per-flow statistics in a MessageMeta.
+ */
+std::shared_ptr<morpheus::MessageMeta> make_flow_snapshot_meta(morpheus::doca::FlowRecord* flow_table)
+{
+    auto snapshot_table = morpheus::doca::flow_table_snapshot(flow_table, static_cast<int32_t>(FLOW_TABLE_CAPACITY));
+
+    auto snapshot_metadata = cudf::io::table_metadata();
+    snapshot_metadata.schema_info.emplace_back("src_ip");
+    snapshot_metadata.schema_info.emplace_back("dst_ip");
+    snapshot_metadata.schema_info.emplace_back("src_port");
+    snapshot_metadata.schema_info.emplace_back("dst_port");
+    snapshot_metadata.schema_info.emplace_back("packets");
+    snapshot_metadata.schema_info.emplace_back("bytes");
+    snapshot_metadata.schema_info.emplace_back("first_timestamp");
+    snapshot_metadata.schema_info.emplace_back("last_timestamp");
+    snapshot_metadata.schema_info.emplace_back("tcp_flags_seen");
+    snapshot_metadata.schema_info.emplace_back("last_seq");
+
+    auto snapshot_table_w_metadata =
+        cudf::io::table_with_metadata{std::move(snapshot_table), std::move(snapshot_metadata)};
+
+    return morpheus::MessageMeta::create_from_cpp(std::move(snapshot_table_w_metadata), 0);
+}
+
+}  // namespace
+
 namespace morpheus {
 
-DocaSourceStage::DocaSourceStage(std::string const& nic_pci_address, std::string const& gpu_pci_address) :
-  PythonSource(build())
+DocaSourceStage::DocaSourceStage(std::string const& nic_pci_address,
+                                 std::string const& gpu_pci_address,
+                                 uint16_t rx_queue_count,
+                                 bool persistent_kernel,
+                                 uint32_t flow_table_snapshot_interval,
+                                 uint32_t snap_length,
+                                 std::string const& lcores,
+                                 std::string const& socket_mem) :
+  PythonSource(build()),
+  m_persistent_kernel(persistent_kernel),
+  m_flow_table_snapshot_interval(flow_table_snapshot_interval),
+  m_snap_length(snap_length)
 {
-    m_context = std::make_shared<morpheus::doca::DocaContext>(nic_pci_address, gpu_pci_address);
+    if (rx_queue_count == 0)
+    {
+        throw std::invalid_argument("rx_queue_count must be at least 1");
+    }
+
+    // Reserving the capture hugepages on the NIC-local node and pinning the EAL threads beside them keeps
+    // every packet-path memory touch socket-local
+    m_context = std::make_shared<morpheus::doca::DocaContext>(
+        nic_pci_address, gpu_pci_address, morpheus::doca::RTEOptions{lcores, socket_mem});
 
-    m_rxq       = std::make_shared<morpheus::doca::DocaRxQueue>(m_context);
-    m_semaphore = std::make_shared<morpheus::doca::DocaSemaphore>(m_context, 1024);
-    m_rxpipe    = std::make_shared<morpheus::doca::DocaRxPipe>(m_context, m_rxq);
+    for (uint16_t queue_idx = 0; queue_idx < rx_queue_count; queue_idx++)
+    {
+        m_rxq.push_back(std::make_shared<morpheus::doca::DocaRxQueue>(m_context));
+        m_semaphore.push_back(std::make_shared<morpheus::doca::DocaSemaphore>(m_context, 1024));
+    }
+
+    m_rxpipe = std::make_shared<morpheus::doca::DocaRxPipe>(m_context, m_rxq);
+
+    // Host-visible so get_capture_stats() can poll while the kernels are resident
+    m_capture_stats =
+        std::make_shared<morpheus::doca::DocaMem<morpheus::doca::CaptureStats>>(m_context, 1, DOCA_GPU_MEM_GPU_CPU);
+
+    *(m_capture_stats->cpu_ptr()) = morpheus::doca::CaptureStats{};
+
+    // Flow table slots are claimed by the kernels with atomics, so a single zeroed allocation shared by
+    // every queue is sufficient. Allocated here rather than in build() so flows can be flagged for
+    // full-payload capture before the pipeline starts.
+    if (m_flow_table_snapshot_interval > 0)
+    {
+        m_flow_table = std::make_shared<rmm::device_uvector<morpheus::doca::FlowRecord>>(FLOW_TABLE_CAPACITY,
+                                                                                         rmm::cuda_stream_default);
+
+        cudaMemsetAsync(m_flow_table->data(),
+                        0,
+                        FLOW_TABLE_CAPACITY * sizeof(morpheus::doca::FlowRecord),
+                        rmm::cuda_stream_default.value());
+        cudaStreamSynchronize(rmm::cuda_stream_default);
+    }
+}
+
+std::map<std::string, uint64_t> DocaSourceStage::get_capture_stats() const
+{
+    auto const* stats = m_capture_stats->cpu_ptr();
+
+    return {{"packets_received", DOCA_GPUNETIO_VOLATILE(stats->packets_received)},
+            {"payload_bytes_received", DOCA_GPUNETIO_VOLATILE(stats->payload_bytes_received)},
+            {"bursts_received", DOCA_GPUNETIO_VOLATILE(stats->bursts_received)},
+            {"full_bursts", DOCA_GPUNETIO_VOLATILE(stats->full_bursts)},
+            {"sem_full_events", DOCA_GPUNETIO_VOLATILE(stats->sem_full_events)},
+            {"host_stall_events", DOCA_GPUNETIO_VOLATILE(stats->host_stall_events)}};
+}
+
+void DocaSourceStage::flag_flow(std::string const& src_ip,
+                                std::string const& dst_ip,
+                                uint16_t src_port,
+                                uint16_t dst_port)
+{
+    if (m_flow_table == nullptr)
+    {
+        throw std::invalid_argument("flag_flow requires flow accounting (flow_table_snapshot_interval > 0)");
+    }
+
+    auto src_ip_int = ip_to_host_order(src_ip);
+    auto dst_ip_int = ip_to_host_order(dst_ip);
+
+    if (!src_ip_int || !dst_ip_int)
+    {
+        throw std::invalid_argument("flag_flow requires dotted-quad IPv4 addresses");
+    }
+
+    morpheus::doca::flow_table_flag(m_flow_table->data(), *src_ip_int, *dst_ip_int, src_port, dst_port);
 }
 
 DocaSourceStage::subscriber_fn_t DocaSourceStage::build()
 {
     return [this](rxcpp::subscriber<source_type_t> output) {
-        auto semaphore_idx_d      = rmm::device_scalar<int32_t>(0, rmm::cuda_stream_default);
-        auto packet_count_d       = rmm::device_scalar<int32_t>(0, rmm::cuda_stream_default);
-        auto payload_buffer_d     = rmm::device_uvector<char>(MAX_PKT_RECEIVE * MAX_PKT_SIZE, rmm::cuda_stream_default);
-        auto payload_size_total_d = rmm::device_scalar<int32_t>(0, rmm::cuda_stream_default);
-        auto payload_sizes_d      = rmm::device_uvector<int32_t>(MAX_PKT_RECEIVE, rmm::cuda_stream_default);
-
-        auto src_mac_out_d       = rmm::device_uvector<int64_t>(MAX_PKT_RECEIVE, rmm::cuda_stream_default);
-        auto dst_mac_out_d       = rmm::device_uvector<int64_t>(MAX_PKT_RECEIVE, rmm::cuda_stream_default);
-        auto src_ip_out_d        = rmm::device_uvector<int64_t>(MAX_PKT_RECEIVE, rmm::cuda_stream_default);
-        auto dst_ip_out_d        = rmm::device_uvector<int64_t>(MAX_PKT_RECEIVE, rmm::cuda_stream_default);
-        auto src_port_out_d      = rmm::device_uvector<uint16_t>(MAX_PKT_RECEIVE, rmm::cuda_stream_default);
-        auto dst_port_out_d      = rmm::device_uvector<uint16_t>(MAX_PKT_RECEIVE, rmm::cuda_stream_default);
-        auto tcp_flags_out_d     = rmm::device_uvector<int32_t>(MAX_PKT_RECEIVE, rmm::cuda_stream_default);
-        auto ether_type_out_d    = rmm::device_uvector<int32_t>(MAX_PKT_RECEIVE, rmm::cuda_stream_default);
-        auto next_proto_id_out_d = rmm::device_uvector<int32_t>(MAX_PKT_RECEIVE, rmm::cuda_stream_default);
-        auto timestamp_out_d     = rmm::device_uvector<uint32_t>(MAX_PKT_RECEIVE, rmm::cuda_stream_default);
-        auto exit_condition = std::make_unique<morpheus::doca::DocaMem<uint32_t>>(m_context, 1, DOCA_GPU_MEM_GPU_CPU);
+        auto const queue_count = m_rxq.size();
 
-        auto fixed_width_inputs_table_view = cudf::table_view(std::vector<cudf::column_view>{
-            cudf::column_view(cudf::device_span<const int64_t>(src_mac_out_d)),
-            cudf::column_view(cudf::device_span<const int64_t>(dst_mac_out_d)),
-            cudf::column_view(cudf::device_span<const int64_t>(src_ip_out_d)),
-            cudf::column_view(cudf::device_span<const int64_t>(dst_ip_out_d)),
-            cudf::column_view(cudf::device_span<const uint16_t>(src_port_out_d)),
-            cudf::column_view(cudf::device_span<const uint16_t>(dst_port_out_d)),
-            cudf::column_view(cudf::device_span<const int32_t>(tcp_flags_out_d)),
-            cudf::column_view(cudf::device_span<const int32_t>(ether_type_out_d)),
-            cudf::column_view(cudf::device_span<const int32_t>(next_proto_id_out_d)),
-            cudf::column_view(cudf::device_span<const uint32_t>(timestamp_out_d)),
-        });
+        // One buffer set per receive queue, each with its own stream so the kernels run concurrently
+        auto buffers = std::vector<PacketReceiveBuffers>(queue_count);
+
+        auto exit_condition = std::make_unique<morpheus::doca::DocaMem<uint32_t>>(m_context, 1, DOCA_GPU_MEM_GPU_CPU);
 
         DOCA_GPUNETIO_VOLATILE(*(exit_condition->cpu_ptr())) = 0;
 
+        // A null flow table pointer disables flow accounting entirely; the table itself is owned by the stage
+        // so flows can be flagged before and during capture
+        auto flow_table_ptr = m_flow_table != nullptr ? m_flow_table->data()
+                                                      : static_cast<morpheus::doca::FlowRecord*>(nullptr);
+
+        auto snap_len = static_cast<int32_t>(m_snap_length);
+
+        auto bursts_since_snapshot = uint32_t{0};
+
         auto cancel_thread = std::thread([&] {
             while (output.is_subscribed()) {}
             DOCA_GPUNETIO_VOLATILE(*(exit_condition->cpu_ptr())) = 1;
         });
 
-        while (output.is_subscribed())
+        if (m_persistent_kernel)
         {
-            if (DOCA_GPUNETIO_VOLATILE(*(exit_condition->cpu_ptr())) == 1)
+            // Burst state the host reads while the kernels stay resident, so it must be host-visible instead of
+            // the device scalars used by the per-burst path
+            auto packet_count_mem       = std::vector<std::unique_ptr<morpheus::doca::DocaMem<int32_t>>>();
+            auto payload_size_total_mem = std::vector<std::unique_ptr<morpheus::doca::DocaMem<int32_t>>>();
+            auto burst_ready_mem        = std::vector<std::unique_ptr<morpheus::doca::DocaMem<uint32_t>>>();
+
+            // Launch one persistent kernel per queue, it stays resident until exit_condition is raised
+            for (std::size_t queue_idx = 0; queue_idx < queue_count; queue_idx++)
             {
-                output.unsubscribe();
-                continue;
+                packet_count_mem.push_back(
+                    std::make_unique<morpheus::doca::DocaMem<int32_t>>(m_context, 1, DOCA_GPU_MEM_GPU_CPU));
+                payload_size_total_mem.push_back(
+                    std::make_unique<morpheus::doca::DocaMem<int32_t>>(m_context, 1, DOCA_GPU_MEM_GPU_CPU));
+                burst_ready_mem.push_back(
+                    std::make_unique<morpheus::doca::DocaMem<uint32_t>>(m_context, 1, DOCA_GPU_MEM_GPU_CPU));
+
+                DOCA_GPUNETIO_VOLATILE(*(burst_ready_mem[queue_idx]->cpu_ptr())) = 0;
+
+                auto& queue_buffers = buffers[queue_idx];
+
+                morpheus::doca::packet_receive_persistent_kernel(m_rxq[queue_idx]->rxq_info_gpu(),
+                                                                 m_semaphore[queue_idx]->gpu_ptr(),
+                                                                 m_semaphore[queue_idx]->size(),
+                                                                 queue_buffers.semaphore_idx_d.data(),
+                                                                 packet_count_mem[queue_idx]->gpu_ptr(),
+                                                                 queue_buffers.table_buffers.payload_chars_d.data(),
+                                                                 payload_size_total_mem[queue_idx]->gpu_ptr(),
+                                                                 queue_buffers.table_buffers.payload_offsets_d.data(),
+                                                                 queue_buffers.table_buffers.src_mac_out_d.data(),
+                                                                 queue_buffers.table_buffers.dst_mac_out_d.data(),
+                                                                 queue_buffers.table_buffers.src_ip_out_d.data(),
+                                                                 queue_buffers.table_buffers.dst_ip_out_d.data(),
+                                                                 queue_buffers.table_buffers.src_port_out_d.data(),
+                                                                 queue_buffers.table_buffers.dst_port_out_d.data(),
+                                                                 queue_buffers.table_buffers.tcp_flags_out_d.data(),
+                                                                 queue_buffers.table_buffers.ether_type_out_d.data(),
+                                                                 queue_buffers.table_buffers.next_proto_id_out_d.data(),
+                                                                 queue_buffers.table_buffers.timestamp_out_d.data(),
+                                                                 snap_len,
+                                                                 flow_table_ptr,
+                                                                 m_capture_stats->gpu_ptr(),
+                                                                 burst_ready_mem[queue_idx]->gpu_ptr(),
+                                                                 exit_condition->gpu_ptr(),
+                                                                 queue_buffers.stream.view());
             }
 
-            morpheus::doca::packet_receive_kernel(m_rxq->rxq_info_gpu(),
-                                                  m_semaphore->gpu_ptr(),
-                                                  m_semaphore->size(),
-                                                  semaphore_idx_d.data(),
-                                                  packet_count_d.data(),
-                                                  payload_buffer_d.data(),
-                                                  payload_size_total_d.data(),
-                                                  payload_sizes_d.data(),
-                                                  src_mac_out_d.data(),
-                                                  dst_mac_out_d.data(),
-                                                  src_ip_out_d.data(),
-                                                  dst_ip_out_d.data(),
-                                                  src_port_out_d.data(),
-                                                  dst_port_out_d.data(),
-                                                  tcp_flags_out_d.data(),
-                                                  ether_type_out_d.data(),
-                                                  next_proto_id_out_d.data(),
-                                                  timestamp_out_d.data(),
-                                                  exit_condition->gpu_ptr(),
-                                                  rmm::cuda_stream_default);
-
-            cudaStreamSynchronize(rmm::cuda_stream_default);
-
-            auto packet_count = packet_count_d.value(rmm::cuda_stream_default);
-
-            if (packet_count == 0)
+            while (output.is_subscribed())
             {
-                continue;
-            }
+                if (DOCA_GPUNETIO_VOLATILE(*(exit_condition->cpu_ptr())) == 1)
+                {
+                    output.unsubscribe();
+                    continue;
+                }
 
-            auto payload_size_total = payload_size_total_d.value(rmm::cuda_stream_default);
+                auto per_queue_tables = std::vector<std::unique_ptr<cudf::table>>();
 
-            // gather payload data
+                for (std::size_t queue_idx = 0; queue_idx < queue_count; queue_idx++)
+                {
+                    if (DOCA_GPUNETIO_VOLATILE(*(burst_ready_mem[queue_idx]->cpu_ptr())) != 1)
+                    {
+                        continue;
+                    }
 
-            auto payload_col = doca::gather_payload(packet_count, payload_buffer_d.data(), payload_sizes_d.data());
+                    auto packet_count       = *(packet_count_mem[queue_idx]->cpu_ptr());
+                    auto payload_size_total = *(payload_size_total_mem[queue_idx]->cpu_ptr());
 
-            auto iota_col = [packet_count]() {
-                using scalar_type_t = cudf::scalar_type_t<uint32_t>;
-                auto zero = cudf::make_numeric_scalar(cudf::data_type(cudf::data_type{cudf::type_to_id<uint32_t>()}));
-                static_cast<scalar_type_t*>(zero.get())->set_value(0);
-                zero->set_valid_async(false);
-                return cudf::sequence(packet_count, *zero);
-            }();
+                    per_queue_tables.emplace_back(
+                        copy_packet_table(buffers[queue_idx].table_buffers, packet_count, payload_size_total));
 
-            auto gathered_table    = cudf::gather(fixed_width_inputs_table_view, iota_col->view());
-            auto gathered_metadata = cudf::io::table_metadata();
-            auto gathered_columns  = gathered_table->release();
+                    // The copies read the kernel's output buffers, finish them before handing the buffers back
+                    cudaStreamSynchronize(rmm::cuda_stream_default);
 
-            // post-processing for mac addresses
-            auto src_mac_col     = gathered_columns[0].release();
-            auto src_mac_str_col = morpheus::doca::integers_to_mac(src_mac_col->view());
-            gathered_columns[0].reset(src_mac_str_col.release());
+                    DOCA_GPUNETIO_VOLATILE(*(burst_ready_mem[queue_idx]->cpu_ptr())) = 0;
+                }
 
-            auto dst_mac_col     = gathered_columns[1].release();
-            auto dst_mac_str_col = morpheus::doca::integers_to_mac(dst_mac_col->view());
-            gathered_columns[1].reset(dst_mac_str_col.release());
+                if (per_queue_tables.empty())
+                {
+                    continue;
+                }
 
-            // post-processing for ip addresses
-            auto src_ip_col     = gathered_columns[2].release();
-            auto src_ip_str_col = cudf::strings::integers_to_ipv4(src_ip_col->view());
-            gathered_columns[2].reset(src_ip_str_col.release());
+                auto meta = make_packet_meta(std::move(per_queue_tables));
 
-            auto dst_ip_col     = gathered_columns[3].release();
-            auto dst_ip_str_col = cudf::strings::integers_to_ipv4(dst_ip_col->view());
-            gathered_columns[3].reset(dst_ip_str_col.release());
+                cudaStreamSynchronize(rmm::cuda_stream_default);
 
-            gathered_columns.emplace_back(std::move(payload_col));
+                output.on_next(std::move(meta));
 
-            // assemble metadata
-            gathered_metadata.schema_info.emplace_back("src_mac");
-            gathered_metadata.schema_info.emplace_back("dst_mac");
-            gathered_metadata.schema_info.emplace_back("src_ip");
-            gathered_metadata.schema_info.emplace_back("dst_ip");
-            gathered_metadata.schema_info.emplace_back("src_port");
-            gathered_metadata.schema_info.emplace_back("dst_port");
-            gathered_metadata.schema_info.emplace_back("tcp_flags");
-            gathered_metadata.schema_info.emplace_back("ether_type");
-            gathered_metadata.schema_info.emplace_back("next_proto");
-            gathered_metadata.schema_info.emplace_back("timestamp");
-            gathered_metadata.schema_info.emplace_back("data");
+                if (flow_table_ptr != nullptr && ++bursts_since_snapshot >= m_flow_table_snapshot_interval)
+                {
+                    bursts_since_snapshot = 0;
 
-            gathered_table = std::make_unique<cudf::table>(std::move(gathered_columns));
+                    auto snapshot_meta = make_flow_snapshot_meta(flow_table_ptr);
 
-            auto gathered_table_w_metadata =
-                cudf::io::table_with_metadata{std::move(gathered_table), std::move(gathered_metadata)};
+                    cudaStreamSynchronize(rmm::cuda_stream_default);
 
-            auto meta = MessageMeta::create_from_cpp(std::move(gathered_table_w_metadata), 0);
+                    if (snapshot_meta->count() > 0)
+                    {
+                        output.on_next(std::move(snapshot_meta));
+                    }
+                }
+            }
 
-            cudaStreamSynchronize(rmm::cuda_stream_default);
+            // Reap the resident kernels before the buffers go out of scope
+            DOCA_GPUNETIO_VOLATILE(*(exit_condition->cpu_ptr())) = 1;
 
-            output.on_next(std::move(meta));
+            for (auto& queue_buffers : buffers)
+            {
+                cudaStreamSynchronize(queue_buffers.stream.value());
+            }
+        }
+        else
+        {
+            while (output.is_subscribed())
+            {
+                if (DOCA_GPUNETIO_VOLATILE(*(exit_condition->cpu_ptr())) == 1)
+                {
+                    output.unsubscribe();
+                    continue;
+                }
+
+                // Launch one receive kernel per queue into freshly allocated column storage, so the populated
+                // buffers can be moved straight into the emitted columns, then wait for all of them
+                auto batches = std::vector<PacketTableBuffers>();
+                batches.reserve(queue_count);
+
+                for (std::size_t queue_idx = 0; queue_idx < queue_count; queue_idx++)
+                {
+                    auto& queue_buffers = buffers[queue_idx];
+                    auto& batch         = batches.emplace_back(queue_buffers.stream.view());
+
+                    morpheus::doca::packet_receive_kernel(m_rxq[queue_idx]->rxq_info_gpu(),
+                                                          m_semaphore[queue_idx]->gpu_ptr(),
+                                                          m_semaphore[queue_idx]->size(),
+                                                          queue_buffers.semaphore_idx_d.data(),
+                                                          queue_buffers.packet_count_d.data(),
+                                                          batch.payload_chars_d.data(),
+                                                          queue_buffers.payload_size_total_d.data(),
+                                                          batch.payload_offsets_d.data(),
+                                                          batch.src_mac_out_d.data(),
+                                                          batch.dst_mac_out_d.data(),
+                                                          batch.src_ip_out_d.data(),
+                                                          batch.dst_ip_out_d.data(),
+                                                          batch.src_port_out_d.data(),
+                                                          batch.dst_port_out_d.data(),
+                                                          batch.tcp_flags_out_d.data(),
+                                                          batch.ether_type_out_d.data(),
+                                                          batch.next_proto_id_out_d.data(),
+                                                          batch.timestamp_out_d.data(),
+                                                          snap_len,
+                                                          flow_table_ptr,
+                                                          m_capture_stats->gpu_ptr(),
+                                                          exit_condition->gpu_ptr(),
+                                                          queue_buffers.stream.view());
+                }
+
+                for (auto& queue_buffers : buffers)
+                {
+                    cudaStreamSynchronize(queue_buffers.stream.value());
+                }
+
+                // Assemble a table for each queue that received packets
+                auto per_queue_tables = std::vector<std::unique_ptr<cudf::table>>();
+
+                for (std::size_t queue_idx = 0; queue_idx < queue_count; queue_idx++)
+                {
+                    auto& queue_buffers = buffers[queue_idx];
+
+                    auto packet_count = queue_buffers.packet_count_d.value(queue_buffers.stream.view());
+
+                    if (packet_count == 0)
+                    {
+                        continue;
+                    }
+
+                    auto payload_size_total = queue_buffers.payload_size_total_d.value(queue_buffers.stream.view());
+
+                    per_queue_tables.emplace_back(
+                        assemble_packet_table(std::move(batches[queue_idx]), packet_count, payload_size_total));
+                }
+
+                if (per_queue_tables.empty())
+                {
+                    continue;
+                }
+
+                auto meta = make_packet_meta(std::move(per_queue_tables));
+
+                cudaStreamSynchronize(rmm::cuda_stream_default);
+
+                output.on_next(std::move(meta));
+
+                if (flow_table_ptr != nullptr && ++bursts_since_snapshot >= m_flow_table_snapshot_interval)
+                {
+                    bursts_since_snapshot = 0;
+
+                    auto snapshot_meta = make_flow_snapshot_meta(flow_table_ptr);
+
+                    cudaStreamSynchronize(rmm::cuda_stream_default);
+
+                    if (snapshot_meta->count() > 0)
+                    {
+                        output.on_next(std::move(snapshot_meta));
+                    }
+                }
+            }
         }
 
         cancel_thread.join();
@@ -232,9 +643,38 @@ std::shared_ptr<mrc::segment::Object<DocaSourceStage>> DocaSourceStageInterfaceP
     mrc::segment::Builder& builder,
     std::string const& name,
     std::string const& nic_pci_address,
-    std::string const& gpu_pci_address)
+    std::string const& gpu_pci_address,
+    uint16_t rx_queue_count,
+    bool persistent_kernel,
+    uint32_t flow_table_snapshot_interval,
+    uint32_t snap_length,
+    std::string const& lcores,
+    std::string const& socket_mem)
+{
+    return builder.construct_object<DocaSourceStage>(name,
+                                                     nic_pci_address,
+                                                     gpu_pci_address,
+                                                     rx_queue_count,
+                                                     persistent_kernel,
+                                                     flow_table_snapshot_interval,
+                                                     snap_length,
+                                                     lcores,
+                                                     socket_mem);
+}
+
+std::map<std::string, uint64_t> DocaSourceStageInterfaceProxy::get_capture_stats(
+    mrc::segment::Object<DocaSourceStage>& self)
+{
+    return self.object().get_capture_stats();
+}
+
+void DocaSourceStageInterfaceProxy::flag_flow(mrc::segment::Object<DocaSourceStage>& self,
+                                              std::string const& src_ip,
+                                              std::string const& dst_ip,
+                                              uint16_t src_port,
+                                              uint16_t dst_port)
 {
-    return builder.construct_object<DocaSourceStage>(name, nic_pci_address, gpu_pci_address);
+    self.object().flag_flow(src_ip, dst_ip, src_port, dst_port);
 }
 
 }  // namespace morpheus
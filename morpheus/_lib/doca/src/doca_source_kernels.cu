@@ -16,6 +16,7 @@
  */
 
 #include "common.hpp"
+#include "doca_source_kernels.hpp"
 
 #include "morpheus/utilities/error.hpp"
 
@@ -25,6 +26,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/strings/convert/convert_ipv4.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
@@ -33,6 +35,9 @@
 #include <doca_gpunetio_dev_buf.cuh>
 #include <doca_gpunetio_dev_eth_rxq.cuh>
 #include <doca_gpunetio_dev_sem.cuh>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rte_ether.h>
 #include <rte_ip.h>
@@ -43,12 +48,20 @@
 #include <thrust/iterator/counting_iterator.h>
 
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #define ETHER_ADDR_LEN  6 /**< Length of Ethernet address. */
 
 #define BYTE_SWAP16(v) \
 	((((uint16_t)(v) & UINT16_C(0x00ff)) << 8) | (((uint16_t)(v) & UINT16_C(0xff00)) >> 8))
 
+#define BYTE_SWAP32(v)                                                        \
+	((((uint32_t)(v) & UINT32_C(0x000000ff)) << 24) |                           \
+	 (((uint32_t)(v) & UINT32_C(0x0000ff00)) << 8)  |                           \
+	 (((uint32_t)(v) & UINT32_C(0x00ff0000)) >> 8)  |                           \
+	 (((uint32_t)(v) & UINT32_C(0xff000000)) >> 24))
+
 #define TCP_PROTOCOL_ID 0x6
 #define UDP_PROTOCOL_ID 0x11
 
@@ -217,64 +230,139 @@ __device__ uint32_t tcp_parse_timestamp(rte_tcp_hdr const *tcp)
 	return 0;
 }
 
-__global__ void _packet_receive_kernel(
-  doca_gpu_eth_rxq*       rxq_info,
-  doca_gpu_semaphore_gpu* sem_in,
-  int32_t                 sem_count,
-  int32_t*                sem_idx,
-  int32_t*                packet_count_out,
-  char*                   payload_buffer_out,
-  int32_t*                payload_size_total_out,
-  int32_t*                payload_sizes_out,
-  int64_t*                src_mac_out,
-  int64_t*                dst_mac_out,
-  int64_t*                src_ip_out,
-  int64_t*                dst_ip_out,
-  uint16_t*               src_port_out,
-  uint16_t*               dst_port_out,
-  int32_t*                tcp_flags_out,
-  int32_t*                ether_type_out,
-  int32_t*                next_proto_id_out,
-  uint32_t*               timestamp_out,
-  uint32_t*               exit_condition
+/**
+ * 64-bit finalizer (splitmix64) used to fold a flow tuple into the table key.
+ */
+__device__ __forceinline__ uint64_t flow_key_hash(uint64_t x)
+{
+  x ^= x >> 30;
+  x *= UINT64_C(0xbf58476d1ce4e5b9);
+  x ^= x >> 27;
+  x *= UINT64_C(0x94d049bb133111eb);
+  x ^= x >> 31;
+  return x;
+}
+
+/**
+ * Computes the table key for a flow tuple. Zero marks an empty slot, so a tuple mixing to zero is nudged to 1.
+ */
+__device__ __forceinline__ uint64_t flow_table_key(
+  uint32_t src_ip,
+  uint32_t dst_ip,
+  uint16_t src_port,
+  uint16_t dst_port
 )
 {
-  // Specialize BlockReduce for a 1D block of 128 threads of type int
-  using BlockReduce = cub::BlockReduce<int32_t, THREADS_PER_BLOCK>;
+  auto key = flow_key_hash((static_cast<uint64_t>(src_ip) << 32 | dst_ip) ^
+                           flow_key_hash(static_cast<uint64_t>(src_port) << 16 | dst_port));
 
-  // Allocate shared memory for BlockReduce
-  __shared__ typename BlockReduce::TempStorage temp_storage;
+  return key == 0 ? 1 : key;
+}
 
-  if (threadIdx.x == 0)
-  {
-    *packet_count_out = 0;
-    *payload_size_total_out = 0;
-  }
+/**
+ * Updates the flow table slot for one packet's tuple, claiming a slot with an atomicCAS on the mixed key.
+ * Flows are identified by the mixed key alone, so two tuples mixing to the same 64-bit value would share a
+ * slot; with 5-tuple entropy that is vanishingly rare for accounting purposes. A full table drops the update.
+ * Returns the slot's flagged word so the caller can exempt flagged flows from snap-length truncation.
+ */
+__device__ uint32_t flow_table_update(
+  morpheus::doca::FlowRecord* flow_table,
+  uint32_t src_ip,
+  uint32_t dst_ip,
+  uint16_t src_port,
+  uint16_t dst_port,
+  int32_t  payload_size,
+  uint32_t timestamp,
+  uint8_t  tcp_flags,
+  uint32_t sent_seq
+)
+{
+  auto key = flow_table_key(src_ip, dst_ip, src_port, dst_port);
 
-  __shared__ uint32_t packet_count_received;
-  __shared__ uint64_t packet_offset_received;
-  __shared__ doca_gpu_semaphore_status sem_status;
+  auto slot_idx = static_cast<uint32_t>(key) & (FLOW_TABLE_CAPACITY - 1);
 
-  while (true)
+  for (uint32_t probe = 0; probe < FLOW_TABLE_CAPACITY; probe++)
   {
-    auto ret = doca_gpu_dev_sem_get_status(sem_in, *sem_idx, &sem_status);
+    auto& slot = flow_table[slot_idx];
 
-    if (ret != DOCA_SUCCESS) {
-      DOCA_GPUNETIO_VOLATILE(*exit_condition) = 1;
-      return;
-    }
+    auto prior = atomicCAS(&slot.key, 0, key);
 
-    if (DOCA_GPUNETIO_VOLATILE(*exit_condition) == 1)
+    if (prior == 0)
     {
-      return;
+      // Newly claimed: record the tuple. A snapshot may observe a claimed slot before these writes land,
+      // which is acceptable for periodic accounting.
+      slot.src_ip          = src_ip;
+      slot.dst_ip          = dst_ip;
+      slot.src_port        = src_port;
+      slot.dst_port        = dst_port;
+      slot.first_timestamp = timestamp;
+
+      __threadfence();
     }
-
-    if (sem_status == DOCA_GPU_SEMAPHORE_STATUS_FREE)
+    else if (prior != key)
     {
-      break;
+      // Occupied by another flow, keep probing
+      slot_idx = (slot_idx + 1) & (FLOW_TABLE_CAPACITY - 1);
+      continue;
     }
+
+    atomicAdd(&slot.packet_count, 1);
+    atomicAdd(&slot.byte_count, static_cast<unsigned long long>(payload_size));
+    atomicMax(&slot.last_timestamp, timestamp);
+    atomicOr(&slot.tcp_flags_seen, static_cast<uint32_t>(tcp_flags));
+    atomicExch(&slot.last_seq, sent_seq);
+
+    return DOCA_GPUNETIO_VOLATILE(slot.flagged);
   }
 
+  return 0;
+}
+
+/**
+ * Receives one burst of packets and parses it directly into the emitted column layout: fixed-width
+ * fields at their row positions and payload bytes compacted at offsets computed with a block-wide
+ * scan, so no second gather pass is needed. With snap_len > 0 each captured payload is truncated to
+ * its first snap_len bytes unless the packet's flow is flagged in the flow table; flow byte counters
+ * always account the full wire payload. On return packet_count and payload_size_total hold
+ * block-uniform totals; a receive failure raises exit_condition and sets packet_count to -1.
+ */
+__device__ void receive_and_parse_burst(
+  doca_gpu_eth_rxq* rxq_info,
+  int32_t           snap_len,
+  char*             payload_chars_out,
+  int32_t*          payload_offsets_out,
+  int64_t*          src_mac_out,
+  int64_t*          dst_mac_out,
+  int64_t*          src_ip_out,
+  int64_t*          dst_ip_out,
+  uint16_t*         src_port_out,
+  uint16_t*         dst_port_out,
+  int32_t*          tcp_flags_out,
+  int32_t*          ether_type_out,
+  int32_t*          next_proto_id_out,
+  uint32_t*         timestamp_out,
+  morpheus::doca::FlowRecord* flow_table,
+  morpheus::doca::CaptureStats* stats,
+  uint32_t*         exit_condition,
+  int32_t&          packet_count,
+  int32_t&          payload_size_total
+)
+{
+  // Specialize BlockReduce for a 1D block of 128 threads of type int
+  using BlockReduce = cub::BlockReduce<int32_t, THREADS_PER_BLOCK>;
+
+  // Specialize BlockScan for computing the payload offsets
+  using BlockScan = cub::BlockScan<int32_t, THREADS_PER_BLOCK>;
+
+  // Allocate shared memory for BlockReduce and BlockScan
+  __shared__ typename BlockReduce::TempStorage reduce_temp_storage;
+  __shared__ typename BlockScan::TempStorage scan_temp_storage;
+
+  __shared__ uint32_t packet_count_received;
+  __shared__ uint64_t packet_offset_received;
+  __shared__ int32_t packet_count_shared;
+  __shared__ int32_t payload_size_total_shared;
+
   __syncthreads();
 
   DOCA_GPUNETIO_VOLATILE(packet_count_received) = 0;
@@ -291,6 +379,7 @@ __global__ void _packet_receive_kernel(
 
   if (ret != DOCA_SUCCESS) {
     DOCA_GPUNETIO_VOLATILE(*exit_condition) = 1;
+    packet_count = -1;
     return;
   }
 
@@ -298,6 +387,7 @@ __global__ void _packet_receive_kernel(
   __syncthreads();
 
   if (DOCA_GPUNETIO_VOLATILE(packet_count_received) == 0) {
+    packet_count = 0;
     return;
   }
 
@@ -306,7 +396,10 @@ __global__ void _packet_receive_kernel(
 
   int32_t payload_sizes[PACKETS_PER_THREAD];
   int32_t payload_flags[PACKETS_PER_THREAD];
+  uint8_t* payload_ptrs[PACKETS_PER_THREAD];
 
+  // First pass: parse headers, write the fixed-width fields in place and note each payload's
+  // source pointer and size so the bytes can be placed at their final offsets in the second pass
   for (auto i = 0; i < PACKETS_PER_THREAD; i++)
   {
     auto packet_idx = threadIdx.x * PACKETS_PER_THREAD + i;
@@ -314,6 +407,7 @@ __global__ void _packet_receive_kernel(
     if (packet_idx >= DOCA_GPUNETIO_VOLATILE(packet_count_received)) {
       payload_sizes[i] = 0;
       payload_flags[i] = 0;
+      payload_ptrs[i]  = nullptr;
       continue;
     }
 
@@ -325,19 +419,13 @@ __global__ void _packet_receive_kernel(
 
     struct eth_ip_tcp_hdr *hdr;
     uint8_t *payload;
-		raw_to_tcp(buf_addr, &hdr, &payload);
+    raw_to_tcp(buf_addr, &hdr, &payload);
 
     auto payload_size = get_payload_size(hdr->l3_hdr, hdr->l4_hdr);
 
-    for(auto j = 0; j < payload_size; j++)
-    {
-      payload_buffer_out[packet_idx * MAX_PKT_SIZE + j] = payload[j];
-    }
-
     payload_sizes[i] = payload_size;
     payload_flags[i] = 1;
-
-    payload_sizes_out[packet_idx] = payload_size;
+    payload_ptrs[i]  = payload;
 
     // mac address
     src_mac_out[packet_idx] = mac_bytes_to_int64(hdr->l2_hdr.s_addr_bytes);
@@ -370,25 +458,196 @@ __global__ void _packet_receive_kernel(
     auto now = cuda::std::chrono::system_clock::now();
     auto now_ms = cuda::std::chrono::time_point_cast<cuda::std::chrono::milliseconds>(now);
     auto epoch = now_ms.time_since_epoch();
-    timestamp_out[packet_idx] = epoch.count();
+    auto timestamp = static_cast<uint32_t>(epoch.count());
+    timestamp_out[packet_idx] = timestamp;
+
+    // flow accounting; byte counters record the full wire payload even when capture is snapped
+    auto flow_flagged = uint32_t{0};
+
+    if (flow_table != nullptr)
+    {
+      flow_flagged = flow_table_update(flow_table,
+                                       static_cast<uint32_t>(src_ip_out[packet_idx]),
+                                       static_cast<uint32_t>(dst_ip_out[packet_idx]),
+                                       src_port_out[packet_idx],
+                                       dst_port_out[packet_idx],
+                                       payload_size,
+                                       timestamp,
+                                       hdr->l4_hdr.tcp_flags,
+                                       BYTE_SWAP32(hdr->l4_hdr.sent_seq));
+    }
+
+    // Snap-length capture: the headers are already parsed into their columns, so truncating here only
+    // limits the payload bytes copied out; flagged flows keep their full payloads
+    if (snap_len > 0 && flow_flagged == 0 && payload_size > snap_len)
+    {
+      payload_sizes[i] = snap_len;
+    }
   }
 
-  auto payload_size_total = BlockReduce(temp_storage).Sum(payload_sizes);
+  __syncthreads();
+
+  int32_t payload_offsets[PACKETS_PER_THREAD];
+
+  BlockScan(scan_temp_storage).ExclusiveSum(payload_sizes, payload_offsets);
 
   __syncthreads();
 
-  auto packet_count = BlockReduce(temp_storage).Sum(payload_flags);
+  auto payload_size_total_local = BlockReduce(reduce_temp_storage).Sum(payload_sizes);
 
   __syncthreads();
 
+  auto packet_count_local = BlockReduce(reduce_temp_storage).Sum(payload_flags);
+
+  __syncthreads();
+
+  // Broadcast the totals, BlockReduce results are only valid on thread 0
   if (threadIdx.x == 0)
   {
-    *packet_count_out = packet_count;
-    *payload_size_total_out = payload_size_total;
+    packet_count_shared = packet_count_local;
+    payload_size_total_shared = payload_size_total_local;
+
+    // capture counters
+    if (stats != nullptr)
+    {
+      atomicAdd(&stats->packets_received, static_cast<unsigned long long>(packet_count_local));
+      atomicAdd(&stats->payload_bytes_received, static_cast<unsigned long long>(payload_size_total_local));
+      atomicAdd(&stats->bursts_received, 1);
+
+      if (packet_count_local == PACKETS_PER_BLOCK)
+      {
+        atomicAdd(&stats->full_bursts, 1);
+      }
+    }
+  }
+
+  __syncthreads();
+
+  packet_count = packet_count_shared;
+  payload_size_total = payload_size_total_shared;
+
+  // Second pass: place each payload at its final offset, producing the strings column's
+  // offsets + chars children in the same kernel
+  for (auto i = 0; i < PACKETS_PER_THREAD; i++)
+  {
+    auto packet_idx = threadIdx.x * PACKETS_PER_THREAD + i;
+
+    if (payload_flags[i] == 0) {
+      continue;
+    }
+
+    payload_offsets_out[packet_idx] = payload_offsets[i];
+
+    for(auto j = 0; j < payload_sizes[i]; j++)
+    {
+      payload_chars_out[payload_offsets[i] + j] = payload_ptrs[i][j];
+    }
+  }
+
+  if (threadIdx.x == 0)
+  {
+    payload_offsets_out[packet_count] = payload_size_total;
+  }
+}
+
+__global__ void _packet_receive_kernel(
+  doca_gpu_eth_rxq*       rxq_info,
+  doca_gpu_semaphore_gpu* sem_in,
+  int32_t                 sem_count,
+  int32_t*                sem_idx,
+  int32_t                 snap_len,
+  int32_t*                packet_count_out,
+  char*                   payload_chars_out,
+  int32_t*                payload_size_total_out,
+  int32_t*                payload_offsets_out,
+  int64_t*                src_mac_out,
+  int64_t*                dst_mac_out,
+  int64_t*                src_ip_out,
+  int64_t*                dst_ip_out,
+  uint16_t*               src_port_out,
+  uint16_t*               dst_port_out,
+  int32_t*                tcp_flags_out,
+  int32_t*                ether_type_out,
+  int32_t*                next_proto_id_out,
+  uint32_t*               timestamp_out,
+  morpheus::doca::FlowRecord* flow_table,
+  morpheus::doca::CaptureStats* stats,
+  uint32_t*               exit_condition
+)
+{
+  if (threadIdx.x == 0)
+  {
+    *packet_count_out = 0;
+    *payload_size_total_out = 0;
+  }
+
+  __shared__ doca_gpu_semaphore_status sem_status;
+
+  auto sem_was_full = false;
+
+  while (true)
+  {
+    auto ret = doca_gpu_dev_sem_get_status(sem_in, *sem_idx, &sem_status);
+
+    if (ret != DOCA_SUCCESS) {
+      DOCA_GPUNETIO_VOLATILE(*exit_condition) = 1;
+      return;
+    }
+
+    if (DOCA_GPUNETIO_VOLATILE(*exit_condition) == 1)
+    {
+      return;
+    }
+
+    if (sem_status == DOCA_GPU_SEMAPHORE_STATUS_FREE)
+    {
+      break;
+    }
+
+    sem_was_full = true;
+  }
+
+  if (threadIdx.x == 0 && stats != nullptr && sem_was_full)
+  {
+    atomicAdd(&stats->sem_full_events, 1);
+  }
+
+  __syncthreads();
+
+  int32_t packet_count = 0;
+  int32_t payload_size_total = 0;
+
+  receive_and_parse_burst(
+    rxq_info,
+    snap_len,
+    payload_chars_out,
+    payload_offsets_out,
+    src_mac_out,
+    dst_mac_out,
+    src_ip_out,
+    dst_ip_out,
+    src_port_out,
+    dst_port_out,
+    tcp_flags_out,
+    ether_type_out,
+    next_proto_id_out,
+    timestamp_out,
+    flow_table,
+    stats,
+    exit_condition,
+    packet_count,
+    payload_size_total
+  );
+
+  if (packet_count <= 0) {
+    return;
   }
 
   if (threadIdx.x == 0)
   {
+    *packet_count_out = packet_count;
+    *payload_size_total_out = payload_size_total;
+
     doca_gpu_dev_sem_set_status(
       sem_in,
       *sem_idx,
@@ -400,67 +659,241 @@ __global__ void _packet_receive_kernel(
   __syncthreads();
 }
 
-__global__ void _packet_gather_kernel(
-  int32_t  packet_count,
-  char*    payload_buffer,
-  int32_t* payload_sizes,
-  char*    payload_chars_out
+/**
+ * Persistent variant: a single long-running block polls the semaphore in device code and hands
+ * finished bursts to the host through the burst_ready flag, avoiding a kernel launch per burst.
+ * The host resets burst_ready to 0 once it has consumed the outputs; the kernel will not overwrite
+ * them before then. packet_count_out and payload_size_total_out must be host-visible
+ * (DOCA_GPU_MEM_GPU_CPU) since the host reads them while the kernel is still resident.
+ */
+__global__ void _packet_receive_persistent_kernel(
+  doca_gpu_eth_rxq*       rxq_info,
+  doca_gpu_semaphore_gpu* sem_in,
+  int32_t                 sem_count,
+  int32_t*                sem_idx,
+  int32_t                 snap_len,
+  int32_t*                packet_count_out,
+  char*                   payload_chars_out,
+  int32_t*                payload_size_total_out,
+  int32_t*                payload_offsets_out,
+  int64_t*                src_mac_out,
+  int64_t*                dst_mac_out,
+  int64_t*                src_ip_out,
+  int64_t*                dst_ip_out,
+  uint16_t*               src_port_out,
+  uint16_t*               dst_port_out,
+  int32_t*                tcp_flags_out,
+  int32_t*                ether_type_out,
+  int32_t*                next_proto_id_out,
+  uint32_t*               timestamp_out,
+  morpheus::doca::FlowRecord* flow_table,
+  morpheus::doca::CaptureStats* stats,
+  uint32_t*               burst_ready,
+  uint32_t*               exit_condition
 )
 {
-  // Specialize BlockScan for a 1D block of 128 threads of type int
-  using BlockScan = cub::BlockScan<int32_t, THREADS_PER_BLOCK>;
+  __shared__ doca_gpu_semaphore_status sem_status;
+
+  while (DOCA_GPUNETIO_VOLATILE(*exit_condition) == 0)
+  {
+    auto sem_was_full  = false;
+    auto host_was_busy = false;
 
-  // Allocate shared memory for BlockScan
-  __shared__ typename BlockScan::TempStorage temp_storage;
+    while (true)
+    {
+      auto ret = doca_gpu_dev_sem_get_status(sem_in, *sem_idx, &sem_status);
 
-  int32_t payload_capture[PACKETS_PER_THREAD];
-  int32_t payload_offsets[PACKETS_PER_THREAD];
+      if (ret != DOCA_SUCCESS) {
+        DOCA_GPUNETIO_VOLATILE(*exit_condition) = 1;
+        return;
+      }
 
-  for (auto i = 0; i < PACKETS_PER_THREAD; i++)
-  {
-    auto packet_idx = threadIdx.x * PACKETS_PER_THREAD + i;
+      if (DOCA_GPUNETIO_VOLATILE(*exit_condition) == 1)
+      {
+        return;
+      }
 
-    if (packet_idx >= packet_count) {
-      payload_capture[i] = 0;
-      payload_offsets[i] = 0;
-    } else {
-      payload_capture[i] = 1;
-      payload_offsets[i] = payload_sizes[packet_idx];
+      if (sem_status == DOCA_GPU_SEMAPHORE_STATUS_FREE)
+      {
+        break;
+      }
+
+      sem_was_full = true;
     }
-  }
 
-  __syncthreads();
+    __syncthreads();
 
-  int32_t data_offsets_agg;
-  BlockScan(temp_storage).ExclusiveSum(payload_offsets, payload_offsets, data_offsets_agg);
+    // Wait for the host to release the previous burst before overwriting the output buffers
+    while (DOCA_GPUNETIO_VOLATILE(*burst_ready) == 1)
+    {
+      if (DOCA_GPUNETIO_VOLATILE(*exit_condition) == 1)
+      {
+        return;
+      }
 
-  __syncthreads();
+      host_was_busy = true;
+    }
 
-  int32_t data_capture_agg;
-  BlockScan(temp_storage).ExclusiveSum(payload_capture, payload_capture, data_capture_agg);
+    if (threadIdx.x == 0 && stats != nullptr)
+    {
+      if (sem_was_full)
+      {
+        atomicAdd(&stats->sem_full_events, 1);
+      }
 
-  __syncthreads();
+      if (host_was_busy)
+      {
+        atomicAdd(&stats->host_stall_events, 1);
+      }
+    }
 
-  for (auto i = 0; i < PACKETS_PER_THREAD; i++)
-  {
-    auto packet_idx = threadIdx.x * PACKETS_PER_THREAD + i;
+    __syncthreads();
+
+    int32_t packet_count = 0;
+    int32_t payload_size_total = 0;
+
+    receive_and_parse_burst(
+      rxq_info,
+      snap_len,
+      payload_chars_out,
+      payload_offsets_out,
+      src_mac_out,
+      dst_mac_out,
+      src_ip_out,
+      dst_ip_out,
+      src_port_out,
+      dst_port_out,
+      tcp_flags_out,
+      ether_type_out,
+      next_proto_id_out,
+      timestamp_out,
+      flow_table,
+      stats,
+      exit_condition,
+      packet_count,
+      payload_size_total
+    );
+
+    if (packet_count < 0) {
+      return;
+    }
 
-    if (packet_idx >= packet_count) {
+    if (packet_count == 0) {
       continue;
     }
 
-    auto payload_size = payload_sizes[packet_idx];
+    if (threadIdx.x == 0)
+    {
+      *packet_count_out = packet_count;
+      *payload_size_total_out = payload_size_total;
+
+      doca_gpu_dev_sem_set_status(
+        sem_in,
+        *sem_idx,
+        DOCA_GPU_SEMAPHORE_STATUS_FREE
+      );
+    }
+
+    // Publish only after every output write has drained to system scope
+    __threadfence_system();
+    __syncthreads();
 
-    for (auto j = 0; j < payload_size; j++)
+    if (threadIdx.x == 0)
     {
-      auto value = payload_buffer[packet_idx * MAX_PKT_SIZE + j];
+      DOCA_GPUNETIO_VOLATILE(*burst_ready) = 1;
+    }
+
+    __syncthreads();
+  }
+}
 
-      auto payload_chars_out_idx = payload_offsets[i] + j;
+/**
+ * Compacts the occupied flow table slots into column arrays, one entry per claimed slot. flow_count
+ * receives the number of entries written.
+ */
+__global__ void _flow_table_snapshot_kernel(
+  morpheus::doca::FlowRecord* flow_table,
+  int32_t   capacity,
+  int32_t*  flow_count,
+  int64_t*  src_ip_out,
+  int64_t*  dst_ip_out,
+  uint16_t* src_port_out,
+  uint16_t* dst_port_out,
+  uint64_t* packet_count_out,
+  uint64_t* byte_count_out,
+  uint32_t* first_timestamp_out,
+  uint32_t* last_timestamp_out,
+  int32_t*  tcp_flags_seen_out,
+  uint32_t* last_seq_out
+)
+{
+  auto slot_idx = blockIdx.x * blockDim.x + threadIdx.x;
 
-      if (payload_chars_out_idx) {
-        payload_chars_out[payload_chars_out_idx] = value;
-      }
+  if (slot_idx >= capacity) {
+    return;
+  }
+
+  auto& slot = flow_table[slot_idx];
+
+  if (slot.key == 0) {
+    return;
+  }
+
+  auto out_idx = atomicAdd(flow_count, 1);
+
+  src_ip_out[out_idx]          = static_cast<int64_t>(slot.src_ip);
+  dst_ip_out[out_idx]          = static_cast<int64_t>(slot.dst_ip);
+  src_port_out[out_idx]        = slot.src_port;
+  dst_port_out[out_idx]        = slot.dst_port;
+  packet_count_out[out_idx]    = slot.packet_count;
+  byte_count_out[out_idx]      = slot.byte_count;
+  first_timestamp_out[out_idx] = slot.first_timestamp;
+  last_timestamp_out[out_idx]  = slot.last_timestamp;
+  tcp_flags_seen_out[out_idx]  = static_cast<int32_t>(slot.tcp_flags_seen);
+  last_seq_out[out_idx]        = slot.last_seq;
+}
+
+/**
+ * Sets the flagged word on the slot for one flow tuple, claiming a slot the same way the receive path
+ * does so flows can be flagged before their first packet arrives. Single-threaded; flagging is a rare
+ * control-plane action.
+ */
+__global__ void _flow_table_flag_kernel(
+  morpheus::doca::FlowRecord* flow_table,
+  uint32_t src_ip,
+  uint32_t dst_ip,
+  uint16_t src_port,
+  uint16_t dst_port
+)
+{
+  auto key = flow_table_key(src_ip, dst_ip, src_port, dst_port);
+
+  auto slot_idx = static_cast<uint32_t>(key) & (FLOW_TABLE_CAPACITY - 1);
+
+  for (uint32_t probe = 0; probe < FLOW_TABLE_CAPACITY; probe++)
+  {
+    auto& slot = flow_table[slot_idx];
+
+    auto prior = atomicCAS(&slot.key, 0, key);
+
+    if (prior == 0)
+    {
+      slot.src_ip   = src_ip;
+      slot.dst_ip   = dst_ip;
+      slot.src_port = src_port;
+      slot.dst_port = dst_port;
+
+      __threadfence();
+    }
+    else if (prior != key)
+    {
+      slot_idx = (slot_idx + 1) & (FLOW_TABLE_CAPACITY - 1);
+      continue;
     }
+
+    DOCA_GPUNETIO_VOLATILE(slot.flagged) = 1;
+
+    return;
   }
 }
 
@@ -551,31 +984,15 @@ void cuda_memory_test1()
     CUDA_TRY(cudaFree(d_a));
 }
 
-void cuda_memory_test2()
-{
-    const unsigned int N = 10485760;
-    const unsigned int bytes = N * sizeof(int);
-    int *h_a = (int*)malloc(bytes);
-    memset(h_a, 0, bytes);
-    int *d_a;
-
-    CUDA_TRY(cudaMalloc((int**)&d_a, bytes));
-    CUDA_TRY(cudaMemcpy(d_a, h_a, bytes, cudaMemcpyHostToDevice));
-    CUDA_TRY(cudaMemcpy(h_a, d_a, bytes, cudaMemcpyDeviceToHost));
-
-    free(h_a);
-    CUDA_TRY(cudaFree(d_a));
-}
-
 void packet_receive_kernel(
   doca_gpu_eth_rxq*       rxq_info,
   doca_gpu_semaphore_gpu* sem_in,
   int32_t                 sem_count,
   int32_t*                sem_idx,
   int32_t*                packet_count_out,
-  char*                   payload_buffer_out,
+  char*                   payload_chars_out,
   int32_t*                payload_size_total_out,
-  int32_t*                payload_sizes_out,
+  int32_t*                payload_offsets_out,
   int64_t*                src_mac_out,
   int64_t*                dst_mac_out,
   int64_t*                src_ip_out,
@@ -586,6 +1003,9 @@ void packet_receive_kernel(
   int32_t*                ether_type_out,
   int32_t*                next_proto_id_out,
   uint32_t*               timestamp_out,
+  int32_t                 snap_len,
+  morpheus::doca::FlowRecord* flow_table,
+  morpheus::doca::CaptureStats* stats,
   uint32_t*               exit_condition,
   cudaStream_t            stream
 )
@@ -595,10 +1015,11 @@ void packet_receive_kernel(
     sem_in,
     sem_count,
     sem_idx,
+    snap_len,
     packet_count_out,
-    payload_buffer_out,
+    payload_chars_out,
     payload_size_total_out,
-    payload_sizes_out,
+    payload_offsets_out,
     src_mac_out,
     dst_mac_out,
     src_ip_out,
@@ -609,6 +1030,8 @@ void packet_receive_kernel(
     ether_type_out,
     next_proto_id_out,
     timestamp_out,
+    flow_table,
+    stats,
     exit_condition
   );
 
@@ -619,41 +1042,144 @@ void packet_receive_kernel(
   CHECK_CUDA(stream);
 }
 
-std::unique_ptr<cudf::column> gather_payload(
-  int32_t      packet_count,
-  char*        payload_buffer,
-  int32_t*     payload_sizes,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr)
+void packet_receive_persistent_kernel(
+  doca_gpu_eth_rxq*       rxq_info,
+  doca_gpu_semaphore_gpu* sem_in,
+  int32_t                 sem_count,
+  int32_t*                sem_idx,
+  int32_t*                packet_count_out,
+  char*                   payload_chars_out,
+  int32_t*                payload_size_total_out,
+  int32_t*                payload_offsets_out,
+  int64_t*                src_mac_out,
+  int64_t*                dst_mac_out,
+  int64_t*                src_ip_out,
+  int64_t*                dst_ip_out,
+  uint16_t*               src_port_out,
+  uint16_t*               dst_port_out,
+  int32_t*                tcp_flags_out,
+  int32_t*                ether_type_out,
+  int32_t*                next_proto_id_out,
+  uint32_t*               timestamp_out,
+  int32_t                 snap_len,
+  morpheus::doca::FlowRecord* flow_table,
+  morpheus::doca::CaptureStats* stats,
+  uint32_t*               burst_ready,
+  uint32_t*               exit_condition,
+  cudaStream_t            stream
+)
 {
-  auto [offsets_column, bytes] = cudf::detail::make_offsets_child_column(
-    payload_sizes,
-    payload_sizes + packet_count,
-    stream,
-    mr
+  _packet_receive_persistent_kernel<<<1, THREADS_PER_BLOCK, 0, stream>>>(
+    rxq_info,
+    sem_in,
+    sem_count,
+    sem_idx,
+    snap_len,
+    packet_count_out,
+    payload_chars_out,
+    payload_size_total_out,
+    payload_offsets_out,
+    src_mac_out,
+    dst_mac_out,
+    src_ip_out,
+    dst_ip_out,
+    src_port_out,
+    dst_port_out,
+    tcp_flags_out,
+    ether_type_out,
+    next_proto_id_out,
+    timestamp_out,
+    flow_table,
+    stats,
+    burst_ready,
+    exit_condition
   );
 
-  auto chars_column = cudf::strings::detail::create_chars_child_column(bytes, stream, mr);
-  auto d_chars      = chars_column->mutable_view().data<char>();
+  CHECK_CUDA(stream);
+}
 
-  _packet_gather_kernel<<<1, THREADS_PER_BLOCK, 0, stream>>>(
-    packet_count,
-    payload_buffer,
-    payload_sizes,
-    d_chars
+std::unique_ptr<cudf::table> flow_table_snapshot(
+  FlowRecord*  flow_table,
+  int32_t      capacity,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto flow_count_d = rmm::device_scalar<int32_t>(0, stream);
+
+  auto src_ip_d          = rmm::device_uvector<int64_t>(capacity, stream, mr);
+  auto dst_ip_d          = rmm::device_uvector<int64_t>(capacity, stream, mr);
+  auto src_port_d        = rmm::device_uvector<uint16_t>(capacity, stream, mr);
+  auto dst_port_d        = rmm::device_uvector<uint16_t>(capacity, stream, mr);
+  auto packet_count_d    = rmm::device_uvector<uint64_t>(capacity, stream, mr);
+  auto byte_count_d      = rmm::device_uvector<uint64_t>(capacity, stream, mr);
+  auto first_timestamp_d = rmm::device_uvector<uint32_t>(capacity, stream, mr);
+  auto last_timestamp_d  = rmm::device_uvector<uint32_t>(capacity, stream, mr);
+  auto tcp_flags_seen_d  = rmm::device_uvector<int32_t>(capacity, stream, mr);
+  auto last_seq_d        = rmm::device_uvector<uint32_t>(capacity, stream, mr);
+
+  auto block_count = (capacity + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+
+  _flow_table_snapshot_kernel<<<block_count, THREADS_PER_BLOCK, 0, stream>>>(
+    flow_table,
+    capacity,
+    flow_count_d.data(),
+    src_ip_d.data(),
+    dst_ip_d.data(),
+    src_port_d.data(),
+    dst_port_d.data(),
+    packet_count_d.data(),
+    byte_count_d.data(),
+    first_timestamp_d.data(),
+    last_timestamp_d.data(),
+    tcp_flags_seen_d.data(),
+    last_seq_d.data()
   );
 
   CHECK_CUDA(stream);
 
-  cuda_memory_test2();
+  auto flow_count = flow_count_d.value(stream);
+
+  auto make_column = [flow_count](auto& data) {
+    using value_type = typename std::remove_reference_t<decltype(data)>::value_type;
+
+    return std::make_unique<cudf::column>(
+      cudf::data_type{cudf::type_to_id<value_type>()}, flow_count, data.release(), rmm::device_buffer{}, 0);
+  };
+
+  auto columns = std::vector<std::unique_ptr<cudf::column>>();
+  columns.reserve(10);
+
+  auto src_ip_col = make_column(src_ip_d);
+  columns.emplace_back(cudf::strings::integers_to_ipv4(src_ip_col->view(), stream, mr));
+
+  auto dst_ip_col = make_column(dst_ip_d);
+  columns.emplace_back(cudf::strings::integers_to_ipv4(dst_ip_col->view(), stream, mr));
+
+  columns.emplace_back(make_column(src_port_d));
+  columns.emplace_back(make_column(dst_port_d));
+  columns.emplace_back(make_column(packet_count_d));
+  columns.emplace_back(make_column(byte_count_d));
+  columns.emplace_back(make_column(first_timestamp_d));
+  columns.emplace_back(make_column(last_timestamp_d));
+  columns.emplace_back(make_column(tcp_flags_seen_d));
+  columns.emplace_back(make_column(last_seq_d));
+
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+void flow_table_flag(
+  FlowRecord* flow_table,
+  uint32_t    src_ip,
+  uint32_t    dst_ip,
+  uint16_t    src_port,
+  uint16_t    dst_port,
+  rmm::cuda_stream_view stream)
+{
+  _flow_table_flag_kernel<<<1, 1, 0, stream>>>(flow_table, src_ip, dst_ip, src_port, dst_port);
 
   CHECK_CUDA(stream);
 
-  return cudf::make_strings_column(packet_count,
-    std::move(offsets_column),
-    std::move(chars_column),
-    0,
-    {});
+  cudaStreamSynchronize(stream);
 }
 
 }
@@ -22,21 +22,39 @@
 #include <glog/logging.h>
 #include <rte_eal.h>
 
-#include <array>
+#include <string>
+#include <vector>
 
 namespace morpheus::doca {
 
-RTEContext::RTEContext()
+RTEContext::RTEContext(RTEOptions options)
 {
-    auto argv = std::vector<char*>();
+    std::vector<std::string> args;
+
+    args.emplace_back("");  // program name
+    args.emplace_back("-a");
+    args.emplace_back("00:00.0");
+
+    if (!options.lcores.empty())
+    {
+        args.emplace_back("-l");
+        args.emplace_back(options.lcores);
+    }
 
-    std::array<char, 1> fake_program = {""};
-    argv.push_back(fake_program.begin());
+    if (!options.socket_mem.empty())
+    {
+        args.emplace_back("--socket-mem=" + options.socket_mem);
 
-    std::array<char, 3> a_flag           = {"-a"};
-    std::array<char, 8> fake_pci_address = {"00:00.0"};
-    argv.push_back(a_flag.begin());
-    argv.push_back(fake_pci_address.begin());
+        // Without the matching limit, demand paging past the reservation could still fault hugepages onto the
+        // remote node; the explicit reservation is meant to be the whole capture footprint
+        args.emplace_back("--socket-limit=" + options.socket_mem);
+    }
+
+    auto argv = std::vector<char*>();
+    for (auto& arg : args)
+    {
+        argv.push_back(arg.data());
+    }
 
     RTE_TRY(rte_eal_init(argv.size(), argv.data()));
 }
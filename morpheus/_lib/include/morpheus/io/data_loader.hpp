@@ -22,9 +22,15 @@
 
 #include <nlohmann/json.hpp>
 
+#include <atomic>   // for atomic
+#include <chrono>   // for steady_clock & seconds
+#include <cstddef>  // for size_t
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>  // for pair
+#include <vector>
 
 namespace morpheus {
 
@@ -71,6 +77,17 @@ class Loader
      */
     virtual std::shared_ptr<ControlMessage> load(std::shared_ptr<ControlMessage> message, nlohmann::json task);
 
+    /**
+     * @brief Virtual method for loading a batch of control messages in a single invocation. The base
+     * implementation simply loops over `load`; loaders whose backing callable amortizes per-call overhead
+     * (e.g. a Python lambda acquiring the GIL) should override it.
+     * @param messages The control messages to be loaded.
+     * @param tasks A json task description per message, parallel to `messages`.
+     * @return The loaded control messages, in the same order as `messages`.
+     */
+    virtual std::vector<std::shared_ptr<ControlMessage>> load_batch(
+        std::vector<std::shared_ptr<ControlMessage>> messages, std::vector<nlohmann::json> tasks);
+
   protected:
     /**
      * @brief Protected method for accessing the loader's configuration information.
@@ -114,6 +131,16 @@ class DataLoader
      */
     std::shared_ptr<ControlMessage> load(std::shared_ptr<ControlMessage> control_message);
 
+    /**
+     * @brief Method for loading a batch of control messages using the registered loaders. Pending load tasks
+     * are popped round-robin across the batch and grouped by loader, so each loader sees one `load_batch` call
+     * per round instead of one `load` call per message.
+     * @param control_messages The control messages to be loaded.
+     * @return The loaded control messages, in the same order as `control_messages`.
+     */
+    std::vector<std::shared_ptr<ControlMessage>> load_batch(
+        std::vector<std::shared_ptr<ControlMessage>> control_messages);
+
     /**
      * @brief Method for registering a loader instance with the data loader.
      * @param loader_id A string identifier for the loader instance.
@@ -132,8 +159,36 @@ class DataLoader
     void remove_loader(const std::string& loader_id, bool throw_if_not_found = true);
 
   private:
-    std::map<std::string, std::shared_ptr<Loader>> m_loaders{};  // Map of registered loader instances.
+    /**
+     * @brief Cached payload for a previously executed load task, shared with every message that repeats the task
+     * while the entry is fresh.
+     */
+    struct CacheEntry
+    {
+        std::shared_ptr<MessageMeta> payload;
+        std::chrono::steady_clock::time_point expires_at;
+        std::size_t bytes{0};
+    };
+
+    std::shared_ptr<MessageMeta> cache_lookup(const std::string& key);
+    void cache_store(const std::string& key, std::shared_ptr<MessageMeta> payload);
+
+    std::shared_ptr<Loader> find_loader(const std::string& loader_id) const;
+
+    // Registered loader instances, pre-bound at module init into a flat id-sorted table. Dispatch is a binary
+    // search, short-circuited to an indexed access when consecutive tasks reuse the same loader. The cached index
+    // is atomic since `load` may be invoked concurrently when payload prefetch is enabled.
+    std::vector<std::pair<std::string, std::shared_ptr<Loader>>> m_loaders{};
+    mutable std::atomic<std::size_t> m_last_loader_idx{0};
     nlohmann::json m_config;
+
+    // Opt-in content-addressed payload cache, see the "cache_payloads" config key
+    bool m_cache_enabled{false};
+    std::chrono::seconds m_cache_ttl{300};
+    std::size_t m_cache_max_bytes{0};
+    std::mutex m_cache_mutex;
+    std::map<std::string, CacheEntry> m_payload_cache;
+    std::size_t m_cache_bytes{0};
 };
 
 #pragma GCC visibility pop
@@ -27,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace morpheus {
 #pragma GCC visibility push(default)
@@ -43,6 +44,17 @@ struct LoaderRegistryProxy
             proxy_constructor,
         bool throw_if_exists = true);
 
+    /**
+     * @brief Register a batched python loader. The callable receives the queued messages and their task
+     * dictionaries as parallel lists in a single invocation, amortizing GIL acquisition across the batch and
+     * letting the python side vectorize.
+     */
+    static void register_proxy_factory_fn_batched(
+        const std::string& name,
+        std::function<std::vector<std::shared_ptr<ControlMessage>>(std::vector<std::shared_ptr<ControlMessage>>,
+                                                                   pybind11::list)> proxy_constructor,
+        bool throw_if_exists = true);
+
     static void register_factory_cleanup_fn(const std::string& name);
 };
 
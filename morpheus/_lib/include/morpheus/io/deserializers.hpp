@@ -17,11 +17,14 @@
 
 #pragma once
 
+#include "morpheus/objects/dtype.hpp"       // for TableSchema
 #include "morpheus/objects/file_types.hpp"  // for FileTypes
 
 #include <cudf/io/types.hpp>
+#include <cudf/types.hpp>      // for data_type
 #include <pybind11/pytypes.h>  // for pybind11::object
 
+#include <cstddef>  // for size_t
 #include <optional>
 #include <string>
 #include <vector>
@@ -34,6 +37,23 @@ namespace morpheus {
  * @file
  */
 
+/**
+ * @brief Byte size at or below which line-delimited JSON is parsed on the host instead of through cudf. For tiny
+ * payloads the GPU reader's kernel launches and transfer setup dwarf the actual parse cost.
+ */
+constexpr std::size_t JsonHostParseMaxBytes = 64UL << 10;
+
+/**
+ * @brief Parses line-delimited JSON on the host, builds host-side columns and uploads them to the device in a
+ * single copy. Column dtypes are inferred as the widest of the values seen (bool, int64, float64 or string, with
+ * any other mixture widening to string) and missing keys become nulls. Intended for payloads at or below
+ * `JsonHostParseMaxBytes`; above that the cudf reader parses faster.
+ *
+ * @param json_lines : Buffer holding one JSON object per line
+ * @return cudf::io::table_with_metadata
+ */
+cudf::io::table_with_metadata load_json_lines_host(const std::string& json_lines);
+
 /**
  * @brief Get the column names from table object. Looks at both column_names as well as schema_info and returns the
  * correct one.
@@ -43,15 +63,117 @@ namespace morpheus {
  */
 std::vector<std::string> get_column_names_from_table(const cudf::io::table_with_metadata& table);
 
+/**
+ * @brief Reduces `table` in place to the requested column subset, in the requested order. Used to apply a column
+ * projection for readers which cannot prune columns at parse time. Throws if a requested column is missing.
+ *
+ * @param table The table to filter
+ * @param columns Names of the columns to keep, an empty vector leaves the table unchanged
+ */
+void filter_table_columns(cudf::io::table_with_metadata& table, const std::vector<std::string>& columns);
+
+/**
+ * @brief Sorts `table` in place by the named key column, entirely on device. A stable sort is used so rows with
+ * equal keys keep their arrival order. Sources use this so downstream per-entity slicing operates on contiguous
+ * runs instead of scattered rows. Throws if the column is missing.
+ *
+ * @param table The table to sort
+ * @param column_name Name of the key column, an empty string leaves the table unchanged
+ */
+void sort_table_by_column(cudf::io::table_with_metadata& table, const std::string& column_name);
+
 /**
  * @brief Loads a cudf table from either CSV or JSON file
  *
  * @param filename : Name of the file that should be loaded into a table
+ * @param columns : When non-empty, only parse/retain this column subset. CSV and Parquet prune at parse time,
+ * JSON is filtered after parsing since the cudf JSON reader has no column selection.
+ * @param schema : When non-empty, pins the dtype of each listed column for the CSV and JSON readers, skipping the
+ * per-file type inference pass. Self-describing formats (Parquet, Arrow) ignore it.
  * @return cudf::io::table_with_metadata
  */
 cudf::io::table_with_metadata load_table_from_file(const std::string& filename,
-                                                   FileTypes file_type            = FileTypes::Auto,
-                                                   std::optional<bool> json_lines = std::nullopt);
+                                                   FileTypes file_type                    = FileTypes::Auto,
+                                                   std::optional<bool> json_lines         = std::nullopt,
+                                                   const std::vector<std::string>& columns = {},
+                                                   const TableSchema& schema               = {});
+
+/**
+ * @brief Parallel variant of `load_table_from_file` for large CSV and JSON-lines files. The file is split into byte
+ * ranges which are parsed concurrently on a thread pool using cudf's byte-range support and concatenated on device,
+ * so the parse throughput scales with the thread count. Small files, Parquet files (whose reader is already
+ * internally parallel) and non-line-delimited JSON fall back to the single-call loader.
+ *
+ * @param filename : Name of the file that should be loaded into a table
+ * @param file_type : Type of the file, `Auto` determines it from the extension
+ * @param json_lines : Whether a JSON file is line-delimited, defaults to true
+ * @param columns : When non-empty, only retain this column subset. Applied after the parallel parse
+ * @param num_threads : Number of reader threads, `0` picks from the hardware concurrency
+ * @param schema : When non-empty, pins the dtype of each listed column for the CSV and JSON readers, skipping the
+ * per-range type inference pass
+ * @return cudf::io::table_with_metadata
+ */
+cudf::io::table_with_metadata load_table_from_file_parallel(const std::string& filename,
+                                                            FileTypes file_type             = FileTypes::Auto,
+                                                            std::optional<bool> json_lines  = std::nullopt,
+                                                            const std::vector<std::string>& columns = {},
+                                                            std::size_t num_threads         = 0,
+                                                            const TableSchema& schema       = {});
+
+/**
+ * @brief Reads a CSV or line-delimited JSON file in fixed byte ranges (cudf's byte-range support), so a consumer
+ * can emit one table per chunk instead of materializing the whole file. For CSV the first range parses the header
+ * and its names and inferred dtypes are reused for every later range, so all chunks agree on the schema. For
+ * JSON-lines each range infers independently; pinning dtypes via `schema` is recommended when keys are sparse. A
+ * range holding no complete record parses to an empty table.
+ */
+class ChunkedTableReader
+{
+  public:
+    /**
+     * @brief Construct a reader over `filename`, split into `chunk_bytes` sized ranges.
+     *
+     * @throws std::invalid_argument
+     * If the file is not CSV or line-delimited JSON (the only formats cudf can split by byte range), or if
+     * `chunk_bytes` is zero.
+     *
+     * @param filename : Name of the file to read
+     * @param file_type : Type of the file, `Auto` determines it from the extension
+     * @param json_lines : Whether a JSON file is line-delimited, defaults to true
+     * @param columns : When non-empty, only retain this column subset, applied per chunk
+     * @param schema : When non-empty, pins the dtype of each listed column
+     * @param chunk_bytes : Size of each byte range
+     */
+    ChunkedTableReader(std::string filename,
+                       FileTypes file_type,
+                       std::optional<bool> json_lines,
+                       std::vector<std::string> columns,
+                       TableSchema schema,
+                       std::size_t chunk_bytes);
+
+    /**
+     * @brief Returns true while byte ranges remain to be parsed.
+     */
+    bool has_next() const;
+
+    /**
+     * @brief Parses and returns the next byte range.
+     */
+    cudf::io::table_with_metadata next();
+
+  private:
+    std::string m_filename;
+    FileTypes m_file_type;
+    std::vector<std::string> m_columns;
+    TableSchema m_schema;
+    std::size_t m_chunk_bytes;
+    std::size_t m_file_size;
+    std::size_t m_offset{0};
+
+    // Names and dtypes from the first CSV range, reused for the header-less later ranges
+    std::vector<std::string> m_csv_names;
+    std::vector<cudf::data_type> m_csv_dtypes;
+};
 
 /**
  * @brief Returns the number of index columns in `data_table`, in practice this will be a `0` or `1`
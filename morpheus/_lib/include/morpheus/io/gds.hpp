@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+#include <sys/types.h>  // for off_t, ssize_t
+
+#include <cstddef>  // for size_t
+#include <string>
+
+namespace morpheus {
+
+/**
+ * @addtogroup IO
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Registered cuFile (GPUDirect Storage) handle over a file, letting device memory move to and from storage
+ * without bouncing through the host. cuFile is a soft dependency: the library is resolved with `dlopen` on first
+ * use, so nothing here requires GDS at build or install time. A default-constructed or failed-to-open handle is
+ * simply invalid, and callers fall back to their host I/O path.
+ *
+ * Movable, not copyable. The handle owns its `O_DIRECT` descriptor; callers doing host-side I/O on the same file
+ * use their own buffered descriptor alongside it.
+ */
+class MORPHEUS_EXPORT GDSFileHandle
+{
+  public:
+    GDSFileHandle() = default;
+    ~GDSFileHandle();
+
+    GDSFileHandle(GDSFileHandle&& other) noexcept;
+    GDSFileHandle& operator=(GDSFileHandle&& other) noexcept;
+
+    GDSFileHandle(const GDSFileHandle&)            = delete;
+    GDSFileHandle& operator=(const GDSFileHandle&) = delete;
+
+    /**
+     * @brief Open `filename` for reading through cuFile. Returns an invalid handle when the driver, library or
+     * filesystem cannot do GDS.
+     *
+     * @param filename : File to open
+     * @return GDSFileHandle
+     */
+    static GDSFileHandle open_read(const std::string& filename);
+
+    /**
+     * @brief Open an existing `filename` for writing through cuFile. The file is neither created nor truncated,
+     * callers create it through their buffered descriptor first. Returns an invalid handle when GDS is unavailable.
+     *
+     * @param filename : File to open
+     * @return GDSFileHandle
+     */
+    static GDSFileHandle open_write(const std::string& filename);
+
+    /**
+     * @brief Returns true when the handle is registered with the cuFile driver and usable
+     *
+     * @return bool
+     */
+    bool valid() const;
+
+    /**
+     * @brief Read `size` bytes at `file_offset` straight into device memory
+     *
+     * @param device_data : Destination pointer in device memory
+     * @param size : Number of bytes to read
+     * @param file_offset : Offset in the file
+     * @return ssize_t Bytes read, negative on error
+     */
+    ssize_t read(void* device_data, std::size_t size, off_t file_offset) const;
+
+    /**
+     * @brief Write `size` bytes at `file_offset` straight from device memory
+     *
+     * @param device_data : Source pointer in device memory
+     * @param size : Number of bytes to write
+     * @param file_offset : Offset in the file
+     * @return ssize_t Bytes written, negative on error
+     */
+    ssize_t write(const void* device_data, std::size_t size, off_t file_offset) const;
+
+    /**
+     * @brief Deregister the handle and close the descriptor, leaving the handle invalid. Used by callers falling
+     * back to host I/O mid-file; also runs on destruction.
+     */
+    void close();
+
+  private:
+    GDSFileHandle(int fd, void* handle);
+
+    static GDSFileHandle open(const std::string& filename, int flags);
+
+    int m_fd{-1};
+    void* m_handle{nullptr};  // CUfileHandle_t, kept opaque so <cufile.h> stays out of this header
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
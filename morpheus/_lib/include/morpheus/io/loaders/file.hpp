@@ -19,10 +19,16 @@
 
 #include "morpheus/io/data_loader.hpp"
 #include "morpheus/messages/control.hpp"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/file_types.hpp"
 
 #include <nlohmann/json.hpp>
 
+#include <cstddef>  // for size_t
 #include <memory>
+#include <string>
+#include <utility>  // for pair
+#include <vector>
 
 namespace morpheus {
 #pragma GCC visibility push(default)
@@ -40,6 +46,19 @@ class FileDataLoader : public Loader
     FileDataLoader(nlohmann::json config);
 
     std::shared_ptr<ControlMessage> load(std::shared_ptr<ControlMessage> message, nlohmann::json task) final;
+
+  private:
+    /**
+     * @brief Loads `files` concurrently on a thread pool through the C++ readers and concatenates the results once
+     * on device, never touching python. Tasks listing many small files are bound by per-file latency, not bandwidth,
+     * so the pool collapses the serial load into a handful of waves.
+     *
+     * @param files : Pairs of path and resolved file type
+     * @param num_threads : Number of loader threads, `0` uses the hardware concurrency
+     * @return std::shared_ptr<MessageMeta> holding the aggregated dataframe
+     */
+    std::shared_ptr<MessageMeta> load_parallel(const std::vector<std::pair<std::string, FileTypes>>& files,
+                                               std::size_t num_threads);
 };
 #pragma GCC visibility pop
 }  // namespace morpheus
\ No newline at end of file
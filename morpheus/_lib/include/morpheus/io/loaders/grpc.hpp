@@ -27,8 +27,9 @@
 namespace morpheus {
 #pragma GCC visibility push(default)
 /**
- * @brief Very simple raw data loader that takes payload data on the control message and returns it
- *
+ * @brief Loader which pulls its payload over a server-streaming gRPC call. Each streamed message carries a chunk of
+ * an Arrow IPC stream; record batches are moved to device as they are decoded and concatenated into the payload
+ * table once the stream completes.
  */
 class GRPCDataLoader : public Loader
 {
@@ -24,6 +24,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace morpheus {
 #pragma GCC visibility push(default)
@@ -34,17 +35,35 @@ namespace morpheus {
 class LambdaLoader : public Loader
 {
   public:
+    using lambda_load_t =
+        std::function<std::shared_ptr<ControlMessage>(std::shared_ptr<ControlMessage>, nlohmann::json)>;
+    using lambda_load_batch_t = std::function<std::vector<std::shared_ptr<ControlMessage>>(
+        std::vector<std::shared_ptr<ControlMessage>>, std::vector<nlohmann::json>)>;
+
     ~LambdaLoader() = default;
 
     LambdaLoader() = delete;
-    LambdaLoader(
-        std::function<std::shared_ptr<ControlMessage>(std::shared_ptr<ControlMessage>, nlohmann::json)> lambda_load,
-        nlohmann::json config = {});
+    LambdaLoader(lambda_load_t lambda_load, nlohmann::json config = {});
+
+    /**
+     * @brief Construct a batched LambdaLoader. The callable is handed every queued (message, task) pair in a
+     * single invocation, amortizing per-call overhead (notably GIL acquisition when the callable is a Python
+     * proxy) and letting user code vectorize across the batch.
+     *
+     * @param lambda_load_batch Callable invoked once per batch with parallel message and task lists, returning
+     * the loaded messages in the same order.
+     * @param config A json object containing configuration information for the loader.
+     */
+    LambdaLoader(lambda_load_batch_t lambda_load_batch, nlohmann::json config = {});
 
     std::shared_ptr<ControlMessage> load(std::shared_ptr<ControlMessage> message, nlohmann::json task) final;
 
+    std::vector<std::shared_ptr<ControlMessage>> load_batch(std::vector<std::shared_ptr<ControlMessage>> messages,
+                                                            std::vector<nlohmann::json> tasks) final;
+
   private:
-    std::function<std::shared_ptr<ControlMessage>(std::shared_ptr<ControlMessage>, nlohmann::json)> m_lambda_load;
+    lambda_load_t m_lambda_load;
+    lambda_load_batch_t m_lambda_load_batch;
 };
 #pragma GCC visibility pop
 }  // namespace morpheus
\ No newline at end of file
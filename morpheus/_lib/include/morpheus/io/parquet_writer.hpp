@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/objects/table_info.hpp"
+#include "morpheus/utilities/edge_gauges.hpp"  // for EdgeGauge
+
+#include <cudf/table/table.hpp>
+
+#include <chrono>              // for seconds
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <deque>
+#include <exception>  // for exception_ptr
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace morpheus {
+#pragma GCC visibility push(default)
+/**
+ * @addtogroup IO
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Long-lived Parquet sink which encodes batches on a pool of background writer threads. `write_async`
+ * snapshots the table on device and returns immediately; each snapshot is encoded into its own sequence-numbered
+ * file, so the encode throughput scales with the thread count instead of serializing on the caller. When a window
+ * length is given, files land in a `window_<start>` subdirectory per wall-clock window, giving downstream consumers
+ * time-partitioned output.
+ *
+ * The writer owns its partitioning and queue state for its whole lifetime; create one per archive leg rather than
+ * per call.
+ */
+class ParquetPartitionedSink
+{
+  public:
+    /**
+     * @brief Construct a new sink.
+     *
+     * @param output_dir : Directory the partition files are written to, created if missing
+     * @param file_prefix : Prefix for the generated `<prefix>-<sequence>.parquet` file names
+     * @param num_writer_threads : Number of background encoder threads
+     * @param window : Wall-clock length of a time partition, `0` writes everything into `output_dir` directly
+     */
+    ParquetPartitionedSink(std::string output_dir,
+                           std::string file_prefix,
+                           std::size_t num_writer_threads = 2,
+                           std::chrono::seconds window    = std::chrono::seconds(0));
+
+    ~ParquetPartitionedSink();
+
+    /**
+     * @brief Snapshot `tbl` on device and queue it for encoding, returning without waiting for the write. Throws
+     * `std::runtime_error` if the sink has been closed or a previous background write failed.
+     */
+    void write_async(const TableInfo& tbl);
+
+    /**
+     * @brief Block until every queued batch has been encoded and flushed to disk. Rethrows the first error raised
+     * by a background write.
+     */
+    void flush();
+
+    /**
+     * @brief Flush and stop the writer threads. Called by the destructor if not called explicitly.
+     */
+    void close();
+
+    /**
+     * @brief Number of batches queued or being encoded.
+     */
+    std::size_t pending() const;
+
+  private:
+    struct WorkItem
+    {
+        std::unique_ptr<cudf::table> table;
+        std::vector<std::string> column_names;
+        std::string directory;
+        std::size_t sequence;
+    };
+
+    void worker_loop();
+    std::string partition_directory();
+
+    std::string m_output_dir;
+    std::string m_file_prefix;
+    std::chrono::seconds m_window;
+
+    std::vector<std::thread> m_workers;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_work_ready;
+    std::condition_variable m_work_done;
+    std::deque<WorkItem> m_pending;
+    EdgeGauge& m_gauge;
+    std::size_t m_in_flight{0};
+    std::size_t m_next_sequence{0};
+    bool m_closed{false};
+    std::exception_ptr m_error;
+};
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
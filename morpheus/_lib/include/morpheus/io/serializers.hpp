@@ -21,14 +21,20 @@
 #include "morpheus/objects/table_info.hpp"
 #include "morpheus/utilities/string_util.hpp"
 
+#include <cudf/types.hpp>  // for size_type
 #include <pybind11/pytypes.h>
 
 #include <fstream>  // IWYU pragma: keep
+#include <memory>   // for shared_ptr
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <utility>
 
+namespace arrow {
+class Table;
+}  // namespace arrow
+
 namespace morpheus {
 #pragma GCC visibility push(default)
 /**
@@ -82,6 +88,27 @@ void df_to_json(const TableInfo& tbl, std::ostream& out_stream, bool include_ind
  */
 std::string df_to_json(const TableInfo& tbl, bool include_index_col = true);
 
+/**
+ * @brief Serialize a dataframe to an output stream as JSON lines in fixed-size row chunks. Each chunk of
+ * `rows_per_chunk` rows is serialized into `buffer` and written to `out_stream` before the next chunk starts, so
+ * peak host memory is bounded by the largest chunk instead of the whole table. `buffer` is cleared between chunks
+ * but never shrunk, a caller-owned buffer therefore stops allocating once it has grown to the steady-state chunk
+ * size.
+ *
+ * @param tbl : A wrapper around data in the dataframe
+ * @param out_stream : Output stream to write the results to a destination
+ * @param rows_per_chunk : Number of rows serialized per chunk
+ * @param buffer : Caller-provided scratch buffer reused across chunks (and across calls)
+ * @param include_index_col : Determines whether or not to include the dataframe index
+ * @param flush : When `true` flush `out_stream` after each chunk.
+ */
+void df_to_json_chunked(const TableInfo& tbl,
+                        std::ostream& out_stream,
+                        cudf::size_type rows_per_chunk,
+                        std::string& buffer,
+                        bool include_index_col = true,
+                        bool flush             = false);
+
 /**
  * @brief Serialize a dataframe to an output stream in Parquet format
  *
@@ -107,6 +134,54 @@ void df_to_parquet(const TableInfo& tbl,
  */
 std::string df_to_parquet(const TableInfo& tbl, bool include_header, bool include_index_col = true);
 
+/**
+ * @brief Serialize a dataframe straight to a file in Parquet format. On GPUDirect Storage capable nodes the encoded
+ * row groups are written device->disk through cuFile, skipping the device-to-host bounce entirely; everywhere else
+ * (and for filesystems cuFile refuses) the write degrades to staging through pinned host memory. Prefer this over
+ * the ostream overload for large archive writes.
+ *
+ * @param tbl : A wrapper around data in the dataframe
+ * @param filename : Name of the file the table is written to, truncated if it exists
+ * @param include_header : Determines whether or not to include the header
+ * @param include_index_col : Determines whether or not to include the dataframe index
+ * @param flush : When `true` push the written data to stable storage before returning.
+ */
+void df_to_parquet(const TableInfo& tbl,
+                   const std::string& filename,
+                   bool include_header,
+                   bool include_index_col = true,
+                   bool flush             = false);
+
+/**
+ * @brief Convert a dataframe to an Arrow table, moving the column data device-to-host in a single transfer
+ *
+ * @param tbl : A wrapper around data in the dataframe
+ * @param include_index_col : Determines whether or not to include the dataframe index
+ * @return std::shared_ptr<arrow::Table>
+ */
+std::shared_ptr<arrow::Table> df_to_arrow(const TableInfo& tbl, bool include_index_col = true);
+
+/**
+ * @brief Serialize a dataframe to an Arrow IPC (Feather V2) file. Unlike the text formats the writer opens the file
+ * itself rather than writing through an ostream, and a reader can memory-map the result and use it without parsing.
+ *
+ * @param tbl : A wrapper around data in the dataframe
+ * @param filename : Name of the file the table is written to
+ * @param include_index_col : Determines whether or not to include the dataframe index
+ */
+void df_to_arrow_ipc(const TableInfo& tbl, const std::string& filename, bool include_index_col = true);
+
+/**
+ * @brief Serialize a dataframe to an in-memory Arrow IPC stream and return the bytes. The schema is embedded
+ * ahead of the record batches, so the payload decodes on its own; suited for binary message sinks where a
+ * consumer should not pay for text parsing.
+ *
+ * @param tbl : A wrapper around data in the dataframe
+ * @param include_index_col : Determines whether or not to include the dataframe index
+ * @return std::string
+ */
+std::string df_to_arrow_ipc(const TableInfo& tbl, bool include_index_col = true);
+
 /**
  * @brief Loads a cudf table from a CSV, JSON or Parquet file returning the DataFrame as a Python object
  *
@@ -124,6 +199,12 @@ void write_df_to_file(const TableInfo& tbl,
         file_type = determine_file_type(filename);  // throws if it is unable to determine the type
     }
 
+    if (file_type == FileTypes::ARROW)
+    {
+        // The Arrow writer opens the file itself, an IPC file is not streamed through an ostream
+        return df_to_arrow_ipc(tbl, filename, std::forward<ArgsT>(args)...);
+    }
+
     std::ofstream out_file;
     out_file.open(filename);
 
@@ -158,6 +239,12 @@ void write_df_to_file(const MutableTableInfo& tbl,
         file_type = determine_file_type(filename);  // throws if it is unable to determine the type
     }
 
+    if (file_type == FileTypes::ARROW)
+    {
+        // The Arrow writer opens the file itself, an IPC file is not streamed through an ostream
+        return df_to_arrow_ipc(tbl, filename, std::forward<ArgsT>(args)...);
+    }
+
     std::ofstream out_file;
     out_file.open(filename);
 
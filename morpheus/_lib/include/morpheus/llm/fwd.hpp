@@ -27,8 +27,12 @@ namespace morpheus::llm {
 
 // IWYU pragma: begin_exports
 
+struct CompiledInputMap;
+
 class LLMContext;
 
+class LLMEmbeddingNode;
+
 class LLMEngine;
 
 class LLMNodeBase;
@@ -37,6 +41,8 @@ class LLMNodeRunner;
 
 class LLMNode;
 
+class LLMRetrieverNode;
+
 class LLMTaskHandlerRunner;
 
 class LLMTaskHandler;
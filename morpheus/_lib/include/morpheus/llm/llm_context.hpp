@@ -21,24 +21,45 @@
 #include "morpheus/llm/input_map.hpp"
 #include "morpheus/llm/llm_task.hpp"
 #include "morpheus/messages/control.hpp"
+#include "morpheus/types.hpp"
 #include "morpheus/utilities/json_types.hpp"
 
 #include <mrc/types.hpp>
 #include <nlohmann/json.hpp>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace morpheus::llm {
 
+// Callback invoked for each incremental output chunk produced while the engine is still running
+using stream_fn_t = std::function<Task<void>(nlohmann::json)>;
+
 struct LLMContextState
 {
     LLMTask task;
     std::shared_ptr<ControlMessage> message;
     nlohmann::json values;
+    stream_fn_t stream_handler;
+};
+
+/**
+ * @brief One pre-resolved input mapping: the sibling/parent classification and, for sibling inputs, the parsed json
+ * pointer. Compiled once when the node graph is wired so per-message lookups skip the string parsing.
+ */
+struct MORPHEUS_EXPORT CompiledInputMap
+{
+    std::string internal_name;
+    std::string external_name;
+    bool is_sibling{false};
+    nlohmann::json::json_pointer sibling_pointer;
 };
 
+// Compiled input mappings sorted by internal name, shared by every context pushed for the same node
+using compiled_input_plan_t = std::vector<CompiledInputMap>;
+
 /**
  * @brief Holds and manages information related to LLM tasks and input mappings required for LLMNode execution.
  * Outputs of node executions are also saved here for use by nodes and task handlers in LLMEngine.
@@ -132,6 +153,20 @@ class MORPHEUS_EXPORT LLMContext : public std::enable_shared_from_this<LLMContex
      */
     std::shared_ptr<LLMContext> push(std::string name, input_mappings_t inputs);
 
+    /**
+     * @brief Create new context from this context using a pre-compiled input plan in addition to the mappings. The
+     * plan lets get_input resolve names with a binary search and a pre-parsed json pointer instead of re-doing the
+     * string work per message.
+     *
+     * @param name name of new context
+     * @param inputs input mappings for new context
+     * @param input_plan compiled input plan matching `inputs`
+     * @return std::shared_ptr<LLMContext>
+     */
+    std::shared_ptr<LLMContext> push(std::string name,
+                                     input_mappings_t inputs,
+                                     std::shared_ptr<const compiled_input_plan_t> input_plan);
+
     /**
      * @brief Moves output map from this context to parent context. Outputs to move can be selected using
      * set_output_names, otherwise all outputs are noved by default.
@@ -154,6 +189,14 @@ class MORPHEUS_EXPORT LLMContext : public std::enable_shared_from_this<LLMContex
      */
     nlohmann::json::const_reference get_input(const std::string& node_name) const;
 
+    /**
+     * @brief Get the output value at a pre-parsed json pointer.
+     *
+     * @param pointer pointer into this context's outputs
+     * @return nlohmann::json::const_reference
+     */
+    nlohmann::json::const_reference output_at(const nlohmann::json::json_pointer& pointer) const;
+
     /**
      * @brief Get parent output values corresponding to all internal input names.
      *
@@ -183,6 +226,30 @@ class MORPHEUS_EXPORT LLMContext : public std::enable_shared_from_this<LLMContex
      */
     void set_output_names(std::vector<std::string> output_names);
 
+    /**
+     * @brief Set the handler invoked by stream_output. Stored on the root context so every node in the tree
+     * shares it.
+     *
+     * @param handler stream handler, pass nullptr to disable streaming
+     */
+    void set_stream_handler(stream_fn_t handler);
+
+    /**
+     * @brief Check whether a stream handler is attached. Nodes can skip building chunks when nothing listens.
+     *
+     * @return bool
+     */
+    bool is_streaming() const;
+
+    /**
+     * @brief Emit an incremental output chunk to the attached stream handler. A no-op when no handler is
+     * attached, so nodes can stream unconditionally.
+     *
+     * @param chunk incremental output value
+     * @return Task<void>
+     */
+    Task<void> stream_output(nlohmann::json chunk);
+
     void outputs_complete();
 
     nlohmann::json::const_reference view_outputs() const;
@@ -191,6 +258,7 @@ class MORPHEUS_EXPORT LLMContext : public std::enable_shared_from_this<LLMContex
     std::shared_ptr<LLMContext> m_parent{nullptr};
     std::string m_name;
     input_mappings_t m_inputs;
+    std::shared_ptr<const compiled_input_plan_t> m_input_plan;
     std::vector<std::string> m_output_names;  // Names of keys to be used as the output. Empty means use all keys
 
     std::shared_ptr<LLMContextState> m_state;
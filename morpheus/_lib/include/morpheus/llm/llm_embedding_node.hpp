@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/llm/fwd.hpp"
+#include "morpheus/llm/llm_node_base.hpp"
+#include "morpheus/types.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace morpheus::llm {
+
+/**
+ * @brief `LLMNodeBase` which post-processes raw token embeddings into sequence embeddings on device. The input
+ * tensor on the message's `TensorMemory` holds `pool_size` token vectors per sequence; a fused
+ * `MatxUtil::mean_pool_normalize` kernel mean-pools each group and L2-normalizes the result, replacing the
+ * message's token-level tensor memory with sequence-level memory holding the pooled embeddings. The data never
+ * leaves the GPU, removing the CuPy pooling/normalization round trips and the device-to-host copy the Python
+ * implementation paid per batch.
+ */
+class MORPHEUS_EXPORT LLMEmbeddingNode : public LLMNodeBase
+{
+  public:
+    /**
+     * @brief Construct a new LLMEmbeddingNode object.
+     *
+     * @param input_tensor_name name of the token-embedding tensor on the message's tensor memory, shaped
+     * `[sequences * pool_size, dim]`
+     * @param output_tensor_name name the pooled `[sequences, dim]` tensor is stored under
+     * @param pool_size number of token vectors pooled into each sequence embedding
+     */
+    LLMEmbeddingNode(std::string input_tensor_name, std::string output_tensor_name, TensorIndex pool_size);
+
+    std::vector<std::string> get_input_names() const override;
+
+    /**
+     * @brief Pools and normalizes the message's token embeddings, then sets the "tensor_name" and "shape"
+     * outputs describing where the device-resident result lives.
+     *
+     * @param context context for node's execution
+     * @return Task<std::shared_ptr<LLMContext>>
+     */
+    Task<std::shared_ptr<LLMContext>> execute(std::shared_ptr<LLMContext> context) override;
+
+  private:
+    std::string m_input_tensor_name;
+    std::string m_output_tensor_name;
+    TensorIndex m_pool_size;
+};
+
+}  // namespace morpheus::llm
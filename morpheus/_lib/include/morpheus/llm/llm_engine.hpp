@@ -26,6 +26,9 @@
 #include "morpheus/messages/control.hpp"
 #include "morpheus/types.hpp"
 
+#include <nlohmann/json.hpp>
+
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -41,6 +44,9 @@ namespace morpheus::llm {
 class MORPHEUS_EXPORT LLMEngine : public LLMNode
 {
   public:
+    // Callback invoked for each partial ControlMessage emitted by a streaming task handler
+    using partial_emit_fn_t = std::function<Task<void>(std::shared_ptr<ControlMessage>)>;
+
     /**
      * @brief Construct a new LLMEngine object.
      *
@@ -61,6 +67,14 @@ class MORPHEUS_EXPORT LLMEngine : public LLMNode
      */
     virtual void add_task_handler(user_input_mappings_t inputs, std::shared_ptr<LLMTaskHandler> task_handler);
 
+    /**
+     * @brief Limit how many task handlers are awaited concurrently while handling an engine invocation's
+     * outputs. The default of 0 awaits all handlers in a single wave.
+     *
+     * @param max_concurrent maximum number of handlers in flight at once, 0 for unlimited
+     */
+    void set_max_concurrent_handlers(std::size_t max_concurrent);
+
     /**
      * @brief Execute nodes in this engine and pass outputs to its task handlers. Must pass this a control message with
      * a 'llm_engine' task` containing 'task_type' and 'task_dict' properties required for execution of task(s).
@@ -70,10 +84,38 @@ class MORPHEUS_EXPORT LLMEngine : public LLMNode
      */
     virtual Task<std::vector<std::shared_ptr<ControlMessage>>> run(std::shared_ptr<ControlMessage> input_message);
 
+    /**
+     * @brief Same as run, but with streaming enabled. Chunks streamed by nodes through
+     * LLMContext::stream_output are offered to the task handlers via try_handle_chunk, and any partial
+     * ControlMessages they build are passed to on_partial while the engine is still executing. The final results
+     * are still returned when the run completes.
+     *
+     * @param input_message input control message
+     * @param on_partial callback receiving partial messages as they are produced
+     * @return Task<std::vector<std::shared_ptr<ControlMessage>>>
+     */
+    virtual Task<std::vector<std::shared_ptr<ControlMessage>>> run(std::shared_ptr<ControlMessage> input_message,
+                                                                   partial_emit_fn_t on_partial);
+
+    /**
+     * @brief Execute the engine once for a window of queued control messages. Messages carrying an identical
+     * 'llm_engine' task are merged into a single invocation by concatenating their payloads (the per-row structure
+     * in LLMContext already handles multi-row inputs), and row-aligned task handler outputs are sliced back out per
+     * source message. Messages whose tasks differ, or whose outputs no longer align row-for-row with the merged
+     * payload, fall back to the single-message path.
+     *
+     * @param input_messages window of input control messages
+     * @return Task<std::vector<std::shared_ptr<ControlMessage>>>
+     */
+    virtual Task<std::vector<std::shared_ptr<ControlMessage>>> run_batch(
+        std::vector<std::shared_ptr<ControlMessage>> input_messages);
+
   private:
     Task<std::vector<std::shared_ptr<ControlMessage>>> handle_tasks(std::shared_ptr<LLMContext> context);
+    Task<void> handle_chunk(std::shared_ptr<LLMContext> context, nlohmann::json chunk, partial_emit_fn_t on_partial);
 
     std::vector<std::shared_ptr<LLMTaskHandlerRunner>> m_task_handlers;
+    std::size_t m_max_concurrent_handlers{0};
 };
 
 }  // namespace morpheus::llm
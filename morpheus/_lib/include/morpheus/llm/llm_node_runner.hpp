@@ -23,6 +23,11 @@
 #include "morpheus/llm/llm_node_base.hpp"
 #include "morpheus/types.hpp"
 
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -87,13 +92,42 @@ class MORPHEUS_EXPORT LLMNodeRunner
      */
     const std::vector<std::string>& parent_input_names() const;
 
+    /**
+     * @brief Enable caching of this node's outputs keyed by its resolved inputs. When a later execution resolves
+     * an identical input set within the TTL, the cached outputs are applied to the context and the wrapped node is
+     * not executed. Only useful for nodes whose outputs depend solely on their inputs, such as LLM service
+     * clients replaying near-identical prompts.
+     *
+     * @param ttl lifetime of a cached result
+     * @param max_entries maximum number of cached results, the entry closest to expiry is evicted when full
+     */
+    void enable_cache(std::chrono::seconds ttl, std::size_t max_entries = 1024);
+
   private:
+    struct CacheEntry
+    {
+        nlohmann::json outputs;
+        std::chrono::steady_clock::time_point expires_at;
+    };
+
+    nlohmann::json resolve_input_key(const std::shared_ptr<LLMContext>& context) const;
+    void cache_store(std::string key, nlohmann::json outputs);
     std::string m_name;
     input_mappings_t m_inputs;
     std::shared_ptr<LLMNodeBase> m_node;
 
     std::vector<std::string> m_sibling_input_names;
     std::vector<std::string> m_parent_input_names;
+
+    // Input mappings compiled once at construction, shared with every context pushed for this node
+    std::shared_ptr<const std::vector<CompiledInputMap>> m_input_plan;
+
+    // Result cache keyed by the serialized resolved inputs, empty unless enable_cache was called. Coroutines for
+    // one engine share a scheduler thread, so map accesses between suspension points need no locking
+    bool m_cache_enabled{false};
+    std::chrono::seconds m_cache_ttl{0};
+    std::size_t m_cache_max_entries{0};
+    std::map<std::string, CacheEntry> m_result_cache;
 };
 
 }  // namespace morpheus::llm
@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+#include "morpheus/llm/fwd.hpp"
+#include "morpheus/llm/llm_node_base.hpp"
+#include "morpheus/types.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rmm {
+class device_buffer;
+}  // namespace rmm
+
+namespace morpheus::llm {
+
+/**
+ * @brief `LLMNodeBase` which performs nearest-neighbor retrieval against a device-resident embedding index, entirely
+ * in-process. The corpus embeddings are uploaded to the GPU once at construction; each `execute` scores the query
+ * embeddings against the whole index with a brute-force inner-product kernel and returns the top-k document payloads
+ * through the `LLMContext`, avoiding the network round trip and GIL bounce of calling out to a vector database from a
+ * Python node.
+ */
+class MORPHEUS_EXPORT LLMRetrieverNode : public LLMNodeBase
+{
+  public:
+    /**
+     * @brief Construct a new LLMRetrieverNode object.
+     *
+     * @param embeddings row-major corpus embeddings, `documents.size() * dim` floats. Normalize the rows up front to
+     * retrieve by cosine similarity instead of raw inner product
+     * @param documents one payload per corpus row, returned verbatim for matched rows
+     * @param dim embedding dimension
+     * @param k number of neighbors to return per query, clamped to the corpus size
+     */
+    LLMRetrieverNode(const std::vector<float>& embeddings,
+                     std::vector<nlohmann::json> documents,
+                     TensorIndex dim,
+                     TensorIndex k);
+    ~LLMRetrieverNode() override;
+
+    std::vector<std::string> get_input_names() const override;
+
+    /**
+     * @brief Scores the "query" input (a single embedding, or a list of embeddings) against the index and sets the
+     * "documents" and "scores" outputs, one list of `k` entries per query, best match first.
+     *
+     * @param context context for node's execution
+     * @return Task<std::shared_ptr<LLMContext>>
+     */
+    Task<std::shared_ptr<LLMContext>> execute(std::shared_ptr<LLMContext> context) override;
+
+  private:
+    std::vector<nlohmann::json> m_documents;
+    TensorIndex m_dim;
+    TensorIndex m_k;
+
+    // Device-resident row-major index, uploaded once at construction
+    std::unique_ptr<rmm::device_buffer> m_index;
+};
+
+}  // namespace morpheus::llm
@@ -21,6 +21,8 @@
 #include "morpheus/llm/fwd.hpp"
 #include "morpheus/types.hpp"
 
+#include <nlohmann/json.hpp>
+
 #include <memory>
 #include <optional>
 #include <string>
@@ -54,6 +56,17 @@ class MORPHEUS_EXPORT LLMTaskHandler
      * @return Task<return_t>
      */
     virtual Task<return_t> try_handle(std::shared_ptr<LLMContext> context) = 0;
+
+    /**
+     * @brief Virtual method for handling an incremental output chunk streamed by a node while the engine is still
+     * running. Handlers that support streaming return partial ControlMessages built from the chunk, which the
+     * engine emits downstream ahead of the final results. The default implementation declines every chunk.
+     *
+     * @param context context for the chunk, outputs of completed nodes are available
+     * @param chunk incremental output value streamed by a node
+     * @return Task<return_t>
+     */
+    virtual Task<return_t> try_handle_chunk(std::shared_ptr<LLMContext> context, const nlohmann::json& chunk);
 };
 
 }  // namespace morpheus::llm
@@ -23,6 +23,8 @@
 #include "morpheus/llm/llm_task_handler.hpp"
 #include "morpheus/types.hpp"
 
+#include <nlohmann/json.hpp>
+
 #include <memory>
 
 namespace morpheus::llm {
@@ -55,6 +57,17 @@ class MORPHEUS_EXPORT LLMTaskHandlerRunner
      */
     virtual Task<LLMTaskHandler::return_t> try_handle(std::shared_ptr<LLMContext> context);
 
+    /**
+     * @brief Forward an incremental output chunk to the wrapped handler with this runner's input mappings
+     * applied.
+     *
+     * @param context context holding outputs of completed nodes
+     * @param chunk incremental output value streamed by a node
+     * @return Task<LLMTaskHandler::return_t>
+     */
+    virtual Task<LLMTaskHandler::return_t> try_handle_chunk(std::shared_ptr<LLMContext> context,
+                                                            const nlohmann::json& chunk);
+
     /**
      * @brief Get input names for task handler.
      *
@@ -18,11 +18,15 @@
 #pragma once
 
 #include "morpheus/messages/meta.hpp"
+#include "morpheus/types.hpp"  // for TensorIndex
 
 #include <nlohmann/json.hpp>
 #include <pybind11/pytypes.h>
 
+#include <array>    // for array
 #include <chrono>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t
 #include <map>
 #include <memory>
 #include <optional>
@@ -179,7 +183,7 @@ class ControlMessage
     ControlMessage();
     explicit ControlMessage(const nlohmann::json& config);
 
-    ControlMessage(const ControlMessage& other);  // Copies config and metadata, but not payload
+    ControlMessage(const ControlMessage& other);  // Shares config and metadata copy-on-write, but not payload
 
     /**
      * @brief Set the configuration object for the control message.
@@ -193,8 +197,30 @@ class ControlMessage
      */
     [[nodiscard]] const nlohmann::json& config() const;
 
+    /**
+     * @brief Get the config and tasks encoded as a flat CBOR buffer. The encoding is cached on the state shared
+     * between copies of this message and reused until one of them mutates, so handing the same message to many
+     * consumers encodes it once.
+     *
+     * @return A const reference to the CBOR encoded config and tasks.
+     */
+    [[nodiscard]] const std::vector<std::uint8_t>& config_cbor() const;
+
+    /**
+     * @brief Create a new ControlMessage from a CBOR buffer produced by `config_cbor`.
+     * @param cbor The CBOR encoded config and tasks.
+     * @return A shared_ptr to the decoded ControlMessage instance.
+     */
+    static std::shared_ptr<ControlMessage> from_cbor(const std::vector<std::uint8_t>& cbor);
+
     /**
      * @brief Add a task of the given type to the control message.
+     *
+     * Tasks are kept ordered by priority: a task may carry a "priority" property, either an integer (lower values
+     * dequeue first) or one of the class names "realtime", "high", "normal" or "bulk". Tasks without a priority
+     * are treated as "normal", and ties dequeue FIFO, so `remove_task` hands latency-sensitive tasks to consumers
+     * such as `DataLoader` ahead of any queued bulk work.
+     *
      * @param task_type A string indicating the type of the task.
      * @param task A json object describing the task.
      */
@@ -214,6 +240,17 @@ class ControlMessage
      */
     nlohmann::json remove_task(const std::string& task_type);
 
+    /**
+     * @brief Remove and return every task of the given type in one operation, in dequeue (priority) order.
+     *
+     * The whole task array is moved out of the shared task storage rather than copied task by task, so draining
+     * a message carrying hundreds of tasks costs one move instead of one JSON copy per `remove_task` call.
+     *
+     * @param task_type A string indicating the type of the tasks.
+     * @return A json array of task objects; empty when no tasks of the given type exist.
+     */
+    nlohmann::json remove_tasks(const std::string& task_type);
+
     /**
      * @brief Get the tasks for the control message.
      */
@@ -282,13 +319,40 @@ class ControlMessage
      * @brief Assigns a new payload object to the control message.
      *
      * Sets the payload of the control message to the provided MessageMeta instance.
-     * The payload contains data or metadata pertinent to the message. Using a shared
-     * pointer ensures that the payload is managed efficiently with automatic reference
-     * counting.
+     * The payload contains data or metadata pertinent to the message. Taken by value so
+     * callers handing over a freshly loaded payload move it straight into the message
+     * without touching the reference count.
      *
      * @param payload A shared pointer to the MessageMeta instance to be set as the new payload.
      */
-    void payload(const std::shared_ptr<MessageMeta>& payload);
+    void payload(std::shared_ptr<MessageMeta> payload);
+
+    /**
+     * @brief Get a zero-copy view of a row range, and optionally a column subset, of the payload.
+     *
+     * The returned SlicedMessageMeta shares the underlying table with the full payload, so several task handlers
+     * can each operate on their own range of one shared frame without materializing copies.
+     *
+     * @param start The first row of the view.
+     * @param stop One past the last row of the view, -1 for the end of the payload.
+     * @param columns Columns to expose, empty for all columns.
+     * @return A shared pointer to the sliced view of the message payload.
+     */
+    std::shared_ptr<MessageMeta> payload_slice(TensorIndex start,
+                                               TensorIndex stop                 = -1,
+                                               std::vector<std::string> columns = {});
+
+    /**
+     * @brief Get the payload view a task should operate on.
+     *
+     * Tasks may scope themselves to part of the shared payload with a "payload_range" property holding a
+     * `[start, stop)` row pair, and optionally a "payload_columns" list of column names. Tasks carrying neither
+     * get the full payload. The view is zero-copy, see `payload_slice`.
+     *
+     * @param task A json object describing the task.
+     * @return A shared pointer to the payload view for the task.
+     */
+    std::shared_ptr<MessageMeta> task_payload(const nlohmann::json& task);
 
     /**
      * @brief Retrieves the tensor memory associated with the control message.
@@ -339,6 +403,16 @@ class ControlMessage
      */
     void set_timestamp(const std::string& key, time_point_t timestamp_ns);
 
+    /**
+     * @brief Stamps the current time for a specific key.
+     *
+     * Equivalent to `set_timestamp(key, std::chrono::system_clock::now())`, for stages that only want to record
+     * when the message passed through them.
+     *
+     * @param key The specific key for which the timestamp is to be set.
+     */
+    void set_timestamp(const std::string& key);
+
     /**
      * @brief Retrieves the timestamp for a specific key.
      *
@@ -365,6 +439,21 @@ class ControlMessage
     std::map<std::string, time_point_t> filter_timestamp(const std::string& regex_filter);
 
   private:
+    // Config, tasks and metadata live in a state block shared between copies, so `ControlMessage::copy` is a
+    // reference bump instead of a deep copy of the json trees. Mutators go through `mutable_state()` which clones the
+    // block only while it is still shared (copy-on-write). The block also caches the CBOR encoding of the config for
+    // boundary crossings, invalidated on any write.
+    struct State
+    {
+        nlohmann::json config{};
+        nlohmann::json tasks{};
+
+        // Lazily populated by `config_cbor()`, cleared on mutation
+        std::vector<std::uint8_t> cbor_cache{};
+    };
+
+    State& mutable_state();
+
     static const std::string s_config_schema;                          // NOLINT
     static std::map<std::string, ControlMessageType> s_task_type_map;  // NOLINT
 
@@ -372,10 +461,21 @@ class ControlMessage
     std::shared_ptr<MessageMeta> m_payload{nullptr};
     std::shared_ptr<TensorMemory> m_tensors{nullptr};
 
-    nlohmann::json m_tasks{};
-    nlohmann::json m_config{};
+    std::shared_ptr<State> m_state;
+
+    // Timestamps live in a fixed-capacity inline array rather than a map (or the JSON metadata) so stamping a
+    // transit time costs a linear scan and a store, with no node allocation. The capacity bounds how many
+    // distinct keys one message can carry; stamps beyond it are dropped with a warning.
+    static constexpr std::size_t TimestampCapacity = 32;
+
+    struct TimestampEntry
+    {
+        std::string key;
+        time_point_t value;
+    };
 
-    std::map<std::string, time_point_t> m_timestamps{};
+    std::array<TimestampEntry, TimestampCapacity> m_timestamps{};
+    std::size_t m_timestamp_count{0};
 };
 
 struct ControlMessageProxy
@@ -431,6 +531,14 @@ struct ControlMessageProxy
      */
     static pybind11::dict remove_task(ControlMessage& self, const std::string& type);
 
+    /**
+     * @brief Removes and returns every task of the given type from the ControlMessage.
+     * @param self Reference to the underlying ControlMessage object.
+     * @param type The type of the tasks to be removed.
+     * @return A pybind11::list of the removed tasks, in dequeue order.
+     */
+    static pybind11::list remove_tasks(ControlMessage& self, const std::string& type);
+
     /**
      * @brief Retrieves all tasks from the ControlMessage.
      * @param self Reference to the underlying ControlMessage object.
@@ -472,6 +580,15 @@ struct ControlMessageProxy
      */
     static void payload_from_python_meta(ControlMessage& self, const pybind11::object& meta);
 
+    /**
+     * @brief Get the zero-copy payload view for a task, honoring its optional "payload_range" and
+     * "payload_columns" properties.
+     * @param self Reference to the underlying ControlMessage object.
+     * @param task A pybind11::dict representing the task.
+     * @return A shared_ptr to the MessageMeta view the task should operate on.
+     */
+    static std::shared_ptr<MessageMeta> task_payload(ControlMessage& self, pybind11::dict& task);
+
     /**
      * @brief Sets a timestamp for a given key.
      * @param self Reference to the underlying ControlMessage object.
@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/control.hpp"
+#include "morpheus/messages/multi.hpp"
+
+#include <memory>
+
+namespace morpheus {
+#pragma GCC visibility push(default)
+
+/****** Message envelope conversion ***********************/
+
+/**
+ * @addtogroup messages
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Re-wrap a MultiMessage as a ControlMessage without touching the data.
+ *
+ * The payload is the same MessageMeta, narrowed to the message's `mess_offset`/`mess_count` range with a
+ * zero-copy SlicedMessageMeta view when the range does not cover the whole table. MultiTensorMessage inputs carry
+ * their TensorMemory across, narrowed to `offset`/`count` with zero-copy tensor views when partial. The envelope
+ * swap is pure bookkeeping, no table or tensor data is copied.
+ *
+ * @param multi The MultiMessage to convert.
+ * @return std::shared_ptr<ControlMessage>
+ */
+std::shared_ptr<ControlMessage> to_control_message(const std::shared_ptr<MultiMessage>& multi);
+
+/**
+ * @brief Re-wrap a ControlMessage payload as a MultiMessage without touching the data.
+ *
+ * The returned message shares the payload MessageMeta and covers all of its rows. When the control message
+ * carries tensor memory, a MultiTensorMessage sharing that memory is returned instead.
+ *
+ * @param control The ControlMessage to convert.
+ * @return std::shared_ptr<MultiMessage>
+ * @throws std::runtime_error If the control message has no payload.
+ */
+std::shared_ptr<MultiMessage> to_multi_message(const std::shared_ptr<ControlMessage>& control);
+
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
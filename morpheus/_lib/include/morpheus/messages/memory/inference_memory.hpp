@@ -24,6 +24,7 @@
 
 #include <memory>  // for shared_ptr
 #include <string>
+#include <string_view>
 
 namespace morpheus {
 /**
@@ -62,7 +63,7 @@ class InferenceMemory : public TensorMemory
      * @return true
      * @return false
      */
-    bool has_input(const std::string& name) const;
+    bool has_input(std::string_view name) const;
 };
 
 /****** InferenceMemoryInterfaceProxy *************************/
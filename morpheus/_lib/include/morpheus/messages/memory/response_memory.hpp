@@ -24,6 +24,7 @@
 
 #include <memory>  // for shared_ptr
 #include <string>
+#include <string_view>
 
 namespace morpheus {
 /****** Component public implementations *******************/
@@ -62,7 +63,7 @@ class ResponseMemory : public TensorMemory
      * @return true
      * @return false
      */
-    bool has_output(const std::string& name) const;
+    bool has_output(std::string_view name) const;
 };
 
 /****** ResponseMemoryInterfaceProxy *************************/
@@ -23,8 +23,10 @@
 
 #include <pybind11/pytypes.h>  // for object
 
+#include <atomic>  // for atomic
 #include <memory>  // for shared_ptr
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace morpheus {
@@ -71,7 +73,7 @@ class TensorMemory
      * @return true
      * @return false
      */
-    bool has_tensor(const std::string& name) const;
+    bool has_tensor(std::string_view name) const;
 
     /**
      * @brief Get the tensor object identified by `name`
@@ -80,7 +82,7 @@ class TensorMemory
      * @return TensorObject&
      * @throws std::runtime_error If no tensor matching `name` exists
      */
-    TensorObject& get_tensor(const std::string& name);
+    TensorObject& get_tensor(std::string_view name);
 
     /**
      * @brief Get the tensor object identified by `name`
@@ -89,7 +91,7 @@ class TensorMemory
      * @return const TensorObject&
      * @throws std::runtime_error If no tensor matching `name` exists
      */
-    const TensorObject& get_tensor(const std::string& name) const;
+    const TensorObject& get_tensor(std::string_view name) const;
 
     /**
      * @brief Set the tensor object identified by `name`
@@ -100,6 +102,24 @@ class TensorMemory
      */
     void set_tensor(const std::string& name, TensorObject&& tensor);
 
+    /**
+     * @brief Get the tensor identified by `name` for explicit in-place mutation. Writes through the returned object
+     * modify the shared buffer seen by every message referencing this memory. Each checkout must be matched by a
+     * `return_tensor` call; debug builds flag overlapping writers.
+     *
+     * @param name
+     * @return TensorObject
+     * @throws std::runtime_error If no tensor matching `name` exists
+     */
+    TensorObject checkout_tensor(std::string_view name);
+
+    /**
+     * @brief Returns a tensor previously obtained from `checkout_tensor`, releasing the writer claim on this memory.
+     *
+     * @param tensor
+     */
+    void return_tensor(TensorObject&& tensor);
+
     /**
      * @brief Get a reference to the internal tensors map
      *
@@ -124,6 +144,16 @@ class TensorMemory
      */
     TensorMap copy_tensor_ranges(const std::vector<RangeType>& ranges, TensorIndex num_selected_rows) const;
 
+    /**
+     * @brief Returns this memory resident on `device_id`, relocating each tensor with
+     * `TensorUtils::copy_to_device`. Tensors already on the target device are shared, not copied, so handing a
+     * message to a stage on the device it was produced on stays free.
+     *
+     * @param device_id : Device the tensors must live on
+     * @return std::shared_ptr<TensorMemory>
+     */
+    std::shared_ptr<TensorMemory> copy_to_device(int device_id) const;
+
   protected:
     /**
      * @brief Checks if the number of rows in `tensor` matches `count`
@@ -147,10 +177,13 @@ class TensorMemory
      * @param name
      * @throws std::runtime_error If no tensor matching `name` exists
      */
-    void verify_tensor_exists(const std::string& name) const;
+    void verify_tensor_exists(std::string_view name) const;
 
   private:
     TensorMap m_tensors;
+
+    // Number of outstanding `checkout_tensor` writers, only consulted by debug builds
+    std::atomic<int> m_writer_count{0};
 };
 
 /****** TensorMemoryInterfaceProxy *************************/
@@ -235,6 +268,15 @@ struct TensorMemoryInterfaceProxy
      * @param cupy_tensor
      */
     static void set_tensor(TensorMemory& self, const std::string name, const pybind11::object& cupy_tensor);
+
+    /**
+     * @brief Returns this memory resident on `device_id`, see `TensorMemory::copy_to_device`.
+     *
+     * @param self
+     * @param device_id
+     * @return std::shared_ptr<TensorMemory>
+     */
+    static std::shared_ptr<TensorMemory> copy_to_device(TensorMemory& self, int device_id);
 };
 
 #pragma GCC visibility pop
@@ -23,12 +23,19 @@
 
 #include <cudf/io/types.hpp>
 #include <pybind11/pytypes.h>
+#include <rmm/device_buffer.hpp>  // for device_buffer
 
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t
 #include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
+namespace arrow {
+class Table;
+}  // namespace arrow
+
 namespace morpheus {
 #pragma GCC visibility push(default)
 /****** Component public implementations ******************/
@@ -42,6 +49,20 @@ namespace morpheus {
 
 class MutableTableCtxMgr;
 
+/**
+ * @brief Transport form of a `MessageMeta` produced by `MessageMeta::pack`: every column buffer laid out in one
+ * contiguous device allocation, plus the small host-side blobs a peer needs to reconstruct the table. Only
+ * `metadata` and `column_names` are ever serialized — `gpu_data` is intended to move as-is over a device-aware
+ * transport (UCX/RDMA/NVLink).
+ */
+struct PackedMessageMeta
+{
+    std::unique_ptr<std::vector<uint8_t>> metadata;  // Host: cudf packed-column descriptors
+    std::unique_ptr<rmm::device_buffer> gpu_data;    // Device: all column buffers, contiguous
+    int index_col_count{0};
+    std::vector<std::string> column_names;  // Index column names first, then data columns
+};
+
 /**
  * @brief Container for class holding a data table, in practice a cudf DataFrame, with the ability to return both
  * Python and C++ representations of the table
@@ -64,6 +85,14 @@ class MessageMeta
      */
     virtual TableInfo get_info() const;
 
+    /**
+     * @brief Get the info object narrowed to `column_names`, constructing views for only those columns
+     *
+     * @param column_names Columns to include
+     * @return TableInfo
+     */
+    virtual TableInfo get_info(const std::vector<std::string>& column_names) const;
+
     /**
      * TODO(Documentation)
      */
@@ -88,6 +117,49 @@ class MessageMeta
      */
     virtual std::optional<std::string> ensure_sliceable_index();
 
+    /**
+     * @brief Dictionary-encodes the given string columns on device, replacing each with a categorical column backed
+     * by a deduplicated keyset. High-repetition columns (hostnames, event ids, user agents) shrink by roughly their
+     * repetition factor, and every downstream slice, copy and serialization of the column shrinks with them.
+     * Columns that are already categorical are left untouched.
+     *
+     * @param columns The names of the columns to encode
+     */
+    void dictionary_encode(const std::vector<std::string>& columns);
+
+    /**
+     * @brief Reverses `dictionary_encode`, materializing the given columns (or every categorical column when empty)
+     * back into their original dtype for consumers that need the raw values.
+     *
+     * @param columns The names of the columns to decode, empty for all categorical columns
+     */
+    void dictionary_decode(const std::vector<std::string>& columns = {});
+
+    /**
+     * @brief Packs the table for transport to another pipeline worker: one `cudf::pack` pass lays every column
+     * buffer into a single contiguous device allocation, leaving only the packed-column descriptors and column
+     * names to serialize. The counterpart worker rebuilds the table with `create_from_packed`.
+     *
+     * @return PackedMessageMeta
+     */
+    PackedMessageMeta pack() const;
+
+    /**
+     * @brief Create MessageMeta cpp object from a table packed by `pack` on a peer worker. The buffers are only
+     * read for the duration of this call: the columns are copied out of `gpu_data` (one device-to-device pass)
+     * into a table which owns its memory.
+     *
+     * @param metadata : Pointer to the packed-column descriptors
+     * @param gpu_data : Pointer to the contiguous device buffer holding the column data
+     * @param index_col_count : Number of leading columns holding the index
+     * @param column_names : Index column names first, then data columns
+     * @return std::shared_ptr<MessageMeta>
+     */
+    static std::shared_ptr<MessageMeta> create_from_packed(const uint8_t* metadata,
+                                                           const uint8_t* gpu_data,
+                                                           int index_col_count,
+                                                           const std::vector<std::string>& column_names);
+
     /**
      * @brief Create MessageMeta cpp object from a python object
      *
@@ -106,6 +178,27 @@ class MessageMeta
     static std::shared_ptr<MessageMeta> create_from_cpp(cudf::io::table_with_metadata&& data_table,
                                                         int index_col_count = 0);
 
+    /**
+     * @brief Create MessageMeta cpp object from an Arrow IPC stream buffer. The buffer is parsed in place, without
+     * copying, and loaded into the underlying table with a single host-to-device transfer. The buffer only needs to
+     * stay alive for the duration of this call.
+     *
+     * @param data : Pointer to the start of the Arrow IPC stream
+     * @param size_bytes : Size of the stream in bytes
+     * @return std::shared_ptr<MessageMeta>
+     */
+    static std::shared_ptr<MessageMeta> create_from_arrow_ipc(const uint8_t* data, std::size_t size_bytes);
+
+    /**
+     * @brief Create MessageMeta cpp object backed by a host-resident Arrow table. The table stays on the host until
+     * a stage checks out a `TableInfo` view (or the Python DataFrame), so pipelines which only route and forward
+     * messages never touch the device.
+     *
+     * @param data_table : Host table, all columns are treated as data columns
+     * @return std::shared_ptr<MessageMeta>
+     */
+    static std::shared_ptr<MessageMeta> create_from_arrow(std::shared_ptr<arrow::Table> data_table);
+
   protected:
     MessageMeta(std::shared_ptr<IDataTable> data);
 
@@ -138,6 +231,8 @@ class SlicedMessageMeta : public MessageMeta
 
     TableInfo get_info() const override;
 
+    TableInfo get_info(const std::vector<std::string>& column_names) const override;
+
     MutableTableInfo get_mutable_info() const override;
 
     std::optional<std::string> ensure_sliceable_index() override;
@@ -163,6 +258,15 @@ struct MessageMetaInterfaceProxy
      */
     static std::shared_ptr<MessageMeta> init_cpp(const std::string& filename);
 
+    /**
+     * @brief Initialize MessageMeta cpp object from an Arrow IPC stream, skipping the Arrow -> pandas -> cudf
+     * conversion chain
+     *
+     * @param data : Bytes object holding the Arrow IPC stream
+     * @return std::shared_ptr<MessageMeta>
+     */
+    static std::shared_ptr<MessageMeta> init_from_arrow_ipc(pybind11::bytes data);
+
     /**
      * @brief Initialize MessageMeta cpp object with a given dataframe and returns shared pointer as the result
      *
@@ -217,6 +321,31 @@ struct MessageMetaInterfaceProxy
      * @return std::string The name of the column with the old index or nullopt if no changes were made.
      */
     static std::optional<std::string> ensure_sliceable_index(MessageMeta& self);
+
+    /**
+     * @brief Dictionary-encodes the given string columns on device, see `MessageMeta::dictionary_encode`.
+     */
+    static void dictionary_encode(MessageMeta& self, const std::vector<std::string>& columns);
+
+    /**
+     * @brief Materializes categorical columns back into their original dtype, see `MessageMeta::dictionary_decode`.
+     */
+    static void dictionary_decode(MessageMeta& self, const std::vector<std::string>& columns);
+
+    /**
+     * @brief Packs the table for transport, returning a `(metadata, gpu_data, index_col_count, column_names)`
+     * tuple. `metadata` and `column_names` are host-side and picklable; `gpu_data` is a 1-D uint8 CuPy array
+     * suitable for a device-aware transport such as ucx-py. See `MessageMeta::pack`.
+     */
+    static pybind11::tuple pack(MessageMeta& self);
+
+    /**
+     * @brief Rebuilds a MessageMeta from the tuple members produced by `pack` on a peer worker.
+     */
+    static std::shared_ptr<MessageMeta> unpack(pybind11::bytes metadata,
+                                               pybind11::object gpu_data,
+                                               int index_col_count,
+                                               const std::vector<std::string>& column_names);
 };
 
 #pragma GCC visibility pop
@@ -284,6 +284,18 @@ class MultiMessage : public DerivedMultiMessage<MultiMessage>
      */
     TableInfo get_meta(const std::vector<std::string>& column_names);
 
+    /**
+     * @brief Returns a column value from a meta object using a cached `ColumnHandle`, skipping the column name
+     * resolution unless the schema has changed since the handle was resolved. A default constructed handle holding
+     * only the column name is resolved on first use, making this a drop-in replacement for the name overload in hot
+     * loops.
+     *
+     * @param handle : Column handle, updated in place when re-resolution is needed
+     * @throws pybind11::key_error
+     * @return TableInfo
+     */
+    TableInfo get_meta(ColumnHandle& handle);
+
     /**
      * @brief Set the meta object with a given column name
      *
@@ -292,6 +304,14 @@ class MultiMessage : public DerivedMultiMessage<MultiMessage>
      */
     void set_meta(const std::string& col_name, TensorObject tensor);
 
+    /**
+     * @brief Set a meta column from a tensor using a cached `ColumnHandle`, see `get_meta(ColumnHandle&)`.
+     *
+     * @param handle : Column handle, updated in place when re-resolution is needed
+     * @param tensor
+     */
+    void set_meta(ColumnHandle& handle, TensorObject tensor);
+
     /**
      * @brief Set the meta object with a given column names
      *
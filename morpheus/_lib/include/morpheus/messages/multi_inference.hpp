@@ -26,6 +26,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace morpheus {
 /****** Component public implementations********************/
@@ -77,7 +78,7 @@ class MultiInferenceMessage : public DerivedMultiMessage<MultiInferenceMessage,
      * @return const TensorObject
      * @throws std::runtime_error If no tensor matching `name` exists
      */
-    const TensorObject get_input(const std::string& name) const;
+    const TensorObject get_input(std::string_view name) const;
 
     /**
      * @brief Returns the input tensor for the given `name`.
@@ -86,12 +87,12 @@ class MultiInferenceMessage : public DerivedMultiMessage<MultiInferenceMessage,
      * @return TensorObject
      * @throws std::runtime_error If no tensor matching `name` exists
      */
-    TensorObject get_input(const std::string& name);
+    TensorObject get_input(std::string_view name);
 
     /**
      * Update the value of ain input tensor. The tensor must already exist, otherwise this will halt on a fatal error.
      */
-    void set_input(const std::string& name, const TensorObject& value);
+    void set_input(std::string_view name, const TensorObject& value);
 };
 
 /****** MultiInferenceMessageInterfaceProxy****************/
@@ -28,6 +28,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace morpheus {
 /****** Component public implementations *******************/
@@ -84,7 +85,7 @@ class MultiResponseMessage : public DerivedMultiMessage<MultiResponseMessage, Mu
      * @return const TensorObject
      * @throws std::runtime_error If no tensor matching `name` exists
      */
-    const TensorObject get_output(const std::string& name) const;
+    const TensorObject get_output(std::string_view name) const;
 
     /**
      * @brief Returns the output tensor with the given name.
@@ -93,7 +94,7 @@ class MultiResponseMessage : public DerivedMultiMessage<MultiResponseMessage, Mu
      * @return TensorObject
      * @throws std::runtime_error If no tensor matching `name` exists
      */
-    TensorObject get_output(const std::string& name);
+    TensorObject get_output(std::string_view name);
 
     /**
      * @brief Update the value of a given output tensor. The tensor must already exist, otherwise this will halt on a
@@ -102,7 +103,7 @@ class MultiResponseMessage : public DerivedMultiMessage<MultiResponseMessage, Mu
      * @param name
      * @param value
      */
-    void set_output(const std::string& name, const TensorObject& value);
+    void set_output(std::string_view name, const TensorObject& value);
 
     /**
      * @brief Get the tensor that holds output probabilities. Equivalent to `get_tensor(probs_tensor_name)`
@@ -27,6 +27,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace morpheus {
@@ -93,7 +94,7 @@ class MultiTensorMessage : public DerivedMultiMessage<MultiTensorMessage, MultiM
      * @return const TensorObject
      * @throws std::runtime_error If no tensor matching `name` exists
      */
-    const TensorObject get_tensor(const std::string& name) const;
+    const TensorObject get_tensor(std::string_view name) const;
 
     /**
      * @brief Returns a tensor with the given name.
@@ -102,7 +103,7 @@ class MultiTensorMessage : public DerivedMultiMessage<MultiTensorMessage, MultiM
      * @return TensorObject
      * @throws std::runtime_error If no tensor matching `name` exists
      */
-    TensorObject get_tensor(const std::string& name);
+    TensorObject get_tensor(std::string_view name);
 
     /**
      * @brief Update the value of a given tensor. The tensor must already exist, otherwise a runtime_error is thrown.
@@ -112,7 +113,28 @@ class MultiTensorMessage : public DerivedMultiMessage<MultiTensorMessage, MultiM
      * @param value
      * @throws std::runtime_error If no tensor matching `name` exists
      */
-    void set_tensor(const std::string& name, const TensorObject& value);
+    void set_tensor(std::string_view name, const TensorObject& value);
+
+    /**
+     * @brief Returns this message's slice of the named tensor for explicit in-place mutation. Unlike copying the
+     * result of `get_tensor` and writing it back with `set_tensor`, no staging buffer is produced, so
+     * post-processing stages can update the response tensors without doubling device bandwidth. Writes are visible
+     * to every message sharing the underlying memory; each checkout must be matched by a `return_tensor` call and
+     * debug builds flag overlapping writers.
+     *
+     * @param name
+     * @return TensorObject
+     * @throws std::runtime_error If no tensor matching `name` exists
+     */
+    TensorObject checkout_tensor(std::string_view name);
+
+    /**
+     * @brief Returns a tensor previously obtained from `checkout_tensor`, releasing the writer claim on the shared
+     * memory object.
+     *
+     * @param tensor
+     */
+    void return_tensor(TensorObject&& tensor);
 
     /**
      * @brief Get the tensor that holds message ID information. Equivalent to `get_tensor(id_tensor_name)`
@@ -131,7 +153,7 @@ class MultiTensorMessage : public DerivedMultiMessage<MultiTensorMessage, MultiM
     std::shared_ptr<morpheus::TensorMemory> copy_input_ranges(const std::vector<RangeType>& ranges,
                                                               TensorIndex num_selected_rows) const;
 
-    TensorObject get_tensor_impl(const std::string& name) const;
+    TensorObject get_tensor_impl(std::string_view name) const;
 };
 
 /****** MultiTensorMessageInterfaceProxy *************************/
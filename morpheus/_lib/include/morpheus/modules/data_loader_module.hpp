@@ -23,6 +23,7 @@
 #include <mrc/modules/segment_modules.hpp>
 #include <nlohmann/json.hpp>
 
+#include <cstddef>  // for size_t
 #include <string>
 
 namespace morpheus {
@@ -45,6 +46,14 @@ class DataLoaderModule : public mrc::modules::SegmentModule, public mrc::modules
     static const std::string s_config_schema;  // NOLINT
 
     DataLoader m_data_loader{};
+
+    // Number of queued messages whose load tasks run ahead of the one currently being consumed, see the
+    // "prefetch_depth" config key. Zero (the default) loads each payload synchronously as the message arrives.
+    std::size_t m_prefetch_depth{0};
+
+    // Number of messages queued per loader invocation, see the "batch_size" config key. Values above one route
+    // loads through `DataLoader::load_batch`, letting batched loaders amortize per-call overhead.
+    std::size_t m_batch_size{1};
 };
 #pragma GCC visibility pop
 }  // namespace morpheus
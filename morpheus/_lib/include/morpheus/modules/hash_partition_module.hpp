@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"
+
+#include <boost/fiber/buffered_channel.hpp>
+#include <mrc/modules/properties/persistent.hpp>
+#include <mrc/modules/segment_modules.hpp>
+#include <nlohmann/json.hpp>
+
+#include <cstddef>  // for size_t
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace morpheus {
+#pragma GCC visibility push(default)
+
+/**
+ * @brief Splits one `MessageMeta` stream into N key-affine branches. Each incoming table is hash-partitioned
+ * on device over the configured key columns (`cudf::hash_partition`, one pass), and each non-empty partition
+ * is emitted as an independent `MessageMeta` on the matching output port, so every downstream branch sees all
+ * rows for its share of the key space and nothing else. Rows never leave the GPU and no re-grouping is needed
+ * downstream, unlike a round-robin split which scatters a key across branches.
+ *
+ * Config keys: "key_columns" (required, list of column names hashed together), "num_partitions" (required,
+ * the number of output ports), "queue_size" (optional per-port handoff depth, a power of two, 64 by default).
+ * The input port is named "input", the output ports "output_0" ... "output_<N-1>".
+ */
+class HashPartitionModule : public mrc::modules::SegmentModule, public mrc::modules::PersistentModule
+{
+    using type_t = HashPartitionModule;
+
+  public:
+    ~HashPartitionModule() override = default;
+
+    HashPartitionModule(std::string module_name);
+    HashPartitionModule(std::string module_name, nlohmann::json _config);
+
+  protected:
+    void initialize(mrc::segment::IBuilder& builder) override;
+    std::string module_type_name() const override;
+
+  private:
+    using channel_t = boost::fibers::buffered_channel<std::shared_ptr<MessageMeta>>;
+
+    /**
+     * @brief Hash-partition `msg` and push each non-empty partition onto its port's channel.
+     */
+    void partition_message(const std::shared_ptr<MessageMeta>& msg);
+
+    static const std::string s_config_schema;  // NOLINT
+
+    std::vector<std::string> m_key_columns;
+    std::size_t m_num_partitions{0};
+    std::size_t m_queue_size{64};
+
+    // One bounded handoff per output port; the splitter blocks (yielding its fiber) when a branch falls
+    // behind, giving the same backpressure as a direct edge
+    std::vector<std::shared_ptr<channel_t>> m_channels;
+};
+#pragma GCC visibility pop
+}  // namespace morpheus
@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/objects/data_table.hpp"  // for IDataTable
+#include "morpheus/objects/table_info_data.hpp"
+
+#include <arrow/table.h>       // for Table
+#include <cudf/io/types.hpp>   // for table_with_metadata
+#include <cudf/types.hpp>      // for size_type
+#include <pybind11/pytypes.h>  // for object
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** ArrowDataTable*************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief `IDataTable` implementation which owns a host-resident `arrow::Table`. Row counts, column names and
+ * pass-through of the owning `MessageMeta` between stages all run against the host table, so a pipeline which only
+ * routes and forwards messages never touches the device at all. The table is uploaded to a cudf table lazily, the
+ * first time a `TableInfo` view is checked out, since every view consumer (cudf writers, filters, kernels) operates
+ * on device memory; after that the instance behaves exactly like `CppDataTable`, including the lazy promotion to a
+ * Python DataFrame.
+ */
+struct ArrowDataTable : public IDataTable
+{
+    /**
+     * @brief Construct a new Arrow Data Table object
+     *
+     * @param table Host table, all columns are treated as data columns (the index is implicit)
+     */
+    ArrowDataTable(std::shared_ptr<arrow::Table> table);
+    ~ArrowDataTable();
+
+    /**
+     * @brief Table rows count, served from the host table while one is held
+     *
+     * @return cudf::size_type
+     */
+    cudf::size_type count() const override;
+
+    /**
+     * @brief Returns true until the table has been promoted to Python, the row numbers form an implicit range index
+     *
+     * @return bool
+     */
+    bool has_implicit_range_index() const override;
+
+    /**
+     * @brief Lazily uploads the table to the device and converts it to a Python DataFrame, then returns it. Requires
+     * the caller to not hold the GIL on the first call.
+     *
+     * @return const pybind11::object&
+     */
+    const pybind11::object& get_py_object() const override;
+
+  private:
+    TableInfoData get_table_data() const override;
+
+    /**
+     * @brief Uploads the host table into `m_device_table` and releases it. The caller must hold `m_mutex`.
+     */
+    void upload() const;
+
+    // Held until the first `TableInfo` checkout (or Python promotion) demands device memory, null afterwards
+    mutable std::shared_ptr<arrow::Table> m_table;
+    std::vector<std::string> m_column_names;
+
+    // Populated by `upload()`, empty until then
+    mutable cudf::io::table_with_metadata m_device_table;
+
+    // Set on the first `get_py_object()` call, empty until then
+    mutable pybind11::object m_py_table;
+
+    // Guards all three promotion states, always acquired after the GIL when both are needed
+    mutable std::mutex m_mutex;
+};
+/** @} */  // end of group
+}  // namespace morpheus
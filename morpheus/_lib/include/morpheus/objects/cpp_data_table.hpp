@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/objects/data_table.hpp"  // for IDataTable
+#include "morpheus/objects/table_info_data.hpp"
+
+#include <cudf/io/types.hpp>   // for table_with_metadata
+#include <cudf/types.hpp>      // for size_type
+#include <pybind11/pytypes.h>  // for object
+
+#include <memory>  // for unique_ptr
+#include <mutex>
+#include <string>
+#include <utility>  // for pair
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** CppDataTable***************************************/
+
+/**
+ * @addtogroup objects
+ * @{
+ * @file
+ */
+
+/**
+ * @brief `IDataTable` implementation which owns a `cudf::table` directly, so `TableInfo` checkouts never touch the
+ * Python GIL. The table is converted to a Python DataFrame lazily, the first time `get_py_object()` is called; until
+ * then an all-C++ pipeline can pass the table between stages with no Python involvement at all. Once converted,
+ * ownership of the device columns moves into the Python object (the column buffers themselves do not move, so any
+ * outstanding `TableInfo` views remain valid) and all further calls delegate to it, matching `PyDataTable`.
+ */
+struct CppDataTable : public IDataTable
+{
+    /**
+     * @brief Construct a new Cpp Data Table object
+     *
+     * @param table Table with metadata, the first `index_col_count` columns are treated as the index
+     * @param index_col_count Number of index columns in the table_with_metadata
+     */
+    CppDataTable(cudf::io::table_with_metadata&& table, int index_col_count);
+    ~CppDataTable();
+
+    /**
+     * @brief cuDF table rows count
+     *
+     * @return cudf::size_type
+     */
+    cudf::size_type count() const override;
+
+    /**
+     * @brief Returns true while the table has no index columns and has not been promoted to Python, the row numbers
+     * then form an implicit range index
+     *
+     * @return bool
+     */
+    bool has_implicit_range_index() const override;
+
+    /**
+     * @brief Attaches the columns to the owned `cudf::table` as a metadata-only append (the column vector is
+     * re-seated, no device data moves) while the table has not been promoted to Python; the Python DataFrame then
+     * picks the columns up whenever it is lazily built. Returns false once promoted, Python owns the columns then.
+     *
+     * @param columns Name / column pairs to append, consumed on success
+     * @return bool
+     */
+    bool append_columns(std::vector<std::pair<std::string, std::unique_ptr<cudf::column>>>&& columns) const override;
+
+    /**
+     * @brief Lazily converts the C++ table to a Python DataFrame, and returns it. Requires the caller to not hold the
+     * GIL on the first call.
+     *
+     * @return const pybind11::object&
+     */
+    const pybind11::object& get_py_object() const override;
+
+  private:
+    TableInfoData get_table_data() const override;
+
+    mutable cudf::io::table_with_metadata m_table;
+    int m_index_col_count;
+    std::vector<std::string> m_index_names;
+
+    // Mutable so `append_columns` can extend the schema through the const checkout path
+    mutable std::vector<std::string> m_column_names;
+
+    // Set on the first `get_py_object()` call, empty until then. Guarded by `m_py_mutex` since conversion can race
+    // between readers holding only the shared table lock
+    mutable pybind11::object m_py_table;
+    mutable std::mutex m_py_mutex;
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -20,8 +20,17 @@
 #include <cudf/types.hpp>
 #include <pybind11/pytypes.h>
 
+#include <atomic>
+#include <cstddef>  // for size_t
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
+#include <string>   // for string
+#include <utility>  // for pair
+#include <vector>   // for vector
+
+namespace cudf {
+class column;
+}  // namespace cudf
 
 namespace morpheus {
 
@@ -70,6 +79,16 @@ struct IDataTable : public std::enable_shared_from_this<IDataTable>
      * `TableInfo`.
      */
     TableInfo get_info() const;
+
+    /**
+     * @brief Same as `get_info()`, narrowed to `column_names` (plus the index columns). Only the requested
+     * `column_view`s are constructed, instead of copying a view and name for every column in the table when the
+     * caller only touches a few of them.
+     *
+     * @param column_names Columns to include, in the order given
+     * @return TableInfo
+     */
+    TableInfo get_info(const std::vector<std::string>& column_names) const;
     ///@}
 
     ///@{
@@ -88,6 +107,40 @@ struct IDataTable : public std::enable_shared_from_this<IDataTable>
     MutableTableInfo get_mutable_info() const;
     ///@}
 
+    /**
+     * @brief Monotonic counter incremented every time mutable access to the table is granted. Used by `ColumnHandle`
+     * to detect when a cached column resolution may be stale.
+     *
+     * @return std::size_t
+     */
+    std::size_t schema_version() const;
+
+    /**
+     * @brief Returns true when the table is known to use an implicit [0, count) range index, which is unique and
+     * monotonic by construction. Such tables are sliceable without inspecting (or materializing) an index column.
+     * Returning false only means it cannot be determined cheaply, the index then needs to be inspected.
+     *
+     * @return bool
+     */
+    virtual bool has_implicit_range_index() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Appends already-built columns to the table as a metadata-only operation on the C++ side, when the
+     * implementation can do so without touching Python. Returns false when it cannot (python-backed tables, or a
+     * table already promoted to a Python object), in which case the caller goes through the Python append path
+     * instead. Must only be called while a `MutableTableInfo` checkout holds exclusive access.
+     *
+     * @param columns Name / column pairs to append, consumed on success
+     * @return bool True when the columns were attached
+     */
+    virtual bool append_columns(std::vector<std::pair<std::string, std::unique_ptr<cudf::column>>>&& columns) const
+    {
+        return false;
+    }
+
     /**
      * @brief Direct access to the underlying python object. Use only when absolutely necessary. `get_mutable_info()`
      * provides better checking when using the python object directly.
@@ -105,9 +158,22 @@ struct IDataTable : public std::enable_shared_from_this<IDataTable>
      */
     virtual TableInfoData get_table_data() const = 0;
 
-    // Used to prevent locking to shared resources. Will need to be a boost fibers
-    // supported mutex if we support C++ nodes with Fiber runables in the future
-    mutable std::shared_mutex m_mutex{};
+    /**
+     * @brief Returns the current published snapshot, building and publishing one first if none is current.
+     *
+     * @return std::shared_ptr<const TableInfoData>
+     */
+    std::shared_ptr<const TableInfoData> get_snapshot() const;
+
+    // Serializes mutators and snapshot publication, readers never take it on the fast path. Will need to be a boost
+    // fibers supported mutex if we support C++ nodes with Fiber runables in the future
+    mutable std::mutex m_writer_mutex{};
+
+    // Immutable snapshot shared by every reader, published and retired with atomic shared_ptr operations. Null
+    // whenever no snapshot is current (before the first read, or after a mutation retired it)
+    mutable std::shared_ptr<const TableInfoData> m_snapshot{};
+
+    mutable std::atomic<std::size_t> m_schema_version{0};
 };
 /** @} */  // end of group
 }  // namespace morpheus
@@ -155,6 +155,13 @@ class MORPHEUS_EXPORT DevMemInfo
      */
     std::shared_ptr<MemoryDescriptor> memory() const;
 
+    /**
+     * @brief Return the ordinal of the device the buffer lives on
+     *
+     * @return int
+     */
+    int device_id() const;
+
     /**
      * @brief Constructs a new rmm buffer with the same stream and memory resource as the current buffer
      *
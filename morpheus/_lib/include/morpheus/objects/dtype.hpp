@@ -22,6 +22,7 @@
 #include <climits>  // for CHAR_BIT
 #include <cstddef>  // for size_t
 #include <cstdint>  // for int32_t
+#include <map>      // for map
 #include <string>   // for string
 
 namespace morpheus {
@@ -57,6 +58,7 @@ enum class TypeId : int32_t
     FLOAT64,  ///< 8 byte floating point
     BOOL8,    ///< Boolean using one byte per value, 0 == false, else true
     STRING,   ///< String elements, not supported by cupy
+    FLOAT16,  ///< 2 byte floating point (IEEE 754 half). No cuDF equivalent, only valid for device tensors
 
     //   TIMESTAMP_DAYS,          ///< point in time in days since Unix Epoch in int32
     //   TIMESTAMP_SECONDS,       ///< point in time in seconds since Unix Epoch in int64
@@ -91,16 +93,16 @@ struct DType
     size_t item_size() const;
 
     // Pretty print
-    std::string name() const;
+    const std::string& name() const;
 
     // Returns the numpy string representation
-    std::string type_str() const;
+    const std::string& type_str() const;
 
     // Cudf representation
     cudf::type_id cudf_type_id() const;
 
     // Returns the triton string representation
-    std::string triton_str() const;
+    const std::string& triton_str() const;
 
     // From cudf
     static DType from_cudf(cudf::type_id tid);
@@ -178,6 +180,20 @@ struct DType
     TypeId m_type_id;
 };
 
+/**
+ * @brief Explicit column name to dtype mapping for the JSON/CSV source readers. Passing one into a reader pins the
+ * column dtypes, skipping cudf's per-batch type inference pass and the dtype flips it can produce between batches.
+ */
+using TableSchema = std::map<std::string, TypeId>;
+
+/**
+ * @brief Convert a `TableSchema` into the per-column dtype mapping the cudf reader options accept
+ *
+ * @param schema : Column name to `TypeId` mapping
+ * @return std::map<std::string, cudf::data_type>
+ */
+std::map<std::string, cudf::data_type> schema_to_cudf_dtypes(const TableSchema& schema);
+
 /** @} */  // end of group
 #pragma GCC visibility pop
 }  // namespace morpheus
@@ -23,30 +23,36 @@
 #include <mrc/utils/type_utils.hpp>
 #include <pybind11/pybind11.h>
 
+#include <atomic>  // for atomic_load_explicit & atomic_store_explicit
 #include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 
 namespace morpheus {
 #pragma GCC visibility push(default)
+
+/**
+ * @brief Static factory registry with a lock-free read path. The constructor table is an immutable snapshot which
+ * is swapped atomically on (un)registration, so the hot lookup/create calls never contend on the writer mutex once
+ * the registration phase is over.
+ */
 template <typename ObjectReturnTypeT>
 class FactoryRegistry
 {
   public:
     static bool contains(const std::string& name)
     {
-        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
-        return m_object_constructors.count(name) > 0;
+        return snapshot()->count(name) > 0;
     }
 
     static std::vector<std::string> list()
     {
-        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
         std::vector<std::string> names;
-        for (const auto& [name, _] : m_object_constructors)
+        for (const auto& [name, _] : *snapshot())
         {
             names.push_back(name);
         }
@@ -56,38 +62,46 @@ class FactoryRegistry
     static std::shared_ptr<ObjectReturnTypeT> create_object_from_factory(const std::string& name,
                                                                          nlohmann::json config = {})
     {
-        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
         VLOG(2) << "Retrieving factory constructor: " << name << "(" << mrc::type_name<ObjectReturnTypeT>() << ")";
 
-        if (m_object_constructors.count(name) == 0)
+        const auto constructors = snapshot();
+
+        auto constructor = constructors->find(name);
+        if (constructor == constructors->end())
         {
             throw std::runtime_error("Unknown data loader: " + name);
         }
 
-        return m_object_constructors[name](config);
+        return constructor->second(config);
     }
 
     static void register_factory_fn(const std::string& name,
                                     const std::function<std::shared_ptr<ObjectReturnTypeT>(nlohmann::json)>& loader_fn,
                                     bool throw_if_exists = true)
     {
-        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        std::lock_guard<std::mutex> lock(writer_mutex());
         VLOG(2) << "Registering factory constructor: " << name << "(" << mrc::type_name<ObjectReturnTypeT>() << ")";
-        if (m_object_constructors.count(name) > 0)
+
+        auto constructors = std::make_shared<constructor_map_t>(*snapshot());
+        if (constructors->count(name) > 0)
         {
             if (throw_if_exists)
             {
                 throw std::runtime_error("Duplicate data loader registration: " + name);
             }
         }
-        m_object_constructors[name] = loader_fn;
+        (*constructors)[name] = loader_fn;
+
+        publish(std::move(constructors));
     }
 
     static void unregister_factory_fn(const std::string& name, bool throw_if_missing = true)
     {
-        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        std::lock_guard<std::mutex> lock(writer_mutex());
         VLOG(2) << "Un-registering factory constructor: " << name << "(" << mrc::type_name<ObjectReturnTypeT>() << ")";
-        if (m_object_constructors.count(name) == 0)
+
+        auto constructors = std::make_shared<constructor_map_t>(*snapshot());
+        if (constructors->count(name) == 0)
         {
             if (throw_if_missing)
             {
@@ -96,21 +110,39 @@ class FactoryRegistry
 
             return;
         }
-        m_object_constructors.erase(name);
+        constructors->erase(name);
+
+        publish(std::move(constructors));
     }
 
   private:
-    static std::mutex m_mutex;
-    static std::map<std::string, std::function<std::shared_ptr<ObjectReturnTypeT>(nlohmann::json)>>
-        m_object_constructors;
-};
+    using constructor_map_t = std::map<std::string, std::function<std::shared_ptr<ObjectReturnTypeT>(nlohmann::json)>>;
 
-template <typename ObjectReturnTypeT>
-std::mutex FactoryRegistry<ObjectReturnTypeT>::m_mutex;
+    // Shared storage slot for the current snapshot, a function-local static so the first use constructs it
+    static std::shared_ptr<const constructor_map_t>& storage()
+    {
+        static std::shared_ptr<const constructor_map_t> constructors = std::make_shared<constructor_map_t>();
+        return constructors;
+    }
 
-template <typename ObjectReturnTypeT>
-std::map<std::string, std::function<std::shared_ptr<ObjectReturnTypeT>(nlohmann::json)>>
-    FactoryRegistry<ObjectReturnTypeT>::m_object_constructors;
+    static std::shared_ptr<const constructor_map_t> snapshot()
+    {
+        return std::atomic_load_explicit(&storage(), std::memory_order_acquire);
+    }
+
+    static void publish(std::shared_ptr<constructor_map_t> constructors)
+    {
+        std::atomic_store_explicit(
+            &storage(), std::shared_ptr<const constructor_map_t>(std::move(constructors)), std::memory_order_release);
+    }
+
+    // Serializes writers only, readers go straight to the snapshot
+    static std::mutex& writer_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+};
 
 #pragma GCC visibility pop
 
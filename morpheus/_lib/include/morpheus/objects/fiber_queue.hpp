@@ -22,8 +22,10 @@
 #include <pybind11/pybind11.h>  // IWYU pragma: keep
 #include <pybind11/pytypes.h>
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace morpheus {
 /****** Component public implementations *******************/
@@ -35,6 +37,48 @@ namespace morpheus {
  * @file
  */
 
+/**
+ * @brief Bounded lock-free MPMC ring (Vyukov style). Producers and consumers claim slots with a single
+ * compare-and-swap and never take a mutex, so a handoff costs no scheduler wakeup. Blocking callers busy-spin for a
+ * bounded number of attempts before yielding the fiber, trading a little CPU for burst latency.
+ */
+class LockFreeRing
+{
+  public:
+    /**
+     * @brief Construct a ring with `capacity` slots (must be a power of 2). Blocking operations retry
+     * `spin_count` times before each fiber yield.
+     */
+    LockFreeRing(std::size_t capacity, std::size_t spin_count);
+
+    boost::fibers::channel_op_status put(pybind11::object&& item, bool block, float timeout);
+    boost::fibers::channel_op_status get(pybind11::object& item, bool block, float timeout);
+
+    void close();
+    bool is_closed() const;
+
+  private:
+    // Only moves from `item` on success, a caller can safely retry after `full`
+    boost::fibers::channel_op_status try_put(pybind11::object&& item);
+    boost::fibers::channel_op_status try_get(pybind11::object& item);
+
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        pybind11::object data;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    std::size_t m_mask;
+    std::size_t m_spin_count;
+
+    // Producers and consumers advance independent cursors, keep them on separate cache lines
+    alignas(64) std::atomic<std::size_t> m_enqueue_pos{0};
+    alignas(64) std::atomic<std::size_t> m_dequeue_pos{0};
+
+    std::atomic<bool> m_closed{false};
+};
+
 /**
  * @brief This class acts as a collection or linear data structure that stores elements in FIFO (First In, First Out)
  * order
@@ -43,7 +87,13 @@ namespace morpheus {
 class FiberQueue
 {
   public:
-    FiberQueue(std::size_t max_size);
+    /**
+     * @brief Construct a queue holding up to `max_size` items (must be a power of 2). When `lock_free` is true the
+     * queue is backed by a `LockFreeRing` instead of a `boost::fibers::buffered_channel`, avoiding the channel's
+     * mutex and wakeup latency under burst load at the cost of busy-spinning blocked callers for up to `spin_count`
+     * attempts before they yield.
+     */
+    FiberQueue(std::size_t max_size, bool lock_free = false, std::size_t spin_count = 1024);
 
     /**
      * @brief Item to the queue. Await the acknowledgement delays based on the timeout that has been specified.
@@ -65,6 +115,36 @@ class FiberQueue
      */
     boost::fibers::channel_op_status get(pybind11::object& item, bool block = true, float timeout = 0.0);
 
+    /**
+     * @brief Puts every item in `items` onto the queue, applying the blocking semantics of `put` to each one. On the
+     * first non-success status the already-delivered items are erased from the front of `items` and that status is
+     * returned, leaving the undelivered tail in place.
+     *
+     * @param items
+     * @param block
+     * @param timeout
+     * @return boost::fibers::channel_op_status
+     */
+    boost::fibers::channel_op_status put_all(std::vector<pybind11::object>& items,
+                                             bool block    = true,
+                                             float timeout = 0.0);
+
+    /**
+     * @brief Retrieves up to `max_n` items in one call. Waits for the first item with the blocking semantics of
+     * `get`, then drains whatever is immediately available without waiting again, so a burst of N queued items costs
+     * one blocking round trip instead of N.
+     *
+     * @param items
+     * @param max_n
+     * @param block
+     * @param timeout
+     * @return boost::fibers::channel_op_status
+     */
+    boost::fibers::channel_op_status get_all(std::vector<pybind11::object>& items,
+                                             std::size_t max_n,
+                                             bool block    = true,
+                                             float timeout = 0.0);
+
     /**
      * TODO(Documentation)
      */
@@ -82,6 +162,9 @@ class FiberQueue
 
   private:
     boost::fibers::buffered_channel<pybind11::object> m_queue;
+
+    // Set when constructed with `lock_free = true`, all operations then bypass `m_queue`
+    std::unique_ptr<LockFreeRing> m_ring;
 };
 
 #pragma GCC visibility push(default)
@@ -95,9 +178,10 @@ struct FiberQueueInterfaceProxy
      * @brief Create and initialize a FIberQueue, and return a shared pointer to the result
      *
      * @param max_size
+     * @param lock_free
      * @return std::shared_ptr<morpheus::FiberQueue>
      */
-    static std::shared_ptr<morpheus::FiberQueue> init(std::size_t max_size);
+    static std::shared_ptr<morpheus::FiberQueue> init(std::size_t max_size, bool lock_free);
 
     /**
      * TODO(Documentation)
@@ -109,6 +193,19 @@ struct FiberQueueInterfaceProxy
      */
     static pybind11::object get(morpheus::FiberQueue& self, bool block = true, float timeout = 0.0);
 
+    /**
+     * @brief Puts every item of the list, raising `queue.Full` if not all of them could be delivered.
+     */
+    static void put_all(morpheus::FiberQueue& self, pybind11::list items, bool block = true, float timeout = 0.0);
+
+    /**
+     * @brief Retrieves up to `max_n` items as a list, waiting for the first one only.
+     */
+    static pybind11::list get_all(morpheus::FiberQueue& self,
+                                  std::size_t max_n,
+                                  bool block    = true,
+                                  float timeout = 0.0);
+
     /**
      * TODO(Documentation)
      */
@@ -36,7 +36,8 @@ enum class FileTypes : int32_t
     Auto,
     JSON,
     CSV,
-    PARQUET
+    PARQUET,
+    ARROW
 };
 
 /**
@@ -57,6 +58,8 @@ inline std::string filetypes_to_str(const FileTypes& f)
         return "CSV";
     case FileTypes::PARQUET:
         return "PARQUET";
+    case FileTypes::ARROW:
+        return "ARROW";
     default:
         throw std::logic_error("Unsupported FileTypes enum. Was a new value added recently?");
     }
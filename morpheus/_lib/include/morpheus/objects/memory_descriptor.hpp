@@ -30,13 +30,16 @@ struct MORPHEUS_EXPORT MemoryDescriptor
 {
     /**
      * @brief Construct a new MemoryDescriptor object.  If `memory_resource` is null the value returned by
-     * `rmm::mr::get_current_device_resource()` will be used.
+     * `rmm::mr::get_current_device_resource()` will be used. If `device_id` is negative the device current at
+     * construction time is recorded, which matches where the stream and memory resource are valid.
      *
      * @param stream
      * @param memory_resource
+     * @param device_id
      */
     MemoryDescriptor(rmm::cuda_stream_view stream,
-                     cuda::mr::async_resource_ref<cuda::mr::device_accessible> mem_resource);
+                     cuda::mr::async_resource_ref<cuda::mr::device_accessible> mem_resource,
+                     int device_id = -1);
     MemoryDescriptor(MemoryDescriptor& other)  = default;
     MemoryDescriptor(MemoryDescriptor&& other) = default;
 
@@ -45,4 +48,8 @@ struct MORPHEUS_EXPORT MemoryDescriptor
 
     // Memory resource
     cuda::mr::async_resource_ref<cuda::mr::device_accessible> memory_resource;
+
+    // Ordinal of the device the memory lives on. The stream and memory resource are only meaningful on this device,
+    // and consumers on other devices must copy (see `TensorUtils::copy_to_device`) before touching the data.
+    int device_id{0};
 };
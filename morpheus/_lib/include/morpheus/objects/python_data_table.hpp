@@ -23,6 +23,8 @@
 #include <cudf/types.hpp>      // for size_type
 #include <pybind11/pytypes.h>  // for object
 
+#include <atomic>  // for atomic
+
 namespace morpheus {
 /****** Component public implementations *******************/
 /****** PyDataTable****************************************/
@@ -47,7 +49,8 @@ struct PyDataTable : public IDataTable
     ~PyDataTable();
 
     /**
-     * @brief cuDF table rows count
+     * @brief cuDF table rows count. Computed with the GIL on first use and cached; in-place mutations of the
+     * table only ever append columns, never rows, so the count is stable for the table's lifetime.
      *
      * @return cudf::size_type
      */
@@ -64,6 +67,7 @@ struct PyDataTable : public IDataTable
     TableInfoData get_table_data() const override;
 
     pybind11::object m_py_table;
+    mutable std::atomic<cudf::size_type> m_count{-1};
 };
 /** @} */  // end of group
 }  // namespace morpheus
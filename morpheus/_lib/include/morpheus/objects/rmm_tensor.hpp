@@ -78,6 +78,11 @@ class RMMTensor : public ITensor
      */
     std::shared_ptr<ITensor> reshape(const ShapeType& dims) const override;
 
+    /**
+     * @brief Zero-copy view with the two axes' shape and stride entries exchanged
+     */
+    std::shared_ptr<ITensor> swap_axes(TensorIndex axis1, TensorIndex axis2) const override;
+
     /**
      * TODO(Documentation)
      */
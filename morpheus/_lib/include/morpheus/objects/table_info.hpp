@@ -21,18 +21,20 @@
 #include "morpheus/objects/data_table.hpp"
 #include "morpheus/objects/dtype.hpp"
 #include "morpheus/objects/table_info_data.hpp"
+#include "morpheus/objects/tensor_object.hpp"  // for TensorObject
 
 #include <cudf/column/column_view.hpp>  // for column_view
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>      // for size_type
 #include <pybind11/pytypes.h>  // for object
 
+#include <cstddef>  // for size_t
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <shared_mutex>
 #include <string>
 #include <tuple>
+#include <utility>  // for pair
 #include <vector>
 
 namespace morpheus {
@@ -46,6 +48,23 @@ struct CudfHelper;
  */
 /****** Component public implementations *******************/
 /****** TableInfo******************************************/
+
+/**
+ * @brief Stage-lifetime handle to a dataframe column, caching the name resolution so hot loops can skip the string
+ * lookup performed by `get_slice`. Resolve once with `TableInfoBase::resolve_column_handle` and pass to
+ * `MultiMessage::get_meta`/`set_meta`; the cached resolution is refreshed only when the table's schema version
+ * changes.
+ */
+struct MORPHEUS_EXPORT ColumnHandle
+{
+    std::string name;
+
+    // Position within the data columns (excluding any index columns). -1 marks an unresolved handle
+    cudf::size_type index{-1};
+    cudf::type_id dtype{cudf::type_id::EMPTY};
+    std::size_t schema_version{0};
+};
+
 struct MORPHEUS_EXPORT TableInfoBase
 {
     /**
@@ -108,6 +127,26 @@ struct MORPHEUS_EXPORT TableInfoBase
      */
     bool has_sliceable_index() const;
 
+    /**
+     * @brief Resolves a column name to a `ColumnHandle` which can be reused across messages sharing the same schema.
+     *
+     * @throws pybind11::key_error
+     * If `name` is not a column of the table
+     *
+     * @param name : Name of the column to resolve
+     * @return ColumnHandle
+     */
+    ColumnHandle resolve_column_handle(const std::string& name) const;
+
+    /**
+     * @brief Returns true if `handle` was resolved against the current schema version of the underlying table, false
+     * if it needs to be re-resolved.
+     *
+     * @param handle
+     * @return bool
+     */
+    bool is_current(const ColumnHandle& handle) const;
+
   protected:
     TableInfoBase() = default;
 
@@ -130,7 +169,9 @@ struct MORPHEUS_EXPORT TableInfo : public TableInfoBase
 {
   public:
     TableInfo() = default;
-    TableInfo(std::shared_ptr<const IDataTable> parent, std::shared_lock<std::shared_mutex> lock, TableInfoData data);
+    TableInfo(std::shared_ptr<const IDataTable> parent,
+              std::shared_ptr<const TableInfoData> snapshot,
+              TableInfoData data);
 
     /**
      * @brief Get slice of a data table info based on the start and stop offset address
@@ -142,17 +183,27 @@ struct MORPHEUS_EXPORT TableInfo : public TableInfoBase
      */
     TableInfo get_slice(cudf::size_type start, cudf::size_type stop, std::vector<std::string> column_names = {}) const;
 
+    /**
+     * @brief Fast-path equivalent of `get_slice` for a single column which selects by the cached index in `handle`
+     * instead of searching the column names. The handle must be current, see `is_current`.
+     *
+     * @param handle : Previously resolved column handle
+     * @param start : Start offset address (inclusive)
+     * @param stop : Stop offset address (exclusive)
+     * @return TableInfo
+     */
+    TableInfo get_column_slice(const ColumnHandle& handle, cudf::size_type start, cudf::size_type stop) const;
+
   private:
-    // We use a shared_lock to allow multiple `TableInfo` to be in use at the same time.
-    std::shared_lock<std::shared_mutex> m_lock;
+    // Keeps alive the snapshot generation this view was taken from. Mutators wait until every reference to a retired
+    // snapshot has dropped before touching the table, so no locking is needed on the read side
+    std::shared_ptr<const TableInfoData> m_snapshot;
 };
 
 struct MORPHEUS_EXPORT MutableTableInfo : public TableInfoBase
 {
   public:
-    MutableTableInfo(std::shared_ptr<const IDataTable> parent,
-                     std::unique_lock<std::shared_mutex> lock,
-                     TableInfoData data);
+    MutableTableInfo(std::shared_ptr<const IDataTable> parent, std::unique_lock<std::mutex> lock, TableInfoData data);
 
     MutableTableInfo(MutableTableInfo&& other) = default;
 
@@ -180,6 +231,28 @@ struct MORPHEUS_EXPORT MutableTableInfo : public TableInfoBase
      */
     void insert_missing_columns(const std::vector<std::tuple<std::string, morpheus::DType>>& columns);
 
+    /**
+     * @brief Appends already-built device columns to the table in place, without rebuilding the dataframe or
+     * acquiring the GIL. Returns false (leaving `columns` untouched) when the owning table cannot adopt the columns
+     * directly (python-backed tables), in which case the caller must append through the Python API instead.
+     *
+     * @param columns : Name / column pairs to append, consumed on success
+     * @return bool True when the columns were attached
+     */
+    bool append_columns(std::vector<std::pair<std::string, std::unique_ptr<cudf::column>>>&& columns);
+
+    /**
+     * @brief Writes each tensor into the device memory of its named column as a single batch. The entire update runs
+     * in libcudf without acquiring the GIL or producing the python object, avoiding a `checkout_obj`/`return_obj`
+     * round-trip per column when several columns are mutated under one checkout.
+     *
+     * @throws std::runtime_error
+     * If any name in `updates` is not an existing column. Call `insert_missing_columns` first to add them.
+     *
+     * @param updates : Pairs of column name and tensor holding the new values
+     */
+    void update_columns(const std::vector<std::pair<std::string, TensorObject>>& updates);
+
     /**
      * @brief Allows the python object to be "checked out" which gives exclusive access to the python object during the
      * lifetime of `MutableTableInfo`. Use this method when it is necessary to make changes to the python object using
@@ -206,8 +279,9 @@ struct MORPHEUS_EXPORT MutableTableInfo : public TableInfoBase
     std::optional<std::string> ensure_sliceable_index();
 
   private:
-    // We use a unique_lock here to enforce exclusive access
-    std::unique_lock<std::shared_mutex> m_lock;
+    // We use a unique_lock here to enforce exclusive access among mutators, readers are excluded by the snapshot
+    // grace period in `IDataTable::get_mutable_info`
+    std::unique_lock<std::mutex> m_lock;
 
     mutable int m_checked_out_ref_count{-1};
 };
@@ -25,6 +25,7 @@
 #include <cuda_runtime.h>  // for cudaMemcpyDeviceToHost & cudaMemcpy
 #include <glog/logging.h>  // for CHECK
 #include <mrc/cuda/common.hpp>
+#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_view
 #include <rmm/device_uvector.hpp>
 
 #include <algorithm>
@@ -89,6 +90,16 @@ void validate_stride(const std::vector<IndexT>& shape, std::vector<IndexT>& stri
     }
 }
 
+/**
+ * @brief Gathers `byte_offsets.size()` elements of `item_size` bytes each from `device_data` into `host_out` using
+ * a single gather kernel and one device-to-host copy. Blocks until the copy completes.
+ */
+void gather_elements_to_host(const uint8_t* device_data,
+                             const std::vector<TensorSize>& byte_offsets,
+                             std::size_t item_size,
+                             void* host_out,
+                             rmm::cuda_stream_view stream);
+
 }  // namespace detail
 
 enum class TensorStorageType
@@ -121,6 +132,8 @@ struct ITensorOperations
 
     virtual std::shared_ptr<ITensor> reshape(const ShapeType& dims) const = 0;
 
+    virtual std::shared_ptr<ITensor> swap_axes(TensorIndex axis1, TensorIndex axis2) const = 0;
+
     virtual std::shared_ptr<ITensor> deep_copy() const = 0;
 
     virtual std::shared_ptr<ITensor> copy_rows(const std::vector<RangeType>& selected_rows,
@@ -267,6 +280,14 @@ struct TensorObject final
         return {m_md, m_tensor->reshape(dims)};
     }
 
+    // Zero-copy view with the two axes' shape and stride entries exchanged, the data is never touched.
+    // Consumers that take a stride (the MatxUtil kernels, the compacting copies) read through the swapped
+    // layout directly; only a consumer that truly needs contiguity pays for a deep_copy
+    TensorObject swap_axes(TensorIndex axis1, TensorIndex axis2) const
+    {
+        return {m_md, m_tensor->swap_axes(axis1, axis2)};
+    }
+
     TensorObject deep_copy() const
     {
         std::shared_ptr<ITensor> copy = m_tensor->deep_copy();
@@ -348,6 +369,57 @@ struct TensorObject final
         return output;
     }
 
+    /**
+     * @brief Batched `read_element`: reads every element addressed by `indices` with a single gather kernel and one
+     * device-to-host copy, instead of a synchronous per-element copy. Intended for diagnostic and sampling paths
+     * which inspect a handful of scattered values per batch and would otherwise pay one sync per value.
+     *
+     * @param indices Element coordinates to read, each of the tensor's rank
+     * @return std::vector<T> The values, in the order of `indices`
+     */
+    template <typename T, RankType N>
+    std::vector<T> read_elements(const std::vector<std::array<TensorIndex, N>>& indices) const
+    {
+        auto stride = this->get_stride();
+        auto shape  = this->get_shape();
+
+        CHECK(shape.size() == N) << "Length of each index must match lengh of shape";
+
+        CHECK(DType::create<T>() == this->dtype())
+            << "read_elements type must match array type. read_elements type: '" << DType::create<T>().name()
+            << "', array type: '" << this->dtype().name() << "'";
+
+        std::vector<TensorSize> byte_offsets;
+        byte_offsets.reserve(indices.size());
+
+        for (const auto& idx : indices)
+        {
+            CHECK(std::transform_reduce(
+                shape.begin(), shape.end(), std::begin(idx), 1, std::logical_and<>(), std::greater<>()))
+                << "Index is outsize of the bounds of the tensor. Index="
+                << StringUtil::array_to_str(std::begin(idx), std::end(idx))
+                << ", Size=" << StringUtil::array_to_str(shape.begin(), shape.end()) << "";
+
+            byte_offsets.push_back(std::transform_reduce(stride.begin(),
+                                                         stride.end(),
+                                                         std::begin(idx),
+                                                         0,
+                                                         std::plus<>(),
+                                                         std::multiplies<>()) *
+                                   this->dtype_size());
+        }
+
+        std::vector<T> output(indices.size());
+
+        detail::gather_elements_to_host(static_cast<const uint8_t*>(this->data()),
+                                        byte_offsets,
+                                        sizeof(T),
+                                        output.data(),
+                                        this->get_memory()->cuda_stream);
+
+        return output;
+    }
+
     /**
      * @brief Explicitly swap the pointers to the underlying data with another tensor. Use inplace of the move operator
      * since it's hard to determine when you want to perform a move vs copy the data.
@@ -51,8 +51,15 @@ class AddClassificationsStage : public AddScoresStageBase
      *
      * @param threshold : Threshold to consider true/false for each class
      * @param idx2label : Index to classification labels map
+     * @param softmax : Apply a row-wise softmax to the probabilities before thresholding
+     * @param argmax_score_column : Preallocated column to receive each row's maximum probability, "" to disable
+     * @param argmax_index_column : Preallocated int64 column to receive each row's winning class index, "" to disable
      */
-    AddClassificationsStage(std::map<std::size_t, std::string> idx2label, float threshold);
+    AddClassificationsStage(std::map<std::size_t, std::string> idx2label,
+                            float threshold,
+                            bool softmax                    = false,
+                            std::string argmax_score_column = "",
+                            std::string argmax_index_column = "");
 };
 
 /****** AddClassificationStageInterfaceProxy******************/
@@ -68,13 +75,19 @@ struct AddClassificationStageInterfaceProxy
      * @param name : Name of a stage reference
      * @param idx2label : Index to classification labels map
      * @param threshold : Threshold to consider true/false for each class
+     * @param softmax : Apply a row-wise softmax to the probabilities before thresholding
+     * @param argmax_score_column : Preallocated column to receive each row's maximum probability, "" to disable
+     * @param argmax_index_column : Preallocated int64 column to receive each row's winning class index, "" to disable
      * @return std::shared_ptr<mrc::segment::Object<AddClassificationsStage>>
      */
     static std::shared_ptr<mrc::segment::Object<AddClassificationsStage>> init(
         mrc::segment::Builder& builder,
         const std::string& name,
         std::map<std::size_t, std::string> idx2label,
-        float threshold);
+        float threshold,
+        bool softmax                    = false,
+        std::string argmax_score_column = "",
+        std::string argmax_index_column = "");
 };
 
 #pragma GCC visibility pop
@@ -49,8 +49,14 @@ class AddScoresStage : public AddScoresStageBase
      * @brief Construct a new Add Scores Stage object
      *
      * @param idx2label : Index to classification labels map
+     * @param softmax : Apply a row-wise softmax to the probabilities before scoring
+     * @param argmax_score_column : Preallocated column to receive each row's maximum probability, "" to disable
+     * @param argmax_index_column : Preallocated int64 column to receive each row's winning class index, "" to disable
      */
-    AddScoresStage(std::map<std::size_t, std::string> idx2label);
+    AddScoresStage(std::map<std::size_t, std::string> idx2label,
+                   bool softmax                    = false,
+                   std::string argmax_score_column = "",
+                   std::string argmax_index_column = "");
 };
 
 /****** AddScoresStageInterfaceProxy******************/
@@ -66,11 +72,17 @@ struct AddScoresStageInterfaceProxy
      * @param name : Name of a stage reference
      * @param num_class_labels : Number of classification labels
      * @param idx2label : Index to classification labels map
+     * @param softmax : Apply a row-wise softmax to the probabilities before scoring
+     * @param argmax_score_column : Preallocated column to receive each row's maximum probability, "" to disable
+     * @param argmax_index_column : Preallocated int64 column to receive each row's winning class index, "" to disable
      * @return std::shared_ptr<mrc::segment::Object<AddScoresStage>>
      */
     static std::shared_ptr<mrc::segment::Object<AddScoresStage>> init(mrc::segment::Builder& builder,
                                                                       const std::string& name,
-                                                                      std::map<std::size_t, std::string> idx2label);
+                                                                      std::map<std::size_t, std::string> idx2label,
+                                                                      bool softmax                    = false,
+                                                                      std::string argmax_score_column = "",
+                                                                      std::string argmax_index_column = "");
 };
 
 #pragma GCC visibility pop
@@ -65,8 +65,18 @@ class AddScoresStageBase
      *
      * @param threshold : Threshold to consider true/false for each class
      * @param idx2label : Index to classification labels map
+     * @param softmax : When true, apply a row-wise softmax to the probabilities tensor before scoring. For
+     * multiclass models emitting raw logits, this replaces a per-batch softmax in Python post-processing
+     * @param argmax_score_column : When set (together with `argmax_index_column`), write each row's maximum
+     * probability into this preallocated column, of the same type as the probabilities tensor
+     * @param argmax_index_column : When set (together with `argmax_score_column`), write the index of each row's
+     * winning class into this preallocated int64 column
      */
-    AddScoresStageBase(std::map<std::size_t, std::string> idx2label, std::optional<float> threshold);
+    AddScoresStageBase(std::map<std::size_t, std::string> idx2label,
+                       std::optional<float> threshold,
+                       bool softmax,
+                       std::string argmax_score_column,
+                       std::string argmax_index_column);
 
   private:
     /**
@@ -76,6 +86,9 @@ class AddScoresStageBase
 
     std::map<std::size_t, std::string> m_idx2label;
     std::optional<float> m_threshold;
+    bool m_softmax;
+    std::string m_argmax_score_column;
+    std::string m_argmax_index_column;
 
     // The minimum number of columns needed to extract the label data
     std::size_t m_min_col_count;
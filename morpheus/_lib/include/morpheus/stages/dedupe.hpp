@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"  // for MessageMeta
+
+#include <boost/fiber/context.hpp>
+#include <boost/fiber/future/future.hpp>
+#include <cudf/table/table.hpp>  // for table
+#include <mrc/node/rx_sink_base.hpp>
+#include <mrc/node/rx_source_base.hpp>
+#include <mrc/node/sink_properties.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <mrc/types.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>  // for apply, make_subscriber, observable_member, is_on_error<>::not_void, is_on_next_of<>::not_void, from
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+#include <cstddef>  // for size_t
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** DedupeStage********************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+/**
+ * @brief Drops rows whose key columns repeat, entirely on device. Within each batch the first occurrence of a key
+ * is kept in row order. When `window_size` is non-zero the stage additionally remembers the keys of the most
+ * recently emitted rows (up to `window_size` of them) in a device table, and rows whose keys were already seen in
+ * earlier batches are dropped as well via a hash anti-join. Batches left with no rows are suppressed entirely.
+ */
+class DedupeStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new Dedupe Stage object
+     *
+     * @param key_columns : Names of the columns which together identify a duplicate row.
+     * @param window_size : Number of recently emitted keys remembered across batches, 0 disables cross-batch
+     * deduplication.
+     */
+    DedupeStage(std::vector<std::string> key_columns, std::size_t window_size = 0);
+
+  private:
+    std::shared_ptr<MessageMeta> on_data(sink_type_t msg);
+
+    subscribe_fn_t build_operator();
+
+    std::vector<std::string> m_key_columns;
+    std::size_t m_window_size;
+
+    // Key columns of the most recently emitted rows, newest first so trimming to the window drops the oldest
+    std::unique_ptr<cudf::table> m_seen_keys;
+};
+
+/****** DedupeStageInterfaceProxy******************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct DedupeStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a DedupeStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param key_columns : Names of the columns which together identify a duplicate row.
+     * @param window_size : Number of recently emitted keys remembered across batches, 0 disables cross-batch
+     * deduplication.
+     * @return std::shared_ptr<mrc::segment::Object<DedupeStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<DedupeStage>> init(mrc::segment::Builder& builder,
+                                                                   const std::string& name,
+                                                                   std::vector<std::string> key_columns,
+                                                                   std::size_t window_size = 0);
+};
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
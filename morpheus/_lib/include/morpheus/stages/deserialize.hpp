@@ -20,9 +20,12 @@
 #include "morpheus/messages/control.hpp"
 #include "morpheus/messages/meta.hpp"
 #include "morpheus/messages/multi.hpp"
-#include "morpheus/types.hpp"                  // for TensorIndex
-#include "morpheus/utilities/python_util.hpp"  // for show_warning_message
-#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+#include "morpheus/types.hpp"                       // for TensorIndex
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/python_util.hpp"       // for show_warning_message
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
+#include "morpheus/utilities/string_util.hpp"       // for MORPHEUS_CONCAT_STR
 
 #include <glog/logging.h>
 #include <mrc/segment/builder.hpp>
@@ -55,13 +58,13 @@ using cm_task_t = std::pair<std::string, nlohmann::json>;
 void make_output_message(std::shared_ptr<MessageMeta>& incoming_message,
                          TensorIndex start,
                          TensorIndex stop,
-                         cm_task_t* task,
+                         ControlMessage* task_template,
                          std::shared_ptr<MultiMessage>& windowed_message);
 
 void make_output_message(std::shared_ptr<MessageMeta>& incoming_message,
                          TensorIndex start,
                          TensorIndex stop,
-                         cm_task_t* task,
+                         ControlMessage* task_template,
                          std::shared_ptr<ControlMessage>& windowed_message);
 
 /****** DeserializationStage********************************/
@@ -87,7 +90,16 @@ class DeserializeStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMe
       base_t(base_t::op_factory_from_sub_fn(build_operator())),
       m_batch_size(batch_size),
       m_ensure_sliceable_index(ensure_sliceable_index),
-      m_task(std::move(task)){};
+      m_task(std::move(task))
+    {
+        if (m_task)
+        {
+            // Compile the task definition into a template message once; each outgoing window clones the
+            // template, sharing the parsed task JSON copy-on-write instead of re-inserting it per message
+            m_task_template = std::make_shared<ControlMessage>();
+            m_task_template->add_task(m_task->first, m_task->second);
+        }
+    };
 
   private:
     subscribe_fn_t build_operator();
@@ -95,6 +107,7 @@ class DeserializeStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMe
     TensorIndex m_batch_size;
     bool m_ensure_sliceable_index{true};
     std::unique_ptr<cm_task_t> m_task{nullptr};
+    std::shared_ptr<ControlMessage> m_task_template{nullptr};
 };
 
 /****** DeserializationStageInterfaceProxy******************/
@@ -142,6 +155,10 @@ typename DeserializeStage<OutputT>::subscribe_fn_t DeserializeStage<OutputT>::bu
     return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
         return input.subscribe(rxcpp::make_observer<sink_type_t>(
             [this, &output](sink_type_t incoming_message) {
+                MORPHEUS_NVTX_RANGE("DeserializeStage::on_data");
+                MORPHEUS_STAGE_TIMER("DeserializeStage");
+                MORPHEUS_STAGE_MEMORY_SCOPE("DeserializeStage");
+
                 if (!incoming_message->has_sliceable_index())
                 {
                     if (m_ensure_sliceable_index)
@@ -165,14 +182,16 @@ typename DeserializeStage<OutputT>::subscribe_fn_t DeserializeStage<OutputT>::bu
                             PyExc_RuntimeWarning);
                     }
                 }
-                // Loop over the MessageMeta and create sub-batches
-                for (TensorIndex i = 0; i < incoming_message->count(); i += this->m_batch_size)
+                // Loop over the MessageMeta and create sub-batches. The row count is hoisted out of the loop
+                // so each emitted window is plain offset arithmetic against the shared meta
+                const auto num_rows = incoming_message->count();
+                for (TensorIndex i = 0; i < num_rows; i += this->m_batch_size)
                 {
                     std::shared_ptr<OutputT> windowed_message{nullptr};
                     make_output_message(incoming_message,
                                         i,
-                                        std::min(i + this->m_batch_size, incoming_message->count()),
-                                        m_task.get(),
+                                        std::min(i + this->m_batch_size, num_rows),
+                                        m_task_template.get(),
                                         windowed_message);
                     output.on_next(std::move(windowed_message));
                 }
@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"       // for MessageMeta
+#include "morpheus/objects/dtype.hpp"       // for TableSchema
+#include "morpheus/objects/file_types.hpp"  // for FileTypes
+
+#include <boost/fiber/context.hpp>
+#include <boost/fiber/future/future.hpp>
+#include <cudf/io/types.hpp>  // for table_with_metadata
+#include <mrc/node/rx_sink_base.hpp>
+#include <mrc/node/rx_source_base.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <mrc/types.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>  // for apply, make_subscriber, observable_member, is_on_error<>::not_void, is_on_next_of<>::not_void, from
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <deque>               // for deque
+#include <map>                 // for map
+#include <memory>
+#include <mutex>  // for mutex
+#include <optional>
+#include <string>
+#include <thread>  // for thread
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** DirectorySourceStage********************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+/**
+ * @brief Source stage that watches a spool directory and emits each dropped file as a MessageMeta.
+ *
+ * The directory is watched with inotify, so new files are picked up as soon as the writer closes them (or moves
+ * them into place) instead of on a polling interval. Files are parsed on a pool of worker threads via
+ * `load_table_from_file`, overlapping the loads, while emission stays in arrival order: a file's table is held
+ * back until every earlier file has been emitted. At most `queue_size` parsed tables are buffered at once, so a
+ * slow downstream bounds the memory footprint rather than the spool rate. Files which fail to parse are logged
+ * and skipped, and left in place for inspection regardless of `delete_files`.
+ */
+class DirectorySourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonSource<std::shared_ptr<MessageMeta>>;
+    using typename base_t::source_type_t;
+    using typename base_t::subscriber_fn_t;
+
+    /**
+     * @brief Construct a new Directory Source Stage object
+     *
+     * @param directory : Directory to watch for dropped files.
+     * @param num_threads : Number of parallel loader threads.
+     * @param queue_size : Maximum number of parsed tables buffered awaiting emission.
+     * @param process_existing : Whether files already present in the directory at startup are emitted (in
+     * lexical order) before watching begins.
+     * @param delete_files : Whether each file is removed after its message has been emitted.
+     * @param stop_after : Stop the source after emitting this many files, 0 runs until the pipeline stops.
+     * @param file_type : Format of the dropped files, `Auto` determines it per file from the extension; files
+     * whose extension is not recognized are ignored.
+     * @param columns : When non-empty, only parse/retain this column subset.
+     * @param schema : When non-empty, pins the dtype of each listed column, skipping per-file type inference.
+     */
+    DirectorySourceStage(std::string directory,
+                         std::size_t num_threads   = 4,
+                         std::size_t queue_size    = 8,
+                         bool process_existing     = true,
+                         bool delete_files         = false,
+                         std::size_t stop_after    = 0,
+                         FileTypes file_type       = FileTypes::Auto,
+                         std::vector<std::string> columns = {},
+                         TableSchema schema        = {});
+
+  private:
+    subscriber_fn_t build();
+
+    /**
+     * @brief Returns true when `filename` looks like a loadable spool file (not hidden/temporary, and with a
+     * recognized extension when the file type is `Auto`).
+     */
+    bool accepts_file(const std::string& filename) const;
+
+    /**
+     * @brief Loader thread body: pops pending paths, parses them and posts the tables for ordered emission.
+     */
+    void worker_loop();
+
+    std::string m_directory;
+    std::size_t m_num_threads;
+    std::size_t m_queue_size;
+    bool m_process_existing;
+    bool m_delete_files;
+    std::size_t m_stop_after;
+    FileTypes m_file_type;
+    std::vector<std::string> m_columns;
+    TableSchema m_schema;
+
+    // A parsed file awaiting ordered emission; the table is empty when the parse failed and the sequence number
+    // is skipped
+    struct LoadResult
+    {
+        std::optional<cudf::io::table_with_metadata> table;
+        std::string path;
+    };
+
+    // Shared between the watcher/emitter fiber and the loader threads. Paths queue up in arrival order in
+    // `m_pending`, loaders place finished tables into `m_results` keyed by sequence number, and the emitter
+    // consumes `m_emit_seq` strictly in order
+    std::mutex m_mutex;
+    std::condition_variable m_task_cv;
+    std::condition_variable m_result_cv;
+    std::deque<std::pair<std::size_t, std::string>> m_pending;
+    std::map<std::size_t, LoadResult> m_results;
+    std::size_t m_next_seq{0};
+    std::size_t m_emit_seq{0};
+    std::atomic<bool> m_stop{false};
+    std::vector<std::thread> m_workers;
+};
+
+/****** DirectorySourceStageInterfaceProxy******************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct DirectorySourceStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a DirectorySourceStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param directory : Directory to watch for dropped files.
+     * @param num_threads : Number of parallel loader threads.
+     * @param queue_size : Maximum number of parsed tables buffered awaiting emission.
+     * @param process_existing : Whether files already present at startup are emitted before watching begins.
+     * @param delete_files : Whether each file is removed after its message has been emitted.
+     * @param stop_after : Stop the source after emitting this many files, 0 runs until the pipeline stops.
+     * @param file_type : Format of the dropped files, `Auto` determines it per file from the extension.
+     * @param columns : When non-empty, only parse/retain this column subset.
+     * @param schema : When non-empty, pins the dtype of each listed column.
+     * @return std::shared_ptr<mrc::segment::Object<DirectorySourceStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<DirectorySourceStage>> init(mrc::segment::Builder& builder,
+                                                                            const std::string& name,
+                                                                            std::string directory,
+                                                                            std::size_t num_threads = 4,
+                                                                            std::size_t queue_size  = 8,
+                                                                            bool process_existing   = true,
+                                                                            bool delete_files       = false,
+                                                                            std::size_t stop_after  = 0,
+                                                                            FileTypes file_type = FileTypes::Auto,
+                                                                            std::vector<std::string> columns = {},
+                                                                            TableSchema schema = {});
+};
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"       // for MessageMeta
+#include "morpheus/objects/file_types.hpp"  // for FileTypes
+
+#include <boost/fiber/context.hpp>
+#include <boost/fiber/future/future.hpp>
+#include <cudf/table/table.hpp>  // for table
+#include <cudf/types.hpp>        // for size_type
+#include <mrc/node/rx_sink_base.hpp>
+#include <mrc/node/rx_source_base.hpp>
+#include <mrc/node/sink_properties.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <mrc/types.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>  // for apply, make_subscriber, observable_member, is_on_error<>::not_void, is_on_next_of<>::not_void, from
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+#include <chrono>      // for milliseconds, steady_clock
+#include <filesystem>  // for file_time_type
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** EnrichmentStage********************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+/**
+ * @brief Appends context columns to each batch via a device-resident lookup table. The lookup table is loaded once
+ * from a file (CSV/JSON/Parquet via `load_table_from_file`) and kept on device; each batch is matched against it
+ * with a single cudf left join on the key columns and the selected lookup columns are appended to the dataframe in
+ * place, with rows that found no match receiving nulls. Rows with duplicate keys in the lookup file are reduced to
+ * their first occurrence at load time so every event maps to exactly one context row.
+ *
+ * When `reload_interval_s` is non-zero the file's modification time is polled between batches at most that often,
+ * and a changed file is transparently reloaded, so the lookup data can be refreshed without restarting the
+ * pipeline.
+ */
+class EnrichmentStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new Enrichment Stage object
+     *
+     * @param filename : File holding the lookup table, any format `load_table_from_file` accepts.
+     * @param key_columns : Names of the join key columns, present in both the stream and the lookup table.
+     * @param columns : Lookup columns to append, an empty vector appends every non-key column.
+     * @param file_type : Format of the lookup file, `Auto` determines it from the extension.
+     * @param reload_interval_s : How often (in seconds) to poll the file's modification time for a hot reload, 0
+     * disables reloading.
+     */
+    EnrichmentStage(std::string filename,
+                    std::vector<std::string> key_columns,
+                    std::vector<std::string> columns = {},
+                    FileTypes file_type              = FileTypes::Auto,
+                    float reload_interval_s          = 0.0F);
+
+  private:
+    std::shared_ptr<MessageMeta> on_data(sink_type_t msg);
+
+    subscribe_fn_t build_operator();
+
+    /**
+     * @brief (Re)loads the lookup table from `m_filename` and resolves the key/payload column indices.
+     */
+    void load_lookup();
+
+    /**
+     * @brief Reloads the lookup table when the file's modification time has changed, polling at most once per
+     * `m_reload_interval`.
+     */
+    void maybe_reload();
+
+    std::string m_filename;
+    std::vector<std::string> m_key_columns;
+    std::vector<std::string> m_columns;
+    FileTypes m_file_type;
+    std::chrono::milliseconds m_reload_interval;
+
+    // Device-resident lookup table with distinct keys, plus the resolved positions of the key columns and of the
+    // payload columns appended to each batch
+    std::unique_ptr<cudf::table> m_lookup;
+    std::vector<cudf::size_type> m_lookup_key_indices;
+    std::vector<cudf::size_type> m_payload_indices;
+    std::vector<std::string> m_payload_names;
+
+    std::chrono::steady_clock::time_point m_last_check;
+    std::filesystem::file_time_type m_file_mtime;
+};
+
+/****** EnrichmentStageInterfaceProxy******************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct EnrichmentStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize an EnrichmentStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param filename : File holding the lookup table.
+     * @param key_columns : Names of the join key columns, present in both the stream and the lookup table.
+     * @param columns : Lookup columns to append, an empty list appends every non-key column.
+     * @param file_type : Format of the lookup file, `Auto` determines it from the extension.
+     * @param reload_interval_s : How often (in seconds) to poll the file's modification time for a hot reload, 0
+     * disables reloading.
+     * @return std::shared_ptr<mrc::segment::Object<EnrichmentStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<EnrichmentStage>> init(mrc::segment::Builder& builder,
+                                                                       const std::string& name,
+                                                                       std::string filename,
+                                                                       std::vector<std::string> key_columns,
+                                                                       std::vector<std::string> columns = {},
+                                                                       FileTypes file_type     = FileTypes::Auto,
+                                                                       float reload_interval_s = 0.0F);
+};
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
@@ -18,8 +18,11 @@
 #pragma once
 
 #include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/dtype.hpp"  // for TableSchema
 
 #include <boost/fiber/context.hpp>
+#include <cudf/io/types.hpp>     // for column_name_info
+#include <cudf/table/table.hpp>  // for table
 #include <boost/fiber/future/future.hpp>
 #include <mrc/node/rx_sink_base.hpp>
 #include <mrc/node/rx_source_base.hpp>
@@ -33,6 +36,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>  // for mutex
 #include <optional>
 #include <string>
 #include <thread>
@@ -66,15 +70,55 @@ class FileSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<MessageM
      * @param filename : Name of the file from which the messages will be read
      * @param repeat : Repeats the input dataset multiple times. Useful to extend small datasets for debugging
      * @param json_lines: Whether to force json or jsonlines parsing
+     * @param columns: When non-empty, only parse/retain this column subset. Lets downstream stages which consume a
+     * fixed set of columns (e.g. the FIL feature list) push their projection into the file parse.
+     * @param schema: When non-empty, pins the dtype of each listed column for the CSV/JSON parse, skipping cudf's
+     * type inference pass. Self-describing formats ignore it.
+     * @param sort_by: When non-empty, sort the parsed table by this key column on device before emitting, so
+     * downstream per-entity `get_slice` calls operate on contiguous runs instead of scattered rows.
+     * @param chunk_size_bytes: When non-zero, read the file in byte ranges of this size and emit one message per
+     * chunk, parsing the next range in the background while the current one is emitted. Downstream sees the first
+     * batch after one chunk parse instead of after the whole file, and device memory holds one chunk (plus the one
+     * being parsed) rather than the full table. Only CSV and line-delimited JSON can be chunked, `sort_by` then
+     * orders rows within each chunk only, and the range index restarts per chunk (as if each chunk were its own
+     * file). Incompatible with `repeat`.
      */
-    FileSourceStage(std::string filename, int repeat = 1, std::optional<bool> json_lines = std::nullopt);
+    FileSourceStage(std::string filename,
+                    int repeat                       = 1,
+                    std::optional<bool> json_lines   = std::nullopt,
+                    std::vector<std::string> columns = {},
+                    TableSchema schema               = {},
+                    std::string sort_by              = {},
+                    std::size_t chunk_size_bytes     = 0);
 
   private:
     subscriber_fn_t build();
 
+    /**
+     * @brief Emission loop for the chunked mode: parses fixed byte ranges, double-buffered so the next range
+     * parses while the current chunk is emitted.
+     */
+    void chunked_read(rxcpp::subscriber<source_type_t>& output);
+
+    /**
+     * @brief Returns the parsed file as a device table, parsing it on the first call and serving the cached snapshot
+     * afterwards. Repeats and pipeline re-runs burn no wall time re-parsing the file.
+     */
+    std::shared_ptr<const cudf::table> get_cached_table();
+
     std::string m_filename;
     int m_repeat{1};
     std::optional<bool> m_json_lines;
+    std::vector<std::string> m_columns;
+    TableSchema m_schema;
+    std::string m_sort_by;
+    std::size_t m_chunk_size_bytes{0};
+
+    // Parse-once cache shared by every subscription, the emitted messages receive device copies of the snapshot
+    std::mutex m_cache_mutex;
+    std::shared_ptr<const cudf::table> m_cached_table;
+    std::vector<cudf::io::column_name_info> m_cached_schema;
+    int m_index_col_count{0};
 };
 
 /****** FileSourceStageInterfaceProxy***********************/
@@ -91,13 +135,22 @@ struct FileSourceStageInterfaceProxy
      * @param filename : Name of the file from which the messages will be read.
      * @param repeat : Repeats the input dataset multiple times. Useful to extend small datasets for debugging.
      * @param parser_kwargs : Optional arguments to pass to the file parser.
+     * @param columns : When non-empty, only parse/retain this column subset.
+     * @param schema : When non-empty, pins the dtype of each listed column, skipping cudf's type inference pass.
+     * @param sort_by : When non-empty, sort the parsed table by this key column on device before emitting.
+     * @param chunk_size_bytes : When non-zero, read the file in byte ranges of this size, emitting one message
+     * per chunk while the next range parses in the background.
      * @return std::shared_ptr<mrc::segment::Object<FileSourceStage>>
      */
     static std::shared_ptr<mrc::segment::Object<FileSourceStage>> init(mrc::segment::Builder& builder,
                                                                        const std::string& name,
                                                                        std::string filename,
-                                                                       int repeat                   = 1,
-                                                                       pybind11::dict parser_kwargs = pybind11::dict());
+                                                                       int repeat                       = 1,
+                                                                       pybind11::dict parser_kwargs = pybind11::dict(),
+                                                                       std::vector<std::string> columns = {},
+                                                                       TableSchema schema               = {},
+                                                                       std::string sort_by              = {},
+                                                                       std::size_t chunk_size_bytes     = 0);
 };
 #pragma GCC visibility pop
 /** @} */  // end of group
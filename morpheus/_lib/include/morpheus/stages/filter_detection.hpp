@@ -74,6 +74,11 @@ namespace morpheus {
  * messages could be high (in the worst case scenario as high as half the number of records in the incoming message).
  * Depending on the downstream stages, this can cause performance issues, especially if those stages need to acquire
  * the Python GIL.
+ *
+ * Setting `mask_column` to a preallocated bool column enables a third, lazy mode which overrides `copy`: the stage
+ * writes the boolean mask into that column and forwards the message untouched, deferring the gather to a downstream
+ * `SerializeStage` configured with the same column. Surviving rows then move once, at write time, instead of being
+ * copied here and again by the serializer.
  */
 class FilterDetectionsStage
   : public mrc::pymrc::PythonNode<std::shared_ptr<MultiMessage>, std::shared_ptr<MultiMessage>>
@@ -92,8 +97,14 @@ class FilterDetectionsStage
      * @param filter_source : Indicate if the values used for filtering exist in either an output tensor
      * (`FilterSource::TENSOR`) or a column in a Dataframe (`FilterSource::DATAFRAME`).
      * @param field_name : Name of the tensor or Dataframe column to filter on default="probs"
+     * @param mask_column : When set, write the boolean mask into this preallocated bool column and forward the
+     * message unchanged instead of copying or slicing
      */
-    FilterDetectionsStage(float threshold, bool copy, FilterSource filter_source, std::string field_name = "probs");
+    FilterDetectionsStage(float threshold,
+                          bool copy,
+                          FilterSource filter_source,
+                          std::string field_name  = "probs",
+                          std::string mask_column = "");
 
   private:
     subscribe_fn_t build_operator();
@@ -104,6 +115,7 @@ class FilterDetectionsStage
     bool m_copy;
     FilterSource m_filter_source;
     std::string m_field_name;
+    std::string m_mask_column;
     std::size_t m_num_class_labels;
     std::map<std::size_t, std::string> m_idx2label;
 };
@@ -124,6 +136,8 @@ struct FilterDetectionStageInterfaceProxy
      * @param filter_source : Indicate if the values used for filtering exist in either an output tensor
      * (`FilterSource::TENSOR`) or a column in a Dataframe (`FilterSource::DATAFRAME`).
      * @param field_name : Name of the tensor or Dataframe column to filter on default="probs"
+     * @param mask_column : When set, write the boolean mask into this preallocated bool column and forward the
+     * message unchanged instead of copying or slicing
      * @return std::shared_ptr<mrc::segment::Object<FilterDetectionsStage>>
      */
     static std::shared_ptr<mrc::segment::Object<FilterDetectionsStage>> init(mrc::segment::Builder& builder,
@@ -131,7 +145,8 @@ struct FilterDetectionStageInterfaceProxy
                                                                              float threshold,
                                                                              bool copy,
                                                                              FilterSource filter_source,
-                                                                             std::string field_name);
+                                                                             std::string field_name,
+                                                                             std::string mask_column = "");
 };
 
 #pragma GCC visibility pop
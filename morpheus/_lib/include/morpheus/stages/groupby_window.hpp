@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"  // for MessageMeta
+
+#include <boost/fiber/context.hpp>
+#include <boost/fiber/future/future.hpp>
+#include <cudf/table/table.hpp>  // for table
+#include <mrc/node/rx_sink_base.hpp>
+#include <mrc/node/rx_source_base.hpp>
+#include <mrc/node/sink_properties.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <mrc/types.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>  // for apply, make_subscriber, observable_member, is_on_error<>::not_void, is_on_next_of<>::not_void, from
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int64_t
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** GroupbyWindowStage********************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+/**
+ * @brief Appends per-entity rolling-window feature columns (counts, sums, means, ...) computed entirely on device.
+ * For every row, each configured aggregation covers the rows sharing the row's group-key values whose timestamps
+ * fall within the trailing window — including rows from earlier batches, whose keys, timestamps and values are
+ * retained in a device history table and trimmed as they age out of the window. Aggregations run through cudf's
+ * grouped range rolling window, so a batch costs one sort of (history + batch) plus one fused kernel per feature.
+ */
+class GroupbyWindowStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    using aggregation_t = std::tuple<std::string, std::string, std::string>;
+
+    /**
+     * @brief Construct a new Groupby Window Stage object
+     *
+     * @param group_columns : Names of the columns identifying an entity.
+     * @param timestamp_column : Name of the timestamp (or monotonic integer) column ordering the rows.
+     * @param window : Length of the trailing window, in the resolution of `timestamp_column` (e.g. 300 for a
+     * 5-minute window over a seconds-resolution timestamp).
+     * @param aggregations : One `(value column, aggregation, output column)` tuple per feature to append.
+     * Supported aggregations: "count", "sum", "mean", "min", "max".
+     */
+    GroupbyWindowStage(std::vector<std::string> group_columns,
+                       std::string timestamp_column,
+                       int64_t window,
+                       std::vector<aggregation_t> aggregations);
+
+  private:
+    std::shared_ptr<MessageMeta> on_data(sink_type_t msg);
+
+    subscribe_fn_t build_operator();
+
+    std::vector<std::string> m_group_columns;
+    std::string m_timestamp_column;
+    int64_t m_window;
+    std::vector<std::string> m_value_columns;
+    std::vector<std::string> m_agg_kinds;
+    std::vector<std::string> m_output_columns;
+
+    // Keys, timestamps and values of rows still inside the window, layout [group columns..., timestamp, values...]
+    std::unique_ptr<cudf::table> m_history;
+};
+
+/****** GroupbyWindowStageInterfaceProxy******************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct GroupbyWindowStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a GroupbyWindowStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param group_columns : Names of the columns identifying an entity.
+     * @param timestamp_column : Name of the timestamp (or monotonic integer) column ordering the rows.
+     * @param window : Length of the trailing window, in the resolution of `timestamp_column`.
+     * @param aggregations : One `(value column, aggregation, output column)` tuple per feature to append.
+     * @return std::shared_ptr<mrc::segment::Object<GroupbyWindowStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<GroupbyWindowStage>> init(
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        std::vector<std::string> group_columns,
+        std::string timestamp_column,
+        int64_t window,
+        std::vector<GroupbyWindowStage::aggregation_t> aggregations);
+};
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
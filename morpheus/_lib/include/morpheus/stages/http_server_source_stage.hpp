@@ -18,6 +18,8 @@
 #pragma once
 
 #include "morpheus/messages/meta.hpp"          // for MessageMeta
+#include "morpheus/objects/dtype.hpp"          // for TableSchema
+#include "morpheus/utilities/edge_gauges.hpp"  // for EdgeGauge
 #include "morpheus/utilities/http_server.hpp"  // for HttpServer
 
 #include <boost/fiber/buffered_channel.hpp>  // for buffered_channel
@@ -46,7 +48,8 @@
 
 namespace morpheus {
 using table_t         = std::unique_ptr<cudf::io::table_with_metadata>;
-using request_queue_t = boost::fibers::buffered_channel<table_t>;
+using payload_t       = std::unique_ptr<std::string>;
+using request_queue_t = boost::fibers::buffered_channel<payload_t>;
 
 /****** Component public implementations *******************/
 /****** HttpServerSourceStage *************************************/
@@ -61,6 +64,17 @@ using request_queue_t = boost::fibers::buffered_channel<table_t>;
 
 // TODO(dagardner): optionally add headers to the dataframe
 
+/**
+ * @brief Source stage that receives HTTP POST bodies and emits them as MessageMeta.
+ *
+ * Raw request bodies are queued as-is by the server threads and coalesced by the reader: each emission drains
+ * the queue and performs a single read_json over the window, so burst traffic of small posts costs one parse
+ * per window instead of one per request. Malformed payloads are therefore detected (and logged) at window parse
+ * time rather than rejected per request.
+ *
+ * High-rate clients may upgrade the endpoint to a WebSocket and stream batches continuously over one connection,
+ * one batch per message, feeding the same accumulation queue without per-request HTTP overhead.
+ */
 class HttpServerSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<MessageMeta>>
 {
   public:
@@ -80,21 +94,31 @@ class HttpServerSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<Me
                           std::size_t max_payload_size         = DefaultMaxPayloadSize,
                           std::chrono::seconds request_timeout = std::chrono::seconds(30),
                           bool lines                           = false,
-                          std::size_t stop_after               = 0);
+                          std::size_t stop_after               = 0,
+                          bool reuse_port                      = false,
+                          TableSchema schema                   = {});
     ~HttpServerSourceStage() override;
 
     void close();
 
   private:
     subscriber_fn_t build();
+    table_t parse_payload(const std::string& payload) const;
     void source_generator(rxcpp::subscriber<source_type_t> subscriber);
 
     std::chrono::duration<float, std::milli> m_sleep_time;
     std::chrono::duration<long> m_queue_timeout;
     std::unique_ptr<HttpServer> m_server;
     request_queue_t m_queue;
+
+    // Depth/high-water/blocked-time of m_queue, the edge between the server threads and the reader
+    EdgeGauge& m_queue_gauge;
     std::size_t m_stop_after;
     std::size_t m_records_emitted;
+    bool m_lines;
+
+    // When non-empty, pins the column dtypes for the JSON parse, skipping cudf's per-window type inference
+    TableSchema m_schema;
 };
 
 /****** HttpServerSourceStageInterfaceProxy***********************/
@@ -117,7 +141,9 @@ struct HttpServerSourceStageInterfaceProxy
                                                                              std::size_t max_payload_size,
                                                                              int64_t request_timeout,
                                                                              bool lines,
-                                                                             std::size_t stop_after);
+                                                                             std::size_t stop_after,
+                                                                             bool reuse_port,
+                                                                             TableSchema schema = {});
 };
 #pragma GCC visibility pop
 /** @} */  // end of group
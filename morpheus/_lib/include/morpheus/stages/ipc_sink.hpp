@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/stages/ipc_transport.hpp"  // for ipc::SlotHeader
+
+#include <mrc/node/rx_sink_base.hpp>
+#include <mrc/node/rx_source_base.hpp>
+#include <mrc/node/sink_properties.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <mrc/types.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstddef>  // for size_t
+#include <memory>
+#include <string>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** IpcSinkStage ***************************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+/**
+ * @brief Hands `MessageMeta` instances to a co-located process through a POSIX shared-memory slot. Each table
+ * is laid out with `MessageMeta::pack` into one contiguous device allocation which is exported as a CUDA IPC
+ * handle; only the packed-column descriptors and column names go through the shared-memory segment, so the
+ * handoff never serializes, parses, or copies table data through the host. The counterpart `IpcSourceStage`
+ * in the peer process rebuilds an owning `MessageMeta` with identical contents, giving the pair the same
+ * semantics as an in-process edge. Messages also pass through downstream unchanged.
+ *
+ * The slot holds one message at a time: the next export waits until the importer acknowledges the previous
+ * one, which backpressures this pipeline the same way a full in-process channel would.
+ */
+class IpcSinkStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new IpcSinkStage object
+     *
+     * @param shm_name : Name of the shared-memory segment, must match the peer's `IpcSourceStage`. Created if
+     * it does not exist yet.
+     * @param shm_size : Size of the segment in bytes. Bounds the host-side transport form (descriptors plus
+     * column names) of a single table, not its device data. By default 1 MiB.
+     */
+    IpcSinkStage(std::string shm_name, std::size_t shm_size = 1024 * 1024);
+
+    ~IpcSinkStage() override;
+
+  private:
+    subscribe_fn_t build_operator();
+
+    /**
+     * @brief Map (creating if needed) the shared-memory segment.
+     */
+    void open_shm();
+
+    /**
+     * @brief Pack `msg` and publish it into the slot, waiting for the importer to release the previous one.
+     */
+    void export_message(sink_type_t& msg);
+
+    /**
+     * @brief Block until the importer has acknowledged the slot, then release the staged device allocation.
+     */
+    void wait_for_consumed();
+
+    void close();
+
+    std::string m_shm_name;
+    std::size_t m_shm_size;
+
+    int m_shm_fd{-1};
+    ipc::SlotHeader* m_header{nullptr};
+
+    // cudaMalloc'd export staging for the in-flight message, freed once the importer acknowledges. A plain
+    // CUDA allocation is used because IPC handles cannot be taken on pool sub-allocations
+    void* m_staging{nullptr};
+};
+
+/****** IpcSinkStageInterfaceProxy *************************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct IpcSinkStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize an IpcSinkStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param shm_name : Name of the shared-memory segment.
+     * @param shm_size : Size of the segment in bytes.
+     * @return std::shared_ptr<mrc::segment::Object<IpcSinkStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<IpcSinkStage>> init(mrc::segment::Builder& builder,
+                                                                    const std::string& name,
+                                                                    std::string shm_name,
+                                                                    std::size_t shm_size = 1024 * 1024);
+};
+
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/stages/ipc_transport.hpp"  // for ipc::SlotHeader
+
+#include <mrc/node/rx_sink_base.hpp>
+#include <mrc/node/rx_source_base.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <mrc/types.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int64_t
+#include <memory>
+#include <string>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** IpcSourceStage *************************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+/**
+ * @brief Receives `MessageMeta` instances published by an `IpcSinkStage` in a co-located process. For each
+ * slot the stage imports the peer's device allocation through its CUDA IPC handle, rebuilds an owning table
+ * with `MessageMeta::create_from_packed` (one device-to-device copy, nothing crosses the host), closes the
+ * handle and acknowledges the slot so the exporter can publish the next message. The emitted messages are
+ * indistinguishable from ones produced in-process.
+ */
+class IpcSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonSource<std::shared_ptr<MessageMeta>>;
+    using typename base_t::source_type_t;
+    using typename base_t::subscriber_fn_t;
+
+    /**
+     * @brief Construct a new IpcSourceStage object
+     *
+     * @param shm_name : Name of the shared-memory segment, must match the peer's `IpcSinkStage`. Created if
+     * it does not exist yet.
+     * @param shm_size : Size of the segment in bytes, must match the peer's. By default 1 MiB.
+     * @param poll_interval_us : How long to sleep between polls of an idle slot, by default 100us.
+     */
+    IpcSourceStage(std::string shm_name, std::size_t shm_size = 1024 * 1024, int64_t poll_interval_us = 100);
+
+    ~IpcSourceStage() override;
+
+  private:
+    subscriber_fn_t build();
+
+    /**
+     * @brief Map (creating if needed) the shared-memory segment.
+     */
+    void open_shm();
+
+    /**
+     * @brief Import the message currently in the slot and acknowledge it.
+     */
+    std::shared_ptr<MessageMeta> import_message();
+
+    void close();
+
+    std::string m_shm_name;
+    std::size_t m_shm_size;
+    int64_t m_poll_interval_us;
+
+    int m_shm_fd{-1};
+    ipc::SlotHeader* m_header{nullptr};
+};
+
+/****** IpcSourceStageInterfaceProxy ***********************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct IpcSourceStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize an IpcSourceStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param shm_name : Name of the shared-memory segment.
+     * @param shm_size : Size of the segment in bytes.
+     * @param poll_interval_us : How long to sleep between polls of an idle slot.
+     * @return std::shared_ptr<mrc::segment::Object<IpcSourceStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<IpcSourceStage>> init(mrc::segment::Builder& builder,
+                                                                      const std::string& name,
+                                                                      std::string shm_name,
+                                                                      std::size_t shm_size     = 1024 * 1024,
+                                                                      int64_t poll_interval_us = 100);
+};
+
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
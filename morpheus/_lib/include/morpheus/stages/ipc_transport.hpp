@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuda_runtime.h>  // for cudaIpcMemHandle_t
+
+#include <atomic>
+#include <cstdint>
+
+namespace morpheus::ipc {
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+// Single-slot handoff protocol shared by IpcSinkStage and IpcSourceStage. The exporter may write the slot in
+// EMPTY or CONSUMED, the importer may read it in READY; DONE tells the importer no further messages will come.
+enum class SlotState : uint32_t
+{
+    EMPTY = 0,
+    READY,
+    CONSUMED,
+    DONE,
+};
+
+constexpr uint32_t SLOT_MAGIC = 0x4D525048;  // 'MRPH'
+
+/**
+ * @brief Header at the start of the POSIX shared-memory segment. The table's host-side transport form (the
+ * `cudf::pack` descriptors followed by the newline-joined column names) is written immediately after the
+ * header; the device data never enters the segment, it travels as a CUDA IPC handle.
+ */
+struct SlotHeader
+{
+    uint32_t magic;
+    std::atomic<uint32_t> state;
+    cudaIpcMemHandle_t gpu_handle;
+    uint64_t gpu_size;        // Bytes behind gpu_handle
+    uint32_t metadata_size;   // Packed-column descriptor bytes following this header
+    uint32_t names_size;      // Newline-joined column names following the descriptors
+    int32_t index_col_count;  // Leading columns forming the table's index
+};
+
+/** @} */  // end of group
+}  // namespace morpheus::ipc
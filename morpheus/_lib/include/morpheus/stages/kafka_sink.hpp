@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/file_types.hpp"
+
+#include <librdkafka/rdkafkacpp.h>
+#include <mrc/node/rx_sink_base.hpp>
+#include <mrc/node/rx_source_base.hpp>
+#include <mrc/node/sink_properties.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <mrc/types.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int32_t
+#include <map>
+#include <memory>
+#include <string>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** KafkaSinkStage *************************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+/**
+ * @brief Write all messages to a Kafka topic. Each row of the incoming `MessageMeta` is serialized (JSON or CSV)
+ * and produced as one Kafka message. Messages are handed to librdkafka's batched producer, which lingers and
+ * coalesces them according to the producer configuration; the stage never blocks on broker acknowledgements
+ * except when the local produce queue is full.
+ */
+class KafkaSinkStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new Kafka Sink Stage object
+     *
+     * @param topic : Output kafka topic.
+     * @param config : Kafka producer configuration. `linger.ms`, `batch.num.messages` and
+     * `max.in.flight.requests.per.connection` control batching and the in-flight window.
+     * @param file_type : Serialization format for each row, `FileTypes::JSON` (the default) or `FileTypes::CSV`.
+     * @param include_index_col : Write out the index as a column, by default true.
+     * @param max_queue_retries : Number of times a produce call is retried with a short poll when the local queue
+     * is full before the row is dropped and logged.
+     */
+    KafkaSinkStage(std::string topic,
+                   std::map<std::string, std::string> config,
+                   FileTypes file_type         = FileTypes::JSON,
+                   bool include_index_col      = true,
+                   std::size_t max_queue_retries = 10);
+
+    ~KafkaSinkStage() override = default;
+
+  private:
+    subscribe_fn_t build_operator();
+
+    /**
+     * @brief Create the librdkafka producer from `m_config`.
+     */
+    std::unique_ptr<RdKafka::Producer> create_producer(RdKafka::DeliveryReportCb& delivery_cb);
+
+    /**
+     * @brief Serialize a message's table and produce one Kafka message per row (text formats) or one binary
+     * message per batch (ARROW).
+     */
+    void produce_message(RdKafka::Producer& producer, sink_type_t& msg);
+
+    /**
+     * @brief Produce a single payload, retrying with backoff while the local queue is full.
+     */
+    void produce_payload(RdKafka::Producer& producer, const std::string& payload);
+
+    std::string m_topic;
+    std::map<std::string, std::string> m_config;
+    FileTypes m_file_type;
+    bool m_include_index_col{true};
+    std::size_t m_max_queue_retries{10};
+};
+
+/****** KafkaSinkStageInterfaceProxy ***********************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct KafkaSinkStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a KafkaSinkStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param topic : Output kafka topic.
+     * @param config : Kafka producer configuration.
+     * @param file_type : Serialization format for each row.
+     * @param include_index_col : Write out the index as a column, by default true.
+     * @param max_queue_retries : Number of produce retries while the local queue is full.
+     * @return std::shared_ptr<mrc::segment::Object<KafkaSinkStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<KafkaSinkStage>> init(mrc::segment::Builder& builder,
+                                                                      const std::string& name,
+                                                                      std::string topic,
+                                                                      std::map<std::string, std::string> config,
+                                                                      FileTypes file_type           = FileTypes::JSON,
+                                                                      bool include_index_col        = true,
+                                                                      std::size_t max_queue_retries = 10);
+};
+
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
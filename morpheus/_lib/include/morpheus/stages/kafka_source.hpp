@@ -18,11 +18,13 @@
 #pragma once
 
 #include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/dtype.hpp"  // for TableSchema
 #include "morpheus/types.hpp"
 
 #include <boost/fiber/context.hpp>
 #include <boost/fiber/future/future.hpp>
 #include <cudf/io/types.hpp>
+#include <cudf/utilities/span.hpp>  // for host_span
 #include <librdkafka/rdkafkacpp.h>
 #include <mrc/node/rx_sink_base.hpp>
 #include <mrc/node/rx_source_base.hpp>
@@ -34,11 +36,14 @@
 #include <pymrc/node.hpp>
 #include <rxcpp/rx.hpp>  // for apply, make_subscriber, observable_member, is_on_error<>::not_void, is_on_next_of<>::not_void, trace_activity
 
-#include <cstddef>  // for size_t
-#include <cstdint>  // for uuint32_t
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <cstdint>             // for uuint32_t & int64_t
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>  // for mutex
 #include <optional>
 #include <string>
 #include <thread>
@@ -60,13 +65,61 @@ namespace morpheus {
 class KafkaOAuthCallback : public RdKafka::OAuthBearerTokenRefreshCb
 {
   public:
-    KafkaOAuthCallback(const std::function<std::map<std::string, std::string>()>& oauth_callback);
+    KafkaOAuthCallback(std::function<std::map<std::string, std::string>()> oauth_callback);
 
+    ~KafkaOAuthCallback() override;
+
+    /**
+     * @brief Hand the cached token to librdkafka. Only the very first invocation runs the Python callable
+     * synchronously; afterwards a background thread refreshes the cache before expiry, so this callback never
+     * blocks the consume thread on Python.
+     */
     void oauthbearer_token_refresh_cb(RdKafka::Handle* handle, const std::string& oauthbearer_config) override;
 
   private:
-    const std::function<std::map<std::string, std::string>()>& m_oauth_callback;
+    struct Token
+    {
+        std::string value;
+        std::int64_t expires_at_epoch_ms{0};
+    };
+
+    Token fetch_token() const;
+    void refresher_main();
+
+    std::function<std::map<std::string, std::string>()> m_oauth_callback;
+
+    // Cached token plus the background refresher keeping it warm, guarded by the mutex
+    std::mutex m_mutex;
+    std::condition_variable m_refresh_cv;
+    Token m_token;
+    bool m_stop{false};
+    std::thread m_refresher;
+};
+
+/**
+ * @brief Pre-parse filter evaluated on raw Kafka messages as they come off the consumer, before their payloads
+ * enter the batch buffer. Messages failing the filter are dropped without ever being JSON-parsed, so traffic
+ * addressed to other tenants or pipelines costs one header comparison instead of a GPU parse.
+ */
+struct KafkaMessageFilter
+{
+    // When non-empty, the message key must equal one of these values
+    std::vector<std::string> allowed_keys;
+
+    // Each entry must be present as a message header with exactly this value
+    std::map<std::string, std::string> required_headers;
+
+    /**
+     * @brief Whether the filter imposes no constraints, in which case evaluation is skipped entirely.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Evaluate the filter against the key and headers of a raw message.
+     */
+    bool matches(const RdKafka::Message& message) const;
 };
+
 /**
  * This class loads messages from the Kafka cluster by serving as a Kafka consumer.
  */
@@ -91,6 +144,20 @@ class KafkaSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<Message
      * @param stop_after : Stops ingesting after emitting `stop_after` records (rows in the table).
      * Useful for testing. Disabled if `0`
      * @param async_commits : Asynchronously acknowledge consuming Kafka messages
+     * @param consumer_pool_size : When greater than 1, fans consumption out across this many dedicated consume
+     * fibers, each driving its own Kafka consumer, feeding a shared conversion path. Per-partition ordering is
+     * preserved since the broker assigns each partition to exactly one consumer in the group.
+     * @param payload_compression : Compression codec of the message payloads ("none", "zstd", "gzip", "snappy" or
+     * "auto"). When set, each payload is treated as a complete compressed frame and decompressed on the device by
+     * the cudf reader ahead of the JSON parse, rather than on the host.
+     * @param payload_format : Encoding of the message payloads ("json" or "avro"). Avro payloads must be complete
+     * container frames and are decoded column-wise by the cudf Avro reader, skipping the JSON round trip.
+     * @param message_filter : Key/header predicate evaluated on each raw message before its payload enters the
+     * batch buffer. Non-matching messages are dropped pre-parse.
+     * @param schema : When non-empty, pins the dtype of each listed column for the JSON parse, skipping cudf's
+     * per-batch type inference pass (and the dtype flips it can produce between batches).
+     * @param sort_by : When non-empty, sort each emitted batch by this key column on device, so downstream
+     * per-entity `get_slice` calls operate on contiguous runs instead of scattered rows.
      */
     KafkaSourceStage(TensorIndex max_batch_size,
                      std::string topic,
@@ -100,7 +167,14 @@ class KafkaSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<Message
                      bool disable_pre_filtering                         = false,
                      std::size_t stop_after                             = 0,
                      bool async_commits                                 = true,
-                     std::unique_ptr<KafkaOAuthCallback> oauth_callback = nullptr);
+                     std::size_t consumer_pool_size                     = 1,
+                     std::string payload_compression                    = "none",
+                     std::string payload_format                         = "json",
+                     std::unique_ptr<KafkaOAuthCallback> oauth_callback = nullptr,
+                     std::vector<std::string> columns                   = {},
+                     KafkaMessageFilter message_filter                  = {},
+                     TableSchema schema                                 = {},
+                     std::string sort_by                                = {});
 
     /**
      * @brief Construct a new Kafka Source Stage object
@@ -116,6 +190,20 @@ class KafkaSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<Message
      * @param stop_after : Stops ingesting after emitting `stop_after` records (rows in the table).
      * Useful for testing. Disabled if `0`
      * @param async_commits : Asynchronously acknowledge consuming Kafka messages
+     * @param consumer_pool_size : When greater than 1, fans consumption out across this many dedicated consume
+     * fibers, each driving its own Kafka consumer, feeding a shared conversion path. Per-partition ordering is
+     * preserved since the broker assigns each partition to exactly one consumer in the group.
+     * @param payload_compression : Compression codec of the message payloads ("none", "zstd", "gzip", "snappy" or
+     * "auto"). When set, each payload is treated as a complete compressed frame and decompressed on the device by
+     * the cudf reader ahead of the JSON parse, rather than on the host.
+     * @param payload_format : Encoding of the message payloads ("json" or "avro"). Avro payloads must be complete
+     * container frames and are decoded column-wise by the cudf Avro reader, skipping the JSON round trip.
+     * @param message_filter : Key/header predicate evaluated on each raw message before its payload enters the
+     * batch buffer. Non-matching messages are dropped pre-parse.
+     * @param schema : When non-empty, pins the dtype of each listed column for the JSON parse, skipping cudf's
+     * per-batch type inference pass (and the dtype flips it can produce between batches).
+     * @param sort_by : When non-empty, sort each emitted batch by this key column on device, so downstream
+     * per-entity `get_slice` calls operate on contiguous runs instead of scattered rows.
      */
     KafkaSourceStage(TensorIndex max_batch_size,
                      std::vector<std::string> topics,
@@ -125,12 +213,22 @@ class KafkaSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<Message
                      bool disable_pre_filtering                         = false,
                      std::size_t stop_after                             = 0,
                      bool async_commits                                 = true,
-                     std::unique_ptr<KafkaOAuthCallback> oauth_callback = nullptr);
+                     std::size_t consumer_pool_size                     = 1,
+                     std::string payload_compression                    = "none",
+                     std::string payload_format                         = "json",
+                     std::unique_ptr<KafkaOAuthCallback> oauth_callback = nullptr,
+                     std::vector<std::string> columns                   = {},
+                     KafkaMessageFilter message_filter                  = {},
+                     TableSchema schema                                 = {},
+                     std::string sort_by                                = {});
 
     ~KafkaSourceStage() override = default;
 
     /**
-     * @return maximum batch size for KafkaSource.
+     * @return the current batch size target for KafkaSource. Adapts between a small floor and the configured
+     * maximum based on whether recent batches filled before the batch timeout: under-filled batches shrink the
+     * target for lower latency when caught up, full batches grow it so the GPU parse amortizes better while
+     * working through lag.
      */
     TensorIndex max_batch_size();
 
@@ -139,12 +237,47 @@ class KafkaSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<Message
      */
     uint32_t batch_timeout_ms();
 
+    /**
+     * @brief Source of raw messages driving the batch accumulation loop. Mirrors
+     * `RdKafka::KafkaConsumer::consume`: returns an owned message whose `err()` is `ERR__TIMED_OUT` when nothing
+     * arrived within `max_wait_ms`. Production consumption wraps a live consumer; benchmarks and tests can
+     * substitute a replay of canned message streams.
+     */
+    using consume_fn_t = std::function<std::unique_ptr<RdKafka::Message>(long max_wait_ms)>;
+
+    /**
+     * @brief Accumulate one batch of raw messages from `consume_fn`, honoring the batch timeout, the adaptive
+     * batch size target and the pre-parse message filter. This is the stage's real consume loop; it is public
+     * so a mock consumer can drive it without a broker.
+     *
+     * @param consume_fn : Callable handing back the next raw message, see `consume_fn_t`.
+     * @return std::vector<std::unique_ptr<RdKafka::Message>>
+     */
+    std::vector<std::unique_ptr<RdKafka::Message>> accumulate_batch(const consume_fn_t& consume_fn);
+
+    /**
+     * @brief This function combines JSON messages from Kafka, parses them, then loads them onto a MessageMeta.
+     * and returns the shared pointer as a result. Public for the same reason as `accumulate_batch`, the pair
+     * forms the stage's consume/process loop.
+     *
+     * @param message_batch : Reference of a message batch that needs to be processed.
+     * @return std::shared_ptr<morpheus::MessageMeta>
+     */
+    std::shared_ptr<morpheus::MessageMeta> process_batch(
+        std::vector<std::unique_ptr<RdKafka::Message>>&& message_batch);
+
   private:
     /**
      * TODO(Documentation)
      */
     subscriber_fn_t build();
 
+    /**
+     * @brief Variant of `build` used when `consumer_pool_size > 1`. Spawns a pool of consume fibers which
+     * accumulate message batches concurrently and hand them to a shared convert/emit loop over a buffered channel.
+     */
+    subscriber_fn_t build_pooled();
+
     /**
      * @brief Create kafka consumer configuration and returns unique pointer to the result.
      *
@@ -157,29 +290,42 @@ class KafkaSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<Message
      * @brief Creates Kafka consumer instance.
      *
      * @param rebalancer : Group rebalance callback for use with RdKafka::KafkaConsumer.
+     * @param offset_commit_cb : Optional callback invoked when asynchronous offset commits complete.
      * @return std::unique_ptr<RdKafka::KafkaConsumer>
      */
-    std::unique_ptr<RdKafka::KafkaConsumer> create_consumer(RdKafka::RebalanceCb& rebalancer);
+    std::unique_ptr<RdKafka::KafkaConsumer> create_consumer(RdKafka::RebalanceCb& rebalancer,
+                                                            RdKafka::OffsetCommitCb* offset_commit_cb = nullptr);
 
     /**
-     * @brief Load messages from a buffer/file to a cuDF table.
+     * @brief Parse a scatter/gather list of JSON-line buffers to a cuDF table without concatenating them on the
+     * host first.
      *
-     * @param buffer : Reference of a messages buffer
+     * @param buffers : Spans over the individual message payloads, which must remain valid for the duration of the
+     * call.
      * @return cudf::io::table_with_metadata
      */
-    cudf::io::table_with_metadata load_table(const std::string& buffer);
+    cudf::io::table_with_metadata load_table(const std::vector<cudf::host_span<const std::byte>>& buffers);
 
     /**
-     * @brief This function combines JSON messages from Kafka, parses them, then loads them onto a MessageMeta.
-     * and returns the shared pointer as a result.
+     * @brief Decode a batch of Avro container frames to a single cuDF table. The reader is driven by the schema
+     * embedded in each frame, so no JSON text is produced or re-parsed along the way.
      *
-     * @param message_batch : Reference of a message batch that needs to be processed.
-     * @return std::shared_ptr<morpheus::MessageMeta>
+     * @param message_batch : Reference of a message batch whose payloads are Avro container frames.
+     * @return cudf::io::table_with_metadata
      */
-    std::shared_ptr<morpheus::MessageMeta> process_batch(
-        std::vector<std::unique_ptr<RdKafka::Message>>&& message_batch);
+    cudf::io::table_with_metadata load_table_avro(const std::vector<std::unique_ptr<RdKafka::Message>>& message_batch);
+
+    /**
+     * @brief Adjust the batch size target from the outcome of the latest consume step. A batch which hit the
+     * target doubles it (lag is building), one which filled less than half of the target halves it (caught up),
+     * bounded by [s_min_batch_size, max_batch_size].
+     *
+     * @param consumed_count : Number of messages in the batch just consumed.
+     */
+    void adapt_batch_size(std::size_t consumed_count);
 
     TensorIndex m_max_batch_size{128};
+    std::atomic<TensorIndex> m_batch_size_target{128};
     uint32_t m_batch_timeout_ms{100};
 
     std::vector<std::string> m_topics;
@@ -190,6 +336,13 @@ class KafkaSourceStage : public mrc::pymrc::PythonSource<std::shared_ptr<Message
     bool m_requires_commit{false};  // Whether or not manual committing is required
     bool m_async_commits{true};
     std::size_t m_stop_after{0};
+    std::size_t m_consumer_pool_size{1};
+    cudf::io::compression_type m_payload_compression{cudf::io::compression_type::NONE};
+    bool m_payload_is_avro{false};
+    std::vector<std::string> m_columns;
+    KafkaMessageFilter m_message_filter;
+    TableSchema m_schema;
+    std::string m_sort_by;
 
     void* m_rebalancer;
 
@@ -219,6 +372,15 @@ struct KafkaSourceStageInterfaceProxy
      * Useful for testing. Disabled if `0`
      * @param async_commits : Asynchronously acknowledge consuming Kafka messages
      * @param oauth_callback : Callback used when an OAuth token needs to be generated.
+     * @param columns : When non-empty, retain only this column subset after parsing each payload batch. Lets
+     * downstream stages which consume a fixed set of columns push their projection into the source.
+     * @param header_filter : When non-empty, each entry must be present as a message header with exactly this
+     * value for the message to be kept. Evaluated pre-parse on the raw message.
+     * @param key_filter : When non-empty, the message key must equal one of these values for the message to be
+     * kept. Evaluated pre-parse on the raw message.
+     * @param schema : When non-empty, pins the dtype of each listed column for the JSON parse, skipping cudf's
+     * per-batch type inference pass.
+     * @param sort_by : When non-empty, sort each emitted batch by this key column on device.
      */
     static std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> init_with_single_topic(
         mrc::segment::Builder& builder,
@@ -231,7 +393,15 @@ struct KafkaSourceStageInterfaceProxy
         bool disable_pre_filtering,
         std::size_t stop_after                           = 0,
         bool async_commits                               = true,
-        std::optional<pybind11::function> oauth_callback = std::nullopt);
+        std::size_t consumer_pool_size                   = 1,
+        std::string payload_compression                  = "none",
+        std::string payload_format                       = "json",
+        std::optional<pybind11::function> oauth_callback = std::nullopt,
+        std::vector<std::string> columns                 = {},
+        std::map<std::string, std::string> header_filter = {},
+        std::vector<std::string> key_filter              = {},
+        TableSchema schema                               = {},
+        std::string sort_by                              = {});
 
     /**
      * @brief Create and initialize a KafkaSourceStage, and return the result
@@ -250,6 +420,15 @@ struct KafkaSourceStageInterfaceProxy
      * Useful for testing. Disabled if `0`
      * @param async_commits : Asynchronously acknowledge consuming Kafka messages
      * @param oauth_callback : Callback used when an OAuth token needs to be generated.
+     * @param columns : When non-empty, retain only this column subset after parsing each payload batch. Lets
+     * downstream stages which consume a fixed set of columns push their projection into the source.
+     * @param header_filter : When non-empty, each entry must be present as a message header with exactly this
+     * value for the message to be kept. Evaluated pre-parse on the raw message.
+     * @param key_filter : When non-empty, the message key must equal one of these values for the message to be
+     * kept. Evaluated pre-parse on the raw message.
+     * @param schema : When non-empty, pins the dtype of each listed column for the JSON parse, skipping cudf's
+     * per-batch type inference pass.
+     * @param sort_by : When non-empty, sort each emitted batch by this key column on device.
      */
     static std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> init_with_multiple_topics(
         mrc::segment::Builder& builder,
@@ -262,7 +441,15 @@ struct KafkaSourceStageInterfaceProxy
         bool disable_pre_filtering,
         std::size_t stop_after                           = 0,
         bool async_commits                               = true,
-        std::optional<pybind11::function> oauth_callback = std::nullopt);
+        std::size_t consumer_pool_size                   = 1,
+        std::string payload_compression                  = "none",
+        std::string payload_format                       = "json",
+        std::optional<pybind11::function> oauth_callback = std::nullopt,
+        std::vector<std::string> columns                 = {},
+        std::map<std::string, std::string> header_filter = {},
+        std::vector<std::string> key_filter              = {},
+        TableSchema schema                               = {},
+        std::string sort_by                              = {});
 
   private:
     /**
@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/multi_inference.hpp"
+#include "morpheus/messages/multi_response.hpp"  // for MultiResponseMessage
+#include "morpheus/types.hpp"                    // for TensorIndex
+#include "morpheus/utilities/buffer_pool.hpp"    // for BufferPool
+
+#include <boost/fiber/context.hpp>
+#include <boost/fiber/future/future.hpp>
+#include <mrc/node/rx_sink_base.hpp>
+#include <mrc/node/rx_source_base.hpp>
+#include <mrc/node/sink_properties.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <mrc/types.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <cstdint>  // for uint64_t
+#include <map>
+#include <memory>
+#include <random>  // for mt19937_64
+#include <string>
+#include <thread>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** MockInferenceClientStage****************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+/**
+ * @brief Stand-in for `InferenceClientStage` which echoes correctly-shaped output tensors after a synthetic
+ * model delay, without a Triton server. Occupies the same pipeline slot (`MultiInferenceMessage` in,
+ * `MultiResponseMessage` out), so the stages around inference run exactly as they would in production: the
+ * measured pipeline throughput with this stage is the pipeline overhead, and the gap to a run against a live
+ * server is the model time. The latency distribution is configurable, letting deployments be capacity-planned
+ * against a model's published latency profile before the model exists.
+ */
+class MockInferenceClientStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<MultiInferenceMessage>, std::shared_ptr<MultiResponseMessage>>
+{
+  public:
+    using base_t =
+        mrc::pymrc::PythonNode<std::shared_ptr<MultiInferenceMessage>, std::shared_ptr<MultiResponseMessage>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new Mock Inference Client Stage object
+     *
+     * @param outputs : Output tensor name to per-row width. Each message is answered with one float32 tensor of
+     * shape `{mess_count, width}` per entry, zero-filled on device.
+     * @param latency_mean_ms : Mean of the synthetic per-batch model latency, `0` answers immediately.
+     * @param latency_stddev_ms : Spread (jitter) of the synthetic latency around the mean, `0` is deterministic.
+     * @param distribution : Shape of the latency distribution, one of `"constant"`, `"normal"` or
+     * `"lognormal"`. Lognormal matches the heavy right tail real inference servers exhibit under load.
+     * @param seed : Seed for the latency sampler, `0` seeds from the system entropy source. Fixing it makes
+     * benchmark runs reproducible.
+     */
+    MockInferenceClientStage(std::map<std::string, TensorIndex> outputs,
+                             double latency_mean_ms   = 0.0,
+                             double latency_stddev_ms = 0.0,
+                             std::string distribution = "lognormal",
+                             std::uint64_t seed       = 0);
+
+  private:
+    /**
+     * @brief Sample one synthetic model latency in milliseconds.
+     */
+    double sample_latency_ms();
+
+    subscribe_fn_t build_operator();
+
+    std::map<std::string, TensorIndex> m_outputs;
+    double m_latency_mean_ms;
+    double m_latency_stddev_ms;
+    std::string m_distribution;
+
+    std::mt19937_64 m_rng;
+
+    // Lognormal parameters derived once from the requested mean and stddev
+    double m_lognormal_mu{0.0};
+    double m_lognormal_sigma{0.0};
+
+    // Recycles the per-batch output buffers exactly as the real client stage does, so the mock's allocation
+    // behaviour matches what the benchmark is standing in for
+    std::shared_ptr<BufferPool> m_buffer_pool{BufferPool::create()};
+};
+
+/****** MockInferenceClientStageInterfaceProxy**************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MockInferenceClientStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a MockInferenceClientStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param outputs : Output tensor name to per-row width, echoed as zero-filled float32 tensors.
+     * @param latency_mean_ms : Mean of the synthetic per-batch model latency, `0` answers immediately.
+     * @param latency_stddev_ms : Spread (jitter) of the synthetic latency around the mean.
+     * @param distribution : One of `"constant"`, `"normal"` or `"lognormal"`.
+     * @param seed : Seed for the latency sampler, `0` seeds from the system entropy source.
+     * @return std::shared_ptr<mrc::segment::Object<MockInferenceClientStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<MockInferenceClientStage>> init(
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        std::map<std::string, TensorIndex> outputs,
+        double latency_mean_ms   = 0.0,
+        double latency_stddev_ms = 0.0,
+        std::string distribution = "lognormal",
+        std::uint64_t seed       = 0);
+};
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,194 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/messages/multi.hpp"
+#include "morpheus/types.hpp"  // for TensorIndex
+
+#include <mrc/node/sink_properties.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // for hash
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>  // for move
+
+namespace morpheus {
+#pragma GCC visibility push(default)
+namespace {
+/**
+ * @brief Returns the number of dataframe rows carried by the message, used by the monitor stage to count rows
+ * without checking out a TableInfo.
+ */
+//@{
+inline TensorIndex row_count(const std::shared_ptr<morpheus::MessageMeta>& msg)
+{
+    return msg->count();
+}
+
+inline TensorIndex row_count(const std::shared_ptr<morpheus::MultiMessage>& msg)
+{
+    return msg->mess_count;
+}
+}  // namespace
+
+// Number of counter shards, must be a power of two. One shard per progress-engine thread would be ideal, but a
+// small fixed pool keyed by thread id keeps the stage allocation-free while still avoiding shared-line contention.
+constexpr std::size_t MonitorShardCount = 8;
+
+/**
+ * @brief A single cache line of counters. Writers use relaxed atomics so the per-message cost is a pair of
+ * uncontended increments; any ordering between the counters is only established by the polling reader.
+ */
+struct alignas(64) MonitorCounterShard
+{
+    std::atomic<std::uint64_t> message_count{0};
+    std::atomic<std::uint64_t> row_count{0};
+};
+
+/****** Component public implementations *******************/
+/****** MonitorStage ********************************/
+/* Pass-through stage that counts messages and rows as they flow by, cheap enough to stay enabled in production.
+ * Counts are written to sharded per-thread counters on the hot path and only aggregated when polled through
+ * `get_stats`. In the Python bindings the stage is bound as `MonitorMessageMetaStage` and
+ * `MonitorMultiMessageStage`.
+ */
+template <typename MessageT>
+class MonitorStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageT>, std::shared_ptr<MessageT>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageT>, std::shared_ptr<MessageT>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    MonitorStage(std::string description);
+
+    /**
+     * @brief Aggregates the counter shards and returns cumulative counts along with rates derived from the time
+     * elapsed since the stage was constructed. Keys: `message_count`, `row_count`, `seconds_elapsed`,
+     * `messages_per_sec`, `rows_per_sec`.
+     */
+    std::map<std::string, double> get_stats() const;
+
+  private:
+    subscribe_fn_t build_operator();
+    MonitorCounterShard& local_shard();
+
+    std::string m_description;
+    std::array<MonitorCounterShard, MonitorShardCount> m_shards;
+    std::chrono::steady_clock::time_point m_start_time;
+};
+
+/****** MonitorStageInterfaceProxy******************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+template <typename MessageT>
+struct MonitorStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a MonitorStage, and return the result.
+     */
+    static std::shared_ptr<mrc::segment::Object<MonitorStage<MessageT>>> init(mrc::segment::Builder& builder,
+                                                                              const std::string& name,
+                                                                              std::string description);
+
+    static std::map<std::string, double> get_stats(mrc::segment::Object<MonitorStage<MessageT>>& self);
+};
+
+template <typename MessageT>
+MonitorStage<MessageT>::MonitorStage(std::string description) :
+  base_t(base_t::op_factory_from_sub_fn(build_operator())),
+  m_description(std::move(description)),
+  m_start_time(std::chrono::steady_clock::now())
+{}
+
+template <typename MessageT>
+MonitorCounterShard& MonitorStage<MessageT>::local_shard()
+{
+    const auto shard_idx = std::hash<std::thread::id>{}(std::this_thread::get_id()) & (MonitorShardCount - 1);
+
+    return m_shards[shard_idx];
+}
+
+template <typename MessageT>
+std::map<std::string, double> MonitorStage<MessageT>::get_stats() const
+{
+    std::uint64_t message_count = 0;
+    std::uint64_t row_count     = 0;
+
+    for (const auto& shard : m_shards)
+    {
+        message_count += shard.message_count.load(std::memory_order_relaxed);
+        row_count += shard.row_count.load(std::memory_order_relaxed);
+    }
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start_time).count();
+
+    return {{"message_count", static_cast<double>(message_count)},
+            {"row_count", static_cast<double>(row_count)},
+            {"seconds_elapsed", elapsed},
+            {"messages_per_sec", elapsed > 0 ? static_cast<double>(message_count) / elapsed : 0.0},
+            {"rows_per_sec", elapsed > 0 ? static_cast<double>(row_count) / elapsed : 0.0}};
+}
+
+template <typename MessageT>
+typename MonitorStage<MessageT>::subscribe_fn_t MonitorStage<MessageT>::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t x) {
+                auto& shard = this->local_shard();
+                shard.message_count.fetch_add(1, std::memory_order_relaxed);
+                shard.row_count.fetch_add(static_cast<std::uint64_t>(row_count(x)), std::memory_order_relaxed);
+
+                output.on_next(std::move(x));
+            },
+            [&](std::exception_ptr error_ptr) { output.on_error(error_ptr); },
+            [&]() { output.on_completed(); }));
+    };
+}
+
+template <typename MessageT>
+std::shared_ptr<mrc::segment::Object<MonitorStage<MessageT>>> MonitorStageInterfaceProxy<MessageT>::init(
+    mrc::segment::Builder& builder, const std::string& name, std::string description)
+{
+    return builder.construct_object<MonitorStage<MessageT>>(name, std::move(description));
+}
+
+template <typename MessageT>
+std::map<std::string, double> MonitorStageInterfaceProxy<MessageT>::get_stats(
+    mrc::segment::Object<MonitorStage<MessageT>>& self)
+{
+    return self.object().get_stats();
+}
+#pragma GCC visibility pop
+}  // namespace morpheus
@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"  // for MessageMeta
+
+#include <boost/fiber/context.hpp>
+#include <boost/fiber/future/future.hpp>
+#include <cudf/strings/regex/regex_program.hpp>  // for regex_program
+#include <mrc/node/rx_sink_base.hpp>
+#include <mrc/node/rx_source_base.hpp>
+#include <mrc/node/sink_properties.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <mrc/types.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** PrefilterStage********************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+/**
+ * @brief Drops rows matching cheap device-side predicates before they reach the inference leg. Each predicate is
+ * a `(column, op, value)` tuple; comparison ops (`eq`, `ne`, `lt`, `le`, `gt`, `ge`) evaluate against a scalar of
+ * the column's type (value ranges are a `ge` plus a `le` on the same column) and `matches`/`not_matches` run a
+ * compiled regex over a string column. Rows whose predicates combine true (`all` of them, or `any` of them) are
+ * removed on device in a single stream-compaction pass and never pay for tokenization or the model; batches left
+ * with no rows are suppressed entirely. Regex programs and scalars are built once at construction.
+ */
+class PrefilterStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    using predicate_t = std::tuple<std::string, std::string, std::string>;
+
+    /**
+     * @brief Construct a new Prefilter Stage object
+     *
+     * @param predicates : One `(column, op, value)` tuple per condition. `op` is one of `eq`, `ne`, `lt`, `le`,
+     * `gt`, `ge`, `matches` or `not_matches`; for the comparison ops `value` is parsed to the column's type, for
+     * the regex ops it is the pattern.
+     * @param combine : How the predicate results combine into the drop decision, `"all"` drops rows matching
+     * every predicate, `"any"` drops rows matching at least one.
+     */
+    PrefilterStage(const std::vector<predicate_t>& predicates, std::string combine = "all");
+
+  private:
+    std::shared_ptr<MessageMeta> on_data(sink_type_t msg);
+
+    subscribe_fn_t build_operator();
+
+    std::vector<std::string> m_columns;
+    std::vector<std::string> m_ops;
+    std::vector<std::string> m_values;
+    bool m_combine_all{true};
+
+    // Compiled once per regex predicate, empty entries for the comparison ops
+    std::vector<std::unique_ptr<cudf::strings::regex_program>> m_programs;
+};
+
+/****** PrefilterStageInterfaceProxy******************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct PrefilterStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a PrefilterStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param predicates : One `(column, op, value)` tuple per condition.
+     * @param combine : `"all"` drops rows matching every predicate, `"any"` rows matching at least one.
+     * @return std::shared_ptr<mrc::segment::Object<PrefilterStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<PrefilterStage>> init(
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        const std::vector<PrefilterStage::predicate_t>& predicates,
+        std::string combine = "all");
+};
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
@@ -20,6 +20,7 @@
 #include "morpheus/messages/multi.hpp"
 #include "morpheus/messages/multi_inference.hpp"
 #include "morpheus/objects/table_info.hpp"
+#include "morpheus/utilities/buffer_pool.hpp"  // for BufferPool
 
 #include <boost/fiber/context.hpp>
 #include <boost/fiber/future/future.hpp>
@@ -71,16 +72,28 @@ class PreprocessFILStage
      */
     PreprocessFILStage(const std::vector<std::string>& features);
 
+    /**
+     * @brief Returns the feature columns this stage consumes. Pipeline builders can push this list into a source's
+     * column projection so the remaining input columns are never parsed.
+     */
+    const std::vector<std::string>& get_feature_columns() const
+    {
+        return m_fea_cols;
+    }
+
   private:
     /**
      * TODO(Documentation)
      */
     subscribe_fn_t build_operator();
 
-    TableInfo fix_bad_columns(sink_type_t x);
+    TableInfo fix_bad_columns(const sink_type_t& x);
 
     std::vector<std::string> m_fea_cols;
     std::string m_vocab_file;
+
+    // Recycles the packed input buffers across batches, their size is stable for a given pipeline
+    std::shared_ptr<BufferPool> m_buffer_pool{BufferPool::create()};
 };
 
 /****** PreprocessFILStageInferenceProxy********************/
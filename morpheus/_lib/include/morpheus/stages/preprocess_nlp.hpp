@@ -19,6 +19,8 @@
 
 #include "morpheus/messages/multi.hpp"
 #include "morpheus/messages/multi_inference.hpp"
+#include "morpheus/types.hpp"                   // for TensorIndex
+#include "morpheus/utilities/buffer_pool.hpp"  // for BufferPool
 
 #include <boost/fiber/context.hpp>
 #include <boost/fiber/future/future.hpp>
@@ -80,14 +82,26 @@ class PreprocessNLPStage
      * equal to stride there are no duplicated-id tokens. If stride is 80% of max_length, 20% of the first sequence will
      * be repeated on the second sequence and so on until the entire sentence is encoded.
      * @param column : Name of the string column to operate on, defaults to "data".
+     * @param chunk_size : When greater than zero and `truncation` is enabled, tokenize the input in slices of this
+     * many rows and assemble the output tensors incrementally, bounding peak scratch memory for large batches. A
+     * value of zero tokenizes each batch in a single call.
+     * @param dedupe : When true and `truncation` is enabled, tokenize only the distinct strings in each batch and
+     * expand the token tensors back to the original row order. Effective on repetitive inputs such as security
+     * logs, where most rows are byte-identical.
+     * @param warmup_rows : When greater than zero, tokenize a dummy batch of this many rows during construction.
+     * This pays the vocabulary load, the cudf/nvtext kernel module loads and the RMM pool growth at pipeline build
+     * time instead of on the first real batch.
      */
     PreprocessNLPStage(std::string vocab_hash_file,
                        uint32_t sequence_length,
                        bool truncation,
                        bool do_lower_case,
                        bool add_special_token,
-                       int stride         = -1,
-                       std::string column = "data");
+                       int stride              = -1,
+                       std::string column      = "data",
+                       TensorIndex chunk_size  = 0,
+                       bool dedupe             = false,
+                       TensorIndex warmup_rows = 0);
 
   private:
     /**
@@ -95,6 +109,11 @@ class PreprocessNLPStage
      */
     subscribe_fn_t build_operator();
 
+    /**
+     * @brief Run a dummy batch of `m_warmup_rows` rows through the tokenizer path, discarding the results
+     */
+    void warmup();
+
     std::string m_vocab_hash_file;
     std::string m_column;
     uint32_t m_sequence_length;
@@ -102,6 +121,12 @@ class PreprocessNLPStage
     bool m_do_lower_case;
     bool m_add_special_token;
     int m_stride{-1};
+    TensorIndex m_chunk_size{0};
+    bool m_dedupe{false};
+    TensorIndex m_warmup_rows{0};
+
+    // Recycles the fixed-shape output buffers (token ids, masks, seq_ids) across batches
+    std::shared_ptr<BufferPool> m_buffer_pool{BufferPool::create()};
 };
 
 /****** PreprocessNLPStageInferenceProxy********************/
@@ -129,6 +154,15 @@ struct PreprocessNLPStageInterfaceProxy
      * equal to stride there are no duplicated-id tokens. If stride is 80% of max_length, 20% of the first sequence will
      * be repeated on the second sequence and so on until the entire sentence is encoded.
      * @param column : Name of the string column to operate on, defaults to "data".
+     * @param chunk_size : When greater than zero and `truncation` is enabled, tokenize the input in slices of this
+     * many rows and assemble the output tensors incrementally, bounding peak scratch memory for large batches. A
+     * value of zero tokenizes each batch in a single call.
+     * @param dedupe : When true and `truncation` is enabled, tokenize only the distinct strings in each batch and
+     * expand the token tensors back to the original row order. Effective on repetitive inputs such as security
+     * logs, where most rows are byte-identical.
+     * @param warmup_rows : When greater than zero, tokenize a dummy batch of this many rows during construction.
+     * This pays the vocabulary load, the cudf/nvtext kernel module loads and the RMM pool growth at pipeline build
+     * time instead of on the first real batch.
      * @return std::shared_ptr<mrc::segment::Object<PreprocessNLPStage>>
      */
     static std::shared_ptr<mrc::segment::Object<PreprocessNLPStage>> init(mrc::segment::Builder& builder,
@@ -138,8 +172,11 @@ struct PreprocessNLPStageInterfaceProxy
                                                                           bool truncation,
                                                                           bool do_lower_case,
                                                                           bool add_special_token,
-                                                                          int stride         = -1,
-                                                                          std::string column = "data");
+                                                                          int stride              = -1,
+                                                                          std::string column      = "data",
+                                                                          TensorIndex chunk_size  = 0,
+                                                                          bool dedupe             = false,
+                                                                          TensorIndex warmup_rows = 0);
 };
 #pragma GCC visibility pop
 /** @} */  // end of group
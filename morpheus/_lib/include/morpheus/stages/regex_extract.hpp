@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"  // for MessageMeta
+#include "morpheus/objects/dtype.hpp"  // for TypeId
+
+#include <boost/fiber/context.hpp>
+#include <boost/fiber/future/future.hpp>
+#include <cudf/strings/regex/regex_program.hpp>  // for regex_program
+#include <mrc/node/rx_sink_base.hpp>
+#include <mrc/node/rx_source_base.hpp>
+#include <mrc/node/sink_properties.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <mrc/types.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>  // for apply, make_subscriber, observable_member, is_on_error<>::not_void, is_on_next_of<>::not_void, from
+// IWYU pragma: no_include "rxcpp/sources/rx-iterate.hpp"
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** RegexExtractStage********************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+/**
+ * @brief Runs compiled extraction patterns against a raw-line string column on device and appends the captures as
+ * typed columns, replacing the pandas-based parsers in `morpheus/parsers` for the hot path. Each extraction is a
+ * `(column, pattern, type)` tuple: the first capture group of `pattern` becomes column `column`, cast to `type`.
+ * Rows the pattern does not match yield nulls. The patterns are compiled once at construction and reused for every
+ * batch.
+ */
+class RegexExtractStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    using extraction_t = std::tuple<std::string, std::string, TypeId>;
+
+    /**
+     * @brief Construct a new Regex Extract Stage object
+     *
+     * @param input_column : Name of the string column holding the raw lines.
+     * @param extractions : One `(output column, regex pattern, output type)` tuple per column to extract. Each
+     * pattern must contain at least one capture group, the first group supplies the column's values.
+     */
+    RegexExtractStage(std::string input_column, const std::vector<extraction_t>& extractions);
+
+  private:
+    std::shared_ptr<MessageMeta> on_data(sink_type_t msg);
+
+    subscribe_fn_t build_operator();
+
+    std::string m_input_column;
+    std::vector<std::string> m_output_columns;
+    std::vector<TypeId> m_output_types;
+    std::vector<std::unique_ptr<cudf::strings::regex_program>> m_programs;
+};
+
+/****** RegexExtractStageInterfaceProxy******************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct RegexExtractStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a RegexExtractStage, and return the result
+     *
+     * @param builder : Pipeline context object reference
+     * @param name : Name of a stage reference
+     * @param input_column : Name of the string column holding the raw lines.
+     * @param extractions : One `(output column, regex pattern, output type)` tuple per column to extract.
+     * @return std::shared_ptr<mrc::segment::Object<RegexExtractStage>>
+     */
+    static std::shared_ptr<mrc::segment::Object<RegexExtractStage>> init(
+        mrc::segment::Builder& builder,
+        const std::string& name,
+        std::string input_column,
+        const std::vector<RegexExtractStage::extraction_t>& extractions);
+};
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
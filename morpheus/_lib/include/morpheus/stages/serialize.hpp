@@ -70,10 +70,14 @@ class SerializeStage : public mrc::pymrc::PythonNode<std::shared_ptr<MultiMessag
      * @param exclude : Attributes that are not required send to downstream stage.
      * @param fixed_columns : When `True` `SerializeStage` will assume that the Dataframe in all messages contain
      * the same columns as the first message received.
+     * @param filter_mask_column : When set, apply the boolean mask held in this column (written by an upstream
+     * `FilterDetectionsStage` in lazy mode) in a single gather, emitting only the surviving rows. The mask column
+     * itself is dropped from the output.
      */
     SerializeStage(const std::vector<std::string>& include,
                    const std::vector<std::string>& exclude,
-                   bool fixed_columns = true);
+                   bool fixed_columns             = true,
+                   std::string filter_mask_column = "");
 
   private:
     void make_regex_objs(const std::vector<std::string>& regex_strs, std::vector<std::regex>& regex_objs);
@@ -84,14 +88,20 @@ class SerializeStage : public mrc::pymrc::PythonNode<std::shared_ptr<MultiMessag
 
     bool exclude_column(const std::string& column) const;
 
+    void update_column_selection(sink_type_t& msg);
+
     std::shared_ptr<SlicedMessageMeta> get_meta(sink_type_t& msg);
 
+    std::shared_ptr<MessageMeta> apply_mask(sink_type_t& msg);
+
     subscribe_fn_t build_operator();
 
     bool m_fixed_columns;
+    std::string m_filter_mask_column;
     std::vector<std::regex> m_include;
     std::vector<std::regex> m_exclude;
     std::vector<std::string> m_column_names;
+    std::vector<std::string> m_cached_schema;
 };
 
 /****** WriteToFileStageInterfaceProxy******************/
@@ -109,13 +119,16 @@ struct SerializeStageInterfaceProxy
      * @param exclude : Reference to the attributes that are not required send to downstream stage.
      * @param fixed_columns : When `True` `SerializeStage` will assume that the Dataframe in all messages contain
      * the same columns as the first message received.
+     * @param filter_mask_column : When set, apply the boolean mask held in this column in a single gather,
+     * emitting only the surviving rows.
      * @return std::shared_ptr<mrc::segment::Object<SerializeStage>>
      */
     static std::shared_ptr<mrc::segment::Object<SerializeStage>> init(mrc::segment::Builder& builder,
                                                                       const std::string& name,
                                                                       const std::vector<std::string>& include,
                                                                       const std::vector<std::string>& exclude,
-                                                                      bool fixed_columns = true);
+                                                                      bool fixed_columns             = true,
+                                                                      std::string filter_mask_column = "");
 };
 
 #pragma GCC visibility pop
@@ -0,0 +1,174 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/messages/multi.hpp"
+
+#include <mrc/node/sink_properties.hpp>
+#include <mrc/node/source_properties.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <pymrc/node.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>  // for int64_t
+#include <memory>
+#include <string>
+#include <utility>  // for move
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** TriggerStage ********************************/
+
+/**
+ * @addtogroup stages
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+
+/**
+ * @brief Merges a buffered window of messages into as few messages as possible.
+ *
+ * The `MessageMeta` overload concatenates all of the buffered tables into a single `MessageMeta` with one
+ * cudf::concatenate call. The `MultiMessage` overload merges runs of adjacent messages that view contiguous row
+ * ranges of the same `MessageMeta`; messages that cannot be merged without a gather are passed through unchanged.
+ */
+//@{
+std::vector<std::shared_ptr<MessageMeta>> merge_buffered_messages(std::vector<std::shared_ptr<MessageMeta>>&& buffered);
+std::vector<std::shared_ptr<MultiMessage>> merge_buffered_messages(
+    std::vector<std::shared_ptr<MultiMessage>>&& buffered);
+//@}
+
+/**
+ * @brief Buffers up to `max_batch_size` messages or `max_latency_ms` milliseconds of input, then emits the window
+ * merged into as few messages as possible.
+ *
+ * The buffer is preallocated to `max_batch_size` entries and reused between windows, so steady-state operation is
+ * allocation free. The latency threshold is evaluated when a message arrives and when the stream completes; an idle
+ * stream therefore holds a partial window until the next message or shutdown rather than waking a timer. In the
+ * Python bindings the stage is bound as `TriggerMessageMetaStage` and `TriggerMultiMessageStage`.
+ */
+template <typename MessageT>
+class TriggerStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageT>, std::shared_ptr<MessageT>>
+{
+  public:
+    using base_t = mrc::pymrc::PythonNode<std::shared_ptr<MessageT>, std::shared_ptr<MessageT>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    TriggerStage(std::size_t max_batch_size, std::chrono::milliseconds max_latency);
+
+  private:
+    subscribe_fn_t build_operator();
+    void flush(rxcpp::subscriber<source_type_t>& output);
+
+    std::size_t m_max_batch_size;
+    std::chrono::milliseconds m_max_latency;
+    std::vector<sink_type_t> m_buffer;
+    std::chrono::steady_clock::time_point m_window_start;
+};
+
+/****** TriggerStageInterfaceProxy******************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+template <typename MessageT>
+struct TriggerStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a TriggerStage, and return the result.
+     */
+    static std::shared_ptr<mrc::segment::Object<TriggerStage<MessageT>>> init(mrc::segment::Builder& builder,
+                                                                              const std::string& name,
+                                                                              std::size_t max_batch_size,
+                                                                              int64_t max_latency_ms);
+};
+
+template <typename MessageT>
+TriggerStage<MessageT>::TriggerStage(std::size_t max_batch_size, std::chrono::milliseconds max_latency) :
+  base_t(base_t::op_factory_from_sub_fn(build_operator())),
+  m_max_batch_size(max_batch_size),
+  m_max_latency(max_latency)
+{
+    m_buffer.reserve(m_max_batch_size);
+}
+
+template <typename MessageT>
+void TriggerStage<MessageT>::flush(rxcpp::subscriber<source_type_t>& output)
+{
+    if (m_buffer.empty())
+    {
+        return;
+    }
+
+    auto merged = merge_buffered_messages(std::move(m_buffer));
+
+    // Moved-from, reclaim the window's capacity for the next one
+    m_buffer.clear();
+    m_buffer.reserve(m_max_batch_size);
+
+    for (auto& msg : merged)
+    {
+        output.on_next(std::move(msg));
+    }
+}
+
+template <typename MessageT>
+typename TriggerStage<MessageT>::subscribe_fn_t TriggerStage<MessageT>::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t x) {
+                if (m_buffer.empty())
+                {
+                    m_window_start = std::chrono::steady_clock::now();
+                }
+
+                m_buffer.emplace_back(std::move(x));
+
+                if (m_buffer.size() >= m_max_batch_size ||
+                    std::chrono::steady_clock::now() - m_window_start >= m_max_latency)
+                {
+                    this->flush(output);
+                }
+            },
+            [&](std::exception_ptr error_ptr) { output.on_error(error_ptr); },
+            [this, &output]() {
+                this->flush(output);
+                output.on_completed();
+            }));
+    };
+}
+
+template <typename MessageT>
+std::shared_ptr<mrc::segment::Object<TriggerStage<MessageT>>> TriggerStageInterfaceProxy<MessageT>::init(
+    mrc::segment::Builder& builder, const std::string& name, std::size_t max_batch_size, int64_t max_latency_ms)
+{
+    return builder.construct_object<TriggerStage<MessageT>>(
+        name, max_batch_size, std::chrono::milliseconds(max_latency_ms));
+}
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
@@ -21,6 +21,7 @@
 #include "morpheus/messages/multi_response.hpp"  // for MultiResponseMessage
 #include "morpheus/objects/triton_in_out.hpp"
 #include "morpheus/types.hpp"
+#include "morpheus/utilities/buffer_pool.hpp"  // for BufferPool
 
 #include <boost/fiber/context.hpp>
 #include <boost/fiber/future/future.hpp>
@@ -71,8 +72,12 @@ class InferenceClientStage
      * @brief Construct a new Inference Client Stage object
      *
      * @param model_name : Name of the model specifies which model can handle the inference requests that are sent to
-     * Triton inference
-     * @param server_url : Triton server URL.
+     * Triton inference. A comma-separated list of model names enables ensemble mode: the input tensors are staged
+     * once and fanned out to every model concurrently, and each model's outputs land in the response memory under
+     * `<model>.<output>` tensor names. Ensemble models must share the same input signature; hedging and shared
+     * memory apply to single-model stages only.
+     * @param server_url : Triton server URL, or a comma-separated list of replica URLs. The first replica is the
+     * primary; the others only receive hedged requests.
      * @param force_convert_inputs : Instructs the stage to convert the incoming data to the same format that Triton is
      * expecting. If set to False, data will only be converted if it would not result in the loss of data.
      * @param use_shared_memory : Whether or not to use CUDA Shared IPC Memory for transferring data to Triton. Using
@@ -80,13 +85,33 @@ class InferenceClientStage
      * @param needs_logits : Determines if logits are required.
      * @param inout_mapping : Dictionary used to map pipeline input/output names to Triton input/output names. Use this
      * if the Morpheus names do not match the model.
+     * @param max_in_flight : Number of mini-batch inference requests allowed in flight at once. Requests are issued
+     * asynchronously and completed in submission order, so responses stay ordered regardless of the window size.
+     * Forced to 1 when `use_shared_memory` is enabled, since the staging regions are reused between batches.
+     * @param hedge_quantile : When multiple replica URLs are given (comma-separated in `server_url`), a request
+     * slower than this quantile of recent request latencies is re-issued to the next replica and the first
+     * response wins. Set to 0 (the default) to disable hedging.
+     * @param warmup_rows : When greater than zero, prime the per-batch buffer pools during construction at the
+     * shapes a batch of this many rows will use. The model handshake already happens at construction; this
+     * additionally moves the first-batch allocations to pipeline build time so steady-state reuse applies from
+     * message one.
      */
     InferenceClientStage(std::string model_name,
                          std::string server_url,
                          bool force_convert_inputs,
                          bool use_shared_memory,
                          bool needs_logits,
-                         std::map<std::string, std::string> inout_mapping = {});
+                         std::map<std::string, std::string> inout_mapping = {},
+                         std::size_t max_in_flight                        = 1,
+                         double hedge_quantile                            = 0.0,
+                         TensorIndex warmup_rows                          = 0);
+
+    /**
+     * @brief Drop every cached model spec. Model metadata and config are resolved once per server+model and shared
+     * across stage instances and reconnects; call this after a model is redeployed with a different signature so
+     * the next connection re-resolves it.
+     */
+    static void reset_model_cache();
 
   private:
     /**
@@ -99,6 +124,11 @@ class InferenceClientStage
      */
     void connect_with_server();
 
+    /**
+     * @brief Acquire and retire pool buffers at the shapes a batch of `m_warmup_rows` rows will use
+     */
+    void warmup();
+
     /**
      * TODO(Documentation)
      */
@@ -110,13 +140,28 @@ class InferenceClientStage
     bool m_use_shared_memory;
     bool m_needs_logits{true};
     std::map<std::string, std::string> m_inout_mapping;
+    std::size_t m_max_in_flight{1};
+    std::vector<std::string> m_server_urls;
+    double m_hedge_quantile{0.0};
+    TensorIndex m_warmup_rows{0};
+    std::vector<std::string> m_model_names;
 
     // Below are settings created during handshake with server
     // std::shared_ptr<triton::client::InferenceServerHttpClient> m_client;
     std::vector<TritonInOut> m_model_inputs;
     std::vector<TritonInOut> m_model_outputs;
+    // `m_model_outputs` grouped per ensemble model; single-model stages have one group
+    std::vector<std::vector<TritonInOut>> m_outputs_by_model;
     triton::client::InferOptions m_options;
+    // One InferOptions per ensemble model, the first entry matches `m_options`
+    std::vector<triton::client::InferOptions> m_model_options;
     TensorIndex m_max_batch_size{-1};
+
+    // Recycles the per-batch output buffers, their shapes repeat across batches
+    std::shared_ptr<BufferPool> m_buffer_pool{BufferPool::create()};
+
+    // Recycles the pinned host buffers the responses are staged through before their upload to the device
+    std::shared_ptr<BufferPool> m_pinned_pool{BufferPool::create_pinned()};
 };
 
 /****** InferenceClientStageInferenceProxy******************/
@@ -140,6 +185,9 @@ struct InferenceClientStageInterfaceProxy
      * @param needs_logits : Determines if logits are required.
      * @param inout_mapping : Dictionary used to map pipeline input/output names to Triton input/output names. Use this
      * if the Morpheus names do not match the model.
+     * @param max_in_flight : Number of mini-batch inference requests allowed in flight at once.
+     * @param warmup_rows : When greater than zero, prime the per-batch buffer pools during construction at the
+     * shapes a batch of this many rows will use.
      * @return std::shared_ptr<mrc::segment::Object<InferenceClientStage>>
      */
     static std::shared_ptr<mrc::segment::Object<InferenceClientStage>> init(
@@ -150,7 +198,10 @@ struct InferenceClientStageInterfaceProxy
         bool force_convert_inputs,
         bool use_shared_memory,
         bool needs_logits,
-        std::map<std::string, std::string> inout_mapping);
+        std::map<std::string, std::string> inout_mapping,
+        std::size_t max_in_flight = 1,
+        double hedge_quantile     = 0.0,
+        TensorIndex warmup_rows   = 0);
 };
 #pragma GCC visibility pop
 /** @} */  // end of group
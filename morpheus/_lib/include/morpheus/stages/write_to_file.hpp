@@ -19,6 +19,7 @@
 
 #include "morpheus/messages/meta.hpp"
 #include "morpheus/objects/file_types.hpp"
+#include "morpheus/utilities/edge_gauges.hpp"  // for EdgeGauge
 
 #include <boost/fiber/context.hpp>
 #include <boost/fiber/future/future.hpp>
@@ -32,14 +33,30 @@
 #include <pymrc/node.hpp>
 #include <rxcpp/rx.hpp>
 
+#include <chrono>              // for seconds, steady_clock
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <deque>
+#include <exception>  // for exception_ptr
 #include <fstream>
 #include <functional>  // for function
 #include <map>
 #include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
 #include <string>
 #include <thread>
 #include <vector>
 
+namespace arrow::io {
+class FileOutputStream;
+}  // namespace arrow::io
+
+namespace arrow::ipc {
+class RecordBatchWriter;
+}  // namespace arrow::ipc
+
 namespace morpheus {
 /****** Component public implementations *******************/
 /****** WriteToFileStage********************************/
@@ -51,9 +68,214 @@ namespace morpheus {
  */
 
 #pragma GCC visibility push(default)
+/**
+ * @brief Stream buffer which performs the actual writes on a background thread. Serialization fills one buffer while
+ * the writer thread drains another; at most `max_pending` filled buffers may be queued before the producer blocks, so
+ * a disk hiccup is absorbed by the queue instead of stalling the upstream immediately. Flushing the owning ostream
+ * drains the queue and flushes the sink, restoring synchronous semantics where durability is requested.
+ */
+class AsyncWriteStreambuf : public std::streambuf
+{
+  public:
+    /**
+     * @brief Construct a new streambuf writing to `sink` from a background thread.
+     *
+     * @param sink : Stream the writer thread drains into, must outlive this object
+     * @param buffer_size : Size of each fill buffer
+     * @param max_pending : Bound on the number of filled buffers queued ahead of the writer thread
+     */
+    AsyncWriteStreambuf(std::ostream& sink, std::size_t buffer_size = 1UL << 20, std::size_t max_pending = 2);
+
+    ~AsyncWriteStreambuf() override;
+
+    /**
+     * @brief Drain all queued buffers and stop the writer thread, rethrowing any error the writer hit. Called by the
+     * destructor if not called explicitly.
+     */
+    void close();
+
+  protected:
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char* data, std::streamsize count) override;
+    int sync() override;
+
+  private:
+    struct Buffer
+    {
+        std::string data;
+        std::size_t size{0};
+    };
+
+    void enqueue_current();
+    void worker_loop();
+
+    std::ostream& m_sink;
+    std::size_t m_buffer_size;
+    std::size_t m_max_pending;
+
+    // Fill buffer the put area points into
+    std::string m_current;
+
+    std::mutex m_mutex;
+    std::condition_variable m_work_ready;
+    std::condition_variable m_work_done;
+    std::deque<Buffer> m_pending;
+    std::vector<std::string> m_free_buffers;
+    EdgeGauge& m_gauge;
+    bool m_writing{false};
+    bool m_closed{false};
+    std::exception_ptr m_error;
+
+    std::thread m_writer;
+};
+
+/**
+ * @brief Stream buffer which zstd-compresses its input on a pool of background threads. Serialization fills one
+ * buffer while the workers compress the previously filled ones, each filled buffer becoming an independent zstd
+ * frame; concatenated frames form a valid .zst stream, so the frames are written to `sink` in fill order and the
+ * result decompresses as one file. At most `max_pending` filled buffers may be queued ahead of the workers before
+ * the producer blocks, bounding memory the same way `AsyncWriteStreambuf` does. Flushing the owning ostream drains
+ * the pool and flushes the sink.
+ */
+class ZstdCompressStreambuf : public std::streambuf
+{
+  public:
+    /**
+     * @brief Construct a new streambuf compressing into `sink` from a pool of background threads.
+     *
+     * @param sink : Stream the compressed frames are written to, must outlive this object
+     * @param level : zstd compression level
+     * @param num_threads : Number of compression worker threads
+     * @param buffer_size : Size of each fill buffer, and therefore of each compressed frame's input
+     * @param max_pending : Bound on the number of filled buffers queued ahead of the workers
+     */
+    ZstdCompressStreambuf(std::ostream& sink,
+                          int level               = 3,
+                          std::size_t num_threads = 2,
+                          std::size_t buffer_size = 1UL << 20,
+                          std::size_t max_pending = 4);
+
+    ~ZstdCompressStreambuf() override;
+
+    /**
+     * @brief Compress and write all queued buffers and stop the workers, rethrowing any error a worker hit. Called
+     * by the destructor if not called explicitly.
+     */
+    void close();
+
+  protected:
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char* data, std::streamsize count) override;
+    int sync() override;
+
+  private:
+    struct Job
+    {
+        std::string data;
+        std::size_t size{0};
+        std::size_t sequence{0};
+    };
+
+    void enqueue_current();
+    void worker_loop();
+
+    std::ostream& m_sink;
+    int m_level;
+    std::size_t m_buffer_size;
+    std::size_t m_max_pending;
+
+    // Fill buffer the put area points into
+    std::string m_current;
+
+    std::mutex m_mutex;
+    std::condition_variable m_work_ready;
+    std::condition_variable m_work_done;
+    std::deque<Job> m_pending;
+    std::vector<std::string> m_free_buffers;
+    EdgeGauge& m_gauge;
+    std::size_t m_next_sequence{0};  // sequence assigned to the next filled buffer
+    std::size_t m_next_write{0};     // sequence the sink expects next, keeps the frames in fill order
+    bool m_closed{false};
+    std::exception_ptr m_error;
+
+    std::vector<std::thread> m_workers;
+};
+
+/**
+ * @brief Stream buffer backing a rotating set of output files. Bytes are written to an in-progress part file which
+ * is atomically renamed to `<stem>-<sequence><extension>` when it reaches the size or age limit (and on close), so a
+ * downstream log shipper only ever sees complete parts and never races the writer. When `use_o_direct` is set the
+ * part files are written with `O_DIRECT` through an aligned staging buffer, keeping bulk sink output from polluting
+ * the page cache of co-located readers; without it the part's pages are dropped from the cache as each part is
+ * finished.
+ */
+class RotatingFileSink : public std::streambuf
+{
+  public:
+    /**
+     * @brief Construct a new rotating sink.
+     *
+     * @param filename : Base path, parts are named `<stem>-<sequence><extension>` beside it
+     * @param max_bytes : Rotate once a part reaches this size, `0` disables size-based rollover
+     * @param max_age : Rotate once a part has been open this long, `0` disables time-based rollover
+     * @param use_o_direct : Write the parts with `O_DIRECT` and aligned buffers
+     */
+    RotatingFileSink(std::string filename,
+                     std::size_t max_bytes,
+                     std::chrono::seconds max_age = std::chrono::seconds(0),
+                     bool use_o_direct            = false);
+
+    ~RotatingFileSink() override;
+
+    /**
+     * @brief Returns true once the current part has hit the size or age limit.
+     */
+    bool should_rotate() const;
+
+    /**
+     * @brief Finish the current part, atomically rename it into place and open the next one.
+     */
+    void rotate();
+
+    /**
+     * @brief Finish and rename the current part. Called by the destructor if not called explicitly.
+     */
+    void close();
+
+  protected:
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char* data, std::streamsize count) override;
+    int sync() override;
+
+  private:
+    void open_part();
+    void finish_part();
+    void write_bytes(const char* data, std::size_t size);
+    void write_fd(const char* data, std::size_t size);
+
+    std::string m_filename;
+    std::size_t m_max_bytes;
+    std::chrono::seconds m_max_age;
+    bool m_use_o_direct;
+
+    int m_fd{-1};
+    std::size_t m_part_bytes{0};
+    std::size_t m_next_sequence{0};
+    std::chrono::steady_clock::time_point m_part_start;
+
+    // O_DIRECT staging: writes leave through this page-aligned buffer in whole-block multiples, the unaligned tail
+    // is written once when the part is finished
+    std::unique_ptr<char, void (*)(void*)> m_staging;
+    std::size_t m_staged{0};
+};
+
 /**
  * @brief Write all messages to a file. Messages are written to a file by this class.
  * This class does not maintain an open file or buffer messages.
+ *
+ * A filename ending in `.zst` (e.g. `results.jsonlines.zst`) enables inline zstd compression: the content format
+ * comes from the inner extension and the bytes are compressed on a background worker pool before they reach the
+ * file, so the sink emits `.zst` directly without adding latency to the message path.
  */
 class WriteToFileStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMeta>, std::shared_ptr<MessageMeta>>
 {
@@ -71,12 +293,18 @@ class WriteToFileStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMe
      * @param file_type : FileTypes
      * @param include_index_col : Write out the index as a column, by default true
      * @param flush : When `true` flush the output buffer to disk on each message.
+     * @param max_file_size : When non-zero, rotate the output file once it reaches this many bytes
+     * @param rotate_period : When non-zero, rotate the output file once it has been open this long
+     * @param use_o_direct : Write rotated parts with `O_DIRECT` and aligned buffers, bypassing the page cache
      */
     WriteToFileStage(const std::string& filename,
-                     std::ios::openmode mode = std::ios::out,
-                     FileTypes file_type     = FileTypes::Auto,
-                     bool include_index_col  = true,
-                     bool flush              = false);
+                     std::ios::openmode mode            = std::ios::out,
+                     FileTypes file_type                = FileTypes::Auto,
+                     bool include_index_col             = true,
+                     bool flush                         = false,
+                     std::size_t max_file_size          = 0,
+                     std::chrono::seconds rotate_period = std::chrono::seconds(0),
+                     bool use_o_direct                  = false);
 
   private:
     /**
@@ -105,12 +333,43 @@ class WriteToFileStage : public mrc::pymrc::PythonNode<std::shared_ptr<MessageMe
      */
     void write_parquet(sink_type_t& msg);
 
+    /**
+     * @brief Write messages (rows in a DataFrame) to an Arrow IPC file, one record batch per message
+     *
+     * @param msg
+     */
+    void write_arrow(sink_type_t& msg);
+
     subscribe_fn_t build_operator();
 
     bool m_is_first{};
     bool m_include_index_col;
     bool m_flush;
+    std::string m_filename;
     std::ofstream m_fstream;
+
+    // Set in rotating mode instead of m_fstream, parts are finished and renamed between messages
+    std::unique_ptr<RotatingFileSink> m_rotating_sink;
+    std::unique_ptr<std::ostream> m_rotating_stream;
+
+    // The serializers write through this double-buffered stream, the file writes happen on its background thread
+    std::unique_ptr<AsyncWriteStreambuf> m_async_buf;
+    std::unique_ptr<std::ostream> m_async_stream;
+
+    // Set instead of m_async_buf for '.zst' output, the compression workers also perform the file writes
+    std::unique_ptr<ZstdCompressStreambuf> m_zstd_buf;
+    std::unique_ptr<std::ostream> m_zstd_stream;
+
+    // Whichever of the two streams above the serializers write through
+    std::ostream* m_out_stream{nullptr};
+
+    // The Arrow writer owns the output file, m_fstream stays closed for `FileTypes::ARROW`. The writer is created
+    // lazily since the IPC schema is only known once the first message arrives
+    std::shared_ptr<arrow::io::FileOutputStream> m_arrow_sink;
+    std::shared_ptr<arrow::ipc::RecordBatchWriter> m_arrow_writer;
+
+    // Scratch buffer reused by the chunked JSON serializer, grows once to the steady-state chunk size
+    std::string m_json_buffer;
     std::function<void(sink_type_t&)> m_write_func;
 };
 
@@ -130,15 +389,21 @@ struct WriteToFileStageInterfaceProxy
      * @param file_type : FileTypes
      * @param include_index_col : Write out the index as a column, by default true
      * @param flush : When `true` flush the output buffer to disk on each message.
+     * @param max_file_size : When non-zero, rotate the output file once it reaches this many bytes
+     * @param rotate_period_s : When non-zero, rotate the output file once it has been open this many seconds
+     * @param use_o_direct : Write rotated parts with `O_DIRECT` and aligned buffers, bypassing the page cache
      * @return std::shared_ptr<mrc::segment::Object<WriteToFileStage>>
      */
     static std::shared_ptr<mrc::segment::Object<WriteToFileStage>> init(mrc::segment::Builder& builder,
                                                                         const std::string& name,
                                                                         const std::string& filename,
-                                                                        const std::string& mode = "w",
-                                                                        FileTypes file_type     = FileTypes::Auto,
-                                                                        bool include_index_col  = true,
-                                                                        bool flush              = false);
+                                                                        const std::string& mode   = "w",
+                                                                        FileTypes file_type       = FileTypes::Auto,
+                                                                        bool include_index_col    = true,
+                                                                        bool flush                = false,
+                                                                        std::size_t max_file_size = 0,
+                                                                        int rotate_period_s       = 0,
+                                                                        bool use_o_direct         = false);
 };
 
 #pragma GCC visibility pop
@@ -46,7 +46,8 @@ using RankType    = int;
 
 using ShapeType = std::vector<TensorIndex>;
 using RangeType = std::pair<TensorIndex, TensorIndex>;
-using TensorMap = std::map<std::string, TensorObject>;
+// Transparent comparator so tensor lookups with string literals or string_views avoid building a std::string
+using TensorMap = std::map<std::string, TensorObject, std::less<>>;
 
 template <typename T = void>
 using Task = mrc::coroutines::Task<T>;
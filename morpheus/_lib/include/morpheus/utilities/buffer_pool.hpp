@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>  // for async_resource_ref
+
+#include <cstddef>  // for size_t
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** BufferPool*****************************************/
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Per-stage pool which recycles fixed-size device buffers across batches instead of returning them to the
+ * global RMM resource. Tensor shapes like input_ids, masks and probs are stable for a given pipeline, so after
+ * warm-up every `acquire` is an O(1) hand-out of a previously retired buffer and the RMM pool sees no per-batch
+ * churn. Buffers are returned automatically when the last reference to them drops.
+ *
+ * Thread-safe, but intended to be owned by a single stage so the pooled sizes stay homogeneous.
+ */
+class BufferPool : public std::enable_shared_from_this<BufferPool>
+{
+  public:
+    /**
+     * @brief Create a new pool. The pool must be owned by a `std::shared_ptr` since handed-out buffers keep a weak
+     * reference back to it.
+     *
+     * @param max_buffers_per_size : Maximum number of retired buffers kept per distinct size, any excess is freed
+     * through RMM as usual
+     * @return std::shared_ptr<BufferPool>
+     */
+    static std::shared_ptr<BufferPool> create(std::size_t max_buffers_per_size = 64);
+
+    /**
+     * @brief Create a pool of page-locked (pinned) host buffers, allocated through `PinnedMemory` instead of the
+     * current device resource. Pinning is itself an expensive OS call, so recycling matters even more for these
+     * buffers than for device memory.
+     *
+     * @param max_buffers_per_size : Maximum number of retired buffers kept per distinct size
+     * @return std::shared_ptr<BufferPool>
+     */
+    static std::shared_ptr<BufferPool> create_pinned(std::size_t max_buffers_per_size = 64);
+
+    /**
+     * @brief Returns a device buffer of exactly `size_bytes`, reusing a retired buffer of the same size when one is
+     * available and allocating from RMM otherwise. When the last reference to the returned buffer drops it is
+     * returned to this pool, or freed normally if the pool has already been destroyed.
+     *
+     * @param size_bytes : Size of the buffer in bytes
+     * @param stream : Stream the buffer (and any allocation) is associated with
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    std::shared_ptr<rmm::device_buffer> acquire(std::size_t size_bytes, rmm::cuda_stream_view stream);
+
+    /**
+     * @brief Total number of bytes currently held by retired buffers waiting for reuse.
+     *
+     * @return std::size_t
+     */
+    std::size_t pooled_bytes() const;
+
+  private:
+    BufferPool(std::size_t max_buffers_per_size, cuda::mr::async_resource_ref<cuda::mr::device_accessible> mr);
+
+    void release(std::unique_ptr<rmm::device_buffer> buffer);
+
+    std::size_t m_max_buffers_per_size;
+    cuda::mr::async_resource_ref<cuda::mr::device_accessible> m_mr;
+
+    mutable std::mutex m_mutex;
+    std::map<std::size_t, std::vector<std::unique_ptr<rmm::device_buffer>>> m_free_buffers;
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuda_runtime.h>  // for cudaGraphExec_t
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <map>
+#include <string>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** CudaGraphCache*************************************/
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Replays a fixed sequence of kernel launches as a single CUDA graph. Short per-batch kernel chains are
+ * dominated by launch overhead at small batch sizes; once a chain has been captured, replaying it costs one graph
+ * launch instead of one launch per kernel.
+ *
+ * Replay re-issues the captured work verbatim, so the cache key must encode everything the chain depends on: the
+ * shapes AND every device address it reads or writes. Keys repeat in steady state when the buffers involved recycle
+ * through a `BufferPool`; a batch whose key has not been seen before simply runs uncaptured, so irregular traffic
+ * degrades to plain launches rather than misbehaving.
+ *
+ * Not thread-safe, intended to be owned by a single stage subscription.
+ */
+class CudaGraphCache
+{
+  public:
+    /**
+     * @brief Construct a new cache.
+     *
+     * @param max_graphs : Maximum number of distinct keys tracked, further keys always run uncaptured
+     */
+    CudaGraphCache(std::size_t max_graphs = 32);
+    ~CudaGraphCache();
+
+    CudaGraphCache(const CudaGraphCache&)            = delete;
+    CudaGraphCache& operator=(const CudaGraphCache&) = delete;
+
+    /**
+     * @brief Runs `work` for the given key, replaying a previously captured graph when one exists. The first
+     * sighting of a key runs `work` directly as a warm-up so lazy initialization happens outside capture, the
+     * second sighting captures and replays it, and every later sighting replays the graph. `work` must only
+     * enqueue asynchronous operations on `stream`: no allocations, no synchronization, no other streams.
+     *
+     * @param key : Cache key encoding the shapes and every device address `work` touches
+     * @param stream : Stream the work is enqueued (and the graph replayed) on
+     * @param work : Enqueues the kernel chain
+     */
+    void launch(const std::string& key, rmm::cuda_stream_view stream, const std::function<void()>& work);
+
+  private:
+    std::size_t m_max_graphs;
+
+    // The executable graph is null between a key's warm-up run and its capture run
+    std::map<std::string, cudaGraphExec_t> m_graphs;
+};
+/** @} */  // end of group
+}  // namespace morpheus
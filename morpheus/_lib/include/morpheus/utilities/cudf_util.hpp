@@ -23,6 +23,9 @@
 #include <cudf/io/types.hpp>
 #include <pybind11/pytypes.h>
 
+#include <functional>  // for reference_wrapper
+#include <vector>      // for vector
+
 namespace morpheus {
 /****** Component public free function implementations******/
 
@@ -40,6 +43,11 @@ namespace morpheus {
 struct CudfHelper
 {
   public:
+    /**
+     * @brief Import the generated cudf_helpers module. Idempotent and safe to call without the GIL; the
+     * conversion functions below call it on first use, so explicit calls are only needed by code that uses the
+     * cython API directly.
+     */
     __attribute__((visibility("default"))) static void load();
 
     /**
@@ -59,6 +67,16 @@ struct CudfHelper
      */
     static pybind11::object table_from_table_info(const morpheus::TableInfoBase& table_info);
 
+    /**
+     * @brief Converts several C++ TableInfo views into Python DataTable objects under a single GIL acquisition,
+     * instead of paying one GIL handoff per table.
+     *
+     * @param table_infos C++ table views
+     * @return std::vector<pybind11::object>
+     */
+    static std::vector<pybind11::object> tables_from_table_info(
+        const std::vector<std::reference_wrapper<const morpheus::TableInfoBase>>& table_infos);
+
     /**
      * @brief Converts a Python DataTable object into a C++ TableInfoData struct containing the column and index
      * information
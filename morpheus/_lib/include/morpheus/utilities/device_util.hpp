@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+namespace morpheus {
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Scoped CUDA device switch. Sets the current device to `device_id` for the lifetime of the object and
+ * restores the previous device on destruction. A stage placed on a non-default device wraps its work (and its
+ * allocations, so RMM picks the right per-device resource) in one of these.
+ */
+class MORPHEUS_EXPORT DeviceScope
+{
+  public:
+    DeviceScope(int device_id);
+    ~DeviceScope();
+
+    DeviceScope(const DeviceScope&)            = delete;
+    DeviceScope& operator=(const DeviceScope&) = delete;
+
+  private:
+    int m_previous_device;
+};
+
+/**
+ * @brief Device placement utilities
+ */
+struct MORPHEUS_EXPORT DeviceUtil
+{
+    /**
+     * @brief Return the ordinal of the current CUDA device.
+     *
+     * @return int
+     */
+    static int current_device();
+
+    /**
+     * @brief Enable peer access between `device_a` and `device_b` in both directions, once per pair for the
+     * lifetime of the process. With peer access enabled, copies between the two devices move directly over
+     * NVLink/PCIe P2P; without it the runtime stages them through host memory. Pairs the hardware cannot peer
+     * (different PCIe root complexes without NVLink) are left alone — copies between them still work, just staged.
+     * Safe to call from multiple threads.
+     *
+     * @param device_a
+     * @param device_b
+     */
+    static void ensure_peer_access(int device_a, int device_b);
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"  // for MORPHEUS_EXPORT
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace morpheus {
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Lock-free gauge describing one bounded queue between pipeline threads.
+ *
+ * Tracks the current depth, the high-water mark, the total number of items enqueued and the accumulated time
+ * producers spent blocked on the queue. When throughput collapses the saturated edge shows itself immediately:
+ * its depth sits at the bound, its high-water mark equals the bound and its blocked-time accumulator grows,
+ * while the edges downstream of the choke point stay shallow. All updates are relaxed atomics, cheap enough to
+ * leave enabled in production.
+ */
+class MORPHEUS_EXPORT EdgeGauge
+{
+  public:
+    /**
+     * @brief Record an item entering the queue, raising the high-water mark if the new depth exceeds it.
+     */
+    void enqueue() noexcept;
+
+    /**
+     * @brief Record an item leaving the queue.
+     */
+    void dequeue() noexcept;
+
+    /**
+     * @brief Add time a producer spent blocked waiting for queue space. Usually recorded via
+     * `ScopedBlockedTimer` rather than called directly.
+     *
+     * @param nanoseconds : Blocked duration in nanoseconds.
+     */
+    void add_blocked_ns(std::uint64_t nanoseconds) noexcept;
+
+    /**
+     * @brief Zero the high-water mark, enqueue count and blocked-time accumulator. The current depth is left
+     * alone since items may still be in flight; intended for use between measurement windows.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Snapshot the gauge.
+     *
+     * @return Map with keys `depth`, `high_water`, `enqueued` and `blocked_ms`.
+     */
+    std::map<std::string, double> stats() const;
+
+  private:
+    std::atomic<std::int64_t> m_depth{0};
+    std::atomic<std::uint64_t> m_high_water{0};
+    std::atomic<std::uint64_t> m_enqueued{0};
+    std::atomic<std::uint64_t> m_blocked_ns{0};
+};
+
+/**
+ * @brief Process-wide registry of edge gauges, the queue-side companion to `LatencyRegistry`.
+ *
+ * Queues obtain their gauge once at construction and update it lock-free; the registry mutex is only taken on
+ * first registration and when aggregating. Snapshots are pollable from Python via
+ * `morpheus._lib.common.edge_gauge_stats()` alongside the per-stage latency histograms.
+ */
+class MORPHEUS_EXPORT EdgeGaugeRegistry
+{
+  public:
+    static EdgeGaugeRegistry& instance();
+
+    /**
+     * @brief Return the gauge registered under `name`, creating it on first use. The returned reference remains
+     * valid for the lifetime of the process.
+     */
+    EdgeGauge& get_or_create(const std::string& name);
+
+    /**
+     * @brief Snapshot every registered gauge, keyed by edge name.
+     */
+    std::map<std::string, std::map<std::string, double>> all_stats() const;
+
+    /**
+     * @brief Reset every registered gauge.
+     */
+    void reset_all();
+
+  private:
+    EdgeGaugeRegistry() = default;
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, std::unique_ptr<EdgeGauge>> m_gauges;
+};
+
+/**
+ * @brief Adds the elapsed wall time of the enclosing scope to an `EdgeGauge`'s blocked-time accumulator on
+ * destruction. Wrap the blocking wait itself, not the whole push, so uncontended traffic contributes nothing.
+ */
+class MORPHEUS_EXPORT ScopedBlockedTimer
+{
+  public:
+    explicit ScopedBlockedTimer(EdgeGauge& gauge) : m_gauge(gauge), m_start(std::chrono::steady_clock::now()) {}
+
+    ~ScopedBlockedTimer()
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        m_gauge.add_blocked_ns(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    ScopedBlockedTimer(const ScopedBlockedTimer&)            = delete;
+    ScopedBlockedTimer& operator=(const ScopedBlockedTimer&) = delete;
+
+  private:
+    EdgeGauge& m_gauge;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"  // for MORPHEUS_EXPORT
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace morpheus {
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Optional NVML-backed sampler recording GPU utilization alongside the per-stage telemetry.
+ *
+ * A background thread periodically reads SM occupancy, memory-controller utilization and PCIe throughput for one
+ * device and appends them to a bounded in-memory timeline. Timestamps come from `std::chrono::steady_clock`, the
+ * same clock the stage timers and edge gauges sample, so utilization rows align with latency and queue-depth
+ * traces without cross-clock skew. Sampling is entirely opt-in and costs nothing until `start()` is called;
+ * failures to initialize NVML (driver too old, no device) disable the sampler with a warning rather than failing
+ * the pipeline.
+ *
+ * Aggregates are pollable from Python via `morpheus._lib.common.gpu_utilization_stats()`, the raw timeline via
+ * `gpu_utilization_samples()`.
+ */
+class MORPHEUS_EXPORT GpuUtilizationSampler
+{
+  public:
+    /**
+     * @brief One point on the utilization timeline.
+     */
+    struct Sample
+    {
+        std::int64_t timestamp_ms;  // steady_clock milliseconds
+        double sm_percent;
+        double memory_percent;
+        double pcie_rx_mbs;
+        double pcie_tx_mbs;
+    };
+
+    static GpuUtilizationSampler& instance();
+
+    /**
+     * @brief Start sampling. No-op when already running.
+     *
+     * @param interval : Time between samples. Each PCIe throughput read occupies NVML for roughly 20ms, so
+     * intervals much below 50ms mostly measure the measurement.
+     * @param device_index : NVML index of the device to sample.
+     * @param capacity : Maximum number of retained samples; the timeline drops its oldest entries beyond this.
+     * @return Whether the sampler is running on return. False when NVML could not be initialized.
+     */
+    bool start(std::chrono::milliseconds interval = std::chrono::milliseconds(100),
+               unsigned int device_index          = 0,
+               std::size_t capacity               = 4096);
+
+    /**
+     * @brief Stop sampling and join the sampler thread. Retained samples survive until the next `start()`.
+     */
+    void stop();
+
+    bool running() const;
+
+    /**
+     * @brief Snapshot of the retained timeline, oldest sample first.
+     */
+    std::vector<Sample> samples() const;
+
+    /**
+     * @brief Summary statistics over the retained timeline.
+     *
+     * @return Map with keys `sample_count`, `sm_mean_percent`, `sm_peak_percent`, `memory_mean_percent`,
+     * `memory_peak_percent`, `pcie_rx_mean_mbs`, `pcie_rx_peak_mbs`, `pcie_tx_mean_mbs` and `pcie_tx_peak_mbs`;
+     * all zero when no samples have been recorded.
+     */
+    std::map<std::string, double> stats() const;
+
+  private:
+    GpuUtilizationSampler() = default;
+
+    void sampler_main(unsigned int device_index, std::chrono::milliseconds interval);
+
+    mutable std::mutex m_mutex;
+    std::deque<Sample> m_samples;
+    std::size_t m_capacity{4096};
+    bool m_running{false};
+    bool m_stop_requested{false};
+    std::thread m_sampler;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -49,13 +49,24 @@ class Listener;
 using on_complete_cb_fn_t = std::function<void(const boost::system::error_code& /* error message */)>;
 
 /**
- * @brief A tuple consisting of the HTTP status code, mime type to be used for the Content-Type header, and the body of
- * the response and optionally a callback function.
+ * @brief Produces the next chunk of a streamed response body, returning an empty string to end the stream.
+ *
+ * @details Called repeatedly from the server's io thread while the response is written with chunked transfer
+ * encoding, so only one chunk is resident per connection rather than the whole body.
+ */
+using chunk_supplier_fn_t = std::function<std::string()>;
+
+/**
+ * @brief A tuple consisting of the HTTP status code, mime type to be used for the Content-Type header, the body of
+ * the response, optionally a callback function and optionally a chunk supplier. When the chunk supplier is
+ * non-null the body string is ignored and the response is streamed from the supplier with chunked transfer
+ * encoding.
  */
 using parse_status_t = std::tuple<unsigned /*http status code*/,
                                   std::string /* Content-Type of response */,
                                   std::string /* response body */,
-                                  on_complete_cb_fn_t /* optional callback function, ignored if null */>;
+                                  on_complete_cb_fn_t /* optional callback function, ignored if null */,
+                                  chunk_supplier_fn_t /* optional streamed body, ignored if null */>;
 
 /**
  * @brief A function that receives the post body and returns an HTTP status code, Content-Type string and body.
@@ -67,8 +78,11 @@ using parse_status_t = std::tuple<unsigned /*http status code*/,
  *
  * Refer to https://www.boost.org/doc/libs/1_74_0/libs/system/doc/html/system.html#ref_class_error_code for more
  * information regarding `boost::system::error_code`.
+ *
+ * The body is moved out of the beast request into the function, so the function takes ownership of the
+ * underlying buffer without a copy.
  */
-using payload_parse_fn_t = std::function<parse_status_t(const std::string& /* post body */)>;
+using payload_parse_fn_t = std::function<parse_status_t(std::string&& /* post body */)>;
 
 constexpr std::size_t DefaultMaxPayloadSize{1024 * 1024 * 10};  // 10MB
 
@@ -77,7 +91,18 @@ constexpr std::size_t DefaultMaxPayloadSize{1024 * 1024 * 10};  // 10MB
  *
  * @details The server is started on a separate thread(s) and will call the provided payload_parse_fn_t
  *          function when an incoming request is received. The payload_parse_fn_t function is expected to
- *          return a tuple conforming to `parse_status_t` (ex: `std::make_tuple(200, "text/plain"s, "OK"s, nullptr)`).
+ *          return a tuple conforming to `parse_status_t`
+ *          (ex: `std::make_tuple(200, "text/plain"s, "OK"s, nullptr, nullptr)`).
+ *
+ *          Request bodies sent with a `Content-Encoding` of gzip, deflate or zstd are decompressed on the
+ *          session's worker thread before the parse function is invoked, so the parse function always receives
+ *          plain bytes. The decompressed size is bounded by `max_payload_size`.
+ *
+ *          High-rate clients may instead upgrade the endpoint to a WebSocket and stream record batches
+ *          continuously over the one connection, one batch per message, with the same parse function invoked per
+ *          message. Accepted batches are not acknowledged individually; a batch whose parse status is >= 400 is
+ *          reported back in a text frame and the stream stays up. Per-message compression (permessage-deflate) is
+ *          supported and message sizes are bounded by `max_payload_size`.
  *
  * @param payload_parse_fn The function that will be called when a POST request is received.
  * @param bind_address The address to bind the server to.
@@ -87,6 +112,9 @@ constexpr std::size_t DefaultMaxPayloadSize{1024 * 1024 * 10};  // 10MB
  * @param num_threads The number of threads to use for the server.
  * @param max_payload_size The maximum size in bytes of the payload that the server will accept in a single request.
  * @param request_timeout The timeout for a request.
+ * @param reuse_port When true each thread runs its own io_context and SO_REUSEPORT acceptor pinned to a CPU,
+ * letting the kernel spread incoming connections across the acceptors instead of funneling them through one
+ * accepting socket. Linux only.
  */
 class HttpServer
 {
@@ -98,7 +126,8 @@ class HttpServer
                std::string method                   = "POST",
                unsigned short num_threads           = 1,
                std::size_t max_payload_size         = DefaultMaxPayloadSize,
-               std::chrono::seconds request_timeout = std::chrono::seconds(30));
+               std::chrono::seconds request_timeout = std::chrono::seconds(30),
+               bool reuse_port                      = false);
     ~HttpServer();
     void start();
     void stop();
@@ -114,9 +143,10 @@ class HttpServer
     unsigned short m_num_threads;
     std::chrono::seconds m_request_timeout;
     std::size_t m_max_payload_size;
+    bool m_reuse_port;
     std::vector<std::thread> m_listener_threads;
-    boost::asio::io_context m_io_context;
-    std::shared_ptr<Listener> m_listener;
+    std::vector<std::unique_ptr<boost::asio::io_context>> m_io_contexts;
+    std::vector<std::shared_ptr<Listener>> m_listeners;
     std::shared_ptr<payload_parse_fn_t> m_payload_parse_fn;
     std::atomic<bool> m_is_running;
 };
@@ -136,7 +166,8 @@ class Listener : public std::enable_shared_from_this<Listener>
              const std::string& endpoint,
              boost::beast::http::verb method,
              std::size_t max_payload_size,
-             std::chrono::seconds request_timeout);
+             std::chrono::seconds request_timeout,
+             bool reuse_port = false);
 
     ~Listener() = default;
 
@@ -34,6 +34,104 @@ namespace morpheus {
  * @file
  */
 
+/**
+ * @brief Lazily recorded chain of elementwise operations over a device buffer. Steps are composed on the host and
+ * fused into a single device pass when the chain is materialized, where running the equivalent `MatxUtil` calls
+ * back to back would allocate a full-size intermediate buffer and pay a global memory round trip per step.
+ *
+ * Arithmetic is evaluated in the input's floating point type. A chain may end with `cast` to store a different
+ * output type, or with `threshold` to produce a BOOL8 mask (optionally row-reduced), mirroring the standalone
+ * `MatxUtil::cast`/`MatxUtil::logits`/`MatxUtil::threshold` operations.
+ */
+class ElementwiseChain
+{
+  public:
+    /**
+     * @brief Store the result as `output_type` instead of the input's type. Applies only to the final store, the
+     * intermediate arithmetic stays in the input's type.
+     *
+     * @param output_type
+     * @return ElementwiseChain&
+     */
+    ElementwiseChain& cast(TypeId output_type);
+
+    /**
+     * @brief Multiply each element by `factor`.
+     *
+     * @param factor
+     * @return ElementwiseChain&
+     */
+    ElementwiseChain& scale(double factor);
+
+    /**
+     * @brief Add `addend` to each element.
+     *
+     * @param addend
+     * @return ElementwiseChain&
+     */
+    ElementwiseChain& add(double addend);
+
+    /**
+     * @brief Apply the sigmoid function, the same transform as `MatxUtil::logits`. May appear at most once in a
+     * chain; `scale`/`add` steps recorded afterwards apply to the sigmoid output.
+     *
+     * @return ElementwiseChain&
+     */
+    ElementwiseChain& sigmoid();
+
+    /**
+     * @brief Compare against `thresh_val`, storing the result as BOOL8. When `by_row` is true each row reduces to a
+     * single value, matching `MatxUtil::threshold`. Terminal, takes precedence over a recorded `cast`.
+     *
+     * @param thresh_val
+     * @param by_row
+     * @return ElementwiseChain&
+     */
+    ElementwiseChain& threshold(double thresh_val, bool by_row = false);
+
+    /**
+     * @brief Materialize the chain on a 2D `input` into a newly allocated buffer in a single fused pass, enqueued on
+     * the stream of the returned buffer without blocking the host.
+     *
+     * @param input
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    std::shared_ptr<rmm::device_buffer> run_async(const DevMemInfo& input) const;
+
+    /**
+     * @brief Synchronous variant of `run_async`
+     *
+     * @param input
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    std::shared_ptr<rmm::device_buffer> run(const DevMemInfo& input) const;
+
+  private:
+    // Affine steps recorded before and after the sigmoid fold into two multiply-adds
+    double m_pre_scale{1.0};
+    double m_pre_offset{0.0};
+    bool m_sigmoid{false};
+    double m_post_scale{1.0};
+    double m_post_offset{0.0};
+
+    bool m_has_threshold{false};
+    double m_threshold{0.0};
+    bool m_by_row{false};
+
+    // EMPTY means "store in the input's type"
+    TypeId m_output_type{TypeId::EMPTY};
+};
+
+/**
+ * @brief Reduction applied over each window by `MatxUtil::sliding_window_reduce`.
+ */
+enum class WindowReduceOp
+{
+    MAX,
+    SUM,
+    MEAN
+};
+
 struct MatxUtil
 {
     /**
@@ -45,6 +143,34 @@ struct MatxUtil
      */
     static std::shared_ptr<rmm::device_buffer> cast(const DevMemInfo& input, TypeId output_type);
 
+    /**
+     * @brief Asynchronous variant of `cast`. The conversion is enqueued on the stream of the returned buffer
+     * without blocking the host, so several MatxUtil ops can be chained and synchronized once. The caller must
+     * synchronize the buffer's stream before reading the result.
+     *
+     * @param input
+     * @param output_type
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> cast_async(const DevMemInfo& input, TypeId output_type);
+
+    /**
+     * @brief Pack a FLOAT32 buffer into IEEE 754 half precision, halving the bytes moved per transfer. The generic
+     * `cast` cannot produce halves since cuDF has no half type.
+     *
+     * @param input : Describes a FLOAT32 buffer
+     * @return std::shared_ptr<rmm::device_buffer> holding `input.count()` half-precision values
+     */
+    static std::shared_ptr<rmm::device_buffer> cast_fp32_to_fp16(const DevMemInfo& input);
+
+    /**
+     * @brief Expand a packed half precision buffer back to FLOAT32.
+     *
+     * @param input : Describes a FLOAT16 buffer
+     * @return std::shared_ptr<rmm::device_buffer> holding `input.count()` FLOAT32 values
+     */
+    static std::shared_ptr<rmm::device_buffer> cast_fp16_to_fp32(const DevMemInfo& input);
+
     /**
      * @brief Builds a Nx3 segment ID matrix
      *
@@ -68,6 +194,38 @@ struct MatxUtil
      */
     static void offset_seq_ids(const DevMemInfo& input, TensorIndex offset);
 
+    /**
+     * @brief Asynchronous variant of `offset_seq_ids`, enqueued on the input's stream without blocking the host.
+     * The caller must synchronize that stream before reading the tensor.
+     *
+     * @param input
+     * @param offset
+     */
+    static void offset_seq_ids_async(const DevMemInfo& input, TensorIndex offset);
+
+    /**
+     * @brief Gathers rows of a 2D `input` into the row order given by `row_indices`, which may repeat rows. The
+     * kernel is enqueued on the stream of the returned buffer without blocking the host; the caller must
+     * synchronize that stream before reading the result.
+     *
+     * @param input
+     * @param row_indices 1D `TensorIndex` tensor holding the input row to place at each output row
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> gather_rows_async(const DevMemInfo& input,
+                                                                 const DevMemInfo& row_indices);
+
+    /**
+     * @brief Casts the 1D `input` and writes it as column `col_idx` of the row-major 2D `output` in a single
+     * fused pass, replacing a separate cast, pack and transpose. The kernel is enqueued on the output's stream
+     * without blocking the host; the caller must synchronize before reading the result.
+     *
+     * @param input
+     * @param output 2D row-major destination sized `[rows, num_cols]`
+     * @param col_idx
+     */
+    static void pack_column_async(const DevMemInfo& input, const DevMemInfo& output, TensorIndex col_idx);
+
     /**
      * @brief Calculate logits on device_buffer
      *
@@ -76,6 +234,26 @@ struct MatxUtil
      */
     static std::shared_ptr<rmm::device_buffer> logits(const DevMemInfo& input);
 
+    /**
+     * @brief Apply a row-wise softmax to the 2D `input`, writing into a new buffer with the input's layout. For
+     * multiclass models emitting raw logits, this replaces a per-batch round trip through Python post-processing.
+     *
+     * @param input
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> softmax(const DevMemInfo& input);
+
+    /**
+     * @brief For each row of the 2D `input`, find the maximum value and the column holding it in a single pass. The
+     * values (in the input's type) are written to `max_values` and the column indices (as int64) to `max_indices`,
+     * both caller-provided device buffers of `input.shape(0)` elements. Blocks until the results are ready.
+     *
+     * @param input
+     * @param max_values
+     * @param max_indices
+     */
+    static void row_argmax(const DevMemInfo& input, void* max_values, void* max_indices);
+
     /**
      * @brief Perform transpose
      *
@@ -95,6 +273,93 @@ struct MatxUtil
      */
     static std::shared_ptr<rmm::device_buffer> threshold(const DevMemInfo& input, double thresh_val, bool by_row);
 
+    /**
+     * @brief Asynchronous variant of `threshold`. The comparison is enqueued on the stream of the returned buffer
+     * without blocking the host; the caller must synchronize that stream before reading the mask.
+     *
+     * @param input
+     * @param thresh_val
+     * @param by_row
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> threshold_async(const DevMemInfo& input, double thresh_val, bool by_row);
+
+    /**
+     * @brief Fused threshold-and-scatter: reads the probabilities tensor once and writes one boolean label
+     * column per entry of `column_indices` directly into the destination column buffers, in a single pass.
+     * Replaces a full-width `threshold` followed by a strided device-to-device copy per label column.
+     * Synchronizes on the input's stream before returning.
+     *
+     * @param input 2D probabilities tensor
+     * @param thresh_val
+     * @param column_indices input column selected for each output
+     * @param output_columns device pointers to the BOOL8 destination column data, one per entry of
+     * `column_indices`, each with room for `input.shape(0)` rows
+     */
+    static void threshold_scatter(const DevMemInfo& input,
+                                  double thresh_val,
+                                  const std::vector<TensorIndex>& column_indices,
+                                  const std::vector<void*>& output_columns);
+
+    /**
+     * @brief Scatters the selected columns of a 2D tensor straight into per-column destination buffers with one
+     * kernel launch. The copy-only sibling of `threshold_scatter`: replaces one strided device-to-device copy per
+     * column with a single pass over the tensor. The destinations must share the input's dtype.
+     * Synchronizes on the input's stream before returning.
+     *
+     * @param input 2D tensor
+     * @param column_indices input column selected for each output
+     * @param output_columns device pointers to the destination column data, one per entry of `column_indices`,
+     * each with room for `input.shape(0)` rows of the input's dtype
+     */
+    static void scatter_columns(const DevMemInfo& input,
+                                const std::vector<TensorIndex>& column_indices,
+                                const std::vector<void*>& output_columns);
+
+    /**
+     * @brief Run-length encodes a BOOL8 row mask (as produced by `threshold`) into contiguous [start, stop)
+     * row ranges entirely on the device; only the compacted ranges are copied back to the host.
+     * Synchronizes on the mask's stream before returning.
+     *
+     * @param bool_mask
+     * @param num_rows
+     * @return std::vector<RangeType>
+     */
+    static std::vector<RangeType> mask_to_ranges(const rmm::device_buffer& bool_mask, TensorIndex num_rows);
+
+    /**
+     * @brief Fused equivalent of `logits` followed by `threshold`, applying the sigmoid and the comparison in a
+     * single pass over the input instead of two. Returns the boolean mask with the same semantics as `threshold`.
+     * When `scores` is non-null, the sigmoid scores are also written out to a new buffer returned through it for
+     * callers that need both.
+     *
+     * @param input
+     * @param thresh_val
+     * @param by_row
+     * @param scores
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> logits_threshold(const DevMemInfo& input,
+                                                                double thresh_val,
+                                                                bool by_row,
+                                                                std::shared_ptr<rmm::device_buffer>* scores = nullptr);
+
+    /**
+     * @brief Asynchronous variant of `logits_threshold`, enqueued on the stream of the returned buffer without
+     * blocking the host. The caller must synchronize that stream before reading the outputs.
+     *
+     * @param input
+     * @param thresh_val
+     * @param by_row
+     * @param scores
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> logits_threshold_async(
+        const DevMemInfo& input,
+        double thresh_val,
+        bool by_row,
+        std::shared_ptr<rmm::device_buffer>* scores = nullptr);
+
     /**
      * @brief Returns a buffer with `output_shape` containing the max value from values in `input` mapped according to
      * `seq_ids`.
@@ -116,6 +381,87 @@ struct MatxUtil
                                                           const ShapeType& seq_ids,
                                                           TensorIndex seq_id_offset,
                                                           const ShapeType& output_shape);
+
+    /**
+     * @brief Asynchronous variant of `reduce_max`. The reductions are enqueued on the stream of the returned buffer
+     * without blocking the host; the caller must synchronize that stream before reading the result.
+     *
+     * @param input
+     * @param seq_ids
+     * @param seq_id_offset
+     * @param output_shape
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> reduce_max_async(const DevMemInfo& input,
+                                                                const ShapeType& seq_ids,
+                                                                TensorIndex seq_id_offset,
+                                                                const ShapeType& output_shape);
+
+    /**
+     * @brief Returns a buffer shaped like `input` where each row holds the reduction over the sliding window of
+     * up to `window` rows ending at that row, clamped at its segment's start. `segment_offsets` holds the
+     * contiguous per-entity row ranges as `num_segments + 1` boundaries (first 0, last the row count), so
+     * windows never cross entities. All windows are computed in one kernel from a shared-memory tile, where
+     * reducing each window separately rereads every row `window` times from global memory.
+     * Ex given a hypothetical input of:
+     *
+     *     input           = [1, 3, 2, 5, 4, 9]
+     *     segment_offsets = [0, 4, 6]
+     *     window          = 2, op = WindowReduceOp::MAX
+     *
+     * Will return:
+     *                       [1, 3, 3, 5, 4, 9]
+     *
+     * @param input
+     * @param segment_offsets
+     * @param window
+     * @param op
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> sliding_window_reduce(const DevMemInfo& input,
+                                                                     const ShapeType& segment_offsets,
+                                                                     TensorIndex window,
+                                                                     WindowReduceOp op);
+
+    /**
+     * @brief Asynchronous variant of `sliding_window_reduce`. The reductions are enqueued on the stream of the
+     * returned buffer without blocking the host; the caller must synchronize that stream before reading the
+     * result.
+     *
+     * @param input
+     * @param segment_offsets
+     * @param window
+     * @param op
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> sliding_window_reduce_async(const DevMemInfo& input,
+                                                                           const ShapeType& segment_offsets,
+                                                                           TensorIndex window,
+                                                                           WindowReduceOp op);
+
+    /**
+     * @brief Mean-pools groups of `pool_size` consecutive rows of the 2D `input` and L2-normalizes each pooled
+     * row, in a single fused kernel. For token embeddings shaped `[rows, cols]` with `pool_size` tokens per
+     * sequence this produces `[rows / pool_size, cols]` unit-length sequence embeddings without materializing
+     * the intermediate pooled values in global memory. `rows` must be a multiple of `pool_size`. All-zero
+     * groups are passed through unscaled instead of dividing by a zero norm.
+     *
+     * @param input
+     * @param pool_size
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> mean_pool_normalize(const DevMemInfo& input, TensorIndex pool_size);
+
+    /**
+     * @brief Asynchronous variant of `mean_pool_normalize`. The work is enqueued on the stream of the returned
+     * buffer without blocking the host; the caller must synchronize that stream before reading the result.
+     *
+     * @param input
+     * @param pool_size
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> mean_pool_normalize_async(const DevMemInfo& input,
+                                                                         TensorIndex pool_size);
 };
 /** @} */  // end of group
 }  // namespace morpheus
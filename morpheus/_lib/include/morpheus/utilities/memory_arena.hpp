@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"                       // for MORPHEUS_EXPORT
+#include "morpheus/objects/memory_descriptor.hpp"  // for MemoryDescriptor
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/arena_memory_resource.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/limiting_resource_adaptor.hpp>
+#include <rmm/mr/device/statistics_resource_adaptor.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace morpheus {
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief A named RMM arena sub-allocator with an independent budget and high-water tracking.
+ *
+ * Multiple pipelines in one process normally share the global RMM resource, so one pipeline's allocation burst
+ * fragments the pool for all of them. An arena carves that pipeline's allocations into its own superblocks:
+ * fragmentation stays inside the arena, the budget caps how much of the device the pipeline may claim (over-budget
+ * allocations throw `rmm::out_of_memory` in the offending pipeline only), and the statistics layer records the
+ * high-water mark for sizing.
+ *
+ * Pipelines select their arena through the `MemoryDescriptor` carried alongside device buffers; `make_descriptor`
+ * builds one that routes allocations here.
+ */
+class MORPHEUS_EXPORT MemoryArena
+{
+  public:
+    /**
+     * @brief Construct an arena over the current device resource.
+     *
+     * @param name : Name of the arena, used as the key in stats reporting
+     * @param budget_bytes : Maximum bytes the arena may hold at once, `0` leaves it unbounded
+     */
+    MemoryArena(std::string name, std::size_t budget_bytes);
+
+    /**
+     * @brief The arena's memory resource, with the budget and statistics layers applied.
+     */
+    rmm::mr::device_memory_resource* resource();
+
+    /**
+     * @brief Build a `MemoryDescriptor` selecting this arena, ready to hand to `DevMemInfo` and the tensor
+     * constructors. The descriptor stays valid as long as the arena is registered.
+     */
+    std::shared_ptr<MemoryDescriptor> make_descriptor(rmm::cuda_stream_view stream) const;
+
+    const std::string& name() const;
+
+    std::size_t budget_bytes() const;
+
+    /**
+     * @brief Snapshot as `current_bytes`, `peak_bytes`, `total_bytes`, `allocation_count` and `budget_bytes`.
+     */
+    std::map<std::string, double> stats() const;
+
+  private:
+    using arena_resource_t   = rmm::mr::arena_memory_resource<rmm::mr::device_memory_resource>;
+    using limited_resource_t = rmm::mr::limiting_resource_adaptor<arena_resource_t>;
+    using tracked_resource_t = rmm::mr::statistics_resource_adaptor<limited_resource_t>;
+
+    std::string m_name;
+    std::size_t m_budget_bytes;
+
+    // Layered bottom-up: arena for isolation, limiting for the budget, statistics for the high-water mark
+    std::unique_ptr<arena_resource_t> m_arena;
+    std::unique_ptr<limited_resource_t> m_limited;
+    std::unique_ptr<tracked_resource_t> m_tracked;
+};
+
+/**
+ * @brief Process-wide registry of named memory arenas, the allocator counterpart of `StageMemoryRegistry`.
+ *
+ * Each pipeline calls `get_or_create` with its own name during build and threads the resulting descriptor into
+ * the buffers it allocates. Aggregated statistics are pollable from Python via
+ * `morpheus._lib.common.memory_arena_stats()`.
+ */
+class MORPHEUS_EXPORT MemoryArenaRegistry
+{
+  public:
+    static MemoryArenaRegistry& instance();
+
+    /**
+     * @brief Return the arena registered under `name`, creating it on first use. `budget_bytes` only applies at
+     * creation; later callers share the existing arena regardless of the budget they pass.
+     */
+    std::shared_ptr<MemoryArena> get_or_create(const std::string& name, std::size_t budget_bytes = 0);
+
+    /**
+     * @brief Snapshot every registered arena's counters, keyed by arena name.
+     */
+    std::map<std::string, std::map<std::string, double>> all_stats() const;
+
+  private:
+    MemoryArenaRegistry() = default;
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, std::shared_ptr<MemoryArena>> m_arenas;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"  // for MORPHEUS_EXPORT
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace morpheus {
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Per-stage device-memory counters: live bytes, high-water mark, cumulative bytes and allocation count.
+ *
+ * Updated lock-free by the tracking resource adaptor installed via `install_memory_telemetry()`; attribution
+ * follows the stage tag active on the allocating fiber (see `MORPHEUS_STAGE_MEMORY_SCOPE`). Deallocations are
+ * charged back to the stage that allocated, regardless of which stage frees.
+ */
+class MORPHEUS_EXPORT StageMemoryCounters
+{
+  public:
+    void record_alloc(std::size_t bytes) noexcept;
+    void record_dealloc(std::size_t bytes) noexcept;
+
+    /**
+     * @brief Snapshot as `current_bytes`, `peak_bytes`, `total_bytes` and `allocation_count`.
+     */
+    std::map<std::string, double> stats() const;
+
+  private:
+    std::atomic<std::int64_t> m_current_bytes{0};
+    std::atomic<std::int64_t> m_peak_bytes{0};
+    std::atomic<std::uint64_t> m_total_bytes{0};
+    std::atomic<std::uint64_t> m_allocation_count{0};
+};
+
+/**
+ * @brief Process-wide registry of per-stage memory counters, the memory counterpart of `LatencyRegistry`.
+ *
+ * Allocations made outside any stage scope are pooled under the `(untagged)` entry. Aggregated statistics are
+ * pollable from Python via `morpheus._lib.common.stage_memory_stats()`.
+ */
+class MORPHEUS_EXPORT StageMemoryRegistry
+{
+  public:
+    static StageMemoryRegistry& instance();
+
+    /**
+     * @brief Return the counters registered under `name`, creating them on first use. The returned reference
+     * remains valid for the lifetime of the process.
+     */
+    StageMemoryCounters& get_or_create(const std::string& name);
+
+    /**
+     * @brief Snapshot every registered stage's counters, keyed by stage name.
+     */
+    std::map<std::string, std::map<std::string, double>> all_stats() const;
+
+    /**
+     * @brief Counters charged for allocations made while no stage scope is active on the calling fiber.
+     */
+    StageMemoryCounters& untagged();
+
+    /**
+     * @brief The counters currently tagged on the calling fiber, or `untagged()` when no scope is active.
+     */
+    static StageMemoryCounters& active();
+
+    /**
+     * @brief Set (or clear, with nullptr) the calling fiber's active counters. Used by `ScopedMemoryTag`.
+     */
+    static StageMemoryCounters* exchange_active(StageMemoryCounters* counters);
+
+  private:
+    StageMemoryRegistry() = default;
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, std::unique_ptr<StageMemoryCounters>> m_counters;
+};
+
+/**
+ * @brief Tags the calling fiber with a stage's counters for the enclosing scope, restoring the previous tag on
+ * exit so nested scopes attribute correctly.
+ */
+class MORPHEUS_EXPORT ScopedMemoryTag
+{
+  public:
+    explicit ScopedMemoryTag(StageMemoryCounters& counters) :
+      m_previous(StageMemoryRegistry::exchange_active(&counters))
+    {}
+
+    ~ScopedMemoryTag()
+    {
+        StageMemoryRegistry::exchange_active(m_previous);
+    }
+
+    ScopedMemoryTag(const ScopedMemoryTag&)            = delete;
+    ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+
+  private:
+    StageMemoryCounters* m_previous;
+};
+
+/**
+ * @brief Wrap the current RMM device resource in the stage-tracking adaptor and install the wrapper as the
+ * current resource. Idempotent; call once after the final resource is configured (pool, arena, etc.) and before
+ * the pipeline starts. Until this is called the stage scopes cost one fiber-local read and track nothing.
+ */
+MORPHEUS_EXPORT void install_memory_telemetry();
+
+/** @} */  // end of group
+}  // namespace morpheus
+
+/**
+ * @brief Attribute device allocations made in the rest of the enclosing scope to the stage named `name`. The
+ * registry lookup runs once per call site; `name` must be a string literal.
+ */
+#define MORPHEUS_STAGE_MEMORY_SCOPE(name)                                                                  \
+    static auto& morpheus_stage_mem_counters__ = morpheus::StageMemoryRegistry::instance().get_or_create(  \
+        name);                                                                                             \
+    morpheus::ScopedMemoryTag morpheus_stage_mem_tag__                                                     \
+    {                                                                                                      \
+        morpheus_stage_mem_counters__                                                                      \
+    }
@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"                   // for MORPHEUS_EXPORT
+#include "morpheus/utilities/http_server.hpp"  // for HttpServer
+
+#include <pybind11/pytypes.h>  // for pybind11::object
+
+#include <atomic>   // for atomic
+#include <cstddef>  // for size_t
+#include <memory>   // for unique_ptr & shared_ptr
+#include <string>   // for string
+
+namespace morpheus {
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+#pragma GCC visibility push(default)
+
+/**
+ * @brief Serves the process-wide telemetry registries in Prometheus text exposition format.
+ *
+ * The exporter owns an `HttpServer` answering GET requests on `endpoint` (by default `/metrics` on port 9105)
+ * and renders the stage latency histograms, edge queue gauges, per-stage and per-arena memory counters and the
+ * GPU utilization summary as labelled gauge families, e.g.
+ * `morpheus_stage_latency{stage="DedupeStage",stat="p95_us"} 742`. Empty registries are omitted, so the
+ * exposition reflects exactly the telemetry the process is collecting.
+ *
+ * The render loop appends into a response buffer pre-sized to the previous scrape's high-water mark and formats
+ * numbers into stack storage, so a scrape performs no heap allocation beyond the one buffer handed to the HTTP
+ * layer (plus the registry snapshots themselves).
+ */
+class MORPHEUS_EXPORT MetricsExporter
+{
+  public:
+    /**
+     * @brief Construct a new Metrics Exporter object
+     *
+     * @param bind_address : The address to bind the scrape server to.
+     * @param port : The port to bind the scrape server to.
+     * @param endpoint : The endpoint to serve the metrics on.
+     * @param num_threads : The number of threads used by the scrape server.
+     */
+    MetricsExporter(std::string bind_address   = "127.0.0.1",
+                    unsigned short port        = 9105,
+                    std::string endpoint       = "/metrics",
+                    unsigned short num_threads = 1);
+
+    void start();
+    void stop();
+    bool is_running() const;
+
+    /**
+     * @brief Render every registry into Prometheus text format. Called per scrape by the server; exposed so the
+     * exposition can be generated (and tested) without going through HTTP.
+     */
+    std::string render();
+
+  private:
+    std::unique_ptr<HttpServer> m_server;
+
+    // High-water mark of the rendered exposition, the next scrape's buffer is reserved to it up front
+    std::atomic<std::size_t> m_high_water{4096};
+};
+
+/****** MetricsExporterInterfaceProxy *************************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct MetricsExporterInterfaceProxy
+{
+    static std::shared_ptr<MetricsExporter> init(std::string bind_address,
+                                                 unsigned short port,
+                                                 std::string endpoint,
+                                                 unsigned short num_threads);
+    static void start(MetricsExporter& self);
+    static void stop(MetricsExporter& self);
+    static bool is_running(const MetricsExporter& self);
+    static std::string render(MetricsExporter& self);
+
+    // Context manager methods
+    static MetricsExporter& enter(MetricsExporter& self);
+    static void exit(MetricsExporter& self,
+                     const pybind11::object& type,
+                     const pybind11::object& value,
+                     const pybind11::object& traceback);
+};
+
+#pragma GCC visibility pop
+/** @} */  // end of group
+}  // namespace morpheus
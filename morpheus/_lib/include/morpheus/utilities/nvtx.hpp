@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+/**
+ * @brief `MORPHEUS_NVTX_RANGE(name)` opens an NVTX range covering the rest of the enclosing scope, letting Nsight
+ * Systems attribute kernels and copies to the stage that issued them. Compiled out entirely unless
+ * `MORPHEUS_ENABLE_NVTX` is defined (controlled by the CMake option of the same name), so instrumented code has
+ * zero cost in un-instrumented builds. `name` must be a string literal.
+ */
+#ifdef MORPHEUS_ENABLE_NVTX
+    #include <nvtx3/nvToolsExt.h>
+
+namespace morpheus {
+
+struct NvtxScopedRange
+{
+    explicit NvtxScopedRange(const char* name)
+    {
+        nvtxRangePushA(name);
+    }
+
+    ~NvtxScopedRange()
+    {
+        nvtxRangePop();
+    }
+
+    NvtxScopedRange(const NvtxScopedRange&)            = delete;
+    NvtxScopedRange& operator=(const NvtxScopedRange&) = delete;
+};
+
+}  // namespace morpheus
+
+    #define MORPHEUS_NVTX_RANGE(name) morpheus::NvtxScopedRange morpheus_nvtx_range__{name}
+#else
+    #define MORPHEUS_NVTX_RANGE(name)
+#endif
@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>  // for async_resource_ref
+
+#include <cstddef>  // for size_t
+#include <memory>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** PinnedMemory***************************************/
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Helpers for allocating page-locked (pinned) host memory through RMM. Copies between the device and a
+ * pageable host buffer run at roughly half of achievable bandwidth and can never be fully asynchronous; staging
+ * through pinned memory restores both. The resource is device-accessible, so the returned buffers can be handed to
+ * anything expecting an `rmm::device_buffer` (e.g. `Tensor::create` or `DevMemInfo`).
+ *
+ * Allocations come from per-NUMA-node suballocating pools rather than straight from `cudaHostAlloc`: pinning is an
+ * expensive OS call, and on multi-socket hosts a staging buffer on the wrong socket gives up a large slice of
+ * memcpy bandwidth. Each pool is created (and its pages pinned, which also fixes their physical placement) by the
+ * first caller running on that node, with an initial span of `MORPHEUS_PINNED_POOL_SIZE` MiB.
+ */
+struct MORPHEUS_EXPORT PinnedMemory
+{
+    /**
+     * @brief The pooled pinned host memory resource for the NUMA node the calling thread is running on. The
+     * returned ref stays valid for the lifetime of the process and frees route back to the right pool regardless
+     * of which thread releases the buffer.
+     *
+     * @return cuda::mr::async_resource_ref<cuda::mr::device_accessible>
+     */
+    static cuda::mr::async_resource_ref<cuda::mr::device_accessible> resource();
+
+    /**
+     * @brief Allocates a buffer of `size_bytes` of pinned host memory associated with `stream`.
+     *
+     * @param size_bytes : Size of the buffer in bytes
+     * @param stream : Stream the buffer is associated with
+     * @return std::shared_ptr<rmm::device_buffer>
+     */
+    static std::shared_ptr<rmm::device_buffer> make_buffer(std::size_t size_bytes, rmm::cuda_stream_view stream);
+};
+/** @} */  // end of group
+}  // namespace morpheus
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"  // for MORPHEUS_EXPORT
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace morpheus {
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Lock-free log-bucketed latency histogram.
+ *
+ * Samples are nanosecond durations binned by their power-of-two magnitude, giving HDR-style relative precision
+ * across the full ns-to-seconds range with a fixed 64-bucket footprint. Counts are sharded across cache lines so
+ * concurrent progress engines recording into the same histogram do not contend; `record()` is two relaxed atomic
+ * increments and is safe to call from any thread. Percentiles read the bucket upper bounds and are therefore
+ * estimates with at most one octave of error, which is ample for spotting which stage a pipeline spends its time
+ * in.
+ */
+class MORPHEUS_EXPORT LatencyHistogram
+{
+  public:
+    static constexpr std::size_t BucketCount = 64;
+    static constexpr std::size_t ShardCount  = 8;
+
+    /**
+     * @brief Record a single sample.
+     *
+     * @param nanoseconds : Observed duration in nanoseconds.
+     */
+    void record(std::uint64_t nanoseconds) noexcept;
+
+    /**
+     * @brief Reset all counts to zero. Not atomic with respect to concurrent `record()` calls; intended for use
+     * between measurement windows.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Aggregate the shards and derive summary statistics.
+     *
+     * @return Map with keys `count`, `mean_us`, `p50_us`, `p95_us`, `p99_us` and `max_us`. Percentile and max
+     * values are bucket upper bounds in microseconds; all values are zero when no samples have been recorded.
+     */
+    std::map<std::string, double> stats() const;
+
+  private:
+    struct alignas(64) Shard
+    {
+        std::array<std::atomic<std::uint64_t>, BucketCount> buckets{};
+    };
+
+    std::array<Shard, ShardCount> m_shards;
+};
+
+/**
+ * @brief Process-wide registry of per-stage latency histograms.
+ *
+ * Stages obtain their histogram once (the `MORPHEUS_STAGE_TIMER` macro caches the lookup in a function-local
+ * static) and record into it lock-free; the registry mutex is only taken on first registration and when
+ * aggregating. Aggregated statistics are pollable from Python via `morpheus._lib.common.stage_latency_stats()` or
+ * from any endpoint handler able to call `all_stats()`.
+ */
+class MORPHEUS_EXPORT LatencyRegistry
+{
+  public:
+    static LatencyRegistry& instance();
+
+    /**
+     * @brief Return the histogram registered under `name`, creating it on first use. The returned reference
+     * remains valid for the lifetime of the process.
+     */
+    LatencyHistogram& get_or_create(const std::string& name);
+
+    /**
+     * @brief Aggregate every registered histogram, keyed by stage name.
+     */
+    std::map<std::string, std::map<std::string, double>> all_stats() const;
+
+    /**
+     * @brief Reset every registered histogram.
+     */
+    void reset_all();
+
+  private:
+    LatencyRegistry() = default;
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, std::unique_ptr<LatencyHistogram>> m_histograms;
+};
+
+/**
+ * @brief Records the elapsed wall time of the enclosing scope into a `LatencyHistogram` on destruction.
+ */
+class MORPHEUS_EXPORT ScopedLatencyTimer
+{
+  public:
+    explicit ScopedLatencyTimer(LatencyHistogram& histogram) :
+      m_histogram(histogram),
+      m_start(std::chrono::steady_clock::now())
+    {}
+
+    ~ScopedLatencyTimer()
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        m_histogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    ScopedLatencyTimer(const ScopedLatencyTimer&)            = delete;
+    ScopedLatencyTimer& operator=(const ScopedLatencyTimer&) = delete;
+
+  private:
+    LatencyHistogram& m_histogram;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
+
+/**
+ * @brief Time the rest of the enclosing scope into the registry histogram named `name`. The registry lookup runs
+ * once per call site; every subsequent pass costs two clock reads and two relaxed atomic increments. `name` must
+ * be a string literal.
+ */
+#define MORPHEUS_STAGE_TIMER(name)                                                                       \
+    static auto& morpheus_stage_histogram__ = morpheus::LatencyRegistry::instance().get_or_create(name); \
+    morpheus::ScopedLatencyTimer morpheus_stage_timer__                                                  \
+    {                                                                                                    \
+        morpheus_stage_histogram__                                                                       \
+    }
@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/export.h"  // for MORPHEUS_EXPORT
+
+#include <rmm/cuda_stream_pool.hpp>
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+
+namespace morpheus {
+
+/**
+ * @addtogroup utilities
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Process-wide pool of CUDA streams handed out per fiber.
+ *
+ * `rmm::cuda_stream_per_thread` keys streams on the OS thread, so fibers multiplexed onto a shared progress engine
+ * all enqueue onto the same stream and their device work serializes even though the stages run concurrently. The
+ * pool instead assigns each fiber its own stream (round-robin over a fixed set, cached in fiber-local storage), so
+ * independent stages overlap on the GPU.
+ *
+ * Stages plumb the borrowed stream through `MemoryDescriptor`, which `MatxUtil` and the tensor utilities already
+ * honor, keeping each message's device work ordered on one stream. Handoff to downstream stages is safe without
+ * explicit events: the pool's streams are blocking streams, so legacy-default-stream work (`cudaMemcpy`, cudf
+ * calls) implicitly synchronizes with them; producers that hand off to another non-default stream should block on
+ * `mrc::enqueue_stream_sync_event()` first, as the sync `MatxUtil` variants do.
+ */
+class MORPHEUS_EXPORT StreamPool
+{
+  public:
+    static constexpr std::size_t PoolSize = 16;
+
+    static StreamPool& instance();
+
+    /**
+     * @brief Return the stream assigned to the calling fiber, assigning one round-robin on first use. The view
+     * remains valid for the lifetime of the process. Threads not running a fiber scheduler are treated as a single
+     * fiber each.
+     */
+    rmm::cuda_stream_view stream_for_fiber();
+
+    /**
+     * @brief Shorthand for `instance().stream_for_fiber()`.
+     */
+    static rmm::cuda_stream_view get_stream();
+
+  private:
+    StreamPool();
+
+    rmm::cuda_stream_pool m_pool;
+};
+
+/** @} */  // end of group
+}  // namespace morpheus
@@ -17,8 +17,10 @@
 
 #include <cudf/io/types.hpp>
 #include <cudf/table/table.hpp>  // IWYU pragma: keep
+#include <cudf/types.hpp>        // for size_type
 
 #include <string>
+#include <vector>
 
 #pragma once
 
@@ -41,6 +43,27 @@ struct CuDFTableUtil
      * TODO(Documentation)
      */
     static cudf::io::table_with_metadata load_table(const std::string& filename);
+
+    /**
+     * @brief Concatenate tables sharing a schema into one table with a single `cudf::concatenate` call. The
+     * column names and types of every table must match the first; the first table's metadata carries over.
+     *
+     * @param tables Tables to combine, consumed by the call
+     * @return cudf::io::table_with_metadata
+     */
+    static cudf::io::table_with_metadata concat_tables(std::vector<cudf::io::table_with_metadata>&& tables);
+
+    /**
+     * @brief Concatenate tables into batches of roughly `target_rows` rows each. Tables are greedily packed in
+     * order until a batch reaches the target, so each output table is one device concatenation of whole input
+     * tables; rows are never split across outputs.
+     *
+     * @param tables Tables to combine, consumed by the call
+     * @param target_rows Row count a batch must reach before it is emitted
+     * @return std::vector<cudf::io::table_with_metadata>
+     */
+    static std::vector<cudf::io::table_with_metadata> concat_tables(
+        std::vector<cudf::io::table_with_metadata>&& tables, cudf::size_type target_rows);
 };
 /** @} */  // end of group
 }  // namespace morpheus
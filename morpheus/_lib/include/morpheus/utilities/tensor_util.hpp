@@ -18,7 +18,11 @@
 #pragma once
 
 #include "morpheus/export.h"
-#include "morpheus/types.hpp"  // for ShapeType, TensorIndex
+#include "morpheus/objects/tensor_object.hpp"  // for TensorObject
+#include "morpheus/types.hpp"                  // for ShapeType, TensorIndex
+
+#include <cuda_runtime.h>               // for cudaMemcpyKind, cudaStream_t
+#include <cudf/column/column_view.hpp>  // for column_view
 
 #include <algorithm>   // IWYU pragma: keep
 #include <functional>  // for multiplies
@@ -86,6 +90,48 @@ struct MORPHEUS_EXPORT TensorUtils
      */
     static bool validate_shape_and_stride(const ShapeType& shape, const ShapeType& stride);
 
+    /**
+     * @brief Copies the contents of `tensor` into the device memory backing `cv`, checking that the sizes and types
+     * are compatible. Runs entirely on the device, no GIL or python object is involved.
+     *
+     * @param cv : Column view to write into
+     * @param tensor : Tensor holding the new values
+     */
+    static void copy_to_column(const cudf::column_view& cv, const TensorObject& tensor);
+
+    /**
+     * @brief Copies the contents of `tensor` into `dst`, compacting it in the process. Compact tensors move with a
+     * single flat copy; 2D row-strided tensors (the layout a row slice of an `RMMTensor` produces) move with a
+     * single `cudaMemcpy2D`, never one transfer per row or per element. `dst` must hold `tensor.bytes()` bytes.
+     *
+     * @param tensor : Tensor holding the values to copy
+     * @param dst : Destination pointer, on the side implied by `kind`
+     * @param kind : Direction of the copy
+     */
+    static void copy_compact(const TensorObject& tensor, void* dst, cudaMemcpyKind kind);
+
+    /**
+     * @brief Asynchronous variant of `copy_compact`, enqueued on `stream`. The caller owns synchronization.
+     *
+     * @param tensor : Tensor holding the values to copy
+     * @param dst : Destination pointer, on the side implied by `kind`
+     * @param kind : Direction of the copy
+     * @param stream : Stream the copy is issued on
+     */
+    static void copy_compact_async(const TensorObject& tensor, void* dst, cudaMemcpyKind kind, cudaStream_t stream);
+
+    /**
+     * @brief Returns `tensor` resident on `device_id`, the handoff a stage placed on another device performs before
+     * touching an upstream tensor. When the tensor already lives there (per its `MemoryDescriptor`) the same handle
+     * is returned and nothing moves; otherwise a compacted copy is allocated on the target device and filled with a
+     * single transfer, peer-to-peer when `DeviceUtil::ensure_peer_access` could enable it.
+     *
+     * @param tensor : Tensor to relocate
+     * @param device_id : Device the result must live on
+     * @return TensorObject
+     */
+    static TensorObject copy_to_device(const TensorObject& tensor, int device_id);
+
     /**
      * @brief Returns a stride expressed in terms of elements given a stride expressed either in terms of bytes or
      * elements.
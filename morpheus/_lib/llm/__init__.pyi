@@ -15,12 +15,14 @@ import mrc.core.segment
 __all__ = [
     "InputMap",
     "LLMContext",
+    "LLMEmbeddingNode",
     "LLMEngine",
     "LLMEngineStage",
     "LLMLambdaNode",
     "LLMNode",
     "LLMNodeBase",
     "LLMNodeRunner",
+    "LLMRetrieverNode",
     "LLMTask",
     "LLMTaskHandler"
 ]
@@ -68,8 +70,10 @@ class LLMContext():
     @typing.overload
     def get_input(self, node_name: str) -> object: ...
     def get_inputs(self) -> dict: ...
+    def is_streaming(self) -> bool: ...
     def message(self) -> morpheus._lib.messages.ControlMessage: ...
     def push(self, name: str, inputs: typing.List[InputMap]) -> LLMContext: ...
+    def stream_output(self, chunk: object) -> typing.Awaitable[None]: ...
     @typing.overload
     def set_output(self, output_name: str, output: object) -> None: ...
     @typing.overload
@@ -161,8 +165,11 @@ class LLMEngine(LLMNode, LLMNodeBase):
     def __init__(self) -> None: ...
     def add_task_handler(self, inputs: typing.List[typing.Union[InputMap, str, typing.Tuple[str, str], LLMNodeRunner]], handler: LLMTaskHandler) -> None: ...
     def run(self, message: morpheus._lib.messages.ControlMessage) -> typing.Awaitable[typing.List[morpheus._lib.messages.ControlMessage]]: ...
+    def run_batch(self, messages: typing.List[morpheus._lib.messages.ControlMessage]) -> typing.Awaitable[typing.List[morpheus._lib.messages.ControlMessage]]: ...
+    def set_max_concurrent_handlers(self, max_concurrent: int) -> None: ...
     pass
 class LLMNodeRunner():
+    def enable_cache(self, ttl_seconds: int, max_entries: int = 1024) -> None: ...
     def execute(self, context: LLMContext) -> typing.Awaitable[LLMContext]: ...
     @property
     def inputs(self) -> typing.List[InputMap]:
@@ -185,6 +192,54 @@ class LLMNodeRunner():
         :type: typing.List[str]
         """
     pass
+class LLMEmbeddingNode(LLMNodeBase):
+    def __init__(self, input_tensor_name: str, output_tensor_name: str, pool_size: int) -> None:
+        """
+        Post-processes raw token embeddings into sequence embeddings on device.
+
+        The input tensor on the message's TensorMemory holds `pool_size` token vectors per sequence; a
+        fused kernel mean-pools each group and L2-normalizes the result, replacing the message's
+        token-level tensor memory with sequence-level memory holding the pooled embeddings. The data
+        never leaves the GPU.
+
+        Parameters
+        ----------
+        input_tensor_name : str
+            Name of the token-embedding tensor on the message's tensor memory, shaped
+            `[sequences * pool_size, dim]`
+
+        output_tensor_name : str
+            Name the pooled `[sequences, dim]` tensor is stored under
+
+        pool_size : int
+            Number of token vectors pooled into each sequence embedding
+        """
+    pass
+class LLMRetrieverNode(LLMNodeBase):
+    def __init__(self, embeddings: typing.List[float], documents: typing.Sequence, dim: int, k: int) -> None:
+        """
+        In-process nearest-neighbor retrieval against a device-resident embedding index.
+
+        The corpus embeddings are uploaded to the GPU once at construction. Each execution scores the
+        "query" input (a single embedding, or a list of embeddings) against the whole index by inner
+        product and outputs "documents" and "scores", one list of `k` entries per query, best match
+        first. Normalize the embeddings up front to retrieve by cosine similarity.
+
+        Parameters
+        ----------
+        embeddings : list[float]
+            Row-major corpus embeddings, `len(documents) * dim` values
+
+        documents : list
+            One payload per corpus row, returned verbatim for matched rows
+
+        dim : int
+            Embedding dimension
+
+        k : int
+            Number of neighbors to return per query, clamped to the corpus size
+        """
+    pass
 class LLMTask():
     def __getitem__(self, key: str) -> object: ...
     @typing.overload
@@ -226,6 +281,23 @@ class LLMTaskHandler():
         context : `morpheus._lib.llm.LLMContext`
             Context instance to use for the execution
 
+        Returns
+        -------
+        Task[Optional[list[ControlMessage]]]
+        """
+    def try_handle_chunk(self, context: LLMContext, chunk: object) -> typing.Awaitable[typing.Optional[typing.List[morpheus._lib.messages.ControlMessage]]]: 
+        """
+        Convert an incremental output chunk into partial `ControlMessage` instances. Returning `None`
+        declines the chunk, which is the default behavior.
+
+        Parameters
+        ----------
+        context : `morpheus._lib.llm.LLMContext`
+            Context instance to use for the execution
+
+        chunk : object
+            Incremental output value streamed by a node
+
         Returns
         -------
         Task[Optional[list[ControlMessage]]]
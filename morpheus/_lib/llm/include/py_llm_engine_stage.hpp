@@ -63,6 +63,7 @@
 #include <condition_variable>
 #include <coroutine>
 #include <cstddef>
+#include <exception>
 #include <functional>
 #include <map>
 #include <memory>
@@ -93,20 +94,72 @@ class MORPHEUS_EXPORT PyLLMEngineStage
     }
 
   private:
+    using message_buffer_t = mrc::coroutines::ClosableRingBuffer<std::shared_ptr<ControlMessage>>;
+
     mrc::coroutines::AsyncGenerator<std::shared_ptr<ControlMessage>> on_data(
         std::shared_ptr<ControlMessage>&& data) override
     {
-        auto result = co_await m_engine->run(std::move(data));
+        // Run the engine as a sibling coroutine funneling messages through a ring buffer, so partial messages
+        // built by streaming task handlers reach downstream stages before the full generation completes
+        message_buffer_t messages{{.capacity = 8}};
+        std::exception_ptr error;
+
+        auto producer = run_engine(std::move(data), messages, error);
+        producer.resume();
+
+        while (true)
+        {
+            auto message = co_await messages.read();
+
+            if (!message)
+            {
+                // The buffer was closed, the engine run is complete
+                break;
+            }
 
-        // Push the output messages
-        for (auto&& out_message : result)
+            co_yield std::move(*message);
+        }
+
+        if (error)
         {
-            co_yield std::move(out_message);
+            std::rethrow_exception(error);
         }
 
         co_return;
     }
 
+    static mrc::coroutines::Task<void> write_message(message_buffer_t& messages,
+                                                     std::shared_ptr<ControlMessage> message)
+    {
+        co_await messages.write(std::move(message));
+    }
+
+    mrc::coroutines::Task<void> run_engine(std::shared_ptr<ControlMessage> message,
+                                           message_buffer_t& messages,
+                                           std::exception_ptr& error)
+    {
+        try
+        {
+            auto results = co_await m_engine->run(std::move(message),
+                                                  [&messages](std::shared_ptr<ControlMessage> partial_message) {
+                                                      return write_message(messages, std::move(partial_message));
+                                                  });
+
+            // Push the final output messages behind any partials
+            for (auto&& out_message : results)
+            {
+                co_await messages.write(std::move(out_message));
+            }
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        // Unblocks the generator, which rethrows any captured error once the buffer drains
+        messages.close();
+    }
+
     std::shared_ptr<LLMEngine> m_engine;
 };
 
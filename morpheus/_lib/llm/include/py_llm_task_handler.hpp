@@ -21,6 +21,8 @@
 #include "morpheus/llm/llm_task_handler.hpp"
 #include "morpheus/types.hpp"
 
+#include <nlohmann/json.hpp>
+
 #include <memory>
 #include <string>
 #include <vector>
@@ -37,6 +39,9 @@ class PyLLMTaskHandler : public LLMTaskHandler
     std::vector<std::string> get_input_names() const override;
 
     Task<LLMTaskHandler::return_t> try_handle(std::shared_ptr<LLMContext> context) override;
+
+    Task<LLMTaskHandler::return_t> try_handle_chunk(std::shared_ptr<LLMContext> context,
+                                                    const nlohmann::json& chunk) override;
 };
 
 }  // namespace morpheus::llm
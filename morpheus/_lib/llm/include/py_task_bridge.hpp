@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <pymrc/types.hpp>  // for PyHolder
+
+#include <coroutine>
+#include <mutex>
+#include <vector>
+
+namespace morpheus::llm {
+
+/**
+ * @brief Collects the C++ coroutine handles whose python awaitables completed during the current event-loop
+ * tick and resumes them in a single pass.
+ *
+ * Resuming each completion individually costs a GIL release and reacquire per awaited task. The batcher
+ * instead schedules a single drain on the running loop via `call_soon`, so however many completions land in
+ * the same tick are resumed under one GIL release.
+ */
+class PyTaskCompletionBatcher
+{
+  public:
+    static PyTaskCompletionBatcher& instance();
+
+    /**
+     * @brief Queue a coroutine handle for resumption, scheduling a drain on the running event loop if one is
+     * not already pending. Must be called with the GIL held, from the event-loop thread.
+     */
+    void enqueue(std::coroutine_handle<> handle);
+
+  private:
+    void drain();
+
+    std::mutex m_mutex;
+    std::vector<std::coroutine_handle<>> m_pending;
+    bool m_drain_scheduled{false};
+};
+
+/**
+ * @brief Awaitable adapting a python asyncio task into the C++ `Task<>` chain.
+ *
+ * Tasks that are already complete resume the awaiting coroutine inline without suspending at all. Pending
+ * tasks register a done-callback that routes through `PyTaskCompletionBatcher`, so the coroutine is resumed
+ * on the event-loop thread without a dedicated thread hop per await. Continuations run on the loop thread
+ * until their next suspension point, so heavy post-await work should be offloaded.
+ */
+class PyTaskAwaitable
+{
+  public:
+    explicit PyTaskAwaitable(mrc::pymrc::PyHolder task);
+
+    bool await_ready() const;
+    bool await_suspend(std::coroutine_handle<> handle);
+    mrc::pymrc::PyHolder await_resume();
+
+  private:
+    mrc::pymrc::PyHolder m_task;
+};
+
+}  // namespace morpheus::llm
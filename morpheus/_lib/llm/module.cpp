@@ -24,16 +24,17 @@
 
 #include "morpheus/llm/input_map.hpp"
 #include "morpheus/llm/llm_context.hpp"
+#include "morpheus/llm/llm_embedding_node.hpp"
 #include "morpheus/llm/llm_engine.hpp"
 #include "morpheus/llm/llm_node.hpp"
 #include "morpheus/llm/llm_node_base.hpp"
 #include "morpheus/llm/llm_node_runner.hpp"
+#include "morpheus/llm/llm_retriever_node.hpp"
 #include "morpheus/llm/llm_task.hpp"
 #include "morpheus/llm/llm_task_handler.hpp"
 #include "morpheus/messages/control.hpp"    // IWYU pragma: keep
 #include "morpheus/pybind11/input_map.hpp"  // IWYU pragma: keep
 #include "morpheus/pybind11/json.hpp"       // IWYU pragma: keep
-#include "morpheus/utilities/cudf_util.hpp"
 #include "morpheus/utilities/json_types.hpp"
 #include "morpheus/version.hpp"
 
@@ -49,6 +50,8 @@
 #include <pymrc/coro.hpp>         // IWYU pragma: keep
 #include <pymrc/utils.hpp>        // for pymrc::import
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -70,9 +73,6 @@ PYBIND11_MODULE(llm, _module)
 
         )pbdoc";
 
-    // Load the cudf helpers
-    CudfHelper::load();
-
     // Import the mrc coro module
     mrc::pymrc::import(_module, "mrc.core.coro");
 
@@ -201,15 +201,29 @@ PYBIND11_MODULE(llm, _module)
              py::arg("node_name"))
         .def("get_inputs",
              [](LLMContext& self) {
-                 // Convert the return value
-                 return mrc::pymrc::cast_from_json(self.get_inputs()).cast<py::dict>();
+                 // Cast each input straight from its stored value, skipping the intermediate json copy of the
+                 // whole input set that LLMContext::get_inputs() would build
+                 py::dict inputs;
+
+                 for (const auto& in_map : self.input_map())
+                 {
+                     inputs[in_map.internal_name.c_str()] = mrc::pymrc::cast_from_json(
+                         self.get_input(in_map.internal_name));
+                 }
+
+                 return inputs;
              })
         .def("set_output", py::overload_cast<nlohmann::json>(&LLMContext::set_output), py::arg("outputs"))
         .def("set_output",
              py::overload_cast<const std::string&, nlohmann::json>(&LLMContext::set_output),
              py::arg("output_name"),
              py::arg("output"))
-        .def("push", &LLMContext::push, py::arg("name"), py::arg("inputs"));
+        .def("push",
+             py::overload_cast<std::string, input_mappings_t>(&LLMContext::push),
+             py::arg("name"),
+             py::arg("inputs"))
+        .def("is_streaming", &LLMContext::is_streaming)
+        .def("stream_output", &LLMContext::stream_output, py::arg("chunk"));
 
     py::class_<LLMNodeBase, PyLLMNodeBase<>, std::shared_ptr<LLMNodeBase>>(_module, "LLMNodeBase")
         .def(py::init_alias<>())
@@ -246,7 +260,16 @@ PYBIND11_MODULE(llm, _module)
         .def_property_readonly("name", &LLMNodeRunner::name)
         .def_property_readonly("parent_input_names", &LLMNodeRunner::parent_input_names)
         .def_property_readonly("sibling_input_names", &LLMNodeRunner::sibling_input_names)
-        .def("execute", &LLMNodeRunner::execute, py::arg("context"));
+        .def("execute", &LLMNodeRunner::execute, py::arg("context"))
+        .def(
+            "enable_cache",
+            [](LLMNodeRunner& self, std::size_t ttl_seconds, std::size_t max_entries) {
+                self.enable_cache(std::chrono::seconds(ttl_seconds), max_entries);
+            },
+            py::arg("ttl_seconds"),
+            py::arg("max_entries") = 1024,
+            "Cache this node's outputs keyed by its resolved inputs, skipping execution on an exact match within "
+            "the TTL. Only use for nodes whose outputs depend solely on their inputs.");
 
     py::class_<LLMNode, LLMNodeBase, PyLLMNode<>, std::shared_ptr<LLMNode>>(_module, "LLMNode")
         .def(py::init_alias<>())
@@ -295,6 +318,74 @@ PYBIND11_MODULE(llm, _module)
 
             )pbdoc");
 
+    py::class_<LLMEmbeddingNode, LLMNodeBase, std::shared_ptr<LLMEmbeddingNode>>(_module, "LLMEmbeddingNode")
+        .def(py::init<std::string, std::string, int>(),
+             py::arg("input_tensor_name"),
+             py::arg("output_tensor_name"),
+             py::arg("pool_size"),
+             R"pbdoc(
+                Post-processes raw token embeddings into sequence embeddings on device.
+
+                The input tensor on the message's TensorMemory holds `pool_size` token vectors per sequence; a
+                fused kernel mean-pools each group and L2-normalizes the result, replacing the message's
+                token-level tensor memory with sequence-level memory holding the pooled embeddings. The data
+                never leaves the GPU.
+
+                Parameters
+                ----------
+                input_tensor_name : str
+                    Name of the token-embedding tensor on the message's tensor memory, shaped
+                    `[sequences * pool_size, dim]`
+
+                output_tensor_name : str
+                    Name the pooled `[sequences, dim]` tensor is stored under
+
+                pool_size : int
+                    Number of token vectors pooled into each sequence embedding
+
+             )pbdoc");
+
+    py::class_<LLMRetrieverNode, LLMNodeBase, std::shared_ptr<LLMRetrieverNode>>(_module, "LLMRetrieverNode")
+        .def(py::init([](const std::vector<float>& embeddings, py::sequence documents, int dim, int k) {
+                 std::vector<nlohmann::json> converted_documents;
+                 converted_documents.reserve(py::len(documents));
+
+                 for (const auto& document : documents)
+                 {
+                     converted_documents.push_back(
+                         mrc::pymrc::cast_from_pyobject(py::reinterpret_borrow<py::object>(document)));
+                 }
+
+                 return std::make_shared<LLMRetrieverNode>(embeddings, std::move(converted_documents), dim, k);
+             }),
+             py::arg("embeddings"),
+             py::arg("documents"),
+             py::arg("dim"),
+             py::arg("k"),
+             R"pbdoc(
+                In-process nearest-neighbor retrieval against a device-resident embedding index.
+
+                The corpus embeddings are uploaded to the GPU once at construction. Each execution scores the
+                "query" input (a single embedding, or a list of embeddings) against the whole index by inner
+                product and outputs "documents" and "scores", one list of `k` entries per query, best match
+                first. Normalize the embeddings up front to retrieve by cosine similarity.
+
+                Parameters
+                ----------
+                embeddings : list[float]
+                    Row-major corpus embeddings, `len(documents) * dim` values
+
+                documents : list
+                    One payload per corpus row, returned verbatim for matched rows
+
+                dim : int
+                    Embedding dimension
+
+                k : int
+                    Number of neighbors to return per query, clamped to the corpus size
+
+             )pbdoc");
+
     py::class_<LLMTaskHandler, PyLLMTaskHandler, std::shared_ptr<LLMTaskHandler>>(
         _module, "LLMTaskHandler", "Acts as a sink for an `LLMEngine`, emitting results as a `ControlMessage`")
         .def(py::init<>())
@@ -324,12 +415,35 @@ PYBIND11_MODULE(llm, _module)
                 -------
                 Task[Optional[list[ControlMessage]]]
 
+              )pbdoc")
+        .def("try_handle_chunk",
+             &LLMTaskHandler::try_handle_chunk,
+             py::arg("context"),
+             py::arg("chunk"),
+             R"pbdoc(
+                Convert an incremental output chunk into partial `ControlMessage` instances. Returning `None`
+                declines the chunk, which is the default behavior.
+
+                Parameters
+                ----------
+                context : `morpheus._lib.llm.LLMContext`
+                    Context instance to use for the execution
+
+                chunk : object
+                    Incremental output value streamed by a node
+
+                Returns
+                -------
+                Task[Optional[list[ControlMessage]]]
+
               )pbdoc");
 
     py::class_<LLMEngine, LLMNode, PyLLMEngine, std::shared_ptr<LLMEngine>>(_module, "LLMEngine")
         .def(py::init_alias<>())
         .def("add_task_handler", &LLMEngine::add_task_handler, py::arg("inputs"), py::arg("handler"))
-        .def("run", &LLMEngine::run, py::arg("message"));
+        .def("set_max_concurrent_handlers", &LLMEngine::set_max_concurrent_handlers, py::arg("max_concurrent"))
+        .def("run", py::overload_cast<std::shared_ptr<ControlMessage>>(&LLMEngine::run), py::arg("message"))
+        .def("run_batch", &LLMEngine::run_batch, py::arg("messages"));
 
     py::class_<PyLLMLambdaNode, LLMNodeBase, std::shared_ptr<PyLLMLambdaNode>>(_module, "LLMLambdaNode")
         .def(py::init<>([](py::function fn) {
@@ -17,19 +17,19 @@
 
 #include "py_llm_lambda_node.hpp"
 
-#include "pymrc/coro.hpp"
+#include "py_task_bridge.hpp"
 
 #include "morpheus/llm/llm_context.hpp"
 #include "morpheus/llm/llm_node_base.hpp"
 #include "morpheus/utilities/json_types.hpp"
 #include "morpheus/utilities/string_util.hpp"
 
+#include <glog/logging.h>           // for DCHECK_EQ
 #include <mrc/coroutines/task.hpp>  // IWYU pragma: keep
 #include <pybind11/cast.h>
 #include <pybind11/gil.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
-#include <pymrc/coro.hpp>  // IWYU pragma: keep
 #include <pymrc/types.hpp>
 #include <pymrc/utils.hpp>
 
@@ -91,14 +91,17 @@ std::vector<std::string> PyLLMLambdaNode::get_input_names() const
 
 Task<std::shared_ptr<LLMContext>> PyLLMLambdaNode::execute(std::shared_ptr<LLMContext> context)
 {
-    // Get the inputs. This will be a dictionary
-    auto inputs = context->get_inputs();
-
     // Grab the GIL
     pybind11::gil_scoped_acquire gil;
 
-    // Convert to python dictionary
-    auto py_inputs = mrc::pymrc::cast_from_json(std::move(inputs));
+    // Convert the inputs to a python dictionary, casting each value straight from its stored form instead of
+    // copying the whole input set into an intermediate json object first
+    pybind11::dict py_inputs;
+
+    for (const auto& in_map : context->input_map())
+    {
+        py_inputs[in_map.internal_name.c_str()] = mrc::pymrc::cast_from_json(context->get_input(in_map.internal_name));
+    }
 
     // Call the function
     auto py_coro = m_fn(**py_inputs);
@@ -114,10 +117,14 @@ Task<std::shared_ptr<LLMContext>> PyLLMLambdaNode::execute(std::shared_ptr<LLMCo
     }
 
     auto o_task = asyncio_module.attr("create_task")(py_coro);
+
+    // Await through the native bridge: completions batched per event-loop tick, no thread hop per await
+    PyTaskAwaitable awaitable{mrc::pymrc::PyHolder(std::move(o_task))};
+
     mrc::pymrc::PyHolder o_result;
     {
         pybind11::gil_scoped_release nogil;
-        o_result = co_await mrc::pymrc::coro::PyTaskToCppAwaitable(std::move(o_task));
+        o_result = co_await awaitable;
         DCHECK_EQ(PyGILState_Check(), 0) << "Should not have the GIL after returning from co_await";
     }
 
@@ -18,6 +18,7 @@
 #include "py_llm_task_handler.hpp"
 
 #include "morpheus/llm/llm_context.hpp"
+#include "morpheus/pybind11/json.hpp"  // IWYU pragma: keep
 
 #include <mrc/coroutines/task.hpp>  // IWYU pragma: keep
 #include <pybind11/pybind11.h>
@@ -41,4 +42,10 @@ Task<LLMTaskHandler::return_t> PyLLMTaskHandler::try_handle(std::shared_ptr<LLMC
     MRC_PYBIND11_OVERRIDE_CORO_PURE(LLMTaskHandler::return_t, LLMTaskHandler, try_handle, context);
 }
 
+Task<LLMTaskHandler::return_t> PyLLMTaskHandler::try_handle_chunk(std::shared_ptr<LLMContext> context,
+                                                                  const nlohmann::json& chunk)
+{
+    MRC_PYBIND11_OVERRIDE_CORO(LLMTaskHandler::return_t, LLMTaskHandler, try_handle_chunk, context, chunk);
+}
+
 }  // namespace morpheus::llm
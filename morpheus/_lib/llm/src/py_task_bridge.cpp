@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "py_task_bridge.hpp"
+
+#include <pybind11/gil.h>
+#include <pybind11/pybind11.h>
+
+#include <coroutine>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace morpheus::llm {
+namespace py = pybind11;
+
+PyTaskCompletionBatcher& PyTaskCompletionBatcher::instance()
+{
+    static PyTaskCompletionBatcher batcher;
+
+    return batcher;
+}
+
+void PyTaskCompletionBatcher::enqueue(std::coroutine_handle<> handle)
+{
+    bool schedule_drain = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_pending.push_back(handle);
+
+        if (!m_drain_scheduled)
+        {
+            m_drain_scheduled = true;
+            schedule_drain    = true;
+        }
+    }
+
+    if (schedule_drain)
+    {
+        auto loop = py::module_::import("asyncio").attr("get_running_loop")();
+        loop.attr("call_soon")(py::cpp_function([this]() {
+            this->drain();
+        }));
+    }
+}
+
+void PyTaskCompletionBatcher::drain()
+{
+    std::vector<std::coroutine_handle<>> completed;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        completed.swap(m_pending);
+        m_drain_scheduled = false;
+    }
+
+    // A single GIL release covers every completion that landed this tick
+    py::gil_scoped_release nogil;
+
+    for (auto& handle : completed)
+    {
+        handle.resume();
+    }
+}
+
+PyTaskAwaitable::PyTaskAwaitable(mrc::pymrc::PyHolder task) : m_task(std::move(task)) {}
+
+bool PyTaskAwaitable::await_ready() const
+{
+    py::gil_scoped_acquire gil;
+
+    const py::object& task = m_task;
+
+    return task.attr("done")().cast<bool>();
+}
+
+bool PyTaskAwaitable::await_suspend(std::coroutine_handle<> handle)
+{
+    py::gil_scoped_acquire gil;
+
+    const py::object& task = m_task;
+
+    // The task may have finished between await_ready and the suspension, resume inline in that case
+    if (task.attr("done")().cast<bool>())
+    {
+        return false;
+    }
+
+    task.attr("add_done_callback")(py::cpp_function([handle](const py::object& /*task*/) {
+        PyTaskCompletionBatcher::instance().enqueue(handle);
+    }));
+
+    return true;
+}
+
+mrc::pymrc::PyHolder PyTaskAwaitable::await_resume()
+{
+    py::gil_scoped_acquire gil;
+
+    const py::object& task = m_task;
+
+    // `result` re-raises as error_already_set when the task failed, propagating through the coroutine chain
+    return {task.attr("result")()};
+}
+
+}  // namespace morpheus::llm
@@ -68,12 +68,15 @@ class ControlMessage():
     def payload(self, arg0: MessageMeta) -> None: ...
     @typing.overload
     def payload(self, meta: object) -> None: ...
+    def payload_slice(self, start: int, stop: int = -1, columns: typing.List[str] = []) -> MessageMeta: ...
     def remove_task(self, task_type: str) -> dict: ...
+    def remove_tasks(self, task_type: str) -> list: ...
     def set_metadata(self, key: str, value: object) -> None: ...
     def set_timestamp(self, key: str, timestamp: object) -> None: 
         """
         Set a timestamp for a given key and group.
         """
+    def task_payload(self, task: dict) -> MessageMeta: ...
     @typing.overload
     def task_type(self) -> ControlMessageType: ...
     @typing.overload
@@ -125,12 +128,15 @@ class DataLoaderRegistry():
     @staticmethod
     def register_loader(name: str, loader: typing.Callable[[ControlMessage, dict], ControlMessage], throw_if_exists: bool = True) -> None: ...
     @staticmethod
+    def register_loader_batched(name: str, loader: typing.Callable[[typing.List[ControlMessage], typing.List[dict]], typing.List[ControlMessage]], throw_if_exists: bool = True) -> None: ...
+    @staticmethod
     def unregister_loader(name: str, throw_if_not_exists: bool = True) -> None: ...
     pass
 class DataTable():
     pass
 class TensorMemory():
     def __init__(self, *, count: int, tensors: object = None) -> None: ...
+    def copy_to_device(self, device_id: int) -> TensorMemory: ...
     def get_tensor(self, name: str) -> object: ...
     def get_tensors(self) -> typing.Dict[str, object]: ...
     def has_tensor(self, arg0: str) -> bool: ...
@@ -182,12 +188,19 @@ class InferenceMemoryNLP(InferenceMemory, TensorMemory):
 class MessageMeta():
     def __init__(self, df: object) -> None: ...
     def copy_dataframe(self) -> object: ...
+    def dictionary_decode(self, columns: typing.List[str] = []) -> None: ...
+    def dictionary_encode(self, columns: typing.List[str]) -> None: ...
     def ensure_sliceable_index(self) -> typing.Optional[str]: ...
+    @staticmethod
+    def from_arrow_ipc(data: bytes) -> MessageMeta: ...
     def get_column_names(self) -> typing.List[str]: ...
     def has_sliceable_index(self) -> bool: ...
     @staticmethod
     def make_from_file(arg0: str) -> MessageMeta: ...
     def mutable_dataframe(self) -> MutableTableCtxMgr: ...
+    def pack(self) -> tuple: ...
+    @staticmethod
+    def unpack(metadata: bytes, gpu_data: object, index_col_count: int, column_names: typing.List[str]) -> MessageMeta: ...
     @property
     def count(self) -> int:
         """
@@ -349,4 +362,12 @@ class InferenceMemoryFIL(InferenceMemory, TensorMemory):
     def seq_ids(self, arg1: object) -> None:
         pass
     pass
+def to_control_message(multi: MultiMessage) -> ControlMessage: 
+    """
+    Re-wrap a MultiMessage as a ControlMessage sharing the same data, honoring offsets and counts with zero-copy views.
+    """
+def to_multi_message(control: ControlMessage) -> MultiMessage: 
+    """
+    Re-wrap a ControlMessage payload (and tensors, when present) as a MultiMessage sharing the same data.
+    """
 __version__ = '24.3.0'
@@ -19,6 +19,7 @@
 
 #include "morpheus/io/data_loader_registry.hpp"
 #include "morpheus/messages/control.hpp"
+#include "morpheus/messages/convert.hpp"
 #include "morpheus/messages/memory/inference_memory.hpp"
 #include "morpheus/messages/memory/inference_memory_fil.hpp"
 #include "morpheus/messages/memory/inference_memory_nlp.hpp"
@@ -35,7 +36,6 @@
 #include "morpheus/messages/multi_tensor.hpp"
 #include "morpheus/objects/data_table.hpp"
 #include "morpheus/objects/mutable_table_ctx_mgr.hpp"
-#include "morpheus/utilities/cudf_util.hpp"
 #include "morpheus/utilities/string_util.hpp"
 #include "morpheus/version.hpp"
 
@@ -70,9 +70,6 @@ PYBIND11_MODULE(messages, _module)
 
         )pbdoc";
 
-    // Load the cudf helpers
-    CudfHelper::load();
-
     mrc::pymrc::import(_module, "cupy");
     mrc::pymrc::import(_module, "morpheus._lib.common");
 
@@ -156,7 +153,8 @@ PYBIND11_MODULE(messages, _module)
         .def("get_tensors", &TensorMemoryInterfaceProxy::get_tensors, py::return_value_policy::move)
         .def("set_tensors", &TensorMemoryInterfaceProxy::set_tensors, py::arg("tensors"))
         .def("get_tensor", &TensorMemoryInterfaceProxy::get_tensor, py::arg("name"), py::return_value_policy::move)
-        .def("set_tensor", &TensorMemoryInterfaceProxy::set_tensor, py::arg("name"), py::arg("tensor"));
+        .def("set_tensor", &TensorMemoryInterfaceProxy::set_tensor, py::arg("name"), py::arg("tensor"))
+        .def("copy_to_device", &TensorMemoryInterfaceProxy::copy_to_device, py::arg("device_id"));
 
     py::class_<InferenceMemory, TensorMemory, std::shared_ptr<InferenceMemory>>(_module, "InferenceMemory")
         .def(py::init<>(&InferenceMemoryInterfaceProxy::init),
@@ -226,7 +224,19 @@ PYBIND11_MODULE(messages, _module)
         .def("mutable_dataframe", &MessageMetaInterfaceProxy::mutable_dataframe, py::return_value_policy::move)
         .def("has_sliceable_index", &MessageMetaInterfaceProxy::has_sliceable_index)
         .def("ensure_sliceable_index", &MessageMetaInterfaceProxy::ensure_sliceable_index)
-        .def_static("make_from_file", &MessageMetaInterfaceProxy::init_cpp);
+        .def("dictionary_encode", &MessageMetaInterfaceProxy::dictionary_encode, py::arg("columns"))
+        .def("dictionary_decode",
+             &MessageMetaInterfaceProxy::dictionary_decode,
+             py::arg("columns") = std::vector<std::string>())
+        .def("pack", &MessageMetaInterfaceProxy::pack)
+        .def_static("unpack",
+                    &MessageMetaInterfaceProxy::unpack,
+                    py::arg("metadata"),
+                    py::arg("gpu_data"),
+                    py::arg("index_col_count"),
+                    py::arg("column_names"))
+        .def_static("make_from_file", &MessageMetaInterfaceProxy::init_cpp)
+        .def_static("from_arrow_ipc", &MessageMetaInterfaceProxy::init_from_arrow_ipc, py::arg("data"));
 
     py::class_<MultiMessage, std::shared_ptr<MultiMessage>>(_module, "MultiMessage")
         .def(py::init<>(&MultiMessageInterfaceProxy::init),
@@ -392,14 +402,21 @@ PYBIND11_MODULE(messages, _module)
         .def("has_task", &ControlMessage::has_task, py::arg("task_type"))
         .def("list_metadata", &ControlMessageProxy::list_metadata)
         .def("payload", pybind11::overload_cast<>(&ControlMessage::payload))
-        .def("payload", pybind11::overload_cast<const std::shared_ptr<MessageMeta>&>(&ControlMessage::payload))
+        .def("payload", pybind11::overload_cast<std::shared_ptr<MessageMeta>>(&ControlMessage::payload))
         .def(
             "payload",
             pybind11::overload_cast<ControlMessage&, const py::object&>(&ControlMessageProxy::payload_from_python_meta),
             py::arg("meta"))
+        .def("payload_slice",
+             &ControlMessage::payload_slice,
+             py::arg("start"),
+             py::arg("stop")    = -1,
+             py::arg("columns") = std::vector<std::string>())
+        .def("task_payload", &ControlMessageProxy::task_payload, py::arg("task"))
         .def("tensors", pybind11::overload_cast<>(&ControlMessage::tensors))
         .def("tensors", pybind11::overload_cast<const std::shared_ptr<TensorMemory>&>(&ControlMessage::tensors))
         .def("remove_task", &ControlMessageProxy::remove_task, py::arg("task_type"))
+        .def("remove_tasks", &ControlMessageProxy::remove_tasks, py::arg("task_type"))
         .def("set_metadata", &ControlMessageProxy::set_metadata, py::arg("key"), py::arg("value"))
         .def("task_type", pybind11::overload_cast<>(&ControlMessage::task_type))
         .def(
@@ -413,11 +430,28 @@ PYBIND11_MODULE(messages, _module)
                     py::arg("name"),
                     py::arg("loader"),
                     py::arg("throw_if_exists") = true)
+        .def_static("register_loader_batched",
+                    &LoaderRegistryProxy::register_proxy_factory_fn_batched,
+                    py::arg("name"),
+                    py::arg("loader"),
+                    py::arg("throw_if_exists") = true)
         .def_static("unregister_loader",
                     &LoaderRegistry::unregister_factory_fn,
                     py::arg("name"),
                     py::arg("throw_if_not_exists") = true);
 
+    // Envelope converters between the MultiMessage and ControlMessage pipeline styles
+    _module.def("to_control_message",
+                &to_control_message,
+                "Re-wrap a MultiMessage as a ControlMessage sharing the same data, honoring offsets and counts with "
+                "zero-copy views.",
+                py::arg("multi"));
+    _module.def("to_multi_message",
+                &to_multi_message,
+                "Re-wrap a ControlMessage payload (and tensors, when present) as a MultiMessage sharing the same "
+                "data.",
+                py::arg("control"));
+
     _module.attr("__version__") =
         MORPHEUS_CONCAT_STR(morpheus_VERSION_MAJOR << "." << morpheus_VERSION_MINOR << "." << morpheus_VERSION_PATCH);
 }
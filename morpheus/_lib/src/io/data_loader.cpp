@@ -18,13 +18,25 @@
 #include "morpheus/io/data_loader.hpp"
 
 #include "morpheus/messages/control.hpp"
+#include "morpheus/objects/table_info.hpp"  // for TableInfo
 
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>                      // for data_type & size_of
+#include <cudf/utilities/traits.hpp>           // for is_fixed_width
+#include <cudf/utilities/type_dispatcher.hpp>  // for size_of
 #include <glog/logging.h>
 
+#include <algorithm>  // for lower_bound
+#include <chrono>
+#include <cstddef>  // for size_t
 #include <exception>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace {
 void process_failures(const std::string& error_msg,
@@ -38,6 +50,39 @@ void process_failures(const std::string& error_msg,
     message->set_metadata("cm_failed", "true");
     message->set_metadata("cm_failed_reason", error_msg);
 }
+
+std::size_t estimate_column_bytes(const cudf::column_view& column)
+{
+    std::size_t bytes = 0;
+
+    if (cudf::is_fixed_width(column.type()))
+    {
+        bytes += static_cast<std::size_t>(column.size()) * cudf::size_of(column.type());
+    }
+
+    // Strings and nested types keep their data in fixed-width children (offsets & chars)
+    for (auto child_idx = 0; child_idx < column.num_children(); ++child_idx)
+    {
+        bytes += estimate_column_bytes(column.child(child_idx));
+    }
+
+    return bytes;
+}
+
+// Approximate device footprint of a payload, used to enforce the cache memory budget
+std::size_t estimate_payload_bytes(const std::shared_ptr<morpheus::MessageMeta>& payload)
+{
+    auto table_info = payload->get_info();
+    auto view       = table_info.get_view();
+
+    std::size_t bytes = 0;
+    for (const auto& column : view)
+    {
+        bytes += estimate_column_bytes(column);
+    }
+
+    return bytes;
+}
 }  // namespace
 
 namespace morpheus {
@@ -59,7 +104,94 @@ std::shared_ptr<ControlMessage> Loader::load(std::shared_ptr<ControlMessage> mes
     return std::move(message);
 }
 
-DataLoader::DataLoader(nlohmann::json config) : m_config(std::move(config)) {}
+std::vector<std::shared_ptr<ControlMessage>> Loader::load_batch(std::vector<std::shared_ptr<ControlMessage>> messages,
+                                                                std::vector<nlohmann::json> tasks)
+{
+    for (std::size_t i = 0; i < messages.size(); ++i)
+    {
+        messages[i] = this->load(std::move(messages[i]), std::move(tasks[i]));
+    }
+
+    return messages;
+}
+
+DataLoader::DataLoader(nlohmann::json config) : m_config(std::move(config))
+{
+    if (!m_config.empty())
+    {
+        m_cache_enabled   = m_config.value("cache_payloads", false);
+        m_cache_ttl       = std::chrono::seconds(m_config.value("cache_ttl_seconds", 300));
+        m_cache_max_bytes = m_config.value("cache_max_bytes", std::size_t(1) << 30);
+    }
+}
+
+std::shared_ptr<MessageMeta> DataLoader::cache_lookup(const std::string& key)
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+
+    auto entry = m_payload_cache.find(key);
+    if (entry == m_payload_cache.end())
+    {
+        return nullptr;
+    }
+
+    if (entry->second.expires_at <= now)
+    {
+        m_cache_bytes -= entry->second.bytes;
+        m_payload_cache.erase(entry);
+
+        return nullptr;
+    }
+
+    return entry->second.payload;
+}
+
+void DataLoader::cache_store(const std::string& key, std::shared_ptr<MessageMeta> payload)
+{
+    auto bytes = estimate_payload_bytes(payload);
+    if (bytes > m_cache_max_bytes)
+    {
+        return;  // Larger than the whole budget, not worth evicting everything else for
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+
+    // Drop expired entries first, then evict the entries closest to expiry until the new payload fits
+    for (auto entry = m_payload_cache.begin(); entry != m_payload_cache.end();)
+    {
+        if (entry->second.expires_at <= now)
+        {
+            m_cache_bytes -= entry->second.bytes;
+            entry = m_payload_cache.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+
+    while (m_cache_bytes + bytes > m_cache_max_bytes && !m_payload_cache.empty())
+    {
+        auto victim = m_payload_cache.begin();
+        for (auto entry = m_payload_cache.begin(); entry != m_payload_cache.end(); ++entry)
+        {
+            if (entry->second.expires_at < victim->second.expires_at)
+            {
+                victim = entry;
+            }
+        }
+
+        m_cache_bytes -= victim->second.bytes;
+        m_payload_cache.erase(victim);
+    }
+
+    m_cache_bytes += bytes;
+    m_payload_cache[key] = CacheEntry{std::move(payload), now + m_cache_ttl, bytes};
+}
 
 std::shared_ptr<ControlMessage> DataLoader::load(std::shared_ptr<ControlMessage> control_message)
 {
@@ -71,53 +203,234 @@ std::shared_ptr<ControlMessage> DataLoader::load(std::shared_ptr<ControlMessage>
         processes_failures_as_errors = m_config.value("processes_failures_as_errors", false);
     }
 
+    // Tasks are kept priority-ordered by ControlMessage::add_task, so draining the queue hands back the pending
+    // loads most-urgent first. `remove_tasks` moves the whole array out in one operation; messages carrying
+    // hundreds of load tasks cost one move rather than one JSON copy per task. The outer loop picks up any
+    // follow-up load tasks a loader queues while running.
     while (control_message->has_task("load"))
     {
-        auto task      = control_message->remove_task("load");
-        auto loader_id = task["loader_id"];
+        for (auto& task : control_message->remove_tasks("load"))
+        {
+            auto loader_id = task["loader_id"];
+
+            auto loader = this->find_loader(loader_id.get<std::string>());
+            if (loader)
+            {
+                // Task properties address the content, the dump of the (key-sorted) json is the canonical form
+                std::string cache_key;
+                if (m_cache_enabled)
+                {
+                    cache_key = loader_id.get<std::string>() + "|" + task.dump();
+
+                    if (auto cached = this->cache_lookup(cache_key))
+                    {
+                        VLOG(5) << "Reusing cached payload from loader: " << loader_id
+                                << " for message: " << control_message->config().dump() << std::endl;
+                        control_message->payload(std::move(cached));
+                        continue;
+                    }
+                }
+
+                VLOG(5) << "Loading data using loader: " << loader_id
+                        << " for message: " << control_message->config().dump() << std::endl;
+                try
+                {
+                    loader->load(control_message, task);
+
+                    if (m_cache_enabled)
+                    {
+                        if (auto payload = control_message->payload())
+                        {
+                            this->cache_store(cache_key, std::move(payload));
+                        }
+                    }
+                } catch (std::exception& e)
+                {
+                    process_failures(e.what(), control_message, processes_failures_as_errors);
+                } catch (...)
+                {
+                    process_failures("Unknown error", control_message, processes_failures_as_errors);
+                }
+            }
+            else
+            {
+                LOG(ERROR) << "Attempt to load using an unknown or unregistered data loader: " << loader_id
+                           << std::endl;
+                throw std::runtime_error("Attempt to load using an unknown or unregistered data loader: " +
+                                         loader_id.get<std::string>());
+            }
+        }
+    }
+
+    return std::move(control_message);
+}
+
+std::vector<std::shared_ptr<ControlMessage>> DataLoader::load_batch(
+    std::vector<std::shared_ptr<ControlMessage>> control_messages)
+{
+    bool processes_failures_as_errors = false;
+    if (!m_config.empty())
+    {
+        processes_failures_as_errors = m_config.value("processes_failures_as_errors", false);
+    }
+
+    // One (message, task) pair bound for a single loader, remembering the message's slot in the batch so the
+    // loader's results land back in arrival order
+    struct PendingTask
+    {
+        std::vector<std::size_t> indices;
+        std::vector<std::shared_ptr<ControlMessage>> messages;
+        std::vector<nlohmann::json> tasks;
+        std::vector<std::string> cache_keys;
+    };
+
+    // Each round pops at most one pending load per message and groups the pops by loader, so a loader whose
+    // callable amortizes per-call overhead sees the whole batch in one invocation
+    bool any_pending = true;
+    while (any_pending)
+    {
+        any_pending = false;
 
-        auto loader = m_loaders.find(loader_id.get<std::string>());
-        if (loader != m_loaders.end())
+        std::map<std::string, PendingTask> pending_by_loader;
+        for (std::size_t i = 0; i < control_messages.size(); ++i)
         {
-            VLOG(5) << "Loading data using loader: " << loader_id
-                    << " for message: " << control_message->config().dump() << std::endl;
+            auto& control_message = control_messages[i];
+            if (!control_message->has_task("load"))
+            {
+                continue;
+            }
+
+            auto task      = control_message->remove_task("load");
+            auto loader_id = task["loader_id"].get<std::string>();
+
+            if (!this->find_loader(loader_id))
+            {
+                LOG(ERROR) << "Attempt to load using an unknown or unregistered data loader: " << loader_id
+                           << std::endl;
+                throw std::runtime_error("Attempt to load using an unknown or unregistered data loader: " + loader_id);
+            }
+
+            any_pending = any_pending || control_message->has_task("load");
+
+            std::string cache_key;
+            if (m_cache_enabled)
+            {
+                cache_key = loader_id + "|" + task.dump();
+
+                if (auto cached = this->cache_lookup(cache_key))
+                {
+                    VLOG(5) << "Reusing cached payload from loader: " << loader_id
+                            << " for message: " << control_message->config().dump() << std::endl;
+                    control_message->payload(std::move(cached));
+                    continue;
+                }
+            }
+
+            auto& pending = pending_by_loader[loader_id];
+            pending.indices.push_back(i);
+            pending.messages.push_back(control_message);
+            pending.tasks.push_back(std::move(task));
+            pending.cache_keys.push_back(std::move(cache_key));
+        }
+
+        for (auto& [loader_id, pending] : pending_by_loader)
+        {
+            auto loader = this->find_loader(loader_id);
+
+            VLOG(5) << "Loading data using loader: " << loader_id << " for a batch of " << pending.messages.size()
+                    << " messages" << std::endl;
             try
             {
-                loader->second->load(control_message, task);
+                auto loaded = loader->load_batch(std::move(pending.messages), std::move(pending.tasks));
+
+                for (std::size_t j = 0; j < loaded.size(); ++j)
+                {
+                    if (m_cache_enabled)
+                    {
+                        if (auto payload = loaded[j]->payload())
+                        {
+                            this->cache_store(pending.cache_keys[j], std::move(payload));
+                        }
+                    }
+
+                    control_messages[pending.indices[j]] = std::move(loaded[j]);
+                }
             } catch (std::exception& e)
             {
-                process_failures(e.what(), control_message, processes_failures_as_errors);
+                for (auto idx : pending.indices)
+                {
+                    process_failures(e.what(), control_messages[idx], processes_failures_as_errors);
+                }
             } catch (...)
             {
-                process_failures("Unknown error", control_message, processes_failures_as_errors);
+                for (auto idx : pending.indices)
+                {
+                    process_failures("Unknown error", control_messages[idx], processes_failures_as_errors);
+                }
             }
         }
-        else
-        {
-            LOG(ERROR) << "Attempt to load using an unknown or unregistered data loader: " << loader_id << std::endl;
-            throw std::runtime_error("Attempt to load using an unknown or unregistered data loader: " +
-                                     loader_id.get<std::string>());
-        }
     }
 
-    return std::move(control_message);
+    return control_messages;
+}
+
+std::shared_ptr<Loader> DataLoader::find_loader(const std::string& loader_id) const
+{
+    // Consecutive tasks almost always reuse the same loader, so check the last hit before searching. A stale
+    // index read from a concurrent load only costs the binary search below.
+    const auto last_idx = m_last_loader_idx.load();
+    if (last_idx < m_loaders.size() && m_loaders[last_idx].first == loader_id)
+    {
+        return m_loaders[last_idx].second;
+    }
+
+    auto entry = std::lower_bound(m_loaders.begin(), m_loaders.end(), loader_id, [](const auto& lhs, const auto& id) {
+        return lhs.first < id;
+    });
+
+    if (entry == m_loaders.end() || entry->first != loader_id)
+    {
+        return nullptr;
+    }
+
+    m_last_loader_idx = entry - m_loaders.begin();
+
+    return entry->second;
 }
 
 void DataLoader::add_loader(const std::string& loader_id, std::shared_ptr<Loader> loader, bool overwrite)
 {
-    if (!overwrite and m_loaders.find(loader_id) != m_loaders.end())
+    auto entry = std::lower_bound(m_loaders.begin(), m_loaders.end(), loader_id, [](const auto& lhs, const auto& id) {
+        return lhs.first < id;
+    });
+
+    if (entry != m_loaders.end() && entry->first == loader_id)
     {
-        throw std::runtime_error("Loader already registered with id: " + loader_id);
+        if (!overwrite)
+        {
+            throw std::runtime_error("Loader already registered with id: " + loader_id);
+        }
+
+        VLOG(2) << "Registering data loader: " << loader_id << std::endl;
+
+        entry->second = std::move(loader);
+
+        return;
     }
 
     VLOG(2) << "Registering data loader: " << loader_id << std::endl;
 
-    m_loaders[loader_id] = loader;
+    m_loaders.emplace(entry, loader_id, std::move(loader));
+    m_last_loader_idx = 0;
 }
 
 void DataLoader::remove_loader(const std::string& loader_id, bool throw_if_not_found)
 {
-    if (m_loaders.find(loader_id) == m_loaders.end())
+    auto entry = std::lower_bound(m_loaders.begin(), m_loaders.end(), loader_id, [](const auto& lhs, const auto& id) {
+        return lhs.first < id;
+    });
+
+    if (entry == m_loaders.end() || entry->first != loader_id)
     {
         if (throw_if_not_found)
         {
@@ -129,6 +442,7 @@ void DataLoader::remove_loader(const std::string& loader_id, bool throw_if_not_f
 
     VLOG(2) << "Removing data loader: " << loader_id << std::endl;
 
-    m_loaders.erase(loader_id);
+    m_loaders.erase(entry);
+    m_last_loader_idx = 0;
 }
 }  // namespace morpheus
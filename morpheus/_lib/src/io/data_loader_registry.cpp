@@ -58,6 +58,36 @@ void LoaderRegistryProxy::register_proxy_factory_fn(
     register_factory_cleanup_fn(name);
 }
 
+void LoaderRegistryProxy::register_proxy_factory_fn_batched(
+    const std::string& name,
+    std::function<std::vector<std::shared_ptr<ControlMessage>>(std::vector<std::shared_ptr<ControlMessage>>,
+                                                               pybind11::list)> proxy_constructor,
+    bool throw_if_exists)
+{
+    LoaderRegistry::register_factory_fn(
+        name,
+        [proxy_constructor](nlohmann::json config) {
+            return std::make_shared<LambdaLoader>(
+                [proxy_constructor](std::vector<std::shared_ptr<ControlMessage>> messages,
+                                    std::vector<nlohmann::json> tasks) {
+                    // One GIL acquisition covers the whole batch
+                    pybind11::gil_scoped_acquire gil;
+
+                    pybind11::list py_tasks;
+                    for (const auto& task : tasks)
+                    {
+                        py_tasks.append(mrc::pymrc::cast_from_json(task));
+                    }
+
+                    return std::move(proxy_constructor(std::move(messages), py_tasks));
+                },
+                config);
+        },
+        throw_if_exists);
+
+    register_factory_cleanup_fn(name);
+}
+
 void LoaderRegistryProxy::register_factory_cleanup_fn(const std::string& name)
 {
     {
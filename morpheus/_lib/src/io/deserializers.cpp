@@ -17,25 +17,57 @@
 
 #include "morpheus/io/deserializers.hpp"
 
+#include "morpheus/io/gds.hpp"               // for GDSFileHandle
 #include "morpheus/utilities/cudf_util.hpp"  // for CudfHelper
 #include "morpheus/utilities/stage_util.hpp"
 #include "morpheus/utilities/string_util.hpp"
 
+#include <arrow/builder.h>     // for BooleanBuilder, Int64Builder, DoubleBuilder, StringBuilder
+#include <arrow/io/file.h>     // for MemoryMappedFile
+#include <arrow/ipc/reader.h>  // for RecordBatchFileReader, RecordBatchStreamReader
+#include <arrow/table.h>       // for Table
+#include <cuda_runtime.h>  // for cudaMemcpyAsync
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>  // for column_view
+#include <cudf/concatenate.hpp>         // for concatenate
+#include <cudf/copying.hpp>             // for gather
+#include <cudf/interop.hpp>             // for from_arrow
 #include <cudf/io/csv.hpp>
+#include <cudf/io/datasource.hpp>  // for datasource
 #include <cudf/io/json.hpp>
 #include <cudf/io/parquet.hpp>
-#include <cudf/table/table.hpp>  // IWYU pragma: keep
-#include <cudf/types.hpp>        // for cudf::type_id
-#include <pybind11/pybind11.h>   // IWYU pragma: keep
+#include <cudf/sorting.hpp>           // for stable_sorted_order
+#include <cudf/table/table.hpp>       // IWYU pragma: keep
+#include <cudf/table/table_view.hpp>  // for table_view
+#include <cudf/types.hpp>             // for cudf::type_id
+#include <glog/logging.h>             // for LOG
+#include <mrc/cuda/common.hpp>        // for MRC_CHECK_CUDA
+#include <nlohmann/json.hpp>          // for ordered_json
+#include <pybind11/pybind11.h>        // IWYU pragma: keep
+#include <rmm/cuda_stream_view.hpp>   // for cuda_stream_view
+#include <rmm/device_buffer.hpp>      // for device_buffer
+
+#include <fcntl.h>   // for open, O_RDONLY
+#include <unistd.h>  // for close, pread
 
 #include <algorithm>
+#include <cerrno>     // for errno
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int64_t, uint8_t
+#include <cstring>    // for strerror
+#include <exception>  // for exception_ptr
+#include <filesystem>
+#include <fstream>  // for ifstream
+#include <future>   // for promise
 #include <iterator>
+#include <map>
 #include <memory>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 #include <utility>
+#include <vector>
 // We're already including pybind11.h, and including only gil.h as IWYU suggests yields an undefined symbol error
 // IWYU pragma: no_include <pybind11/gil.h>
 
@@ -44,6 +76,269 @@ const std::regex IndexRegex(R"(^\s*(unnamed: 0|id)\s*$)",
                             std::regex_constants::ECMAScript | std::regex_constants::icase);
 
 const std::regex UnnamedRegex(R"(^\s*unnamed: 0\s*$)", std::regex_constants::ECMAScript | std::regex_constants::icase);
+
+/**
+ * @brief Loads an Arrow IPC (Feather V2) file into a cudf table. The file is memory-mapped rather than read, the
+ * record batches are decoded straight out of the page cache with no parse step, making this the cheapest format for
+ * repeated replays of the same dataset.
+ */
+cudf::io::table_with_metadata load_arrow_ipc_table(const std::string& filename)
+{
+    auto mapped = arrow::io::MemoryMappedFile::Open(filename, arrow::io::FileMode::READ);
+
+    if (!mapped.ok())
+    {
+        throw std::runtime_error("Failed to memory-map Arrow IPC file '" + filename +
+                                 "': " + mapped.status().ToString());
+    }
+
+    std::shared_ptr<arrow::Table> arrow_table;
+
+    auto file_reader = arrow::ipc::RecordBatchFileReader::Open(mapped.ValueUnsafe());
+    if (file_reader.ok())
+    {
+        auto table_result = file_reader.ValueUnsafe()->ToTable();
+
+        if (!table_result.ok())
+        {
+            throw std::runtime_error("Failed to read Arrow IPC record batches: " + table_result.status().ToString());
+        }
+
+        arrow_table = table_result.ValueUnsafe();
+    }
+    else
+    {
+        // No file footer, try again treating it as a stream-format capture
+        if (!mapped.ValueUnsafe()->Seek(0).ok())
+        {
+            throw std::runtime_error("Failed to open Arrow IPC file: " + file_reader.status().ToString());
+        }
+
+        auto stream_reader = arrow::ipc::RecordBatchStreamReader::Open(mapped.ValueUnsafe());
+
+        if (!stream_reader.ok())
+        {
+            throw std::runtime_error("Failed to open Arrow IPC file: " + stream_reader.status().ToString());
+        }
+
+        auto table_result = stream_reader.ValueUnsafe()->ToTable();
+
+        if (!table_result.ok())
+        {
+            throw std::runtime_error("Failed to read Arrow IPC record batches: " + table_result.status().ToString());
+        }
+
+        arrow_table = table_result.ValueUnsafe();
+    }
+
+    cudf::io::table_with_metadata table;
+
+    const auto& fields = arrow_table->schema()->fields();
+    table.metadata.schema_info.reserve(fields.size());
+
+    for (const auto& field : fields)
+    {
+        table.metadata.schema_info.emplace_back(field->name());
+    }
+
+    // Single host-to-device transfer into a cudf table
+    table.tbl = cudf::from_arrow(*arrow_table);
+
+    return table;
+}
+
+/**
+ * @brief Dtype lattice for the host-side JSON parser. Integers widen to doubles when a column mixes them and any
+ * other mixture widens to string, close enough to the GPU reader's "most permissive wins" inference for the tiny
+ * control-plane payloads this path exists for.
+ */
+enum class HostColumnKind
+{
+    UNKNOWN,  // only nulls seen so far
+    BOOL,
+    INT64,
+    FLOAT64,
+    STRING
+};
+
+HostColumnKind merge_host_kind(HostColumnKind current, const nlohmann::ordered_json& value)
+{
+    if (value.is_null() || current == HostColumnKind::STRING)
+    {
+        return current;
+    }
+
+    if (value.is_boolean())
+    {
+        return (current == HostColumnKind::UNKNOWN || current == HostColumnKind::BOOL) ? HostColumnKind::BOOL
+                                                                                       : HostColumnKind::STRING;
+    }
+
+    if (value.is_number_integer() || value.is_number_unsigned())
+    {
+        if (current == HostColumnKind::UNKNOWN)
+        {
+            return HostColumnKind::INT64;
+        }
+
+        return (current == HostColumnKind::INT64 || current == HostColumnKind::FLOAT64) ? current
+                                                                                        : HostColumnKind::STRING;
+    }
+
+    if (value.is_number_float())
+    {
+        if (current == HostColumnKind::UNKNOWN || current == HostColumnKind::INT64 ||
+            current == HostColumnKind::FLOAT64)
+        {
+            return HostColumnKind::FLOAT64;
+        }
+
+        return HostColumnKind::STRING;
+    }
+
+    return HostColumnKind::STRING;
+}
+
+void check_arrow(const arrow::Status& status)
+{
+    if (!status.ok())
+    {
+        throw std::runtime_error("Failed to build host JSON columns: " + status.ToString());
+    }
+}
+
+/**
+ * @brief File source which serves the cudf readers' device reads through GPUDirect Storage (cuFile), so parquet
+ * row groups and CSV bytes move NVMe->device without the host bounce. Host reads (footers, headers, small probes)
+ * go through a regular buffered descriptor. Only constructed via `make_if_available`, which returns nullptr when
+ * the node cannot do GDS so callers fall back to cudf's own file source.
+ */
+class GDSDataSource : public cudf::io::datasource
+{
+  public:
+    ~GDSDataSource() override
+    {
+        ::close(m_fd);
+    }
+
+    /**
+     * @brief Open `filename` as a GDS-backed source, or return nullptr when cuFile cannot serve the file
+     */
+    static std::unique_ptr<GDSDataSource> make_if_available(const std::string& filename)
+    {
+        auto handle = morpheus::GDSFileHandle::open_read(filename);
+        if (!handle.valid())
+        {
+            return nullptr;
+        }
+
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return nullptr;
+        }
+
+        const auto size = static_cast<std::size_t>(std::filesystem::file_size(filename));
+
+        return std::unique_ptr<GDSDataSource>(new GDSDataSource(fd, size, std::move(handle)));
+    }
+
+    std::unique_ptr<buffer> host_read(std::size_t offset, std::size_t size) override
+    {
+        std::vector<uint8_t> data(size);
+        data.resize(host_read(offset, size, data.data()));
+
+        return buffer::create(std::move(data));
+    }
+
+    std::size_t host_read(std::size_t offset, std::size_t size, uint8_t* dst) override
+    {
+        size = std::min(size, m_size - std::min(offset, m_size));
+
+        std::size_t done = 0;
+        while (done < size)
+        {
+            const auto count = ::pread(m_fd, dst + done, size - done, static_cast<off_t>(offset + done));
+            if (count < 0)
+            {
+                throw std::runtime_error(std::string("Failed to read input file: ") + std::strerror(errno));
+            }
+
+            if (count == 0)
+            {
+                break;
+            }
+
+            done += count;
+        }
+
+        return done;
+    }
+
+    bool supports_device_read() const override
+    {
+        return true;
+    }
+
+    std::size_t device_read(std::size_t offset,
+                            std::size_t size,
+                            uint8_t* dst,
+                            rmm::cuda_stream_view stream) override
+    {
+        size = std::min(size, m_size - std::min(offset, m_size));
+
+        const auto count = m_handle.read(dst, size, static_cast<off_t>(offset));
+        if (count == static_cast<ssize_t>(size))
+        {
+            return size;
+        }
+
+        // cuFile refused the range (e.g. an unregistered destination buffer), bounce it through the host instead
+        std::vector<uint8_t> staging(size);
+        const auto read = host_read(offset, size, staging.data());
+
+        MRC_CHECK_CUDA(cudaMemcpyAsync(dst, staging.data(), read, cudaMemcpyHostToDevice, stream.value()));
+        stream.synchronize();
+
+        return read;
+    }
+
+    std::unique_ptr<buffer> device_read(std::size_t offset, std::size_t size, rmm::cuda_stream_view stream) override
+    {
+        rmm::device_buffer data(std::min(size, m_size - std::min(offset, m_size)), stream);
+        device_read(offset, data.size(), static_cast<uint8_t*>(data.data()), stream);
+
+        return buffer::create(std::move(data));
+    }
+
+    std::future<std::size_t> device_read_async(std::size_t offset,
+                                               std::size_t size,
+                                               uint8_t* dst,
+                                               rmm::cuda_stream_view stream) override
+    {
+        // cuFile batch submission is not worth its setup here, satisfy the future synchronously
+        std::promise<std::size_t> result;
+        result.set_value(device_read(offset, size, dst, stream));
+
+        return result.get_future();
+    }
+
+    std::size_t size() const override
+    {
+        return m_size;
+    }
+
+  private:
+    GDSDataSource(int fd, std::size_t size, morpheus::GDSFileHandle handle) :
+      m_fd(fd),
+      m_size(size),
+      m_handle(std::move(handle))
+    {}
+
+    int m_fd{-1};
+    std::size_t m_size{0};
+    morpheus::GDSFileHandle m_handle;
+};
 }  // namespace
 
 namespace morpheus {
@@ -53,9 +348,226 @@ std::vector<std::string> get_column_names_from_table(const cudf::io::table_with_
     return foreach_map(table.metadata.schema_info, [](auto schema) { return schema.name; });
 }
 
+void filter_table_columns(cudf::io::table_with_metadata& table, const std::vector<std::string>& columns)
+{
+    if (columns.empty())
+    {
+        return;
+    }
+
+    auto names       = get_column_names_from_table(table);
+    auto all_columns = table.tbl->release();
+
+    std::vector<std::unique_ptr<cudf::column>> selected;
+    std::vector<cudf::io::column_name_info> selected_info;
+    selected.reserve(columns.size());
+    selected_info.reserve(columns.size());
+
+    for (const auto& name : columns)
+    {
+        auto found = std::find(names.begin(), names.end(), name);
+        if (found == names.end())
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Column '" << name << "' was not found in the input"));
+        }
+
+        auto idx = found - names.begin();
+        selected.emplace_back(std::move(all_columns[idx]));
+        selected_info.emplace_back(table.metadata.schema_info[idx]);
+    }
+
+    table.tbl                  = std::make_unique<cudf::table>(std::move(selected));
+    table.metadata.schema_info = std::move(selected_info);
+}
+
+void sort_table_by_column(cudf::io::table_with_metadata& table, const std::string& column_name)
+{
+    if (column_name.empty())
+    {
+        return;
+    }
+
+    auto names = get_column_names_from_table(table);
+    auto found = std::find(names.begin(), names.end(), column_name);
+    if (found == names.end())
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Sort column '" << column_name << "' was not found in the input"));
+    }
+
+    auto key_idx = static_cast<cudf::size_type>(found - names.begin());
+
+    // A stable sort keeps arrival order within a key, so per-entity slices still read in ingest order
+    auto sort_order = cudf::stable_sorted_order(table.tbl->view().select(std::vector<cudf::size_type>{key_idx}));
+
+    table.tbl = cudf::gather(table.tbl->view(), sort_order->view());
+}
+
+
+cudf::io::table_with_metadata load_json_lines_host(const std::string& json_lines)
+{
+    // ordered_json keeps each object's keys in appearance order, matching the column order the GPU reader derives
+    std::vector<nlohmann::ordered_json> rows;
+
+    std::size_t begin = 0;
+    while (begin < json_lines.size())
+    {
+        const auto end  = json_lines.find('\n', begin);
+        const auto line = json_lines.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+
+        begin = end == std::string::npos ? json_lines.size() : end + 1;
+
+        if (line.find_first_not_of(" \t\r") == std::string::npos)
+        {
+            continue;
+        }
+
+        auto row = nlohmann::ordered_json::parse(line);  // throws on malformed input, like the GPU reader
+        if (!row.is_object())
+        {
+            throw std::runtime_error("Host JSON parsing requires one object per line");
+        }
+
+        rows.emplace_back(std::move(row));
+    }
+
+    if (rows.empty())
+    {
+        throw std::runtime_error("No JSON records to parse");
+    }
+
+    // Columns are the union of the keys in first-appearance order
+    std::vector<std::string> names;
+    std::vector<HostColumnKind> kinds;
+    std::map<std::string, std::size_t, std::less<>> column_index;
+
+    for (const auto& row : rows)
+    {
+        for (const auto& [key, value] : row.items())
+        {
+            auto found = column_index.find(key);
+            if (found == column_index.end())
+            {
+                found = column_index.emplace(key, names.size()).first;
+                names.push_back(key);
+                kinds.push_back(HostColumnKind::UNKNOWN);
+            }
+
+            kinds[found->second] = merge_host_kind(kinds[found->second], value);
+        }
+    }
+
+    std::vector<std::shared_ptr<arrow::Field>> fields;
+    std::vector<std::shared_ptr<arrow::Array>> arrays;
+    fields.reserve(names.size());
+    arrays.reserve(names.size());
+
+    for (std::size_t col = 0; col < names.size(); ++col)
+    {
+        const auto& name = names[col];
+
+        // All-null columns have nothing to infer from, surface them as strings
+        const auto kind = kinds[col] == HostColumnKind::UNKNOWN ? HostColumnKind::STRING : kinds[col];
+
+        std::shared_ptr<arrow::Array> array;
+
+        if (kind == HostColumnKind::BOOL)
+        {
+            arrow::BooleanBuilder builder;
+            for (const auto& row : rows)
+            {
+                auto found = row.find(name);
+                if (found == row.end() || found->is_null())
+                {
+                    check_arrow(builder.AppendNull());
+                }
+                else
+                {
+                    check_arrow(builder.Append(found->get<bool>()));
+                }
+            }
+            check_arrow(builder.Finish(&array));
+            fields.push_back(arrow::field(name, arrow::boolean()));
+        }
+        else if (kind == HostColumnKind::INT64)
+        {
+            arrow::Int64Builder builder;
+            for (const auto& row : rows)
+            {
+                auto found = row.find(name);
+                if (found == row.end() || found->is_null())
+                {
+                    check_arrow(builder.AppendNull());
+                }
+                else
+                {
+                    check_arrow(builder.Append(found->get<std::int64_t>()));
+                }
+            }
+            check_arrow(builder.Finish(&array));
+            fields.push_back(arrow::field(name, arrow::int64()));
+        }
+        else if (kind == HostColumnKind::FLOAT64)
+        {
+            arrow::DoubleBuilder builder;
+            for (const auto& row : rows)
+            {
+                auto found = row.find(name);
+                if (found == row.end() || found->is_null())
+                {
+                    check_arrow(builder.AppendNull());
+                }
+                else
+                {
+                    check_arrow(builder.Append(found->get<double>()));
+                }
+            }
+            check_arrow(builder.Finish(&array));
+            fields.push_back(arrow::field(name, arrow::float64()));
+        }
+        else
+        {
+            arrow::StringBuilder builder;
+            for (const auto& row : rows)
+            {
+                auto found = row.find(name);
+                if (found == row.end() || found->is_null())
+                {
+                    check_arrow(builder.AppendNull());
+                }
+                else
+                {
+                    // Nested objects and arrays round-trip as their serialized form
+                    check_arrow(builder.Append(found->is_string() ? found->get<std::string>() : found->dump()));
+                }
+            }
+            check_arrow(builder.Finish(&array));
+            fields.push_back(arrow::field(name, arrow::utf8()));
+        }
+
+        arrays.push_back(std::move(array));
+    }
+
+    auto arrow_table = arrow::Table::Make(arrow::schema(std::move(fields)), arrays);
+
+    cudf::io::table_with_metadata table;
+
+    table.metadata.schema_info.reserve(names.size());
+    for (const auto& name : names)
+    {
+        table.metadata.schema_info.emplace_back(name);
+    }
+
+    // Single host-to-device transfer into a cudf table
+    table.tbl = cudf::from_arrow(*arrow_table);
+
+    return table;
+}
+
 cudf::io::table_with_metadata load_table_from_file(const std::string& filename,
                                                    FileTypes file_type,
-                                                   std::optional<bool> json_lines)
+                                                   std::optional<bool> json_lines,
+                                                   const std::vector<std::string>& columns,
+                                                   const TableSchema& schema)
 {
     if (file_type == FileTypes::Auto)
     {
@@ -67,19 +579,74 @@ cudf::io::table_with_metadata load_table_from_file(const std::string& filename,
     switch (file_type)
     {
     case FileTypes::JSON: {
-        auto options =
-            cudf::io::json_reader_options::builder(cudf::io::source_info{filename}).lines(json_lines.value_or(true));
-        table        = cudf::io::read_json(options.build());
+        const bool lines = json_lines.value_or(true);
+
+        // The host parser always infers, a pinned schema goes through the GPU reader
+        if (lines && schema.empty() && std::filesystem::file_size(filename) <= JsonHostParseMaxBytes)
+        {
+            // Tiny files parse faster on the host than the GPU reader's kernel launches and transfer setup cost
+            std::ifstream file(filename, std::ios::binary);
+            std::stringstream buffer;
+            buffer << file.rdbuf();
+
+            table = load_json_lines_host(buffer.str());
+        }
+        else
+        {
+            auto options = cudf::io::json_reader_options::builder(cudf::io::source_info{filename}).lines(lines);
+
+            if (!schema.empty())
+            {
+                options.dtypes(schema_to_cudf_dtypes(schema));
+            }
+
+            table = cudf::io::read_json(options.build());
+        }
+
+        // The JSON reader has no column selection, apply the projection after the parse
+        filter_table_columns(table, columns);
         break;
     }
     case FileTypes::CSV: {
-        auto options = cudf::io::csv_reader_options::builder(cudf::io::source_info{filename});
-        table        = cudf::io::read_csv(options.build());
+        // On GDS-capable nodes the reader pulls the file NVMe->device through cuFile instead of bouncing it
+        // through host memory
+        auto gds = GDSDataSource::make_if_available(filename);
+
+        auto options = cudf::io::csv_reader_options::builder(
+            gds ? cudf::io::source_info{gds.get()} : cudf::io::source_info{filename});
+
+        if (!columns.empty())
+        {
+            options.use_cols_names(columns);
+        }
+
+        if (!schema.empty())
+        {
+            options.dtypes(schema_to_cudf_dtypes(schema));
+        }
+
+        table = cudf::io::read_csv(options.build());
         break;
     }
     case FileTypes::PARQUET: {
-        auto options = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filename});
-        table        = cudf::io::read_parquet(options.build());
+        auto gds = GDSDataSource::make_if_available(filename);
+
+        auto options = cudf::io::parquet_reader_options::builder(
+            gds ? cudf::io::source_info{gds.get()} : cudf::io::source_info{filename});
+
+        if (!columns.empty())
+        {
+            options.columns(columns);
+        }
+
+        table = cudf::io::read_parquet(options.build());
+        break;
+    }
+    case FileTypes::ARROW: {
+        table = load_arrow_ipc_table(filename);
+
+        // Like the JSON reader, the IPC path has no column selection, apply the projection after the load
+        filter_table_columns(table, columns);
         break;
     }
     case FileTypes::Auto:
@@ -95,6 +662,285 @@ cudf::io::table_with_metadata load_table_from_file(const std::string& filename,
     return table;
 }
 
+cudf::io::table_with_metadata load_table_from_file_parallel(const std::string& filename,
+                                                            FileTypes file_type,
+                                                            std::optional<bool> json_lines,
+                                                            const std::vector<std::string>& columns,
+                                                            std::size_t num_threads,
+                                                            const TableSchema& schema)
+{
+    // Ranges smaller than this parse faster in one call than the per-range reader setup costs
+    constexpr std::size_t MinBytesPerRange = 32UL << 20;
+
+    if (file_type == FileTypes::Auto)
+    {
+        file_type = determine_file_type(filename);  // throws if it is unable to determine the type
+    }
+
+    if (num_threads == 0)
+    {
+        num_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(filename));
+    const auto num_ranges =
+        std::min<std::size_t>(num_threads, std::max<std::size_t>(file_size / MinBytesPerRange, 1));
+
+    const bool lines = json_lines.value_or(true);
+
+    // Byte ranges only make sense for line/record oriented text. The Parquet reader parallelizes internally, Arrow
+    // IPC loads do no parsing at all, and a non-line JSON document cannot be split
+    if (num_ranges < 2 || file_type == FileTypes::PARQUET || file_type == FileTypes::ARROW ||
+        (file_type == FileTypes::JSON && !lines))
+    {
+        return load_table_from_file(filename, file_type, json_lines, columns, schema);
+    }
+
+    const auto range_size = (file_size + num_ranges - 1) / num_ranges;
+
+    std::vector<cudf::io::table_with_metadata> chunks(num_ranges);
+    std::vector<std::exception_ptr> errors(num_ranges);
+
+    // For CSV only the first range carries the header. Parse it up front so the remaining ranges can reuse its
+    // column names and, crucially, its inferred dtypes; ranges inferring independently could disagree
+    std::vector<std::string> csv_names;
+    std::vector<cudf::data_type> csv_dtypes;
+
+    if (file_type == FileTypes::CSV)
+    {
+        auto options =
+            cudf::io::csv_reader_options::builder(cudf::io::source_info{filename}).byte_range_size(range_size);
+
+        if (!schema.empty())
+        {
+            // Pinned dtypes make the header parse name-resolution only, inference is skipped
+            options.dtypes(schema_to_cudf_dtypes(schema));
+        }
+
+        chunks.front() = cudf::io::read_csv(options.build());
+
+        csv_names = get_column_names_from_table(chunks.front());
+
+        csv_dtypes.reserve(chunks.front().tbl->num_columns());
+        for (const auto& column : chunks.front().tbl->view())
+        {
+            csv_dtypes.emplace_back(column.type());
+        }
+    }
+
+    // JSON-lines ranges infer independently too. Parse the first range up front and pin the later ranges to its
+    // inferred dtypes, otherwise a column reading integral in one range and float (or null) in another yields
+    // chunks the concatenate below cannot combine
+    std::map<std::string, cudf::data_type> json_dtypes;
+
+    if (file_type == FileTypes::JSON)
+    {
+        auto options = cudf::io::json_reader_options::builder(cudf::io::source_info{filename})
+                           .lines(true)
+                           .byte_range_size(range_size);
+
+        if (!schema.empty())
+        {
+            options.dtypes(schema_to_cudf_dtypes(schema));
+        }
+
+        chunks.front() = cudf::io::read_json(options.build());
+
+        auto names = get_column_names_from_table(chunks.front());
+        auto view  = chunks.front().tbl->view();
+
+        for (cudf::size_type col_idx = 0; col_idx < view.num_columns(); ++col_idx)
+        {
+            json_dtypes.emplace(names[col_idx], view.column(col_idx).type());
+        }
+    }
+
+    auto read_range = [&](std::size_t range_idx) {
+        try
+        {
+            const auto offset = range_idx * range_size;
+
+            if (file_type == FileTypes::CSV)
+            {
+                auto options = cudf::io::csv_reader_options::builder(cudf::io::source_info{filename})
+                                   .byte_range_offset(offset)
+                                   .byte_range_size(range_size)
+                                   .names(csv_names)
+                                   .dtypes(csv_dtypes)
+                                   .header(-1);
+
+                chunks[range_idx] = cudf::io::read_csv(options.build());
+            }
+            else
+            {
+                auto options = cudf::io::json_reader_options::builder(cudf::io::source_info{filename})
+                                   .lines(true)
+                                   .byte_range_offset(offset)
+                                   .byte_range_size(range_size);
+
+                if (!json_dtypes.empty())
+                {
+                    options.dtypes(json_dtypes);
+                }
+
+                chunks[range_idx] = cudf::io::read_json(options.build());
+            }
+        } catch (...)
+        {
+            errors[range_idx] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> readers;
+    readers.reserve(num_ranges);
+
+    // Range 0 was parsed up front for both formats to seed the pinned names/dtypes
+    for (std::size_t i = 1; i < num_ranges; ++i)
+    {
+        readers.emplace_back(read_range, i);
+    }
+
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    for (auto& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    cudf::io::table_with_metadata table;
+    table.metadata = std::move(chunks.front().metadata);
+
+    try
+    {
+        std::vector<cudf::table_view> views;
+        views.reserve(num_ranges);
+        for (const auto& chunk : chunks)
+        {
+            // A range holding no complete record parses to an empty table, concatenate skips nothing by including it
+            views.emplace_back(chunk.tbl->view());
+        }
+
+        table.tbl = cudf::concatenate(views);
+    } catch (const std::exception& e)
+    {
+        // Pinned dtypes keep the chunks' types in line, but a key entirely absent from a range still yields a
+        // chunk with fewer columns. Fall back to the single-call parse the serial reader handles this with
+        LOG(WARNING) << "Unable to combine byte ranges of '" << filename << "' (" << e.what()
+                     << "), falling back to a serial load";
+
+        return load_table_from_file(filename, file_type, json_lines, columns, schema);
+    }
+
+    filter_table_columns(table, columns);
+
+    return table;
+}
+
+ChunkedTableReader::ChunkedTableReader(std::string filename,
+                                       FileTypes file_type,
+                                       std::optional<bool> json_lines,
+                                       std::vector<std::string> columns,
+                                       TableSchema schema,
+                                       std::size_t chunk_bytes) :
+  m_filename(std::move(filename)),
+  m_file_type(file_type),
+  m_columns(std::move(columns)),
+  m_schema(std::move(schema)),
+  m_chunk_bytes(chunk_bytes)
+{
+    if (m_file_type == FileTypes::Auto)
+    {
+        m_file_type = determine_file_type(m_filename);  // throws if it is unable to determine the type
+    }
+
+    // Byte ranges only make sense for line/record oriented text, matching `load_table_from_file_parallel`
+    if (m_file_type != FileTypes::CSV && (m_file_type != FileTypes::JSON || !json_lines.value_or(true)))
+    {
+        throw std::invalid_argument(
+            MORPHEUS_CONCAT_STR("Chunked reads require a CSV or line-delimited JSON file, '"
+                                << m_filename << "' is " << m_file_type));
+    }
+
+    if (m_chunk_bytes == 0)
+    {
+        throw std::invalid_argument("chunk_bytes must be greater than zero");
+    }
+
+    m_file_size = static_cast<std::size_t>(std::filesystem::file_size(m_filename));
+}
+
+bool ChunkedTableReader::has_next() const
+{
+    return m_offset < m_file_size;
+}
+
+cudf::io::table_with_metadata ChunkedTableReader::next()
+{
+    CHECK(has_next()) << "next() called on an exhausted ChunkedTableReader";
+
+    const auto offset = m_offset;
+    m_offset += m_chunk_bytes;
+
+    cudf::io::table_with_metadata table;
+
+    if (m_file_type == FileTypes::CSV)
+    {
+        auto options = cudf::io::csv_reader_options::builder(cudf::io::source_info{m_filename})
+                           .byte_range_offset(offset)
+                           .byte_range_size(m_chunk_bytes);
+
+        if (offset == 0)
+        {
+            if (!m_schema.empty())
+            {
+                options.dtypes(schema_to_cudf_dtypes(m_schema));
+            }
+
+            table = cudf::io::read_csv(options.build());
+
+            // Later ranges carry no header; reuse the first range's names and inferred dtypes so every chunk
+            // agrees on the schema
+            m_csv_names = get_column_names_from_table(table);
+
+            m_csv_dtypes.reserve(table.tbl->num_columns());
+            for (const auto& column : table.tbl->view())
+            {
+                m_csv_dtypes.emplace_back(column.type());
+            }
+        }
+        else
+        {
+            options.names(m_csv_names).dtypes(m_csv_dtypes).header(-1);
+
+            table = cudf::io::read_csv(options.build());
+        }
+    }
+    else
+    {
+        auto options = cudf::io::json_reader_options::builder(cudf::io::source_info{m_filename})
+                           .lines(true)
+                           .byte_range_offset(offset)
+                           .byte_range_size(m_chunk_bytes);
+
+        if (!m_schema.empty())
+        {
+            options.dtypes(schema_to_cudf_dtypes(m_schema));
+        }
+
+        table = cudf::io::read_json(options.build());
+    }
+
+    filter_table_columns(table, m_columns);
+
+    return table;
+}
+
 pybind11::object read_file_to_df(const std::string& filename, FileTypes file_type)
 {
     auto table          = load_table_from_file(filename, file_type);
@@ -0,0 +1,197 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/io/gds.hpp"
+
+#include <dlfcn.h>  // for dlopen, dlsym
+#include <fcntl.h>  // for open, O_DIRECT, O_RDONLY, O_WRONLY
+#include <unistd.h>  // for close
+
+#include <utility>  // for exchange
+
+// cuFile ships with the CUDA toolkit but the driver is only present on GDS-capable nodes, so the header is used
+// when available and the library is resolved at runtime
+#if __has_include(<cufile.h>)
+    #include <cufile.h>  // for CUfileDescr_t, CUfileHandle_t  IWYU pragma: keep
+    #define MORPHEUS_HAS_CUFILE 1
+#else
+    #define MORPHEUS_HAS_CUFILE 0
+#endif
+
+namespace {
+
+#if MORPHEUS_HAS_CUFILE
+
+// cuFile entry points, resolved once per process. `read` stays null when the library is not installed or the
+// driver refuses to open, in which case every handle comes back invalid.
+struct CuFileApi
+{
+    decltype(&cuFileHandleRegister) handle_register{nullptr};
+    decltype(&cuFileHandleDeregister) handle_deregister{nullptr};
+    decltype(&cuFileRead) read{nullptr};
+    decltype(&cuFileWrite) write{nullptr};
+};
+
+const CuFileApi& get_cufile_api()
+{
+    static const CuFileApi api = []() {
+        CuFileApi resolved;
+
+        auto* lib = dlopen("libcufile.so.0", RTLD_NOW | RTLD_LOCAL);
+        if (lib == nullptr)
+        {
+            return resolved;
+        }
+
+        auto* driver_open       = dlsym(lib, "cuFileDriverOpen");
+        auto* handle_register   = dlsym(lib, "cuFileHandleRegister");
+        auto* handle_deregister = dlsym(lib, "cuFileHandleDeregister");
+        auto* read              = dlsym(lib, "cuFileRead");
+        auto* write             = dlsym(lib, "cuFileWrite");
+
+        if (driver_open == nullptr || handle_register == nullptr || handle_deregister == nullptr ||
+            read == nullptr || write == nullptr)
+        {
+            return resolved;
+        }
+
+        if (reinterpret_cast<decltype(&cuFileDriverOpen)>(driver_open)().err != CU_FILE_SUCCESS)
+        {
+            return resolved;
+        }
+
+        resolved.handle_register   = reinterpret_cast<decltype(&cuFileHandleRegister)>(handle_register);
+        resolved.handle_deregister = reinterpret_cast<decltype(&cuFileHandleDeregister)>(handle_deregister);
+        resolved.read              = reinterpret_cast<decltype(&cuFileRead)>(read);
+        resolved.write             = reinterpret_cast<decltype(&cuFileWrite)>(write);
+        return resolved;
+    }();
+
+    return api;
+}
+
+#endif  // MORPHEUS_HAS_CUFILE
+
+}  // namespace
+
+namespace morpheus {
+
+GDSFileHandle::GDSFileHandle(int fd, void* handle) : m_fd(fd), m_handle(handle) {}
+
+GDSFileHandle::~GDSFileHandle()
+{
+    this->close();
+}
+
+GDSFileHandle::GDSFileHandle(GDSFileHandle&& other) noexcept :
+  m_fd(std::exchange(other.m_fd, -1)),
+  m_handle(std::exchange(other.m_handle, nullptr))
+{}
+
+GDSFileHandle& GDSFileHandle::operator=(GDSFileHandle&& other) noexcept
+{
+    if (this != &other)
+    {
+        this->close();
+        m_fd     = std::exchange(other.m_fd, -1);
+        m_handle = std::exchange(other.m_handle, nullptr);
+    }
+
+    return *this;
+}
+
+GDSFileHandle GDSFileHandle::open(const std::string& filename, int flags)
+{
+#if MORPHEUS_HAS_CUFILE
+    if (get_cufile_api().read == nullptr)
+    {
+        return {};
+    }
+
+    const int fd = ::open(filename.c_str(), flags | O_DIRECT);
+    if (fd < 0)
+    {
+        return {};
+    }
+
+    CUfileDescr_t descr{};
+    descr.type      = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+    descr.handle.fd = fd;
+
+    CUfileHandle_t handle{};
+    if (get_cufile_api().handle_register(&handle, &descr).err != CU_FILE_SUCCESS)
+    {
+        ::close(fd);
+        return {};
+    }
+
+    return {fd, handle};
+#else
+    return {};
+#endif
+}
+
+GDSFileHandle GDSFileHandle::open_read(const std::string& filename)
+{
+    return open(filename, O_RDONLY);
+}
+
+GDSFileHandle GDSFileHandle::open_write(const std::string& filename)
+{
+    return open(filename, O_WRONLY);
+}
+
+bool GDSFileHandle::valid() const
+{
+    return m_fd >= 0;
+}
+
+ssize_t GDSFileHandle::read(void* device_data, std::size_t size, off_t file_offset) const
+{
+#if MORPHEUS_HAS_CUFILE
+    return get_cufile_api().read(static_cast<CUfileHandle_t>(m_handle), device_data, size, file_offset, 0);
+#else
+    return -1;
+#endif
+}
+
+ssize_t GDSFileHandle::write(const void* device_data, std::size_t size, off_t file_offset) const
+{
+#if MORPHEUS_HAS_CUFILE
+    return get_cufile_api().write(static_cast<CUfileHandle_t>(m_handle), device_data, size, file_offset, 0);
+#else
+    return -1;
+#endif
+}
+
+void GDSFileHandle::close()
+{
+    if (m_fd < 0)
+    {
+        return;
+    }
+
+#if MORPHEUS_HAS_CUFILE
+    get_cufile_api().handle_deregister(static_cast<CUfileHandle_t>(m_handle));
+#endif
+    ::close(m_fd);
+
+    m_fd     = -1;
+    m_handle = nullptr;
+}
+
+}  // namespace morpheus
@@ -17,9 +17,14 @@
 
 #include "morpheus/io/loaders/file.hpp"
 
+#include "morpheus/io/deserializers.hpp"  // for load_table_from_file, prepare_df_index
 #include "morpheus/messages/control.hpp"
 #include "morpheus/messages/meta.hpp"
 
+#include <cudf/concatenate.hpp>       // for concatenate
+#include <cudf/io/types.hpp>          // for table_with_metadata
+#include <cudf/table/table.hpp>       // for table
+#include <cudf/table/table_view.hpp>  // for table_view
 #include <glog/logging.h>
 #include <nlohmann/json.hpp>
 #include <pybind11/cast.h>
@@ -30,29 +35,139 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>  // for atomic
 #include <cctype>
+#include <exception>  // for exception_ptr
 #include <filesystem>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace py = pybind11;
 
+namespace {
+
+// Normalizes a file entry's extension, either from its explicit "type" or from the path
+std::string file_extension(const std::filesystem::path& path, const nlohmann::json& file)
+{
+    std::string extension = file.value("type", path.extension().string());
+
+    // Remove the leading period
+    if (!extension.empty() && extension[0] == '.')
+    {
+        extension = extension.substr(1);
+    }
+
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    return extension;
+}
+
+// Extensions the C++ reader handles, anything else keeps the python cudf readers
+std::optional<morpheus::FileTypes> cpp_file_type(const std::string& extension)
+{
+    if (extension == "csv")
+    {
+        return morpheus::FileTypes::CSV;
+    }
+
+    if (extension == "json" || extension == "jsonlines")
+    {
+        return morpheus::FileTypes::JSON;
+    }
+
+    if (extension == "parquet")
+    {
+        return morpheus::FileTypes::PARQUET;
+    }
+
+    if (extension == "arrow" || extension == "feather" || extension == "ipc")
+    {
+        return morpheus::FileTypes::ARROW;
+    }
+
+    return std::nullopt;
+}
+
+}  // namespace
+
 namespace morpheus {
 
 FileDataLoader::FileDataLoader(nlohmann::json config) : Loader(config) {}
 
-std::shared_ptr<ControlMessage> FileDataLoader::load(std::shared_ptr<ControlMessage> message, nlohmann::json task)
+std::shared_ptr<MessageMeta> FileDataLoader::load_parallel(
+    const std::vector<std::pair<std::string, FileTypes>>& files, std::size_t num_threads)
 {
-    VLOG(30) << "Called FileDataLoader::load()";
+    if (num_threads == 0)
+    {
+        num_threads = std::thread::hardware_concurrency();
+    }
 
-    // Aggregate dataframes for each file
-    py::gil_scoped_acquire gil;
-    py::module_ mod_cudf;
+    num_threads = std::max<std::size_t>(std::min(num_threads, files.size()), 1);
 
-    auto& cache_handle = mrc::pymrc::PythonObjectCache::get_handle();
-    mod_cudf           = cache_handle.get_module("cudf");
+    std::vector<cudf::io::table_with_metadata> tables(files.size());
+    std::vector<std::exception_ptr> errors(files.size());
+    std::atomic<std::size_t> next_file{0};
+
+    auto worker = [&]() {
+        for (auto idx = next_file.fetch_add(1); idx < files.size(); idx = next_file.fetch_add(1))
+        {
+            try
+            {
+                tables[idx] = load_table_from_file(files[idx].first, files[idx].second);
+            } catch (...)
+            {
+                errors[idx] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+
+    for (std::size_t i = 0; i < num_threads; ++i)
+    {
+        workers.emplace_back(worker);
+    }
+
+    for (auto& thread : workers)
+    {
+        thread.join();
+    }
+
+    for (auto& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::vector<cudf::table_view> views;
+    views.reserve(tables.size());
+
+    for (const auto& table : tables)
+    {
+        views.emplace_back(table.tbl->view());
+    }
+
+    // Single device-side concatenate, throws if the files disagree on the schema
+    cudf::io::table_with_metadata combined;
+    combined.metadata = std::move(tables.front().metadata);
+    combined.tbl      = cudf::concatenate(views);
+
+    int index_col_count = prepare_df_index(combined);
+
+    return MessageMeta::create_from_cpp(std::move(combined), index_col_count);
+}
+
+std::shared_ptr<ControlMessage> FileDataLoader::load(std::shared_ptr<ControlMessage> message, nlohmann::json task)
+{
+    VLOG(30) << "Called FileDataLoader::load()";
 
     // TODO(Devin) : error checking + improve robustness
     if (!task["files"].is_array() or task.empty())
@@ -66,19 +181,59 @@ std::shared_ptr<ControlMessage> FileDataLoader::load(std::shared_ptr<ControlMess
         throw std::runtime_error("Only 'aggregate' strategy is currently supported");
     }
 
-    auto files           = task["files"];
-    py::object dataframe = py::none();
-    // TODO(Devin) : Migrate this to use the cudf::io interface
+    auto files = task["files"];
+
+    // When every file is a type the C++ reader handles, load them on a thread pool and aggregate with a single
+    // device-side concatenate, never touching python. Tasks listing hundreds of small files are bound by the
+    // serial per-file latency otherwise
+    std::vector<std::pair<std::string, FileTypes>> cpp_files;
+    cpp_files.reserve(files.size());
+
     for (auto& file : files)
     {
         std::filesystem::path path(file.value("path", ""));
-        std::string extension = file.value("type", path.extension().string());
-        // Remove the leading period
-        if (!extension.empty() && extension[0] == '.')
+        auto file_type = cpp_file_type(file_extension(path, file));
+
+        if (!file_type)
         {
-            extension = extension.substr(1);
+            cpp_files.clear();
+            break;
         }
-        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+        cpp_files.emplace_back(path.string(), *file_type);
+    }
+
+    if (!cpp_files.empty())
+    {
+        auto config_json        = this->config();
+        std::size_t num_threads = config_json.is_object() ? config_json.value("num_threads", 0) : 0;
+        num_threads             = task.value("num_threads", num_threads);
+
+        try
+        {
+            message->payload(this->load_parallel(cpp_files, num_threads));
+            return message;
+        } catch (const std::exception& e)
+        {
+            // Typically the files disagreeing on the schema, python's concat can still align them by name
+            LOG(WARNING) << "Parallel file load failed (" << e.what()
+                         << "), falling back to the serial python loaders";
+        }
+    }
+
+    // Aggregate dataframes for each file
+    py::gil_scoped_acquire gil;
+    py::module_ mod_cudf;
+
+    auto& cache_handle = mrc::pymrc::PythonObjectCache::get_handle();
+    mod_cudf           = cache_handle.get_module("cudf");
+
+    py::object dataframe = py::none();
+    // TODO(Devin) : Migrate this to use the cudf::io interface
+    for (auto& file : files)
+    {
+        std::filesystem::path path(file.value("path", ""));
+        std::string extension = file_extension(path, file);
 
         VLOG(5) << "Loading file: " << file.dump(2);
 
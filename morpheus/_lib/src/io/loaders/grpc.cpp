@@ -17,12 +17,113 @@
 
 #include "morpheus/io/loaders/grpc.hpp"
 
+#include "morpheus/io/deserializers.hpp"       // for prepare_df_index
+#include "morpheus/messages/meta.hpp"          // for MessageMeta
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <arrow/ipc/reader.h>  // for Listener & StreamDecoder
+#include <arrow/record_batch.h>
+#include <arrow/status.h>
+#include <arrow/table.h>
+#include <arrow/type.h>  // for Schema & Field
+#include <cudf/concatenate.hpp>
+#include <cudf/interop.hpp>   // for from_arrow
+#include <cudf/io/types.hpp>  // for table_with_metadata
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <glog/logging.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <grpcpp/grpcpp.h>
 #include <nlohmann/json.hpp>
 
+#include <cstdint>  // for uint8_t & int64_t
 #include <memory>
 #include <ostream>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Arrow IPC stream listener which moves each decoded record batch to device as soon as it arrives, so host
+ * memory only ever holds the batch currently in flight instead of the whole stream.
+ */
+class DeviceAssemblyListener : public arrow::ipc::Listener
+{
+  public:
+    arrow::Status OnSchemaDecoded(std::shared_ptr<arrow::Schema> schema) override
+    {
+        m_schema = std::move(schema);
+
+        return arrow::Status::OK();
+    }
+
+    arrow::Status OnRecordBatchDecoded(std::shared_ptr<arrow::RecordBatch> record_batch) override
+    {
+        auto table_result = arrow::Table::FromRecordBatches({std::move(record_batch)});
+        if (!table_result.ok())
+        {
+            return table_result.status();
+        }
+
+        m_device_tables.emplace_back(cudf::from_arrow(*table_result.ValueUnsafe()));
+
+        return arrow::Status::OK();
+    }
+
+    const std::shared_ptr<arrow::Schema>& schema() const
+    {
+        return m_schema;
+    }
+
+    std::vector<std::unique_ptr<cudf::table>>& device_tables()
+    {
+        return m_device_tables;
+    }
+
+  private:
+    std::shared_ptr<arrow::Schema> m_schema;
+    std::vector<std::unique_ptr<cudf::table>> m_device_tables;
+};
+
+// Blocks on the next completion queue event, which must be `expected_tag`, and returns its ok flag
+bool wait_for_tag(grpc::CompletionQueue& cq, void* expected_tag)
+{
+    void* tag = nullptr;
+    bool ok   = false;
+
+    if (!cq.Next(&tag, &ok))
+    {
+        throw std::runtime_error("'gRPC Loader' completion queue shut down unexpectedly");
+    }
+
+    DCHECK(tag == expected_tag);
+
+    return ok;
+}
+
+void feed_decoder(arrow::ipc::StreamDecoder& decoder, const grpc::ByteBuffer& buffer)
+{
+    std::vector<grpc::Slice> slices;
+    auto status = buffer.Dump(&slices);
+    if (!status.ok())
+    {
+        throw std::runtime_error("'gRPC Loader' failed to read response buffer: " + status.error_message());
+    }
+
+    for (const auto& slice : slices)
+    {
+        auto consume_status = decoder.Consume(reinterpret_cast<const std::uint8_t*>(slice.begin()),
+                                              static_cast<std::int64_t>(slice.size()));
+        if (!consume_status.ok())
+        {
+            throw std::runtime_error("'gRPC Loader' failed to decode record batch: " + consume_status.ToString());
+        }
+    }
+}
+}  // namespace
 
 namespace morpheus {
 GRPCDataLoader::GRPCDataLoader(nlohmann::json config) : Loader(config) {}
@@ -31,7 +132,104 @@ std::shared_ptr<ControlMessage> GRPCDataLoader::load(std::shared_ptr<ControlMess
 {
     VLOG(30) << "Called GRPCDataLoader::load()";
 
-    // TODO(Devin): Implement this
-    throw std::runtime_error("GRPCDataLoader::load() not implemented yet");
+    if (!task.contains("endpoint") || !task.contains("method"))
+    {
+        throw std::runtime_error("'gRPC Loader' control message must specify an 'endpoint' and a 'method'");
+    }
+
+    auto endpoint = task["endpoint"].get<std::string>();
+    auto method   = task["method"].get<std::string>();
+
+    // Optional serialized request message, many streaming export RPCs take an empty request
+    auto request_payload = task.value("request", std::string());
+
+    auto listener = std::make_shared<DeviceAssemblyListener>();
+    arrow::ipc::StreamDecoder decoder(listener);
+
+    auto channel = grpc::CreateChannel(endpoint, grpc::InsecureChannelCredentials());
+    grpc::GenericStub stub(channel);
+
+    grpc::ClientContext context;
+    grpc::CompletionQueue cq;
+
+    auto call = stub.PrepareCall(&context, method, &cq);
+
+    call->StartCall(reinterpret_cast<void*>(1));
+    if (!wait_for_tag(cq, reinterpret_cast<void*>(1)))
+    {
+        throw std::runtime_error("'gRPC Loader' failed to start call to " + endpoint);
+    }
+
+    grpc::Slice request_slice(request_payload);
+    grpc::ByteBuffer request_buffer(&request_slice, 1);
+
+    call->Write(request_buffer, reinterpret_cast<void*>(2));
+    if (!wait_for_tag(cq, reinterpret_cast<void*>(2)))
+    {
+        throw std::runtime_error("'gRPC Loader' failed to send request to " + endpoint);
+    }
+
+    call->WritesDone(reinterpret_cast<void*>(3));
+    wait_for_tag(cq, reinterpret_cast<void*>(3));
+
+    // Each streamed message carries a chunk of an Arrow IPC stream. Decode as the chunks arrive, the listener moves
+    // every completed record batch to device immediately.
+    grpc::ByteBuffer response_buffer;
+    while (true)
+    {
+        call->Read(&response_buffer, reinterpret_cast<void*>(4));
+        if (!wait_for_tag(cq, reinterpret_cast<void*>(4)))
+        {
+            break;  // Server half-closed the stream
+        }
+
+        feed_decoder(decoder, response_buffer);
+        response_buffer.Clear();
+    }
+
+    grpc::Status status;
+    call->Finish(&status, reinterpret_cast<void*>(5));
+    wait_for_tag(cq, reinterpret_cast<void*>(5));
+
+    if (!status.ok())
+    {
+        throw std::runtime_error(
+            MORPHEUS_CONCAT_STR("'gRPC Loader' stream from " << endpoint << " failed: " << status.error_message()));
+    }
+
+    auto& device_tables = listener->device_tables();
+    if (!listener->schema() || device_tables.empty())
+    {
+        throw std::runtime_error("'gRPC Loader' stream from " + endpoint + " contained no record batches");
+    }
+
+    cudf::io::table_with_metadata combined;
+    for (const auto& field : listener->schema()->fields())
+    {
+        combined.metadata.schema_info.emplace_back(field->name());
+    }
+
+    if (device_tables.size() == 1)
+    {
+        combined.tbl = std::move(device_tables.front());
+    }
+    else
+    {
+        std::vector<cudf::table_view> views;
+        views.reserve(device_tables.size());
+
+        for (const auto& table : device_tables)
+        {
+            views.emplace_back(table->view());
+        }
+
+        combined.tbl = cudf::concatenate(views);
+    }
+
+    int index_col_count = prepare_df_index(combined);
+
+    message->payload(MessageMeta::create_from_cpp(std::move(combined), index_col_count));
+
+    return message;
 }
-}  // namespace morpheus
\ No newline at end of file
+}  // namespace morpheus
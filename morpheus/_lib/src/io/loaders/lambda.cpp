@@ -23,19 +23,44 @@
 #include <memory>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 namespace morpheus {
-LambdaLoader::LambdaLoader(
-    std::function<std::shared_ptr<ControlMessage>(std::shared_ptr<ControlMessage>, nlohmann::json)> lambda_load,
-    nlohmann::json config) :
+LambdaLoader::LambdaLoader(lambda_load_t lambda_load, nlohmann::json config) :
   Loader(config),
   m_lambda_load(std::move(lambda_load))
 {}
 
+LambdaLoader::LambdaLoader(lambda_load_batch_t lambda_load_batch, nlohmann::json config) :
+  Loader(config),
+  m_lambda_load_batch(std::move(lambda_load_batch))
+{}
+
 std::shared_ptr<ControlMessage> LambdaLoader::load(std::shared_ptr<ControlMessage> message, nlohmann::json task)
 {
     VLOG(30) << "Called LambdaLoader::load()";
 
+    if (!m_lambda_load)
+    {
+        // Only a batched callable was supplied, hand it a batch of one
+        auto loaded = m_lambda_load_batch({std::move(message)}, {std::move(task)});
+
+        return std::move(loaded.front());
+    }
+
     return std::move(m_lambda_load(message, task));
 }
+
+std::vector<std::shared_ptr<ControlMessage>> LambdaLoader::load_batch(
+    std::vector<std::shared_ptr<ControlMessage>> messages, std::vector<nlohmann::json> tasks)
+{
+    VLOG(30) << "Called LambdaLoader::load_batch() with " << messages.size() << " messages";
+
+    if (!m_lambda_load_batch)
+    {
+        return Loader::load_batch(std::move(messages), std::move(tasks));
+    }
+
+    return std::move(m_lambda_load_batch(std::move(messages), std::move(tasks)));
+}
 }  // namespace morpheus
\ No newline at end of file
@@ -30,6 +30,9 @@ PayloadDataLoader::PayloadDataLoader(nlohmann::json config) : Loader(config) {}
 std::shared_ptr<ControlMessage> PayloadDataLoader::load(std::shared_ptr<ControlMessage> message, nlohmann::json task)
 {
     VLOG(30) << "Called PayloadDataLoader::load()";
+
+    // The payload is already attached to the message; forwarding the shared_ptr untouched keeps the attach path
+    // at the single MessageMeta construction made by whichever reader produced the table
     return std::move(message);
 }
 }  // namespace morpheus
\ No newline at end of file
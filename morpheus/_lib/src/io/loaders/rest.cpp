@@ -55,14 +55,20 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>  // for atomic
 #include <cctype>
 #include <chrono>
+#include <cstddef>    // for size_t
+#include <exception>  // for exception_ptr
+#include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <stdexcept>
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 namespace py = pybind11;
 
@@ -71,6 +77,74 @@ namespace http  = beast::http;
 namespace net   = boost::asio;
 
 namespace {
+
+/**
+ * @brief Small pool of persistent keep-alive connections to one host:port. Connections are handed back after each
+ * exchange and reused for the next request instead of paying a TCP (re)connect per query, which dominates when a
+ * task pages through the same endpoint many times.
+ */
+class ConnectionPool
+{
+  public:
+    ConnectionPool(const std::string& host, const std::string& port)
+    {
+        net::ip::tcp::resolver resolver(m_ioc);
+        m_endpoints = resolver.resolve(host, port);
+    }
+
+    struct Connection
+    {
+        std::unique_ptr<beast::tcp_stream> stream;
+
+        // False when the stream is a reused keep-alive connection, the server may have closed it in the meantime
+        bool fresh{true};
+    };
+
+    Connection acquire()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (!m_idle.empty())
+            {
+                Connection connection{std::move(m_idle.back()), false};
+                m_idle.pop_back();
+
+                return connection;
+            }
+        }
+
+        auto stream = std::make_unique<beast::tcp_stream>(m_ioc);
+        stream->connect(m_endpoints);
+
+        return {std::move(stream), true};
+    }
+
+    void release(std::unique_ptr<beast::tcp_stream> stream, bool reusable)
+    {
+        if (reusable)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_idle.push_back(std::move(stream));
+
+            return;
+        }
+
+        // Best effort, the connection is being dropped either way
+        beast::error_code ec;
+        stream->socket().shutdown(net::ip::tcp::socket::shutdown_both, ec);
+    }
+
+  private:
+    net::io_context m_ioc;
+    net::ip::tcp::resolver::results_type m_endpoints;
+
+    std::mutex m_mutex;
+    std::vector<std::unique_ptr<beast::tcp_stream>> m_idle;
+};
+
+using connection_pool_map_t = std::map<std::string, std::shared_ptr<ConnectionPool>>;
+
 void extract_query_fields(nlohmann::json& query,
                           std::string& method,
                           std::string& endpoint,
@@ -161,27 +235,38 @@ void construct_request(http::request<http::string_body>& request,
 }
 
 void get_response_with_retry(http::request<http::string_body>& request,
-                             const std::string& port,
+                             ConnectionPool& pool,
                              http::response<http::dynamic_body>& response,
                              int max_retry,
                              int retry_interval_milliseconds)
 {
-    net::io_context ioc;
-    net::ip::tcp::resolver resolver(ioc);
-    beast::tcp_stream stream(ioc);
-    auto const endpoint_results = resolver.resolve(std::string(request[http::field::host]), port);
     while (max_retry > 0)
     {
-        stream.connect(endpoint_results);
-        http::write(stream, request);
-        beast::flat_buffer buffer;
-        http::read(stream, buffer, response);
-        beast::error_code ec;
-        stream.socket().shutdown(net::ip::tcp::socket::shutdown_both, ec);
-        if (ec && ec != beast::errc::not_connected)
+        auto connection = pool.acquire();
+
+        try
         {
-            throw beast::system_error{ec};
+            response = {};
+            http::write(*connection.stream, request);
+            beast::flat_buffer buffer;
+            http::read(*connection.stream, buffer, response);
+        } catch (const beast::system_error&)
+        {
+            pool.release(std::move(connection.stream), false);
+
+            // A reused keep-alive connection the server has since closed fails here, retry on a fresh one without
+            // consuming a retry
+            if (!connection.fresh)
+            {
+                continue;
+            }
+
+            throw;
         }
+
+        // Hand the connection back for the next request when the server allows it
+        pool.release(std::move(connection.stream), response.keep_alive());
+
         unsigned status = response.result_int();
         // Retry only if status is 503 Service Unavailable / 504 Gateway Timeout
         if (status != (unsigned)http::status::service_unavailable && status != (unsigned)http::status::gateway_timeout)
@@ -267,22 +352,22 @@ void parse_params(nlohmann::json& params, std::string& query)
 }
 
 void get_response_from_endpoint(http::response<http::dynamic_body>& response,
-                                std::string& method,
-                                std::string& host,
-                                std::string& target,
-                                std::string& query,
-                                std::string& port,
-                                std::string& http_version,
-                                std::string& content_type,
-                                std::string& body,
-                                nlohmann::json& x_headers,
+                                const std::string& method,
+                                const std::string& host,
+                                const std::string& target,
+                                const std::string& query,
+                                ConnectionPool& pool,
+                                const std::string& http_version,
+                                const std::string& content_type,
+                                const std::string& body,
+                                const nlohmann::json& x_headers,
                                 int max_retry,
                                 int retry_interval_milliseconds)
 {
     http::request<http::string_body> request;
 
     construct_request(request, method, host, target, query, http_version, content_type, body, x_headers);
-    get_response_with_retry(request, port, response, max_retry, retry_interval_milliseconds);
+    get_response_with_retry(request, pool, response, max_retry, retry_interval_milliseconds);
 }
 
 void create_dataframe_from_response(py::object& dataframe,
@@ -320,9 +405,11 @@ void create_dataframe_from_response(py::object& dataframe,
 
 void create_dataframe_from_query(py::object& dataframe,
                                  py::module_& mod_cudf,
+                                 connection_pool_map_t& pools,
                                  nlohmann::json& query,
                                  int max_retry,
                                  int retry_interval_milliseconds,
+                                 int max_concurrency,
                                  std::string& strategy)
 {
     std::string method;
@@ -340,6 +427,13 @@ void create_dataframe_from_query(py::object& dataframe,
     std::string queries;
     parse_endpoint(endpoint, host, target, queries);
 
+    // Queries against the same host:port share the pool, so their keep-alive connections get reused
+    auto& pool = pools[host + ":" + port];
+    if (!pool)
+    {
+        pool = std::make_shared<ConnectionPool>(host, port);
+    }
+
     if (params.empty())
     {
         http::response<http::dynamic_body> response;
@@ -348,7 +442,7 @@ void create_dataframe_from_query(py::object& dataframe,
                                    host,
                                    target,
                                    queries,
-                                   port,
+                                   *pool,
                                    http_version,
                                    content_type,
                                    body,
@@ -359,23 +453,77 @@ void create_dataframe_from_query(py::object& dataframe,
     }
     else
     {
-        // For each set of param, send a separate request
+        // For each set of param, send a separate request. Encode every page's query string up front (urlencode needs
+        // the GIL), then fetch the pages concurrently and reassemble the responses in their original order.
+        std::vector<std::string> page_queries;
+        page_queries.reserve(params.size());
         for (auto& param : params)
         {
             parse_params(param, queries);
-            http::response<http::dynamic_body> response;
-            get_response_from_endpoint(response,
-                                       method,
-                                       host,
-                                       target,
-                                       queries,
-                                       port,
-                                       http_version,
-                                       content_type,
-                                       body,
-                                       x_headers,
-                                       max_retry,
-                                       retry_interval_milliseconds);
+            page_queries.push_back(queries);
+        }
+
+        std::vector<http::response<http::dynamic_body>> responses(page_queries.size());
+        std::vector<std::exception_ptr> errors(page_queries.size());
+        std::atomic<std::size_t> next_page{0};
+
+        auto fetch_pages = [&]() {
+            for (auto page_idx = next_page.fetch_add(1); page_idx < page_queries.size();
+                 page_idx      = next_page.fetch_add(1))
+            {
+                try
+                {
+                    get_response_from_endpoint(responses[page_idx],
+                                               method,
+                                               host,
+                                               target,
+                                               page_queries[page_idx],
+                                               *pool,
+                                               http_version,
+                                               content_type,
+                                               body,
+                                               x_headers,
+                                               max_retry,
+                                               retry_interval_milliseconds);
+                } catch (...)
+                {
+                    errors[page_idx] = std::current_exception();
+                }
+            }
+        };
+
+        const auto num_workers = std::min<std::size_t>(max_concurrency, page_queries.size());
+
+        if (num_workers < 2)
+        {
+            fetch_pages();
+        }
+        else
+        {
+            std::vector<std::thread> workers;
+            workers.reserve(num_workers);
+            for (std::size_t i = 0; i < num_workers; ++i)
+            {
+                workers.emplace_back(fetch_pages);
+            }
+
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        for (auto& error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        // Aggregation order matches the order of the param sets regardless of which fetch finished first
+        for (auto& response : responses)
+        {
             create_dataframe_from_response(dataframe, mod_cudf, response, strategy);
         }
     }
@@ -422,16 +570,27 @@ std::shared_ptr<ControlMessage> RESTDataLoader::load(std::shared_ptr<ControlMess
             throw std::runtime_error("'REST Loader' control message specified no queries to load");
         }
 
+        int max_concurrency = conf.value("max_concurrency", 8);
+        if (max_concurrency < 1)
+        {
+            throw std::runtime_error("'REST Loader' receives invalid max_concurrency value: " +
+                                     std::to_string(max_concurrency));
+        }
+
         std::string strategy = task.value("strategy", "aggregate");
         if (strategy != "aggregate")
         {
             throw std::runtime_error("Only 'aggregate' strategy is currently supported");
         }
 
+        // Keep-alive connections persist across the queries of this task, keyed by host:port
+        connection_pool_map_t pools;
+
         auto queries = task["queries"];
         for (auto& query : queries)
         {
-            create_dataframe_from_query(dataframe, mod_cudf, query, max_retry, retry_interval_milliseconds, strategy);
+            create_dataframe_from_query(
+                dataframe, mod_cudf, pools, query, max_retry, retry_interval_milliseconds, max_concurrency, strategy);
         }
 
         {
@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/io/parquet_writer.hpp"
+
+#include "morpheus/utilities/edge_gauges.hpp"  // for EdgeGaugeRegistry
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <cudf/io/parquet.hpp>
+#include <cudf/io/types.hpp>  // for column_name_info, sink_info, table_input_metadata
+#include <cudf/table/table_view.hpp>
+#include <glog/logging.h>
+
+#include <filesystem>
+#include <iomanip>  // for setfill & setw
+#include <mutex>
+#include <sstream>    // for ostringstream
+#include <stdexcept>  // for runtime_error
+#include <utility>    // for move
+
+namespace morpheus {
+
+/****** Component public implementations *******************/
+/****** ParquetPartitionedSink*****************************/
+ParquetPartitionedSink::ParquetPartitionedSink(std::string output_dir,
+                                              std::string file_prefix,
+                                              std::size_t num_writer_threads,
+                                              std::chrono::seconds window) :
+  m_output_dir(std::move(output_dir)),
+  m_file_prefix(std::move(file_prefix)),
+  m_window(window),
+  m_gauge(EdgeGaugeRegistry::instance().get_or_create("ParquetPartitionedSink.queue"))
+{
+    CHECK_GT(num_writer_threads, 0);
+
+    std::filesystem::create_directories(m_output_dir);
+
+    m_workers.reserve(num_writer_threads);
+    for (std::size_t i = 0; i < num_writer_threads; ++i)
+    {
+        m_workers.emplace_back([this]() {
+            this->worker_loop();
+        });
+    }
+}
+
+ParquetPartitionedSink::~ParquetPartitionedSink()
+{
+    try
+    {
+        this->close();
+    } catch (const std::exception& e)
+    {
+        LOG(ERROR) << "Error closing ParquetPartitionedSink: " << e.what();
+    }
+}
+
+void ParquetPartitionedSink::write_async(const TableInfo& tbl)
+{
+    // Snapshot on device before queueing, the caller's view into the message is only valid until it returns
+    auto snapshot = std::make_unique<cudf::table>(tbl.get_view());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_closed)
+    {
+        throw std::runtime_error("ParquetPartitionedSink has been closed");
+    }
+
+    if (m_error)
+    {
+        std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+
+    m_pending.push_back(
+        WorkItem{std::move(snapshot), tbl.get_column_names(), this->partition_directory(), m_next_sequence++});
+    m_gauge.enqueue();
+
+    m_work_ready.notify_one();
+}
+
+void ParquetPartitionedSink::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_work_done.wait(lock, [this]() {
+        return (m_pending.empty() && m_in_flight == 0) || m_error;
+    });
+
+    if (m_error)
+    {
+        std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+}
+
+void ParquetPartitionedSink::close()
+{
+    this->flush();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_closed)
+        {
+            return;
+        }
+
+        m_closed = true;
+        m_work_ready.notify_all();
+    }
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+std::size_t ParquetPartitionedSink::pending() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_pending.size() + m_in_flight;
+}
+
+std::string ParquetPartitionedSink::partition_directory()
+{
+    if (m_window.count() == 0)
+    {
+        return m_output_dir;
+    }
+
+    // Bucket by the wall-clock window the batch was queued in, so consumers can pick up closed windows
+    const auto now = std::chrono::duration_cast<std::chrono::seconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    const auto window_start = now - (now % m_window.count());
+
+    auto directory = MORPHEUS_CONCAT_STR(m_output_dir << "/window_" << window_start);
+
+    std::filesystem::create_directories(directory);
+
+    return directory;
+}
+
+void ParquetPartitionedSink::worker_loop()
+{
+    for (;;)
+    {
+        WorkItem item;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_work_ready.wait(lock, [this]() {
+                return !m_pending.empty() || m_closed;
+            });
+
+            if (m_pending.empty())
+            {
+                return;
+            }
+
+            item = std::move(m_pending.front());
+            m_pending.pop_front();
+            m_gauge.dequeue();
+            ++m_in_flight;
+        }
+
+        try
+        {
+            std::ostringstream filename;
+            filename << item.directory << "/" << m_file_prefix << "-" << std::setfill('0') << std::setw(6)
+                     << item.sequence << ".parquet";
+
+            cudf::io::table_input_metadata tbl_meta{cudf::io::table_metadata{
+                std::vector<cudf::io::column_name_info>{item.column_names.cbegin(), item.column_names.cend()}}};
+
+            auto destination     = cudf::io::sink_info(filename.str());
+            auto options_builder = cudf::io::parquet_writer_options_builder(destination, item.table->view())
+                                       .metadata(std::move(tbl_meta));
+
+            cudf::io::write_parquet(options_builder.build());
+        } catch (...)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (!m_error)
+            {
+                m_error = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            --m_in_flight;
+            m_work_done.notify_all();
+        }
+    }
+}
+
+}  // namespace morpheus
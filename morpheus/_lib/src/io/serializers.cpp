@@ -17,9 +17,19 @@
 
 #include "morpheus/io/serializers.hpp"
 
+#include "morpheus/io/gds.hpp"  // for GDSFileHandle
 #include "morpheus/objects/table_info_data.hpp"
 #include "morpheus/utilities/cudf_util.hpp"
-
+#include "morpheus/utilities/pinned_memory.hpp"  // for PinnedMemory
+
+#include <arrow/buffer.h>      // for Buffer
+#include <arrow/io/file.h>     // for FileOutputStream
+#include <arrow/io/memory.h>   // for BufferOutputStream
+#include <arrow/ipc/writer.h>  // for MakeFileWriter, MakeStreamWriter, RecordBatchWriter
+#include <arrow/table.h>       // for Table
+#include <cuda_runtime.h>    // for cudaMemcpyAsync
+#include <cudf/copying.hpp>  // for slice
+#include <cudf/interop.hpp>  // for to_arrow, column_metadata
 #include <cudf/io/csv.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/json.hpp>
@@ -28,16 +38,28 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <glog/logging.h>
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
 #include <pybind11/cast.h>
 #include <pybind11/pytypes.h>
 #include <pybind11/stl.h>  // IWYU pragma: keep
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>  // for device_buffer
 #include <rmm/mr/device/per_device_resource.hpp>
 
-#include <cstddef>  // for size_t
+#include <fcntl.h>   // for open, O_CREAT, O_TRUNC, O_WRONLY
+#include <unistd.h>  // for close, fdatasync, pwrite
+
+#include <algorithm>   // for min
+#include <cerrno>      // for errno
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint8_t
+#include <cstring>     // for strerror
 #include <fstream>
+#include <functional>  // for function
+#include <memory>      // for shared_ptr
 #include <numeric>
-#include <sstream>  // IWYU pragma: keep
+#include <sstream>    // IWYU pragma: keep
+#include <stdexcept>  // for runtime_error
 #include <vector>
 // IWYU pragma: no_include <unordered_map>
 
@@ -46,6 +68,141 @@ namespace py = pybind11;
 using namespace py::literals;
 using namespace std::string_literals;
 
+namespace {
+
+// Upper bound on the pinned staging allocation held by a sink, larger device writes are drained in slices
+constexpr std::size_t MaxStagingBytes = 16UL << 20;
+
+/**
+ * @brief Copies a device buffer produced by a cuDF writer down through a reusable pinned staging buffer, handing
+ * each staged slice to `write_host`. Staging through pinned memory keeps the copy at full bandwidth, and reusing
+ * `staging` across writes means a sink allocates it once.
+ */
+void drain_device_write(void const* gpu_data,
+                        std::size_t size,
+                        rmm::cuda_stream_view stream,
+                        std::shared_ptr<rmm::device_buffer>& staging,
+                        const std::function<void(char const*, std::size_t)>& write_host)
+{
+    const auto staging_size = std::min(size, MaxStagingBytes);
+
+    if (!staging || staging->size() < staging_size)
+    {
+        staging = PinnedMemory::make_buffer(staging_size, stream);
+    }
+
+    const auto* src = static_cast<const uint8_t*>(gpu_data);
+
+    for (std::size_t offset = 0; offset < size; offset += staging_size)
+    {
+        const auto chunk = std::min(size - offset, staging_size);
+
+        MRC_CHECK_CUDA(
+            cudaMemcpyAsync(staging->data(), src + offset, chunk, cudaMemcpyDeviceToHost, stream.value()));
+        stream.synchronize();
+
+        write_host(static_cast<char const*>(staging->data()), chunk);
+    }
+}
+
+/**
+ * @brief File sink which hands the cuDF writer's device buffers straight to the filesystem with GPUDirect Storage
+ * (cuFile) when the node supports it, so encoded row groups move device->NVMe without the host bounce. Host-side
+ * writes (the parquet magic bytes and footer) go through a regular buffered descriptor. When cuFile is missing, the
+ * driver refuses the file, or a write fails mid-stream (e.g. the target is not on a GDS filesystem), the sink
+ * degrades to the same pinned staging path the ostream sinks use.
+ */
+class GDSFileSink : public cudf::io::data_sink
+{
+  public:
+    GDSFileSink(const std::string& filename)
+    {
+        m_fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (m_fd < 0)
+        {
+            throw std::runtime_error("Failed to open '" + filename + "' for writing: " + std::strerror(errno));
+        }
+
+        // cuFile keeps its own O_DIRECT descriptor on the now-created file, host writes use the buffered one
+        m_handle = GDSFileHandle::open_write(filename);
+    }
+
+    ~GDSFileSink() override
+    {
+        ::close(m_fd);
+    }
+
+    void host_write(void const* data, size_t size) override
+    {
+        write_host_at_offset(static_cast<char const*>(data), size);
+    }
+
+    bool supports_device_write() const override
+    {
+        return true;
+    }
+
+    void device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream) override
+    {
+        if (m_handle.valid())
+        {
+            // The writer's buffer is only valid once its enqueued work completes
+            stream.synchronize();
+
+            const auto written = m_handle.write(gpu_data, size, static_cast<off_t>(m_offset));
+
+            if (written == static_cast<ssize_t>(size))
+            {
+                m_offset += size;
+                return;
+            }
+
+            LOG(WARNING) << "cuFile write returned " << written << ", finishing the file with staged writes";
+            m_handle.close();
+        }
+
+        drain_device_write(gpu_data, size, stream, m_staging, [this](char const* data, std::size_t chunk) {
+            write_host_at_offset(data, chunk);
+        });
+    }
+
+    void flush() override
+    {
+        // Writes go straight to the descriptor, flushing means pushing them to stable storage
+        ::fdatasync(m_fd);
+    }
+
+    size_t bytes_written() override
+    {
+        return m_offset;
+    }
+
+  private:
+    void write_host_at_offset(char const* data, std::size_t size)
+    {
+        std::size_t written = 0;
+        while (written < size)
+        {
+            const auto count = ::pwrite(m_fd, data + written, size - written, static_cast<off_t>(m_offset + written));
+            if (count < 0)
+            {
+                throw std::runtime_error("Failed to write parquet output: "s + std::strerror(errno));
+            }
+
+            written += count;
+        }
+
+        m_offset += size;
+    }
+
+    int m_fd{-1};
+    std::size_t m_offset{0};
+    std::shared_ptr<rmm::device_buffer> m_staging;
+    GDSFileHandle m_handle;
+};
+
+}  // namespace
+
 class OStreamSink : public cudf::io::data_sink
 {
   public:
@@ -65,6 +222,23 @@ class OStreamSink : public cudf::io::data_sink
         m_bytest_written += size;
     }
 
+    /**
+     * @brief Accept the writer's output directly in device memory, staged down through pinned host memory. Without
+     * this the writer bounces its output through its own pageable host copy
+     */
+    bool supports_device_write() const override
+    {
+        return true;
+    }
+
+    void device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream) override
+    {
+        drain_device_write(gpu_data, size, stream, m_staging, [this](char const* data, std::size_t chunk) {
+            m_stream.write(data, static_cast<std::streamsize>(chunk));
+            m_bytest_written += chunk;
+        });
+    }
+
     /**
      * @brief Flush the data written into the sink
      */
@@ -86,6 +260,7 @@ class OStreamSink : public cudf::io::data_sink
   private:
     std::ostream& m_stream;
     size_t m_bytest_written{0};
+    std::shared_ptr<rmm::device_buffer> m_staging;
 };
 
 void table_to_csv(
@@ -142,6 +317,45 @@ std::string df_to_csv(const TableInfo& tbl, bool include_header, bool include_in
     return out_stream.str();
 }
 
+namespace {
+
+// Appends into a caller-owned string, letting the buffer's capacity be reused across writes
+class StringSink : public cudf::io::data_sink
+{
+  public:
+    StringSink(std::string& buffer) : m_buffer(buffer) {}
+
+    void host_write(void const* data, size_t size) override
+    {
+        m_buffer.append(static_cast<char const*>(data), size);
+    }
+
+    bool supports_device_write() const override
+    {
+        return true;
+    }
+
+    void device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream) override
+    {
+        drain_device_write(gpu_data, size, stream, m_staging, [this](char const* data, std::size_t chunk) {
+            m_buffer.append(data, chunk);
+        });
+    }
+
+    void flush() override {}
+
+    size_t bytes_written() override
+    {
+        return m_buffer.size();
+    }
+
+  private:
+    std::string& m_buffer;
+    std::shared_ptr<rmm::device_buffer> m_staging;
+};
+
+}  // namespace
+
 void table_to_json(const TableInfoData& tbl, std::ostream& out_stream, bool include_index_col, bool flush)
 {
     if (!include_index_col)
@@ -191,6 +405,59 @@ std::string df_to_json(const TableInfo& tbl, bool include_index_col)
     return out_stream.str();
 }
 
+void df_to_json_chunked(const TableInfo& tbl,
+                        std::ostream& out_stream,
+                        cudf::size_type rows_per_chunk,
+                        std::string& buffer,
+                        bool include_index_col,
+                        bool flush)
+{
+    if (!include_index_col)
+    {
+        LOG(WARNING) << "Ignoring include_index_col=false as this isn't supported by cuDF";
+    }
+
+    CHECK_GT(rows_per_chunk, 0);
+
+    auto column_names = tbl.get_column_names();
+    std::vector<cudf::size_type> col_idexes(column_names.size());
+    std::iota(col_idexes.begin(), col_idexes.end(), 1);
+    auto tbl_view = tbl.get_view().select(col_idexes);
+
+    cudf::io::table_metadata tbl_meta{
+        std::vector<cudf::io::column_name_info>{column_names.cbegin(), column_names.cend()}};
+
+    StringSink sink(buffer);
+    auto destination = cudf::io::sink_info(&sink);
+
+    const auto num_rows = tbl_view.num_rows();
+    for (cudf::size_type start = 0; start < num_rows; start += rows_per_chunk)
+    {
+        const auto stop = std::min(start + rows_per_chunk, num_rows);
+
+        // clear() keeps the capacity, after the first chunk the buffer stops allocating
+        buffer.clear();
+
+        auto chunk_view = cudf::slice(tbl_view, {start, stop}).front();
+
+        auto options_builder = cudf::io::json_writer_options_builder(destination, chunk_view)
+                                   .metadata(tbl_meta)
+                                   .lines(true)
+                                   .include_nulls(true)
+                                   .na_rep("null");
+
+        cudf::io::write_json(options_builder.build());
+
+        // Each chunk is a complete set of JSON lines, streaming them out back to back matches the unchunked output
+        out_stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+        if (flush)
+        {
+            out_stream.flush();
+        }
+    }
+}
+
 void table_to_parquet(
     const TableInfoData& tbl, std::ostream& out_stream, bool include_header, bool include_index_col, bool flush)
 {
@@ -238,6 +505,154 @@ std::string df_to_parquet(const TableInfo& tbl, bool include_header, bool includ
     return out_stream.str();
 }
 
+void table_to_parquet(
+    const TableInfoData& tbl, const std::string& filename, bool include_header, bool include_index_col, bool flush)
+{
+    auto column_names         = tbl.column_names;
+    cudf::size_type start_col = 1;
+    if (include_index_col)
+    {
+        start_col = 0;
+        column_names.insert(column_names.begin(), ""s);  // insert the id column
+    }
+
+    std::vector<cudf::size_type> col_idexes(column_names.size());
+    std::iota(col_idexes.begin(), col_idexes.end(), start_col);
+    auto tbl_view = tbl.table_view.select(col_idexes);
+
+    GDSFileSink sink(filename);
+    auto destination     = cudf::io::sink_info(&sink);
+    auto options_builder = cudf::io::parquet_writer_options_builder(destination, tbl_view);
+
+    cudf::io::write_parquet(options_builder.build());
+
+    if (flush)
+    {
+        sink.flush();
+    }
+}
+
+void df_to_parquet(
+    const TableInfo& tbl, const std::string& filename, bool include_header, bool include_index_col, bool flush)
+{
+    table_to_parquet(TableInfoData{tbl.get_view(), tbl.get_index_names(), tbl.get_column_names()},
+                     filename,
+                     include_header,
+                     include_index_col,
+                     flush);
+}
+
+std::shared_ptr<arrow::Table> table_to_arrow(const TableInfoData& tbl, bool include_index_col)
+{
+    auto column_names         = tbl.column_names;
+    cudf::size_type start_col = 1;
+    if (include_index_col)
+    {
+        start_col = 0;
+        column_names.insert(column_names.begin(), ""s);  // insert the id column
+    }
+
+    std::vector<cudf::size_type> col_idexes(column_names.size());
+    std::iota(col_idexes.begin(), col_idexes.end(), start_col);
+    auto tbl_view = tbl.table_view.select(col_idexes);
+
+    std::vector<cudf::column_metadata> metadata{column_names.cbegin(), column_names.cend()};
+
+    return cudf::to_arrow(tbl_view, metadata);
+}
+
+void table_to_arrow_ipc(const TableInfoData& tbl, const std::string& filename, bool include_index_col)
+{
+    auto arrow_table = table_to_arrow(tbl, include_index_col);
+
+    auto sink = arrow::io::FileOutputStream::Open(filename);
+
+    if (!sink.ok())
+    {
+        throw std::runtime_error("Failed to open Arrow IPC file '" + filename + "': " + sink.status().ToString());
+    }
+
+    auto writer = arrow::ipc::MakeFileWriter(sink.ValueUnsafe(), arrow_table->schema());
+
+    if (!writer.ok())
+    {
+        throw std::runtime_error("Failed to create Arrow IPC writer: " + writer.status().ToString());
+    }
+
+    auto status = writer.ValueUnsafe()->WriteTable(*arrow_table);
+
+    if (status.ok())
+    {
+        status = writer.ValueUnsafe()->Close();
+    }
+
+    if (!status.ok())
+    {
+        throw std::runtime_error("Failed to write Arrow IPC file '" + filename + "': " + status.ToString());
+    }
+}
+
+std::string table_to_arrow_ipc(const TableInfoData& tbl, bool include_index_col)
+{
+    auto arrow_table = table_to_arrow(tbl, include_index_col);
+
+    auto sink = arrow::io::BufferOutputStream::Create();
+
+    if (!sink.ok())
+    {
+        throw std::runtime_error("Failed to create Arrow IPC buffer: " + sink.status().ToString());
+    }
+
+    // The stream format puts the schema ahead of the batches and needs no footer, so each payload decodes on
+    // its own, unlike the file format which is only readable once the footer lands
+    auto writer = arrow::ipc::MakeStreamWriter(sink.ValueUnsafe(), arrow_table->schema());
+
+    if (!writer.ok())
+    {
+        throw std::runtime_error("Failed to create Arrow IPC writer: " + writer.status().ToString());
+    }
+
+    auto status = writer.ValueUnsafe()->WriteTable(*arrow_table);
+
+    if (status.ok())
+    {
+        status = writer.ValueUnsafe()->Close();
+    }
+
+    if (!status.ok())
+    {
+        throw std::runtime_error("Failed to serialize Arrow IPC payload: " + status.ToString());
+    }
+
+    auto buffer = sink.ValueUnsafe()->Finish();
+
+    if (!buffer.ok())
+    {
+        throw std::runtime_error("Failed to finish Arrow IPC buffer: " + buffer.status().ToString());
+    }
+
+    return buffer.ValueUnsafe()->ToString();
+}
+
+std::shared_ptr<arrow::Table> df_to_arrow(const TableInfo& tbl, bool include_index_col)
+{
+    return table_to_arrow(TableInfoData{tbl.get_view(), tbl.get_index_names(), tbl.get_column_names()},
+                          include_index_col);
+}
+
+void df_to_arrow_ipc(const TableInfo& tbl, const std::string& filename, bool include_index_col)
+{
+    table_to_arrow_ipc(TableInfoData{tbl.get_view(), tbl.get_index_names(), tbl.get_column_names()},
+                       filename,
+                       include_index_col);
+}
+
+std::string df_to_arrow_ipc(const TableInfo& tbl, bool include_index_col)
+{
+    return table_to_arrow_ipc(TableInfoData{tbl.get_view(), tbl.get_index_names(), tbl.get_column_names()},
+                              include_index_col);
+}
+
 template <typename T>
 T get_with_default(const py::dict& d, const std::string& key, T default_value)
 {
@@ -259,11 +674,29 @@ void SerializersProxy::write_df_to_file(pybind11::object df,
         file_type = determine_file_type(filename);  // throws if it is unable to determine the type
     }
 
+    auto tbl = CudfHelper::CudfHelper::table_info_data_from_table(df);
+
+    if (file_type == FileTypes::ARROW)
+    {
+        // The Arrow writer opens the file itself, an IPC file is not streamed through an ostream
+        table_to_arrow_ipc(tbl, filename, get_with_default(kwargs, "include_index_col", true));
+        return;
+    }
+
+    if (file_type == FileTypes::PARQUET)
+    {
+        // The parquet sink opens the file itself so device buffers can go device->disk via cuFile on GDS nodes
+        table_to_parquet(tbl,
+                         filename,
+                         get_with_default(kwargs, "include_header", true),
+                         get_with_default(kwargs, "include_index_col", true),
+                         get_with_default(kwargs, "flush", false));
+        return;
+    }
+
     std::ofstream out_file;
     out_file.open(filename);
 
-    auto tbl = CudfHelper::CudfHelper::table_info_data_from_table(df);
-
     switch (file_type)
     {
     case FileTypes::JSON: {
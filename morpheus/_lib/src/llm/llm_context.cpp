@@ -19,7 +19,10 @@
 
 #include "morpheus/utilities/string_util.hpp"
 
+#include <mrc/coroutines/task.hpp>  // IWYU pragma: keep
+
 #include <algorithm>
+#include <coroutine>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
@@ -99,6 +102,17 @@ std::shared_ptr<LLMContext> LLMContext::push(std::string name, input_mappings_t
     return std::make_shared<LLMContext>(this->shared_from_this(), std::move(name), std::move(inputs));
 }
 
+std::shared_ptr<LLMContext> LLMContext::push(std::string name,
+                                             input_mappings_t inputs,
+                                             std::shared_ptr<const compiled_input_plan_t> input_plan)
+{
+    auto context = std::make_shared<LLMContext>(this->shared_from_this(), std::move(name), std::move(inputs));
+
+    context->m_input_plan = std::move(input_plan);
+
+    return context;
+}
+
 void LLMContext::pop()
 {
     // Copy the outputs from the child context to the parent
@@ -114,12 +128,13 @@ void LLMContext::pop()
     }
     else
     {
-        // Build a new json object with only the specified keys
+        // Build a new json object with only the specified keys, moving the subtrees instead of copying them. For
+        // large per-row values (e.g. embedding batches) the copy dominates the handoff between contexts.
         nlohmann::json new_outputs;
 
         for (const auto& output_name : m_output_names)
         {
-            new_outputs[output_name] = m_outputs[output_name];
+            new_outputs[output_name] = std::move(m_outputs[output_name]);
         }
 
         m_parent->set_output(m_name, std::move(new_outputs));
@@ -141,18 +156,33 @@ nlohmann::json::const_reference LLMContext::get_input(const std::string& node_na
 {
     if (node_name[0] == '/')
     {
-        nlohmann::json::json_pointer node_json_ptr(node_name);
-
-        if (!m_outputs.contains(node_json_ptr))
-        {
-            throw std::runtime_error(MORPHEUS_CONCAT_STR("Input '" << node_name << "' not found in the output map"));
-        }
-
         // Get the value from a sibling output
-        return m_outputs[node_json_ptr];
+        return this->output_at(nlohmann::json::json_pointer(node_name));
     }
     else
     {
+        // When a compiled plan is available, resolve the mapping with a binary search and use the pre-parsed json
+        // pointer for sibling inputs, skipping the per-call string parsing below
+        if (m_input_plan)
+        {
+            auto plan_found = std::lower_bound(m_input_plan->begin(),
+                                               m_input_plan->end(),
+                                               node_name,
+                                               [](const CompiledInputMap& entry, const std::string& name) {
+                                                   return entry.internal_name < name;
+                                               });
+
+            if (plan_found != m_input_plan->end() && plan_found->internal_name == node_name)
+            {
+                if (plan_found->is_sibling)
+                {
+                    return m_parent->output_at(plan_found->sibling_pointer);
+                }
+
+                return m_parent->get_input(plan_found->external_name);
+            }
+        }
+
         // Must be on the parent, so find the mapping between this namespace and the parent
         auto found = std::find_if(m_inputs.begin(), m_inputs.end(), [&node_name](const auto& map_iterator) {
             return map_iterator.internal_name == node_name;
@@ -186,6 +216,17 @@ nlohmann::json::const_reference LLMContext::get_input(const std::string& node_na
     }
 }
 
+nlohmann::json::const_reference LLMContext::output_at(const nlohmann::json::json_pointer& pointer) const
+{
+    if (!m_outputs.contains(pointer))
+    {
+        throw std::runtime_error(
+            MORPHEUS_CONCAT_STR("Input '" << pointer.to_string() << "' not found in the output map"));
+    }
+
+    return m_outputs[pointer];
+}
+
 nlohmann::json LLMContext::get_inputs() const
 {
     nlohmann::json inputs = nlohmann::json::object();
@@ -215,6 +256,42 @@ void LLMContext::set_output_names(std::vector<std::string> output_names)
     m_output_names = std::move(output_names);
 }
 
+void LLMContext::set_stream_handler(stream_fn_t handler)
+{
+    if (m_parent)
+    {
+        return m_parent->set_stream_handler(std::move(handler));
+    }
+
+    m_state->stream_handler = std::move(handler);
+}
+
+bool LLMContext::is_streaming() const
+{
+    if (m_parent)
+    {
+        return m_parent->is_streaming();
+    }
+
+    return static_cast<bool>(m_state->stream_handler);
+}
+
+Task<void> LLMContext::stream_output(nlohmann::json chunk)
+{
+    if (m_parent)
+    {
+        co_await m_parent->stream_output(std::move(chunk));
+        co_return;
+    }
+
+    if (m_state->stream_handler)
+    {
+        co_await m_state->stream_handler(std::move(chunk));
+    }
+
+    co_return;
+}
+
 void LLMContext::outputs_complete()
 {
     // m_outputs_promise.set_value();
@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/llm/llm_embedding_node.hpp"
+
+#include "morpheus/llm/llm_context.hpp"
+#include "morpheus/messages/control.hpp"
+#include "morpheus/messages/memory/tensor_memory.hpp"
+#include "morpheus/objects/dev_mem_info.hpp"  // for DevMemInfo
+#include "morpheus/objects/tensor.hpp"
+#include "morpheus/objects/tensor_object.hpp"
+#include "morpheus/utilities/matx_util.hpp"
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+#include "morpheus/utilities/tensor_util.hpp"  // for get_element_stride
+
+#include <nlohmann/json.hpp>
+
+#include <coroutine>
+#include <memory>
+#include <stdexcept>  // for invalid_argument, runtime_error
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace morpheus::llm {
+
+LLMEmbeddingNode::LLMEmbeddingNode(std::string input_tensor_name,
+                                   std::string output_tensor_name,
+                                   TensorIndex pool_size) :
+  m_input_tensor_name(std::move(input_tensor_name)),
+  m_output_tensor_name(std::move(output_tensor_name)),
+  m_pool_size(pool_size)
+{
+    if (m_pool_size < 1)
+    {
+        throw std::invalid_argument("LLMEmbeddingNode: pool_size must be positive");
+    }
+}
+
+std::vector<std::string> LLMEmbeddingNode::get_input_names() const
+{
+    // The token embeddings come from the message's tensor memory, not from sibling node outputs
+    return {};
+}
+
+Task<std::shared_ptr<LLMContext>> LLMEmbeddingNode::execute(std::shared_ptr<LLMContext> context)
+{
+    auto message = context->message();
+
+    if (!message || !message->tensors() || !message->tensors()->has_tensor(m_input_tensor_name))
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR(
+            "LLMEmbeddingNode requires a ControlMessage with a '" << m_input_tensor_name << "' tensor"));
+    }
+
+    const auto& tensor = message->tensors()->get_tensor(m_input_tensor_name);
+
+    const auto& shape = tensor.get_shape();
+
+    if (shape.size() != 2 || shape[0] % m_pool_size != 0)
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Tensor '" << m_input_tensor_name
+                                                                << "' must be 2D with a row count divisible by "
+                                                                << m_pool_size));
+    }
+
+    // Depending on the input the stride is given in bytes or elements, convert to elements
+    auto stride = TensorUtils::get_element_stride(tensor.get_stride());
+
+    auto pooled_buffer = MatxUtil::mean_pool_normalize(
+        DevMemInfo{tensor.data(), tensor.dtype(), tensor.get_memory(), shape, stride}, m_pool_size);
+
+    const ShapeType pooled_shape{shape[0] / m_pool_size, shape[1]};
+
+    // The token-level memory has served its purpose, swap in sequence-level memory holding the embeddings
+    auto pooled_memory = std::make_shared<TensorMemory>(pooled_shape[0]);
+    pooled_memory->set_tensor(m_output_tensor_name, Tensor::create(pooled_buffer, tensor.dtype(), pooled_shape, {}, 0));
+    message->tensors(pooled_memory);
+
+    // The embeddings stay device-resident, the output only describes where to find them
+    context->set_output(nlohmann::json{{"tensor_name", m_output_tensor_name}, {"shape", pooled_shape}});
+
+    co_return context;
+}
+
+}  // namespace morpheus::llm
@@ -20,15 +20,25 @@
 #include "morpheus/llm/llm_task.hpp"
 #include "morpheus/llm/llm_task_handler_runner.hpp"
 #include "morpheus/llm/utils.hpp"
+#include "morpheus/messages/meta.hpp"       // for MessageMeta & SlicedMessageMeta
+#include "morpheus/objects/table_info.hpp"  // for TableInfo
 
+#include <cudf/concatenate.hpp>
+#include <cudf/io/types.hpp>  // for table_with_metadata
+#include <cudf/table/table_view.hpp>
 #include <mrc/coroutines/task.hpp>  // IWYU pragma: keep
+#include <mrc/coroutines/when_all.hpp>
 #include <nlohmann/json.hpp>
 
+#include <algorithm>  // for min
 #include <coroutine>
+#include <cstddef>  // for size_t
+#include <functional>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace morpheus::llm {
 
@@ -46,6 +56,12 @@ void LLMEngine::add_task_handler(user_input_mappings_t inputs, std::shared_ptr<L
 }
 
 Task<std::vector<std::shared_ptr<ControlMessage>>> LLMEngine::run(std::shared_ptr<ControlMessage> input_message)
+{
+    co_return co_await this->run(std::move(input_message), partial_emit_fn_t());
+}
+
+Task<std::vector<std::shared_ptr<ControlMessage>>> LLMEngine::run(std::shared_ptr<ControlMessage> input_message,
+                                                                  partial_emit_fn_t on_partial)
 {
     if (!input_message)
     {
@@ -69,11 +85,32 @@ Task<std::vector<std::shared_ptr<ControlMessage>>> LLMEngine::run(std::shared_pt
         // Set the name, task, control_message and inputs on the context
         auto context = std::make_shared<LLMContext>(tmp_task, input_message);
 
-        // Call the base node
-        co_await this->execute(context);
+        if (on_partial)
+        {
+            // Route chunks streamed by nodes to the task handlers while the engine is still executing
+            context->set_stream_handler([this, context, on_partial](nlohmann::json chunk) {
+                return this->handle_chunk(context, std::move(chunk), on_partial);
+            });
+        }
+
+        std::vector<std::shared_ptr<ControlMessage>> tasks;
 
-        // Pass the outputs into the task generators
-        auto tasks = co_await this->handle_tasks(context);
+        try
+        {
+            // Call the base node
+            co_await this->execute(context);
+
+            // Pass the outputs into the task generators
+            tasks = co_await this->handle_tasks(context);
+        }
+        catch (...)
+        {
+            // The handler holds a reference back to the context, drop it before unwinding
+            context->set_stream_handler(nullptr);
+            throw;
+        }
+
+        context->set_stream_handler(nullptr);
 
         output_messages.insert(output_messages.end(), tasks.begin(), tasks.end());
     }
@@ -81,22 +118,201 @@ Task<std::vector<std::shared_ptr<ControlMessage>>> LLMEngine::run(std::shared_pt
     co_return output_messages;
 }
 
+Task<std::vector<std::shared_ptr<ControlMessage>>> LLMEngine::run_batch(
+    std::vector<std::shared_ptr<ControlMessage>> input_messages)
+{
+    std::vector<std::shared_ptr<ControlMessage>> output_messages;
+
+    // Only messages carrying exactly one 'llm_engine' task and a payload can share an invocation
+    const auto mergeable = [](const std::shared_ptr<ControlMessage>& message) {
+        return message && message->has_task("llm_engine") && message->get_tasks()["llm_engine"].size() == 1 &&
+               message->payload();
+    };
+
+    std::vector<bool> handled(input_messages.size(), false);
+
+    for (std::size_t i = 0; i < input_messages.size(); ++i)
+    {
+        if (handled[i])
+        {
+            continue;
+        }
+
+        handled[i] = true;
+
+        if (!mergeable(input_messages[i]))
+        {
+            auto outputs = co_await this->run(input_messages[i]);
+            output_messages.insert(output_messages.end(), outputs.begin(), outputs.end());
+            continue;
+        }
+
+        // Collect every later message in the window that repeats the same task
+        auto task     = input_messages[i]->get_tasks()["llm_engine"][0];
+        auto task_key = task.dump();
+
+        std::vector<std::size_t> batch{i};
+        for (std::size_t j = i + 1; j < input_messages.size(); ++j)
+        {
+            if (!handled[j] && mergeable(input_messages[j]) &&
+                input_messages[j]->get_tasks()["llm_engine"][0].dump() == task_key)
+            {
+                handled[j] = true;
+                batch.push_back(j);
+            }
+        }
+
+        if (batch.size() == 1)
+        {
+            auto outputs = co_await this->run(input_messages[i]);
+            output_messages.insert(output_messages.end(), outputs.begin(), outputs.end());
+            continue;
+        }
+
+        // Merge the payloads into a single device table, remembering each source's row range for the demux
+        std::vector<TableInfo> infos;
+        std::vector<cudf::table_view> views;
+        std::vector<TensorIndex> offsets;
+        infos.reserve(batch.size());
+        views.reserve(batch.size());
+        offsets.reserve(batch.size());
+
+        TensorIndex total_rows = 0;
+        for (auto idx : batch)
+        {
+            auto info = input_messages[idx]->payload()->get_info();
+
+            offsets.push_back(total_rows);
+            total_rows += info.num_rows();
+
+            views.emplace_back(info.get_view());
+            infos.emplace_back(std::move(info));
+
+            // The merged message carries the shared task, the source keeps only its row range
+            input_messages[idx]->remove_task("llm_engine");
+        }
+
+        cudf::io::table_with_metadata combined;
+
+        const auto& first = infos.front();
+        for (const auto& name : first.get_index_names())
+        {
+            combined.metadata.schema_info.emplace_back(name);
+        }
+        for (const auto& name : first.get_column_names())
+        {
+            combined.metadata.schema_info.emplace_back(name);
+        }
+
+        combined.tbl = cudf::concatenate(views);
+
+        auto merged = std::make_shared<ControlMessage>();
+        merged->add_task("llm_engine", task);
+        merged->payload(MessageMeta::create_from_cpp(std::move(combined), first.num_indices()));
+
+        auto merged_outputs = co_await this->run(merged);
+
+        // Demultiplex row-aligned outputs back out per source message
+        for (auto& output : merged_outputs)
+        {
+            if (output->payload() && output->payload()->count() == total_rows)
+            {
+                for (std::size_t k = 0; k < batch.size(); ++k)
+                {
+                    auto stop = k + 1 < batch.size() ? offsets[k + 1] : total_rows;
+
+                    auto demuxed = std::make_shared<ControlMessage>(*output);
+                    demuxed->payload(std::make_shared<SlicedMessageMeta>(output->payload(), offsets[k], stop));
+
+                    output_messages.emplace_back(std::move(demuxed));
+                }
+            }
+            else
+            {
+                // The handler changed the row count, the output cannot be attributed to one source
+                output_messages.emplace_back(output);
+            }
+        }
+    }
+
+    co_return output_messages;
+}
+
+void LLMEngine::set_max_concurrent_handlers(std::size_t max_concurrent)
+{
+    m_max_concurrent_handlers = max_concurrent;
+}
+
 Task<std::vector<std::shared_ptr<ControlMessage>>> LLMEngine::handle_tasks(std::shared_ptr<LLMContext> context)
 {
-    // Wait for the base node outputs (This will yield if not already available)
-    // auto outputs = context->get_outputs();
+    // Handlers do independent I/O, so await them in concurrent waves rather than one at a time; serial
+    // execution adds the sum instead of the max of the handler latencies to every invocation. Registration
+    // order still decides the winner, a claim in an earlier wave short-circuits the later waves.
+    const auto wave_size = m_max_concurrent_handlers == 0 ? m_task_handlers.size() : m_max_concurrent_handlers;
 
-    for (auto& task_handler : m_task_handlers)
+    for (std::size_t start = 0; start < m_task_handlers.size(); start += wave_size)
     {
-        auto new_tasks = co_await task_handler->try_handle(context);
+        const auto stop = std::min(start + wave_size, m_task_handlers.size());
 
-        if (new_tasks.has_value())
+        if (stop - start == 1)
         {
-            co_return new_tasks.value();
+            auto new_tasks = co_await m_task_handlers[start]->try_handle(context);
+
+            if (new_tasks.has_value())
+            {
+                co_return new_tasks.value();
+            }
+
+            continue;
+        }
+
+        std::vector<Task<LLMTaskHandler::return_t>> tasks;
+        tasks.reserve(stop - start);
+
+        for (std::size_t i = start; i < stop; ++i)
+        {
+            tasks.emplace_back(m_task_handlers[i]->try_handle(context));
+        }
+
+        auto results = co_await mrc::coroutines::when_all(std::move(tasks));
+
+        // First handler in registration order that claimed the message wins, matching the serial behavior.
+        // return_value rethrows an exception captured by the task
+        for (auto& result : results)
+        {
+            auto& new_tasks = result.return_value();
+
+            if (new_tasks.has_value())
+            {
+                co_return new_tasks.value();
+            }
         }
     }
 
     throw std::runtime_error("No task handler was able to handle the input message and responses generated");
 }
 
+Task<void> LLMEngine::handle_chunk(std::shared_ptr<LLMContext> context,
+                                   nlohmann::json chunk,
+                                   partial_emit_fn_t on_partial)
+{
+    for (auto& task_handler : m_task_handlers)
+    {
+        auto partial_messages = co_await task_handler->try_handle_chunk(context, chunk);
+
+        if (partial_messages.has_value())
+        {
+            for (auto& partial_message : partial_messages.value())
+            {
+                co_await on_partial(std::move(partial_message));
+            }
+
+            co_return;
+        }
+    }
+
+    // Unlike handle_tasks an unclaimed chunk is not an error, streaming is opt-in per handler
+    co_return;
+}
+
 }  // namespace morpheus::llm
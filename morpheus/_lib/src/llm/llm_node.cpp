@@ -23,12 +23,16 @@
 #include "morpheus/utilities/string_util.hpp"
 
 #include <mrc/coroutines/task.hpp>  // IWYU pragma: keep
+#include <mrc/coroutines/when_all.hpp>
 
 #include <algorithm>
 #include <coroutine>
+#include <cstddef>  // for size_t
+#include <map>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace morpheus::llm {
 
@@ -123,13 +127,66 @@ size_t LLMNode::node_count() const
 
 Task<std::shared_ptr<LLMContext>> LLMNode::execute(std::shared_ptr<LLMContext> context)
 {
+    // Group the child runners into dependency waves: a runner lands one wave after the deepest sibling it reads
+    // from, so independent subtrees share a wave and run concurrently while dependent nodes still execute after
+    // their upstream outputs are available. Registration order is already topological (add_node rejects inputs
+    // from nodes that do not exist yet), which keeps this a single pass.
+    std::map<std::string, std::size_t> wave_by_name;
+    std::vector<std::vector<std::shared_ptr<LLMNodeRunner>>> waves;
+
     for (auto& runner : m_child_runners)
     {
-        // Run the child node
-        co_await runner->execute(context);
+        std::size_t wave = 0;
+
+        for (const auto& sibling_input : runner->sibling_input_names())
+        {
+            // Sibling inputs look like "/<node>[/<output>]", extract the node name
+            auto slash_pos = sibling_input.find('/', 1);
+
+            auto sibling_name =
+                sibling_input.substr(1, slash_pos != std::string::npos ? slash_pos - 1 : std::string::npos);
+
+            auto sibling_wave = wave_by_name.find(sibling_name);
+            if (sibling_wave != wave_by_name.end())
+            {
+                wave = std::max(wave, sibling_wave->second + 1);
+            }
+        }
+
+        wave_by_name[runner->name()] = wave;
+
+        if (wave >= waves.size())
+        {
+            waves.resize(wave + 1);
+        }
+
+        waves[wave].push_back(runner);
+    }
+
+    for (auto& wave : waves)
+    {
+        if (wave.size() == 1)
+        {
+            // Run the child node
+            co_await wave.front()->execute(context);
+            continue;
+        }
+
+        std::vector<Task<std::shared_ptr<LLMContext>>> tasks;
+        tasks.reserve(wave.size());
 
-        // Wait for the child node outputs (This will yield if not already available)
-        // context->get_outputs();
+        for (auto& runner : wave)
+        {
+            tasks.emplace_back(runner->execute(context));
+        }
+
+        auto results = co_await mrc::coroutines::when_all(std::move(tasks));
+
+        // Surface the first failure, return_value rethrows an exception captured by the task
+        for (auto& result : results)
+        {
+            result.return_value();
+        }
     }
 
     // Before returning, set the output names to only propagate the specified outputs
@@ -25,7 +25,10 @@
 #include <mrc/coroutines/task.hpp>  // IWYU pragma: keep
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <coroutine>
+#include <iterator>  // for next
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -55,6 +58,11 @@ LLMNodeRunner::LLMNodeRunner(std::string name, input_mappings_t inputs, std::sha
     std::set<std::string> input_names_set(input_names.begin(), input_names.end());
     std::set<std::string> specified_input_names_set;
 
+    // Compile the input plan alongside validation so per-message lookups reuse the classification and pre-parsed
+    // json pointers instead of re-resolving names
+    auto input_plan = std::make_shared<std::vector<CompiledInputMap>>();
+    input_plan->reserve(m_inputs.size());
+
     // Check all of the external node inputs to make sure they are valid
     for (auto& inp : m_inputs)
     {
@@ -65,12 +73,19 @@ LLMNodeRunner::LLMNodeRunner(std::string name, input_mappings_t inputs, std::sha
             throw std::runtime_error("Input '" + inp.internal_name + "' is specified more than once");
         }
 
+        auto& plan_entry         = input_plan->emplace_back();
+        plan_entry.internal_name = inp.internal_name;
+        plan_entry.external_name = inp.external_name;
+
         // Determine if the inputs are coming from a parent node or a sibling node
         if (inp.external_name[0] == '/')
         {
             // Break it down into json pointer components
             auto components = nlohmann::json::json_pointer(external_name);
 
+            plan_entry.is_sibling      = true;
+            plan_entry.sibling_pointer = components;
+
             // Loop over each segment to make sure its a valid name
             while (!components.empty())
             {
@@ -115,14 +130,42 @@ LLMNodeRunner::LLMNodeRunner(std::string name, input_mappings_t inputs, std::sha
                                 << ". Missing inputs: "
                                 << StringUtil::array_to_str(missing_names.begin(), missing_names.end()) << "."));
     }
+
+    // Sort by internal name so the context can resolve lookups with a binary search
+    std::sort(input_plan->begin(), input_plan->end(), [](const CompiledInputMap& lhs, const CompiledInputMap& rhs) {
+        return lhs.internal_name < rhs.internal_name;
+    });
+
+    m_input_plan = std::move(input_plan);
 }
 
 LLMNodeRunner::~LLMNodeRunner() = default;
 
 Task<std::shared_ptr<LLMContext>> LLMNodeRunner::execute(std::shared_ptr<LLMContext> context)
 {
-    // Create a new context
-    auto child_context = context->push(m_name, m_inputs);
+    std::string cache_key;
+
+    if (m_cache_enabled)
+    {
+        cache_key = this->resolve_input_key(context).dump();
+
+        auto found = m_result_cache.find(cache_key);
+        if (found != m_result_cache.end())
+        {
+            if (std::chrono::steady_clock::now() < found->second.expires_at)
+            {
+                // Apply the cached outputs exactly as pop would have, skipping the node entirely
+                context->set_output(m_name, found->second.outputs);
+
+                co_return context;
+            }
+
+            m_result_cache.erase(found);
+        }
+    }
+
+    // Create a new context, handing it the plan compiled at construction
+    auto child_context = context->push(m_name, m_inputs, m_input_plan);
 
     // Also need error handling here
     auto returned_context = co_await m_node->execute(child_context);
@@ -130,9 +173,60 @@ Task<std::shared_ptr<LLMContext>> LLMNodeRunner::execute(std::shared_ptr<LLMCont
     // Call pop to apply the outputs to the parent context
     child_context->pop();
 
+    if (m_cache_enabled)
+    {
+        this->cache_store(std::move(cache_key),
+                          context->all_outputs()[nlohmann::json::json_pointer("/" + m_name)]);
+    }
+
     co_return returned_context;
 }
 
+void LLMNodeRunner::enable_cache(std::chrono::seconds ttl, std::size_t max_entries)
+{
+    m_cache_enabled     = true;
+    m_cache_ttl         = ttl;
+    m_cache_max_entries = max_entries;
+}
+
+nlohmann::json LLMNodeRunner::resolve_input_key(const std::shared_ptr<LLMContext>& context) const
+{
+    // Resolve this node's inputs against the parent context, mirroring what the pushed child would see. The
+    // serialized object is the cache key, nlohmann keeps keys sorted so equal input sets serialize identically
+    auto key = nlohmann::json::object();
+
+    for (const auto& inp : m_inputs)
+    {
+        key[inp.internal_name] = context->get_input(inp.external_name);
+    }
+
+    return key;
+}
+
+void LLMNodeRunner::cache_store(std::string key, nlohmann::json outputs)
+{
+    auto now = std::chrono::steady_clock::now();
+
+    // Drop anything that has already expired
+    for (auto it = m_result_cache.begin(); it != m_result_cache.end();)
+    {
+        it = now < it->second.expires_at ? std::next(it) : m_result_cache.erase(it);
+    }
+
+    // Evict the entry closest to expiry to stay within the size bound
+    while (m_result_cache.size() >= m_cache_max_entries && !m_result_cache.empty())
+    {
+        auto victim =
+            std::min_element(m_result_cache.begin(), m_result_cache.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.second.expires_at < rhs.second.expires_at;
+            });
+
+        m_result_cache.erase(victim);
+    }
+
+    m_result_cache[std::move(key)] = CacheEntry{std::move(outputs), now + m_cache_ttl};
+}
+
 const std::string& LLMNodeRunner::name() const
 {
     return m_name;
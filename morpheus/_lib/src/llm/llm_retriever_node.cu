@@ -0,0 +1,257 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/llm/llm_retriever_node.hpp"
+
+#include "morpheus/llm/llm_context.hpp"
+#include "morpheus/types.hpp"  // for TensorIndex
+
+#include <cuda_runtime.h>
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
+#include <nlohmann/json.hpp>
+#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
+#include <rmm/device_buffer.hpp>
+
+#include <cfloat>  // for FLT_MAX
+#include <coroutine>
+#include <cstddef>  // for size_t
+#include <memory>
+#include <stdexcept>  // for invalid_argument
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using morpheus::TensorIndex;
+
+constexpr int RetrieverBlockSize = 256;
+
+// One block per query: each thread scores a strided subset of the index rows against the query embedding
+__global__ void retriever_score_kernel(
+    const float* index, const float* queries, float* scores, TensorIndex num_vectors, TensorIndex dim)
+{
+    const auto* query  = queries + static_cast<std::size_t>(blockIdx.x) * dim;
+    auto* query_scores = scores + static_cast<std::size_t>(blockIdx.x) * num_vectors;
+
+    for (TensorIndex row = threadIdx.x; row < num_vectors; row += blockDim.x)
+    {
+        const auto* vec = index + static_cast<std::size_t>(row) * dim;
+
+        float dot = 0.0F;
+        for (TensorIndex i = 0; i < dim; ++i)
+        {
+            dot += vec[i] * query[i];
+        }
+
+        query_scores[row] = dot;
+    }
+}
+
+// One block per query: extract the arg-max `k` times, masking each winner. O(k * num_vectors), but the scores are
+// already resident in device memory and `k` is small, so selection is a rounding error next to scoring
+__global__ void retriever_select_kernel(
+    float* scores, TensorIndex* out_indices, float* out_scores, TensorIndex num_vectors, TensorIndex k)
+{
+    __shared__ float best_score[RetrieverBlockSize];
+    __shared__ TensorIndex best_index[RetrieverBlockSize];
+
+    auto* query_scores = scores + static_cast<std::size_t>(blockIdx.x) * num_vectors;
+
+    for (TensorIndex pick = 0; pick < k; ++pick)
+    {
+        float local_best        = -FLT_MAX;
+        TensorIndex local_index = -1;
+
+        for (TensorIndex row = threadIdx.x; row < num_vectors; row += blockDim.x)
+        {
+            if (query_scores[row] > local_best)
+            {
+                local_best  = query_scores[row];
+                local_index = row;
+            }
+        }
+
+        best_score[threadIdx.x] = local_best;
+        best_index[threadIdx.x] = local_index;
+        __syncthreads();
+
+        for (unsigned int offset = blockDim.x / 2; offset > 0; offset /= 2)
+        {
+            if (threadIdx.x < offset && best_score[threadIdx.x + offset] > best_score[threadIdx.x])
+            {
+                best_score[threadIdx.x] = best_score[threadIdx.x + offset];
+                best_index[threadIdx.x] = best_index[threadIdx.x + offset];
+            }
+            __syncthreads();
+        }
+
+        if (threadIdx.x == 0)
+        {
+            const auto out   = static_cast<std::size_t>(blockIdx.x) * k + pick;
+            out_indices[out] = best_index[0];
+            out_scores[out]  = best_score[0];
+
+            // Mask the winner so the next pass finds the runner-up
+            query_scores[best_index[0]] = -FLT_MAX;
+        }
+        __syncthreads();
+    }
+}
+
+}  // namespace
+
+namespace morpheus::llm {
+
+LLMRetrieverNode::LLMRetrieverNode(const std::vector<float>& embeddings,
+                                   std::vector<nlohmann::json> documents,
+                                   TensorIndex dim,
+                                   TensorIndex k) :
+  m_documents(std::move(documents)),
+  m_dim(dim),
+  m_k(k)
+{
+    if (m_dim < 1 || m_k < 1)
+    {
+        throw std::invalid_argument("LLMRetrieverNode: dim and k must be positive");
+    }
+
+    if (m_documents.empty() || embeddings.size() != m_documents.size() * static_cast<std::size_t>(m_dim))
+    {
+        throw std::invalid_argument("LLMRetrieverNode: embeddings must hold documents.size() * dim values");
+    }
+
+    if (m_k > static_cast<TensorIndex>(m_documents.size()))
+    {
+        m_k = static_cast<TensorIndex>(m_documents.size());
+    }
+
+    m_index = std::make_unique<rmm::device_buffer>(
+        embeddings.data(), embeddings.size() * sizeof(float), rmm::cuda_stream_per_thread);
+
+    // The caller's embeddings vector is only guaranteed to outlive the constructor
+    rmm::cuda_stream_per_thread.synchronize();
+}
+
+LLMRetrieverNode::~LLMRetrieverNode() = default;
+
+std::vector<std::string> LLMRetrieverNode::get_input_names() const
+{
+    return {"query"};
+}
+
+Task<std::shared_ptr<LLMContext>> LLMRetrieverNode::execute(std::shared_ptr<LLMContext> context)
+{
+    const auto& input = context->get_input();
+
+    // Accept either a single embedding or a batch of embeddings
+    const bool single_query = !input.empty() && input.front().is_number();
+
+    std::vector<float> host_queries;
+    host_queries.reserve(single_query ? m_dim : input.size() * m_dim);
+
+    auto append_query = [this, &host_queries](nlohmann::json::const_reference query) {
+        if (!query.is_array() || static_cast<TensorIndex>(query.size()) != m_dim)
+        {
+            throw std::invalid_argument(
+                "LLMRetrieverNode: query embeddings must be arrays of " + std::to_string(m_dim) + " numbers");
+        }
+
+        for (const auto& value : query)
+        {
+            host_queries.push_back(value.get<float>());
+        }
+    };
+
+    if (single_query)
+    {
+        append_query(input);
+    }
+    else
+    {
+        for (const auto& query : input)
+        {
+            append_query(query);
+        }
+    }
+
+    const auto num_queries = static_cast<TensorIndex>(host_queries.size() / m_dim);
+    const auto num_vectors = static_cast<TensorIndex>(m_documents.size());
+    auto stream            = rmm::cuda_stream_per_thread;
+
+    rmm::device_buffer queries_d(host_queries.data(), host_queries.size() * sizeof(float), stream);
+    rmm::device_buffer scores_d(static_cast<std::size_t>(num_queries) * num_vectors * sizeof(float), stream);
+    rmm::device_buffer out_indices_d(static_cast<std::size_t>(num_queries) * m_k * sizeof(TensorIndex), stream);
+    rmm::device_buffer out_scores_d(static_cast<std::size_t>(num_queries) * m_k * sizeof(float), stream);
+
+    retriever_score_kernel<<<num_queries, RetrieverBlockSize, 0, stream.value()>>>(
+        static_cast<const float*>(m_index->data()),
+        static_cast<const float*>(queries_d.data()),
+        static_cast<float*>(scores_d.data()),
+        num_vectors,
+        m_dim);
+
+    retriever_select_kernel<<<num_queries, RetrieverBlockSize, 0, stream.value()>>>(
+        static_cast<float*>(scores_d.data()),
+        static_cast<TensorIndex*>(out_indices_d.data()),
+        static_cast<float*>(out_scores_d.data()),
+        num_vectors,
+        m_k);
+
+    MRC_CHECK_CUDA(cudaPeekAtLastError());
+
+    std::vector<TensorIndex> indices(static_cast<std::size_t>(num_queries) * m_k);
+    std::vector<float> scores(indices.size());
+
+    MRC_CHECK_CUDA(cudaMemcpyAsync(
+        indices.data(), out_indices_d.data(), indices.size() * sizeof(TensorIndex), cudaMemcpyDeviceToHost, stream));
+    MRC_CHECK_CUDA(cudaMemcpyAsync(
+        scores.data(), out_scores_d.data(), scores.size() * sizeof(float), cudaMemcpyDeviceToHost, stream));
+    MRC_CHECK_CUDA(cudaStreamSynchronize(stream));
+
+    auto documents_out = nlohmann::json::array();
+    auto scores_out    = nlohmann::json::array();
+
+    for (TensorIndex query = 0; query < num_queries; ++query)
+    {
+        auto query_documents = nlohmann::json::array();
+        auto query_scores    = nlohmann::json::array();
+
+        for (TensorIndex pick = 0; pick < m_k; ++pick)
+        {
+            const auto idx = indices[static_cast<std::size_t>(query) * m_k + pick];
+
+            query_documents.push_back(m_documents[idx]);
+            query_scores.push_back(scores[static_cast<std::size_t>(query) * m_k + pick]);
+        }
+
+        documents_out.push_back(std::move(query_documents));
+        scores_out.push_back(std::move(query_scores));
+    }
+
+    if (single_query)
+    {
+        documents_out = std::move(documents_out.front());
+        scores_out    = std::move(scores_out.front());
+    }
+
+    context->set_output(nlohmann::json{{"documents", std::move(documents_out)}, {"scores", std::move(scores_out)}});
+
+    co_return context;
+}
+
+}  // namespace morpheus::llm
@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/llm/llm_task_handler.hpp"
+
+#include <mrc/coroutines/task.hpp>  // IWYU pragma: keep
+
+#include <coroutine>
+#include <optional>
+
+namespace morpheus::llm {
+
+Task<LLMTaskHandler::return_t> LLMTaskHandler::try_handle_chunk(std::shared_ptr<LLMContext> context,
+                                                                const nlohmann::json& chunk)
+{
+    // Handlers opt into streaming by overriding this, declining keeps non-streaming handlers unchanged
+    co_return std::nullopt;
+}
+
+}  // namespace morpheus::llm
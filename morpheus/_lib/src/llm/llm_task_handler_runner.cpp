@@ -65,4 +65,13 @@ Task<LLMTaskHandler::return_t> LLMTaskHandlerRunner::try_handle(std::shared_ptr<
     co_return co_await m_handler->try_handle(child_context);
 }
 
+Task<LLMTaskHandler::return_t> LLMTaskHandlerRunner::try_handle_chunk(std::shared_ptr<LLMContext> context,
+                                                                      const nlohmann::json& chunk)
+{
+    // Create a new context so the handler can resolve any inputs that are already available
+    auto child_context = context->push("TaskHandler", m_inputs);
+
+    co_return co_await m_handler->try_handle_chunk(child_context, chunk);
+}
+
 }  // namespace morpheus::llm
@@ -18,6 +18,7 @@
 #include "morpheus/messages/control.hpp"
 
 #include "morpheus/messages/meta.hpp"
+#include "morpheus/types.hpp"  // for TensorIndex
 
 #include <glog/logging.h>
 #include <pybind11/chrono.h>  // IWYU pragma: keep
@@ -26,14 +27,57 @@
 #include <pymrc/utils.hpp>
 
 #include <chrono>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t & int64_t
+#include <map>      // for map
+#include <memory>   // for make_shared
 #include <optional>
 #include <ostream>
 #include <regex>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace py = pybind11;
 
+namespace {
+
+// Priority assigned to tasks that do not carry a "priority" property, and to the "normal" class
+constexpr std::int64_t DefaultTaskPriority = 100;
+
+// Named priority classes a task may use instead of a bare integer, lower values dequeue first
+const std::map<std::string, std::int64_t> TaskPriorityClasses = {
+    {"realtime", 0}, {"high", 10}, {"normal", DefaultTaskPriority}, {"bulk", 1000}};
+
+std::int64_t task_priority(const nlohmann::json& task)
+{
+    if (!task.contains("priority"))
+    {
+        return DefaultTaskPriority;
+    }
+
+    const auto& priority = task.at("priority");
+    if (priority.is_number_integer())
+    {
+        return priority.get<std::int64_t>();
+    }
+
+    if (priority.is_string())
+    {
+        auto found = TaskPriorityClasses.find(priority.get<std::string>());
+        if (found != TaskPriorityClasses.end())
+        {
+            return found->second;
+        }
+    }
+
+    LOG(WARNING) << "Unknown task priority " << priority.dump() << ", treating as normal";
+
+    return DefaultTaskPriority;
+}
+
+}  // namespace
+
 namespace morpheus {
 
 const std::string ControlMessage::s_config_schema = R"()";
@@ -41,24 +85,63 @@ const std::string ControlMessage::s_config_schema = R"()";
 std::map<std::string, ControlMessageType> ControlMessage::s_task_type_map{{"inference", ControlMessageType::INFERENCE},
                                                                           {"training", ControlMessageType::TRAINING}};
 
-ControlMessage::ControlMessage() : m_config({{"metadata", nlohmann::json::object()}}), m_tasks({}) {}
+ControlMessage::ControlMessage() :
+  m_state(std::make_shared<State>(State{{{"metadata", nlohmann::json::object()}}, nlohmann::json{}}))
+{}
 
-ControlMessage::ControlMessage(const nlohmann::json& _config) :
-  m_config({{"metadata", nlohmann::json::object()}}),
-  m_tasks({})
+ControlMessage::ControlMessage(const nlohmann::json& _config) : ControlMessage()
 {
     config(_config);
 }
 
 ControlMessage::ControlMessage(const ControlMessage& other)
 {
-    m_config = other.m_config;
-    m_tasks  = other.m_tasks;
+    // Share the state block, `mutable_state` clones it if either message mutates later
+    m_state = other.m_state;
+
+    // The task-type classification travels with the shared tasks
+    m_cm_type = other.m_cm_type;
 }
 
 const nlohmann::json& ControlMessage::config() const
 {
-    return m_config;
+    return m_state->config;
+}
+
+const std::vector<std::uint8_t>& ControlMessage::config_cbor() const
+{
+    if (m_state->cbor_cache.empty())
+    {
+        m_state->cbor_cache =
+            nlohmann::json::to_cbor(nlohmann::json{{"config", m_state->config}, {"tasks", m_state->tasks}});
+    }
+
+    return m_state->cbor_cache;
+}
+
+std::shared_ptr<ControlMessage> ControlMessage::from_cbor(const std::vector<std::uint8_t>& cbor)
+{
+    auto decoded = nlohmann::json::from_cbor(cbor);
+
+    auto message             = std::make_shared<ControlMessage>();
+    message->m_state->config = std::move(decoded.at("config"));
+    message->m_state->tasks  = std::move(decoded.at("tasks"));
+
+    return message;
+}
+
+ControlMessage::State& ControlMessage::mutable_state()
+{
+    // Clone the state block only while another message still references it
+    if (m_state.use_count() > 1)
+    {
+        m_state = std::make_shared<State>(State{m_state->config, m_state->tasks});
+    }
+
+    // Any mutation invalidates the cached binary encoding
+    m_state->cbor_cache.clear();
+
+    return *m_state;
 }
 
 void ControlMessage::add_task(const std::string& task_type, const nlohmann::json& task)
@@ -76,24 +159,44 @@ void ControlMessage::add_task(const std::string& task_type, const nlohmann::json
         throw std::runtime_error("Cannot add inference and training tasks to the same control message");
     }
 
-    m_tasks[task_type].push_back(task);
+    auto& task_set = mutable_state().tasks[task_type];
+    if (task_set.is_null())
+    {
+        task_set = nlohmann::json::array();
+    }
+
+    // Keep the queue priority-ordered so `remove_task` always pops the most urgent pending task. Inserting after
+    // equal priorities preserves FIFO order within a class.
+    const auto priority = task_priority(task);
+
+    auto insert_at = task_set.cbegin();
+    while (insert_at != task_set.cend() && task_priority(*insert_at) <= priority)
+    {
+        ++insert_at;
+    }
+
+    task_set.insert(insert_at, task);
 }
 
 bool ControlMessage::has_task(const std::string& task_type) const
 {
-    return m_tasks.contains(task_type) && m_tasks.at(task_type).size() > 0;
+    const auto& tasks = m_state->tasks;
+
+    return tasks.contains(task_type) && tasks.at(task_type).size() > 0;
 }
 
 const nlohmann::json& ControlMessage::get_tasks() const
 {
-    return m_tasks;
+    return m_state->tasks;
 }
 
 std::vector<std::string> ControlMessage::list_metadata() const
 {
     std::vector<std::string> key_list{};
 
-    for (auto it = m_config["metadata"].begin(); it != m_config["metadata"].end(); ++it)
+    const auto& metadata = m_state->config["metadata"];
+
+    for (auto it = metadata.begin(); it != metadata.end(); ++it)
     {
         key_list.push_back(it.key());
     }
@@ -103,22 +206,24 @@ std::vector<std::string> ControlMessage::list_metadata() const
 
 void ControlMessage::set_metadata(const std::string& key, const nlohmann::json& value)
 {
-    if (m_config["metadata"].contains(key))
+    auto& state = mutable_state();
+
+    if (state.config["metadata"].contains(key))
     {
         VLOG(20) << "Overwriting metadata key " << key << " with value " << value;
     }
 
-    m_config["metadata"][key] = value;
+    state.config["metadata"][key] = value;
 }
 
 bool ControlMessage::has_metadata(const std::string& key) const
 {
-    return m_config["metadata"].contains(key);
+    return m_state->config["metadata"].contains(key);
 }
 
 nlohmann::json ControlMessage::get_metadata() const
 {
-    auto metadata = m_config["metadata"];
+    auto metadata = m_state->config["metadata"];
 
     return metadata;
 }
@@ -126,7 +231,7 @@ nlohmann::json ControlMessage::get_metadata() const
 nlohmann::json ControlMessage::get_metadata(const std::string& key, bool fail_on_nonexist) const
 {
     // Assuming m_metadata is a std::map<std::string, nlohmann::json> storing metadata
-    auto metadata = m_config["metadata"];
+    auto metadata = m_state->config["metadata"];
     auto it       = metadata.find(key);
     if (it != metadata.end())
     {
@@ -142,7 +247,7 @@ nlohmann::json ControlMessage::get_metadata(const std::string& key, bool fail_on
 
 nlohmann::json ControlMessage::remove_task(const std::string& task_type)
 {
-    auto& task_set = m_tasks.at(task_type);
+    auto& task_set = mutable_state().tasks.at(task_type);
     auto iter_task = task_set.begin();
 
     if (iter_task != task_set.end())
@@ -156,10 +261,51 @@ nlohmann::json ControlMessage::remove_task(const std::string& task_type)
     throw std::runtime_error("No tasks of type " + task_type + " found");
 }
 
+nlohmann::json ControlMessage::remove_tasks(const std::string& task_type)
+{
+    auto& tasks = mutable_state().tasks;
+
+    auto entry = tasks.find(task_type);
+    if (entry == tasks.end() || entry->empty())
+    {
+        return nlohmann::json::array();
+    }
+
+    // The array is already in dequeue order (see `add_task`), moving it out hands the caller every pending task
+    // without a per-task copy
+    auto task_set = std::move(*entry);
+    *entry        = nlohmann::json::array();
+
+    return task_set;
+}
+
 void ControlMessage::set_timestamp(const std::string& key, time_point_t timestamp_ns)
 {
-    // Insert or update the timestamp in the map
-    m_timestamps[key] = timestamp_ns;
+    // Update an existing entry in place
+    for (std::size_t i = 0; i < m_timestamp_count; ++i)
+    {
+        if (m_timestamps[i].key == key)
+        {
+            m_timestamps[i].value = timestamp_ns;
+            return;
+        }
+    }
+
+    if (m_timestamp_count == TimestampCapacity)
+    {
+        LOG(WARNING) << "Timestamp capacity (" << TimestampCapacity << ") exhausted, dropping stamp for key '" << key
+                     << "'";
+        return;
+    }
+
+    m_timestamps[m_timestamp_count].key   = key;
+    m_timestamps[m_timestamp_count].value = timestamp_ns;
+    ++m_timestamp_count;
+}
+
+void ControlMessage::set_timestamp(const std::string& key)
+{
+    this->set_timestamp(key, std::chrono::system_clock::now());
 }
 
 std::map<std::string, time_point_t> ControlMessage::filter_timestamp(const std::string& regex_filter)
@@ -167,12 +313,12 @@ std::map<std::string, time_point_t> ControlMessage::filter_timestamp(const std::
     std::map<std::string, time_point_t> matching_timestamps;
     std::regex filter(regex_filter);
 
-    for (const auto& [key, timestamp] : m_timestamps)
+    for (std::size_t i = 0; i < m_timestamp_count; ++i)
     {
         // Check if the key matches the regex
-        if (std::regex_search(key, filter))
+        if (std::regex_search(m_timestamps[i].key, filter))
         {
-            matching_timestamps[key] = timestamp;
+            matching_timestamps[m_timestamps[i].key] = m_timestamps[i].value;
         }
     }
 
@@ -181,12 +327,15 @@ std::map<std::string, time_point_t> ControlMessage::filter_timestamp(const std::
 
 std::optional<time_point_t> ControlMessage::get_timestamp(const std::string& key, bool fail_if_nonexist)
 {
-    auto it = m_timestamps.find(key);
-    if (it != m_timestamps.end())
+    for (std::size_t i = 0; i < m_timestamp_count; ++i)
     {
-        return it->second;  // Return the found timestamp
+        if (m_timestamps[i].key == key)
+        {
+            return m_timestamps[i].value;
+        }
     }
-    else if (fail_if_nonexist)
+
+    if (fail_if_nonexist)
     {
         throw std::runtime_error("Timestamp for the specified key does not exist.");
     }
@@ -231,9 +380,49 @@ std::shared_ptr<MessageMeta> ControlMessage::payload()
     return m_payload;
 }
 
-void ControlMessage::payload(const std::shared_ptr<MessageMeta>& payload)
+void ControlMessage::payload(std::shared_ptr<MessageMeta> payload)
+{
+    m_payload = std::move(payload);
+}
+
+std::shared_ptr<MessageMeta> ControlMessage::payload_slice(TensorIndex start,
+                                                           TensorIndex stop,
+                                                           std::vector<std::string> columns)
 {
-    m_payload = payload;
+    if (!m_payload)
+    {
+        throw std::runtime_error("Cannot slice the payload of a control message without one");
+    }
+
+    return std::make_shared<SlicedMessageMeta>(m_payload, start, stop, std::move(columns));
+}
+
+std::shared_ptr<MessageMeta> ControlMessage::task_payload(const nlohmann::json& task)
+{
+    TensorIndex start = 0;
+    TensorIndex stop  = -1;
+    std::vector<std::string> columns;
+
+    if (task.contains("payload_range"))
+    {
+        const auto& range = task.at("payload_range");
+
+        start = range.at(0).get<TensorIndex>();
+        stop  = range.at(1).get<TensorIndex>();
+    }
+
+    if (task.contains("payload_columns"))
+    {
+        columns = task.at("payload_columns").get<std::vector<std::string>>();
+    }
+
+    // Tasks without a scope share the payload itself, not a view of all of it
+    if (start == 0 && stop == -1 && columns.empty())
+    {
+        return m_payload;
+    }
+
+    return this->payload_slice(start, stop, std::move(columns));
 }
 
 std::shared_ptr<TensorMemory> ControlMessage::tensors()
@@ -285,6 +474,13 @@ py::dict ControlMessageProxy::remove_task(ControlMessage& self, const std::strin
     return mrc::pymrc::cast_from_json(task);
 }
 
+py::list ControlMessageProxy::remove_tasks(ControlMessage& self, const std::string& task_type)
+{
+    auto tasks = self.remove_tasks(task_type);
+
+    return mrc::pymrc::cast_from_json(tasks);
+}
+
 py::dict ControlMessageProxy::get_tasks(ControlMessage& self)
 {
     return mrc::pymrc::cast_from_json(self.get_tasks());
@@ -392,4 +588,9 @@ void ControlMessageProxy::payload_from_python_meta(ControlMessage& self, const p
     self.payload(MessageMetaInterfaceProxy::init_python_meta(meta));
 }
 
+std::shared_ptr<MessageMeta> ControlMessageProxy::task_payload(ControlMessage& self, py::dict& task)
+{
+    return self.task_payload(mrc::pymrc::cast_from_pyobject(task));
+}
+
 }  // namespace morpheus
@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/messages/convert.hpp"
+
+#include "morpheus/messages/memory/tensor_memory.hpp"
+#include "morpheus/messages/meta.hpp"
+#include "morpheus/messages/multi_tensor.hpp"
+#include "morpheus/types.hpp"  // for TensorIndex, ShapeType, TensorMap
+
+#include <glog/logging.h>  // for CHECK
+
+#include <memory>     // for make_shared
+#include <stdexcept>  // for runtime_error
+#include <utility>    // for move & pair
+
+namespace {
+
+using namespace morpheus;
+
+// Narrow a tensor memory block to a row range, sharing it outright when the range covers all of it and handing
+// out zero-copy tensor views otherwise
+std::shared_ptr<TensorMemory> slice_tensor_memory(const std::shared_ptr<TensorMemory>& memory,
+                                                  TensorIndex offset,
+                                                  TensorIndex count)
+{
+    if (offset == 0 && count == memory->count)
+    {
+        return memory;
+    }
+
+    TensorMap sliced;
+    for (const auto& [name, tensor] : memory->get_tensors())
+    {
+        ShapeType min_dims(tensor.get_shape().size(), 0);
+        ShapeType max_dims(tensor.get_shape().size(), -1);
+
+        min_dims[0] = offset;
+        max_dims[0] = offset + count;
+
+        sliced.insert(std::pair{name, tensor.slice(min_dims, max_dims)});
+    }
+
+    return std::make_shared<TensorMemory>(count, std::move(sliced));
+}
+
+}  // namespace
+
+namespace morpheus {
+
+std::shared_ptr<ControlMessage> to_control_message(const std::shared_ptr<MultiMessage>& multi)
+{
+    CHECK(multi) << "Cannot convert a null MultiMessage";
+
+    auto control = std::make_shared<ControlMessage>();
+
+    // Share the table outright when the message covers all of it, otherwise hand over a zero-copy view
+    if (multi->mess_offset == 0 && multi->mess_count == multi->meta->count())
+    {
+        control->payload(multi->meta);
+    }
+    else
+    {
+        control->payload(std::make_shared<SlicedMessageMeta>(
+            multi->meta, multi->mess_offset, multi->mess_offset + multi->mess_count));
+    }
+
+    if (auto tensor_message = std::dynamic_pointer_cast<MultiTensorMessage>(multi))
+    {
+        control->tensors(slice_tensor_memory(tensor_message->memory, tensor_message->offset, tensor_message->count));
+    }
+
+    return control;
+}
+
+std::shared_ptr<MultiMessage> to_multi_message(const std::shared_ptr<ControlMessage>& control)
+{
+    CHECK(control) << "Cannot convert a null ControlMessage";
+
+    auto payload = control->payload();
+    if (!payload)
+    {
+        throw std::runtime_error("Cannot convert a ControlMessage without a payload to a MultiMessage");
+    }
+
+    if (auto tensors = control->tensors())
+    {
+        return std::make_shared<MultiTensorMessage>(payload, 0, payload->count(), tensors);
+    }
+
+    return std::make_shared<MultiMessage>(payload);
+}
+
+}  // namespace morpheus
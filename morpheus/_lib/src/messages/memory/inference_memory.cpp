@@ -25,6 +25,7 @@
 #include <pybind11/stl.h>  // IWYU pragma: keep
 
 #include <string>
+#include <string_view>
 #include <utility>  // for move
 
 namespace morpheus {
@@ -33,7 +34,7 @@ namespace morpheus {
 InferenceMemory::InferenceMemory(TensorIndex count) : TensorMemory(count) {}
 InferenceMemory::InferenceMemory(TensorIndex count, TensorMap&& tensors) : TensorMemory(count, std::move(tensors)) {}
 
-bool InferenceMemory::has_input(const std::string& name) const
+bool InferenceMemory::has_input(std::string_view name) const
 {
     return this->has_tensor(name);
 }
@@ -23,6 +23,7 @@
 #include <pybind11/stl.h>  // IWYU pragma: keep
 
 #include <string>
+#include <string_view>
 #include <utility>  // for move
 
 namespace morpheus {
@@ -31,7 +32,7 @@ namespace morpheus {
 ResponseMemory::ResponseMemory(TensorIndex count) : TensorMemory(count) {}
 ResponseMemory::ResponseMemory(TensorIndex count, TensorMap&& tensors) : TensorMemory(count, std::move(tensors)) {}
 
-bool ResponseMemory::has_output(const std::string& name) const
+bool ResponseMemory::has_output(std::string_view name) const
 {
     return this->has_tensor(name);
 }
@@ -21,15 +21,21 @@
 #include "morpheus/utilities/cupy_util.hpp"    // for CupyUtil
 #include "morpheus/utilities/stage_util.hpp"
 #include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+#include "morpheus/utilities/tensor_util.hpp"  // for TensorUtils
 
+#include <glog/logging.h>  // for DCHECK_EQ
 #include <pybind11/cast.h>
+#include <pybind11/gil.h>      // for gil_scoped_release
 #include <pybind11/pytypes.h>  // for attribute_error, key_error
 #include <pybind11/stl.h>      // IWYU pragma: keep
 
+#include <atomic>     // for memory_order_relaxed
 #include <map>
+#include <memory>     // for make_shared, shared_ptr
 #include <sstream>    // needed by MORPHEUS_CONCAT_STR
 #include <stdexcept>  // for std::length_error
 #include <string>
+#include <string_view>
 #include <utility>  // for move, pair
 #include <vector>
 // IWYU pragma: no_include <type_traits>
@@ -43,21 +49,21 @@ TensorMemory::TensorMemory(TensorIndex count, TensorMap&& tensors) : count(count
     check_tensors_length(this->m_tensors);
 }
 
-bool TensorMemory::has_tensor(const std::string& name) const
+bool TensorMemory::has_tensor(std::string_view name) const
 {
     return this->m_tensors.find(name) != this->m_tensors.end();
 }
 
-const TensorObject& TensorMemory::get_tensor(const std::string& name) const
+const TensorObject& TensorMemory::get_tensor(std::string_view name) const
 {
     verify_tensor_exists(name);
-    return m_tensors.at(name);
+    return m_tensors.find(name)->second;
 }
 
-TensorObject& TensorMemory::get_tensor(const std::string& name)
+TensorObject& TensorMemory::get_tensor(std::string_view name)
 {
     verify_tensor_exists(name);
-    return m_tensors[name];
+    return m_tensors.find(name)->second;
 }
 
 void TensorMemory::set_tensor(const std::string& name, TensorObject&& tensor)
@@ -66,6 +72,19 @@ void TensorMemory::set_tensor(const std::string& name, TensorObject&& tensor)
     this->m_tensors[name].swap(std::move(tensor));
 }
 
+TensorObject TensorMemory::checkout_tensor(std::string_view name)
+{
+    DCHECK_EQ(m_writer_count.fetch_add(1, std::memory_order_relaxed), 0)
+        << "Tensor '" << name << "' checked out for in-place mutation while another writer holds this memory";
+
+    return this->get_tensor(name);
+}
+
+void TensorMemory::return_tensor(TensorObject&& tensor)
+{
+    m_writer_count.fetch_sub(1, std::memory_order_relaxed);
+}
+
 const TensorMap& TensorMemory::get_tensors() const
 {
     return m_tensors;
@@ -88,6 +107,17 @@ TensorMap TensorMemory::copy_tensor_ranges(const std::vector<RangeType>& ranges,
     return tensors;
 }
 
+std::shared_ptr<TensorMemory> TensorMemory::copy_to_device(int device_id) const
+{
+    TensorMap tensors;
+    for (const auto& p : this->m_tensors)
+    {
+        tensors.insert(std::pair{p.first, TensorUtils::copy_to_device(p.second, device_id)});
+    }
+
+    return std::make_shared<TensorMemory>(this->count, std::move(tensors));
+}
+
 void TensorMemory::check_tensor_length(const TensorObject& tensor)
 {
     if (tensor.shape(0) != this->count)
@@ -106,7 +136,7 @@ void TensorMemory::check_tensors_length(const TensorMap& tensors)
     }
 }
 
-void TensorMemory::verify_tensor_exists(const std::string& name) const
+void TensorMemory::verify_tensor_exists(std::string_view name) const
 {
     if (!has_tensor(name))
     {
@@ -186,4 +216,12 @@ void TensorMemoryInterfaceProxy::set_tensor(TensorMemory& self,
     self.set_tensor(name, CupyUtil::cupy_to_tensor(cupy_tensor));
 }
 
+std::shared_ptr<TensorMemory> TensorMemoryInterfaceProxy::copy_to_device(TensorMemory& self, int device_id)
+{
+    // The copies run entirely on the device, no python object is involved
+    pybind11::gil_scoped_release no_gil;
+
+    return self.copy_to_device(device_id);
+}
+
 }  // namespace morpheus
@@ -18,12 +18,24 @@
 #include "morpheus/messages/meta.hpp"
 
 #include "morpheus/io/deserializers.hpp"
+#include "morpheus/objects/arrow_data_table.hpp"  // for ArrowDataTable
+#include "morpheus/objects/cpp_data_table.hpp"    // for CppDataTable
 #include "morpheus/objects/mutable_table_ctx_mgr.hpp"
+#include "morpheus/objects/dtype.hpp"  // for DType & TypeId
 #include "morpheus/objects/python_data_table.hpp"
 #include "morpheus/objects/table_info.hpp"
+#include "morpheus/objects/tensor.hpp"  // for Tensor::create
 #include "morpheus/utilities/cudf_util.hpp"
-
+#include "morpheus/utilities/cupy_util.hpp"  // for CupyUtil
+
+#include <arrow/buffer.h>      // for Buffer
+#include <arrow/io/memory.h>   // for BufferReader
+#include <arrow/ipc/reader.h>  // for RecordBatchStreamReader
+#include <arrow/table.h>       // for Table
+#include <cudf/contiguous_split.hpp>  // for pack & unpack
+#include <cudf/interop.hpp>           // for from_arrow
 #include <cudf/io/types.hpp>
+#include <cudf/table/table.hpp>  // for table
 #include <glog/logging.h>
 #include <pybind11/gil.h>
 #include <pybind11/pybind11.h>
@@ -31,11 +43,13 @@
 #include <pyerrors.h>  // for PyExc_DeprecationWarning
 #include <warnings.h>  // for PyErr_WarnEx
 
+#include <algorithm>  // for find
 #include <memory>
 #include <optional>
 #include <ostream>    // for operator<< needed by glog
 #include <stdexcept>  // for runtime_error
 #include <utility>
+#include <vector>
 // We're already including pybind11.h and don't need to include cast.
 // For some reason IWYU also thinks we need array for the `isinsance` call.
 // IWYU pragma: no_include <pybind11/cast.h>
@@ -58,6 +72,11 @@ TableInfo MessageMeta::get_info() const
     return this->m_data->get_info();
 }
 
+TableInfo MessageMeta::get_info(const std::vector<std::string>& column_names) const
+{
+    return this->m_data->get_info(column_names);
+}
+
 MutableTableInfo MessageMeta::get_mutable_info() const
 {
     return this->m_data->get_mutable_info();
@@ -78,10 +97,49 @@ std::shared_ptr<MessageMeta> MessageMeta::create_from_python(py::object&& data_t
 std::shared_ptr<MessageMeta> MessageMeta::create_from_cpp(cudf::io::table_with_metadata&& data_table,
                                                           int index_col_count)
 {
-    // Convert to py first
-    py::object py_dt = cpp_to_py(std::move(data_table), index_col_count);
+    // Keep the table on the C++ side, it will only be converted to a python DataFrame if a python stage asks for it
+    auto data = std::make_unique<CppDataTable>(std::move(data_table), index_col_count);
+
+    return std::shared_ptr<MessageMeta>(new MessageMeta(std::move(data)));
+}
+
+std::shared_ptr<MessageMeta> MessageMeta::create_from_arrow_ipc(const uint8_t* data, std::size_t size_bytes)
+{
+    // Wrap the caller's buffer without copying, the decoded record batches view straight into it
+    auto buffer = std::make_shared<arrow::Buffer>(data, static_cast<int64_t>(size_bytes));
+    auto reader = arrow::ipc::RecordBatchStreamReader::Open(std::make_shared<arrow::io::BufferReader>(buffer));
+
+    if (!reader.ok())
+    {
+        throw std::runtime_error("Failed to open Arrow IPC stream: " + reader.status().ToString());
+    }
+
+    auto arrow_table = reader.ValueUnsafe()->ToTable();
+
+    if (!arrow_table.ok())
+    {
+        throw std::runtime_error("Failed to read Arrow IPC record batches: " + arrow_table.status().ToString());
+    }
+
+    const auto& fields = arrow_table.ValueUnsafe()->schema()->fields();
+
+    auto metadata = cudf::io::table_metadata{};
+    metadata.schema_info.reserve(fields.size());
+
+    for (const auto& field : fields)
+    {
+        metadata.schema_info.emplace_back(field->name());
+    }
 
-    auto data = std::make_unique<PyDataTable>(std::move(py_dt));
+    // Single host-to-device transfer into a cudf table
+    auto table = cudf::from_arrow(*arrow_table.ValueUnsafe());
+
+    return create_from_cpp({std::move(table), std::move(metadata)}, 0);
+}
+
+std::shared_ptr<MessageMeta> MessageMeta::create_from_arrow(std::shared_ptr<arrow::Table> data_table)
+{
+    auto data = std::make_shared<ArrowDataTable>(std::move(data_table));
 
     return std::shared_ptr<MessageMeta>(new MessageMeta(std::move(data)));
 }
@@ -128,6 +186,100 @@ std::optional<std::string> MessageMeta::ensure_sliceable_index()
     return std::nullopt;
 }
 
+void MessageMeta::dictionary_encode(const std::vector<std::string>& columns)
+{
+    auto table = this->get_mutable_info();
+
+    pybind11::gil_scoped_acquire gil;
+
+    auto df = table.checkout_obj();
+
+    for (const auto& column : columns)
+    {
+        auto series = df[pybind11::str(column)];
+
+        // cudf categoricals are already dictionary-encoded on device, re-encoding one is a wasted pass
+        if (pybind11::str(series.attr("dtype")).cast<std::string>() == "category")
+        {
+            continue;
+        }
+
+        df[pybind11::str(column)] = series.attr("astype")("category");
+    }
+
+    table.return_obj(std::move(df));
+}
+
+void MessageMeta::dictionary_decode(const std::vector<std::string>& columns)
+{
+    auto table = this->get_mutable_info();
+
+    pybind11::gil_scoped_acquire gil;
+
+    auto df = table.checkout_obj();
+
+    auto requested = columns;
+    if (requested.empty())
+    {
+        for (const auto& name : df.attr("columns"))
+        {
+            requested.push_back(pybind11::str(name).cast<std::string>());
+        }
+    }
+
+    for (const auto& column : requested)
+    {
+        auto series = df[pybind11::str(column)];
+
+        if (pybind11::str(series.attr("dtype")).cast<std::string>() != "category")
+        {
+            continue;
+        }
+
+        // The keyset preserves the pre-encoding dtype, so casting to it restores the original column
+        df[pybind11::str(column)] = series.attr("astype")(series.attr("cat").attr("categories").attr("dtype"));
+    }
+
+    table.return_obj(std::move(df));
+}
+
+PackedMessageMeta MessageMeta::pack() const
+{
+    const auto table_info = this->get_info();
+
+    auto packed = cudf::pack(table_info.get_view());
+
+    PackedMessageMeta result;
+    result.metadata        = std::move(packed.metadata);
+    result.gpu_data        = std::move(packed.gpu_data);
+    result.index_col_count = static_cast<int>(table_info.get_index_names().size());
+    result.column_names    = table_info.get_index_names();
+
+    const auto column_names = table_info.get_column_names();
+    result.column_names.insert(result.column_names.end(), column_names.begin(), column_names.end());
+
+    return result;
+}
+
+std::shared_ptr<MessageMeta> MessageMeta::create_from_packed(const uint8_t* metadata,
+                                                             const uint8_t* gpu_data,
+                                                             int index_col_count,
+                                                             const std::vector<std::string>& column_names)
+{
+    // The unpacked views alias the transport buffer, copy the columns into a table which owns its memory
+    auto table = std::make_unique<cudf::table>(cudf::unpack(metadata, gpu_data));
+
+    auto table_metadata = cudf::io::table_metadata{};
+    table_metadata.schema_info.reserve(column_names.size());
+
+    for (const auto& name : column_names)
+    {
+        table_metadata.schema_info.emplace_back(name);
+    }
+
+    return MessageMeta::create_from_cpp({std::move(table), std::move(table_metadata)}, index_col_count);
+}
+
 /********** MessageMetaInterfaceProxy **********/
 std::shared_ptr<MessageMeta> MessageMetaInterfaceProxy::init_python(py::object&& data_frame)
 {
@@ -228,6 +380,23 @@ std::shared_ptr<MessageMeta> MessageMetaInterfaceProxy::init_cpp(const std::stri
     return MessageMeta::create_from_cpp(std::move(df_with_meta), index_col_count);
 }
 
+std::shared_ptr<MessageMeta> MessageMetaInterfaceProxy::init_from_arrow_ipc(py::bytes data)
+{
+    char* data_ptr{nullptr};
+    py::ssize_t size_bytes{0};
+
+    if (PYBIND11_BYTES_AS_STRING_AND_SIZE(data.ptr(), &data_ptr, &size_bytes) != 0)
+    {
+        throw py::error_already_set();
+    }
+
+    // `data` remains alive on this stack frame for the duration of the call, release the GIL for the device copy
+    py::gil_scoped_release no_gil;
+
+    return MessageMeta::create_from_arrow_ipc(reinterpret_cast<const uint8_t*>(data_ptr),
+                                              static_cast<std::size_t>(size_bytes));
+}
+
 bool MessageMetaInterfaceProxy::has_sliceable_index(MessageMeta& self)
 {
     // Release the GIL
@@ -242,6 +411,64 @@ std::optional<std::string> MessageMetaInterfaceProxy::ensure_sliceable_index(Mes
     return self.ensure_sliceable_index();
 }
 
+void MessageMetaInterfaceProxy::dictionary_encode(MessageMeta& self, const std::vector<std::string>& columns)
+{
+    // Release the GIL, it is reacquired once the mutable table has been checked out
+    py::gil_scoped_release no_gil;
+    self.dictionary_encode(columns);
+}
+
+void MessageMetaInterfaceProxy::dictionary_decode(MessageMeta& self, const std::vector<std::string>& columns)
+{
+    // Release the GIL, it is reacquired once the mutable table has been checked out
+    py::gil_scoped_release no_gil;
+    self.dictionary_decode(columns);
+}
+
+py::tuple MessageMetaInterfaceProxy::pack(MessageMeta& self)
+{
+    PackedMessageMeta packed;
+    {
+        // Release the GIL for the device pass
+        py::gil_scoped_release no_gil;
+        packed = self.pack();
+    }
+
+    auto metadata = py::bytes(reinterpret_cast<const char*>(packed.metadata->data()), packed.metadata->size());
+
+    py::list names;
+    for (const auto& name : packed.column_names)
+    {
+        names.append(name);
+    }
+
+    // Hand the contiguous buffer to python as a flat uint8 CuPy array, ready for a device-aware transport
+    const auto num_bytes = static_cast<TensorIndex>(packed.gpu_data->size());
+    auto tensor          = Tensor::create(std::move(packed.gpu_data), DType(TypeId::UINT8), {num_bytes}, {});
+
+    return py::make_tuple(
+        std::move(metadata), CupyUtil::tensor_to_cupy(tensor), packed.index_col_count, std::move(names));
+}
+
+std::shared_ptr<MessageMeta> MessageMetaInterfaceProxy::unpack(py::bytes metadata,
+                                                               py::object gpu_data,
+                                                               int index_col_count,
+                                                               const std::vector<std::string>& column_names)
+{
+    // The descriptor blob is small, copy it so the GIL can be dropped for the device work
+    const auto metadata_str = metadata.cast<std::string>();
+
+    auto tensor = CupyUtil::cupy_to_tensor(std::move(gpu_data));
+
+    // `tensor` keeps the transport buffer alive while the columns are copied out
+    py::gil_scoped_release no_gil;
+
+    return MessageMeta::create_from_packed(reinterpret_cast<const uint8_t*>(metadata_str.data()),
+                                           static_cast<const uint8_t*>(tensor.data()),
+                                           index_col_count,
+                                           column_names);
+}
+
 SlicedMessageMeta::SlicedMessageMeta(std::shared_ptr<MessageMeta> other,
                                      TensorIndex start,
                                      TensorIndex stop,
@@ -262,6 +489,24 @@ TableInfo SlicedMessageMeta::get_info() const
     return this->m_data->get_info().get_slice(m_start, m_stop, m_column_names);
 }
 
+TableInfo SlicedMessageMeta::get_info(const std::vector<std::string>& column_names) const
+{
+    // Columns hidden by this view's own filter must stay hidden
+    if (!m_column_names.empty())
+    {
+        for (const auto& name : column_names)
+        {
+            if (std::find(m_column_names.begin(), m_column_names.end(), name) == m_column_names.end())
+            {
+                throw pybind11::key_error("Unknown column: " + name);
+            }
+        }
+    }
+
+    // Select the requested columns from the full table, then apply the row bounds
+    return this->m_data->get_info(column_names).get_slice(m_start, m_stop);
+}
+
 MutableTableInfo SlicedMessageMeta::get_mutable_info() const
 {
     return this->m_data->get_mutable_info().get_slice(m_start, m_stop, m_column_names);
@@ -18,31 +18,29 @@
 #include "morpheus/messages/multi.hpp"
 
 #include "morpheus/messages/meta.hpp"
-#include "morpheus/objects/dtype.hpp"  // for TypeId, DType
 #include "morpheus/objects/table_info.hpp"
 #include "morpheus/objects/tensor_object.hpp"
 #include "morpheus/utilities/cudf_util.hpp"
+#include "morpheus/utilities/tensor_util.hpp"  // for TensorUtils::copy_to_column
 
-#include <cuda_runtime.h>               // for cudaMemcpy, cudaMemcpy2D, cudaMemcpyDeviceToDevice
-#include <cudf/column/column_view.hpp>  // for column_view
-#include <cudf/concatenate.hpp>
+#include <cuda_runtime.h>          // for cudaMemcpy, cudaMemcpyHostToDevice
+#include <cudf/column/column.hpp>  // for column
 #include <cudf/copying.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
-#include <glog/logging.h>       // for CHECK
 #include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
 #include <pybind11/cast.h>
 #include <pybind11/gil.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/pytypes.h>
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>  // for device_buffer
 #include <rmm/mr/device/per_device_resource.hpp>  // for get_current_device_resource
 
 #include <algorithm>  // for transform
 #include <array>      // needed for pybind11::make_tuple
 #include <cstddef>    // for size_t
-#include <cstdint>    // for uint8_t
 #include <sstream>
 #include <stdexcept>  // for runtime_error
 #include <tuple>
@@ -104,14 +102,29 @@ TableInfo MultiMessage::get_meta(const std::string& col_name)
 }
 
 TableInfo MultiMessage::get_meta(const std::vector<std::string>& column_names)
+{
+    if (column_names.empty())
+    {
+        return this->meta->get_info().get_slice(this->mess_offset, this->mess_offset + this->mess_count);
+    }
+
+    // Narrow to the requested columns before slicing so views are only constructed for those columns
+    TableInfo info = this->meta->get_info(column_names);
+
+    return info.get_slice(this->mess_offset, this->mess_offset + this->mess_count);
+}
+
+TableInfo MultiMessage::get_meta(ColumnHandle& handle)
 {
     TableInfo info = this->meta->get_info();
 
-    TableInfo sliced_info = info.get_slice(this->mess_offset,
-                                           this->mess_offset + this->mess_count,
-                                           column_names.empty() ? info.get_column_names() : column_names);
+    // Only pay for the name lookup when the schema has changed since the handle was resolved
+    if (!info.is_current(handle))
+    {
+        handle = info.resolve_column_handle(handle.name);
+    }
 
-    return sliced_info;
+    return info.get_column_slice(handle, this->mess_offset, this->mess_offset + this->mess_count);
 }
 
 void MultiMessage::get_slice_impl(std::shared_ptr<MultiMessage> new_message, TensorIndex start, TensorIndex stop) const
@@ -143,16 +156,26 @@ void MultiMessage::copy_ranges_impl(std::shared_ptr<MultiMessage> new_message,
 
 std::shared_ptr<MessageMeta> MultiMessage::copy_meta_ranges(const std::vector<RangeType>& ranges) const
 {
-    // copy ranges into a sequntial list of values
-    // https://github.com/rapidsai/cudf/issues/11223
-    std::vector<TensorIndex> cudf_ranges;
+    // Expand the ranges into a single gather map so the whole selection is one cudf::gather, instead of a
+    // slice + concatenate per range which costs a kernel launch (and a temporary) for every range
+    std::vector<TensorIndex> row_indices;
     for (const auto& p : ranges)
     {
-        // Append the message offset to the range here
-        cudf_ranges.push_back(p.first + this->mess_offset);
-        cudf_ranges.push_back(p.second + this->mess_offset);
+        for (TensorIndex row = p.first + this->mess_offset; row < p.second + this->mess_offset; ++row)
+        {
+            row_indices.push_back(row);
+        }
     }
 
+    rmm::device_buffer map_data{row_indices.size() * sizeof(TensorIndex), rmm::cuda_stream_per_thread};
+    MRC_CHECK_CUDA(cudaMemcpy(map_data.data(), row_indices.data(), map_data.size(), cudaMemcpyHostToDevice));
+
+    cudf::column gather_map{cudf::data_type{cudf::type_id::INT32},
+                            static_cast<cudf::size_type>(row_indices.size()),
+                            std::move(map_data),
+                            rmm::device_buffer{},
+                            0};
+
     auto table_info   = this->meta->get_info();
     auto column_names = table_info.get_column_names();
     auto metadata     = cudf::io::table_metadata{};
@@ -166,8 +189,7 @@ std::shared_ptr<MessageMeta> MultiMessage::copy_meta_ranges(const std::vector<Ra
     }
 
     auto table_view                     = table_info.get_view();
-    auto sliced_views                   = cudf::slice(table_view, cudf_ranges);
-    cudf::io::table_with_metadata table = {cudf::concatenate(sliced_views), std::move(metadata)};
+    cudf::io::table_with_metadata table = {cudf::gather(table_view, gather_map.view()), std::move(metadata)};
 
     return MessageMeta::create_from_cpp(std::move(table), 1);
 }
@@ -177,6 +199,13 @@ void MultiMessage::set_meta(const std::string& col_name, TensorObject tensor)
     set_meta(std::vector<std::string>{col_name}, std::vector<TensorObject>{tensor});
 }
 
+void MultiMessage::set_meta(ColumnHandle& handle, TensorObject tensor)
+{
+    auto table_meta = this->get_meta(handle);
+
+    TensorUtils::copy_to_column(table_meta.get_column(0), tensor);
+}
+
 void MultiMessage::set_meta(const std::vector<std::string>& column_names, const std::vector<TensorObject>& tensors)
 {
     TableInfo table_meta;
@@ -194,36 +223,7 @@ void MultiMessage::set_meta(const std::vector<std::string>& column_names, const
 
     for (std::size_t i = 0; i < tensors.size(); ++i)
     {
-        const auto& cv            = table_meta.get_column(i);
-        const auto table_type_id  = cv.type().id();
-        const auto tensor_type    = DType(tensors[i].dtype());
-        const auto tensor_type_id = tensor_type.cudf_type_id();
-        const auto row_stride     = tensors[i].stride(0);
-
-        CHECK(tensors[i].count() == cv.size() &&
-              (table_type_id == tensor_type_id ||
-               (table_type_id == cudf::type_id::BOOL8 && tensor_type_id == cudf::type_id::UINT8)));
-
-        const auto item_size = tensors[i].dtype().item_size();
-
-        // Dont use cv.data<>() here since that does not account for the size of each element
-        auto data_start = const_cast<uint8_t*>(cv.head<uint8_t>()) + cv.offset() * item_size;
-
-        if (row_stride == 1)
-        {
-            // column major just use cudaMemcpy
-            MRC_CHECK_CUDA(cudaMemcpy(data_start, tensors[i].data(), tensors[i].bytes(), cudaMemcpyDeviceToDevice));
-        }
-        else
-        {
-            MRC_CHECK_CUDA(cudaMemcpy2D(data_start,
-                                        item_size,
-                                        tensors[i].data(),
-                                        row_stride * item_size,
-                                        item_size,
-                                        cv.size(),
-                                        cudaMemcpyDeviceToDevice));
-        }
+        TensorUtils::copy_to_column(table_meta.get_column(i), tensors[i]);
     }
 }
 
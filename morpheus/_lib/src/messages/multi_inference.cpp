@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 
 namespace morpheus {
@@ -34,20 +35,20 @@ MultiInferenceMessage::MultiInferenceMessage(std::shared_ptr<MessageMeta> meta,
                                              TensorIndex offset,
                                              TensorIndex count,
                                              std::string id_tensor_name) :
-  DerivedMultiMessage(meta, mess_offset, mess_count, memory, offset, count, std::move(id_tensor_name))
+  DerivedMultiMessage(std::move(meta), mess_offset, mess_count, std::move(memory), offset, count, std::move(id_tensor_name))
 {}
 
-const TensorObject MultiInferenceMessage::get_input(const std::string& name) const
+const TensorObject MultiInferenceMessage::get_input(std::string_view name) const
 {
     return get_tensor(name);
 }
 
-TensorObject MultiInferenceMessage::get_input(const std::string& name)
+TensorObject MultiInferenceMessage::get_input(std::string_view name)
 {
     return get_tensor(name);
 }
 
-void MultiInferenceMessage::set_input(const std::string& name, const TensorObject& value)
+void MultiInferenceMessage::set_input(std::string_view name, const TensorObject& value)
 {
     set_tensor(name, value);
 }
@@ -35,7 +35,7 @@ MultiInferenceNLPMessage::MultiInferenceNLPMessage(std::shared_ptr<MessageMeta>
                                                    TensorIndex offset,
                                                    TensorIndex count,
                                                    std::string id_tensor_name) :
-  DerivedMultiMessage(meta, mess_offset, mess_count, memory, offset, count, std::move(id_tensor_name))
+  DerivedMultiMessage(std::move(meta), mess_offset, mess_count, std::move(memory), offset, count, std::move(id_tensor_name))
 {}
 
 const TensorObject MultiInferenceNLPMessage::get_input_ids() const
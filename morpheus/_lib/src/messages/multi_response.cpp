@@ -27,6 +27,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 
 namespace morpheus {
@@ -39,21 +40,21 @@ MultiResponseMessage::MultiResponseMessage(std::shared_ptr<MessageMeta> meta,
                                            TensorIndex count,
                                            std::string id_tensor_name,
                                            std::string probs_tensor_name) :
-  DerivedMultiMessage(meta, mess_offset, mess_count, memory, offset, count, std::move(id_tensor_name)),
+  DerivedMultiMessage(std::move(meta), mess_offset, mess_count, std::move(memory), offset, count, std::move(id_tensor_name)),
   probs_tensor_name(std::move(probs_tensor_name))
 {}
 
-const TensorObject MultiResponseMessage::get_output(const std::string& name) const
+const TensorObject MultiResponseMessage::get_output(std::string_view name) const
 {
     return get_tensor(name);
 }
 
-TensorObject MultiResponseMessage::get_output(const std::string& name)
+TensorObject MultiResponseMessage::get_output(std::string_view name)
 {
     return get_tensor(name);
 }
 
-void MultiResponseMessage::set_output(const std::string& name, const TensorObject& value)
+void MultiResponseMessage::set_output(std::string_view name, const TensorObject& value)
 {
     set_tensor(name, value);
 }
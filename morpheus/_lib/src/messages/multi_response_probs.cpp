@@ -35,8 +35,14 @@ MultiResponseProbsMessage::MultiResponseProbsMessage(std::shared_ptr<MessageMeta
                                                      TensorIndex count,
                                                      std::string id_tensor_name,
                                                      std::string probs_tensor_name) :
-  DerivedMultiMessage(
-      meta, mess_offset, mess_count, memory, offset, count, std::move(id_tensor_name), std::move(probs_tensor_name))
+  DerivedMultiMessage(std::move(meta),
+                      mess_offset,
+                      mess_count,
+                      std::move(memory),
+                      offset,
+                      count,
+                      std::move(id_tensor_name),
+                      std::move(probs_tensor_name))
 {}
 
 const TensorObject MultiResponseProbsMessage::get_probs() const
@@ -28,8 +28,9 @@
 
 #include <cstdint>
 #include <sstream>
-#include <stdexcept>  // for runtime_error
-#include <utility>    // for move
+#include <stdexcept>   // for runtime_error
+#include <string_view>
+#include <utility>     // for move
 
 namespace {
 // MatX works best with C-Style arrays so ignore this warning
@@ -73,7 +74,7 @@ MultiTensorMessage::MultiTensorMessage(std::shared_ptr<MessageMeta> meta,
                                        TensorIndex offset,
                                        TensorIndex count,
                                        std::string id_tensor_name) :
-  DerivedMultiMessage(meta, mess_offset, mess_count),
+  DerivedMultiMessage(std::move(meta), mess_offset, mess_count),
   memory(std::move(memory)),
   offset(offset),
   id_tensor_name(std::move(id_tensor_name))
@@ -130,17 +131,17 @@ MultiTensorMessage::MultiTensorMessage(std::shared_ptr<MessageMeta> meta,
     }
 }
 
-const TensorObject MultiTensorMessage::get_tensor(const std::string& name) const
+const TensorObject MultiTensorMessage::get_tensor(std::string_view name) const
 {
     return get_tensor_impl(name);
 }
 
-TensorObject MultiTensorMessage::get_tensor(const std::string& name)
+TensorObject MultiTensorMessage::get_tensor(std::string_view name)
 {
     return get_tensor_impl(name);
 }
 
-TensorObject MultiTensorMessage::get_tensor_impl(const std::string& name) const
+TensorObject MultiTensorMessage::get_tensor_impl(std::string_view name) const
 {
     auto& tensor = this->memory->get_tensor(name);
 
@@ -153,7 +154,7 @@ TensorObject MultiTensorMessage::get_tensor_impl(const std::string& name) const
     return tensor.slice({this->offset, 0}, {this->offset + this->count, -1});
 }
 
-void MultiTensorMessage::set_tensor(const std::string& name, const TensorObject& value)
+void MultiTensorMessage::set_tensor(std::string_view name, const TensorObject& value)
 {
     // Get the input slice first
     auto slice = this->get_tensor(name);
@@ -162,6 +163,25 @@ void MultiTensorMessage::set_tensor(const std::string& name, const TensorObject&
     slice = value;
 }
 
+TensorObject MultiTensorMessage::checkout_tensor(std::string_view name)
+{
+    // Claims the writer count on the shared memory object before handing out the same sliced view `get_tensor`
+    // returns
+    auto tensor = this->memory->checkout_tensor(name);
+
+    if (this->offset == 0 && this->count == this->memory->count)
+    {
+        return tensor;
+    }
+
+    return tensor.slice({this->offset, 0}, {this->offset + this->count, -1});
+}
+
+void MultiTensorMessage::return_tensor(TensorObject&& tensor)
+{
+    this->memory->return_tensor(std::move(tensor));
+}
+
 TensorObject MultiTensorMessage::get_id_tensor() const
 {
     try
@@ -0,0 +1,204 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/modules/hash_partition_module.hpp"
+
+#include "morpheus/objects/table_info.hpp"
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <boost/fiber/channel_op_status.hpp>
+#include <cudf/copying.hpp>  // for slice
+#include <cudf/io/types.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <glog/logging.h>
+#include <mrc/modules/segment_modules.hpp>
+#include <mrc/segment/builder.hpp>
+#include <mrc/utils/type_utils.hpp>
+#include <rxcpp/rx.hpp>
+
+#include <algorithm>  // for find
+#include <cstddef>    // for size_t
+#include <exception>  // for exception_ptr
+#include <memory>
+#include <sstream>  // IWYU pragma: keep for MORPHEUS_CONCAT_STR
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace mrc::modules;
+using nlohmann::json;
+
+namespace morpheus {
+
+const std::string HashPartitionModule::s_config_schema = R"()";
+
+HashPartitionModule::HashPartitionModule(std::string module_name) : SegmentModule(module_name) {}
+
+HashPartitionModule::HashPartitionModule(std::string module_name, nlohmann::json _config) :
+  SegmentModule(std::move(module_name), std::move(_config))
+{
+    if (!config().contains("key_columns") || !config()["key_columns"].is_array() || config()["key_columns"].empty())
+    {
+        throw std::runtime_error("HashPartitionModule requires a non-empty 'key_columns' list");
+    }
+
+    m_key_columns = config()["key_columns"].get<std::vector<std::string>>();
+
+    if (!config().contains("num_partitions") || config()["num_partitions"].get<std::size_t>() < 1)
+    {
+        throw std::runtime_error("HashPartitionModule requires 'num_partitions' >= 1");
+    }
+
+    m_num_partitions = config()["num_partitions"].get<std::size_t>();
+
+    if (config().contains("queue_size"))
+    {
+        m_queue_size = config()["queue_size"].get<std::size_t>();
+    }
+
+    if (m_queue_size < 2 || (m_queue_size & (m_queue_size - 1)) != 0)
+    {
+        throw std::runtime_error("HashPartitionModule 'queue_size' must be a power of two >= 2");
+    }
+
+    m_channels.reserve(m_num_partitions);
+    for (std::size_t i = 0; i < m_num_partitions; ++i)
+    {
+        m_channels.emplace_back(std::make_shared<channel_t>(m_queue_size));
+    }
+}
+
+void HashPartitionModule::partition_message(const std::shared_ptr<MessageMeta>& msg)
+{
+    const auto info        = msg->get_info();
+    const auto& view       = info.get_view();
+    const auto index_count = info.num_indices();
+    const auto names       = info.get_column_names();
+
+    // Resolve the key columns against this table; the view's leading columns are the index
+    std::vector<cudf::size_type> key_indices;
+    key_indices.reserve(m_key_columns.size());
+
+    for (const auto& key : m_key_columns)
+    {
+        auto found = std::find(names.begin(), names.end(), key);
+
+        if (found == names.end())
+        {
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Key column '" << key << "' not found in message"));
+        }
+
+        key_indices.push_back(index_count + static_cast<cudf::size_type>(found - names.begin()));
+    }
+
+    // One device pass reorders the rows so each partition is a contiguous range
+    auto [partitioned, offsets] = cudf::hash_partition(view, key_indices, static_cast<int>(m_num_partitions));
+
+    cudf::io::table_metadata metadata;
+    metadata.schema_info.reserve(names.size() + index_count);
+
+    for (const auto& name : info.get_index_names())
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    for (const auto& name : names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    const auto num_rows = partitioned->num_rows();
+
+    for (std::size_t i = 0; i < m_num_partitions; ++i)
+    {
+        const auto start = offsets[i];
+        const auto end   = i + 1 < m_num_partitions ? offsets[i + 1] : num_rows;
+
+        if (start == end)
+        {
+            // Branches only see the keys hashed to them, an empty partition carries no information
+            continue;
+        }
+
+        // Copy the partition's rows into a table of its own, the sub-messages must not share lifetime
+        auto partition = std::make_unique<cudf::table>(cudf::slice(partitioned->view(), {start, end}).front());
+
+        auto meta = MessageMeta::create_from_cpp({std::move(partition), cudf::io::table_metadata{metadata}},
+                                                 index_count);
+
+        // Blocks (yielding the fiber) while this branch's queue is full, backpressuring the splitter the
+        // same way a full in-process edge would
+        m_channels[i]->push(std::move(meta));
+    }
+}
+
+void HashPartitionModule::initialize(mrc::segment::IBuilder& builder)
+{
+    using message_t = std::shared_ptr<MessageMeta>;
+
+    auto splitter = builder.make_sink<message_t>(
+        "input",
+        [this](message_t msg) {
+            partition_message(msg);
+        },
+        [this](std::exception_ptr error_ptr) {
+            for (auto& channel : m_channels)
+            {
+                channel->close();
+            }
+
+            std::rethrow_exception(error_ptr);
+        },
+        [this]() {
+            // End of stream: closing the channels lets each port source drain and complete
+            for (auto& channel : m_channels)
+            {
+                channel->close();
+            }
+        });
+
+    register_input_port("input", splitter);
+
+    for (std::size_t i = 0; i < m_num_partitions; ++i)
+    {
+        auto port_name = MORPHEUS_CONCAT_STR("output_" << i);
+        auto channel   = m_channels[i];
+
+        auto source = builder.make_source<message_t>(port_name, [channel](rxcpp::subscriber<message_t>& sub) {
+            message_t msg;
+
+            while (sub.is_subscribed() && channel->pop(msg) == boost::fibers::channel_op_status::success)
+            {
+                sub.on_next(std::move(msg));
+            }
+
+            sub.on_completed();
+        });
+
+        register_output_port(port_name, source);
+    }
+}
+
+std::string HashPartitionModule::module_type_name() const
+{
+    return std::string(::mrc::type_name<type_t>());
+}
+}  // namespace morpheus
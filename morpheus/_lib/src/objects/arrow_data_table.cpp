@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/arrow_data_table.hpp"
+
+#include "morpheus/utilities/cudf_util.hpp"
+
+#include <cudf/interop.hpp>  // for from_arrow
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+#include <glog/logging.h>
+#include <pybind11/cast.h>  // for object::cast
+#include <pybind11/gil.h>
+#include <pybind11/pybind11.h>
+
+#include <mutex>
+#include <utility>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** ArrowDataTable*************************************/
+ArrowDataTable::ArrowDataTable(std::shared_ptr<arrow::Table> table) : m_table(std::move(table))
+{
+    CHECK(m_table) << "ArrowDataTable requires a table";
+
+    for (const auto& field : m_table->schema()->fields())
+    {
+        m_column_names.push_back(field->name());
+    }
+}
+
+ArrowDataTable::~ArrowDataTable()
+{
+    if (m_py_table)
+    {
+        pybind11::gil_scoped_acquire gil;
+
+        // Clear out the python object
+        m_py_table = pybind11::object();
+    }
+}
+
+cudf::size_type ArrowDataTable::count() const
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_table)
+        {
+            return static_cast<cudf::size_type>(m_table->num_rows());
+        }
+
+        if (!m_py_table)
+        {
+            return m_device_table.tbl->num_rows();
+        }
+    }
+
+    // Once set, `m_py_table` is never reset, so it's safe to use outside the lock. Query the python object since it
+    // may have been mutated through a checkout
+    pybind11::gil_scoped_acquire gil;
+
+    return m_py_table.attr("shape").attr("__getitem__")(0).cast<cudf::size_type>();
+}
+
+bool ArrowDataTable::has_implicit_range_index() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // There is never an index column in the Arrow table, but once promoted python code may have replaced the index,
+    // so the index then needs to be inspected again
+    return !m_py_table;
+}
+
+const pybind11::object& ArrowDataTable::get_py_object() const
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_py_table)
+        {
+            return m_py_table;
+        }
+    }
+
+    // Acquire the GIL before re-taking the mutex. Taking them in the opposite order would deadlock against a caller
+    // which already holds the GIL (i.e. `has_sliceable_index`)
+    pybind11::gil_scoped_acquire gil;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_py_table)
+    {
+        if (m_table)
+        {
+            this->upload();
+        }
+
+        // The columns' device buffers are moved by pointer, not copied, so any outstanding views remain valid
+        m_py_table = CudfHelper::table_from_table_with_metadata(std::move(m_device_table), 0);
+    }
+
+    return m_py_table;
+}
+
+TableInfoData ArrowDataTable::get_table_data() const
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // A view consumer needs device memory, this is the point a host table stops being host-only
+        if (m_table)
+        {
+            this->upload();
+        }
+
+        if (!m_py_table)
+        {
+            // Pure C++ path, no GIL required
+            return {m_device_table.tbl->view(), {}, m_column_names};
+        }
+    }
+
+    pybind11::gil_scoped_acquire gil;
+
+    auto info = CudfHelper::table_info_data_from_table(m_py_table);
+
+    return info;
+}
+
+void ArrowDataTable::upload() const
+{
+    auto metadata = cudf::io::table_metadata{};
+    metadata.schema_info.reserve(m_column_names.size());
+
+    for (const auto& name : m_column_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    // Single host-to-device transfer, the host table is released as soon as the device copy exists
+    m_device_table = {cudf::from_arrow(*m_table), std::move(metadata)};
+    m_table.reset();
+}
+}  // namespace morpheus
@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/cpp_data_table.hpp"
+
+#include "morpheus/utilities/cudf_util.hpp"
+
+#include <cudf/column/column.hpp>  // for column
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+#include <pybind11/cast.h>  // for object::cast
+#include <pybind11/gil.h>
+#include <pybind11/pybind11.h>
+
+#include <cstddef>  // for size_t
+#include <memory>   // for unique_ptr
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace morpheus {
+/****** Component public implementations *******************/
+/****** CppDataTable***************************************/
+CppDataTable::CppDataTable(cudf::io::table_with_metadata&& table, int index_col_count) :
+  m_table(std::move(table)),
+  m_index_col_count(index_col_count)
+{
+    // Split the schema names up front so get_table_data() is a pure pointer copy
+    const auto& schema = m_table.metadata.schema_info;
+
+    for (std::size_t i = 0; i < schema.size(); ++i)
+    {
+        if (i < static_cast<std::size_t>(m_index_col_count))
+        {
+            m_index_names.push_back(schema[i].name);
+        }
+        else
+        {
+            m_column_names.push_back(schema[i].name);
+        }
+    }
+}
+
+CppDataTable::~CppDataTable()
+{
+    if (m_py_table)
+    {
+        pybind11::gil_scoped_acquire gil;
+
+        // Clear out the python object
+        m_py_table = pybind11::object();
+    }
+}
+
+cudf::size_type CppDataTable::count() const
+{
+    {
+        std::lock_guard<std::mutex> lock(m_py_mutex);
+
+        if (!m_py_table)
+        {
+            return m_table.tbl->num_rows();
+        }
+    }
+
+    // Once set, `m_py_table` is never reset, so it's safe to use outside the lock. Query the python object since it
+    // may have been mutated through a checkout
+    pybind11::gil_scoped_acquire gil;
+
+    return m_py_table.attr("shape").attr("__getitem__")(0).cast<cudf::size_type>();
+}
+
+bool CppDataTable::has_implicit_range_index() const
+{
+    std::lock_guard<std::mutex> lock(m_py_mutex);
+
+    // Once promoted, python code may have replaced the index, so the index needs to be inspected again
+    return m_index_col_count == 0 && !m_py_table;
+}
+
+bool CppDataTable::append_columns(std::vector<std::pair<std::string, std::unique_ptr<cudf::column>>>&& columns) const
+{
+    std::lock_guard<std::mutex> lock(m_py_mutex);
+
+    if (m_py_table)
+    {
+        // Python owns the columns now, the caller appends through the DataFrame instead
+        return false;
+    }
+
+    // Re-seat the owned table around its released column vector plus the new columns. Only the column pointers
+    // move; no device data is touched, so outstanding views into the existing columns remain valid.
+    auto owned_columns = m_table.tbl->release();
+    owned_columns.reserve(owned_columns.size() + columns.size());
+
+    for (auto& [name, column] : columns)
+    {
+        m_table.metadata.schema_info.emplace_back(name);
+        m_column_names.push_back(name);
+        owned_columns.push_back(std::move(column));
+    }
+
+    m_table.tbl = std::make_unique<cudf::table>(std::move(owned_columns));
+
+    return true;
+}
+
+const pybind11::object& CppDataTable::get_py_object() const
+{
+    {
+        std::lock_guard<std::mutex> lock(m_py_mutex);
+
+        if (m_py_table)
+        {
+            return m_py_table;
+        }
+    }
+
+    // Acquire the GIL before re-taking the mutex. Taking them in the opposite order would deadlock against a caller
+    // which already holds the GIL (i.e. `has_sliceable_index`)
+    pybind11::gil_scoped_acquire gil;
+    std::lock_guard<std::mutex> lock(m_py_mutex);
+
+    if (!m_py_table)
+    {
+        // Promote the C++ table to a python DataFrame. The columns' device buffers are moved by pointer, not copied,
+        // so any outstanding views into this table remain valid
+        m_py_table = CudfHelper::table_from_table_with_metadata(std::move(m_table), m_index_col_count);
+    }
+
+    return m_py_table;
+}
+
+TableInfoData CppDataTable::get_table_data() const
+{
+    {
+        std::lock_guard<std::mutex> lock(m_py_mutex);
+
+        if (!m_py_table)
+        {
+            // Pure C++ path, no GIL required
+            return {m_table.tbl->view(), m_index_names, m_column_names};
+        }
+    }
+
+    pybind11::gil_scoped_acquire gil;
+
+    auto info = CudfHelper::table_info_data_from_table(m_py_table);
+
+    return info;
+}
+}  // namespace morpheus
@@ -22,27 +22,97 @@
 
 #include <glog/logging.h>
 #include <pybind11/gil.h>
+#include <pybind11/pytypes.h>  // for key_error
 
+#include <algorithm>  // for find
+#include <atomic>     // for atomic_load, atomic_store & atomic_exchange on shared_ptr
+#include <memory>
 #include <mutex>
 #include <ostream>
-#include <shared_mutex>
+#include <string>   // for string
+#include <thread>   // for yield
 #include <utility>
+#include <vector>  // for vector
 
 namespace morpheus {
 
+std::shared_ptr<const TableInfoData> IDataTable::get_snapshot() const
+{
+    // Fast path: readers share the current immutable snapshot without taking any lock
+    auto snapshot = std::atomic_load(&m_snapshot);
+
+    if (!snapshot)
+    {
+        // No published snapshot (first reader, or a mutator retired it). Build one under the writer mutex so it
+        // cannot race with a mutation in progress
+        std::lock_guard<std::mutex> lock(m_writer_mutex);
+
+        snapshot = std::atomic_load(&m_snapshot);
+
+        if (!snapshot)
+        {
+            snapshot = std::make_shared<const TableInfoData>(this->get_table_data());
+            std::atomic_store(&m_snapshot, snapshot);
+        }
+    }
+
+    return snapshot;
+}
+
 TableInfo IDataTable::get_info() const
 {
     CHECK_EQ(PyGILState_Check(), 0)
         << "Cannot hold the Python GIL when accessing `get_info()`. Please release it first or deadlocks may occur.";
 
-    // Get a shared lock while we get the table info (prevents mutation)
-    std::shared_lock lock(m_mutex);
+    auto snapshot = this->get_snapshot();
 
-    // Get the table info data
-    auto table_info_data = this->get_table_data();
+    // From this, create a new TableInfo sharing the snapshot
+    TableInfoData table_info_data = *snapshot;
 
-    // From this, create a new TableInfo
-    return {this->shared_from_this(), std::move(lock), std::move(table_info_data)};
+    return {this->shared_from_this(), std::move(snapshot), std::move(table_info_data)};
+}
+
+TableInfo IDataTable::get_info(const std::vector<std::string>& column_names) const
+{
+    CHECK_EQ(PyGILState_Check(), 0)
+        << "Cannot hold the Python GIL when accessing `get_info()`. Please release it first or deadlocks may occur.";
+
+    auto snapshot = this->get_snapshot();
+
+    // Select just the requested columns (plus the index columns) out of the snapshot, instead of copying a view
+    // and name for every column only for the caller to discard most of them
+    const auto num_indices = static_cast<cudf::size_type>(snapshot->index_names.size());
+
+    std::vector<cudf::size_type> col_indices;
+    col_indices.reserve(num_indices + column_names.size());
+
+    for (cudf::size_type i = 0; i < num_indices; ++i)
+    {
+        col_indices.push_back(i);
+    }
+
+    std::vector<cudf::size_type> col_mappings;
+    col_mappings.reserve(column_names.size());
+
+    for (const auto& name : column_names)
+    {
+        auto found_col = std::find(snapshot->column_names.begin(), snapshot->column_names.end(), name);
+
+        if (found_col == snapshot->column_names.end())
+        {
+            throw pybind11::key_error("Unknown column: " + name);
+        }
+
+        auto idx = static_cast<cudf::size_type>(found_col - snapshot->column_names.begin());
+
+        col_mappings.push_back(idx);
+        col_indices.push_back(idx + num_indices);
+    }
+
+    TableInfoData narrowed{
+        snapshot->table_view.select(col_indices), snapshot->index_names, column_names, std::move(col_mappings)};
+
+    return {this->shared_from_this(), std::move(snapshot), std::move(narrowed)};
 }
 
 MutableTableInfo IDataTable::get_mutable_info() const
@@ -50,8 +120,20 @@ MutableTableInfo IDataTable::get_mutable_info() const
     CHECK_EQ(PyGILState_Check(), 0) << "Cannot hold the Python GIL when accessing `get_mutable_info()`. Please release "
                                        "it first or deadlocks may occur.";
 
-    // Get a unique lock while we get the table info (prevents mutation)
-    std::unique_lock lock(m_mutex);
+    // Serialize against other mutators and against readers rebuilding the snapshot
+    std::unique_lock<std::mutex> lock(m_writer_mutex);
+
+    // Any mutable checkout may change the schema, conservatively invalidate any cached column handles
+    m_schema_version.fetch_add(1, std::memory_order_relaxed);
+
+    // Retire the published snapshot and wait for every outstanding reader to drop its reference (the RCU grace
+    // period). New readers rebuild a fresh snapshot once this mutator releases the writer mutex
+    auto retired = std::atomic_exchange(&m_snapshot, std::shared_ptr<const TableInfoData>());
+
+    while (retired.use_count() > 1)
+    {
+        std::this_thread::yield();
+    }
 
     // Get the table info data
     auto table_info_data = this->get_table_data();
@@ -60,4 +142,9 @@ MutableTableInfo IDataTable::get_mutable_info() const
     return {this->shared_from_this(), std::move(lock), std::move(table_info_data)};
 }
 
+std::size_t IDataTable::schema_version() const
+{
+    return m_schema_version.load(std::memory_order_relaxed);
+}
+
 }  // namespace morpheus
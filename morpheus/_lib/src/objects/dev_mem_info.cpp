@@ -111,6 +111,11 @@ std::shared_ptr<MemoryDescriptor> DevMemInfo::memory() const
     return m_md;
 }
 
+int DevMemInfo::device_id() const
+{
+    return m_md->device_id;
+}
+
 std::unique_ptr<rmm::device_buffer> DevMemInfo::make_new_buffer(TensorSize bytes) const
 {
     return std::make_unique<rmm::device_buffer>(bytes, m_md->cuda_stream, m_md->memory_resource);
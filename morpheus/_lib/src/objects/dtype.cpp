@@ -17,18 +17,93 @@
 
 #include "morpheus/objects/dtype.hpp"
 
-#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
-
 #include <cudf/types.hpp>
 #include <glog/logging.h>  // for CHECK
 
+#include <array>
+#include <cstddef>
 #include <map>
-#include <sstream>  // Needed by MORPHEUS_CONCAT_STR
 #include <stdexcept>
 #include <string>
-#include <utility>
+#include <string_view>
 
 namespace {
+
+constexpr std::size_t TypeIdCount = static_cast<std::size_t>(morpheus::TypeId::NUM_TYPE_IDS);
+
+/**
+ * One row per TypeId, indexed by the enum's underlying value, so the per-call switch/string building the
+ * accessors used to do becomes an array lookup. `cudf::type_id::NUM_TYPE_IDS` marks types with no cuDF
+ * equivalent, an empty triton name marks types Triton cannot carry, and an item size of zero marks ids that are
+ * not real data types.
+ */
+struct DTypeTraits
+{
+    std::size_t item_size;
+    char type_char;
+    cudf::type_id cudf_id;
+    std::string_view numpy_str;
+    std::string_view triton_str;
+};
+
+constexpr std::array<DTypeTraits, TypeIdCount> TypeIdTraits = {{
+    {0, '\0', cudf::type_id::NUM_TYPE_IDS, "", ""},       // EMPTY
+    {1, 'i', cudf::type_id::INT8, "<i1", "INT8"},         // INT8
+    {2, 'i', cudf::type_id::INT16, "<i2", "INT16"},       // INT16
+    {4, 'i', cudf::type_id::INT32, "<i4", "INT32"},       // INT32
+    {8, 'i', cudf::type_id::INT64, "<i8", "INT64"},       // INT64
+    {1, 'u', cudf::type_id::UINT8, "<u1", "UINT8"},       // UINT8
+    {2, 'u', cudf::type_id::UINT16, "<u2", "UINT16"},     // UINT16
+    {4, 'u', cudf::type_id::UINT32, "<u4", "UINT32"},     // UINT32
+    {8, 'u', cudf::type_id::UINT64, "<u8", "UINT64"},     // UINT64
+    {4, 'f', cudf::type_id::FLOAT32, "<f4", "FP32"},      // FLOAT32
+    {8, 'f', cudf::type_id::FLOAT64, "<f8", "FP64"},      // FLOAT64
+    {1, '?', cudf::type_id::BOOL8, "?", "BOOL"},          // BOOL8
+    {1, 'O', cudf::type_id::STRING, "O", ""},             // STRING, item size of an individual char
+    {2, 'f', cudf::type_id::NUM_TYPE_IDS, "<f2", "FP16"},  // FLOAT16, cuDF has no half type
+}};
+
+const DTypeTraits& traits(morpheus::TypeId tid)
+{
+    const auto index = static_cast<std::size_t>(tid);
+    if (index >= TypeIdCount)
+    {
+        throw std::invalid_argument("Unknown datatype");
+    }
+
+    return TypeIdTraits[index];
+}
+
+// Interned std::string copies of the numpy names, so type_str() hands out a reference instead of building a
+// string per call
+const std::array<std::string, TypeIdCount>& numpy_strings()
+{
+    static const auto strings = [] {
+        std::array<std::string, TypeIdCount> out;
+        for (std::size_t i = 0; i < TypeIdCount; ++i)
+        {
+            out[i] = TypeIdTraits[i].numpy_str;
+        }
+        return out;
+    }();
+
+    return strings;
+}
+
+const std::array<std::string, TypeIdCount>& triton_strings()
+{
+    static const auto strings = [] {
+        std::array<std::string, TypeIdCount> out;
+        for (std::size_t i = 0; i < TypeIdCount; ++i)
+        {
+            out[i] = TypeIdTraits[i].triton_str;
+        }
+        return out;
+    }();
+
+    return strings;
+}
+
 const std::map<char, std::map<size_t, morpheus::TypeId>> StrToTypeId = {
     {'?', {{1, morpheus::TypeId::BOOL8}}},
 
@@ -46,7 +121,7 @@ const std::map<char, std::map<size_t, morpheus::TypeId>> StrToTypeId = {
          {8, morpheus::TypeId::UINT64},
      }},
 
-    {'f', {{4, morpheus::TypeId::FLOAT32}, {8, morpheus::TypeId::FLOAT64}}},
+    {'f', {{2, morpheus::TypeId::FLOAT16}, {4, morpheus::TypeId::FLOAT32}, {8, morpheus::TypeId::FLOAT64}}},
 
     {'O', {{1, morpheus::TypeId::STRING}}}};
 }  // namespace
@@ -67,155 +142,79 @@ TypeId DType::type_id() const
 
 size_t DType::item_size() const
 {
-    switch (m_type_id)
+    const auto size = traits(m_type_id).item_size;
+    if (size == 0)
     {
-    case TypeId::BOOL8:
-    case TypeId::INT8:
-    case TypeId::STRING:  // not sure, but size of individual char
-    case TypeId::UINT8:
-        return 1;
-    case TypeId::INT16:
-    case TypeId::UINT16:
-        return 2;
-    case TypeId::INT32:
-    case TypeId::UINT32:
-    case TypeId::FLOAT32:
-        return 4;
-    case TypeId::INT64:
-    case TypeId::UINT64:
-    case TypeId::FLOAT64:
-        return 8;
-    case TypeId::NUM_TYPE_IDS:
-    case TypeId::EMPTY:
-    default:
         throw std::invalid_argument("Unknown datatype");
     }
+
+    return size;
 }
 
-std::string DType::name() const
+const std::string& DType::name() const
 {
     // TODO(MDD): Replace this with a better version. For now, follow type_str
     return this->type_str();
 }
 
-std::string DType::type_str() const
+const std::string& DType::type_str() const
 {
-    if (m_type_id != TypeId::BOOL8 && m_type_id != TypeId::STRING)
-    {
-        return MORPHEUS_CONCAT_STR("<" << this->type_char() << this->item_size());
-    }
-    else
+    if (traits(m_type_id).numpy_str.empty())
     {
-        return std::string{this->type_char()};
+        throw std::invalid_argument("Unknown datatype");
     }
+
+    return numpy_strings()[static_cast<std::size_t>(m_type_id)];
 }
 
 // Cudf representation
 cudf::type_id DType::cudf_type_id() const
 {
-    switch (m_type_id)
+    const auto cudf_id = traits(m_type_id).cudf_id;
+    if (cudf_id == cudf::type_id::NUM_TYPE_IDS)
     {
-    case TypeId::INT8:
-        return cudf::type_id::INT8;
-    case TypeId::INT16:
-        return cudf::type_id::INT16;
-    case TypeId::INT32:
-        return cudf::type_id::INT32;
-    case TypeId::INT64:
-        return cudf::type_id::INT64;
-    case TypeId::UINT8:
-        return cudf::type_id::UINT8;
-    case TypeId::UINT16:
-        return cudf::type_id::UINT16;
-    case TypeId::UINT32:
-        return cudf::type_id::UINT32;
-    case TypeId::UINT64:
-        return cudf::type_id::UINT64;
-    case TypeId::FLOAT32:
-        return cudf::type_id::FLOAT32;
-    case TypeId::FLOAT64:
-        return cudf::type_id::FLOAT64;
-    case TypeId::BOOL8:
-        return cudf::type_id::BOOL8;
-    case TypeId::STRING:
-        return cudf::type_id::STRING;
-    case TypeId::EMPTY:
-    case TypeId::NUM_TYPE_IDS:
-    default:
         throw std::runtime_error("Not supported");
     }
+
+    return cudf_id;
 }
 
 // Returns the triton string representation
-std::string DType::triton_str() const
+const std::string& DType::triton_str() const
 {
     // Triton doesn't have any definitions or enums. Wow
-    switch (m_type_id)
+    if (traits(m_type_id).triton_str.empty())
     {
-    case TypeId::INT8:
-        return "INT8";
-    case TypeId::INT16:
-        return "INT16";
-    case TypeId::INT32:
-        return "INT32";
-    case TypeId::INT64:
-        return "INT64";
-    case TypeId::UINT8:
-        return "UINT8";
-    case TypeId::UINT16:
-        return "UINT16";
-    case TypeId::UINT32:
-        return "UINT32";
-    case TypeId::UINT64:
-        return "UINT64";
-    case TypeId::FLOAT32:
-        return "FP32";
-    case TypeId::FLOAT64:
-        return "FP64";
-    case TypeId::BOOL8:
-        return "BOOL";
-    case TypeId::EMPTY:
-    case TypeId::NUM_TYPE_IDS:
-    case TypeId::STRING:
-    default:
         throw std::runtime_error("Not supported");
     }
+
+    return triton_strings()[static_cast<std::size_t>(m_type_id)];
 }
 
 // From cudf
 DType DType::from_cudf(cudf::type_id tid)
 {
-    switch (tid)
+    // Reverse of the traits table, built once and indexed by the cudf id
+    static const auto cudf_to_type_id = [] {
+        std::array<TypeId, static_cast<std::size_t>(cudf::type_id::NUM_TYPE_IDS)> out;
+        out.fill(TypeId::EMPTY);
+        for (std::size_t i = 0; i < TypeIdCount; ++i)
+        {
+            if (TypeIdTraits[i].cudf_id != cudf::type_id::NUM_TYPE_IDS)
+            {
+                out[static_cast<std::size_t>(TypeIdTraits[i].cudf_id)] = static_cast<TypeId>(i);
+            }
+        }
+        return out;
+    }();
+
+    const auto index = static_cast<std::size_t>(tid);
+    if (index >= cudf_to_type_id.size() || cudf_to_type_id[index] == TypeId::EMPTY)
     {
-    case cudf::type_id::INT8:
-        return {TypeId::INT8};
-    case cudf::type_id::INT16:
-        return {TypeId::INT16};
-    case cudf::type_id::INT32:
-        return {TypeId::INT32};
-    case cudf::type_id::INT64:
-        return {TypeId::INT64};
-    case cudf::type_id::UINT8:
-        return {TypeId::UINT8};
-    case cudf::type_id::UINT16:
-        return {TypeId::UINT16};
-    case cudf::type_id::UINT32:
-        return {TypeId::UINT32};
-    case cudf::type_id::UINT64:
-        return {TypeId::UINT64};
-    case cudf::type_id::FLOAT32:
-        return {TypeId::FLOAT32};
-    case cudf::type_id::FLOAT64:
-        return {TypeId::FLOAT64};
-    case cudf::type_id::BOOL8:
-        return {TypeId::BOOL8};
-    case cudf::type_id::STRING:
-        return {TypeId::STRING};
-    case cudf::type_id::EMPTY:
-    case cudf::type_id::NUM_TYPE_IDS:
-    default:
         throw std::runtime_error("Not supported");
     }
+
+    return {cudf_to_type_id[index]};
 }
 
 DType DType::from_numpy(const std::string& numpy_str)
@@ -253,82 +252,38 @@ DType DType::from_numpy(const std::string& numpy_str)
 // From triton
 DType DType::from_triton(const std::string& type_str)
 {
-    if (type_str == "INT8")
+    for (std::size_t i = 0; i < TypeIdCount; ++i)
     {
-        return {TypeId::INT8};
-    }
-    else if (type_str == "INT16")
-    {
-        return {TypeId::INT16};
-    }
-    else if (type_str == "INT32")
-    {
-        return {TypeId::INT32};
-    }
-    else if (type_str == "INT64")
-    {
-        return {TypeId::INT64};
-    }
-    else if (type_str == "UINT8")
-    {
-        return {TypeId::UINT8};
-    }
-    else if (type_str == "UINT16")
-    {
-        return {TypeId::UINT16};
-    }
-    else if (type_str == "UINT32")
-    {
-        return {TypeId::UINT32};
-    }
-    else if (type_str == "UINT64")
-    {
-        return {TypeId::UINT64};
-    }
-    else if (type_str == "FP32")
-    {
-        return {TypeId::FLOAT32};
-    }
-    else if (type_str == "FP64")
-    {
-        return {TypeId::FLOAT64};
-    }
-    else if (type_str == "BOOL")
-    {
-        return {TypeId::BOOL8};
-    }
-    else
-    {
-        throw std::runtime_error("Not supported");
+        if (!TypeIdTraits[i].triton_str.empty() && TypeIdTraits[i].triton_str == type_str)
+        {
+            return {static_cast<TypeId>(i)};
+        }
     }
+
+    throw std::runtime_error("Not supported");
 }
 
 char DType::type_char() const
 {
-    switch (m_type_id)
+    const auto type_char = traits(m_type_id).type_char;
+    if (type_char == '\0')
     {
-    case TypeId::INT8:
-    case TypeId::INT16:
-    case TypeId::INT32:
-    case TypeId::INT64:
-        return 'i';
-    case TypeId::UINT8:
-    case TypeId::UINT16:
-    case TypeId::UINT32:
-    case TypeId::UINT64:
-        return 'u';
-    case TypeId::BOOL8:
-        return '?';
-    case TypeId::FLOAT32:
-    case TypeId::FLOAT64:
-        return 'f';
-    case TypeId::STRING:
-        return 'O';
-    case TypeId::NUM_TYPE_IDS:
-    case TypeId::EMPTY:
-    default:
         throw std::invalid_argument("Unknown datatype");
     }
+
+    return type_char;
+}
+
+std::map<std::string, cudf::data_type> schema_to_cudf_dtypes(const TableSchema& schema)
+{
+    std::map<std::string, cudf::data_type> dtypes;
+
+    for (const auto& [name, type_id] : schema)
+    {
+        dtypes.emplace(name, cudf::data_type{DType(type_id).cudf_type_id()});
+    }
+
+    return dtypes;
 }
 
 }  // namespace morpheus
@@ -18,25 +18,207 @@
 #include "morpheus/objects/fiber_queue.hpp"
 
 #include <boost/fiber/channel_op_status.hpp>
-#include <glog/logging.h>  // for LOG, FATAL
-#include <pybind11/gil.h>  // for gil_scoped_release
+#include <boost/fiber/operations.hpp>  // for this_fiber::yield
+#include <glog/logging.h>              // for LOG, FATAL
+#include <pybind11/gil.h>              // for gil_scoped_release
 #include <pybind11/pybind11.h>
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>     // for size_t, ptrdiff_t
+#include <cstdint>     // for intptr_t
 #include <functional>  // for ref, reference_wrapper
 #include <memory>
 #include <ostream>    // needed by GLOG
 #include <ratio>      // for ratio needed for std::chrono::duration
 #include <stdexcept>  // for invalid_argument, runtime_error
 #include <utility>
+#include <vector>
 
 namespace morpheus {
+
+namespace {
+
+// Converts a float timeout in seconds to a deadline. A timeout of 0 means "no deadline"
+std::chrono::steady_clock::time_point make_deadline(float timeout)
+{
+    return std::chrono::steady_clock::now() +
+           std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(timeout));
+}
+
+}  // namespace
+
 /****** Component public implementations *******************/
+/****** LockFreeRing**************************************/
+LockFreeRing::LockFreeRing(std::size_t capacity, std::size_t spin_count) :
+  m_cells(std::make_unique<Cell[]>(capacity)),
+  m_mask(capacity - 1),
+  m_spin_count(spin_count)
+{
+    DCHECK(capacity >= 2 && (capacity & (capacity - 1)) == 0) << "capacity must be a power of 2";
+
+    for (std::size_t i = 0; i < capacity; ++i)
+    {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+boost::fibers::channel_op_status LockFreeRing::try_put(pybind11::object&& item)
+{
+    if (m_closed.load(std::memory_order_relaxed))
+    {
+        return boost::fibers::channel_op_status::closed;
+    }
+
+    auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        auto& cell = m_cells[pos & m_mask];
+        auto seq   = cell.sequence.load(std::memory_order_acquire);
+        auto diff  = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0)
+        {
+            // The slot is free, claim it. On failure `pos` is reloaded by the exchange
+            if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.data = std::move(item);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+
+                return boost::fibers::channel_op_status::success;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The consumer for this slot a full lap behind, the ring is full
+            return boost::fibers::channel_op_status::full;
+        }
+        else
+        {
+            // Another producer claimed this slot, move to the current tail
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+boost::fibers::channel_op_status LockFreeRing::try_get(pybind11::object& item)
+{
+    auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        auto& cell = m_cells[pos & m_mask];
+        auto seq   = cell.sequence.load(std::memory_order_acquire);
+        auto diff  = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+        if (diff == 0)
+        {
+            if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                item = std::move(cell.data);
+                cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+
+                return boost::fibers::channel_op_status::success;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Drain any items published before the close, only report closed once the ring is empty
+            return m_closed.load(std::memory_order_relaxed) ? boost::fibers::channel_op_status::closed
+                                                            : boost::fibers::channel_op_status::empty;
+        }
+        else
+        {
+            pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+boost::fibers::channel_op_status LockFreeRing::put(pybind11::object&& item, bool block, float timeout)
+{
+    auto status = this->try_put(std::move(item));
+
+    if (!block || status != boost::fibers::channel_op_status::full)
+    {
+        return status;
+    }
+
+    const auto deadline  = make_deadline(timeout);
+    std::size_t attempts = 0;
+
+    while (status == boost::fibers::channel_op_status::full)
+    {
+        if (++attempts > m_spin_count)
+        {
+            // Burst absorbed or consumer stalled, stop burning the core
+            boost::this_fiber::yield();
+        }
+
+        if (timeout > 0.0F && std::chrono::steady_clock::now() >= deadline)
+        {
+            return boost::fibers::channel_op_status::timeout;
+        }
+
+        status = this->try_put(std::move(item));
+    }
+
+    return status;
+}
+
+boost::fibers::channel_op_status LockFreeRing::get(pybind11::object& item, bool block, float timeout)
+{
+    auto status = this->try_get(item);
+
+    if (!block || status != boost::fibers::channel_op_status::empty)
+    {
+        return status;
+    }
+
+    const auto deadline  = make_deadline(timeout);
+    std::size_t attempts = 0;
+
+    while (status == boost::fibers::channel_op_status::empty)
+    {
+        if (++attempts > m_spin_count)
+        {
+            boost::this_fiber::yield();
+        }
+
+        if (timeout > 0.0F && std::chrono::steady_clock::now() >= deadline)
+        {
+            return boost::fibers::channel_op_status::timeout;
+        }
+
+        status = this->try_get(item);
+    }
+
+    return status;
+}
+
+void LockFreeRing::close()
+{
+    m_closed.store(true, std::memory_order_relaxed);
+}
+
+bool LockFreeRing::is_closed() const
+{
+    return m_closed.load(std::memory_order_relaxed);
+}
+
 /****** FiberQueue****************************************/
-FiberQueue::FiberQueue(size_t max_size) : m_queue(max_size) {}
+FiberQueue::FiberQueue(size_t max_size, bool lock_free, std::size_t spin_count) :
+  m_queue(max_size),
+  m_ring(lock_free ? std::make_unique<LockFreeRing>(max_size, spin_count) : nullptr)
+{}
 
 boost::fibers::channel_op_status FiberQueue::put(pybind11::object&& item, bool block, float timeout)
 {
+    if (m_ring)
+    {
+        return m_ring->put(std::move(item), block, timeout);
+    }
+
     if (!block)
     {
         return m_queue.try_push(std::move(item));
@@ -55,6 +237,11 @@ boost::fibers::channel_op_status FiberQueue::put(pybind11::object&& item, bool b
 
 boost::fibers::channel_op_status FiberQueue::get(pybind11::object& item, bool block, float timeout)
 {
+    if (m_ring)
+    {
+        return m_ring->get(item, block, timeout);
+    }
+
     if (!block)
     {
         return m_queue.try_pop(std::ref(item));
@@ -71,13 +258,72 @@ boost::fibers::channel_op_status FiberQueue::get(pybind11::object& item, bool bl
     }
 }
 
+boost::fibers::channel_op_status FiberQueue::put_all(std::vector<pybind11::object>& items, bool block, float timeout)
+{
+    std::size_t delivered = 0;
+
+    auto status = boost::fibers::channel_op_status::success;
+
+    for (auto& item : items)
+    {
+        status = this->put(std::move(item), block, timeout);
+
+        if (status != boost::fibers::channel_op_status::success)
+        {
+            break;
+        }
+
+        ++delivered;
+    }
+
+    items.erase(items.begin(), items.begin() + static_cast<std::ptrdiff_t>(delivered));
+
+    return status;
+}
+
+boost::fibers::channel_op_status FiberQueue::get_all(std::vector<pybind11::object>& items,
+                                                     std::size_t max_n,
+                                                     bool block,
+                                                     float timeout)
+{
+    pybind11::object item;
+
+    auto status = this->get(item, block, timeout);
+
+    if (status != boost::fibers::channel_op_status::success)
+    {
+        return status;
+    }
+
+    items.emplace_back(std::move(item));
+
+    // The wait above paid for the whole burst, everything else comes out without blocking
+    while (items.size() < max_n && this->get(item, false, 0.0F) == boost::fibers::channel_op_status::success)
+    {
+        items.emplace_back(std::move(item));
+    }
+
+    return boost::fibers::channel_op_status::success;
+}
+
 void FiberQueue::close()
 {
+    if (m_ring)
+    {
+        m_ring->close();
+        return;
+    }
+
     m_queue.close();
 }
 
 bool FiberQueue::is_closed()
 {
+    if (m_ring)
+    {
+        return m_ring->is_closed();
+    }
+
     return m_queue.is_closed();
 }
 
@@ -87,7 +333,7 @@ void FiberQueue::join()
 }
 
 /****** FiberQueueInterfaceProxy *************************/
-std::shared_ptr<morpheus::FiberQueue> FiberQueueInterfaceProxy::init(std::size_t max_size)
+std::shared_ptr<morpheus::FiberQueue> FiberQueueInterfaceProxy::init(std::size_t max_size, bool lock_free)
 {
     if (max_size < 2 || ((max_size & (max_size - 1)) != 0))
     {
@@ -95,7 +341,7 @@ std::shared_ptr<morpheus::FiberQueue> FiberQueueInterfaceProxy::init(std::size_t
     }
 
     // Create a new shared_ptr
-    return std::make_shared<morpheus::FiberQueue>(max_size);
+    return std::make_shared<morpheus::FiberQueue>(max_size, lock_free);
 }
 
 void FiberQueueInterfaceProxy::put(morpheus::FiberQueue& self, pybind11::object item, bool block, float timeout)
@@ -183,6 +429,101 @@ pybind11::object FiberQueueInterfaceProxy::get(morpheus::FiberQueue& self, bool
     }
 }
 
+void FiberQueueInterfaceProxy::put_all(morpheus::FiberQueue& self, pybind11::list items, bool block, float timeout)
+{
+    std::vector<pybind11::object> object_items;
+    object_items.reserve(items.size());
+
+    for (auto&& item : items)
+    {
+        object_items.emplace_back(pybind11::reinterpret_borrow<pybind11::object>(item));
+    }
+
+    boost::fibers::channel_op_status status;
+
+    // Release the GIL and try to move them
+    {
+        pybind11::gil_scoped_release nogil;
+
+        status = self.put_all(object_items, block, timeout);
+    }
+
+    switch (status)
+    {
+    case boost::fibers::channel_op_status::success:
+        return;
+    case boost::fibers::channel_op_status::empty: {
+        LOG(FATAL) << "FiberQueue::put_all should never return empty.";
+    }
+    case boost::fibers::channel_op_status::full:
+    case boost::fibers::channel_op_status::timeout: {
+        // Raise queue.Full
+        pybind11::object exc_class = pybind11::module_::import("queue").attr("Full");
+
+        PyErr_SetNone(exc_class.ptr());
+
+        throw pybind11::error_already_set();
+    }
+    case boost::fibers::channel_op_status::closed: {
+        pybind11::object exc_class = pybind11::module_::import("morpheus.utils.producer_consumer_queue").attr("Closed");
+
+        PyErr_SetNone(exc_class.ptr());
+
+        throw pybind11::error_already_set();
+    }
+    }
+}
+
+pybind11::list FiberQueueInterfaceProxy::get_all(morpheus::FiberQueue& self,
+                                                 std::size_t max_n,
+                                                 bool block,
+                                                 float timeout)
+{
+    boost::fibers::channel_op_status status;
+
+    std::vector<pybind11::object> items;
+
+    // Release the GIL and try to move them
+    {
+        pybind11::gil_scoped_release nogil;
+
+        status = self.get_all(items, max_n, block, timeout);
+    }
+
+    switch (status)
+    {
+    case boost::fibers::channel_op_status::success: {
+        pybind11::list result;
+
+        for (auto& item : items)
+        {
+            result.append(std::move(item));
+        }
+
+        return result;
+    }
+    case boost::fibers::channel_op_status::empty:
+    case boost::fibers::channel_op_status::full:
+    case boost::fibers::channel_op_status::timeout: {
+        // Raise queue.Empty
+        pybind11::object exc_class = pybind11::module_::import("queue").attr("Empty");
+
+        PyErr_SetNone(exc_class.ptr());
+
+        throw pybind11::error_already_set();
+    }
+    case boost::fibers::channel_op_status::closed: {
+        pybind11::object exc_class = pybind11::module_::import("morpheus.utils.producer_consumer_queue").attr("Closed");
+
+        PyErr_SetNone(exc_class.ptr());
+
+        throw pybind11::error_already_set();
+    }
+    default:
+        throw std::runtime_error("Unknown channel status");
+    }
+}
+
 void FiberQueueInterfaceProxy::close(morpheus::FiberQueue& self)
 {
     self.close();
@@ -29,6 +29,12 @@ FileTypes determine_file_type(const std::string& filename)
 {
     auto filename_path = std::filesystem::path(filename);
 
+    if (filename_path.extension() == ".zst")
+    {
+        // Compressed output ('data.jsonlines.zst'), the content type comes from the inner extension
+        return determine_file_type(filename_path.stem().string());
+    }
+
     if (filename_path.extension() == ".json" || filename_path.extension() == ".jsonlines")
     {
         return FileTypes::JSON;
@@ -41,11 +47,17 @@ FileTypes determine_file_type(const std::string& filename)
     {
         return FileTypes::PARQUET;
     }
+    else if (filename_path.extension() == ".arrow" || filename_path.extension() == ".feather" ||
+             filename_path.extension() == ".ipc")
+    {
+        return FileTypes::ARROW;
+    }
     else
     {
-        throw std::runtime_error(MORPHEUS_CONCAT_STR("Unsupported extension '"
-                                                     << filename_path.extension()
-                                                     << "' with 'auto' type. 'auto' only works with: csv, json"));
+        throw std::runtime_error(
+            MORPHEUS_CONCAT_STR("Unsupported extension '"
+                                << filename_path.extension()
+                                << "' with 'auto' type. 'auto' only works with: csv, json, parquet, arrow"));
     }
 }
 
@@ -17,13 +17,22 @@
 
 #include "morpheus/objects/memory_descriptor.hpp"
 
+#include <cuda_runtime.h>       // for cudaGetDevice
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>  // for get_current_device_resource
 
 #include <utility>  // for move
 
 MemoryDescriptor::MemoryDescriptor(rmm::cuda_stream_view stream,
-                                   cuda::mr::async_resource_ref<cuda::mr::device_accessible> mem_resource) :
+                                   cuda::mr::async_resource_ref<cuda::mr::device_accessible> mem_resource,
+                                   int device_id) :
   cuda_stream(std::move(stream)),
-  memory_resource(mem_resource)
-{}
+  memory_resource(mem_resource),
+  device_id(device_id)
+{
+    if (this->device_id < 0)
+    {
+        MRC_CHECK_CUDA(cudaGetDevice(&this->device_id));
+    }
+}
@@ -45,9 +45,19 @@ PyDataTable::~PyDataTable()
 
 cudf::size_type PyDataTable::count() const
 {
+    // Callers like MultiMessage slice validation hit this several times per slice; pay the GIL round trip once
+    auto cached = m_count.load(std::memory_order_relaxed);
+    if (cached >= 0)
+    {
+        return cached;
+    }
+
     pybind11::gil_scoped_acquire gil;
 
-    return m_py_table.attr("shape").attr("__getitem__")(0).cast<cudf::size_type>();
+    auto computed = m_py_table.attr("shape").attr("__getitem__")(0).cast<cudf::size_type>();
+    m_count.store(computed, std::memory_order_relaxed);
+
+    return computed;
 }
 
 const pybind11::object& PyDataTable::get_py_object() const
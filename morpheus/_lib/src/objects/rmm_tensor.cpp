@@ -23,7 +23,7 @@
 #include "morpheus/utilities/matx_util.hpp"
 #include "morpheus/utilities/tensor_util.hpp"  // for get_elem_count & get_element_stride
 
-#include <cuda_runtime.h>            // for cudaMemcpy, cudaMemcpy2D, cudaMemcpyDeviceToDevice
+#include <cuda_runtime.h>            // for cudaMemcpyAsync, cudaMemcpy2DAsync, cudaStreamSynchronize
 #include <glog/logging.h>            // for DCHECK_LT, COMPACT_GOOGLE_LOG_FATAL, DCHECK, DCHECK_EQ, LogMessageFatal
 #include <mrc/cuda/common.hpp>       // for MRC_CHECK_CUDA
 #include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
@@ -35,7 +35,7 @@
 #include <memory>
 #include <numeric>  // for transform_reduce
 #include <ostream>  // needed for logging
-#include <utility>  // for move, pair
+#include <utility>  // for move, pair, swap
 #include <vector>
 
 namespace morpheus {
@@ -153,7 +153,26 @@ std::shared_ptr<ITensor> RMMTensor::slice(const ShapeType& min_dims, const Shape
 
 std::shared_ptr<ITensor> RMMTensor::reshape(const ShapeType& dims) const
 {
-    return std::make_shared<RMMTensor>(m_md, 0, m_dtype, dims, m_stride);
+    DCHECK_EQ(TensorUtils::get_elem_count(dims), this->count()) << "Reshape must preserve the element count";
+    DCHECK(is_compact()) << "Reshape of a non-compact tensor is not expressible as a view, deep_copy first";
+
+    // Zero-copy: an empty stride lets the constructor derive the contiguous stride for the new dims
+    return std::make_shared<RMMTensor>(m_md, m_offset, m_dtype, dims, ShapeType{});
+}
+
+std::shared_ptr<ITensor> RMMTensor::swap_axes(TensorIndex axis1, TensorIndex axis2) const
+{
+    DCHECK_LT(axis1, rank());
+    DCHECK_LT(axis2, rank());
+
+    // Pure stride manipulation, the data is never touched. Consumers that take a stride read through the
+    // swapped layout in place
+    auto shape  = m_shape;
+    auto stride = m_stride;
+    std::swap(shape[axis1], shape[axis2]);
+    std::swap(stride[axis1], stride[axis2]);
+
+    return std::make_shared<RMMTensor>(m_md, m_offset, m_dtype, std::move(shape), std::move(stride));
 }
 
 std::shared_ptr<ITensor> RMMTensor::deep_copy() const
@@ -188,11 +207,42 @@ std::shared_ptr<ITensor> RMMTensor::copy_rows(const std::vector<RangeType>& sele
     const auto stride      = TensorUtils::get_element_stride(m_stride);
     const auto row_stride  = stride[0];
 
+    if (this->is_compact())
+    {
+        // Expand the ranges into one gather map and copy all rows in a single kernel, instead of a device copy
+        // per range
+        std::vector<TensorIndex> row_indices;
+        row_indices.reserve(num_rows);
+
+        for (const auto& rows : selected_rows)
+        {
+            for (TensorIndex row = rows.first; row < rows.second; ++row)
+            {
+                row_indices.push_back(row);
+            }
+        }
+
+        auto indices_buffer = std::make_shared<rmm::device_buffer>(num_rows * sizeof(TensorIndex), m_md->stream());
+        MRC_CHECK_CUDA(
+            cudaMemcpy(indices_buffer->data(), row_indices.data(), indices_buffer->size(), cudaMemcpyHostToDevice));
+
+        auto output_buffer = MatxUtil::gather_rows_async(
+            DevMemInfo{m_md, tensor_type, {shape(0), num_columns}, m_stride, this->offset_bytes()},
+            DevMemInfo{indices_buffer, DType::create<TensorIndex>(), {num_rows}, {1}});
+
+        // Callers expect the copy to be complete on return, matching the synchronous per-range copies below
+        MRC_CHECK_CUDA(cudaStreamSynchronize(output_buffer->stream().value()));
+
+        return std::make_shared<RMMTensor>(output_buffer, 0, tensor_type, ShapeType{num_rows, num_columns});
+    }
+
     auto output_buffer =
         std::make_shared<rmm::device_buffer>(num_rows * num_columns * item_size, rmm::cuda_stream_per_thread);
 
-    auto output_offset = static_cast<uint8_t*>(output_buffer->data());
+    auto output_offset    = static_cast<uint8_t*>(output_buffer->data());
+    const auto out_stream = output_buffer->stream().value();
 
+    // Enqueue every range's copy on one stream and synchronize once, instead of a blocking copy per range
     for (const auto& rows : selected_rows)
     {
         const auto& sliced_input_tensor  = slice({rows.first, 0}, {rows.second, num_columns});
@@ -203,24 +253,27 @@ std::shared_ptr<ITensor> RMMTensor::copy_rows(const std::vector<RangeType>& sele
 
         if (row_stride == 1)
         {
-            // column major just use cudaMemcpy
-            MRC_CHECK_CUDA(
-                cudaMemcpy(output_offset, sliced_input_tensor->data(), slice_size, cudaMemcpyDeviceToDevice));
+            // column major just use a flat copy
+            MRC_CHECK_CUDA(cudaMemcpyAsync(
+                output_offset, sliced_input_tensor->data(), slice_size, cudaMemcpyDeviceToDevice, out_stream));
         }
         else
         {
-            MRC_CHECK_CUDA(cudaMemcpy2D(output_offset,
-                                        item_size,
-                                        sliced_input_tensor->data(),
-                                        row_stride * item_size,
-                                        item_size,
-                                        num_input_rows,
-                                        cudaMemcpyDeviceToDevice));
+            MRC_CHECK_CUDA(cudaMemcpy2DAsync(output_offset,
+                                             item_size,
+                                             sliced_input_tensor->data(),
+                                             row_stride * item_size,
+                                             item_size,
+                                             num_input_rows,
+                                             cudaMemcpyDeviceToDevice,
+                                             out_stream));
         }
 
         output_offset += slice_size;
     }
 
+    MRC_CHECK_CUDA(cudaStreamSynchronize(out_stream));
+
     ShapeType output_shape{num_rows, num_columns};
     return std::make_shared<RMMTensor>(output_buffer, 0, tensor_type, output_shape);
 }
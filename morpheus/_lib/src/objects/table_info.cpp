@@ -18,11 +18,18 @@
 #include "morpheus/objects/table_info.hpp"
 
 #include "morpheus/objects/dtype.hpp"
+#include "morpheus/utilities/tensor_util.hpp"  // for TensorUtils::copy_to_column
 
+#include <cuda_runtime.h>                    // for cudaMemset
+#include <cudf/column/column.hpp>            // for column
+#include <cudf/column/column_factories.hpp>  // for make_fixed_width_column
 #include <cudf/copying.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>           // for is_fixed_width
+#include <cudf/utilities/type_dispatcher.hpp>  // for size_of
 #include <glog/logging.h>
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
 #include <pybind11/gil.h>       // for gil_scoped_acquire
 #include <pybind11/pybind11.h>  // IWYU pragma: keep
 #include <pybind11/pytypes.h>
@@ -32,9 +39,9 @@
 #include <cstddef>    // for size_t
 #include <iterator>   // for back_insert_iterator, back_inserter
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
-#include <shared_mutex>
 #include <stdexcept>
 #include <utility>
 // IWYU pragma: no_include <pybind11/cast.h>
@@ -188,8 +195,36 @@ const TableInfoData& TableInfoBase::get_data() const
     return m_data;
 }
 
+ColumnHandle TableInfoBase::resolve_column_handle(const std::string& name) const
+{
+    const auto& column_names = m_data.column_names;
+
+    auto found_col = std::find(column_names.begin(), column_names.end(), name);
+
+    if (found_col == column_names.end())
+    {
+        throw py::key_error("Unknown column: " + name);
+    }
+
+    auto idx = static_cast<cudf::size_type>(found_col - column_names.begin());
+
+    return {name, idx, this->get_column(idx).type().id(), m_parent->schema_version()};
+}
+
+bool TableInfoBase::is_current(const ColumnHandle& handle) const
+{
+    return handle.index >= 0 && handle.schema_version == m_parent->schema_version();
+}
+
 bool TableInfoBase::has_sliceable_index() const
 {
+    // Tables carrying an implicit [0, count) range index are sliceable by construction. Answering here avoids
+    // acquiring the GIL (and converting C++ backed tables to python) just to look at a RangeIndex
+    if (m_parent->has_implicit_range_index())
+    {
+        return true;
+    }
+
     py::gil_scoped_acquire gil;
     auto df    = m_parent->get_py_object();
     auto index = df.attr("index");
@@ -203,22 +238,49 @@ bool TableInfoBase::has_sliceable_index() const
 }
 
 TableInfo::TableInfo(std::shared_ptr<const IDataTable> parent,
-                     std::shared_lock<std::shared_mutex> lock,
+                     std::shared_ptr<const TableInfoData> snapshot,
                      TableInfoData data) :
   TableInfoBase(parent, std::move(data)),
-  m_lock(std::move(lock))
+  m_snapshot(std::move(snapshot))
 {}
 
 TableInfo TableInfo::get_slice(cudf::size_type start, cudf::size_type stop, std::vector<std::string> column_names) const
 {
-    // Create a new Table info, (cloning the shared_lock)
+    // Create a new Table info, (sharing the snapshot)
+    return {this->get_parent(), m_snapshot, get_table_info_data_slice(this->get_data(), start, stop, column_names)};
+}
+
+TableInfo TableInfo::get_column_slice(const ColumnHandle& handle, cudf::size_type start, cudf::size_type stop) const
+{
+    const auto& data = this->get_data();
+
+    // Select the index columns plus the target column by position, skipping the name search in `get_slice`
+    std::vector<cudf::size_type> col_indices;
+    col_indices.reserve(data.index_names.size() + 1);
+
+    for (cudf::size_type i = 0; i < data.index_names.size(); ++i)
+    {
+        col_indices.push_back(i);
+    }
+
+    col_indices.push_back(handle.index + data.index_names.size());
+
+    auto table_view_out = data.table_view.select(col_indices);
+
+    // If the start/stop is different, then perform the slice
+    if (start != 0 || stop != data.table_view.num_rows())
+    {
+        table_view_out = cudf::slice(table_view_out, {start, stop})[0];
+    }
+
+    // Create a new Table info, (sharing the snapshot)
     return {this->get_parent(),
-            std::shared_lock<std::shared_mutex>(*m_lock.mutex()),
-            get_table_info_data_slice(this->get_data(), start, stop, column_names)};
+            m_snapshot,
+            TableInfoData{table_view_out, data.index_names, {handle.name}, {handle.index}}};
 }
 
 MutableTableInfo::MutableTableInfo(std::shared_ptr<const IDataTable> parent,
-                                   std::unique_lock<std::shared_mutex> lock,
+                                   std::unique_lock<std::mutex> lock,
                                    TableInfoData data) :
   TableInfoBase(parent, std::move(data)),
   m_lock(std::move(lock))
@@ -243,21 +305,59 @@ MutableTableInfo MutableTableInfo::get_slice(cudf::size_type start,
 
 void MutableTableInfo::insert_columns(const std::vector<std::tuple<std::string, morpheus::DType>>& columns)
 {
-    const auto num_existing_cols = this->get_data().column_names.size();
-    const auto num_rows          = this->get_data().table_view.num_rows();
+    // Fixed-width columns can be built and attached entirely on the C++ side, without the GIL. The append is a
+    // metadata-only operation on the owning table (`IDataTable::append_columns`), and the Python DataFrame picks the
+    // new columns up whenever it is lazily built. Python-backed tables (and non-fixed-width dtypes) decline the
+    // append and take the assign path below instead.
+    const auto all_fixed_width = std::all_of(columns.begin(), columns.end(), [](const auto& column) {
+        return cudf::is_fixed_width(cudf::data_type{std::get<1>(column).cudf_type_id()});
+    });
+
+    if (all_fixed_width)
+    {
+        const auto num_rows = this->num_rows();
+
+        std::vector<std::pair<std::string, std::unique_ptr<cudf::column>>> built_columns;
+        built_columns.reserve(columns.size());
+
+        for (const auto& column : columns)
+        {
+            auto cudf_type  = cudf::data_type{std::get<1>(column).cudf_type_id()};
+            auto new_column = cudf::make_fixed_width_column(cudf_type, num_rows);
+
+            // Zero-fill to match the `cudf.Scalar(0, ...)` semantics of the python path
+            MRC_CHECK_CUDA(cudaMemset(new_column->mutable_view().head(), 0, num_rows * cudf::size_of(cudf_type)));
+
+            built_columns.emplace_back(std::get<0>(column), std::move(new_column));
+        }
+
+        if (this->append_columns(std::move(built_columns)))
+        {
+            return;
+        }
+    }
 
-    // TODO(mdemoret): figure out how to do this without the gil
     {
         py::gil_scoped_acquire gil;
         py::object cudf_scalar = py::module_::import("cudf").attr("Scalar");
 
         auto table = this->get_parent()->get_py_object();
 
-        for (std::size_t i = 0; i < columns.size(); ++i)
+        // Append all of the columns in a single assign call rather than one DataFrame.insert per column. The
+        // assign result shares the existing column buffers, so swapping its column map into the table makes the
+        // append visible in place with a constant number of table rebuilds regardless of the column count.
+        py::dict new_columns;
+        for (const auto& column : columns)
+        {
+            new_columns[py::str(std::get<0>(column))] = cudf_scalar(0, std::get<1>(column).type_str());
+        }
+
+        auto appended       = table.attr("assign")(**new_columns);
+        table.attr("_data") = appended.attr("_data");
+
+        for (const auto& column : columns)
         {
-            auto scalar = cudf_scalar(0, std::get<1>(columns[i]).type_str());
-            table.attr("insert")(num_existing_cols + i, std::get<0>(columns[i]), scalar);
-            this->get_data().column_names.push_back(std::get<0>(columns[i]));
+            this->get_data().column_names.push_back(std::get<0>(column));
         }
     }
 }
@@ -281,6 +381,49 @@ void MutableTableInfo::insert_missing_columns(const std::vector<std::tuple<std::
     }
 }
 
+bool MutableTableInfo::append_columns(std::vector<std::pair<std::string, std::unique_ptr<cudf::column>>>&& columns)
+{
+    std::vector<std::string> names;
+    names.reserve(columns.size());
+
+    for (const auto& column : columns)
+    {
+        names.push_back(column.first);
+    }
+
+    if (!this->get_parent()->append_columns(std::move(columns)))
+    {
+        return false;
+    }
+
+    for (auto& name : names)
+    {
+        this->get_data().column_names.push_back(std::move(name));
+    }
+
+    return true;
+}
+
+void MutableTableInfo::update_columns(const std::vector<std::pair<std::string, TensorObject>>& updates)
+{
+    const auto& column_names = this->get_data().column_names;
+
+    for (const auto& [column_name, tensor] : updates)
+    {
+        auto found_col = std::find(column_names.begin(), column_names.end(), column_name);
+
+        if (found_col == column_names.end())
+        {
+            throw std::runtime_error("Cannot update unknown column '" + column_name +
+                                     "'. Use insert_missing_columns() to add it first.");
+        }
+
+        auto idx = static_cast<cudf::size_type>(found_col - column_names.begin());
+
+        TensorUtils::copy_to_column(this->get_column(idx), tensor);
+    }
+}
+
 py::object MutableTableInfo::checkout_obj()
 {
     // Get a copy increasing the ref count
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/objects/tensor_object.hpp"
+
+#include "morpheus/types.hpp"  // for TensorSize
+
+#include <cuda_runtime.h>       // for cudaMemcpyAsync
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t
+#include <vector>
+
+namespace {
+
+using namespace morpheus;
+
+/**
+ * One work item per requested element, copying `item_size` bytes from its offset into the compacted output.
+ * Elements are at most a few bytes, so the byte-wise copy is free next to the launch itself.
+ */
+struct GatherElementsOp
+{
+    const uint8_t* input;
+    const TensorSize* byte_offsets;
+    uint8_t* output;
+    std::size_t item_size;
+
+    __device__ void operator()(std::size_t i) const
+    {
+        const auto* src = input + byte_offsets[i];
+        auto* dst       = output + i * item_size;
+
+        for (std::size_t b = 0; b < item_size; ++b)
+        {
+            dst[b] = src[b];
+        }
+    }
+};
+
+}  // namespace
+
+namespace morpheus::detail {
+
+void gather_elements_to_host(const uint8_t* device_data,
+                             const std::vector<TensorSize>& byte_offsets,
+                             std::size_t item_size,
+                             void* host_out,
+                             rmm::cuda_stream_view stream)
+{
+    const auto count = byte_offsets.size();
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    rmm::device_uvector<TensorSize> offsets_d(count, stream);
+    MRC_CHECK_CUDA(cudaMemcpyAsync(
+        offsets_d.data(), byte_offsets.data(), count * sizeof(TensorSize), cudaMemcpyHostToDevice, stream.value()));
+
+    rmm::device_uvector<uint8_t> gathered(count * item_size, stream);
+
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::counting_iterator<std::size_t>(0),
+                       count,
+                       GatherElementsOp{device_data, offsets_d.data(), gathered.data(), item_size});
+
+    // The scattered reads are compacted on the device, so a single copy brings every requested value across
+    MRC_CHECK_CUDA(
+        cudaMemcpyAsync(host_out, gathered.data(), count * item_size, cudaMemcpyDeviceToHost, stream.value()));
+    MRC_CHECK_CUDA(cudaStreamSynchronize(stream.value()));
+}
+
+}  // namespace morpheus::detail
@@ -23,6 +23,7 @@
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>  // for move
 // IWYU thinks we need __alloc_traits<>::value_type for vector assignments
 // IWYU pragma: no_include <ext/alloc_traits.h>
@@ -31,8 +32,13 @@ namespace morpheus {
 
 // Component public implementations
 // ************ AddClassificationStage **************************** //
-AddClassificationsStage::AddClassificationsStage(std::map<std::size_t, std::string> idx2label, float threshold) :
-  AddScoresStageBase(std::move(idx2label), threshold)
+AddClassificationsStage::AddClassificationsStage(std::map<std::size_t, std::string> idx2label,
+                                                 float threshold,
+                                                 bool softmax,
+                                                 std::string argmax_score_column,
+                                                 std::string argmax_index_column) :
+  AddScoresStageBase(
+      std::move(idx2label), threshold, softmax, std::move(argmax_score_column), std::move(argmax_index_column))
 {}
 
 // ************ AddClassificationStageInterfaceProxy ************* //
@@ -40,9 +46,13 @@ std::shared_ptr<mrc::segment::Object<AddClassificationsStage>> AddClassification
     mrc::segment::Builder& builder,
     const std::string& name,
     std::map<std::size_t, std::string> idx2label,
-    float threshold)
+    float threshold,
+    bool softmax,
+    std::string argmax_score_column,
+    std::string argmax_index_column)
 {
-    return builder.construct_object<AddClassificationsStage>(name, idx2label, threshold);
+    return builder.construct_object<AddClassificationsStage>(
+        name, idx2label, threshold, softmax, std::move(argmax_score_column), std::move(argmax_index_column));
 }
 
 }  // namespace morpheus
@@ -26,6 +26,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>  // for move
 // IWYU thinks we need __alloc_traits<>::value_type for vector assignments
 // IWYU pragma: no_include <ext/alloc_traits.h>
@@ -34,15 +35,25 @@ namespace morpheus {
 
 // Component public implementations
 // ************ AddScoresStage **************************** //
-AddScoresStage::AddScoresStage(std::map<std::size_t, std::string> idx2label) :
-  AddScoresStageBase(std::move(idx2label), std::nullopt)
+AddScoresStage::AddScoresStage(std::map<std::size_t, std::string> idx2label,
+                               bool softmax,
+                               std::string argmax_score_column,
+                               std::string argmax_index_column) :
+  AddScoresStageBase(
+      std::move(idx2label), std::nullopt, softmax, std::move(argmax_score_column), std::move(argmax_index_column))
 {}
 
 // ************ AddScoresStageInterfaceProxy ************* //
 std::shared_ptr<mrc::segment::Object<AddScoresStage>> AddScoresStageInterfaceProxy::init(
-    mrc::segment::Builder& builder, const std::string& name, std::map<std::size_t, std::string> idx2label)
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::map<std::size_t, std::string> idx2label,
+    bool softmax,
+    std::string argmax_score_column,
+    std::string argmax_index_column)
 {
-    return builder.construct_object<AddScoresStage>(name, std::move(idx2label));
+    return builder.construct_object<AddScoresStage>(
+        name, std::move(idx2label), softmax, std::move(argmax_score_column), std::move(argmax_index_column));
 }
 
 }  // namespace morpheus
@@ -25,21 +25,29 @@
 #include "pymrc/node.hpp"
 #include "rxcpp/operators/rx-map.hpp"
 
-#include "morpheus/objects/dtype.hpp"  // for DType
-#include "morpheus/objects/tensor.hpp"
+#include "morpheus/objects/table_info.hpp"     // for TableInfo
+#include "morpheus/objects/tensor.hpp"         // for Tensor::create
 #include "morpheus/objects/tensor_object.hpp"  // for TensorObject
 #include "morpheus/types.hpp"                  // for TensorIndex
 #include "morpheus/utilities/matx_util.hpp"
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
 #include "morpheus/utilities/string_util.hpp"
 #include "morpheus/utilities/tensor_util.hpp"  // for TensorUtils::get_element_stride
 
+#include <cudf/column/column_view.hpp>  // for column_view
+#include <cudf/types.hpp>               // for type_id
 #include <glog/logging.h>
 #include <rxcpp/rx.hpp>
 
 #include <cstddef>
+#include <cstdint>  // for uint8_t
 #include <iterator>
 #include <memory>
 #include <ostream>  // needed for logging
+#include <sstream>  // for ostringstream
+#include <stdexcept>  // for runtime_error
 #include <utility>  // for move
 // IWYU thinks we need __alloc_traits<>::value_type for vector assignments
 // IWYU pragma: no_include <ext/alloc_traits.h>
@@ -49,18 +57,43 @@ namespace morpheus {
 
 // Component public implementations
 // ************ AddClassificationStage **************************** //
-AddScoresStageBase::AddScoresStageBase(std::map<std::size_t, std::string> idx2label, std::optional<float> threshold) :
+AddScoresStageBase::AddScoresStageBase(std::map<std::size_t, std::string> idx2label,
+                                       std::optional<float> threshold,
+                                       bool softmax,
+                                       std::string argmax_score_column,
+                                       std::string argmax_index_column) :
   PythonNode(),
   m_idx2label(std::move(idx2label)),
   m_threshold(threshold),
+  m_softmax(softmax),
+  m_argmax_score_column(std::move(argmax_score_column)),
+  m_argmax_index_column(std::move(argmax_index_column)),
   m_min_col_count(m_idx2label.rbegin()->first)  // Ordered map's largest key will be the last entry
 {
+    CHECK(m_argmax_score_column.empty() == m_argmax_index_column.empty())
+        << "argmax_score_column and argmax_index_column must be set together";
+
     this->pipe(rxcpp::operators::map([this](sink_type_t x) { return this->on_data(std::move(x)); }));
 }
 
 AddScoresStageBase::source_type_t AddScoresStageBase::on_data(sink_type_t x)
 {
-    auto probs        = x->get_probs_tensor();
+    MORPHEUS_NVTX_RANGE("AddScoresStageBase::on_data");
+    MORPHEUS_STAGE_TIMER("AddScoresStageBase");
+    MORPHEUS_STAGE_MEMORY_SCOPE("AddScoresStageBase");
+
+    auto probs = x->get_probs_tensor();
+
+    if (m_softmax)
+    {
+        // Replace the raw logits with row-wise softmax probabilities, fused into a single kernel on the device
+        auto softmax_stride = TensorUtils::get_element_stride(probs.get_stride());
+        auto softmax_buffer = MatxUtil::softmax(
+            {probs.data(), probs.dtype(), probs.get_memory(), probs.get_shape(), softmax_stride});
+
+        probs = Tensor::create(std::move(softmax_buffer), probs.dtype(), probs.get_shape(), softmax_stride);
+    }
+
     const auto& shape = probs.get_shape();
 
     // Depending on the input the stride is given in bytes or elements, convert to elements
@@ -71,39 +104,109 @@ AddScoresStageBase::source_type_t AddScoresStageBase::on_data(sink_type_t x)
            "indexes: "
         << StringUtil::map_to_str(m_idx2label.begin(), m_idx2label.end()) << ", Model output columns: " << shape[1];
 
-    const auto num_rows    = shape[0];
-    const auto num_columns = shape[1];
+    const auto num_rows = shape[0];
 
-    TensorObject output_tensor;
+    if (!m_argmax_score_column.empty())
+    {
+        // Fused row argmax: the winning probability and class index are written straight into the preallocated
+        // columns, replacing two CuPy kernel dispatches and a GIL round trip per batch
+        auto argmax_meta = x->get_meta(std::vector<std::string>{m_argmax_score_column, m_argmax_index_column});
+
+        const auto& score_cv = argmax_meta.get_column(0);
+        const auto& index_cv = argmax_meta.get_column(1);
+
+        CHECK(score_cv.type().id() == probs.dtype().cudf_type_id())
+            << "Argmax score column '" << m_argmax_score_column
+            << "' must be preallocated with the same type as the probabilities tensor";
+        CHECK(index_cv.type().id() == cudf::type_id::INT64)
+            << "Argmax index column '" << m_argmax_index_column << "' must be preallocated as an int64 column";
+        CHECK(score_cv.size() == num_rows && index_cv.size() == num_rows);
+
+        auto* score_data =
+            const_cast<uint8_t*>(score_cv.head<uint8_t>()) + score_cv.offset() * probs.dtype().item_size();
+
+        MatxUtil::row_argmax({probs.data(), probs.dtype(), probs.get_memory(), shape, stride},
+                             score_data,
+                             const_cast<int64_t*>(index_cv.head<int64_t>()) + index_cv.offset());
+    }
 
-    if (m_threshold.has_value())
+    std::vector<std::string> columns;
+    columns.reserve(m_idx2label.size());
+    for (const auto& [column_num, column_name] : m_idx2label)
     {
-        auto thresh_bool_buffer = MatxUtil::threshold(
-            {probs.data(), probs.dtype(), probs.get_memory(), probs.get_shape(), probs.get_stride()},
-            *m_threshold,
-            false);
+        columns.push_back(column_name);
+    }
 
-        output_tensor.swap(Tensor::create(thresh_bool_buffer, DType::create<bool>(), shape, stride));
+    // Both paths checkout the label columns once and write straight into them on the device, skipping the
+    // per-column strided copies of the set_meta path
+    TableInfo table_meta;
+    try
+    {
+        table_meta = x->get_meta(columns);
+    } catch (const std::runtime_error& e)
+    {
+        std::ostringstream err_msg;
+        err_msg << e.what() << " Ensure that the stage that needs this column has populated the '_needed_columns' "
+                << "attribute and that at least one stage in the current segment is using the PreallocatorMixin to "
+                << "ensure all needed columns have been allocated.";
+        throw std::runtime_error(err_msg.str());
     }
-    else
+
+    if (m_threshold.has_value())
     {
-        output_tensor.swap(std::move(probs));
+        // Fused threshold-and-scatter also saves the intermediate full-width bool tensor
+        std::vector<TensorIndex> col_indices;
+        std::vector<void*> output_columns;
+        col_indices.reserve(m_idx2label.size());
+        output_columns.reserve(m_idx2label.size());
+
+        std::size_t i = 0;
+        for (const auto& [column_num, column_name] : m_idx2label)
+        {
+            const auto& cv = table_meta.get_column(i);
+            CHECK(cv.type().id() == cudf::type_id::BOOL8)
+                << "Classification column '" << column_name << "' must be preallocated as a bool column";
+            CHECK(cv.size() == num_rows);
+
+            col_indices.push_back(static_cast<TensorIndex>(column_num));
+            output_columns.push_back(const_cast<uint8_t*>(cv.head<uint8_t>()) + cv.offset());
+
+            ++i;
+        }
+
+        MatxUtil::threshold_scatter({probs.data(), probs.dtype(), probs.get_memory(), shape, stride},
+                                    *m_threshold,
+                                    col_indices,
+                                    output_columns);
+
+        return x;
     }
 
-    std::vector<std::string> columns;
-    std::vector<TensorObject> tensors;
+    // Score path: scatter the selected probability columns into the dataframe with one kernel launch instead
+    // of one device-to-device copy per label
+    std::vector<TensorIndex> col_indices;
+    std::vector<void*> output_columns;
+    col_indices.reserve(m_idx2label.size());
+    output_columns.reserve(m_idx2label.size());
 
     std::size_t i = 0;
     for (const auto& [column_num, column_name] : m_idx2label)
     {
-        columns.push_back(column_name);
-        tensors.emplace_back(output_tensor.slice({0, static_cast<TensorIndex>(column_num)},
-                                                 {num_rows, static_cast<TensorIndex>(column_num + 1)}));
+        const auto& cv = table_meta.get_column(i);
+        CHECK(cv.type().id() == probs.dtype().cudf_type_id())
+            << "Score column '" << column_name
+            << "' must be preallocated with the same type as the probabilities tensor";
+        CHECK(cv.size() == num_rows);
+
+        col_indices.push_back(static_cast<TensorIndex>(column_num));
+        output_columns.push_back(const_cast<uint8_t*>(cv.head<uint8_t>()) + cv.offset() * probs.dtype().item_size());
 
         ++i;
     }
 
-    x->set_meta(columns, tensors);
+    MatxUtil::scatter_columns({probs.data(), probs.dtype(), probs.get_memory(), shape, stride},
+                              col_indices,
+                              output_columns);
 
     return x;
 }
@@ -0,0 +1,188 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/dedupe.hpp"
+
+#include "mrc/segment/builder.hpp"
+#include "mrc/segment/object.hpp"
+#include "pymrc/node.hpp"
+
+#include "morpheus/objects/table_info.hpp"          // for TableInfo
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
+
+#include <cudf/column/column_view.hpp>         // for column_view
+#include <cudf/concatenate.hpp>                // for concatenate
+#include <cudf/copying.hpp>                    // for gather & slice
+#include <cudf/io/types.hpp>                   // for table_metadata
+#include <cudf/join.hpp>                       // for left_anti_join
+#include <cudf/stream_compaction.hpp>          // for stable_distinct
+#include <cudf/table/table_view.hpp>           // for table_view
+#include <cudf/types.hpp>                      // for size_type
+#include <cudf/utilities/default_stream.hpp>   // for get_default_stream
+#include <glog/logging.h>                      // for CHECK
+#include <rmm/exec_policy.hpp>                 // for exec_policy
+#include <thrust/sort.h>                       // for sort
+
+#include <algorithm>  // for find
+#include <exception>
+#include <memory>
+#include <utility>  // for move
+
+namespace morpheus {
+
+// Component public implementations
+// ************ DedupeStage **************************** //
+DedupeStage::DedupeStage(std::vector<std::string> key_columns, std::size_t window_size) :
+  PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
+  m_key_columns(std::move(key_columns)),
+  m_window_size(window_size)
+{
+    CHECK(!m_key_columns.empty()) << "DedupeStage requires at least one key column";
+}
+
+std::shared_ptr<MessageMeta> DedupeStage::on_data(sink_type_t msg)
+{
+    MORPHEUS_NVTX_RANGE("DedupeStage::on_data");
+    MORPHEUS_STAGE_TIMER("DedupeStage");
+    MORPHEUS_STAGE_MEMORY_SCOPE("DedupeStage");
+
+    auto table_info   = msg->get_info();
+    auto table_view   = table_info.get_view();
+    auto index_names  = table_info.get_index_names();
+    auto column_names = table_info.get_column_names();
+
+    // The view places the index columns ahead of the data columns
+    std::vector<cudf::size_type> key_indices;
+    key_indices.reserve(m_key_columns.size());
+
+    for (const auto& key : m_key_columns)
+    {
+        auto found = std::find(column_names.begin(), column_names.end(), key);
+        CHECK(found != column_names.end()) << "Dedupe key column '" << key << "' not found in the dataframe";
+
+        key_indices.push_back(static_cast<cudf::size_type>(index_names.size() + (found - column_names.begin())));
+    }
+
+    // Within-batch pass, keeping the first occurrence of each key in row order
+    auto deduped = cudf::stable_distinct(table_view, key_indices, cudf::duplicate_keep_option::KEEP_FIRST);
+
+    if (m_window_size > 0)
+    {
+        auto key_view = deduped->view().select(key_indices);
+
+        if (m_seen_keys)
+        {
+            // Rows whose keys match the rolling window are duplicates from earlier batches. The anti-join is the
+            // device hash-set probe, handing back the row indices which survive.
+            auto novel = cudf::left_anti_join(key_view, m_seen_keys->view());
+
+            if (static_cast<cudf::size_type>(novel->size()) < deduped->num_rows())
+            {
+                // The join does not guarantee ordering, sort the gather map to preserve arrival order
+                thrust::sort(rmm::exec_policy(cudf::get_default_stream()), novel->begin(), novel->end());
+
+                cudf::column_view gather_map{cudf::data_type{cudf::type_to_id<cudf::size_type>()},
+                                             static_cast<cudf::size_type>(novel->size()),
+                                             novel->data(),
+                                             nullptr,
+                                             0};
+
+                deduped  = cudf::gather(deduped->view(), gather_map);
+                key_view = deduped->view().select(key_indices);
+            }
+        }
+
+        if (!m_seen_keys)
+        {
+            m_seen_keys = std::make_unique<cudf::table>(key_view);
+        }
+        else
+        {
+            auto combined = cudf::concatenate(std::vector<cudf::table_view>{key_view, m_seen_keys->view()});
+
+            if (static_cast<std::size_t>(combined->num_rows()) > m_window_size)
+            {
+                auto trimmed = cudf::slice(combined->view(), {0, static_cast<cudf::size_type>(m_window_size)});
+                m_seen_keys  = std::make_unique<cudf::table>(trimmed.front());
+            }
+            else
+            {
+                m_seen_keys = std::move(combined);
+            }
+        }
+    }
+
+    if (deduped->num_rows() == 0)
+    {
+        return nullptr;
+    }
+
+    // No duplicates found, forward the incoming message and let the copy made by stable_distinct go
+    if (deduped->num_rows() == table_view.num_rows())
+    {
+        return msg;
+    }
+
+    auto metadata = cudf::io::table_metadata{};
+    metadata.schema_info.reserve(index_names.size() + column_names.size());
+
+    for (const auto& name : index_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    for (const auto& name : column_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    return MessageMeta::create_from_cpp({std::move(deduped), std::move(metadata)},
+                                        static_cast<int>(index_names.size()));
+}
+
+DedupeStage::subscribe_fn_t DedupeStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t msg) {
+                auto deduped = this->on_data(std::move(msg));
+
+                // Batches which dedupe down to nothing are suppressed
+                if (deduped)
+                {
+                    output.on_next(std::move(deduped));
+                }
+            },
+            [&](std::exception_ptr error_ptr) { output.on_error(error_ptr); },
+            [&]() { output.on_completed(); }));
+    };
+}
+
+// ************ DedupeStageInterfaceProxy ************* //
+std::shared_ptr<mrc::segment::Object<DedupeStage>> DedupeStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::vector<std::string> key_columns,
+    std::size_t window_size)
+{
+    auto stage = builder.construct_object<DedupeStage>(name, std::move(key_columns), window_size);
+
+    return stage;
+}
+}  // namespace morpheus
@@ -29,10 +29,10 @@ namespace morpheus {
 void make_output_message(std::shared_ptr<MessageMeta>& incoming_message,
                          TensorIndex start,
                          TensorIndex stop,
-                         cm_task_t* task,
+                         ControlMessage* task_template,
                          std::shared_ptr<MultiMessage>& windowed_message)
 {
-    DCHECK_EQ(task, nullptr) << "Task is not supported for MultiMessage";
+    DCHECK_EQ(task_template, nullptr) << "Task is not supported for MultiMessage";
     auto sliced_msg = std::make_shared<MultiMessage>(incoming_message, start, stop - start);
     windowed_message.swap(sliced_msg);
 }
@@ -40,16 +40,16 @@ void make_output_message(std::shared_ptr<MessageMeta>& incoming_message,
 void make_output_message(std::shared_ptr<MessageMeta>& incoming_message,
                          TensorIndex start,
                          TensorIndex stop,
-                         cm_task_t* task,
+                         ControlMessage* task_template,
                          std::shared_ptr<ControlMessage>& windowed_message)
 {
     auto slidced_meta = std::make_shared<SlicedMessageMeta>(incoming_message, start, stop);
-    auto message      = std::make_shared<ControlMessage>();
-    message->payload(slidced_meta);
-    if (task)
-    {
-        message->add_task(task->first, task->second);
-    }
+
+    // Cloning the precompiled template attaches the task definition by shared reference; the copied message
+    // only materializes its own copy if a downstream stage mutates the task set
+    auto message = task_template ? std::make_shared<ControlMessage>(*task_template)
+                                 : std::make_shared<ControlMessage>();
+    message->payload(std::move(slidced_meta));
 
     windowed_message.swap(message);
 }
@@ -0,0 +1,339 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/directory_source.hpp"
+
+#include "mrc/node/rx_sink_base.hpp"
+#include "mrc/node/rx_source_base.hpp"
+#include "mrc/node/source_properties.hpp"
+#include "mrc/segment/object.hpp"
+#include "mrc/types.hpp"
+#include "pymrc/node.hpp"
+
+#include "morpheus/io/deserializers.hpp"  // for load_table_from_file & prepare_df_index
+
+#include <boost/fiber/operations.hpp>  // for sleep_for
+#include <glog/logging.h>
+#include <mrc/segment/builder.hpp>
+
+#include <sys/inotify.h>  // for inotify_init1, inotify_add_watch
+#include <unistd.h>       // for read & close
+
+#include <algorithm>  // for sort
+#include <array>      // for array
+#include <cerrno>     // for errno
+#include <chrono>     // for milliseconds
+#include <cstring>    // for strerror
+#include <exception>
+#include <filesystem>  // for directory_iterator & remove
+#include <memory>
+#include <stdexcept>     // for runtime_error
+#include <system_error>  // for error_code
+#include <utility>       // for move, pair
+
+namespace morpheus {
+// Component public implementations
+// ************ DirectorySourceStage ************* //
+DirectorySourceStage::DirectorySourceStage(std::string directory,
+                                           std::size_t num_threads,
+                                           std::size_t queue_size,
+                                           bool process_existing,
+                                           bool delete_files,
+                                           std::size_t stop_after,
+                                           FileTypes file_type,
+                                           std::vector<std::string> columns,
+                                           TableSchema schema) :
+  PythonSource(build()),
+  m_directory(std::move(directory)),
+  m_num_threads(num_threads),
+  m_queue_size(queue_size),
+  m_process_existing(process_existing),
+  m_delete_files(delete_files),
+  m_stop_after(stop_after),
+  m_file_type(file_type),
+  m_columns(std::move(columns)),
+  m_schema(std::move(schema))
+{
+    CHECK(m_num_threads > 0) << "DirectorySourceStage requires at least one loader thread";
+    CHECK(m_queue_size > 0) << "DirectorySourceStage requires a queue size of at least one";
+}
+
+bool DirectorySourceStage::accepts_file(const std::string& filename) const
+{
+    // Hidden files and in-progress temporaries (collectors write dot-files then rename into place)
+    if (filename.empty() || filename.front() == '.')
+    {
+        return false;
+    }
+
+    if (m_file_type != FileTypes::Auto)
+    {
+        return true;
+    }
+
+    try
+    {
+        determine_file_type(filename);
+    } catch (const std::runtime_error&)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void DirectorySourceStage::worker_loop()
+{
+    while (true)
+    {
+        std::pair<std::size_t, std::string> task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_task_cv.wait(lock, [this]() {
+                return m_stop || !m_pending.empty();
+            });
+
+            if (m_pending.empty())
+            {
+                return;  // Stopping
+            }
+
+            task = std::move(m_pending.front());
+            m_pending.pop_front();
+        }
+
+        LoadResult result;
+        result.path = task.second;
+
+        try
+        {
+            result.table = load_table_from_file(task.second, m_file_type, std::nullopt, m_columns, m_schema);
+        } catch (const std::exception& e)
+        {
+            // The sequence number is skipped and the file left in place for inspection
+            LOG(ERROR) << "Failed to load '" << task.second << "': " << e.what();
+        }
+
+        {
+            // Bounded buffer: block while full, unless the emitter is waiting on exactly this file, which must
+            // always be admitted to keep the in-order emission moving
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_result_cv.wait(lock, [this, &task]() {
+                return m_stop || m_results.size() < m_queue_size || task.first == m_emit_seq;
+            });
+
+            if (m_stop)
+            {
+                return;
+            }
+
+            m_results.emplace(task.first, std::move(result));
+        }
+    }
+}
+
+DirectorySourceStage::subscriber_fn_t DirectorySourceStage::build()
+{
+    return [this](rxcpp::subscriber<source_type_t> output) {
+        int inotify_fd = inotify_init1(IN_NONBLOCK);
+        if (inotify_fd < 0)
+        {
+            throw std::runtime_error(std::string("Failed to initialize inotify: ") + std::strerror(errno));
+        }
+
+        // CLOSE_WRITE catches collectors which write in place, MOVED_TO catches write-then-rename spooling
+        if (inotify_add_watch(inotify_fd, m_directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+        {
+            auto error = errno;
+            close(inotify_fd);
+            throw std::runtime_error("Failed to watch directory '" + m_directory + "': " + std::strerror(error));
+        }
+
+        if (m_process_existing)
+        {
+            // The backlog present at startup is emitted first, in lexical order for determinism
+            std::vector<std::string> existing;
+
+            for (const auto& entry : std::filesystem::directory_iterator(m_directory))
+            {
+                if (entry.is_regular_file() && accepts_file(entry.path().filename().string()))
+                {
+                    existing.push_back(entry.path().string());
+                }
+            }
+
+            std::sort(existing.begin(), existing.end());
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& path : existing)
+            {
+                m_pending.emplace_back(m_next_seq++, std::move(path));
+            }
+        }
+
+        m_stop = false;
+        m_workers.reserve(m_num_threads);
+
+        for (std::size_t i = 0; i < m_num_threads; ++i)
+        {
+            m_workers.emplace_back([this]() {
+                worker_loop();
+            });
+        }
+
+        m_task_cv.notify_all();
+
+        std::size_t emitted = 0;
+        alignas(inotify_event) std::array<char, 4096> event_buffer;
+
+        while (output.is_subscribed() && (m_stop_after == 0 || emitted < m_stop_after))
+        {
+            // Drain the inotify queue, handing completed files to the loaders in arrival order
+            ssize_t len = 0;
+            while ((len = read(inotify_fd, event_buffer.data(), event_buffer.size())) > 0)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                std::size_t offset = 0;
+                while (offset < static_cast<std::size_t>(len))
+                {
+                    const auto* event = reinterpret_cast<const inotify_event*>(event_buffer.data() + offset);
+
+                    if (event->len > 0 && accepts_file(event->name))
+                    {
+                        m_pending.emplace_back(m_next_seq++, m_directory + "/" + event->name);
+                    }
+
+                    offset += sizeof(inotify_event) + event->len;
+                }
+
+                m_task_cv.notify_all();
+            }
+
+            // Emit every table that is ready, strictly in arrival order
+            bool emitted_any = false;
+
+            while (output.is_subscribed() && (m_stop_after == 0 || emitted < m_stop_after))
+            {
+                LoadResult result;
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+
+                    auto found = m_results.find(m_emit_seq);
+                    if (found == m_results.end())
+                    {
+                        break;
+                    }
+
+                    result = std::move(found->second);
+                    m_results.erase(found);
+                    ++m_emit_seq;
+                }
+
+                // A slot freed up, unblock any loader waiting on the bounded buffer
+                m_result_cv.notify_all();
+
+                if (!result.table)
+                {
+                    continue;  // The load failed and was already logged
+                }
+
+                auto index_col_count = prepare_df_index(*result.table);
+
+                output.on_next(MessageMeta::create_from_cpp(std::move(*result.table), index_col_count));
+                ++emitted;
+                emitted_any = true;
+
+                if (m_delete_files)
+                {
+                    std::error_code ec;
+                    std::filesystem::remove(result.path, ec);
+
+                    if (ec)
+                    {
+                        LOG(WARNING) << "Failed to remove '" << result.path << "': " << ec.message();
+                    }
+                }
+            }
+
+            if (!emitted_any)
+            {
+                boost::this_fiber::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+
+        // Shutdown: wake everything up, discard unprocessed work and join the loaders
+        m_stop = true;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.clear();
+        }
+
+        m_task_cv.notify_all();
+        m_result_cv.notify_all();
+
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+
+        m_workers.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_results.clear();
+            m_next_seq = 0;
+            m_emit_seq = 0;
+        }
+
+        close(inotify_fd);
+
+        output.on_completed();
+    };
+}
+
+// ************ DirectorySourceStageInterfaceProxy ************ //
+std::shared_ptr<mrc::segment::Object<DirectorySourceStage>> DirectorySourceStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string directory,
+    std::size_t num_threads,
+    std::size_t queue_size,
+    bool process_existing,
+    bool delete_files,
+    std::size_t stop_after,
+    FileTypes file_type,
+    std::vector<std::string> columns,
+    TableSchema schema)
+{
+    auto stage = builder.construct_object<DirectorySourceStage>(name,
+                                                                std::move(directory),
+                                                                num_threads,
+                                                                queue_size,
+                                                                process_existing,
+                                                                delete_files,
+                                                                stop_after,
+                                                                file_type,
+                                                                std::move(columns),
+                                                                std::move(schema));
+
+    return stage;
+}
+}  // namespace morpheus
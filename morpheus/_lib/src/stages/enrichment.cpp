@@ -0,0 +1,312 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/enrichment.hpp"
+
+#include "mrc/segment/builder.hpp"
+#include "mrc/segment/object.hpp"
+#include "pymrc/node.hpp"
+
+#include "morpheus/io/deserializers.hpp"            // for load_table_from_file
+#include "morpheus/objects/table_info.hpp"          // for TableInfo & MutableTableInfo
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
+
+#include <cudf/column/column.hpp>              // for column
+#include <cudf/column/column_view.hpp>         // for column_view
+#include <cudf/copying.hpp>                    // for gather
+#include <cudf/io/types.hpp>                   // for table_metadata
+#include <cudf/join.hpp>                       // for left_join
+#include <cudf/stream_compaction.hpp>          // for stable_distinct
+#include <cudf/table/table_view.hpp>           // for table_view
+#include <cudf/types.hpp>                      // for size_type
+#include <cudf/utilities/default_stream.hpp>   // for get_default_stream
+#include <glog/logging.h>                      // for CHECK
+#include <rmm/exec_policy.hpp>                 // for exec_policy
+#include <thrust/sort.h>                       // for sort_by_key
+
+#include <algorithm>  // for find
+#include <chrono>
+#include <cstddef>  // for size_t
+#include <exception>
+#include <memory>
+#include <system_error>  // for error_code
+#include <utility>       // for move, pair
+
+namespace morpheus {
+
+// Component public implementations
+// ************ EnrichmentStage **************************** //
+EnrichmentStage::EnrichmentStage(std::string filename,
+                                 std::vector<std::string> key_columns,
+                                 std::vector<std::string> columns,
+                                 FileTypes file_type,
+                                 float reload_interval_s) :
+  PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
+  m_filename(std::move(filename)),
+  m_key_columns(std::move(key_columns)),
+  m_columns(std::move(columns)),
+  m_file_type(file_type),
+  m_reload_interval(std::chrono::milliseconds(static_cast<long>(reload_interval_s * 1000.0F)))
+{
+    CHECK(!m_key_columns.empty()) << "EnrichmentStage requires at least one key column";
+
+    load_lookup();
+
+    m_last_check = std::chrono::steady_clock::now();
+
+    std::error_code ec;
+    m_file_mtime = std::filesystem::last_write_time(m_filename, ec);
+}
+
+void EnrichmentStage::load_lookup()
+{
+    auto loaded = load_table_from_file(m_filename, m_file_type);
+    auto names  = get_column_names_from_table(loaded);
+
+    std::vector<cudf::size_type> key_indices;
+    key_indices.reserve(m_key_columns.size());
+
+    for (const auto& key : m_key_columns)
+    {
+        auto found = std::find(names.begin(), names.end(), key);
+        CHECK(found != names.end()) << "Key column '" << key << "' not found in lookup file '" << m_filename << "'";
+
+        key_indices.push_back(static_cast<cudf::size_type>(found - names.begin()));
+    }
+
+    std::vector<cudf::size_type> payload_indices;
+    std::vector<std::string> payload_names;
+
+    if (m_columns.empty())
+    {
+        // Every non-key column is enrichment payload
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            auto idx = static_cast<cudf::size_type>(i);
+
+            if (std::find(key_indices.begin(), key_indices.end(), idx) == key_indices.end())
+            {
+                payload_indices.push_back(idx);
+                payload_names.push_back(names[i]);
+            }
+        }
+    }
+    else
+    {
+        for (const auto& column : m_columns)
+        {
+            auto found = std::find(names.begin(), names.end(), column);
+            CHECK(found != names.end())
+                << "Enrichment column '" << column << "' not found in lookup file '" << m_filename << "'";
+
+            payload_indices.push_back(static_cast<cudf::size_type>(found - names.begin()));
+            payload_names.push_back(column);
+        }
+    }
+
+    CHECK(!payload_indices.empty()) << "Lookup file '" << m_filename << "' has no enrichment columns to append";
+
+    // A duplicated key would fan each matching event out to several rows; keep the first occurrence so the join
+    // yields exactly one context row per event
+    auto distinct = cudf::stable_distinct(loaded.tbl->view(), key_indices, cudf::duplicate_keep_option::KEEP_FIRST);
+
+    if (distinct->num_rows() < loaded.tbl->num_rows())
+    {
+        LOG(WARNING) << "Lookup file '" << m_filename << "' has " << loaded.tbl->num_rows() - distinct->num_rows()
+                     << " rows with duplicate keys, keeping the first occurrence of each";
+    }
+
+    m_lookup             = std::move(distinct);
+    m_lookup_key_indices = std::move(key_indices);
+    m_payload_indices    = std::move(payload_indices);
+    m_payload_names      = std::move(payload_names);
+
+    LOG(INFO) << "EnrichmentStage loaded " << m_lookup->num_rows() << " lookup rows from '" << m_filename << "'";
+}
+
+void EnrichmentStage::maybe_reload()
+{
+    if (m_reload_interval.count() == 0)
+    {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (now - m_last_check < m_reload_interval)
+    {
+        return;
+    }
+
+    m_last_check = now;
+
+    // A missing file (e.g. mid-replace by the producer) is skipped and retried on the next poll
+    std::error_code ec;
+    auto mtime = std::filesystem::last_write_time(m_filename, ec);
+
+    if (ec || mtime == m_file_mtime)
+    {
+        return;
+    }
+
+    load_lookup();
+    m_file_mtime = mtime;
+}
+
+std::shared_ptr<MessageMeta> EnrichmentStage::on_data(sink_type_t msg)
+{
+    MORPHEUS_NVTX_RANGE("EnrichmentStage::on_data");
+    MORPHEUS_STAGE_TIMER("EnrichmentStage");
+    MORPHEUS_STAGE_MEMORY_SCOPE("EnrichmentStage");
+
+    maybe_reload();
+
+    std::vector<std::pair<std::string, std::unique_ptr<cudf::column>>> new_columns;
+    std::vector<std::string> index_names;
+    std::vector<std::string> column_names;
+
+    {
+        // Scoped so the read-side view is released before the mutable checkout below, which waits on readers
+        auto table_info = msg->get_info();
+        auto table_view = table_info.get_view();
+        index_names     = table_info.get_index_names();
+        column_names    = table_info.get_column_names();
+
+        // The view places the index columns ahead of the data columns
+        std::vector<cudf::size_type> key_indices;
+        key_indices.reserve(m_key_columns.size());
+
+        for (const auto& key : m_key_columns)
+        {
+            auto found = std::find(column_names.begin(), column_names.end(), key);
+            CHECK(found != column_names.end()) << "Enrichment key column '" << key << "' not found in the dataframe";
+
+            key_indices.push_back(static_cast<cudf::size_type>(index_names.size() + (found - column_names.begin())));
+        }
+
+        for (const auto& name : m_payload_names)
+        {
+            CHECK(std::find(column_names.begin(), column_names.end(), name) == column_names.end())
+                << "Enrichment column '" << name << "' already exists in the dataframe";
+        }
+
+        // The device hash-join probe; unmatched rows get a negative right index
+        auto [left_map, right_map] = cudf::left_join(
+            table_view.select(key_indices), m_lookup->view().select(m_lookup_key_indices), cudf::null_equality::EQUAL);
+
+        // The lookup keys are distinct, so the join yields exactly one pair per row and sorting the pairs by left
+        // index aligns the right map with the batch's row order
+        CHECK(static_cast<cudf::size_type>(left_map->size()) == table_view.num_rows())
+            << "Enrichment join produced an unexpected row count";
+
+        thrust::sort_by_key(rmm::exec_policy(cudf::get_default_stream()),
+                            left_map->begin(),
+                            left_map->end(),
+                            right_map->begin());
+
+        cudf::column_view gather_map{cudf::data_type{cudf::type_to_id<cudf::size_type>()},
+                                     static_cast<cudf::size_type>(right_map->size()),
+                                     right_map->data(),
+                                     nullptr,
+                                     0};
+
+        // Unmatched rows (negative map entries) become nulls
+        auto enrichment =
+            cudf::gather(m_lookup->view().select(m_payload_indices), gather_map, cudf::out_of_bounds_policy::NULLIFY);
+
+        auto released = enrichment->release();
+        new_columns.reserve(released.size());
+
+        for (std::size_t i = 0; i < released.size(); ++i)
+        {
+            new_columns.emplace_back(m_payload_names[i], std::move(released[i]));
+        }
+    }
+
+    {
+        // In-place append: the owning table adopts the device columns without rebuilding the dataframe. Declined
+        // (and the columns left untouched) when the table is python-backed
+        auto mutable_info = msg->get_mutable_info();
+
+        if (mutable_info.append_columns(std::move(new_columns)))
+        {
+            return msg;
+        }
+    }
+
+    // Python-backed frames cannot adopt libcudf columns directly; rebuild the table with the enrichment appended
+    // and re-wrap it as a new message
+    auto table_info = msg->get_info();
+    auto columns    = cudf::table(table_info.get_view()).release();
+
+    for (auto& column : new_columns)
+    {
+        columns.push_back(std::move(column.second));
+    }
+
+    auto metadata = cudf::io::table_metadata{};
+    metadata.schema_info.reserve(index_names.size() + column_names.size() + m_payload_names.size());
+
+    for (const auto& name : index_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    for (const auto& name : column_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    for (const auto& name : m_payload_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    return MessageMeta::create_from_cpp({std::make_unique<cudf::table>(std::move(columns)), std::move(metadata)},
+                                        static_cast<int>(index_names.size()));
+}
+
+EnrichmentStage::subscribe_fn_t EnrichmentStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t msg) {
+                output.on_next(this->on_data(std::move(msg)));
+            },
+            [&](std::exception_ptr error_ptr) { output.on_error(error_ptr); },
+            [&]() { output.on_completed(); }));
+    };
+}
+
+// ************ EnrichmentStageInterfaceProxy ************* //
+std::shared_ptr<mrc::segment::Object<EnrichmentStage>> EnrichmentStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string filename,
+    std::vector<std::string> key_columns,
+    std::vector<std::string> columns,
+    FileTypes file_type,
+    float reload_interval_s)
+{
+    auto stage = builder.construct_object<EnrichmentStage>(
+        name, std::move(filename), std::move(key_columns), std::move(columns), file_type, reload_interval_s);
+
+    return stage;
+}
+}  // namespace morpheus
@@ -29,6 +29,12 @@
 #include "morpheus/objects/table_info.hpp"
 #include "morpheus/utilities/cudf_util.hpp"
 
+#include <cudf/binaryop.hpp>           // for binary_operation
+#include <cudf/column/column.hpp>      // for column
+#include <cudf/io/types.hpp>           // for table_metadata, table_with_metadata
+#include <cudf/scalar/scalar.hpp>      // for numeric_scalar
+#include <cudf/table/table.hpp>        // for table
+#include <cudf/table/table_view.hpp>   // for table_view
 #include <cudf/types.hpp>
 #include <glog/logging.h>
 #include <mrc/segment/builder.hpp>
@@ -37,33 +43,129 @@
 #include <pybind11/pybind11.h>  // for str_attr_accessor
 #include <pybind11/pytypes.h>   // for pybind11::int_
 
+#include <cstdint>  // for int64_t
 #include <functional>
+#include <future>  // for async
 #include <memory>
+#include <mutex>  // for lock_guard
 #include <optional>
 #include <sstream>
 #include <utility>
+#include <vector>
 // IWYU thinks we need __alloc_traits<>::value_type for vector assignments
 // IWYU pragma: no_include <ext/alloc_traits.h>
 
 namespace morpheus {
 // Component public implementations
 // ************ FileSourceStage ************* //
-FileSourceStage::FileSourceStage(std::string filename, int repeat, std::optional<bool> json_lines) :
+FileSourceStage::FileSourceStage(std::string filename,
+                                 int repeat,
+                                 std::optional<bool> json_lines,
+                                 std::vector<std::string> columns,
+                                 TableSchema schema,
+                                 std::string sort_by,
+                                 std::size_t chunk_size_bytes) :
   PythonSource(build()),
   m_filename(std::move(filename)),
   m_repeat(repeat),
-  m_json_lines(json_lines)
-{}
+  m_json_lines(json_lines),
+  m_columns(std::move(columns)),
+  m_schema(std::move(schema)),
+  m_sort_by(std::move(sort_by)),
+  m_chunk_size_bytes(chunk_size_bytes)
+{
+    CHECK(m_chunk_size_bytes == 0 || m_repeat == 1) << "chunk_size_bytes cannot be combined with repeat";
+}
+
+std::shared_ptr<const cudf::table> FileSourceStage::get_cached_table()
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+
+    if (!m_cached_table)
+    {
+        auto data_table = load_table_from_file(m_filename, FileTypes::Auto, m_json_lines, m_columns, m_schema);
+
+        // Sorting before the index is prepared keeps the emitted index monotonic
+        sort_table_by_column(data_table, m_sort_by);
+
+        m_index_col_count = prepare_df_index(data_table);
+
+        m_cached_schema = std::move(data_table.metadata.schema_info);
+        m_cached_table  = std::move(data_table.tbl);
+    }
+
+    return m_cached_table;
+}
+
+void FileSourceStage::chunked_read(rxcpp::subscriber<source_type_t>& output)
+{
+    ChunkedTableReader reader(m_filename, FileTypes::Auto, m_json_lines, m_columns, m_schema, m_chunk_size_bytes);
+
+    // Double buffer: the next byte range parses on a background thread while the current chunk is emitted
+    auto read_next = [&reader]() {
+        return reader.next();
+    };
+
+    auto pending = std::async(std::launch::async, read_next);
+
+    while (output.is_subscribed())
+    {
+        auto chunk      = pending.get();
+        const bool more = reader.has_next();
+
+        if (more)
+        {
+            pending = std::async(std::launch::async, read_next);
+        }
+
+        // A range holding no complete record parses to an empty table and is skipped
+        if (chunk.tbl->num_rows() > 0)
+        {
+            // Orders rows within this chunk only, a full-file sort would require the full-file parse
+            sort_table_by_column(chunk, m_sort_by);
+
+            auto index_col_count = prepare_df_index(chunk);
+
+            output.on_next(MessageMeta::create_from_cpp(std::move(chunk), index_col_count));
+        }
+
+        if (!more)
+        {
+            break;
+        }
+    }
+
+    // An early unsubscribe can leave a background parse running, it must finish before the reader dies
+    if (pending.valid())
+    {
+        try
+        {
+            pending.get();
+        } catch (...)  // NOLINT(bugprone-empty-catch)
+        {}
+    }
+
+    output.on_completed();
+}
 
 FileSourceStage::subscriber_fn_t FileSourceStage::build()
 {
     return [this](rxcpp::subscriber<source_type_t> output) {
-        auto data_table     = load_table_from_file(m_filename, FileTypes::Auto, m_json_lines);
-        int index_col_count = prepare_df_index(data_table);
+        if (m_chunk_size_bytes > 0)
+        {
+            // Streaming replay: emit per byte-range chunks, never materializing the whole file
+            return chunked_read(output);
+        }
 
-        // Next, create the message metadata. This gets reused for repeats
-        // When index_col_count is 0 this will cause a new range index to be created
-        auto meta = MessageMeta::create_from_cpp(std::move(data_table), index_col_count);
+        // Parsed once for the lifetime of the stage, repeats and re-runs copy the cached device snapshot
+        auto cached_table   = this->get_cached_table();
+        const auto num_rows = cached_table->num_rows();
+
+        // When m_index_col_count is 0 this will cause a new range index to be created
+        cudf::io::table_with_metadata data_table{std::make_unique<cudf::table>(cached_table->view()),
+                                                 cudf::io::table_metadata{m_cached_schema}};
+
+        auto meta = MessageMeta::create_from_cpp(std::move(data_table), m_index_col_count);
 
         // next_meta stores a copy of the upcoming meta
         std::shared_ptr<MessageMeta> next_meta = nullptr;
@@ -84,19 +186,47 @@ FileSourceStage::subscriber_fn_t FileSourceStage::build()
             // Clone the meta object before pushing while we still have access to it
             if (repeat_idx + 1 < m_repeat)
             {
-                // Use the copy function, copy_to_py_object will acquire it's own gil
-                auto df = CudfHelper::table_from_table_info(meta->get_info());
+                if (m_index_col_count > 0)
+                {
+                    // The index is a materialized column, shift it on device so each repeat keeps unique increasing
+                    // values. This stays entirely in libcudf, no python object and no GIL per repeat
+                    auto table_view = cached_table->view();
 
-                // GIL must come after get_info
-                pybind11::gil_scoped_acquire gil;
+                    std::vector<std::unique_ptr<cudf::column>> columns;
+                    columns.reserve(table_view.num_columns());
+
+                    cudf::numeric_scalar<int64_t> offset(static_cast<int64_t>(repeat_idx + 1) * num_rows);
+                    columns.emplace_back(cudf::binary_operation(
+                        table_view.column(0), offset, cudf::binary_operator::ADD, table_view.column(0).type()));
+
+                    for (cudf::size_type col_idx = 1; col_idx < table_view.num_columns(); ++col_idx)
+                    {
+                        columns.emplace_back(std::make_unique<cudf::column>(table_view.column(col_idx)));
+                    }
+
+                    cudf::io::table_with_metadata copy{std::make_unique<cudf::table>(std::move(columns)),
+                                                       cudf::io::table_metadata{m_cached_schema}};
+
+                    next_meta = MessageMeta::create_from_cpp(std::move(copy), m_index_col_count);
+                }
+                else
+                {
+                    // A range index only exists on the python side, keep shifting it there so the repeats stay
+                    // monotonic for downstream concatenation
+                    // Use the copy function, copy_to_py_object will acquire it's own gil
+                    auto df = CudfHelper::table_from_table_info(meta->get_info());
+
+                    // GIL must come after get_info
+                    pybind11::gil_scoped_acquire gil;
 
-                pybind11::int_ df_len = pybind11::len(df);
+                    pybind11::int_ df_len = pybind11::len(df);
 
-                pybind11::object index = df.attr("index");
+                    pybind11::object index = df.attr("index");
 
-                df.attr("index") = index + df_len;
+                    df.attr("index") = index + df_len;
 
-                next_meta = MessageMeta::create_from_python(std::move(df));
+                    next_meta = MessageMeta::create_from_python(std::move(df));
+                }
             }
 
             DCHECK(meta) << "Cannot push null meta";
@@ -120,7 +250,11 @@ std::shared_ptr<mrc::segment::Object<FileSourceStage>> FileSourceStageInterfaceP
     const std::string& name,
     std::string filename,
     int repeat,
-    pybind11::dict parser_kwargs)
+    pybind11::dict parser_kwargs,
+    std::vector<std::string> columns,
+    TableSchema schema,
+    std::string sort_by,
+    std::size_t chunk_size_bytes)
 {
     std::optional<bool> json_lines = std::nullopt;
 
@@ -129,7 +263,9 @@ std::shared_ptr<mrc::segment::Object<FileSourceStage>> FileSourceStageInterfaceP
         json_lines = parser_kwargs["lines"].cast<bool>();
     }
 
-    auto stage = builder.construct_object<FileSourceStage>(name, filename, repeat, json_lines);
+    auto stage = builder.construct_object<FileSourceStage>(
+        name, filename, repeat, json_lines, std::move(columns), std::move(schema), std::move(sort_by),
+        chunk_size_bytes);
 
     return stage;
 }
@@ -34,19 +34,22 @@
 #include "morpheus/objects/tensor_object.hpp"  // for TensorIndex, TensorObject
 #include "morpheus/types.hpp"                  // for RangeType
 #include "morpheus/utilities/matx_util.hpp"
-#include "morpheus/utilities/tensor_util.hpp"  // for TensorUtils::get_element_stride
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
+#include "morpheus/utilities/stream_pool.hpp"       // for StreamPool
+#include "morpheus/utilities/tensor_util.hpp"       // for TensorUtils::get_element_stride
 
-#include <cuda_runtime.h>  // for cudaMemcpy, cudaMemcpyDeviceToDevice, cudaMemcpyDeviceToHost
+#include <cuda_runtime.h>  // for cudaMemcpyAsync
 #include <cudf/column/column_view.hpp>
 #include <cudf/types.hpp>
-#include <glog/logging.h>       // for CHECK, CHECK_NE
-#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
+#include <glog/logging.h>        // for CHECK, CHECK_NE
+#include <mrc/cuda/common.hpp>   // for MRC_CHECK_CUDA
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>  // for device_buffer
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <cstddef>
-#include <cstdint>  // for uint8_t
 #include <exception>
 #include <functional>
 #include <memory>
@@ -63,12 +66,14 @@ namespace morpheus {
 FilterDetectionsStage::FilterDetectionsStage(float threshold,
                                              bool copy,
                                              FilterSource filter_source,
-                                             std::string field_name) :
+                                             std::string field_name,
+                                             std::string mask_column) :
   PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
   m_threshold(threshold),
   m_copy(copy),
   m_filter_source(filter_source),
-  m_field_name(std::move(field_name))
+  m_field_name(std::move(field_name)),
+  m_mask_column(std::move(mask_column))
 {
     CHECK(m_filter_source != FilterSource::Auto);  // The python stage should determine this
 }
@@ -100,7 +105,7 @@ DevMemInfo FilterDetectionsStage::get_column_filter_source(const std::shared_ptr
     return {
         data,
         std::move(dtype),
-        std::make_shared<MemoryDescriptor>(rmm::cuda_stream_per_thread, rmm::mr::get_current_device_resource()),
+        std::make_shared<MemoryDescriptor>(StreamPool::get_stream(), rmm::mr::get_current_device_resource()),
         {num_rows, 1},
         {1, 0},
     };
@@ -126,6 +131,10 @@ FilterDetectionsStage::subscribe_fn_t FilterDetectionsStage::build_operator()
 
         return input.subscribe(rxcpp::make_observer<sink_type_t>(
             [this, &output, &get_filter_source](sink_type_t x) {
+                MORPHEUS_NVTX_RANGE("FilterDetectionsStage::on_data");
+                MORPHEUS_STAGE_TIMER("FilterDetectionsStage");
+                MORPHEUS_STAGE_MEMORY_SCOPE("FilterDetectionsStage");
+
                 auto tmp_buffer = get_filter_source(x);
 
                 const auto num_rows    = tmp_buffer.shape(0);
@@ -133,68 +142,56 @@ FilterDetectionsStage::subscribe_fn_t FilterDetectionsStage::build_operator()
 
                 bool by_row = (num_columns > 1);
 
-                // Now call the threshold function
-                auto thresh_bool_buffer = MatxUtil::threshold(tmp_buffer, m_threshold, by_row);
-
-                std::vector<uint8_t> host_bool_values(num_rows);
+                // Threshold and run-length encode the mask entirely on the device; only the compacted
+                // ranges cross back to the host, instead of the full mask plus a host scan
+                auto thresh_bool_buffer = MatxUtil::threshold_async(tmp_buffer, m_threshold, by_row);
 
-                // Copy bools back to host
-                MRC_CHECK_CUDA(cudaMemcpy(host_bool_values.data(),
-                                          thresh_bool_buffer->data(),
-                                          thresh_bool_buffer->size(),
-                                          cudaMemcpyDeviceToHost));
+                if (!m_mask_column.empty())
+                {
+                    // Lazy mode: attach the mask and forward the message untouched. The serializer applies it in
+                    // a single gather at write time, so surviving rows move once instead of twice
+                    auto mask_info = x->get_meta(m_mask_column);
+
+                    const auto& mask_cv = mask_info.get_column(0);
+                    CHECK(mask_cv.type().id() == cudf::type_id::BOOL8)
+                        << "Filter mask column '" << m_mask_column << "' must be preallocated as a bool column";
+                    CHECK(mask_cv.size() == num_rows);
+
+                    auto* mask_data = const_cast<uint8_t*>(mask_cv.head<uint8_t>()) + mask_cv.offset();
+
+                    MRC_CHECK_CUDA(cudaMemcpyAsync(mask_data,
+                                                   thresh_bool_buffer->data(),
+                                                   num_rows * sizeof(bool),
+                                                   cudaMemcpyDeviceToDevice,
+                                                   thresh_bool_buffer->stream().value()));
+                    MRC_CHECK_CUDA(cudaStreamSynchronize(thresh_bool_buffer->stream().value()));
+
+                    output.on_next(std::move(x));
+                    return;
+                }
 
-                // Only used when m_copy is true
-                std::vector<RangeType> selected_ranges;
-                std::size_t num_selected_rows = 0;
+                auto selected_ranges = MatxUtil::mask_to_ranges(*thresh_bool_buffer, num_rows);
 
-                // We are slicing by rows, using num_rows as our marker for undefined
-                std::size_t slice_start = num_rows;
-                for (std::size_t row = 0; row < num_rows; ++row)
+                if (m_copy)
                 {
-                    bool above_threshold = host_bool_values[row];
-
-                    if (above_threshold && slice_start == num_rows)
+                    std::size_t num_selected_rows = 0;
+                    for (const auto& range : selected_ranges)
                     {
-                        slice_start = row;
+                        num_selected_rows += (range.second - range.first);
                     }
-                    else if (!above_threshold && slice_start != num_rows)
+
+                    if (num_selected_rows > 0)
                     {
-                        if (m_copy)
-                        {
-                            selected_ranges.emplace_back(std::pair{slice_start, row});
-                            num_selected_rows += (row - slice_start);
-                        }
-                        else
-                        {
-                            output.on_next(x->get_slice(slice_start, row));
-                        }
-
-                        slice_start = num_rows;
+                        output.on_next(x->copy_ranges(selected_ranges, num_selected_rows));
                     }
                 }
-
-                if (slice_start != num_rows)
+                else
                 {
-                    // Last row was above the threshold
-                    if (m_copy)
-                    {
-                        selected_ranges.emplace_back(std::pair{slice_start, num_rows});
-                        num_selected_rows += (num_rows - slice_start);
-                    }
-                    else
+                    for (const auto& range : selected_ranges)
                     {
-                        output.on_next(x->get_slice(slice_start, num_rows));
+                        output.on_next(x->get_slice(range.first, range.second));
                     }
                 }
-
-                // num_selected_rows will always be 0 when m_copy is false,
-                // or when m_copy is true, but none of the rows matched the output
-                if (num_selected_rows > 0)
-                {
-                    DCHECK(m_copy);
-                    output.on_next(x->copy_ranges(selected_ranges, num_selected_rows));
-                }
             },
             [&](std::exception_ptr error_ptr) {
                 output.on_error(error_ptr);
@@ -212,9 +209,11 @@ std::shared_ptr<mrc::segment::Object<FilterDetectionsStage>> FilterDetectionStag
     float threshold,
     bool copy,
     FilterSource filter_source,
-    std::string field_name)
+    std::string field_name,
+    std::string mask_column)
 {
-    auto stage = builder.construct_object<FilterDetectionsStage>(name, threshold, copy, filter_source, field_name);
+    auto stage = builder.construct_object<FilterDetectionsStage>(
+        name, threshold, copy, filter_source, field_name, std::move(mask_column));
 
     return stage;
 }
@@ -0,0 +1,336 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/groupby_window.hpp"
+
+#include "mrc/segment/builder.hpp"
+#include "mrc/segment/object.hpp"
+#include "pymrc/node.hpp"
+
+#include "morpheus/objects/table_info.hpp"          // for TableInfo
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
+
+#include <cudf/aggregation.hpp>               // for make_sum_aggregation & friends
+#include <cudf/binaryop.hpp>                  // for binary_operation
+#include <cudf/column/column.hpp>             // for column
+#include <cudf/column/column_factories.hpp>   // for make_column_from_scalar
+#include <cudf/concatenate.hpp>               // for concatenate
+#include <cudf/copying.hpp>                   // for gather
+#include <cudf/filling.hpp>                   // for sequence
+#include <cudf/io/types.hpp>                  // for table_metadata
+#include <cudf/reduction.hpp>                 // for reduce
+#include <cudf/rolling.hpp>                   // for grouped_range_rolling_window
+#include <cudf/rolling/range_window_bounds.hpp>  // for range_window_bounds
+#include <cudf/scalar/scalar.hpp>             // for duration_scalar & numeric_scalar
+#include <cudf/sorting.hpp>                   // for sorted_order & stable_sorted_order
+#include <cudf/stream_compaction.hpp>         // for apply_boolean_mask
+#include <cudf/table/table_view.hpp>          // for table_view
+#include <cudf/types.hpp>                     // for size_type
+#include <cudf/unary.hpp>                     // for cast
+#include <cudf/wrappers/durations.hpp>        // for duration_s & friends
+#include <glog/logging.h>                     // for CHECK
+
+#include <algorithm>  // for find
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int32_t & int64_t
+#include <exception>
+#include <memory>
+#include <numeric>    // for iota
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for move
+
+namespace {
+
+using namespace morpheus;
+
+std::unique_ptr<cudf::rolling_aggregation> make_rolling_agg(const std::string& kind)
+{
+    if (kind == "count")
+    {
+        return cudf::make_count_aggregation<cudf::rolling_aggregation>();
+    }
+    if (kind == "sum")
+    {
+        return cudf::make_sum_aggregation<cudf::rolling_aggregation>();
+    }
+    if (kind == "mean")
+    {
+        return cudf::make_mean_aggregation<cudf::rolling_aggregation>();
+    }
+    if (kind == "min")
+    {
+        return cudf::make_min_aggregation<cudf::rolling_aggregation>();
+    }
+    if (kind == "max")
+    {
+        return cudf::make_max_aggregation<cudf::rolling_aggregation>();
+    }
+
+    throw std::invalid_argument("Unsupported aggregation: " + kind);
+}
+
+// The window bound scalar must match the resolution of the orderby column
+std::unique_ptr<cudf::scalar> make_window_scalar(cudf::type_id orderby_type, int64_t window)
+{
+    switch (orderby_type)
+    {
+    case cudf::type_id::TIMESTAMP_SECONDS:
+        return std::make_unique<cudf::duration_scalar<cudf::duration_s>>(cudf::duration_s{window}, true);
+    case cudf::type_id::TIMESTAMP_MILLISECONDS:
+        return std::make_unique<cudf::duration_scalar<cudf::duration_ms>>(cudf::duration_ms{window}, true);
+    case cudf::type_id::TIMESTAMP_MICROSECONDS:
+        return std::make_unique<cudf::duration_scalar<cudf::duration_us>>(cudf::duration_us{window}, true);
+    case cudf::type_id::TIMESTAMP_NANOSECONDS:
+        return std::make_unique<cudf::duration_scalar<cudf::duration_ns>>(cudf::duration_ns{window}, true);
+    case cudf::type_id::INT64:
+        return std::make_unique<cudf::numeric_scalar<int64_t>>(window, true);
+    default:
+        throw std::invalid_argument("Timestamp column must be a cudf timestamp or int64 column");
+    }
+}
+
+}  // namespace
+
+namespace morpheus {
+
+// Component public implementations
+// ************ GroupbyWindowStage **************************** //
+GroupbyWindowStage::GroupbyWindowStage(std::vector<std::string> group_columns,
+                                       std::string timestamp_column,
+                                       int64_t window,
+                                       std::vector<aggregation_t> aggregations) :
+  PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
+  m_group_columns(std::move(group_columns)),
+  m_timestamp_column(std::move(timestamp_column)),
+  m_window(window)
+{
+    CHECK(!m_group_columns.empty()) << "GroupbyWindowStage requires at least one group column";
+    CHECK(!aggregations.empty()) << "GroupbyWindowStage requires at least one aggregation";
+    CHECK_GT(m_window, 0) << "Window length must be positive";
+
+    m_value_columns.reserve(aggregations.size());
+    m_agg_kinds.reserve(aggregations.size());
+    m_output_columns.reserve(aggregations.size());
+
+    for (auto& [value_column, kind, output_column] : aggregations)
+    {
+        // Validate eagerly, a bad aggregation name should fail at construction rather than on the first batch
+        make_rolling_agg(kind);
+
+        m_value_columns.push_back(std::move(value_column));
+        m_agg_kinds.push_back(std::move(kind));
+        m_output_columns.push_back(std::move(output_column));
+    }
+}
+
+std::shared_ptr<MessageMeta> GroupbyWindowStage::on_data(sink_type_t msg)
+{
+    MORPHEUS_NVTX_RANGE("GroupbyWindowStage::on_data");
+    MORPHEUS_STAGE_TIMER("GroupbyWindowStage");
+    MORPHEUS_STAGE_MEMORY_SCOPE("GroupbyWindowStage");
+
+    auto table_info   = msg->get_info();
+    auto table_view   = table_info.get_view();
+    auto index_names  = table_info.get_index_names();
+    auto column_names = table_info.get_column_names();
+
+    const auto num_rows = table_view.num_rows();
+    if (num_rows == 0)
+    {
+        return msg;
+    }
+
+    // The view places the index columns ahead of the data columns
+    auto find_column = [&](const std::string& name) {
+        auto found = std::find(column_names.begin(), column_names.end(), name);
+        CHECK(found != column_names.end()) << "Column '" << name << "' not found in the dataframe";
+
+        return static_cast<cudf::size_type>(index_names.size() + (found - column_names.begin()));
+    };
+
+    // Working layout: [group columns..., timestamp, value columns..., ordinal]. The ordinal tags each batch row
+    // with its arrival position (history rows get -1) so results can be routed back after the sort.
+    std::vector<cudf::size_type> subset_indices;
+    subset_indices.reserve(m_group_columns.size() + 1 + m_value_columns.size());
+
+    for (const auto& name : m_group_columns)
+    {
+        subset_indices.push_back(find_column(name));
+    }
+
+    subset_indices.push_back(find_column(m_timestamp_column));
+
+    for (const auto& name : m_value_columns)
+    {
+        subset_indices.push_back(find_column(name));
+    }
+
+    const auto num_keys      = static_cast<cudf::size_type>(m_group_columns.size());
+    const auto timestamp_idx = num_keys;
+    const auto ordinal_idx   = static_cast<cudf::size_type>(subset_indices.size());
+
+    auto batch_subset  = table_view.select(subset_indices);
+    auto batch_ordinal = cudf::sequence(num_rows, cudf::numeric_scalar<int32_t>(0));
+
+    std::vector<cudf::column_view> batch_columns(batch_subset.begin(), batch_subset.end());
+    batch_columns.push_back(batch_ordinal->view());
+
+    std::unique_ptr<cudf::table> combined;
+    if (m_history)
+    {
+        auto history_ordinal = cudf::make_column_from_scalar(cudf::numeric_scalar<int32_t>(-1), m_history->num_rows());
+
+        std::vector<cudf::column_view> history_columns(m_history->view().begin(), m_history->view().end());
+        history_columns.push_back(history_ordinal->view());
+
+        combined = cudf::concatenate(
+            std::vector<cudf::table_view>{cudf::table_view(history_columns), cudf::table_view(batch_columns)});
+    }
+    else
+    {
+        combined = std::make_unique<cudf::table>(cudf::table_view(batch_columns));
+    }
+
+    // Sort by (keys, timestamp); the stable order keeps history rows ahead of batch rows at equal timestamps
+    std::vector<cudf::size_type> sort_indices(num_keys + 1);
+    std::iota(sort_indices.begin(), sort_indices.end(), 0);
+
+    auto sort_order = cudf::stable_sorted_order(combined->view().select(sort_indices));
+    auto sorted     = cudf::gather(combined->view(), sort_order->view());
+
+    std::vector<cudf::size_type> key_indices(num_keys);
+    std::iota(key_indices.begin(), key_indices.end(), 0);
+
+    auto group_keys = sorted->view().select(key_indices);
+    auto orderby    = sorted->view().column(timestamp_idx);
+
+    auto preceding_scalar = make_window_scalar(orderby.type().id(), m_window);
+    auto following_scalar = make_window_scalar(orderby.type().id(), 0);
+    auto preceding        = cudf::range_window_bounds::get(*preceding_scalar);
+    auto following        = cudf::range_window_bounds::get(*following_scalar);
+
+    // One fused kernel per feature over the sorted (history + batch) rows
+    std::vector<cudf::column_view> result_columns{sorted->view().column(ordinal_idx)};
+    std::vector<std::unique_ptr<cudf::column>> result_storage;
+    result_storage.reserve(m_agg_kinds.size());
+
+    for (std::size_t i = 0; i < m_agg_kinds.size(); ++i)
+    {
+        auto input = sorted->view().column(timestamp_idx + 1 + static_cast<cudf::size_type>(i));
+
+        result_storage.push_back(cudf::grouped_range_rolling_window(group_keys,
+                                                                    orderby,
+                                                                    cudf::order::ASCENDING,
+                                                                    input,
+                                                                    preceding,
+                                                                    following,
+                                                                    1,
+                                                                    *make_rolling_agg(m_agg_kinds[i])));
+        result_columns.push_back(result_storage.back()->view());
+    }
+
+    // Keep the batch rows only and restore arrival order via the ordinal column
+    auto batch_mask = cudf::binary_operation(result_columns.front(),
+                                             cudf::numeric_scalar<int32_t>(0),
+                                             cudf::binary_operator::GREATER_EQUAL,
+                                             cudf::data_type{cudf::type_id::BOOL8});
+
+    auto batch_results = cudf::apply_boolean_mask(cudf::table_view(result_columns), batch_mask->view());
+    auto arrival_order = cudf::sorted_order(batch_results->view().select(std::vector<cudf::size_type>{0}));
+    auto ordered       = cudf::gather(batch_results->view(), arrival_order->view())->release();
+
+    // Roll the history forward: every (key, timestamp, value) row still inside the window measured from the
+    // newest timestamp seen, batch rows included
+    {
+        // Combined's layout minus the trailing ordinal column
+        std::vector<cudf::size_type> combined_subset(subset_indices.size());
+        std::iota(combined_subset.begin(), combined_subset.end(), 0);
+
+        auto timestamps = cudf::cast(combined->view().column(timestamp_idx), cudf::data_type{cudf::type_id::INT64});
+        auto max_scalar = cudf::reduce(timestamps->view(),
+                                       *cudf::make_max_aggregation<cudf::reduce_aggregation>(),
+                                       cudf::data_type{cudf::type_id::INT64});
+
+        const auto max_timestamp = static_cast<cudf::numeric_scalar<int64_t>*>(max_scalar.get())->value();
+
+        auto history_mask = cudf::binary_operation(timestamps->view(),
+                                                   cudf::numeric_scalar<int64_t>(max_timestamp - m_window),
+                                                   cudf::binary_operator::GREATER,
+                                                   cudf::data_type{cudf::type_id::BOOL8});
+
+        m_history =
+            cudf::apply_boolean_mask(combined->view().select(combined_subset), history_mask->view());
+    }
+
+    // Rebuild the output table with the feature columns appended
+    auto columns = std::make_unique<cudf::table>(table_view)->release();
+    columns.reserve(columns.size() + m_output_columns.size());
+
+    for (std::size_t i = 1; i < ordered.size(); ++i)
+    {
+        columns.push_back(std::move(ordered[i]));
+    }
+
+    auto metadata = cudf::io::table_metadata{};
+    metadata.schema_info.reserve(index_names.size() + column_names.size() + m_output_columns.size());
+
+    for (const auto& name : index_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    for (const auto& name : column_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    for (const auto& name : m_output_columns)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    return MessageMeta::create_from_cpp({std::make_unique<cudf::table>(std::move(columns)), std::move(metadata)},
+                                        static_cast<int>(index_names.size()));
+}
+
+GroupbyWindowStage::subscribe_fn_t GroupbyWindowStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t msg) { output.on_next(this->on_data(std::move(msg))); },
+            [&](std::exception_ptr error_ptr) { output.on_error(error_ptr); },
+            [&]() { output.on_completed(); }));
+    };
+}
+
+// ************ GroupbyWindowStageInterfaceProxy ************* //
+std::shared_ptr<mrc::segment::Object<GroupbyWindowStage>> GroupbyWindowStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::vector<std::string> group_columns,
+    std::string timestamp_column,
+    int64_t window,
+    std::vector<GroupbyWindowStage::aggregation_t> aggregations)
+{
+    auto stage = builder.construct_object<GroupbyWindowStage>(
+        name, std::move(group_columns), std::move(timestamp_column), window, std::move(aggregations));
+
+    return stage;
+}
+}  // namespace morpheus
@@ -17,9 +17,16 @@
 
 #include "morpheus/stages/http_server_source_stage.hpp"
 
+#include "morpheus/io/deserializers.hpp"       // for load_json_lines_host, JsonHostParseMaxBytes
+#include "morpheus/objects/dtype.hpp"          // for schema_to_cudf_dtypes
+#include "morpheus/utilities/edge_gauges.hpp"  // for EdgeGaugeRegistry, ScopedBlockedTimer
+
 #include <boost/beast/http/status.hpp>        // for int_to_status, status
 #include <boost/fiber/channel_op_status.hpp>  // for channel_op_status
+#include <cudf/concatenate.hpp>               // for concatenate
 #include <cudf/io/json.hpp>                   // for json_reader_options & read_json
+#include <cudf/table/table.hpp>               // for table
+#include <cudf/table/table_view.hpp>          // for table_view
 #include <glog/logging.h>                     // for CHECK & LOG
 
 #include <exception>   // for std::exception
@@ -29,6 +36,7 @@
 #include <thread>      // for std::this_thread::sleep_for
 #include <tuple>       // for make_tuple
 #include <utility>     // for std::move
+#include <vector>      // for vector
 // IWYU thinks we need more boost headers than we need as int_to_status is defined in status.hpp
 // IWYU pragma: no_include <boost/beast/http.hpp>
 
@@ -51,40 +59,39 @@ HttpServerSourceStage::HttpServerSourceStage(std::string bind_address,
                                              std::size_t max_payload_size,
                                              std::chrono::seconds request_timeout,
                                              bool lines,
-                                             std::size_t stop_after) :
+                                             std::size_t stop_after,
+                                             bool reuse_port,
+                                             TableSchema schema) :
   PythonSource(build()),
   m_sleep_time{sleep_time},
   m_queue_timeout{queue_timeout},
   m_queue{max_queue_size},
+  m_queue_gauge{EdgeGaugeRegistry::instance().get_or_create("HttpServerSourceStage.queue")},
   m_stop_after{stop_after},
-  m_records_emitted{0}
+  m_records_emitted{0},
+  m_lines{lines},
+  m_schema{std::move(schema)}
 {
     CHECK(boost::beast::http::int_to_status(accept_status) != boost::beast::http::status::unknown)
         << "Invalid HTTP status code: " << accept_status;
 
-    payload_parse_fn_t parser = [this, accept_status, lines](const std::string& payload) {
-        std::unique_ptr<cudf::io::table_with_metadata> table{nullptr};
+    // Queue the raw body untouched; the reader coalesces a window of bodies into a single read_json, so the
+    // server threads never pay the parse cost and burst traffic is amortized into one GPU parse per window
+    payload_parse_fn_t parser = [this, accept_status](std::string&& payload) {
         try
         {
-            cudf::io::source_info source{payload.c_str(), payload.size()};
-            auto options = cudf::io::json_reader_options::builder(source).lines(lines);
-            table        = std::make_unique<cudf::io::table_with_metadata>(cudf::io::read_json(options.build()));
-        } catch (const std::exception& e)
-        {
-            std::string error_msg = "Error occurred converting HTTP payload to Dataframe";
-            LOG(ERROR) << error_msg << ": " << e.what();
-            return std::make_tuple(400u, "text/plain", error_msg, nullptr);
-        }
-
-        try
-        {
-            // NOLINTNEXTLINE(clang-diagnostic-unused-value)
-            DCHECK_NOTNULL(table);
-            auto queue_status = m_queue.push_wait_for(std::move(table), m_queue_timeout);
+            boost::fibers::channel_op_status queue_status;
+            {
+                // An uncontended push returns immediately, anything measured here is the reader falling behind
+                ScopedBlockedTimer blocked(m_queue_gauge);
+                queue_status = m_queue.push_wait_for(std::make_unique<std::string>(std::move(payload)),
+                                                     m_queue_timeout);
+            }
 
             if (queue_status == boost::fibers::channel_op_status::success)
             {
-                return std::make_tuple(accept_status, "text/plain", std::string(), nullptr);
+                m_queue_gauge.enqueue();
+                return std::make_tuple(accept_status, "text/plain", std::string(), nullptr, nullptr);
             }
 
             std::string error_msg = "HTTP payload queue is ";
@@ -106,12 +113,12 @@ HttpServerSourceStage::HttpServerSourceStage(std::string bind_address,
             }
             }
 
-            return std::make_tuple(503u, "text/plain", std::move(error_msg), nullptr);
+            return std::make_tuple(503u, "text/plain", std::move(error_msg), nullptr, nullptr);
         } catch (const std::exception& e)
         {
             std::string error_msg = "Error occurred while pushing payload to queue";
             LOG(ERROR) << error_msg << ": " << e.what();
-            return std::make_tuple(500u, "text/plain", error_msg, nullptr);
+            return std::make_tuple(500u, "text/plain", error_msg, nullptr, nullptr);
         }
     };
     m_server = std::make_unique<HttpServer>(std::move(parser),
@@ -121,7 +128,8 @@ HttpServerSourceStage::HttpServerSourceStage(std::string bind_address,
                                             std::move(method),
                                             num_server_threads,
                                             max_payload_size,
-                                            request_timeout);
+                                            request_timeout,
+                                            reuse_port);
 }
 
 HttpServerSourceStage::subscriber_fn_t HttpServerSourceStage::build()
@@ -145,6 +153,34 @@ HttpServerSourceStage::subscriber_fn_t HttpServerSourceStage::build()
     };
 }
 
+table_t HttpServerSourceStage::parse_payload(const std::string& payload) const
+{
+    try
+    {
+        // The host parser always infers, a pinned schema goes through the GPU reader
+        if (m_lines && m_schema.empty() && payload.size() <= JsonHostParseMaxBytes)
+        {
+            // Control-plane sized payloads parse faster on the host than the GPU reader's launch overhead
+            return std::make_unique<cudf::io::table_with_metadata>(load_json_lines_host(payload));
+        }
+
+        cudf::io::source_info source{payload.c_str(), payload.size()};
+        auto options = cudf::io::json_reader_options::builder(source).lines(m_lines);
+
+        if (!m_schema.empty())
+        {
+            // Pinned dtypes skip the inference pass and keep the column types stable across windows
+            options.dtypes(schema_to_cudf_dtypes(m_schema));
+        }
+
+        return std::make_unique<cudf::io::table_with_metadata>(cudf::io::read_json(options.build()));
+    } catch (const std::exception& e)
+    {
+        LOG(ERROR) << "Error occurred converting HTTP payload to Dataframe: " << e.what();
+        return nullptr;
+    }
+}
+
 void HttpServerSourceStage::source_generator(rxcpp::subscriber<HttpServerSourceStage::source_type_t> subscriber)
 {
     // only check if the server is running when the queue is empty, allowing all queued messages to be processed prior
@@ -153,21 +189,112 @@ void HttpServerSourceStage::source_generator(rxcpp::subscriber<HttpServerSourceS
     bool queue_closed   = false;
     while (subscriber.is_subscribed() && server_running && !queue_closed)
     {
-        table_t table_ptr{nullptr};
-        auto queue_status = m_queue.try_pop(table_ptr);
+        payload_t payload{nullptr};
+        auto queue_status = m_queue.try_pop(payload);
         if (queue_status == boost::fibers::channel_op_status::success)
         {
             // NOLINTNEXTLINE(clang-diagnostic-unused-value)
-            DCHECK_NOTNULL(table_ptr);
-            try
+            DCHECK_NOTNULL(payload);
+            m_queue_gauge.dequeue();
+
+            // Coalescing window: drain the burst of raw bodies that queued up behind this one so the whole
+            // window costs a single read_json and a single emitted message instead of one per request
+            std::vector<payload_t> payloads;
+            payloads.emplace_back(std::move(payload));
+
+            while (m_queue.try_pop(payload) == boost::fibers::channel_op_status::success)
+            {
+                // NOLINTNEXTLINE(clang-diagnostic-unused-value)
+                DCHECK_NOTNULL(payload);
+                m_queue_gauge.dequeue();
+                payloads.emplace_back(std::move(payload));
+            }
+
+            std::vector<table_t> tables;
+
+            if (payloads.size() == 1)
+            {
+                // Single-body window: parse the queued buffer in place, no join copy
+                auto table = parse_payload(*payloads.front());
+                if (table)
+                {
+                    tables.emplace_back(std::move(table));
+                }
+            }
+            else if (m_lines)
+            {
+                // In lines mode the window can be joined textually and parsed in one pass
+                std::size_t window_size = 0;
+                for (const auto& body : payloads)
+                {
+                    window_size += body->size() + 1;
+                }
+
+                std::string window;
+                window.reserve(window_size);
+
+                for (const auto& body : payloads)
+                {
+                    window += *body;
+                    if (m_lines && !window.empty() && window.back() != '\n')
+                    {
+                        window += '\n';
+                    }
+                }
+
+                auto table = parse_payload(window);
+                if (table)
+                {
+                    tables.emplace_back(std::move(table));
+                }
+            }
+            else
             {
-                auto message     = MessageMeta::create_from_cpp(std::move(*table_ptr), 0);
-                auto num_records = message->count();
-                subscriber.on_next(std::move(message));
-                m_records_emitted += num_records;
-            } catch (const std::exception& e)
+                // Stand-alone JSON documents cannot be joined textually, parse each body and combine the tables
+                for (const auto& body : payloads)
+                {
+                    auto table = parse_payload(*body);
+                    if (table)
+                    {
+                        tables.emplace_back(std::move(table));
+                    }
+                }
+
+                if (tables.size() > 1)
+                {
+                    // Payloads on one endpoint usually share a schema, combine the window into a single
+                    // dataframe so the downstream sees one message. Mixed schemas cannot be combined, emit
+                    // those individually
+                    try
+                    {
+                        std::vector<cudf::table_view> views;
+                        views.reserve(tables.size());
+                        for (const auto& table : tables)
+                        {
+                            views.emplace_back(table->tbl->view());
+                        }
+
+                        tables.front()->tbl = cudf::concatenate(views);
+                        tables.resize(1);
+                    } catch (const std::exception& e)
+                    {
+                        DLOG(WARNING) << "Unable to combine " << tables.size() << " HTTP payloads: " << e.what();
+                    }
+                }
+            }
+
+            for (auto& table : tables)
             {
-                LOG(ERROR) << "Error occurred converting HTTP payload to Dataframe: " << e.what();
+                try
+                {
+                    auto message     = MessageMeta::create_from_cpp(std::move(*table), 0);
+                    auto num_records = message->count();
+                    subscriber.on_next(std::move(message));
+                    m_records_emitted += num_records;
+                } catch (const std::exception& e)
+                {
+                    LOG(ERROR) << "Error occurred converting HTTP payload to Dataframe: " << e.what();
+                }
             }
 
             if (m_stop_after > 0 && m_records_emitted >= m_stop_after)
@@ -230,7 +357,9 @@ std::shared_ptr<mrc::segment::Object<HttpServerSourceStage>> HttpServerSourceSta
     std::size_t max_payload_size,
     int64_t request_timeout,
     bool lines,
-    std::size_t stop_after)
+    std::size_t stop_after,
+    bool reuse_port,
+    TableSchema schema)
 {
     return builder.construct_object<HttpServerSourceStage>(
 
@@ -247,6 +376,8 @@ std::shared_ptr<mrc::segment::Object<HttpServerSourceStage>> HttpServerSourceSta
         max_payload_size,
         std::chrono::seconds(request_timeout),
         lines,
-        stop_after);
+        stop_after,
+        reuse_port,
+        std::move(schema));
 }
 }  // namespace morpheus
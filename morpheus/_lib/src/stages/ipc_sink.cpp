@@ -0,0 +1,197 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/ipc_sink.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <cuda_runtime.h>
+#include <fcntl.h>              // for O_CREAT, O_RDWR
+#include <glog/logging.h>
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
+#include <mrc/segment/builder.hpp>
+#include <rmm/device_buffer.hpp>
+#include <sys/mman.h>  // for mmap, shm_open
+#include <unistd.h>    // for close, ftruncate
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>  // for memcpy
+#include <exception>
+#include <memory>
+#include <sstream>  // IWYU pragma: keep for MORPHEUS_CONCAT_STR
+#include <stdexcept>
+#include <string>
+#include <thread>  // for sleep_for
+#include <utility>
+#include <vector>
+
+namespace {
+
+// How long to sleep between polls while waiting for the importer
+constexpr auto SlotPollInterval = std::chrono::microseconds(100);
+
+}  // namespace
+
+namespace morpheus {
+// Component public implementations
+// ************ IpcSinkStage ************* //
+IpcSinkStage::IpcSinkStage(std::string shm_name, std::size_t shm_size) :
+  PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
+  m_shm_name(std::move(shm_name)),
+  m_shm_size(shm_size)
+{
+    if (m_shm_size <= sizeof(ipc::SlotHeader))
+    {
+        throw std::invalid_argument("shm_size must be larger than the slot header");
+    }
+
+    open_shm();
+}
+
+IpcSinkStage::~IpcSinkStage()
+{
+    close();
+}
+
+void IpcSinkStage::open_shm()
+{
+    // Either side of the pair may start first, so both create the segment; the zero-filled initial state is
+    // SlotState::EMPTY
+    m_shm_fd = shm_open(m_shm_name.c_str(), O_CREAT | O_RDWR, 0600);
+
+    if (m_shm_fd < 0 || ftruncate(m_shm_fd, static_cast<off_t>(m_shm_size)) != 0)
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Failed to create shared memory segment: " << m_shm_name));
+    }
+
+    auto* mapped = mmap(nullptr, m_shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_shm_fd, 0);
+
+    if (mapped == MAP_FAILED)
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Failed to map shared memory segment: " << m_shm_name));
+    }
+
+    m_header = static_cast<ipc::SlotHeader*>(mapped);
+}
+
+void IpcSinkStage::wait_for_consumed()
+{
+    if (m_staging == nullptr)
+    {
+        return;
+    }
+
+    while (m_header->state.load(std::memory_order_acquire) == static_cast<uint32_t>(ipc::SlotState::READY))
+    {
+        std::this_thread::sleep_for(SlotPollInterval);
+    }
+
+    MRC_CHECK_CUDA(cudaFree(m_staging));
+    m_staging = nullptr;
+}
+
+void IpcSinkStage::export_message(sink_type_t& msg)
+{
+    auto packed = msg->pack();
+
+    // Newline-join the names, the importer splits on the same delimiter
+    std::string names;
+    for (const auto& name : packed.column_names)
+    {
+        names += name;
+        names += '\n';
+    }
+
+    const auto payload_size = packed.metadata->size() + names.size();
+
+    if (sizeof(ipc::SlotHeader) + payload_size > m_shm_size)
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Table transport form (" << payload_size
+                                                                              << " bytes) exceeds the shared memory "
+                                                                                 "segment, increase shm_size"));
+    }
+
+    // Release the previous message before overwriting the slot
+    wait_for_consumed();
+
+    // IPC handles require a dedicated CUDA allocation, pool sub-allocations cannot be exported. Stage the
+    // packed device data into one; it is freed once the importer acknowledges
+    MRC_CHECK_CUDA(cudaMalloc(&m_staging, packed.gpu_data->size()));
+    MRC_CHECK_CUDA(cudaMemcpy(m_staging, packed.gpu_data->data(), packed.gpu_data->size(), cudaMemcpyDeviceToDevice));
+    MRC_CHECK_CUDA(cudaIpcGetMemHandle(&m_header->gpu_handle, m_staging));
+
+    auto* payload = reinterpret_cast<char*>(m_header + 1);
+    std::memcpy(payload, packed.metadata->data(), packed.metadata->size());
+    std::memcpy(payload + packed.metadata->size(), names.data(), names.size());
+
+    m_header->magic           = ipc::SLOT_MAGIC;
+    m_header->gpu_size        = packed.gpu_data->size();
+    m_header->metadata_size   = static_cast<uint32_t>(packed.metadata->size());
+    m_header->names_size      = static_cast<uint32_t>(names.size());
+    m_header->index_col_count = packed.index_col_count;
+
+    m_header->state.store(static_cast<uint32_t>(ipc::SlotState::READY), std::memory_order_release);
+}
+
+void IpcSinkStage::close()
+{
+    if (m_header != nullptr)
+    {
+        munmap(m_header, m_shm_size);
+        m_header = nullptr;
+    }
+
+    if (m_shm_fd >= 0)
+    {
+        ::close(m_shm_fd);
+        m_shm_fd = -1;
+    }
+}
+
+IpcSinkStage::subscribe_fn_t IpcSinkStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t msg) {
+                this->export_message(msg);
+
+                output.on_next(std::move(msg));
+            },
+            [&](std::exception_ptr error_ptr) {
+                output.on_error(error_ptr);
+            },
+            [this, &output]() {
+                // Let the importer drain the last message, then signal the end of the stream
+                this->wait_for_consumed();
+                m_header->state.store(static_cast<uint32_t>(ipc::SlotState::DONE), std::memory_order_release);
+
+                output.on_completed();
+            }));
+    };
+}
+
+// ************ IpcSinkStageInterfaceProxy ************* //
+std::shared_ptr<mrc::segment::Object<IpcSinkStage>> IpcSinkStageInterfaceProxy::init(mrc::segment::Builder& builder,
+                                                                                     const std::string& name,
+                                                                                     std::string shm_name,
+                                                                                     std::size_t shm_size)
+{
+    return builder.construct_object<IpcSinkStage>(name, std::move(shm_name), shm_size);
+}
+}  // namespace morpheus
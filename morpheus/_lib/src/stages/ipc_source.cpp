@@ -0,0 +1,183 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/ipc_source.hpp"
+
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+
+#include <cuda_runtime.h>
+#include <fcntl.h>  // for O_CREAT, O_RDWR
+#include <glog/logging.h>
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
+#include <mrc/segment/builder.hpp>
+#include <sys/mman.h>  // for mmap, shm_open, shm_unlink
+#include <unistd.h>    // for close, ftruncate
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <sstream>  // IWYU pragma: keep for MORPHEUS_CONCAT_STR
+#include <stdexcept>
+#include <string>
+#include <thread>  // for sleep_for
+#include <utility>
+#include <vector>
+
+namespace morpheus {
+// Component public implementations
+// ************ IpcSourceStage ************* //
+IpcSourceStage::IpcSourceStage(std::string shm_name, std::size_t shm_size, int64_t poll_interval_us) :
+  PythonSource(build()),
+  m_shm_name(std::move(shm_name)),
+  m_shm_size(shm_size),
+  m_poll_interval_us(poll_interval_us)
+{
+    if (m_shm_size <= sizeof(ipc::SlotHeader))
+    {
+        throw std::invalid_argument("shm_size must be larger than the slot header");
+    }
+
+    open_shm();
+}
+
+IpcSourceStage::~IpcSourceStage()
+{
+    close();
+}
+
+void IpcSourceStage::open_shm()
+{
+    // Either side of the pair may start first, so both create the segment; the zero-filled initial state is
+    // SlotState::EMPTY
+    m_shm_fd = shm_open(m_shm_name.c_str(), O_CREAT | O_RDWR, 0600);
+
+    if (m_shm_fd < 0 || ftruncate(m_shm_fd, static_cast<off_t>(m_shm_size)) != 0)
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Failed to create shared memory segment: " << m_shm_name));
+    }
+
+    auto* mapped = mmap(nullptr, m_shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_shm_fd, 0);
+
+    if (mapped == MAP_FAILED)
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Failed to map shared memory segment: " << m_shm_name));
+    }
+
+    m_header = static_cast<ipc::SlotHeader*>(mapped);
+}
+
+std::shared_ptr<MessageMeta> IpcSourceStage::import_message()
+{
+    CHECK(m_header->magic == ipc::SLOT_MAGIC) << "Corrupt IPC slot in segment " << m_shm_name;
+
+    const auto* payload = reinterpret_cast<const char*>(m_header + 1);
+
+    // Split the newline-joined column names written by the exporter
+    std::vector<std::string> column_names;
+    {
+        const std::string names(payload + m_header->metadata_size, m_header->names_size);
+
+        std::size_t start = 0;
+        for (auto end = names.find('\n'); end != std::string::npos; end = names.find('\n', start))
+        {
+            column_names.push_back(names.substr(start, end - start));
+            start = end + 1;
+        }
+    }
+
+    // Map the exporter's staged device allocation; create_from_packed copies it into columns this process
+    // owns, so the mapping is released before acknowledging
+    void* gpu_data = nullptr;
+    MRC_CHECK_CUDA(cudaIpcOpenMemHandle(&gpu_data, m_header->gpu_handle, cudaIpcMemLazyEnablePeerAccess));
+
+    std::shared_ptr<MessageMeta> meta;
+    try
+    {
+        meta = MessageMeta::create_from_packed(reinterpret_cast<const uint8_t*>(payload),
+                                               static_cast<const uint8_t*>(gpu_data),
+                                               m_header->index_col_count,
+                                               column_names);
+    } catch (...)
+    {
+        cudaIpcCloseMemHandle(gpu_data);
+        throw;
+    }
+
+    MRC_CHECK_CUDA(cudaIpcCloseMemHandle(gpu_data));
+
+    m_header->state.store(static_cast<uint32_t>(ipc::SlotState::CONSUMED), std::memory_order_release);
+
+    return meta;
+}
+
+void IpcSourceStage::close()
+{
+    if (m_header != nullptr)
+    {
+        munmap(m_header, m_shm_size);
+        m_header = nullptr;
+    }
+
+    if (m_shm_fd >= 0)
+    {
+        ::close(m_shm_fd);
+        m_shm_fd = -1;
+    }
+}
+
+IpcSourceStage::subscriber_fn_t IpcSourceStage::build()
+{
+    return [this](rxcpp::subscriber<source_type_t> output) {
+        const auto poll_interval = std::chrono::microseconds(m_poll_interval_us);
+
+        while (output.is_subscribed())
+        {
+            const auto state = m_header->state.load(std::memory_order_acquire);
+
+            if (state == static_cast<uint32_t>(ipc::SlotState::READY))
+            {
+                output.on_next(import_message());
+            }
+            else if (state == static_cast<uint32_t>(ipc::SlotState::DONE))
+            {
+                // The exporter is finished; remove the name so a future pair starts from a fresh segment
+                shm_unlink(m_shm_name.c_str());
+                break;
+            }
+            else
+            {
+                std::this_thread::sleep_for(poll_interval);
+            }
+        }
+
+        output.on_completed();
+    };
+}
+
+// ************ IpcSourceStageInterfaceProxy ************* //
+std::shared_ptr<mrc::segment::Object<IpcSourceStage>> IpcSourceStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string shm_name,
+    std::size_t shm_size,
+    int64_t poll_interval_us)
+{
+    return builder.construct_object<IpcSourceStage>(name, std::move(shm_name), shm_size, poll_interval_us);
+}
+}  // namespace morpheus
@@ -0,0 +1,229 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/kafka_sink.hpp"
+
+#include "mrc/segment/builder.hpp"
+#include "mrc/segment/object.hpp"
+
+#include "morpheus/io/serializers.hpp"
+#include "morpheus/utilities/string_util.hpp"
+
+#include <boost/fiber/operations.hpp>  // for sleep_for
+#include <glog/logging.h>
+#include <librdkafka/rdkafkacpp.h>
+
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <sstream>
+#include <stdexcept>  // for invalid_argument
+#include <string>
+#include <utility>  // for move
+
+namespace morpheus {
+
+// Component-private classes.
+// ************ KafkaSinkStage__DeliveryReport ***********************//
+class KafkaSinkStage__DeliveryReport : public RdKafka::DeliveryReportCb  // NOLINT
+{
+  public:
+    void dr_cb(RdKafka::Message& message) override
+    {
+        if (message.err() != RdKafka::ERR_NO_ERROR)
+        {
+            LOG(ERROR) << "Kafka message delivery failed: " << message.errstr();
+        }
+    }
+};
+
+// Component public implementations
+// ************ KafkaSinkStage ******************************* //
+KafkaSinkStage::KafkaSinkStage(std::string topic,
+                               std::map<std::string, std::string> config,
+                               FileTypes file_type,
+                               bool include_index_col,
+                               std::size_t max_queue_retries) :
+  PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
+  m_topic(std::move(topic)),
+  m_config(std::move(config)),
+  m_file_type(file_type),
+  m_include_index_col(include_index_col),
+  m_max_queue_retries(max_queue_retries)
+{
+    if (m_file_type != FileTypes::JSON && m_file_type != FileTypes::CSV && m_file_type != FileTypes::ARROW)
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR(
+            "KafkaSinkStage only supports JSON, CSV and ARROW serialization. File type: " << file_type));
+    }
+}
+
+std::unique_ptr<RdKafka::Producer> KafkaSinkStage::create_producer(RdKafka::DeliveryReportCb& delivery_cb)
+{
+    // Copy the config and set some batching-friendly defaults if they dont exist
+    std::map<std::string, std::string> config_out(m_config);
+
+    std::map<std::string, std::string> defaults{
+        {"linger.ms", "5"}, {"batch.num.messages", "10000"}, {"max.in.flight.requests.per.connection", "5"}};
+
+    config_out.merge(defaults);
+
+    auto kafka_conf = std::unique_ptr<RdKafka::Conf>(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
+
+    std::string errstr;
+    for (auto const& key_value : config_out)
+    {
+        if (RdKafka::Conf::ConfResult::CONF_OK != kafka_conf->set(key_value.first, key_value.second, errstr))
+        {
+            LOG(ERROR) << "Error occurred while setting Kafka configuration. Error: " << errstr;
+        }
+    }
+
+    if (RdKafka::Conf::ConfResult::CONF_OK != kafka_conf->set("dr_cb", &delivery_cb, errstr))
+    {
+        LOG(FATAL) << "Error occurred while setting Kafka delivery report function. Error: " << errstr;
+    }
+
+    auto producer = std::unique_ptr<RdKafka::Producer>(RdKafka::Producer::create(kafka_conf.get(), errstr));
+
+    if (!producer)
+    {
+        LOG(FATAL) << "Error occurred creating Kafka producer. Error: " << errstr;
+    }
+
+    return producer;
+}
+
+void KafkaSinkStage::produce_message(RdKafka::Producer& producer, sink_type_t& msg)
+{
+    auto table_info = msg->get_info();
+
+    if (m_file_type == FileTypes::ARROW)
+    {
+        // One binary Arrow IPC payload per batch with the schema embedded, consumers decode it without text
+        // parsing and the payload is a fraction of the JSON bytes
+        produce_payload(producer, df_to_arrow_ipc(table_info, m_include_index_col));
+
+        producer.poll(0);
+        return;
+    }
+
+    // Serialize the whole table once, then produce line-by-line. librdkafka coalesces the individual produce calls
+    // according to linger.ms/batch.num.messages, so no broker round trip happens per row
+    auto buffer = m_file_type == FileTypes::JSON ? df_to_json(table_info, m_include_index_col)
+                                                 : df_to_csv(table_info, false, m_include_index_col);
+
+    std::istringstream lines(buffer);
+    std::string line;
+
+    while (std::getline(lines, line))
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+
+        produce_payload(producer, line);
+    }
+
+    // Serve any queued delivery report callbacks without blocking
+    producer.poll(0);
+}
+
+void KafkaSinkStage::produce_payload(RdKafka::Producer& producer, const std::string& payload)
+{
+    std::size_t retries = 0;
+
+    while (true)
+    {
+        auto err_code = producer.produce(m_topic,
+                                         RdKafka::Topic::PARTITION_UA,
+                                         RdKafka::Producer::RK_MSG_COPY,
+                                         const_cast<char*>(payload.data()),
+                                         payload.size(),
+                                         nullptr,
+                                         0,
+                                         0,
+                                         nullptr);
+
+        if (err_code == RdKafka::ERR_NO_ERROR)
+        {
+            return;
+        }
+
+        if (err_code == RdKafka::ERR__QUEUE_FULL && retries++ < m_max_queue_retries)
+        {
+            // Serve delivery reports to drain the queue, then retry
+            producer.poll(10);
+            continue;
+        }
+
+        LOG(ERROR) << "Failed to produce Kafka message: " << RdKafka::err2str(err_code);
+        return;
+    }
+}
+
+KafkaSinkStage::subscribe_fn_t KafkaSinkStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        auto delivery_cb = std::make_shared<KafkaSinkStage__DeliveryReport>();
+        auto producer    = std::shared_ptr<RdKafka::Producer>(this->create_producer(*delivery_cb));
+
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, producer, delivery_cb, &output](sink_type_t msg) {
+                try
+                {
+                    this->produce_message(*producer, msg);
+                } catch (std::exception& ex)
+                {
+                    LOG(ERROR) << "Exception while producing to Kafka. Msg: " << ex.what();
+                }
+
+                output.on_next(std::move(msg));
+            },
+            [producer, &output](std::exception_ptr error_ptr) {
+                producer->flush(10000);
+                output.on_error(error_ptr);
+            },
+            [producer, &output]() {
+                // Block until everything in flight has been acknowledged before completing
+                auto err_code = producer->flush(10000);
+                if (err_code != RdKafka::ERR_NO_ERROR)
+                {
+                    LOG(ERROR) << "Timed out flushing Kafka producer: " << RdKafka::err2str(err_code);
+                }
+
+                output.on_completed();
+            }));
+    };
+}
+
+// ************ KafkaSinkStageInterfaceProxy ************ //
+std::shared_ptr<mrc::segment::Object<KafkaSinkStage>> KafkaSinkStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string topic,
+    std::map<std::string, std::string> config,
+    FileTypes file_type,
+    bool include_index_col,
+    std::size_t max_queue_retries)
+{
+    return builder.construct_object<KafkaSinkStage>(
+        name, std::move(topic), std::move(config), file_type, include_index_col, max_queue_retries);
+}
+
+}  // namespace morpheus
@@ -23,13 +23,25 @@
 #include "mrc/segment/object.hpp"
 #include "pymrc/utilities/function_wrappers.hpp"  // for PyFuncWrapper
 
+#include "morpheus/io/deserializers.hpp"  // for filter_table_columns, load_json_lines_host, sort_table_by_column
 #include "morpheus/messages/meta.hpp"
+#include "morpheus/objects/dtype.hpp"  // for schema_to_cudf_dtypes
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
 #include "morpheus/utilities/stage_util.hpp"
 #include "morpheus/utilities/string_util.hpp"
 
+#include <boost/fiber/buffered_channel.hpp>  // for buffered_channel
+#include <boost/fiber/channel_op_status.hpp>
+#include <boost/fiber/fiber.hpp>
 #include <boost/fiber/operations.hpp>  // for sleep_for, yield
 #include <boost/fiber/recursive_mutex.hpp>
+#include <cudf/concatenate.hpp>  // for concatenate
+#include <cudf/io/avro.hpp>
 #include <cudf/io/json.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/span.hpp>  // for host_span
 #include <glog/logging.h>
 #include <librdkafka/rdkafkacpp.h>
 #include <mrc/runnable/context.hpp>
@@ -41,6 +53,7 @@
 #include <pymrc/node.hpp>
 
 #include <algorithm>  // for find, min, transform
+#include <atomic>     // for atomic
 #include <chrono>
 #include <compare>
 #include <cstdint>
@@ -54,12 +67,11 @@
 #include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <thread>  // for thread
 #include <tuple>
 #include <type_traits>
 #include <utility>
-// IWYU thinks we need atomic for vector.emplace_back of a unique_ptr
-// and __alloc_traits<>::value_type for vector assignments
-// IWYU pragma: no_include <atomic>
+// IWYU thinks we need __alloc_traits<>::value_type for vector assignments
 // IWYU pragma: no_include <ext/alloc_traits.h>
 
 #if !defined(DOXYGEN_SHOULD_SKIP_THIS)
@@ -81,21 +93,107 @@
 
 namespace morpheus {
 
-KafkaOAuthCallback::KafkaOAuthCallback(const std::function<std::map<std::string, std::string>()>& oauth_callback) :
-  m_oauth_callback(oauth_callback)
+KafkaOAuthCallback::KafkaOAuthCallback(std::function<std::map<std::string, std::string>()> oauth_callback) :
+  m_oauth_callback(std::move(oauth_callback))
 {}
 
+KafkaOAuthCallback::~KafkaOAuthCallback()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_refresh_cv.notify_all();
+
+    if (m_refresher.joinable())
+    {
+        m_refresher.join();
+    }
+}
+
+KafkaOAuthCallback::Token KafkaOAuthCallback::fetch_token() const
+{
+    auto response = m_oauth_callback();
+
+    return {response["token"], std::stoll(response["token_expiration_in_epoch"])};
+}
+
+void KafkaOAuthCallback::refresher_main()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop)
+    {
+        // Wake at 80% of the cached token's remaining lifetime. librdkafka re-fires the consume-side callback
+        // around the same time and must find a fresh token already waiting.
+        const auto now = std::chrono::system_clock::now();
+        const auto expires_at =
+            std::chrono::system_clock::time_point(std::chrono::milliseconds(m_token.expires_at_epoch_ms));
+        const auto refresh_at = now + (expires_at - now) * 4 / 5;
+
+        if (m_refresh_cv.wait_until(lock, refresh_at, [this] {
+                return m_stop;
+            }))
+        {
+            return;
+        }
+
+        lock.unlock();
+
+        Token token;
+        try
+        {
+            token = this->fetch_token();
+        } catch (std::exception& ex)
+        {
+            LOG(ERROR) << "Exception occurred refreshing oauth token: " << ex.what();
+
+            // Leave the stale token in place, the consume-side callback falls back to a synchronous fetch once
+            // it actually expires
+            lock.lock();
+            continue;
+        }
+
+        lock.lock();
+        m_token = std::move(token);
+    }
+}
+
 void KafkaOAuthCallback::oauthbearer_token_refresh_cb(RdKafka::Handle* handle, const std::string& oauthbearer_config)
 {
     try
     {
-        auto response = m_oauth_callback();
-        // Build parameters to pass to librdkafka
-        std::string token         = response["token"];
-        int64_t token_lifetime_ms = std::stoll(response["token_expiration_in_epoch"]);
+        Token token;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            const auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                    std::chrono::system_clock::now().time_since_epoch())
+                                    .count();
+
+            if (m_token.value.empty() || m_token.expires_at_epoch_ms <= now_ms)
+            {
+                // First use, or the refresher fell behind: fetch synchronously, then keep the cache warm from a
+                // background thread so later refreshes never run Python on the consume thread
+                lock.unlock();
+                auto fetched = this->fetch_token();
+                lock.lock();
+
+                m_token = std::move(fetched);
+
+                if (!m_refresher.joinable())
+                {
+                    m_refresher = std::thread(&KafkaOAuthCallback::refresher_main, this);
+                }
+            }
+
+            token = m_token;
+        }
+
         std::list<std::string> extensions;  // currently not supported
         std::string errstr;
-        auto result = handle->oauthbearer_set_token(token, token_lifetime_ms, "kafka", extensions, errstr);
+        auto result =
+            handle->oauthbearer_set_token(token.value, token.expires_at_epoch_ms, "kafka", extensions, errstr);
         CHECK(result == RdKafka::ErrorCode::ERR_NO_ERROR) << "Error occurred while setting the oauthbearer token";
     } catch (std::exception ex)
     {
@@ -103,6 +201,50 @@ void KafkaOAuthCallback::oauthbearer_token_refresh_cb(RdKafka::Handle* handle, c
     }
 }
 
+bool KafkaMessageFilter::empty() const
+{
+    return allowed_keys.empty() && required_headers.empty();
+}
+
+bool KafkaMessageFilter::matches(const RdKafka::Message& message) const
+{
+    if (!allowed_keys.empty())
+    {
+        const auto* key = message.key();
+        if (key == nullptr || std::find(allowed_keys.begin(), allowed_keys.end(), *key) == allowed_keys.end())
+        {
+            return false;
+        }
+    }
+
+    if (!required_headers.empty())
+    {
+        const auto* headers = message.headers();
+        if (headers == nullptr)
+        {
+            return false;
+        }
+
+        for (const auto& [name, value] : required_headers)
+        {
+            auto header = headers->get_last(name);
+            if (header.err() != RdKafka::ERR_NO_ERROR)
+            {
+                return false;
+            }
+
+            const auto* header_value = static_cast<const char*>(header.value());
+            if (value.size() != header.value_size() ||
+                value.compare(0, value.size(), header_value, header.value_size()) != 0)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 // Component-private classes.
 // ************ KafkaSourceStage__UnsubscribedException**************//
 class KafkaSourceStageUnsubscribedException : public std::exception
@@ -115,10 +257,11 @@ class KafkaSourceStageStopAfter : public std::exception
 class KafkaSourceStage__Rebalancer : public RdKafka::RebalanceCb  // NOLINT
 {
   public:
-    KafkaSourceStage__Rebalancer(std::function<uint32_t()> batch_timeout_fn,
-                                 std::function<TensorIndex()> max_batch_size_fn,
-                                 std::function<std::string(std::string)> display_str_fn,
-                                 std::function<bool(std::vector<std::unique_ptr<RdKafka::Message>>&)> process_fn);
+    KafkaSourceStage__Rebalancer(
+        std::function<std::string(std::string)> display_str_fn,
+        std::function<bool(std::vector<std::unique_ptr<RdKafka::Message>>&)> process_fn,
+        std::function<std::vector<std::unique_ptr<RdKafka::Message>>(const KafkaSourceStage::consume_fn_t&)>
+            accumulate_fn);
 
     void rebalance_cb(RdKafka::KafkaConsumer* consumer,
                       RdKafka::ErrorCode err,
@@ -130,47 +273,11 @@ class KafkaSourceStage__Rebalancer : public RdKafka::RebalanceCb  // NOLINT
 
     std::vector<std::unique_ptr<RdKafka::Message>> partition_progress_step(RdKafka::KafkaConsumer* consumer)
     {
-        // auto batch_timeout = std::chrono::milliseconds(m_parent.batch_timeout_ms());
-        auto batch_timeout = std::chrono::milliseconds(m_batch_timeout_fn());
-
-        std::vector<std::unique_ptr<RdKafka::Message>> messages;
-
-        auto now       = std::chrono::high_resolution_clock::now();
-        auto batch_end = now + batch_timeout;
-
-        do
-        {
-            auto remaining_ms = std::chrono::duration_cast<std::chrono::milliseconds>(batch_end - now).count();
-
-            DCHECK(remaining_ms >= 0) << "Cant have negative reminaing time";
-
-            std::unique_ptr<RdKafka::Message> msg{consumer->consume(std::min(10L, remaining_ms))};
-
-            switch (msg->err())
-            {
-            case RdKafka::ERR__TIMED_OUT:
-                // Yield on a timeout
-                boost::this_fiber::yield();
-                break;
-            case RdKafka::ERR_NO_ERROR:
-
-                messages.emplace_back(std::move(msg));
-                break;
-            case RdKafka::ERR__PARTITION_EOF:
-                VLOG_EVERY_N(10, 10) << "Hit EOF for partition";
-                // Hit the end, sleep for 100 ms
-                boost::this_fiber::sleep_for(std::chrono::milliseconds(100));
-                break;
-            default:
-                /* Errors */
-                LOG(ERROR) << "Consume failed: " << msg->errstr();
-            }
-
-            // Update now
-            now = std::chrono::high_resolution_clock::now();
-        } while (messages.size() < m_max_batch_size_fn() && now < batch_end);
-
-        return std::move(messages);
+        // The accumulation loop itself lives on the stage (`accumulate_batch`), all this adds is the binding to
+        // a live consumer
+        return m_accumulate_fn([consumer](long max_wait_ms) {
+            return std::unique_ptr<RdKafka::Message>(consumer->consume(static_cast<int>(max_wait_ms)));
+        });
     }
 
     bool process_messages(std::vector<std::unique_ptr<RdKafka::Message>>& messages)
@@ -181,24 +288,23 @@ class KafkaSourceStage__Rebalancer : public RdKafka::RebalanceCb  // NOLINT
   private:
     bool m_is_rebalanced{false};
 
-    std::function<uint32_t()> m_batch_timeout_fn;
-    std::function<TensorIndex()> m_max_batch_size_fn;
     std::function<std::string(std::string)> m_display_str_fn;
     std::function<bool(std::vector<std::unique_ptr<RdKafka::Message>>&)> m_process_fn;
+    std::function<std::vector<std::unique_ptr<RdKafka::Message>>(const KafkaSourceStage::consume_fn_t&)>
+        m_accumulate_fn;
 
     boost::fibers::recursive_mutex m_mutex;
     mrc::SharedFuture<bool> m_partition_future;
 };
 
 KafkaSourceStage__Rebalancer::KafkaSourceStage__Rebalancer(
-    std::function<uint32_t()> batch_timeout_fn,
-    std::function<TensorIndex()> max_batch_size_fn,
     std::function<std::string(std::string)> display_str_fn,
-    std::function<bool(std::vector<std::unique_ptr<RdKafka::Message>>&)> process_fn) :
-  m_batch_timeout_fn(std::move(batch_timeout_fn)),
-  m_max_batch_size_fn(std::move(max_batch_size_fn)),
+    std::function<bool(std::vector<std::unique_ptr<RdKafka::Message>>&)> process_fn,
+    std::function<std::vector<std::unique_ptr<RdKafka::Message>>(const KafkaSourceStage::consume_fn_t&)>
+        accumulate_fn) :
   m_display_str_fn(std::move(display_str_fn)),
-  m_process_fn(std::move(process_fn))
+  m_process_fn(std::move(process_fn)),
+  m_accumulate_fn(std::move(accumulate_fn))
 {}
 
 void KafkaSourceStage__Rebalancer::rebalance_cb(RdKafka::KafkaConsumer* consumer,
@@ -284,6 +390,190 @@ class KafkaRebalancer : public RdKafka::RebalanceCb
     std::unique_ptr<RdKafka::KafkaConsumer> m_consumer;
 };
 
+// ************ KafkaSourceStage__OffsetCommitter ********************//
+/**
+ * @brief Batches per-partition high-water offsets and commits them asynchronously on an interval, with a bounded
+ * number of in-flight commit requests. Keeps broker round trips off the ingest path: a slow or failing broker delays
+ * offset durability but never stalls consumption.
+ */
+class KafkaSourceStage__OffsetCommitter : public RdKafka::OffsetCommitCb  // NOLINT
+{
+  public:
+    explicit KafkaSourceStage__OffsetCommitter(uint32_t commit_interval_ms) :
+      m_commit_interval(std::chrono::milliseconds(commit_interval_ms)),
+      m_last_commit(std::chrono::high_resolution_clock::now())
+    {}
+
+    using offset_batch_t = std::map<std::pair<std::string, int32_t>, int64_t>;
+
+    /**
+     * @brief Gather the high-water offset of each partition represented in a batch. Called before the batch is
+     * handed off for processing, since processing consumes the messages.
+     */
+    static offset_batch_t gather_offsets(const std::vector<std::unique_ptr<RdKafka::Message>>& messages)
+    {
+        offset_batch_t offsets;
+
+        for (const auto& msg : messages)
+        {
+            auto& high_water = offsets[{msg->topic_name(), msg->partition()}];
+
+            // Committed offsets point at the *next* message to consume
+            high_water = std::max(high_water, msg->offset() + 1);
+        }
+
+        return offsets;
+    }
+
+    /**
+     * @brief Synchronously commit the offsets gathered from one processed batch. The sync-commit mode must name
+     * its offsets explicitly: consumption runs ahead of processing, so committing the consumer's position would
+     * also cover prefetched batches that have not been parsed or emitted yet.
+     */
+    static void commit_batch_sync(RdKafka::KafkaConsumer* consumer, const offset_batch_t& offsets)
+    {
+        if (offsets.empty())
+        {
+            return;
+        }
+
+        std::vector<std::unique_ptr<RdKafka::TopicPartition>> toppars;
+        toppars.reserve(offsets.size());
+
+        for (const auto& [toppar, offset] : offsets)
+        {
+            toppars.emplace_back(RdKafka::TopicPartition::create(toppar.first, toppar.second, offset));
+        }
+
+        auto toppar_ptrs =
+            foreach_map(toppars, [](const std::unique_ptr<RdKafka::TopicPartition>& x) { return x.get(); });
+
+        CHECK_KAFKA(consumer->commitSync(toppar_ptrs), RdKafka::ERR_NO_ERROR, "Error during commit");
+    }
+
+    /**
+     * @brief Merge the offsets of a successfully emitted batch into the pending commit set.
+     */
+    void record_offsets(offset_batch_t&& offsets)
+    {
+        for (const auto& [toppar, offset] : offsets)
+        {
+            auto& high_water = m_pending_offsets[toppar];
+            high_water       = std::max(high_water, offset);
+        }
+    }
+
+    /**
+     * @brief Commit the pending offsets asynchronously if the commit interval has elapsed and the in-flight window
+     * has room. Safe to call once per batch.
+     */
+    void maybe_commit(RdKafka::KafkaConsumer* consumer)
+    {
+        auto now = std::chrono::high_resolution_clock::now();
+        if (m_pending_offsets.empty() || now - m_last_commit < m_commit_interval ||
+            m_inflight.load() >= MaxInflightCommits)
+        {
+            return;
+        }
+
+        auto toppars = this->take_pending_offsets();
+        auto toppar_ptrs =
+            foreach_map(toppars, [](const std::unique_ptr<RdKafka::TopicPartition>& x) { return x.get(); });
+
+        ++m_inflight;
+        CHECK_KAFKA(consumer->commitAsync(toppar_ptrs), RdKafka::ERR_NO_ERROR, "Error during batched commitAsync");
+        m_last_commit = now;
+    }
+
+    /**
+     * @brief Synchronously commit any remaining offsets. Called on shutdown/rebalance so no acknowledged work is
+     * lost.
+     */
+    void flush(RdKafka::KafkaConsumer* consumer)
+    {
+        if (m_pending_offsets.empty())
+        {
+            return;
+        }
+
+        auto toppars = this->take_pending_offsets();
+        auto toppar_ptrs =
+            foreach_map(toppars, [](const std::unique_ptr<RdKafka::TopicPartition>& x) { return x.get(); });
+
+        CHECK_KAFKA(consumer->commitSync(toppar_ptrs), RdKafka::ERR_NO_ERROR, "Error during final offset commit");
+    }
+
+    void offset_commit_cb(RdKafka::ErrorCode err, std::vector<RdKafka::TopicPartition*>& offsets) override
+    {
+        --m_inflight;
+
+        if (err != RdKafka::ERR_NO_ERROR && err != RdKafka::ERR__NO_OFFSET)
+        {
+            LOG(ERROR) << "Async offset commit failed: " << RdKafka::err2str(err);
+        }
+    }
+
+  private:
+    std::vector<std::unique_ptr<RdKafka::TopicPartition>> take_pending_offsets()
+    {
+        std::vector<std::unique_ptr<RdKafka::TopicPartition>> toppars;
+        toppars.reserve(m_pending_offsets.size());
+
+        for (const auto& [toppar, offset] : m_pending_offsets)
+        {
+            toppars.emplace_back(RdKafka::TopicPartition::create(toppar.first, toppar.second, offset));
+        }
+
+        m_pending_offsets.clear();
+        return toppars;
+    }
+
+    static constexpr int MaxInflightCommits{4};
+
+    std::map<std::pair<std::string, int32_t>, int64_t> m_pending_offsets;
+    std::chrono::milliseconds m_commit_interval;
+    std::chrono::high_resolution_clock::time_point m_last_commit;
+    std::atomic<int> m_inflight{0};
+};
+
+/**
+ * @brief Validate a user-facing payload format name, returning true for the Avro decode path.
+ */
+bool parse_payload_format(const std::string& name)
+{
+    if (name == "json")
+    {
+        return false;
+    }
+    else if (name == "avro")
+    {
+        return true;
+    }
+
+    throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unsupported payload format: " << name));
+}
+
+/**
+ * @brief Map a user-facing codec name onto the matching cudf compression type.
+ */
+cudf::io::compression_type parse_compression_type(const std::string& name)
+{
+    static const std::map<std::string, cudf::io::compression_type> CompressionTypes{
+        {"none", cudf::io::compression_type::NONE},
+        {"auto", cudf::io::compression_type::AUTO},
+        {"gzip", cudf::io::compression_type::GZIP},
+        {"snappy", cudf::io::compression_type::SNAPPY},
+        {"zstd", cudf::io::compression_type::ZSTD}};
+
+    auto found = CompressionTypes.find(name);
+    if (found == CompressionTypes.end())
+    {
+        throw std::invalid_argument(MORPHEUS_CONCAT_STR("Unsupported payload compression type: " << name));
+    }
+
+    return found->second;
+}
+
 // Component public implementations
 // ************ KafkaStage ************************* //
 KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
@@ -294,9 +584,17 @@ KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
                                    bool disable_pre_filtering,
                                    std::size_t stop_after,
                                    bool async_commits,
-                                   std::unique_ptr<KafkaOAuthCallback> oauth_callback) :
-  PythonSource(build()),
+                                   std::size_t consumer_pool_size,
+                                   std::string payload_compression,
+                                   std::string payload_format,
+                                   std::unique_ptr<KafkaOAuthCallback> oauth_callback,
+                                   std::vector<std::string> columns,
+                                   KafkaMessageFilter message_filter,
+                                   TableSchema schema,
+                                   std::string sort_by) :
+  PythonSource(consumer_pool_size > 1 ? build_pooled() : build()),
   m_max_batch_size(max_batch_size),
+  m_batch_size_target(max_batch_size),
   m_topics(std::vector<std::string>{std::move(topic)}),
   m_batch_timeout_ms(batch_timeout_ms),
   m_config(std::move(config)),
@@ -304,7 +602,14 @@ KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
   m_disable_pre_filtering(disable_pre_filtering),
   m_stop_after{stop_after},
   m_async_commits(async_commits),
-  m_oauth_callback(std::move(oauth_callback))
+  m_consumer_pool_size(consumer_pool_size),
+  m_payload_compression(parse_compression_type(payload_compression)),
+  m_payload_is_avro(parse_payload_format(payload_format)),
+  m_oauth_callback(std::move(oauth_callback)),
+  m_columns(std::move(columns)),
+  m_message_filter(std::move(message_filter)),
+  m_schema(std::move(schema)),
+  m_sort_by(std::move(sort_by))
 {}
 
 KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
@@ -315,9 +620,17 @@ KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
                                    bool disable_pre_filtering,
                                    std::size_t stop_after,
                                    bool async_commits,
-                                   std::unique_ptr<KafkaOAuthCallback> oauth_callback) :
-  PythonSource(build()),
+                                   std::size_t consumer_pool_size,
+                                   std::string payload_compression,
+                                   std::string payload_format,
+                                   std::unique_ptr<KafkaOAuthCallback> oauth_callback,
+                                   std::vector<std::string> columns,
+                                   KafkaMessageFilter message_filter,
+                                   TableSchema schema,
+                                   std::string sort_by) :
+  PythonSource(consumer_pool_size > 1 ? build_pooled() : build()),
   m_max_batch_size(max_batch_size),
+  m_batch_size_target(max_batch_size),
   m_topics(std::move(topics)),
   m_batch_timeout_ms(batch_timeout_ms),
   m_config(std::move(config)),
@@ -325,7 +638,14 @@ KafkaSourceStage::KafkaSourceStage(TensorIndex max_batch_size,
   m_disable_pre_filtering(disable_pre_filtering),
   m_stop_after{stop_after},
   m_async_commits(async_commits),
-  m_oauth_callback(std::move(oauth_callback))
+  m_consumer_pool_size(consumer_pool_size),
+  m_payload_compression(parse_compression_type(payload_compression)),
+  m_payload_is_avro(parse_payload_format(payload_format)),
+  m_oauth_callback(std::move(oauth_callback)),
+  m_columns(std::move(columns)),
+  m_message_filter(std::move(message_filter)),
+  m_schema(std::move(schema)),
+  m_sort_by(std::move(sort_by))
 {}
 
 KafkaSourceStage::subscriber_fn_t KafkaSourceStage::build()
@@ -334,8 +654,6 @@ KafkaSourceStage::subscriber_fn_t KafkaSourceStage::build()
         std::size_t records_emitted = 0;
         // Build rebalancer
         KafkaSourceStage__Rebalancer rebalancer(
-            [this]() { return this->batch_timeout_ms(); },
-            [this]() { return this->max_batch_size(); },
             [this](const std::string str_to_display) {
                 auto& ctx = mrc::runnable::Context::get_runtime_context();
                 return MORPHEUS_CONCAT_STR(ctx.info() << " " << str_to_display);
@@ -372,22 +690,57 @@ KafkaSourceStage::subscriber_fn_t KafkaSourceStage::build()
                 sub.on_next(std::move(batch));
                 records_emitted += num_records;
                 return m_requires_commit;
-            });
+            },
+            [this](const consume_fn_t& consume_fn) { return this->accumulate_batch(consume_fn); });
 
         auto& context = mrc::runnable::Context::get_runtime_context();
 
+        // Commit at most once per interval, never from the ingest path
+        KafkaSourceStage__OffsetCommitter committer{std::max(1000U, m_batch_timeout_ms)};
+
         // Build consumer
-        auto consumer = this->create_consumer(rebalancer);
+        auto consumer = this->create_consumer(rebalancer, m_async_commits ? &committer : nullptr);
 
         // Wait for all to connect
         context.barrier();
 
+        // Two usable slots: accumulation of batch N+1 overlaps the cudf parse of batch N, hiding the parse latency
+        // behind network receive time. librdkafka handles are thread safe, so consumption runs on a dedicated
+        // thread while parse and emit stay on the progress engine's fiber
+        boost::fibers::buffered_channel<std::vector<std::unique_ptr<RdKafka::Message>>> prefetch_channel{4};
+
+        std::thread consume_thread([&]() {
+            while (sub.is_subscribed())
+            {
+                auto message_batch = rebalancer.partition_progress_step(consumer.get());
+
+                if (message_batch.empty())
+                {
+                    continue;
+                }
+
+                if (prefetch_channel.push(std::move(message_batch)) != boost::fibers::channel_op_status::success)
+                {
+                    // Channel was closed by the parse loop, shut down
+                    break;
+                }
+            }
+
+            prefetch_channel.close();
+        });
+
         try
         {
-            while (sub.is_subscribed())
+            std::vector<std::unique_ptr<RdKafka::Message>> message_batch;
+            while (prefetch_channel.pop(message_batch) == boost::fibers::channel_op_status::success)
             {
-                std::vector<std::unique_ptr<RdKafka::Message>> message_batch =
-                    rebalancer.partition_progress_step(consumer.get());
+                // Both commit modes need the batch's own offsets: the consume thread runs ahead of this loop, so
+                // the consumer position includes prefetched batches that have not been processed yet
+                auto batch_offsets = m_requires_commit
+                                         ? KafkaSourceStage__OffsetCommitter::gather_offsets(message_batch)
+                                         : KafkaSourceStage__OffsetCommitter::offset_batch_t{};
+
+                this->adapt_batch_size(message_batch.size());
 
                 // Process the messages. Returns true if we need to commit
                 auto should_commit = rebalancer.process_messages(message_batch);
@@ -396,11 +749,12 @@ KafkaSourceStage::subscriber_fn_t KafkaSourceStage::build()
                 {
                     if (m_async_commits)
                     {
-                        CHECK_KAFKA(consumer->commitAsync(), RdKafka::ERR_NO_ERROR, "Error during commitAsync");
+                        committer.record_offsets(std::move(batch_offsets));
+                        committer.maybe_commit(consumer.get());
                     }
                     else
                     {
-                        CHECK_KAFKA(consumer->commitSync(), RdKafka::ERR_NO_ERROR, "Error during commit");
+                        KafkaSourceStage__OffsetCommitter::commit_batch_sync(consumer.get(), batch_offsets);
                     }
                 }
             }
@@ -413,6 +767,14 @@ KafkaSourceStage::subscriber_fn_t KafkaSourceStage::build()
             LOG(ERROR) << "Exception in rebalance_loop. Msg: " << ex.what();
         }
 
+        prefetch_channel.close();
+        consume_thread.join();
+
+        if (m_requires_commit && m_async_commits)
+        {
+            committer.flush(consumer.get());
+        }
+
         consumer->unsubscribe();
         consumer->close();
         consumer.reset();
@@ -423,9 +785,268 @@ KafkaSourceStage::subscriber_fn_t KafkaSourceStage::build()
     };
 }
 
+KafkaSourceStage::subscriber_fn_t KafkaSourceStage::build_pooled()
+{
+    return [this](rxcpp::subscriber<source_type_t> sub) -> void {
+        // A consumed batch paired with the consumer which owns its offsets, so the convert/emit loop can commit on
+        // the correct handle
+        struct ConsumedBatch
+        {
+            std::vector<std::unique_ptr<RdKafka::Message>> messages;
+            RdKafka::KafkaConsumer* consumer;
+        };
+
+        auto& context = mrc::runnable::Context::get_runtime_context();
+
+        // Capacity must be a power of two. Two slots per worker keeps the consume fibers a batch ahead of the
+        // conversion path without unbounded buffering
+        std::size_t channel_capacity = 2;
+        while (channel_capacity < m_consumer_pool_size * 2)
+        {
+            channel_capacity <<= 1;
+        }
+
+        boost::fibers::buffered_channel<ConsumedBatch> channel{channel_capacity};
+        std::atomic<std::size_t> active_workers{m_consumer_pool_size};
+
+        auto display_str_fn = [&context](const std::string str_to_display) {
+            return MORPHEUS_CONCAT_STR(context.info() << " " << str_to_display);
+        };
+
+        // Each worker owns one consumer. The broker assigns each partition to exactly one consumer in the group, so
+        // per-partition ordering is preserved end-to-end
+        std::vector<std::unique_ptr<KafkaSourceStage__Rebalancer>> rebalancers;
+        std::vector<std::unique_ptr<RdKafka::KafkaConsumer>> consumers;
+        std::map<RdKafka::KafkaConsumer*, std::unique_ptr<KafkaSourceStage__OffsetCommitter>> committers;
+        std::vector<boost::fibers::fiber> workers;
+
+        for (std::size_t i = 0; i < m_consumer_pool_size; ++i)
+        {
+            rebalancers.emplace_back(std::make_unique<KafkaSourceStage__Rebalancer>(
+                display_str_fn,
+                [](std::vector<std::unique_ptr<RdKafka::Message>>& messages) {
+                    // Processing happens on the shared conversion path, not in the worker
+                    return false;
+                },
+                [this](const consume_fn_t& consume_fn) { return this->accumulate_batch(consume_fn); }));
+
+            auto committer = std::make_unique<KafkaSourceStage__OffsetCommitter>(std::max(1000U, m_batch_timeout_ms));
+
+            consumers.emplace_back(
+                this->create_consumer(*rebalancers.back(), m_async_commits ? committer.get() : nullptr));
+            committers.emplace(consumers.back().get(), std::move(committer));
+        }
+
+        // Wait for all to connect
+        context.barrier();
+
+        for (std::size_t i = 0; i < m_consumer_pool_size; ++i)
+        {
+            workers.emplace_back([&, i]() {
+                auto* consumer = consumers[i].get();
+
+                while (sub.is_subscribed())
+                {
+                    auto messages = rebalancers[i]->partition_progress_step(consumer);
+
+                    if (messages.empty())
+                    {
+                        continue;
+                    }
+
+                    if (channel.push(ConsumedBatch{std::move(messages), consumer}) !=
+                        boost::fibers::channel_op_status::success)
+                    {
+                        // Channel was closed by the conversion loop, shut down
+                        break;
+                    }
+                }
+
+                if (active_workers.fetch_sub(1) == 1)
+                {
+                    // Last worker out closes the channel to unblock the conversion loop
+                    channel.close();
+                }
+            });
+        }
+
+        std::size_t records_emitted = 0;
+
+        try
+        {
+            ConsumedBatch item;
+            while (channel.pop(item) == boost::fibers::channel_op_status::success)
+            {
+                if (!sub.is_subscribed())
+                {
+                    break;
+                }
+                else if (m_stop_after > 0 && records_emitted >= m_stop_after)
+                {
+                    throw KafkaSourceStageStopAfter();
+                }
+
+                // The worker fibers prefetch ahead of this loop, so each consumer's position covers batches that
+                // have not been converted yet. Commits in either mode must name this batch's offsets explicitly
+                auto batch_offsets = m_requires_commit
+                                         ? KafkaSourceStage__OffsetCommitter::gather_offsets(item.messages)
+                                         : KafkaSourceStage__OffsetCommitter::offset_batch_t{};
+
+                this->adapt_batch_size(item.messages.size());
+
+                std::shared_ptr<morpheus::MessageMeta> batch;
+
+                try
+                {
+                    batch = std::move(this->process_batch(std::move(item.messages)));
+                } catch (std::exception& ex)
+                {
+                    LOG(ERROR) << "Exception in process_batch. Msg: " << ex.what();
+                    continue;
+                }
+
+                auto num_records = batch->count();
+                sub.on_next(std::move(batch));
+                records_emitted += num_records;
+
+                if (m_requires_commit)
+                {
+                    if (m_async_commits)
+                    {
+                        auto& committer = committers.at(item.consumer);
+                        committer->record_offsets(std::move(batch_offsets));
+                        committer->maybe_commit(item.consumer);
+                    }
+                    else
+                    {
+                        KafkaSourceStage__OffsetCommitter::commit_batch_sync(item.consumer, batch_offsets);
+                    }
+                }
+            }
+        } catch (KafkaSourceStageStopAfter)
+        {
+            DLOG(INFO) << "Completed after emitting " << records_emitted << " records";
+        } catch (std::exception& ex)
+        {
+            LOG(ERROR) << "Exception in consumer pool conversion loop. Msg: " << ex.what();
+        }
+
+        channel.close();
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        for (auto& consumer : consumers)
+        {
+            if (m_requires_commit && m_async_commits)
+            {
+                committers.at(consumer.get())->flush(consumer.get());
+            }
+
+            consumer->unsubscribe();
+            consumer->close();
+            consumer.reset();
+        }
+
+        sub.on_completed();
+    };
+}
+
+std::vector<std::unique_ptr<RdKafka::Message>> KafkaSourceStage::accumulate_batch(const consume_fn_t& consume_fn)
+{
+    auto batch_timeout  = std::chrono::milliseconds(this->batch_timeout_ms());
+    auto max_batch_size = this->max_batch_size();
+
+    std::vector<std::unique_ptr<RdKafka::Message>> messages;
+
+    auto now       = std::chrono::high_resolution_clock::now();
+    auto batch_end = now + batch_timeout;
+
+    do
+    {
+        auto remaining_ms = std::chrono::duration_cast<std::chrono::milliseconds>(batch_end - now).count();
+
+        DCHECK(remaining_ms >= 0) << "Cant have negative reminaing time";
+
+        auto msg = consume_fn(std::min(10L, remaining_ms));
+
+        switch (msg->err())
+        {
+        case RdKafka::ERR__TIMED_OUT:
+            // Yield on a timeout
+            boost::this_fiber::yield();
+            break;
+        case RdKafka::ERR_NO_ERROR:
+            // Messages failing the pre-parse key/header filter are dropped here, before their payloads ever
+            // reach the batch buffer
+            if (m_message_filter.empty() || m_message_filter.matches(*msg))
+            {
+                messages.emplace_back(std::move(msg));
+            }
+
+            // Once messages are flowing, drain whatever librdkafka has already fetched into its local queue
+            // with zero-timeout consumes. This pulls hundreds of messages per outer iteration without paying
+            // the clock read and timeout bookkeeping per message
+            while (messages.size() < max_batch_size)
+            {
+                auto queued_msg = consume_fn(0);
+
+                if (queued_msg->err() != RdKafka::ERR_NO_ERROR)
+                {
+                    if (queued_msg->err() != RdKafka::ERR__TIMED_OUT &&
+                        queued_msg->err() != RdKafka::ERR__PARTITION_EOF)
+                    {
+                        LOG(ERROR) << "Consume failed: " << queued_msg->errstr();
+                    }
+                    break;
+                }
+
+                if (m_message_filter.empty() || m_message_filter.matches(*queued_msg))
+                {
+                    messages.emplace_back(std::move(queued_msg));
+                }
+            }
+            break;
+        case RdKafka::ERR__PARTITION_EOF:
+            VLOG_EVERY_N(10, 10) << "Hit EOF for partition";
+            // Hit the end, sleep for 100 ms
+            boost::this_fiber::sleep_for(std::chrono::milliseconds(100));
+            break;
+        default:
+            /* Errors */
+            LOG(ERROR) << "Consume failed: " << msg->errstr();
+        }
+
+        // Update now
+        now = std::chrono::high_resolution_clock::now();
+    } while (messages.size() < max_batch_size && now < batch_end);
+
+    return std::move(messages);
+}
+
 TensorIndex KafkaSourceStage::max_batch_size()
 {
-    return m_max_batch_size;
+    return m_batch_size_target.load(std::memory_order_relaxed);
+}
+
+void KafkaSourceStage::adapt_batch_size(std::size_t consumed_count)
+{
+    constexpr TensorIndex MinBatchSize{64};
+
+    auto target = m_batch_size_target.load(std::memory_order_relaxed);
+
+    if (static_cast<TensorIndex>(consumed_count) >= target)
+    {
+        // Consumer lag is building, grow toward the configured maximum
+        m_batch_size_target.store(std::min(target * 2, m_max_batch_size), std::memory_order_relaxed);
+    }
+    else if (static_cast<TensorIndex>(consumed_count) < target / 2)
+    {
+        // Caught up, shrink for lower per-batch latency
+        m_batch_size_target.store(std::max({target / 2, MinBatchSize, TensorIndex{1}}), std::memory_order_relaxed);
+    }
 }
 
 uint32_t KafkaSourceStage::batch_timeout_ms()
@@ -476,7 +1097,8 @@ std::unique_ptr<RdKafka::Conf> KafkaSourceStage::build_kafka_conf(const std::map
     return std::move(kafka_conf);
 }
 
-std::unique_ptr<RdKafka::KafkaConsumer> KafkaSourceStage::create_consumer(RdKafka::RebalanceCb& rebalancer)
+std::unique_ptr<RdKafka::KafkaConsumer> KafkaSourceStage::create_consumer(RdKafka::RebalanceCb& rebalancer,
+                                                                          RdKafka::OffsetCommitCb* offset_commit_cb)
 {
     auto kafka_conf = this->build_kafka_conf(m_config);
     std::string errstr;
@@ -486,6 +1108,12 @@ std::unique_ptr<RdKafka::KafkaConsumer> KafkaSourceStage::create_consumer(RdKafk
         LOG(FATAL) << "Error occurred while setting Kafka rebalance function. Error: " << errstr;
     }
 
+    if (offset_commit_cb != nullptr &&
+        RdKafka::Conf::ConfResult::CONF_OK != kafka_conf->set("offset_commit_cb", offset_commit_cb, errstr))
+    {
+        LOG(FATAL) << "Error occurred while setting Kafka offset commit function. Error: " << errstr;
+    }
+
     if (m_oauth_callback != nullptr)
     {
         if (RdKafka::Conf::ConfResult::CONF_OK !=
@@ -604,47 +1232,142 @@ std::unique_ptr<RdKafka::KafkaConsumer> KafkaSourceStage::create_consumer(RdKafk
     return std::move(consumer);
 }
 
-cudf::io::table_with_metadata KafkaSourceStage::load_table(const std::string& buffer)
+cudf::io::table_with_metadata KafkaSourceStage::load_table(
+    const std::vector<cudf::host_span<const std::byte>>& buffers)
 {
-    auto options =
-        cudf::io::json_reader_options::builder(cudf::io::source_info(buffer.c_str(), buffer.size())).lines(true);
+    // The host parser always infers, a pinned schema goes through the GPU reader
+    if (m_payload_compression == cudf::io::compression_type::NONE && m_schema.empty())
+    {
+        std::size_t total_bytes = 0;
+        for (const auto& buffer : buffers)
+        {
+            total_bytes += buffer.size();
+        }
+
+        // Low-rate batches parse faster on the host than the GPU reader's launch and transfer setup overhead
+        if (total_bytes <= JsonHostParseMaxBytes)
+        {
+            std::string batch;
+            batch.reserve(total_bytes);
+
+            for (const auto& buffer : buffers)
+            {
+                batch.append(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+            }
+
+            return load_json_lines_host(batch);
+        }
+    }
+
+    auto options = cudf::io::json_reader_options::builder(
+                       cudf::io::source_info(cudf::host_span<const cudf::host_span<const std::byte>>(buffers)))
+                       .compression(m_payload_compression)
+                       .lines(true);
+
+    if (!m_schema.empty())
+    {
+        // Pinned dtypes skip the inference pass and keep the column types stable across batches
+        options.dtypes(schema_to_cudf_dtypes(m_schema));
+    }
 
     return cudf::io::read_json(options.build());
 }
 
+cudf::io::table_with_metadata KafkaSourceStage::load_table_avro(
+    const std::vector<std::unique_ptr<RdKafka::Message>>& message_batch)
+{
+    // Each payload is a self-describing container frame, decode them individually then concatenate on the device
+    std::vector<cudf::io::table_with_metadata> tables;
+    tables.reserve(message_batch.size());
+
+    for (const auto& msg : message_batch)
+    {
+        auto options = cudf::io::avro_reader_options::builder(
+            cudf::io::source_info(static_cast<const char*>(msg->payload()), msg->len()));
+
+        tables.emplace_back(cudf::io::read_avro(options.build()));
+    }
+
+    if (tables.size() == 1)
+    {
+        return std::move(tables.front());
+    }
+
+    auto views = foreach_map(tables, [](const cudf::io::table_with_metadata& table) { return table.tbl->view(); });
+
+    return {cudf::concatenate(views), std::move(tables.front().metadata)};
+}
+
 template <bool EnableFilter>
-std::string concat_message_batch(std::vector<std::unique_ptr<RdKafka::Message>> const& message_batch)
+std::vector<cudf::host_span<const std::byte>> gather_message_batch(
+    std::vector<std::unique_ptr<RdKafka::Message>> const& message_batch, bool insert_separators)
 {
-    std::ostringstream buffer;
+    // Newline separator spans inserted between messages. Must outlive the returned spans, which is guaranteed since
+    // this has static storage duration.
+    static constexpr char NEWLINE = '\n';
+
+    // One span for the payload plus one for the separator per message
+    std::vector<cudf::host_span<const std::byte>> buffers;
+    buffers.reserve(message_batch.size() * 2);
 
     for (auto& msg : message_batch)
     {
-        auto s = static_cast<char*>(msg->payload());
+        auto* payload = static_cast<const char*>(msg->payload());
+        auto length   = msg->len();
 
         if constexpr (EnableFilter)
         {
-            if (!nlohmann::json::accept(s))
+            if (!nlohmann::json::accept(payload, payload + length))
             {
-                LOG(ERROR) << "Failed to parse kafka message as json: " << s;
+                LOG(ERROR) << "Failed to parse kafka message as json: " << std::string(payload, length);
                 continue;
             }
         }
 
-        buffer << s << "\n";
+        buffers.emplace_back(reinterpret_cast<const std::byte*>(payload), length);
+
+        if (insert_separators)
+        {
+            buffers.emplace_back(reinterpret_cast<const std::byte*>(&NEWLINE), 1);
+        }
     }
 
-    return buffer.str();
+    return buffers;
 }
 
 std::shared_ptr<morpheus::MessageMeta> KafkaSourceStage::process_batch(
     std::vector<std::unique_ptr<RdKafka::Message>>&& message_batch)
 {
-    // concat the kafka json messages
-    auto json_lines = !this->m_disable_pre_filtering ? concat_message_batch<true>(message_batch)
-                                                     : concat_message_batch<false>(message_batch);
+    MORPHEUS_NVTX_RANGE("KafkaSourceStage::process_batch");
+    MORPHEUS_STAGE_TIMER("KafkaSourceStage");
+    MORPHEUS_STAGE_MEMORY_SCOPE("KafkaSourceStage");
+
+    if (m_payload_is_avro)
+    {
+        auto avro_table = this->load_table_avro(message_batch);
+        filter_table_columns(avro_table, m_columns);
+        sort_table_by_column(avro_table, m_sort_by);
+        return MessageMeta::create_from_cpp(std::move(avro_table), 0);
+    }
+
+    // Build a scatter/gather list of spans over the raw librdkafka payloads. The messages are kept alive for the
+    // duration of the read_json call below, so the payload bytes are handed to cudf without an intermediate copy.
+    // Compressed payloads are complete frames: no newline separators are inserted and the pre-filter (which can
+    // only validate plain-text JSON) is skipped, leaving decompression to the cudf reader on the device.
+    bool is_compressed = m_payload_compression != cudf::io::compression_type::NONE;
+
+    auto buffers = !this->m_disable_pre_filtering && !is_compressed
+                       ? gather_message_batch<true>(message_batch, true)
+                       : gather_message_batch<false>(message_batch, !is_compressed);
 
     // parse the json
-    auto data_table = this->load_table(json_lines);
+    auto data_table = this->load_table(buffers);
+
+    // The JSON reader has no column selection, apply any projection after the parse
+    filter_table_columns(data_table, m_columns);
+
+    // Contiguous key runs make downstream per-entity slicing cheap
+    sort_table_by_column(data_table, m_sort_by);
 
     // Next, create the message metadata. This gets reused for repeats
     return MessageMeta::create_from_cpp(std::move(data_table), 0);
@@ -662,7 +1385,15 @@ std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> KafkaSourceStageInterfac
     bool disable_pre_filtering,
     std::size_t stop_after,
     bool async_commits,
-    std::optional<pybind11::function> oauth_callback)
+    std::size_t consumer_pool_size,
+    std::string payload_compression,
+    std::string payload_format,
+    std::optional<pybind11::function> oauth_callback,
+    std::vector<std::string> columns,
+    std::map<std::string, std::string> header_filter,
+    std::vector<std::string> key_filter,
+    TableSchema schema,
+    std::string sort_by)
 {
     auto oauth_callback_cpp = KafkaSourceStageInterfaceProxy::make_kafka_oauth_callback(std::move(oauth_callback));
 
@@ -675,7 +1406,15 @@ std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> KafkaSourceStageInterfac
                                                             disable_pre_filtering,
                                                             stop_after,
                                                             async_commits,
-                                                            std::move(oauth_callback_cpp));
+                                                            consumer_pool_size,
+                                                            std::move(payload_compression),
+                                                            std::move(payload_format),
+                                                            std::move(oauth_callback_cpp),
+                                                            std::move(columns),
+                                                            KafkaMessageFilter{std::move(key_filter),
+                                                                               std::move(header_filter)},
+                                                            std::move(schema),
+                                                            std::move(sort_by));
 
     return stage;
 }
@@ -691,7 +1430,15 @@ std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> KafkaSourceStageInterfac
     bool disable_pre_filtering,
     std::size_t stop_after,
     bool async_commits,
-    std::optional<pybind11::function> oauth_callback)
+    std::size_t consumer_pool_size,
+    std::string payload_compression,
+    std::string payload_format,
+    std::optional<pybind11::function> oauth_callback,
+    std::vector<std::string> columns,
+    std::map<std::string, std::string> header_filter,
+    std::vector<std::string> key_filter,
+    TableSchema schema,
+    std::string sort_by)
 {
     auto oauth_callback_cpp = KafkaSourceStageInterfaceProxy::make_kafka_oauth_callback(std::move(oauth_callback));
 
@@ -704,7 +1451,15 @@ std::shared_ptr<mrc::segment::Object<KafkaSourceStage>> KafkaSourceStageInterfac
                                                             disable_pre_filtering,
                                                             stop_after,
                                                             async_commits,
-                                                            std::move(oauth_callback_cpp));
+                                                            consumer_pool_size,
+                                                            std::move(payload_compression),
+                                                            std::move(payload_format),
+                                                            std::move(oauth_callback_cpp),
+                                                            std::move(columns),
+                                                            KafkaMessageFilter{std::move(key_filter),
+                                                                               std::move(header_filter)},
+                                                            std::move(schema),
+                                                            std::move(sort_by));
 
     return stage;
 }
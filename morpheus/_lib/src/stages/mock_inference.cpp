@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/mock_inference.hpp"
+
+#include "mrc/node/rx_sink_base.hpp"
+#include "mrc/node/rx_source_base.hpp"
+#include "mrc/node/sink_properties.hpp"
+#include "mrc/node/source_properties.hpp"
+#include "mrc/segment/builder.hpp"
+#include "mrc/segment/object.hpp"
+#include "mrc/types.hpp"
+
+#include "morpheus/messages/memory/response_memory.hpp"
+#include "morpheus/objects/dtype.hpp"            // for DType
+#include "morpheus/objects/tensor.hpp"           // for Tensor::create
+#include "morpheus/types.hpp"                    // for ShapeType, TensorMap
+#include "morpheus/utilities/stage_latency.hpp"  // for MORPHEUS_STAGE_TIMER
+#include "morpheus/utilities/stream_pool.hpp"    // for StreamPool
+
+#include <cuda_runtime.h>  // for cudaMemsetAsync
+#include <glog/logging.h>
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
+#include <pymrc/node.hpp>
+#include <rmm/device_buffer.hpp>  // for device_buffer
+
+#include <algorithm>  // for max
+#include <chrono>     // for duration
+#include <cmath>      // for log, sqrt
+#include <cstddef>    // for size_t
+#include <memory>
+#include <random>
+#include <stdexcept>  // for invalid_argument
+#include <thread>     // for sleep_for
+#include <utility>    // for move
+
+namespace morpheus {
+// Component public implementations
+// ************ MockInferenceClientStage ************* //
+MockInferenceClientStage::MockInferenceClientStage(std::map<std::string, TensorIndex> outputs,
+                                                   double latency_mean_ms,
+                                                   double latency_stddev_ms,
+                                                   std::string distribution,
+                                                   std::uint64_t seed) :
+  PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
+  m_outputs(std::move(outputs)),
+  m_latency_mean_ms(latency_mean_ms),
+  m_latency_stddev_ms(latency_stddev_ms),
+  m_distribution(std::move(distribution)),
+  m_rng(seed != 0 ? seed : std::random_device{}())
+{
+    CHECK(!m_outputs.empty()) << "MockInferenceClientStage requires at least one output tensor";
+    CHECK_GE(m_latency_mean_ms, 0.0);
+    CHECK_GE(m_latency_stddev_ms, 0.0);
+
+    if (m_distribution != "constant" && m_distribution != "normal" && m_distribution != "lognormal")
+    {
+        throw std::invalid_argument("Unknown latency distribution '" + m_distribution +
+                                    "', expected 'constant', 'normal' or 'lognormal'");
+    }
+
+    if (m_distribution == "lognormal" && m_latency_mean_ms > 0.0)
+    {
+        // Moment matching: pick mu and sigma so the lognormal's mean and stddev equal the requested values
+        const auto ratio  = m_latency_stddev_ms / m_latency_mean_ms;
+        m_lognormal_sigma = std::sqrt(std::log(1.0 + ratio * ratio));
+        m_lognormal_mu    = std::log(m_latency_mean_ms) - 0.5 * m_lognormal_sigma * m_lognormal_sigma;
+    }
+}
+
+double MockInferenceClientStage::sample_latency_ms()
+{
+    if (m_latency_mean_ms <= 0.0)
+    {
+        return 0.0;
+    }
+
+    if (m_distribution == "constant" || m_latency_stddev_ms == 0.0)
+    {
+        return m_latency_mean_ms;
+    }
+
+    if (m_distribution == "normal")
+    {
+        std::normal_distribution<double> dist(m_latency_mean_ms, m_latency_stddev_ms);
+        return std::max(0.0, dist(m_rng));
+    }
+
+    std::lognormal_distribution<double> dist(m_lognormal_mu, m_lognormal_sigma);
+    return dist(m_rng);
+}
+
+MockInferenceClientStage::subscribe_fn_t MockInferenceClientStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t x) {
+                MORPHEUS_STAGE_TIMER("MockInferenceClientStage");
+
+                // Synthetic model time, sampled per batch like a real server's per-request latency
+                const auto latency_ms = this->sample_latency_ms();
+                if (latency_ms > 0.0)
+                {
+                    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(latency_ms));
+                }
+
+                auto stream = StreamPool::get_stream();
+
+                TensorMap output_tensors;
+                for (const auto& [name, width] : m_outputs)
+                {
+                    const ShapeType shape{x->mess_count, width};
+                    const auto bytes =
+                        static_cast<std::size_t>(x->mess_count) * width * DType(TypeId::FLOAT32).item_size();
+
+                    auto buffer = m_buffer_pool->acquire(bytes, stream);
+                    MRC_CHECK_CUDA(cudaMemsetAsync(buffer->data(), 0, bytes, stream.value()));
+
+                    const ShapeType stride{width, 1};
+                    output_tensors[name].swap(
+                        Tensor::create(std::move(buffer), DType(TypeId::FLOAT32), shape, stride, 0));
+                }
+
+                // The zero-fills must land before the message is handed downstream on another stream
+                MRC_CHECK_CUDA(cudaStreamSynchronize(stream.value()));
+
+                auto response_mem = std::make_shared<ResponseMemory>(x->mess_count, std::move(output_tensors));
+                auto response     = std::make_shared<MultiResponseMessage>(
+                    x->meta, x->mess_offset, x->mess_count, std::move(response_mem), 0, x->mess_count);
+
+                output.on_next(std::move(response));
+            },
+            [&](std::exception_ptr error_ptr) {
+                output.on_error(error_ptr);
+            },
+            [&]() {
+                output.on_completed();
+            }));
+    };
+}
+
+// ************ MockInferenceClientStageInterfaceProxy ************ //
+std::shared_ptr<mrc::segment::Object<MockInferenceClientStage>> MockInferenceClientStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::map<std::string, TensorIndex> outputs,
+    double latency_mean_ms,
+    double latency_stddev_ms,
+    std::string distribution,
+    std::uint64_t seed)
+{
+    return builder.construct_object<MockInferenceClientStage>(
+        name, std::move(outputs), latency_mean_ms, latency_stddev_ms, std::move(distribution), seed);
+}
+}  // namespace morpheus
@@ -0,0 +1,293 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/prefilter.hpp"
+
+#include "mrc/segment/builder.hpp"
+#include "mrc/segment/object.hpp"
+#include "pymrc/node.hpp"
+
+#include "morpheus/objects/table_info.hpp"          // for TableInfo
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
+
+#include <cudf/binaryop.hpp>                  // for binary_operation
+#include <cudf/column/column.hpp>             // for column
+#include <cudf/column/column_view.hpp>        // for column_view
+#include <cudf/io/types.hpp>                  // for table_metadata
+#include <cudf/replace.hpp>                   // for replace_nulls
+#include <cudf/scalar/scalar.hpp>      // for numeric_scalar, string_scalar
+#include <cudf/stream_compaction.hpp>  // for apply_boolean_mask
+#include <cudf/strings/contains.hpp>   // for contains_re
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>  // for table_view
+#include <cudf/types.hpp>             // for data_type, size_type
+#include <cudf/unary.hpp>             // for unary_operation
+#include <glog/logging.h>             // for CHECK
+
+#include <algorithm>  // for find
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <stdexcept>  // for invalid_argument
+#include <string>
+#include <utility>  // for move
+
+namespace {
+
+using namespace morpheus;
+
+bool is_regex_op(const std::string& op)
+{
+    return op == "matches" || op == "not_matches";
+}
+
+cudf::binary_operator comparison_operator(const std::string& op)
+{
+    if (op == "eq")
+    {
+        return cudf::binary_operator::EQUAL;
+    }
+    if (op == "ne")
+    {
+        return cudf::binary_operator::NOT_EQUAL;
+    }
+    if (op == "lt")
+    {
+        return cudf::binary_operator::LESS;
+    }
+    if (op == "le")
+    {
+        return cudf::binary_operator::LESS_EQUAL;
+    }
+    if (op == "gt")
+    {
+        return cudf::binary_operator::GREATER;
+    }
+    if (op == "ge")
+    {
+        return cudf::binary_operator::GREATER_EQUAL;
+    }
+
+    throw std::invalid_argument("Unknown prefilter op '" + op +
+                                "', expected eq, ne, lt, le, gt, ge, matches or not_matches");
+}
+
+// Builds a scalar of the predicate column's type from the predicate's value string
+std::unique_ptr<cudf::scalar> make_comparison_scalar(cudf::data_type type, const std::string& value)
+{
+    switch (type.id())
+    {
+    case cudf::type_id::INT8:
+        return std::make_unique<cudf::numeric_scalar<std::int8_t>>(static_cast<std::int8_t>(std::stol(value)));
+    case cudf::type_id::INT16:
+        return std::make_unique<cudf::numeric_scalar<std::int16_t>>(static_cast<std::int16_t>(std::stol(value)));
+    case cudf::type_id::INT32:
+        return std::make_unique<cudf::numeric_scalar<std::int32_t>>(static_cast<std::int32_t>(std::stol(value)));
+    case cudf::type_id::INT64:
+        return std::make_unique<cudf::numeric_scalar<std::int64_t>>(std::stoll(value));
+    case cudf::type_id::UINT8:
+        return std::make_unique<cudf::numeric_scalar<std::uint8_t>>(static_cast<std::uint8_t>(std::stoul(value)));
+    case cudf::type_id::UINT16:
+        return std::make_unique<cudf::numeric_scalar<std::uint16_t>>(static_cast<std::uint16_t>(std::stoul(value)));
+    case cudf::type_id::UINT32:
+        return std::make_unique<cudf::numeric_scalar<std::uint32_t>>(static_cast<std::uint32_t>(std::stoul(value)));
+    case cudf::type_id::UINT64:
+        return std::make_unique<cudf::numeric_scalar<std::uint64_t>>(std::stoull(value));
+    case cudf::type_id::FLOAT32:
+        return std::make_unique<cudf::numeric_scalar<float>>(std::stof(value));
+    case cudf::type_id::FLOAT64:
+        return std::make_unique<cudf::numeric_scalar<double>>(std::stod(value));
+    case cudf::type_id::BOOL8:
+        return std::make_unique<cudf::numeric_scalar<bool>>(value == "true" || value == "1");
+    case cudf::type_id::STRING:
+        return std::make_unique<cudf::string_scalar>(value);
+    default:
+        throw std::invalid_argument("Prefilter predicates do not support the column's dtype");
+    }
+}
+
+}  // namespace
+
+namespace morpheus {
+
+// Component public implementations
+// ************ PrefilterStage **************************** //
+PrefilterStage::PrefilterStage(const std::vector<predicate_t>& predicates, std::string combine) :
+  PythonNode(base_t::op_factory_from_sub_fn(build_operator()))
+{
+    CHECK(!predicates.empty()) << "PrefilterStage requires at least one predicate";
+
+    if (combine == "all")
+    {
+        m_combine_all = true;
+    }
+    else if (combine == "any")
+    {
+        m_combine_all = false;
+    }
+    else
+    {
+        throw std::invalid_argument("Unknown combine mode '" + combine + "', expected 'all' or 'any'");
+    }
+
+    // Compile the regexes and validate the ops up front, batches only pay for the device evaluation itself
+    for (const auto& [column, op, value] : predicates)
+    {
+        m_columns.push_back(column);
+        m_ops.push_back(op);
+        m_values.push_back(value);
+
+        if (is_regex_op(op))
+        {
+            m_programs.push_back(cudf::strings::regex_program::create(value));
+        }
+        else
+        {
+            comparison_operator(op);  // throws on an unknown op
+            m_programs.push_back(nullptr);
+        }
+    }
+}
+
+std::shared_ptr<MessageMeta> PrefilterStage::on_data(sink_type_t msg)
+{
+    MORPHEUS_NVTX_RANGE("PrefilterStage::on_data");
+    MORPHEUS_STAGE_TIMER("PrefilterStage");
+    MORPHEUS_STAGE_MEMORY_SCOPE("PrefilterStage");
+
+    auto table_info   = msg->get_info();
+    auto table_view   = table_info.get_view();
+    auto index_names  = table_info.get_index_names();
+    auto column_names = table_info.get_column_names();
+
+    const auto bool_type = cudf::data_type{cudf::type_id::BOOL8};
+
+    std::unique_ptr<cudf::column> drop_mask;
+
+    for (std::size_t i = 0; i < m_columns.size(); ++i)
+    {
+        auto found = std::find(column_names.begin(), column_names.end(), m_columns[i]);
+        CHECK(found != column_names.end()) << "Prefilter column '" << m_columns[i] << "' not found in the dataframe";
+
+        // The view places the index columns ahead of the data columns
+        const auto& col = table_view.column(index_names.size() + (found - column_names.begin()));
+
+        std::unique_ptr<cudf::column> mask;
+
+        if (is_regex_op(m_ops[i]))
+        {
+            CHECK(col.type().id() == cudf::type_id::STRING)
+                << "Prefilter column '" << m_columns[i] << "' must be a string column for op '" << m_ops[i] << "'";
+
+            mask = cudf::strings::contains_re(cudf::strings_column_view(col), *m_programs[i]);
+
+            if (m_ops[i] == "not_matches")
+            {
+                mask = cudf::unary_operation(mask->view(), cudf::unary_operator::NOT);
+            }
+        }
+        else
+        {
+            auto scalar = make_comparison_scalar(col.type(), m_values[i]);
+
+            mask = cudf::binary_operation(col, *scalar, comparison_operator(m_ops[i]), bool_type);
+        }
+
+        if (!drop_mask)
+        {
+            drop_mask = std::move(mask);
+        }
+        else
+        {
+            drop_mask = cudf::binary_operation(
+                drop_mask->view(),
+                mask->view(),
+                m_combine_all ? cudf::binary_operator::LOGICAL_AND : cudf::binary_operator::LOGICAL_OR,
+                bool_type);
+        }
+    }
+
+    // A null in a predicate column means the condition cannot be shown true, keep the row for the model
+    const cudf::numeric_scalar<bool> not_matched(false);
+    auto valid_drop_mask = cudf::replace_nulls(drop_mask->view(), not_matched);
+    auto keep_mask       = cudf::unary_operation(valid_drop_mask->view(), cudf::unary_operator::NOT);
+
+    // Single device compaction pass gathering the surviving rows, the same machinery the range copies use
+    auto filtered = cudf::apply_boolean_mask(table_view, keep_mask->view());
+
+    if (filtered->num_rows() == 0)
+    {
+        return nullptr;
+    }
+
+    // Nothing matched, forward the incoming message and let the copy made by the compaction go
+    if (filtered->num_rows() == table_view.num_rows())
+    {
+        return msg;
+    }
+
+    auto metadata = cudf::io::table_metadata{};
+    metadata.schema_info.reserve(index_names.size() + column_names.size());
+
+    for (const auto& name : index_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    for (const auto& name : column_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    return MessageMeta::create_from_cpp({std::move(filtered), std::move(metadata)},
+                                        static_cast<int>(index_names.size()));
+}
+
+PrefilterStage::subscribe_fn_t PrefilterStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t msg) {
+                auto filtered = this->on_data(std::move(msg));
+
+                // Batches whose rows were all dropped are suppressed entirely
+                if (filtered)
+                {
+                    output.on_next(std::move(filtered));
+                }
+            },
+            [&](std::exception_ptr error_ptr) {
+                output.on_error(error_ptr);
+            },
+            [&]() {
+                output.on_completed();
+            }));
+    };
+}
+
+// ************ PrefilterStageInterfaceProxy ************ //
+std::shared_ptr<mrc::segment::Object<PrefilterStage>> PrefilterStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    const std::vector<PrefilterStage::predicate_t>& predicates,
+    std::string combine)
+{
+    return builder.construct_object<PrefilterStage>(name, predicates, std::move(combine));
+}
+}  // namespace morpheus
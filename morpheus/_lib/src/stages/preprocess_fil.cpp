@@ -28,33 +28,38 @@
 #include "morpheus/messages/meta.hpp"         // for MessageMeta
 #include "morpheus/objects/dev_mem_info.hpp"  // for DevMemInfo
 #include "morpheus/objects/dtype.hpp"
+#include "morpheus/objects/memory_descriptor.hpp"  // for MemoryDescriptor
 #include "morpheus/objects/table_info.hpp"  // for TableInfo
 #include "morpheus/objects/tensor.hpp"
 #include "morpheus/objects/tensor_object.hpp"  // for TensorObject
 #include "morpheus/types.hpp"                  // for TensorIndex
+#include "morpheus/utilities/cuda_graph.hpp"   // for CudaGraphCache
 #include "morpheus/utilities/matx_util.hpp"
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
+#include "morpheus/utilities/stream_pool.hpp"       // for StreamPool
 
-#include <cuda_runtime.h>               // for cudaMemcpy, cudaMemcpyDeviceToDevice
-#include <cudf/column/column.hpp>       // for column, column::contents
 #include <cudf/column/column_view.hpp>  // for column_view
 #include <cudf/types.hpp>
-#include <cudf/unary.hpp>
-#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
 #include <mrc/segment/builder.hpp>
 #include <pybind11/cast.h>  // for object_api::operator(), operator""_a
 #include <pybind11/gil.h>
 #include <pybind11/pybind11.h>  // for str_attr_accessor, arg
 #include <pybind11/pytypes.h>
 #include <pymrc/node.hpp>
-#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
+#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_view
 #include <rmm/device_buffer.hpp>     // for device_buffer
+#include <rmm/mr/device/per_device_resource.hpp>  // for get_current_device_resource
 
 #include <array>
 #include <cstddef>
 #include <exception>
 #include <functional>
 #include <memory>
+#include <sstream>  // for ostringstream
 #include <utility>
+#include <vector>
 
 namespace morpheus {
 // Component public implementations
@@ -67,54 +72,71 @@ PreprocessFILStage::PreprocessFILStage(const std::vector<std::string>& features)
 PreprocessFILStage::subscribe_fn_t PreprocessFILStage::build_operator()
 {
     return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        // Replays the per-batch column-pack kernel chain as one CUDA graph once its shapes and buffers have been
+        // seen, collapsing a launch per feature column into a single launch
+        auto graph_cache = std::make_shared<CudaGraphCache>();
+
         return input.subscribe(rxcpp::make_observer<sink_type_t>(
-            [&output, this](sink_type_t x) {
+            [&output, this, graph_cache](sink_type_t x) {
+                MORPHEUS_NVTX_RANGE("PreprocessFILStage::on_data");
+                MORPHEUS_STAGE_TIMER("PreprocessFILStage");
+                MORPHEUS_STAGE_MEMORY_SCOPE("PreprocessFILStage");
+
                 // Make sure to
                 auto df_meta = this->fix_bad_columns(x);
 
-                auto packed_data = std::make_shared<rmm::device_buffer>(
-                    m_fea_cols.size() * x->mess_count * sizeof(float), rmm::cuda_stream_per_thread);
+                const auto fea_len = static_cast<TensorIndex>(m_fea_cols.size());
+
+                // This fiber's pooled stream, so concurrent stages don't serialize on the GPU
+                const auto stream = StreamPool::get_stream();
+
+                // Batch sizes are stable in steady state, so this comes from the stage's buffer pool instead of
+                // hitting the RMM resource every batch
+                auto packed_data =
+                    this->m_buffer_pool->acquire(m_fea_cols.size() * x->mess_count * sizeof(float), stream);
+
+                // Cast and pack each feature column directly into its column of the row-major input tensor in one
+                // fused pass, rather than cast + copy into a column-major staging buffer + transpose
+                DevMemInfo packed_info{packed_data, TypeId::FLOAT32, {x->mess_count, fea_len}, {fea_len, 1}};
+
+                auto col_md = std::make_shared<MemoryDescriptor>(stream, rmm::mr::get_current_device_resource());
+
+                // Graph replay re-issues the captured launches verbatim, so the key has to pin down the batch
+                // shape and every address involved. The pooled output buffer and preallocated source columns make
+                // the keys repeat in steady state; a fresh key just runs uncaptured
+                std::ostringstream graph_key;
+                graph_key << x->mess_count << "/" << packed_data->data();
+
+                std::vector<std::pair<uint8_t*, DType>> feature_columns;
+                feature_columns.reserve(df_meta.num_columns());
 
                 for (size_t i = 0; i < df_meta.num_columns(); ++i)
                 {
-                    auto curr_col = df_meta.get_column(i);
+                    auto curr_col  = df_meta.get_column(i);
+                    auto col_dtype = DType::from_cudf(curr_col.type().id());
 
-                    auto curr_ptr = static_cast<float*>(packed_data->data()) + i * df_meta.num_rows();
+                    auto* col_data = const_cast<uint8_t*>(curr_col.head<uint8_t>()) +
+                                     static_cast<TensorSize>(curr_col.offset()) * col_dtype.item_size();
 
-                    // Check if we are something other than float
-                    if (curr_col.type().id() != cudf::type_id::FLOAT32)
-                    {
-                        auto float_data = cudf::cast(curr_col, cudf::data_type(cudf::type_id::FLOAT32))->release();
+                    graph_key << "/" << static_cast<void*>(col_data) << ":"
+                              << static_cast<int>(col_dtype.type_id());
 
-                        // Do the copy here before it goes out of scope
-                        MRC_CHECK_CUDA(cudaMemcpy(curr_ptr,
-                                                  float_data.data->data(),
-                                                  df_meta.num_rows() * sizeof(float),
-                                                  cudaMemcpyDeviceToDevice));
-                    }
-                    else
-                    {
-                        MRC_CHECK_CUDA(cudaMemcpy(curr_ptr,
-                                                  curr_col.data<float>(),
-                                                  df_meta.num_rows() * sizeof(float),
-                                                  cudaMemcpyDeviceToDevice));
-                    }
+                    feature_columns.emplace_back(col_data, col_dtype);
                 }
 
-                // Need to convert from row major to column major
-                // Easiest way to do this is to transpose the data from [fea_len, row_count] to [row_count, fea_len]
-                auto transposed_data =
-                    MatxUtil::transpose(DevMemInfo{packed_data,
-                                                   TypeId::FLOAT32,
-                                                   {static_cast<TensorIndex>(m_fea_cols.size()), x->mess_count},
-                                                   {x->mess_count, 1}});
+                graph_cache->launch(graph_key.str(), stream, [&]() {
+                    for (std::size_t i = 0; i < feature_columns.size(); ++i)
+                    {
+                        const auto& [col_data, col_dtype] = feature_columns[i];
+
+                        MatxUtil::pack_column_async(DevMemInfo{col_data, col_dtype, col_md, {x->mess_count}, {1}},
+                                                    packed_info,
+                                                    static_cast<TensorIndex>(i));
+                    }
+                });
 
                 // Create the tensor which will be row-major and size [row_count, fea_len]
-                auto input__0 = Tensor::create(transposed_data,
-                                               DType::create<float>(),
-                                               {x->mess_count, static_cast<TensorIndex>(m_fea_cols.size())},
-                                               {},
-                                               0);
+                auto input__0 = Tensor::create(packed_data, DType::create<float>(), {x->mess_count, fea_len}, {}, 0);
 
                 auto seq_id_dtype = DType::create<TensorIndex>();
                 auto seq_ids      = Tensor::create(MatxUtil::create_seq_ids(x->mess_count,
@@ -145,7 +167,7 @@ PreprocessFILStage::subscribe_fn_t PreprocessFILStage::build_operator()
     };
 }
 
-TableInfo PreprocessFILStage::fix_bad_columns(sink_type_t x)
+TableInfo PreprocessFILStage::fix_bad_columns(const sink_type_t& x)
 {
     std::vector<std::string> bad_cols;
 
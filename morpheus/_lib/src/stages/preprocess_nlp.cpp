@@ -28,14 +28,23 @@
 #include "morpheus/messages/multi_inference.hpp"
 #include "morpheus/objects/dev_mem_info.hpp"
 #include "morpheus/objects/dtype.hpp"
+#include "morpheus/objects/memory_descriptor.hpp"  // for MemoryDescriptor
 #include "morpheus/objects/table_info.hpp"  // for TableInfo
 #include "morpheus/objects/tensor.hpp"
 #include "morpheus/types.hpp"  // for TensorIndex, TensorMap
 #include "morpheus/utilities/matx_util.hpp"
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
+#include "morpheus/utilities/stream_pool.hpp"       // for StreamPool
 
+#include <cuda_runtime.h>  // for cudaMemcpyAsync, cudaMemcpyDeviceToDevice
 #include <cudf/column/column.hpp>  // for column, column::contents
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>  // for slice
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/filling.hpp>
 #include <cudf/reshape.hpp>
 #include <cudf/scalar/scalar.hpp>
@@ -43,6 +52,7 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/unary.hpp>
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
 #include <mrc/segment/builder.hpp>
 #include <nvtext/normalize.hpp>
 #include <nvtext/subword_tokenize.hpp>
@@ -50,13 +60,82 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>  // for device_buffer
 
+#include <algorithm>  // for min
 #include <cstdint>
 #include <exception>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 
+namespace {
+
+// Loading a hashed vocabulary costs a couple hundred milliseconds, so share one instance per file across every
+// stage instance and worker thread in the process. The tokenizer only reads the vocabulary, making concurrent use
+// safe once it has been loaded.
+std::mutex vocab_cache_mutex;
+std::map<std::string, std::shared_ptr<const nvtext::hashed_vocabulary>> vocab_cache;
+
+std::shared_ptr<const nvtext::hashed_vocabulary> get_hashed_vocab(const std::string& vocab_hash_file)
+{
+    std::lock_guard<std::mutex> lock(vocab_cache_mutex);
+
+    auto& entry = vocab_cache[vocab_hash_file];
+    if (!entry)
+    {
+        entry = nvtext::load_vocabulary_file(vocab_hash_file);
+    }
+
+    return entry;
+}
+
+/**
+ * @brief Normalize and subword-tokenize a strings column, handling the all-whitespace edge case.
+ */
+nvtext::tokenizer_result tokenize_strings(const cudf::strings_column_view& string_col,
+                                          const nvtext::hashed_vocabulary& vocab,
+                                          uint32_t sequence_length,
+                                          uint32_t stride,
+                                          bool do_lower_case,
+                                          bool truncation)
+{
+    // remove leading and trailing whitespace
+    auto normalized_col      = nvtext::normalize_spaces(string_col);
+    auto normalized_col_view = cudf::strings_column_view{normalized_col->view()};
+
+    if (normalized_col_view.chars_size(rmm::cuda_stream_default) > 0)
+    {
+        return nvtext::subword_tokenize(normalized_col_view,
+                                        vocab,
+                                        sequence_length,
+                                        stride,
+                                        do_lower_case,
+                                        truncation,
+                                        rmm::mr::get_current_device_resource());
+    }
+
+    // workaround for a situation where the input strings contain either no characters or only
+    // whitespace
+    auto zero     = cudf::numeric_scalar<uint32_t>(0, true, rmm::cuda_stream_default);
+    auto ids      = cudf::make_column_from_scalar(zero, sequence_length * normalized_col_view.size());
+    auto mask     = cudf::make_column_from_scalar(zero, sequence_length * normalized_col_view.size());
+    auto metadata = [&]() {
+        auto iota   = cudf::sequence(normalized_col_view.size(), zero);
+        auto zeroes = cudf::make_column_from_scalar(zero, normalized_col_view.size());
+        return cudf::interleave_columns(
+            cudf::table_view{std::vector<cudf::column_view>{iota->view(), zeroes->view(), zeroes->view()}});
+    }();
+
+    return nvtext::tokenizer_result{static_cast<uint32_t>(normalized_col_view.size()),
+                                    sequence_length,
+                                    std::move(ids),
+                                    std::move(mask),
+                                    std::move(metadata)};
+}
+
+}  // namespace
+
 namespace morpheus {
 // Component public implementations
 // ************ PreprocessNLPStage ************************* //
@@ -66,7 +145,10 @@ PreprocessNLPStage::PreprocessNLPStage(std::string vocab_hash_file,
                                        bool do_lower_case,
                                        bool add_special_token,
                                        int stride,
-                                       std::string column) :
+                                       std::string column,
+                                       TensorIndex chunk_size,
+                                       bool dedupe,
+                                       TensorIndex warmup_rows) :
   PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
   m_vocab_hash_file(std::move(vocab_hash_file)),
   m_sequence_length(sequence_length),
@@ -74,8 +156,48 @@ PreprocessNLPStage::PreprocessNLPStage(std::string vocab_hash_file,
   m_do_lower_case(do_lower_case),
   m_add_special_token(add_special_token),
   m_stride(stride),
-  m_column(std::move(column))
-{}
+  m_column(std::move(column)),
+  m_chunk_size(chunk_size),
+  m_dedupe(dedupe),
+  m_warmup_rows(warmup_rows)
+{
+    if (m_warmup_rows > 0)
+    {
+        this->warmup();
+    }
+}
+
+void PreprocessNLPStage::warmup()
+{
+    MORPHEUS_NVTX_RANGE("PreprocessNLPStage::warmup");
+
+    uint32_t stride = m_stride;
+    if (m_stride < 0)
+    {
+        stride = m_sequence_length / 2;
+        stride = stride + stride / 2;
+    }
+
+    // Loading the vocabulary here also seeds the process-wide cache for every later subscription
+    auto vocab = get_hashed_vocab(m_vocab_hash_file);
+
+    // A dummy batch at the configured shape forces the cudf/nvtext kernel module loads and grows the RMM pool to
+    // roughly its steady-state size. The results are discarded.
+    auto dummy_col = cudf::make_column_from_scalar(cudf::string_scalar("warmup"), m_warmup_rows);
+    tokenize_strings(cudf::strings_column_view{dummy_col->view()},
+                     *vocab,
+                     m_sequence_length,
+                     stride,
+                     m_do_lower_case,
+                     m_truncation);
+
+    // Touch the MatX path the real batches use for their seq_ids tensor
+    auto seq_id_dtype = DType::create<TensorIndex>();
+    auto md = std::make_shared<MemoryDescriptor>(rmm::cuda_stream_default, rmm::mr::get_current_device_resource());
+    MatxUtil::create_seq_ids(m_warmup_rows, m_sequence_length, seq_id_dtype.type_id(), md, 0);
+
+    MRC_CHECK_CUDA(cudaStreamSynchronize(rmm::cuda_stream_default.value()));
+}
 
 PreprocessNLPStage::subscribe_fn_t PreprocessNLPStage::build_operator()
 {
@@ -89,64 +211,193 @@ PreprocessNLPStage::subscribe_fn_t PreprocessNLPStage::build_operator()
             stride = stride + stride / 2;
         }
 
-        return input.subscribe(rxcpp::make_observer<sink_type_t>(
-            [this, &output, stride](sink_type_t x) {
-                // Convert to string view
-                auto meta       = x->get_meta(this->m_column);
-                auto col        = meta.get_column(0);
-                auto string_col = cudf::strings_column_view{col};
+        // Resolve the shared vocabulary once per subscription rather than once per batch
+        auto vocab = get_hashed_vocab(m_vocab_hash_file);
 
-                // Create the hashed vocab
-                thread_local std::unique_ptr<nvtext::hashed_vocabulary> vocab =
-                    nvtext::load_vocabulary_file(this->m_vocab_hash_file);
+        // Tokenize each distinct string once and expand the resulting tensors back to the original row order with
+        // a device-side gather. Security logs are heavily repetitive, so this routinely cuts tokenizer work by more
+        // than half.
+        auto process_deduped = [this, stride, vocab](sink_type_t& x, const cudf::dictionary_column_view& dict) {
+            const auto rows        = dict.size();
+            const auto unique_rows = dict.keys_size();
+            const auto seq_len     = static_cast<TensorIndex>(this->m_sequence_length);
 
-                // remove leading and trailing whitespace
-                auto normalized_col      = nvtext::normalize_spaces(string_col);
-                auto normalized_col_view = cudf::strings_column_view{normalized_col->view()};
+            auto token_results = tokenize_strings(
+                cudf::strings_column_view{dict.keys()}, *vocab, this->m_sequence_length, stride, this->m_do_lower_case, true);
 
-                // Perform the tokenizer
-                nvtext::tokenizer_result token_results;
+            // Map from each original row to its distinct string, reused by both gathers below
+            auto indices    = dict.indices();
+            auto indices_md =
+                std::make_shared<MemoryDescriptor>(StreamPool::get_stream(), rmm::mr::get_current_device_resource());
+
+            auto int32_dtype = DType::create<int32_t>();
+
+            DevMemInfo indices_info{
+                const_cast<int32_t*>(indices.data<int32_t>()), int32_dtype, indices_md, {rows}, {1}};
+
+            auto unique_ids_released                       = token_results.tensor_token_ids->release();
+            std::shared_ptr<rmm::device_buffer> unique_ids = std::move(unique_ids_released.data);
+
+            auto ids_buffer = MatxUtil::gather_rows_async(
+                DevMemInfo{unique_ids, int32_dtype.type_id(), {unique_rows, seq_len}, {seq_len, 1}}, indices_info);
+
+            auto unique_mask_released                       = token_results.tensor_attention_mask->release();
+            std::shared_ptr<rmm::device_buffer> unique_mask = std::move(unique_mask_released.data);
+
+            auto mask_buffer = MatxUtil::gather_rows_async(
+                DevMemInfo{unique_mask, int32_dtype.type_id(), {unique_rows, seq_len}, {seq_len, 1}}, indices_info);
 
-                if (normalized_col_view.chars_size(rmm::cuda_stream_default) > 0)
+            auto memory = std::make_shared<InferenceMemory>(rows);
+
+            memory->set_tensor("input_ids", Tensor::create(ids_buffer, int32_dtype, {rows, seq_len}, {}, 0));
+            memory->set_tensor("input_mask", Tensor::create(mask_buffer, int32_dtype, {rows, seq_len}, {}, 0));
+
+            // The tokenizer's metadata refers to the distinct strings, so build fresh per-row seq_ids instead of
+            // gathering it, the same synthetic form PreprocessFILStage emits
+            auto seq_id_dtype   = DType::create<TensorIndex>();
+            auto seq_ids_buffer = MatxUtil::create_seq_ids(
+                rows, seq_len, seq_id_dtype.type_id(), indices_md, x->mess_offset);
+            memory->set_tensor("seq_ids", Tensor::create(seq_ids_buffer, seq_id_dtype, {rows, 3}, {}, 0));
+
+            return std::make_shared<MultiInferenceMessage>(
+                x->meta, x->mess_offset, x->mess_count, std::move(memory), 0, rows);
+        };
+
+        // Tokenize fixed-size row slices and assemble the output tensors incrementally. With truncation each row
+        // yields exactly one sequence, so the final extents are known up front and each chunk writes into its row
+        // range of the preallocated buffers. Peak scratch memory is bounded by the chunk size, and because the
+        // assembly copies share the fiber's pooled stream they queue behind each chunk without a host sync,
+        // overlapping the next chunk's host-side setup with the previous chunk's device work.
+        auto process_chunked = [this, stride, vocab](sink_type_t& x) {
+            auto meta = x->get_meta(this->m_column);
+            auto col  = meta.get_column(0);
+
+            const auto rows    = col.size();
+            const auto seq_len = static_cast<TensorIndex>(this->m_sequence_length);
+
+            // This fiber's pooled stream, so concurrent stages don't serialize on the GPU
+            const auto stream = StreamPool::get_stream();
+
+            // The output shapes are stable across batches, so these come from the stage's buffer pool instead of
+            // hitting the RMM resource every batch
+            auto ids_buffer =
+                this->m_buffer_pool->acquire(static_cast<TensorSize>(rows) * seq_len * sizeof(int32_t), stream);
+            auto mask_buffer =
+                this->m_buffer_pool->acquire(static_cast<TensorSize>(rows) * seq_len * sizeof(int32_t), stream);
+
+            auto tensor_index_dtype = DType::create<TensorIndex>();
+            auto seq_ids_buffer     = this->m_buffer_pool->acquire(
+                static_cast<TensorSize>(rows) * 3 * tensor_index_dtype.item_size(), stream);
+
+            for (TensorIndex start = 0; start < rows; start += this->m_chunk_size)
+            {
+                auto stop      = std::min(start + this->m_chunk_size, rows);
+                auto chunk_col = cudf::slice(col, {start, stop}).front();
+
+                auto token_results = tokenize_strings(cudf::strings_column_view{chunk_col},
+                                                      *vocab,
+                                                      this->m_sequence_length,
+                                                      stride,
+                                                      this->m_do_lower_case,
+                                                      true);
+
+                const auto chunk_rows = static_cast<TensorIndex>(token_results.nrows_tensor);
+
+                MRC_CHECK_CUDA(
+                    cudaMemcpyAsync(static_cast<uint8_t*>(ids_buffer->data()) + start * seq_len * sizeof(int32_t),
+                                    token_results.tensor_token_ids->view().head(),
+                                    chunk_rows * seq_len * sizeof(int32_t),
+                                    cudaMemcpyDeviceToDevice,
+                                    stream.value()));
+
+                MRC_CHECK_CUDA(
+                    cudaMemcpyAsync(static_cast<uint8_t*>(mask_buffer->data()) + start * seq_len * sizeof(int32_t),
+                                    token_results.tensor_attention_mask->view().head(),
+                                    chunk_rows * seq_len * sizeof(int32_t),
+                                    cudaMemcpyDeviceToDevice,
+                                    stream.value()));
+
+                auto chunk_seq_ids = cudf::cast(token_results.tensor_metadata->view(),
+                                                cudf::data_type(tensor_index_dtype.cudf_type_id()));
+
+                const auto seq_ids_offset = static_cast<TensorSize>(start) * 3 * tensor_index_dtype.item_size();
+
+                MRC_CHECK_CUDA(cudaMemcpyAsync(static_cast<uint8_t*>(seq_ids_buffer->data()) + seq_ids_offset,
+                                               chunk_seq_ids->view().head(),
+                                               chunk_rows * 3 * tensor_index_dtype.item_size(),
+                                               cudaMemcpyDeviceToDevice,
+                                               stream.value()));
+
+                if (x->mess_offset + start > 0)
                 {
-                    token_results = nvtext::subword_tokenize(normalized_col_view,
-                                                             *vocab,
-                                                             this->m_sequence_length,
-                                                             stride,
-                                                             this->m_do_lower_case,
-                                                             this->m_truncation,
-                                                             rmm::mr::get_current_device_resource());
+                    // The tokenizer's row indices are chunk-local, shift them into the message's frame
+                    MatxUtil::offset_seq_ids_async(
+                        DevMemInfo{
+                            seq_ids_buffer, tensor_index_dtype.type_id(), {chunk_rows, 3}, {1, 3}, seq_ids_offset},
+                        x->mess_offset + start);
                 }
-                else
+            }
+
+            auto memory = std::make_shared<InferenceMemory>(rows);
+
+            memory->set_tensor("input_ids",
+                               Tensor::create(ids_buffer, DType::create<int32_t>(), {rows, seq_len}, {}, 0));
+            memory->set_tensor("input_mask",
+                               Tensor::create(mask_buffer, DType::create<int32_t>(), {rows, seq_len}, {}, 0));
+            memory->set_tensor("seq_ids", Tensor::create(seq_ids_buffer, tensor_index_dtype, {rows, 3}, {}, 0));
+
+            return std::make_shared<MultiInferenceMessage>(
+                x->meta, x->mess_offset, x->mess_count, std::move(memory), 0, rows);
+        };
+
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output, stride, vocab, process_deduped, process_chunked](sink_type_t x) {
+                MORPHEUS_NVTX_RANGE("PreprocessNLPStage::on_data");
+                MORPHEUS_STAGE_TIMER("PreprocessNLPStage");
+                MORPHEUS_STAGE_MEMORY_SCOPE("PreprocessNLPStage");
+
+                // Convert to string view
+                auto meta = x->get_meta(this->m_column);
+                auto col  = meta.get_column(0);
+
+                if (this->m_dedupe && this->m_truncation && col.size() > 1)
                 {
-                    // workaround for a situation where the input strings contain either no characters or only
-                    // whitespace
-                    auto zero = cudf::numeric_scalar<uint32_t>(0, true, rmm::cuda_stream_default);
-                    auto ids =
-                        cudf::make_column_from_scalar(zero, this->m_sequence_length * normalized_col_view.size());
-                    auto mask =
-                        cudf::make_column_from_scalar(zero, this->m_sequence_length * normalized_col_view.size());
-                    auto metadata = [&]() {
-                        auto iota   = cudf::sequence(normalized_col_view.size(), zero);
-                        auto zeroes = cudf::make_column_from_scalar(zero, normalized_col_view.size());
-                        return cudf::interleave_columns(cudf::table_view{
-                            std::vector<cudf::column_view>{iota->view(), zeroes->view(), zeroes->view()}});
-                    }();
-
-                    token_results = nvtext::tokenizer_result{static_cast<uint32_t>(normalized_col_view.size()),
-                                                             this->m_sequence_length,
-                                                             std::move(ids),
-                                                             std::move(mask),
-                                                             std::move(metadata)};
+                    // Byte-identical rows tokenize identically, so tokenize each distinct string once. Like the
+                    // chunked path this needs truncation's one-sequence-per-row guarantee
+                    auto dict      = cudf::dictionary::encode(col, cudf::data_type{cudf::type_id::INT32});
+                    auto dict_view = cudf::dictionary_column_view{dict->view()};
+
+                    if (dict_view.keys_size() < col.size())
+                    {
+                        output.on_next(process_deduped(x, dict_view));
+                        return;
+                    }
+
+                    // All rows are distinct, the gather would be pure overhead; fall through to the direct paths
                 }
 
+                if (this->m_chunk_size > 0 && this->m_truncation && col.size() > this->m_chunk_size)
+                {
+                    // Without truncation the sequence count per row is data dependent and the output extents
+                    // cannot be sized up front, so chunking only applies when truncation is enabled
+                    output.on_next(process_chunked(x));
+                    return;
+                }
+
+                auto string_col = cudf::strings_column_view{col};
+
+                // Perform the tokenizer
+                auto token_results = tokenize_strings(
+                    string_col, *vocab, this->m_sequence_length, stride, this->m_do_lower_case, this->m_truncation);
+
                 // Build the results
                 auto memory = std::make_shared<InferenceMemory>(token_results.nrows_tensor);
 
                 TensorIndex length = token_results.tensor_token_ids->size() / token_results.sequence_length;
-                auto input_ids_released =
-                    cudf::cast(token_results.tensor_token_ids->view(), cudf::data_type(cudf::type_id::INT32))
-                        ->release();
+
+                // Token ids and the attention mask are small non-negative values, so the uint32 columns can be
+                // reinterpreted as int32 in place rather than allocating a cast copy for every batch
+                auto input_ids_released = token_results.tensor_token_ids->release();
 
                 memory->set_tensor("input_ids",
                                    Tensor::create(std::move(input_ids_released.data),
@@ -155,10 +406,8 @@ PreprocessNLPStage::subscribe_fn_t PreprocessNLPStage::build_operator()
                                                   {},
                                                   0));
 
-                length = token_results.tensor_attention_mask->size() / token_results.sequence_length;
-                auto input_mask_released =
-                    cudf::cast(token_results.tensor_attention_mask->view(), cudf::data_type(cudf::type_id::INT32))
-                        ->release();
+                length                  = token_results.tensor_attention_mask->size() / token_results.sequence_length;
+                auto input_mask_released = token_results.tensor_attention_mask->release();
                 memory->set_tensor("input_mask",
                                    Tensor::create(std::move(input_mask_released.data),
                                                   DType::create<int32_t>(),
@@ -176,8 +425,9 @@ PreprocessNLPStage::subscribe_fn_t PreprocessNLPStage::build_operator()
 
                 if (x->mess_offset > 0)
                 {
-                    // Add an offset to the seq_ids so the message IDs line up
-                    MatxUtil::offset_seq_ids(
+                    // Add an offset to the seq_ids so the message IDs line up. The async variant chains the kernel
+                    // behind the cast above on the buffer's stream, avoiding a host sync per batch
+                    MatxUtil::offset_seq_ids_async(
                         DevMemInfo{seq_ids_data, tensor_index_dtype.type_id(), {length, 3}, {1, 3}}, x->mess_offset);
                 }
 
@@ -203,10 +453,22 @@ std::shared_ptr<mrc::segment::Object<PreprocessNLPStage>> PreprocessNLPStageInte
     bool do_lower_case,
     bool add_special_token,
     int stride,
-    std::string column)
+    std::string column,
+    TensorIndex chunk_size,
+    bool dedupe,
+    TensorIndex warmup_rows)
 {
-    auto stage = builder.construct_object<PreprocessNLPStage>(
-        name, vocab_hash_file, sequence_length, truncation, do_lower_case, add_special_token, stride, column);
+    auto stage = builder.construct_object<PreprocessNLPStage>(name,
+                                                              vocab_hash_file,
+                                                              sequence_length,
+                                                              truncation,
+                                                              do_lower_case,
+                                                              add_special_token,
+                                                              stride,
+                                                              column,
+                                                              chunk_size,
+                                                              dedupe,
+                                                              warmup_rows);
 
     return stage;
 }
@@ -0,0 +1,194 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/regex_extract.hpp"
+
+#include "mrc/segment/builder.hpp"
+#include "mrc/segment/object.hpp"
+#include "pymrc/node.hpp"
+
+#include "morpheus/objects/dtype.hpp"               // for DType
+#include "morpheus/objects/table_info.hpp"          // for TableInfo
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
+
+#include <cudf/column/column.hpp>                     // for column
+#include <cudf/io/types.hpp>                          // for table_metadata
+#include <cudf/scalar/scalar.hpp>                     // for string_scalar
+#include <cudf/strings/convert/convert_booleans.hpp>  // for to_booleans
+#include <cudf/strings/convert/convert_floats.hpp>    // for to_floats
+#include <cudf/strings/convert/convert_integers.hpp>  // for to_integers
+#include <cudf/strings/extract.hpp>                   // for extract
+#include <cudf/strings/strings_column_view.hpp>       // for strings_column_view
+#include <cudf/table/table.hpp>                       // for table
+#include <cudf/table/table_view.hpp>                  // for table_view
+#include <cudf/types.hpp>                             // for type_id
+#include <glog/logging.h>                             // for CHECK
+
+#include <algorithm>  // for find
+#include <cstddef>    // for size_t
+#include <exception>
+#include <memory>
+#include <stdexcept>  // for invalid_argument
+#include <utility>    // for move
+
+namespace {
+
+using namespace morpheus;
+
+// The capture groups come back as strings, convert each to the dtype its extraction requested
+std::unique_ptr<cudf::column> convert_extracted(std::unique_ptr<cudf::column> extracted, const DType& dtype)
+{
+    if (dtype.type_id() == TypeId::STRING)
+    {
+        return extracted;
+    }
+
+    auto string_view = cudf::strings_column_view(extracted->view());
+
+    switch (dtype.type_id())
+    {
+    case TypeId::INT8:
+    case TypeId::INT16:
+    case TypeId::INT32:
+    case TypeId::INT64:
+    case TypeId::UINT8:
+    case TypeId::UINT16:
+    case TypeId::UINT32:
+    case TypeId::UINT64:
+        return cudf::strings::to_integers(string_view, cudf::data_type{dtype.cudf_type_id()});
+    case TypeId::FLOAT32:
+    case TypeId::FLOAT64:
+        return cudf::strings::to_floats(string_view, cudf::data_type{dtype.cudf_type_id()});
+    case TypeId::BOOL8:
+        return cudf::strings::to_booleans(string_view, cudf::string_scalar("true"));
+    default:
+        throw std::invalid_argument("Unsupported extraction type");
+    }
+}
+
+}  // namespace
+
+namespace morpheus {
+
+// Component public implementations
+// ************ RegexExtractStage **************************** //
+RegexExtractStage::RegexExtractStage(std::string input_column, const std::vector<extraction_t>& extractions) :
+  PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
+  m_input_column(std::move(input_column))
+{
+    CHECK(!extractions.empty()) << "RegexExtractStage requires at least one extraction";
+
+    m_output_columns.reserve(extractions.size());
+    m_output_types.reserve(extractions.size());
+    m_programs.reserve(extractions.size());
+
+    // Compile every pattern up front, batches only pay for the device scan itself
+    for (const auto& [column, pattern, type_id] : extractions)
+    {
+        m_output_columns.push_back(column);
+        m_output_types.push_back(type_id);
+        m_programs.push_back(cudf::strings::regex_program::create(pattern));
+    }
+}
+
+std::shared_ptr<MessageMeta> RegexExtractStage::on_data(sink_type_t msg)
+{
+    MORPHEUS_NVTX_RANGE("RegexExtractStage::on_data");
+    MORPHEUS_STAGE_TIMER("RegexExtractStage");
+    MORPHEUS_STAGE_MEMORY_SCOPE("RegexExtractStage");
+
+    auto table_info   = msg->get_info();
+    auto table_view   = table_info.get_view();
+    auto index_names  = table_info.get_index_names();
+    auto column_names = table_info.get_column_names();
+
+    auto found = std::find(column_names.begin(), column_names.end(), m_input_column);
+    CHECK(found != column_names.end()) << "Input column '" << m_input_column << "' not found in the dataframe";
+
+    // The view places the index columns ahead of the data columns
+    const auto& raw_lines = table_view.column(index_names.size() + (found - column_names.begin()));
+    CHECK(raw_lines.type().id() == cudf::type_id::STRING)
+        << "Input column '" << m_input_column << "' must be a string column";
+
+    auto raw_view = cudf::strings_column_view(raw_lines);
+
+    std::vector<std::unique_ptr<cudf::column>> extracted_columns;
+    extracted_columns.reserve(m_programs.size());
+
+    for (std::size_t i = 0; i < m_programs.size(); ++i)
+    {
+        // Every capture group is materialized, only the first supplies the output column
+        auto captures = cudf::strings::extract(raw_view, *m_programs[i])->release();
+
+        extracted_columns.push_back(convert_extracted(std::move(captures.front()), DType(m_output_types[i])));
+    }
+
+    // Rebuild the table with the extracted columns appended, one device pass over the existing columns
+    auto columns = std::make_unique<cudf::table>(table_view)->release();
+    columns.reserve(columns.size() + extracted_columns.size());
+
+    for (auto& column : extracted_columns)
+    {
+        columns.push_back(std::move(column));
+    }
+
+    auto metadata = cudf::io::table_metadata{};
+    metadata.schema_info.reserve(index_names.size() + column_names.size() + m_output_columns.size());
+
+    for (const auto& name : index_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    for (const auto& name : column_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    for (const auto& name : m_output_columns)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    return MessageMeta::create_from_cpp({std::make_unique<cudf::table>(std::move(columns)), std::move(metadata)},
+                                        static_cast<int>(index_names.size()));
+}
+
+RegexExtractStage::subscribe_fn_t RegexExtractStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output](sink_type_t msg) { output.on_next(this->on_data(std::move(msg))); },
+            [&](std::exception_ptr error_ptr) { output.on_error(error_ptr); },
+            [&]() { output.on_completed(); }));
+    };
+}
+
+// ************ RegexExtractStageInterfaceProxy ************* //
+std::shared_ptr<mrc::segment::Object<RegexExtractStage>> RegexExtractStageInterfaceProxy::init(
+    mrc::segment::Builder& builder,
+    const std::string& name,
+    std::string input_column,
+    const std::vector<RegexExtractStage::extraction_t>& extractions)
+{
+    auto stage = builder.construct_object<RegexExtractStage>(name, std::move(input_column), extractions);
+
+    return stage;
+}
+}  // namespace morpheus
@@ -27,7 +27,17 @@
 #include "pymrc/node.hpp"
 
 #include "morpheus/messages/meta.hpp"
-#include "morpheus/objects/table_info.hpp"
+#include "morpheus/objects/table_info.hpp"          // for TableInfo
+#include "morpheus/utilities/memory_telemetry.hpp"  // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"              // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/stage_latency.hpp"     // for MORPHEUS_STAGE_TIMER
+
+#include <cudf/column/column_view.hpp>    // for column_view
+#include <cudf/io/types.hpp>              // for table_metadata
+#include <cudf/stream_compaction.hpp>     // for apply_boolean_mask
+#include <cudf/table/table.hpp>           // for table
+#include <cudf/types.hpp>                 // for type_id
+#include <glog/logging.h>                 // for CHECK
 
 #include <exception>
 #include <functional>
@@ -47,9 +57,11 @@ constexpr std::regex_constants::syntax_option_type RegexOptions =
 // ************ WriteToFileStage **************************** //
 SerializeStage::SerializeStage(const std::vector<std::string>& include,
                                const std::vector<std::string>& exclude,
-                               bool fixed_columns) :
+                               bool fixed_columns,
+                               std::string filter_mask_column) :
   PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
-  m_fixed_columns{fixed_columns}
+  m_fixed_columns{fixed_columns},
+  m_filter_mask_column{std::move(filter_mask_column)}
 {
     make_regex_objs(include, m_include);
     make_regex_objs(exclude, m_exclude);
@@ -92,35 +104,96 @@ bool SerializeStage::exclude_column(const std::string& column) const
     return match_column(m_exclude, column);
 }
 
-std::shared_ptr<SlicedMessageMeta> SerializeStage::get_meta(sink_type_t& msg)
+void SerializeStage::update_column_selection(sink_type_t& msg)
 {
     // If none of the columns match the include regex patterns or are all are excluded this has the effect
     // of including all of the rows since calling msg->get_meta({}) will return a view with all columns.
     // The Python impl appears to have the same behavior.
     if (!m_fixed_columns || m_column_names.empty())
     {
-        m_column_names.clear();
-        for (const auto& c : msg->get_meta().get_column_names())
+        auto column_names = msg->get_meta_column_names();
+
+        // Only re-run the regexes when the incoming schema differs from the one the cached selection was
+        // computed against. In the common case of a stable schema this is a single vector comparison.
+        if (column_names != m_cached_schema)
         {
-            if (include_column(c) && !exclude_column(c))
+            m_column_names.clear();
+            for (const auto& c : column_names)
             {
-                m_column_names.push_back(c);
+                if (c != m_filter_mask_column && include_column(c) && !exclude_column(c))
+                {
+                    m_column_names.push_back(c);
+                }
             }
+
+            m_cached_schema = std::move(column_names);
         }
     }
+}
+
+std::shared_ptr<SlicedMessageMeta> SerializeStage::get_meta(sink_type_t& msg)
+{
+    MORPHEUS_NVTX_RANGE("SerializeStage::get_meta");
+    MORPHEUS_STAGE_TIMER("SerializeStage");
+    MORPHEUS_STAGE_MEMORY_SCOPE("SerializeStage");
+
+    this->update_column_selection(msg);
 
     return std::make_shared<SlicedMessageMeta>(
         msg->meta, msg->mess_offset, msg->mess_offset + msg->mess_count, m_column_names);
 }
 
+std::shared_ptr<MessageMeta> SerializeStage::apply_mask(sink_type_t& msg)
+{
+    MORPHEUS_NVTX_RANGE("SerializeStage::apply_mask");
+    MORPHEUS_STAGE_TIMER("SerializeStage");
+    MORPHEUS_STAGE_MEMORY_SCOPE("SerializeStage");
+
+    this->update_column_selection(msg);
+
+    auto table_info = msg->get_meta(m_column_names);
+    auto mask_info  = msg->get_meta(m_filter_mask_column);
+
+    const auto& mask = mask_info.get_column(0);
+    CHECK(mask.type().id() == cudf::type_id::BOOL8)
+        << "Filter mask column '" << m_filter_mask_column << "' must be a bool column";
+
+    // Single fused gather: every surviving row (index columns included) is moved exactly once, at write time
+    auto filtered = cudf::apply_boolean_mask(table_info.get_view(), mask);
+
+    auto index_names  = table_info.get_index_names();
+    auto column_names = table_info.get_column_names();
+
+    auto metadata = cudf::io::table_metadata{};
+    metadata.schema_info.reserve(index_names.size() + column_names.size());
+
+    for (const auto& name : index_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    for (const auto& name : column_names)
+    {
+        metadata.schema_info.emplace_back(name);
+    }
+
+    return MessageMeta::create_from_cpp({std::move(filtered), std::move(metadata)},
+                                        static_cast<int>(index_names.size()));
+}
+
 SerializeStage::subscribe_fn_t SerializeStage::build_operator()
 {
     return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
         return input.subscribe(rxcpp::make_observer<sink_type_t>(
             [this, &output](sink_type_t msg) {
-                auto next_meta = this->get_meta(msg);
-
-                output.on_next(std::move(next_meta));
+                if (!m_filter_mask_column.empty())
+                {
+                    output.on_next(this->apply_mask(msg));
+                }
+                else
+                {
+                    output.on_next(this->get_meta(msg));
+                }
             },
             [&](std::exception_ptr error_ptr) { output.on_error(error_ptr); },
             [&]() { output.on_completed(); }));
@@ -133,9 +206,11 @@ std::shared_ptr<mrc::segment::Object<SerializeStage>> SerializeStageInterfacePro
     const std::string& name,
     const std::vector<std::string>& include,
     const std::vector<std::string>& exclude,
-    bool fixed_columns)
+    bool fixed_columns,
+    std::string filter_mask_column)
 {
-    auto stage = builder.construct_object<SerializeStage>(name, include, exclude, fixed_columns);
+    auto stage =
+        builder.construct_object<SerializeStage>(name, include, exclude, fixed_columns, std::move(filter_mask_column));
 
     return stage;
 }
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/stages/trigger.hpp"
+
+#include "morpheus/objects/table_info.hpp"
+
+#include <cudf/concatenate.hpp>  // for concatenate
+#include <cudf/io/types.hpp>     // for table_metadata, table_with_metadata
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <utility>  // for move
+#include <vector>
+
+namespace morpheus {
+
+std::vector<std::shared_ptr<MessageMeta>> merge_buffered_messages(std::vector<std::shared_ptr<MessageMeta>>&& buffered)
+{
+    if (buffered.size() <= 1)
+    {
+        return std::move(buffered);
+    }
+
+    // The TableInfo checkouts must outlive the concatenate call, the views alone don't hold the tables
+    std::vector<TableInfo> table_infos;
+    std::vector<cudf::table_view> views;
+    table_infos.reserve(buffered.size());
+    views.reserve(buffered.size());
+
+    for (const auto& msg : buffered)
+    {
+        table_infos.emplace_back(msg->get_info());
+        views.emplace_back(table_infos.back().get_view());
+    }
+
+    auto column_names = table_infos.front().get_column_names();
+    auto metadata     = cudf::io::table_metadata{};
+
+    metadata.schema_info.reserve(column_names.size() + 1);
+    metadata.schema_info.emplace_back("");
+
+    for (auto column_name : column_names)
+    {
+        metadata.schema_info.emplace_back(column_name);
+    }
+
+    cudf::io::table_with_metadata table = {cudf::concatenate(views), std::move(metadata)};
+
+    std::vector<std::shared_ptr<MessageMeta>> merged;
+    merged.emplace_back(MessageMeta::create_from_cpp(std::move(table), 1));
+
+    return merged;
+}
+
+std::vector<std::shared_ptr<MultiMessage>> merge_buffered_messages(
+    std::vector<std::shared_ptr<MultiMessage>>&& buffered)
+{
+    std::vector<std::shared_ptr<MultiMessage>> merged;
+
+    for (auto& msg : buffered)
+    {
+        // Extend the previous message when this one continues the same meta's row range, otherwise a merge would
+        // require a gather & copy which defeats the purpose of re-batching
+        if (!merged.empty() && merged.back()->meta == msg->meta &&
+            merged.back()->mess_offset + merged.back()->mess_count == msg->mess_offset)
+        {
+            merged.back() = std::make_shared<MultiMessage>(
+                merged.back()->meta, merged.back()->mess_offset, merged.back()->mess_count + msg->mess_count);
+        }
+        else
+        {
+            merged.emplace_back(std::move(msg));
+        }
+    }
+
+    return merged;
+}
+
+}  // namespace morpheus
@@ -29,14 +29,21 @@
 #include "morpheus/messages/memory/tensor_memory.hpp"  // for TensorMemory
 #include "morpheus/objects/dev_mem_info.hpp"           // for DevMemInfo
 #include "morpheus/objects/dtype.hpp"                  // for DType
+#include "morpheus/objects/memory_descriptor.hpp"      // for MemoryDescriptor
 #include "morpheus/objects/tensor.hpp"                 // for Tensor::create
 #include "morpheus/objects/tensor_object.hpp"          // for TensorObject
 #include "morpheus/objects/triton_in_out.hpp"          // for TritonInOut
 #include "morpheus/types.hpp"                          // for TensorIndex, TensorMap
+#include "morpheus/utilities/buffer_pool.hpp"          // for BufferPool
 #include "morpheus/utilities/matx_util.hpp"            // for MatxUtil::logits, MatxUtil::reduce_max
+#include "morpheus/utilities/memory_telemetry.hpp"     // for MORPHEUS_STAGE_MEMORY_SCOPE
+#include "morpheus/utilities/nvtx.hpp"                 // for MORPHEUS_NVTX_RANGE
+#include "morpheus/utilities/pinned_memory.hpp"        // for PinnedMemory
+#include "morpheus/utilities/stage_latency.hpp"        // for MORPHEUS_STAGE_TIMER
 #include "morpheus/utilities/stage_util.hpp"           // for foreach_map
+#include "morpheus/utilities/stream_pool.hpp"          // for StreamPool
 #include "morpheus/utilities/string_util.hpp"          // for MORPHEUS_CONCAT_STR
-#include "morpheus/utilities/tensor_util.hpp"          // for get_elem_count
+#include "morpheus/utilities/tensor_util.hpp"          // for TensorUtils
 
 #include <cuda_runtime.h>  // for cudaMemcpy, cudaMemcpy2D, cudaMemcpyDeviceToHost, cudaMemcpyHostToDevice
 #include <glog/logging.h>
@@ -44,15 +51,25 @@
 #include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
 #include <nlohmann/json.hpp>
 #include <pymrc/node.hpp>
-#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
+#include <rmm/cuda_stream.hpp>       // for cuda_stream
+#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_view
 #include <rmm/device_buffer.hpp>     // for device_buffer
+#include <rmm/mr/device/per_device_resource.hpp>  // for get_current_device_resource
 
-#include <algorithm>  // for min
+#include <boost/fiber/future/future.hpp>   // for future
+#include <boost/fiber/future/promise.hpp>  // for promise
+
+#include <algorithm>  // for min, nth_element
+#include <chrono>     // for steady_clock
 #include <cstddef>
 #include <cstdint>
+#include <cstring>  // for memcpy
+#include <deque>  // for deque
 #include <exception>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>  // for mutex, lock_guard
 #include <sstream>
 #include <stdexcept>  // for runtime_error, out_of_range
 #include <utility>
@@ -93,6 +110,7 @@ void InferenceClientStage__check_triton_errors(triton::client::Error status,
 
 void build_output_tensors(TensorIndex count,
                           const std::vector<TritonInOut>& model_outputs,
+                          BufferPool& buffer_pool,
                           buffer_map_t& output_buffers,
                           TensorMap& output_tensors)
 {
@@ -105,9 +123,13 @@ void build_output_tensors(TensorIndex count,
         total_shape[0]  = count;
         auto elem_count = TensorUtils::get_elem_count(total_shape);
 
-        // Create the output memory
-        auto output_buffer = std::make_shared<rmm::device_buffer>(elem_count * model_output.datatype.item_size(),
-                                                                  rmm::cuda_stream_per_thread);
+        // Half precision outputs are expanded to FLOAT32 before they are handed downstream
+        auto tensor_dtype = model_output.datatype.type_id() == TypeId::FLOAT16 ? DType(TypeId::FLOAT32)
+                                                                               : model_output.datatype;
+
+        // Create the output memory. Output shapes repeat across batches, so the buffers recycle through the
+        // stage's pool instead of hitting the RMM resource every batch
+        auto output_buffer = buffer_pool.acquire(elem_count * tensor_dtype.item_size(), StreamPool::get_stream());
 
         output_buffers[model_output.mapped_name] = output_buffer;
 
@@ -115,7 +137,7 @@ void build_output_tensors(TensorIndex count,
         // https://github.com/kserve/kserve/blob/master/docs/predict-api/v2/required_api.md#tensor-data
         ShapeType stride{total_shape[1], 1};
         output_tensors[model_output.mapped_name].swap(
-            Tensor::create(std::move(output_buffer), model_output.datatype, total_shape, stride, 0));
+            Tensor::create(std::move(output_buffer), tensor_dtype, total_shape, stride, 0));
     }
 }
 
@@ -139,7 +161,7 @@ ShapeType get_seq_ids(const InferenceClientStage::sink_type_t& message)
     return host_seq_ids;
 }
 
-std::pair<std::shared_ptr<triton::client::InferInput>, std::vector<uint8_t>> build_input(
+std::pair<std::shared_ptr<triton::client::InferInput>, std::shared_ptr<rmm::device_buffer>> build_input(
     const InferenceClientStage::sink_type_t& msg_slice, const TritonInOut& model_input)
 {
     DCHECK(msg_slice->memory->has_tensor(model_input.mapped_name))
@@ -147,10 +169,34 @@ std::pair<std::shared_ptr<triton::client::InferInput>, std::vector<uint8_t>> bui
 
     auto const& inp_tensor = msg_slice->get_input(model_input.mapped_name);
 
-    // Convert to the right type. Make shallow if necessary
-    auto final_tensor = inp_tensor.as_type(model_input.datatype);
+    // Stage into pinned host memory, a pageable destination would halve the copy bandwidth
+    std::shared_ptr<rmm::device_buffer> inp_data;
+
+    if (model_input.datatype.type_id() == TypeId::FLOAT16)
+    {
+        // The generic cast path cannot produce halves (cuDF has no half type). Pack on device with the dedicated
+        // kernel and pull the packed values off at half the transfer size
+        auto fp32_tensor = inp_tensor.as_type(DType(TypeId::FLOAT32));
+
+        auto md =
+            std::make_shared<MemoryDescriptor>(StreamPool::get_stream(), rmm::mr::get_current_device_resource());
+
+        auto fp16_buffer = MatxUtil::cast_fp32_to_fp16(
+            DevMemInfo{fp32_tensor.data(), fp32_tensor.dtype(), md, fp32_tensor.get_shape(), fp32_tensor.get_stride()});
+
+        inp_data = PinnedMemory::make_buffer(fp16_buffer->size(), StreamPool::get_stream());
+        MRC_CHECK_CUDA(cudaMemcpy(inp_data->data(), fp16_buffer->data(), fp16_buffer->size(), cudaMemcpyDeviceToHost));
+    }
+    else
+    {
+        // Convert to the right type. Make shallow if necessary
+        auto final_tensor = inp_tensor.as_type(model_input.datatype);
+
+        inp_data = PinnedMemory::make_buffer(final_tensor.bytes(), StreamPool::get_stream());
 
-    std::vector<uint8_t> inp_data = final_tensor.get_host_data();
+        // Sliced inputs are shallow row-strided views; copy_compact turns those into one 2D transfer
+        TensorUtils::copy_compact(final_tensor, inp_data->data(), cudaMemcpyDeviceToHost);
+    }
 
     // Test
     triton::client::InferInput* inp_ptr;
@@ -161,11 +207,91 @@ std::pair<std::shared_ptr<triton::client::InferInput>, std::vector<uint8_t>> bui
     std::shared_ptr<triton::client::InferInput> inp_shared;
     inp_shared.reset(inp_ptr);
 
-    inp_ptr->AppendRaw(inp_data);
+    inp_ptr->AppendRaw(static_cast<const uint8_t*>(inp_data->data()), inp_data->size());
+
+    return std::make_pair(inp_shared, std::move(inp_data));
+}
+
+std::pair<std::shared_ptr<triton::client::InferInput>, std::shared_ptr<rmm::device_buffer>> build_coalesced_input(
+    const std::vector<InferenceClientStage::sink_type_t>& msgs, const TritonInOut& model_input, TensorIndex total_rows)
+{
+    // Concatenate each message's input tensor into a single pinned request payload
+    std::shared_ptr<rmm::device_buffer> inp_data;
+    std::size_t write_offset = 0;
+    TensorIndex cols         = 0;
+
+    for (auto const& msg : msgs)
+    {
+        DCHECK(msg->memory->has_tensor(model_input.mapped_name))
+            << "Model input '" << model_input.mapped_name << "' not found in InferenceMemory";
+
+        auto const& inp_tensor = msg->get_input(model_input.mapped_name);
+
+        DCHECK(cols == 0 || cols == inp_tensor.shape(1)) << "Coalesced messages must share input dimensions";
+        cols = inp_tensor.shape(1);
+
+        // Convert to the right type. Make shallow if necessary
+        auto final_tensor = inp_tensor.as_type(model_input.datatype);
+
+        if (!inp_data)
+        {
+            // Every message shares the column count, so the payload size is known from the first tensor
+            inp_data = PinnedMemory::make_buffer(
+                static_cast<std::size_t>(total_rows) * cols * model_input.datatype.item_size(),
+                StreamPool::get_stream());
+        }
+
+        // Sliced inputs are shallow row-strided views; copy_compact turns those into one 2D transfer
+        TensorUtils::copy_compact(
+            final_tensor, static_cast<uint8_t*>(inp_data->data()) + write_offset, cudaMemcpyDeviceToHost);
+        write_offset += final_tensor.bytes();
+    }
+
+    triton::client::InferInput* inp_ptr;
+
+    triton::client::InferInput::Create(
+        &inp_ptr, model_input.name, {total_rows, cols}, model_input.datatype.triton_str());
+
+    std::shared_ptr<triton::client::InferInput> inp_shared;
+    inp_shared.reset(inp_ptr);
+
+    inp_ptr->AppendRaw(static_cast<const uint8_t*>(inp_data->data()), inp_data->size());
 
     return std::make_pair(inp_shared, std::move(inp_data));
 }
 
+std::pair<std::shared_ptr<triton::client::InferInput>, std::shared_ptr<rmm::device_buffer>> build_input_shm(
+    const InferenceClientStage::sink_type_t& msg_slice,
+    const TritonInOut& model_input,
+    TritonCudaShmRegion& region,
+    rmm::cuda_stream_view stream)
+{
+    DCHECK(msg_slice->memory->has_tensor(model_input.mapped_name))
+        << "Model input '" << model_input.mapped_name << "' not found in InferenceMemory";
+
+    auto const& inp_tensor = msg_slice->get_input(model_input.mapped_name);
+
+    // Convert to the right type. Make shallow if necessary
+    auto final_tensor = inp_tensor.as_type(model_input.datatype);
+
+    // Stage into the registered region with a device-to-device copy, the bytes never touch the host. The copy is
+    // issued on the stage's own stream; the caller synchronizes it before the request goes out
+    region.ensure_size(final_tensor.bytes());
+    TensorUtils::copy_compact_async(final_tensor, region.data(), cudaMemcpyDeviceToDevice, stream.value());
+
+    triton::client::InferInput* inp_ptr;
+
+    triton::client::InferInput::Create(
+        &inp_ptr, model_input.name, {inp_tensor.shape(0), inp_tensor.shape(1)}, model_input.datatype.triton_str());
+
+    std::shared_ptr<triton::client::InferInput> inp_shared;
+    inp_shared.reset(inp_ptr);
+
+    inp_ptr->SetSharedMemory(region.name(), final_tensor.bytes(), 0);
+
+    return std::make_pair(inp_shared, std::shared_ptr<rmm::device_buffer>{});
+}
+
 std::shared_ptr<const triton::client::InferRequestedOutput> build_output(const TritonInOut& model_output)
 {
     triton::client::InferRequestedOutput* out_ptr;
@@ -177,6 +303,18 @@ std::shared_ptr<const triton::client::InferRequestedOutput> build_output(const T
     return out_shared;
 }
 
+std::shared_ptr<rmm::device_buffer> stage_response(BufferPool& pinned_pool, const uint8_t* data, std::size_t size)
+{
+    // Triton owns the response allocation and it is pageable, so uploading straight from it runs at half bandwidth
+    // and cannot overlap. Restage the bytes through a pooled pinned buffer first; the host-side memcpy is cheap
+    // next to the pageable-copy penalty it removes, and response shapes repeat so the buffers recycle
+    auto staged = pinned_pool.acquire(size, StreamPool::get_stream());
+
+    std::memcpy(staged->data(), data, size);
+
+    return staged;
+}
+
 void reduce_outputs(const InferenceClientStage::sink_type_t& x, buffer_map_t& output_buffers, TensorMap& output_tensors)
 {
     // When our tensor lengths are longer than our dataframe we will need to use the seq_ids array to
@@ -233,9 +371,112 @@ void apply_logits(buffer_map_t& output_buffers, TensorMap& output_tensors)
     output_tensors = std::move(logit_outputs);
 }
 
+// ************ TritonCudaShmRegion **************************//
+/**
+ * @brief A device buffer registered with Triton as a CUDA shared-memory region. Input tensors are staged into (and
+ * output tensors scattered out of) the region with device-to-device copies, so tensor bytes never cross PCIe inside
+ * an HTTP body. The region grows geometrically and is re-registered only when it grows.
+ */
+class TritonCudaShmRegion
+{
+  public:
+    TritonCudaShmRegion(triton::client::InferenceServerHttpClient& client, std::string name) :
+      m_client(client),
+      m_name(std::move(name))
+    {}
+
+    ~TritonCudaShmRegion()
+    {
+        this->release();
+    }
+
+    TritonCudaShmRegion(const TritonCudaShmRegion&)            = delete;
+    TritonCudaShmRegion& operator=(const TritonCudaShmRegion&) = delete;
+
+    void* ensure_size(std::size_t bytes)
+    {
+        if (bytes <= m_bytes)
+        {
+            return m_data;
+        }
+
+        this->release();
+
+        std::size_t new_bytes = 1;
+        while (new_bytes < bytes)
+        {
+            new_bytes <<= 1;
+        }
+
+        // IPC handles require the allocation base, so this memory comes straight from the CUDA runtime rather than
+        // an RMM pool
+        MRC_CHECK_CUDA(cudaMalloc(&m_data, new_bytes));
+
+        cudaIpcMemHandle_t handle;
+        MRC_CHECK_CUDA(cudaIpcGetMemHandle(&handle, m_data));
+
+        int device_id = 0;
+        MRC_CHECK_CUDA(cudaGetDevice(&device_id));
+
+        CHECK_TRITON(m_client.RegisterCudaSharedMemory(m_name, handle, device_id, new_bytes));
+
+        m_bytes = new_bytes;
+
+        return m_data;
+    }
+
+    const std::string& name() const
+    {
+        return m_name;
+    }
+
+    void* data() const
+    {
+        return m_data;
+    }
+
+  private:
+    void release()
+    {
+        if (m_data != nullptr)
+        {
+            m_client.UnregisterCudaSharedMemory(m_name);
+            MRC_CHECK_CUDA(cudaFree(m_data));
+            m_data  = nullptr;
+            m_bytes = 0;
+        }
+    }
+
+    triton::client::InferenceServerHttpClient& m_client;
+    std::string m_name;
+    void* m_data{nullptr};
+    std::size_t m_bytes{0};
+};
+
+using shm_region_map_t = std::map<std::string, std::unique_ptr<TritonCudaShmRegion>>;
+
+// ************ TritonModelSpec cache ************************//
+/**
+ * @brief Model metadata resolved from a Triton server: the unmapped input/output descriptions and the max batch
+ * size. Cached per server+model so reconnects and additional stage instances skip the metadata round trips.
+ */
+struct TritonModelSpec
+{
+    TensorIndex max_batch_size{-1};
+    std::vector<TritonInOut> inputs;
+    std::vector<TritonInOut> outputs;
+};
+
+std::mutex model_spec_cache_mutex;
+std::map<std::string, std::shared_ptr<const TritonModelSpec>> model_spec_cache;
+
 }  // namespace
 
 namespace morpheus {
+
+// Defined below, needed during construction
+static std::vector<std::string> split_server_urls(const std::string& server_url);
+
 // Component public implementations
 // ************ InferenceClientStage ************************* //
 InferenceClientStage::InferenceClientStage(std::string model_name,
@@ -243,7 +484,10 @@ InferenceClientStage::InferenceClientStage(std::string model_name,
                                            bool force_convert_inputs,
                                            bool use_shared_memory,
                                            bool needs_logits,
-                                           std::map<std::string, std::string> inout_mapping) :
+                                           std::map<std::string, std::string> inout_mapping,
+                                           std::size_t max_in_flight,
+                                           double hedge_quantile,
+                                           TensorIndex warmup_rows) :
   PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
   m_model_name(std::move(model_name)),
   m_server_url(std::move(server_url)),
@@ -251,10 +495,66 @@ InferenceClientStage::InferenceClientStage(std::string model_name,
   m_use_shared_memory(use_shared_memory),
   m_needs_logits(needs_logits),
   m_inout_mapping(std::move(inout_mapping)),
+  m_max_in_flight(max_in_flight),
+  m_hedge_quantile(hedge_quantile),
+  m_warmup_rows(warmup_rows),
   m_options(m_model_name)
 {
+    m_server_urls = split_server_urls(m_server_url);
+    if (m_server_urls.empty())
+    {
+        throw std::runtime_error("InferenceClientStage requires at least one server URL");
+    }
+
+    // Ensemble mode shares the comma-separated convention with the replica URLs: inputs are staged once and
+    // fanned out to every model concurrently
+    m_model_names = split_server_urls(m_model_name);
+    if (m_model_names.empty())
+    {
+        throw std::runtime_error("InferenceClientStage requires at least one model name");
+    }
+
+    if (m_model_names.size() > 1 && m_use_shared_memory)
+    {
+        throw std::runtime_error("Ensemble mode (multiple model names) is not supported with use_shared_memory");
+    }
+
+    // The member was initialized from the raw comma-separated string, point it at the primary model
+    m_options.model_name_ = m_model_names.front();
+
+    for (const auto& name : m_model_names)
+    {
+        m_model_options.emplace_back(name);
+    }
+
     // Connect with the server to setup the inputs/outputs
     this->connect_with_server();  // TODO(Devin)
+
+    if (m_warmup_rows > 0)
+    {
+        this->warmup();
+    }
+}
+
+void InferenceClientStage::warmup()
+{
+    // Acquire the buffers a batch of m_warmup_rows rows will need and let them retire straight back into the
+    // pools. The first real batch then reuses them instead of growing the RMM pool under the SLO clock.
+    buffer_map_t output_buffers;
+    TensorMap output_tensors;
+    build_output_tensors(m_warmup_rows, m_model_outputs, *m_buffer_pool, output_buffers, output_tensors);
+
+    for (const auto& model_output : m_model_outputs)
+    {
+        ShapeType total_shape = model_output.shape;
+        total_shape[0]        = m_warmup_rows;
+
+        // The pinned staging buffers the responses land in before their upload to the device
+        m_pinned_pool->acquire(TensorUtils::get_elem_count(total_shape) * model_output.datatype.item_size(),
+                               StreamPool::get_stream());
+    }
+
+    MRC_CHECK_CUDA(cudaStreamSynchronize(StreamPool::get_stream().value()));
 }
 
 InferenceClientStage::subscribe_fn_t InferenceClientStage::build_operator()
@@ -262,56 +562,207 @@ InferenceClientStage::subscribe_fn_t InferenceClientStage::build_operator()
     return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
         std::unique_ptr<triton::client::InferenceServerHttpClient> client;
 
-        CHECK_TRITON(triton::client::InferenceServerHttpClient::Create(&client, m_server_url, false));
+        CHECK_TRITON(triton::client::InferenceServerHttpClient::Create(&client, m_server_urls.front(), false));
 
-        return input.subscribe(rxcpp::make_observer<sink_type_t>(
-            [this, &output, &client](sink_type_t x) {
-                // Using the `count` which is the number of rows in the inference tensors. We will check later if this
-                // doesn't match the number of rows in the dataframe (`mess_count`). This happens when the size of the
-                // input is too large and needs to be broken up in chunks in the pre-process stage. When this is the
-                // case we will reduce the rows in the response outputs such that we have a single response for each
-                // row int he dataframe.
-                TensorMap output_tensors;
-                buffer_map_t output_buffers;
-                build_output_tensors(x->count, m_model_outputs, output_buffers, output_tensors);
-
-                for (TensorIndex start = 0; start < x->count; start += m_max_batch_size)
+        // One client per extra replica, used only for hedged re-issues of slow requests
+        std::vector<std::unique_ptr<triton::client::InferenceServerHttpClient>> hedge_clients;
+        for (std::size_t i = 1; i < m_server_urls.size(); ++i)
+        {
+            std::unique_ptr<triton::client::InferenceServerHttpClient> hedge_client;
+            CHECK_TRITON(triton::client::InferenceServerHttpClient::Create(&hedge_client, m_server_urls[i], false));
+            hedge_clients.emplace_back(std::move(hedge_client));
+        }
+
+        // Rolling latency window feeding the hedge threshold, and a round-robin cursor over the replicas
+        auto latency_window  = std::make_shared<std::vector<std::int64_t>>();
+        auto next_hedge_idx  = std::make_shared<std::size_t>(0);
+
+        // CUDA shared-memory staging regions, one per model input/output, lazily sized
+        auto shm_regions = std::make_shared<shm_region_map_t>();
+
+        // Dedicated copy streams so input staging and response scatter overlap with each other and never serialize
+        // behind default-stream cuDF work from other stages
+        auto stage_stream   = std::make_shared<rmm::cuda_stream>();
+        auto scatter_stream = std::make_shared<rmm::cuda_stream>();
+
+        auto process_message = [this,
+                                &output,
+                                &client,
+                                &hedge_clients,
+                                shm_regions,
+                                stage_stream,
+                                scatter_stream,
+                                latency_window,
+                                next_hedge_idx](sink_type_t x) {
+            MORPHEUS_NVTX_RANGE("InferenceClientStage::on_data");
+            MORPHEUS_STAGE_TIMER("InferenceClientStage");
+            MORPHEUS_STAGE_MEMORY_SCOPE("InferenceClientStage");
+
+            // Using the `count` which is the number of rows in the inference tensors. We will check later if this
+            // doesn't match the number of rows in the dataframe (`mess_count`). This happens when the size of the
+            // input is too large and needs to be broken up in chunks in the pre-process stage. When this is the
+            // case we will reduce the rows in the response outputs such that we have a single response for each
+            // row int he dataframe.
+            TensorMap output_tensors;
+            buffer_map_t output_buffers;
+            build_output_tensors(x->count, m_model_outputs, *m_buffer_pool, output_buffers, output_tensors);
+
+            auto get_shm_region = [&](const std::string& kind, const std::string& name) -> TritonCudaShmRegion& {
+                auto key   = MORPHEUS_CONCAT_STR(kind << "/" << name);
+                auto found = shm_regions->find(key);
+                if (found == shm_regions->end())
+                {
+                    // Region names must be unique per client connection
+                    auto region_name = MORPHEUS_CONCAT_STR("morpheus_" << this << "_" << kind << "_" << name);
+                    found            = shm_regions
+                                ->emplace(key,
+                                          std::make_unique<TritonCudaShmRegion>(*client, std::move(region_name)))
+                                .first;
+                }
+                return *found->second;
+            };
+
+            using saved_inputs_t = std::vector<
+                std::pair<std::shared_ptr<triton::client::InferInput>, std::shared_ptr<rmm::device_buffer>>>;
+            using saved_outputs_t = std::vector<std::shared_ptr<const triton::client::InferRequestedOutput>>;
+            using result_future_t = boost::fibers::future<std::unique_ptr<triton::client::InferResult>>;
+
+            // Submitted mini-batches awaiting their responses, one request per ensemble model. The
+            // inputs/outputs are shared with the completion callbacks so a hedged request that loses the race
+            // can finish safely after the batch is gone
+            struct PendingInfer
+            {
+                TensorIndex start;
+                TensorIndex stop;
+                std::shared_ptr<saved_inputs_t> inputs;
+                std::vector<std::shared_ptr<saved_outputs_t>> outputs;
+                std::chrono::steady_clock::time_point submitted;
+                std::vector<result_future_t> results;
+                result_future_t hedge_result;
+            };
+
+            std::deque<PendingInfer> pending;
+
+            // Pinned buffers holding responses whose device upload is still in flight; they go back to the pool
+            // once the scatter stream syncs below
+            std::vector<std::shared_ptr<rmm::device_buffer>> staged_responses;
+
+            // Shared-memory staging regions are reused across mini-batches, so they cannot be in flight twice
+            std::size_t max_in_flight = m_use_shared_memory ? 1 : std::max<std::size_t>(m_max_in_flight, 1);
+
+            // Issue a request; the callback keeps the inputs/outputs alive until it fires
+            auto submit = [](triton::client::InferenceServerHttpClient& request_client,
+                             const triton::client::InferOptions& options,
+                             const std::shared_ptr<saved_inputs_t>& saved_inputs,
+                             const std::shared_ptr<saved_outputs_t>& saved_outputs) -> result_future_t {
+                std::vector<triton::client::InferInput*> inputs =
+                    foreach_map(*saved_inputs, [](auto x) { return x.first.get(); });
+
+                std::vector<const triton::client::InferRequestedOutput*> outputs =
+                    foreach_map(*saved_outputs, [](auto x) { return x.get(); });
+
+                auto promise =
+                    std::make_shared<boost::fibers::promise<std::unique_ptr<triton::client::InferResult>>>();
+
+                CHECK_TRITON(request_client.AsyncInfer(
+                    [promise, saved_inputs, saved_outputs](triton::client::InferResult* results) {
+                        promise->set_value(std::unique_ptr<triton::client::InferResult>(results));
+                    },
+                    options,
+                    inputs,
+                    outputs));
+
+                return promise->get_future();
+            };
+
+            // The request latency above which a hedge is worthwhile, taken from the rolling window
+            constexpr std::size_t MaxLatencySamples = 64;
+            constexpr std::size_t MinLatencySamples = 8;
+
+            auto hedge_threshold = [this, latency_window]() -> std::chrono::microseconds {
+                if (latency_window->size() < MinLatencySamples)
                 {
-                    triton::client::InferInput* input1;
+                    return std::chrono::microseconds::max();
+                }
 
-                    TensorIndex stop = std::min(start + m_max_batch_size, x->count);
+                auto sorted = *latency_window;
+                auto idx    = static_cast<std::size_t>(m_hedge_quantile * (sorted.size() - 1));
 
-                    sink_type_t mini_batch_input = x->get_slice(start, stop);
+                std::nth_element(sorted.begin(), sorted.begin() + idx, sorted.end());
 
-                    // Iterate on the model inputs in case the model takes less than what tensors are available
-                    std::vector<std::pair<std::shared_ptr<triton::client::InferInput>, std::vector<uint8_t>>>
-                        saved_inputs = foreach_map(m_model_inputs, [&mini_batch_input](auto const& model_input) {
-                            return (build_input(mini_batch_input, model_input));
-                        });
+                return std::chrono::microseconds(sorted[idx]);
+            };
 
-                    std::vector<std::shared_ptr<const triton::client::InferRequestedOutput>> saved_outputs =
-                        foreach_map(m_model_outputs, [](auto const& model_output) {
-                            // Generate the outputs to be requested.
-                            return build_output(model_output);
-                        });
+            auto complete_oldest = [&]() {
+                auto batch = std::move(pending.front());
+                pending.pop_front();
+
+                // One result per ensemble model; only single-model requests participate in hedging
+                std::vector<std::unique_ptr<triton::client::InferResult>> results(batch.results.size());
 
-                    std::vector<triton::client::InferInput*> inputs =
-                        foreach_map(saved_inputs, [](auto x) { return x.first.get(); });
+                bool can_hedge = m_model_names.size() == 1 && m_hedge_quantile > 0.0 && !hedge_clients.empty() &&
+                                 !m_use_shared_memory;
+
+                auto threshold = can_hedge ? hedge_threshold() : std::chrono::microseconds::max();
+
+                if (threshold != std::chrono::microseconds::max() &&
+                    batch.results.front().wait_until(batch.submitted + threshold) !=
+                        boost::fibers::future_status::ready)
+                {
+                    // The primary replica is past the hedge threshold, race it against the next replica and take
+                    // whichever answers first. The loser finishes in the background and is dropped
+                    auto& hedge_client = *hedge_clients[(*next_hedge_idx)++ % hedge_clients.size()];
 
-                    std::vector<const triton::client::InferRequestedOutput*> outputs =
-                        foreach_map(saved_outputs, [](auto x) { return x.get(); });
+                    batch.hedge_result =
+                        submit(hedge_client, m_model_options.front(), batch.inputs, batch.outputs.front());
 
-                    auto results = std::unique_ptr<triton::client::InferResult>([&]() {
-                        triton::client::InferResult* results;
-                        CHECK_TRITON(client->Infer(&results, m_options, inputs, outputs));
-                        return results;
-                    }());
+                    constexpr auto PollInterval = std::chrono::microseconds(500);
 
-                    for (auto& model_output : m_model_outputs)
+                    while (!results.front())
+                    {
+                        if (batch.results.front().wait_for(PollInterval) == boost::fibers::future_status::ready)
+                        {
+                            results.front() = batch.results.front().get();
+                        }
+                        else if (batch.hedge_result.wait_for(PollInterval) == boost::fibers::future_status::ready)
+                        {
+                            results.front() = batch.hedge_result.get();
+                        }
+                    }
+                }
+
+                for (std::size_t i = 0; i < results.size(); ++i)
+                {
+                    if (!results[i])
+                    {
+                        results[i] = batch.results[i].get();
+                    }
+                }
+
+                auto elapsed =
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                          batch.submitted);
+
+                if (latency_window->size() >= MaxLatencySamples)
+                {
+                    latency_window->erase(latency_window->begin());
+                }
+                latency_window->push_back(elapsed.count());
+
+                auto start = batch.start;
+                auto stop  = batch.stop;
+
+                for (std::size_t model_idx = 0; model_idx < results.size(); ++model_idx)
+                {
+                    auto& model_results = results[model_idx];
+
+                    CHECK_TRITON(model_results->RequestStatus());
+
+                    for (auto& model_output : m_outputs_by_model[model_idx])
                     {
                         std::vector<int64_t> output_shape;
 
-                        CHECK_TRITON(results->Shape(model_output.name, &output_shape));
+                        CHECK_TRITON(model_results->Shape(model_output.name, &output_shape));
 
                         // Make sure we have at least 2 dims
                         while (output_shape.size() < 2)
@@ -319,48 +770,441 @@ InferenceClientStage::subscribe_fn_t InferenceClientStage::build_operator()
                             output_shape.push_back(1);
                         }
 
-                        const uint8_t* output_ptr = nullptr;
-                        size_t output_ptr_size    = 0;
-                        CHECK_TRITON(results->RawData(model_output.name, &output_ptr, &output_ptr_size));
-
                         auto output_tensor = output_tensors[model_output.mapped_name].slice({start, 0}, {stop, -1});
 
                         DCHECK_EQ(stop - start, output_shape[0]);
-                        DCHECK_EQ(output_tensor.bytes(), output_ptr_size);
-                        DCHECK_NOTNULL(output_ptr);
                         DCHECK_NOTNULL(output_tensor.data());
 
-                        MRC_CHECK_CUDA(
-                            cudaMemcpy(output_tensor.data(), output_ptr, output_ptr_size, cudaMemcpyHostToDevice));
+                        if (m_use_shared_memory)
+                        {
+                            // Triton wrote the result into the registered region, scatter it device-to-device
+                            auto& region = get_shm_region("output", model_output.name);
+                            MRC_CHECK_CUDA(cudaMemcpyAsync(output_tensor.data(),
+                                                           region.data(),
+                                                           output_tensor.bytes(),
+                                                           cudaMemcpyDeviceToDevice,
+                                                           scatter_stream->value()));
+                        }
+                        else
+                        {
+                            const uint8_t* output_ptr = nullptr;
+                            size_t output_ptr_size    = 0;
+                            CHECK_TRITON(model_results->RawData(model_output.name, &output_ptr, &output_ptr_size));
+
+                            DCHECK_NOTNULL(output_ptr);
+
+                            auto staged = stage_response(*m_pinned_pool, output_ptr, output_ptr_size);
+
+                            if (model_output.datatype.type_id() == TypeId::FLOAT16)
+                            {
+                                // Stage the packed halves on device and expand them into the FLOAT32 output slice
+                                ShapeType half_shape{stop - start, output_tensor.shape(1)};
+
+                                auto fp16_staging =
+                                    std::make_shared<rmm::device_buffer>(output_ptr_size, scatter_stream->view());
+
+                                MRC_CHECK_CUDA(cudaMemcpy(
+                                    fp16_staging->data(), staged->data(), output_ptr_size, cudaMemcpyHostToDevice));
+
+                                auto fp32_buffer = MatxUtil::cast_fp16_to_fp32(DevMemInfo{
+                                    fp16_staging, DType(TypeId::FLOAT16), half_shape, ShapeType{half_shape[1], 1}});
+
+                                DCHECK_EQ(output_tensor.bytes(), fp32_buffer->size());
+
+                                MRC_CHECK_CUDA(cudaMemcpy(output_tensor.data(),
+                                                          fp32_buffer->data(),
+                                                          fp32_buffer->size(),
+                                                          cudaMemcpyDeviceToDevice));
+                            }
+                            else
+                            {
+                                DCHECK_EQ(output_tensor.bytes(), output_ptr_size);
+
+                                MRC_CHECK_CUDA(cudaMemcpyAsync(output_tensor.data(),
+                                                               staged->data(),
+                                                               output_ptr_size,
+                                                               cudaMemcpyHostToDevice,
+                                                               scatter_stream->value()));
+
+                                // The upload is asynchronous; keep the pinned bytes alive until the stream syncs
+                                staged_responses.emplace_back(std::move(staged));
+                            }
+                        }
                     }
                 }
 
+                if (m_use_shared_memory)
+                {
+                    // The output region is reused by the next request, so its scatter must complete first. In the
+                    // non-shared-memory path the scatters keep running while the next batch is staged
+                    MRC_CHECK_CUDA(cudaStreamSynchronize(scatter_stream->value()));
+                }
+            };
+
+            for (TensorIndex start = 0; start < x->count; start += m_max_batch_size)
+            {
+                TensorIndex stop = std::min(start + m_max_batch_size, x->count);
+
+                sink_type_t mini_batch_input = x->get_slice(start, stop);
+
+                // Iterate on the model inputs in case the model takes less than what tensors are available
+                auto saved_inputs = std::make_shared<saved_inputs_t>(
+                    m_use_shared_memory
+                        ? foreach_map(m_model_inputs,
+                                      [&](auto const& model_input) {
+                                          return build_input_shm(mini_batch_input,
+                                                                 model_input,
+                                                                 get_shm_region("input", model_input.name),
+                                                                 stage_stream->view());
+                                      })
+                        : foreach_map(m_model_inputs, [&mini_batch_input](auto const& model_input) {
+                              return (build_input(mini_batch_input, model_input));
+                          }));
+
+                // Requested outputs per ensemble model; the staged inputs above are shared by every request
+                std::vector<std::shared_ptr<saved_outputs_t>> saved_outputs_by_model;
+                saved_outputs_by_model.reserve(m_outputs_by_model.size());
+
+                for (auto& model_outputs : m_outputs_by_model)
+                {
+                    saved_outputs_by_model.emplace_back(
+                        std::make_shared<saved_outputs_t>(foreach_map(model_outputs, [&](auto const& model_output) {
+                            // Generate the outputs to be requested.
+                            auto output = build_output(model_output);
+
+                            if (m_use_shared_memory)
+                            {
+                                auto output_tensor =
+                                    output_tensors[model_output.mapped_name].slice({start, 0}, {stop, -1});
+                                auto& region = get_shm_region("output", model_output.name);
+                                region.ensure_size(output_tensor.bytes());
+
+                                const_cast<triton::client::InferRequestedOutput*>(output.get())
+                                    ->SetSharedMemory(region.name(), output_tensor.bytes(), 0);
+                            }
+
+                            return output;
+                        })));
+                }
+
+                if (m_use_shared_memory)
+                {
+                    // The staging copies must have landed in the region before Triton reads from it
+                    MRC_CHECK_CUDA(cudaStreamSynchronize(stage_stream->value()));
+                }
+
+                PendingInfer pending_batch{
+                    start, stop, saved_inputs, saved_outputs_by_model, std::chrono::steady_clock::now(), {}, {}};
+
+                // Back-to-back submissions, so an ensemble's models all execute concurrently on the server
+                for (std::size_t i = 0; i < m_model_options.size(); ++i)
+                {
+                    pending_batch.results.emplace_back(
+                        submit(*client, m_model_options[i], saved_inputs, saved_outputs_by_model[i]));
+                }
+
+                pending.emplace_back(std::move(pending_batch));
+
+                // Bound the number of in-flight requests, completing the oldest batch in order
+                if (pending.size() >= max_in_flight)
+                {
+                    complete_oldest();
+                }
+            }
+
+            while (!pending.empty())
+            {
+                complete_oldest();
+            }
+
+            // Every response scatter must have landed before the tensors are handed downstream
+            MRC_CHECK_CUDA(cudaStreamSynchronize(scatter_stream->value()));
+
+            // Hand the staging buffers back to the pinned pool for the next message
+            staged_responses.clear();
+
+            if (x->mess_count != x->count)
+            {
+                reduce_outputs(x, output_buffers, output_tensors);
+            }
+
+            // If we need to do logits, do that here
+            if (m_needs_logits)
+            {
+                apply_logits(output_buffers, output_tensors);
+            }
+
+            // Final output of all mini-batches
+            auto response_mem = std::make_shared<ResponseMemory>(x->mess_count, std::move(output_tensors));
+            auto response     = std::make_shared<MultiResponseMessage>(
+                x->meta, x->mess_offset, x->mess_count, std::move(response_mem), 0, response_mem->count);
+
+            output.on_next(std::move(response));
+        };
+
+        // Combine buffered messages into one request, then scatter the response back out per message. Row counts
+        // are bounded by m_max_batch_size at the buffering site, so no mini-batching is needed here
+        auto process_coalesced = [this, &output, &client, scatter_stream](std::vector<sink_type_t> msgs) {
+            TensorIndex total_rows = 0;
+            for (auto const& msg : msgs)
+            {
+                total_rows += msg->count;
+            }
+
+            std::vector<buffer_map_t> output_buffers(msgs.size());
+            std::vector<TensorMap> output_tensors(msgs.size());
+
+            for (std::size_t i = 0; i < msgs.size(); ++i)
+            {
+                build_output_tensors(
+                    msgs[i]->count, m_model_outputs, *m_buffer_pool, output_buffers[i], output_tensors[i]);
+            }
+
+            std::vector<std::pair<std::shared_ptr<triton::client::InferInput>, std::shared_ptr<rmm::device_buffer>>>
+                saved_inputs = foreach_map(m_model_inputs, [&msgs, total_rows](auto const& model_input) {
+                    return build_coalesced_input(msgs, model_input, total_rows);
+                });
+
+            std::vector<std::shared_ptr<const triton::client::InferRequestedOutput>> saved_outputs = foreach_map(
+                m_model_outputs, [](auto const& model_output) { return build_output(model_output); });
+
+            std::vector<triton::client::InferInput*> inputs =
+                foreach_map(saved_inputs, [](auto x) { return x.first.get(); });
+
+            std::vector<const triton::client::InferRequestedOutput*> outputs =
+                foreach_map(saved_outputs, [](auto x) { return x.get(); });
+
+            triton::client::InferResult* results_ptr;
+            CHECK_TRITON(client->Infer(&results_ptr, m_options, inputs, outputs));
+            std::unique_ptr<triton::client::InferResult> results(results_ptr);
+
+            // Pinned staging buffers for the in-flight scatters, recycled after the sync below
+            std::vector<std::shared_ptr<rmm::device_buffer>> staged_responses;
+
+            for (auto& model_output : m_model_outputs)
+            {
+                const uint8_t* output_ptr = nullptr;
+                size_t output_ptr_size    = 0;
+                CHECK_TRITON(results->RawData(model_output.name, &output_ptr, &output_ptr_size));
+
+                auto staged = stage_response(*m_pinned_pool, output_ptr, output_ptr_size);
+
+                std::size_t offset = 0;
+                for (std::size_t i = 0; i < msgs.size(); ++i)
+                {
+                    auto& output_tensor = output_tensors[i][model_output.mapped_name];
+
+                    DCHECK_LE(offset + output_tensor.bytes(), output_ptr_size);
+                    DCHECK_NOTNULL(output_tensor.data());
+
+                    MRC_CHECK_CUDA(cudaMemcpyAsync(output_tensor.data(),
+                                                   static_cast<const uint8_t*>(staged->data()) + offset,
+                                                   output_tensor.bytes(),
+                                                   cudaMemcpyHostToDevice,
+                                                   scatter_stream->value()));
+
+                    offset += output_tensor.bytes();
+                }
+
+                staged_responses.emplace_back(std::move(staged));
+            }
+
+            // Every response scatter must have landed before the tensors are handed downstream
+            MRC_CHECK_CUDA(cudaStreamSynchronize(scatter_stream->value()));
+
+            for (std::size_t i = 0; i < msgs.size(); ++i)
+            {
+                auto& x = msgs[i];
+
                 if (x->mess_count != x->count)
                 {
-                    reduce_outputs(x, output_buffers, output_tensors);
+                    reduce_outputs(x, output_buffers[i], output_tensors[i]);
                 }
 
                 // If we need to do logits, do that here
                 if (m_needs_logits)
                 {
-                    apply_logits(output_buffers, output_tensors);
+                    apply_logits(output_buffers[i], output_tensors[i]);
                 }
 
-                // Final output of all mini-batches
-                auto response_mem = std::make_shared<ResponseMemory>(x->mess_count, std::move(output_tensors));
+                auto response_mem = std::make_shared<ResponseMemory>(x->mess_count, std::move(output_tensors[i]));
                 auto response     = std::make_shared<MultiResponseMessage>(
                     x->meta, x->mess_offset, x->mess_count, std::move(response_mem), 0, response_mem->count);
 
                 output.on_next(std::move(response));
+            }
+        };
+
+        // The coalesced fast path issues a single synchronous request, ensembles go through the direct path
+        // which fans a request out per model
+        bool is_ensemble = m_model_names.size() > 1;
+
+        // FP16 staging converts per message, so half-precision models take the direct path below
+        bool has_fp16 =
+            std::any_of(m_model_inputs.begin(),
+                        m_model_inputs.end(),
+                        [](const TritonInOut& in_out) { return in_out.datatype.type_id() == TypeId::FLOAT16; }) ||
+            std::any_of(m_model_outputs.begin(), m_model_outputs.end(), [](const TritonInOut& in_out) {
+                return in_out.datatype.type_id() == TypeId::FLOAT16;
+            });
+
+        // Consecutive messages smaller than the model's max batch size are buffered and sent as one request.
+        // Upstream slicing no longer dictates the inference batch size
+        auto pending_msgs = std::make_shared<std::vector<sink_type_t>>();
+        auto pending_rows = std::make_shared<TensorIndex>(0);
+
+        auto flush_pending = [process_message, process_coalesced, pending_msgs, pending_rows]() {
+            if (pending_msgs->empty())
+            {
+                return;
+            }
+
+            if (pending_msgs->size() == 1)
+            {
+                process_message(std::move(pending_msgs->front()));
+            }
+            else
+            {
+                process_coalesced(std::move(*pending_msgs));
+            }
+
+            pending_msgs->clear();
+            *pending_rows = 0;
+        };
+
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, process_message, flush_pending, pending_msgs, pending_rows, has_fp16, is_ensemble](sink_type_t x) {
+                // Shared-memory staging cannot batch across messages, and full batches gain nothing from buffering
+                if (m_use_shared_memory || has_fp16 || is_ensemble || x->count >= m_max_batch_size)
+                {
+                    flush_pending();
+                    process_message(std::move(x));
+                    return;
+                }
+
+                if (*pending_rows + x->count > m_max_batch_size)
+                {
+                    flush_pending();
+                }
+
+                *pending_rows += x->count;
+                pending_msgs->emplace_back(std::move(x));
+
+                if (*pending_rows >= m_max_batch_size)
+                {
+                    flush_pending();
+                }
             },
             [&](std::exception_ptr error_ptr) { output.on_error(error_ptr); },
-            [&]() { output.on_completed(); }));
+            [flush_pending, &output]() {
+                flush_pending();
+                output.on_completed();
+            }));
     };
 }
 
+/**
+ * @brief Query a Triton server for a model's metadata and config, building the unmapped model spec which is shared
+ * through the cache.
+ */
+static std::shared_ptr<const TritonModelSpec> resolve_model_spec(triton::client::InferenceServerHttpClient& client,
+                                                                 const std::string& model_name)
+{
+    auto model_spec = std::make_shared<TritonModelSpec>();
+
+    std::string model_metadata_json;
+    CHECK_TRITON(client.ModelMetadata(&model_metadata_json, model_name));
+
+    auto model_metadata = nlohmann::json::parse(model_metadata_json);
+
+    std::string model_config_json;
+    CHECK_TRITON(client.ModelConfig(&model_config_json, model_name));
+
+    auto model_config = nlohmann::json::parse(model_config_json);
+
+    if (model_config.contains("max_batch_size"))
+    {
+        model_spec->max_batch_size = model_config.at("max_batch_size").get<TensorIndex>();
+    }
+
+    for (auto const& input : model_metadata.at("inputs"))
+    {
+        auto shape = input.at("shape").get<ShapeType>();
+
+        auto dtype = DType::from_triton(input.at("datatype").get<std::string>());
+
+        size_t bytes = dtype.item_size();
+
+        for (auto& y : shape)
+        {
+            if (y == -1)
+            {
+                y = model_spec->max_batch_size;
+            }
+
+            bytes *= y;
+        }
+
+        model_spec->inputs.push_back(TritonInOut{input.at("name").get<std::string>(),
+                                                 bytes,
+                                                 DType::from_triton(input.at("datatype").get<std::string>()),
+                                                 shape,
+                                                 input.at("name").get<std::string>(),
+                                                 0});
+    }
+
+    for (auto const& output : model_metadata.at("outputs"))
+    {
+        auto shape = output.at("shape").get<ShapeType>();
+
+        auto dtype = DType::from_triton(output.at("datatype").get<std::string>());
+
+        size_t bytes = dtype.item_size();
+
+        for (auto& y : shape)
+        {
+            if (y == -1)
+            {
+                y = model_spec->max_batch_size;
+            }
+
+            bytes *= y;
+        }
+
+        model_spec->outputs.push_back(
+            TritonInOut{output.at("name").get<std::string>(), bytes, dtype, shape, output.at("name").get<std::string>(), 0});
+    }
+
+    return model_spec;
+}
+
+/**
+ * @brief Split a comma-separated list of replica server URLs, trimming surrounding whitespace.
+ */
+static std::vector<std::string> split_server_urls(const std::string& server_url)
+{
+    std::vector<std::string> urls;
+
+    std::istringstream stream(server_url);
+    std::string url;
+
+    while (std::getline(stream, url, ','))
+    {
+        auto begin = url.find_first_not_of(' ');
+        auto end   = url.find_last_not_of(' ');
+
+        if (begin != std::string::npos)
+        {
+            urls.push_back(url.substr(begin, end - begin + 1));
+        }
+    }
+
+    return urls;
+}
+
 void InferenceClientStage::connect_with_server()
 {
-    std::string server_url = m_server_url;
+    std::string server_url = m_server_urls.front();
 
     std::unique_ptr<triton::client::InferenceServerHttpClient> client;
 
@@ -405,7 +1249,7 @@ void InferenceClientStage::connect_with_server()
     }
 
     // Save this for new clients
-    m_server_url = server_url;
+    m_server_urls.front() = server_url;
 
     if (!is_server_live)
         throw std::runtime_error("Server is not live");
@@ -416,88 +1260,116 @@ void InferenceClientStage::connect_with_server()
     if (!is_server_ready)
         throw std::runtime_error("Server is not ready");
 
-    bool is_model_ready = false;
-    CHECK_TRITON(client->IsModelReady(&is_model_ready, this->m_model_name));
+    for (const auto& model_name : m_model_names)
+    {
+        bool is_model_ready = false;
+        CHECK_TRITON(client->IsModelReady(&is_model_ready, model_name));
 
-    if (!is_model_ready)
-        throw std::runtime_error("Model is not ready");
+        if (!is_model_ready)
+            throw std::runtime_error(MORPHEUS_CONCAT_STR("Model '" << model_name << "' is not ready"));
+    }
 
-    std::string model_metadata_json;
-    CHECK_TRITON(client->ModelMetadata(&model_metadata_json, this->m_model_name));
+    // Apply this stage's name mapping on top of the shared, unmapped spec
+    auto apply_mapping = [this](const TritonInOut& in_out) {
+        auto mapped = in_out;
 
-    auto model_metadata = nlohmann::json::parse(model_metadata_json);
+        auto found = m_inout_mapping.find(mapped.mapped_name);
+        if (found != m_inout_mapping.end())
+        {
+            mapped.mapped_name = found->second;
+        }
 
-    std::string model_config_json;
-    CHECK_TRITON(client->ModelConfig(&model_config_json, this->m_model_name));
+        return mapped;
+    };
 
-    auto model_config = nlohmann::json::parse(model_config_json);
+    const bool is_ensemble = m_model_names.size() > 1;
 
-    if (model_config.contains("max_batch_size"))
-    {
-        m_max_batch_size = model_config.at("max_batch_size").get<TensorIndex>();
-    }
+    m_max_batch_size = -1;
+    m_model_inputs.clear();
+    m_model_outputs.clear();
+    m_outputs_by_model.clear();
 
-    for (auto const& input : model_metadata.at("inputs"))
+    for (const auto& model_name : m_model_names)
     {
-        auto shape = input.at("shape").get<ShapeType>();
+        auto cache_key = MORPHEUS_CONCAT_STR(m_server_urls.front() << "/" << model_name);
 
-        auto dtype = DType::from_triton(input.at("datatype").get<std::string>());
-
-        size_t bytes = dtype.item_size();
+        std::shared_ptr<const TritonModelSpec> model_spec;
 
-        for (auto& y : shape)
         {
-            if (y == -1)
+            std::lock_guard<std::mutex> lock(model_spec_cache_mutex);
+
+            auto found = model_spec_cache.find(cache_key);
+            if (found != model_spec_cache.end())
             {
-                y = m_max_batch_size;
+                model_spec = found->second;
             }
-
-            bytes *= y;
         }
 
-        auto mapped_name = input.at("name").get<std::string>();
-
-        if (m_inout_mapping.find(mapped_name) != m_inout_mapping.end())
+        if (!model_spec)
         {
-            mapped_name = m_inout_mapping[mapped_name];
-        }
-
-        m_model_inputs.push_back(TritonInOut{input.at("name").get<std::string>(),
-                                             bytes,
-                                             DType::from_triton(input.at("datatype").get<std::string>()),
-                                             shape,
-                                             mapped_name,
-                                             0});
-    }
+            model_spec = resolve_model_spec(*client, model_name);
 
-    for (auto const& output : model_metadata.at("outputs"))
-    {
-        auto shape = output.at("shape").get<ShapeType>();
+            std::lock_guard<std::mutex> lock(model_spec_cache_mutex);
+            model_spec_cache[cache_key] = model_spec;
+        }
 
-        auto dtype = DType::from_triton(output.at("datatype").get<std::string>());
+        // The staged inputs are shared by every request, so the tightest batch bound applies to all
+        m_max_batch_size = m_max_batch_size < 0 ? model_spec->max_batch_size
+                                                : std::min(m_max_batch_size, model_spec->max_batch_size);
 
-        size_t bytes = dtype.item_size();
+        auto inputs = foreach_map(model_spec->inputs, apply_mapping);
 
-        for (auto& y : shape)
+        if (m_model_inputs.empty())
         {
-            if (y == -1)
+            m_model_inputs = std::move(inputs);
+        }
+        else
+        {
+            auto same_input = [](const TritonInOut& lhs, const TritonInOut& rhs) {
+                return lhs.name == rhs.name && lhs.datatype == rhs.datatype && lhs.shape == rhs.shape;
+            };
+
+            if (!std::equal(
+                    inputs.begin(), inputs.end(), m_model_inputs.begin(), m_model_inputs.end(), same_input))
             {
-                y = m_max_batch_size;
+                throw std::runtime_error(MORPHEUS_CONCAT_STR(
+                    "Ensemble model '" << model_name
+                                       << "' does not share the input signature of '" << m_model_names.front()
+                                       << "'. Inputs are staged once and reused by every model's request."));
             }
-
-            bytes *= y;
         }
 
-        auto mapped_name = output.at("name").get<std::string>();
+        auto outputs = foreach_map(model_spec->outputs, apply_mapping);
 
-        if (m_inout_mapping.find(mapped_name) != m_inout_mapping.end())
+        if (is_ensemble)
         {
-            mapped_name = m_inout_mapping[mapped_name];
+            // Distinct tensor names per model so the merged response memory carries every model's outputs
+            for (auto& output : outputs)
+            {
+                output.mapped_name = MORPHEUS_CONCAT_STR(model_name << "." << output.mapped_name);
+            }
         }
 
-        m_model_outputs.push_back(
-            TritonInOut{output.at("name").get<std::string>(), bytes, dtype, shape, mapped_name, 0});
+        m_model_outputs.insert(m_model_outputs.end(), outputs.begin(), outputs.end());
+        m_outputs_by_model.emplace_back(std::move(outputs));
     }
+
+    // Half precision is staged through dedicated conversion kernels that the shared-memory path bypasses
+    auto is_fp16 = [](const TritonInOut& in_out) {
+        return in_out.datatype.type_id() == TypeId::FLOAT16;
+    };
+
+    if (m_use_shared_memory && (std::any_of(m_model_inputs.begin(), m_model_inputs.end(), is_fp16) ||
+                                std::any_of(m_model_outputs.begin(), m_model_outputs.end(), is_fp16)))
+    {
+        throw std::runtime_error("use_shared_memory is not supported with FP16 models");
+    }
+}
+
+void InferenceClientStage::reset_model_cache()
+{
+    std::lock_guard<std::mutex> lock(model_spec_cache_mutex);
+    model_spec_cache.clear();
 }
 
 bool InferenceClientStage::is_default_grpc_port(std::string& server_url)
@@ -531,10 +1403,21 @@ std::shared_ptr<mrc::segment::Object<InferenceClientStage>> InferenceClientStage
     bool force_convert_inputs,
     bool use_shared_memory,
     bool needs_logits,
-    std::map<std::string, std::string> inout_mapping)
+    std::map<std::string, std::string> inout_mapping,
+    std::size_t max_in_flight,
+    double hedge_quantile,
+    TensorIndex warmup_rows)
 {
-    auto stage = builder.construct_object<InferenceClientStage>(
-        name, model_name, server_url, force_convert_inputs, use_shared_memory, needs_logits, inout_mapping);
+    auto stage = builder.construct_object<InferenceClientStage>(name,
+                                                                model_name,
+                                                                server_url,
+                                                                force_convert_inputs,
+                                                                use_shared_memory,
+                                                                needs_logits,
+                                                                inout_mapping,
+                                                                max_in_flight,
+                                                                hedge_quantile,
+                                                                warmup_rows);
 
     return stage;
 }
@@ -27,10 +27,29 @@
 #include "pymrc/node.hpp"
 
 #include "morpheus/io/serializers.hpp"
+#include "morpheus/utilities/edge_gauges.hpp"  // for EdgeGaugeRegistry, ScopedBlockedTimer
 #include "morpheus/utilities/string_util.hpp"
 
+#include <arrow/io/file.h>     // for FileOutputStream
+#include <arrow/ipc/writer.h>  // for MakeFileWriter, RecordBatchWriter
+#include <arrow/table.h>       // for Table
+#include <cudf/types.hpp>  // for size_type
+#include <fcntl.h>         // for open, fcntl, O_DIRECT
+#include <glog/logging.h>
+#include <unistd.h>  // for write, fdatasync, close
+#include <zstd.h>    // for ZSTD_compressCCtx, ZSTD_compressBound
+
+#include <algorithm>  // for min
+#include <cerrno>     // for errno, EINTR
+#include <chrono>     // for steady_clock
+#include <cstdio>     // for rename
+#include <cstdlib>    // for posix_memalign, free
+#include <cstring>    // for memcpy, strerror
 #include <exception>
+#include <filesystem>  // for path
+#include <iomanip>     // for setfill & setw
 #include <memory>
+#include <mutex>  // for lock_guard, unique_lock
 #include <sstream>
 #include <stdexcept>  // for invalid_argument, runtime_error
 #include <string>
@@ -39,19 +58,702 @@
 namespace morpheus {
 
 // Component public implementations
+// ************ RotatingFileSink **************************** //
+namespace {
+
+// O_DIRECT writes must be whole blocks from aligned memory, 4K covers every common logical block size
+constexpr std::size_t DirectAlignment   = 4096;
+constexpr std::size_t DirectBufferBytes = 1UL << 20;
+
+std::string part_filename(const std::string& base, std::size_t sequence)
+{
+    auto path = std::filesystem::path(base);
+
+    std::ostringstream name;
+    name << path.stem().string() << "-" << std::setfill('0') << std::setw(6) << sequence << path.extension().string();
+
+    return (path.parent_path() / name.str()).string();
+}
+
+}  // namespace
+
+RotatingFileSink::RotatingFileSink(std::string filename,
+                                   std::size_t max_bytes,
+                                   std::chrono::seconds max_age,
+                                   bool use_o_direct) :
+  m_filename(std::move(filename)),
+  m_max_bytes(max_bytes),
+  m_max_age(max_age),
+  m_use_o_direct(use_o_direct),
+  m_staging(nullptr, &std::free)
+{
+    if (m_use_o_direct)
+    {
+        void* buffer = nullptr;
+
+        if (posix_memalign(&buffer, DirectAlignment, DirectBufferBytes) != 0)
+        {
+            throw std::runtime_error("Failed to allocate the aligned O_DIRECT staging buffer");
+        }
+
+        m_staging.reset(static_cast<char*>(buffer));
+    }
+
+    this->open_part();
+}
+
+RotatingFileSink::~RotatingFileSink()
+{
+    try
+    {
+        this->close();
+    } catch (const std::exception& e)
+    {
+        LOG(ERROR) << "Error closing RotatingFileSink: " << e.what();
+    }
+}
+
+bool RotatingFileSink::should_rotate() const
+{
+    if (m_max_bytes > 0 && m_part_bytes >= m_max_bytes)
+    {
+        return true;
+    }
+
+    return m_max_age.count() > 0 && std::chrono::steady_clock::now() - m_part_start >= m_max_age;
+}
+
+void RotatingFileSink::rotate()
+{
+    this->finish_part();
+    this->open_part();
+}
+
+void RotatingFileSink::close()
+{
+    if (m_fd >= 0)
+    {
+        this->finish_part();
+    }
+}
+
+RotatingFileSink::int_type RotatingFileSink::overflow(int_type ch)
+{
+    if (ch != traits_type::eof())
+    {
+        const char value = traits_type::to_char_type(ch);
+        this->write_bytes(&value, 1);
+    }
+
+    return ch;
+}
+
+std::streamsize RotatingFileSink::xsputn(const char* data, std::streamsize count)
+{
+    this->write_bytes(data, static_cast<std::size_t>(count));
+
+    return count;
+}
+
+int RotatingFileSink::sync()
+{
+    // The staged O_DIRECT tail only reaches the disk when the part is finished, fdatasync covers everything else
+    if (m_fd >= 0 && ::fdatasync(m_fd) != 0)
+    {
+        throw std::runtime_error(
+            MORPHEUS_CONCAT_STR("Error syncing '" << m_filename << "': " << std::strerror(errno)));
+    }
+
+    return 0;
+}
+
+void RotatingFileSink::open_part()
+{
+    int flags = O_WRONLY | O_CREAT | O_TRUNC;
+
+    if (m_use_o_direct)
+    {
+        flags |= O_DIRECT;
+    }
+
+    const auto in_progress = m_filename + ".part";
+
+    m_fd = ::open(in_progress.c_str(), flags, 0644);
+
+    if (m_fd < 0)
+    {
+        throw std::runtime_error(
+            MORPHEUS_CONCAT_STR("Unable to open '" << in_progress << "': " << std::strerror(errno)));
+    }
+
+    m_part_bytes = 0;
+    m_staged     = 0;
+    m_part_start = std::chrono::steady_clock::now();
+}
+
+void RotatingFileSink::finish_part()
+{
+    if (m_use_o_direct && m_staged > 0)
+    {
+        // Drop O_DIRECT to write the final unaligned tail of the part
+        const int flags = ::fcntl(m_fd, F_GETFL);
+
+        if (flags < 0 || ::fcntl(m_fd, F_SETFL, flags & ~O_DIRECT) != 0)
+        {
+            throw std::runtime_error(
+                MORPHEUS_CONCAT_STR("Unable to clear O_DIRECT on '" << m_filename << "': " << std::strerror(errno)));
+        }
+
+        this->write_fd(m_staging.get(), m_staged);
+        m_staged = 0;
+    }
+
+    // Make the part durable before it is renamed into place, a consumer must never see a part lose data
+    if (::fdatasync(m_fd) != 0)
+    {
+        throw std::runtime_error(
+            MORPHEUS_CONCAT_STR("Error syncing '" << m_filename << "': " << std::strerror(errno)));
+    }
+
+    if (!m_use_o_direct)
+    {
+        // The finished part will not be touched again here, keep its pages from evicting hotter data
+        ::posix_fadvise(m_fd, 0, 0, POSIX_FADV_DONTNEED);
+    }
+
+    ::close(m_fd);
+    m_fd = -1;
+
+    const auto final_name = part_filename(m_filename, m_next_sequence++);
+
+    if (::rename((m_filename + ".part").c_str(), final_name.c_str()) != 0)
+    {
+        throw std::runtime_error(
+            MORPHEUS_CONCAT_STR("Unable to rename part to '" << final_name << "': " << std::strerror(errno)));
+    }
+}
+
+void RotatingFileSink::write_bytes(const char* data, std::size_t size)
+{
+    m_part_bytes += size;
+
+    if (!m_use_o_direct)
+    {
+        this->write_fd(data, size);
+        return;
+    }
+
+    while (size > 0)
+    {
+        const auto chunk = std::min(size, DirectBufferBytes - m_staged);
+        std::memcpy(m_staging.get() + m_staged, data, chunk);
+        m_staged += chunk;
+        data += chunk;
+        size -= chunk;
+
+        if (m_staged == DirectBufferBytes)
+        {
+            this->write_fd(m_staging.get(), DirectBufferBytes);
+            m_staged = 0;
+        }
+    }
+}
+
+void RotatingFileSink::write_fd(const char* data, std::size_t size)
+{
+    while (size > 0)
+    {
+        const auto written = ::write(m_fd, data, size);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            throw std::runtime_error(
+                MORPHEUS_CONCAT_STR("Error writing to '" << m_filename << "': " << std::strerror(errno)));
+        }
+
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+// ************ AsyncWriteStreambuf ************************* //
+AsyncWriteStreambuf::AsyncWriteStreambuf(std::ostream& sink, std::size_t buffer_size, std::size_t max_pending) :
+  m_sink(sink),
+  m_buffer_size(buffer_size),
+  m_max_pending(max_pending),
+  m_gauge(EdgeGaugeRegistry::instance().get_or_create("WriteToFileStage.write_queue"))
+{
+    CHECK_GT(m_buffer_size, 0);
+    CHECK_GT(m_max_pending, 0);
+
+    m_current.resize(m_buffer_size);
+    this->setp(m_current.data(), m_current.data() + m_buffer_size);
+
+    m_writer = std::thread([this]() {
+        this->worker_loop();
+    });
+}
+
+AsyncWriteStreambuf::~AsyncWriteStreambuf()
+{
+    try
+    {
+        this->close();
+    } catch (const std::exception& e)
+    {
+        LOG(ERROR) << "Error closing AsyncWriteStreambuf: " << e.what();
+    }
+}
+
+void AsyncWriteStreambuf::close()
+{
+    if (!m_writer.joinable())
+    {
+        return;
+    }
+
+    std::exception_ptr sync_error;
+
+    try
+    {
+        this->sync();
+    } catch (...)
+    {
+        sync_error = std::current_exception();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_closed = true;
+        m_work_ready.notify_all();
+    }
+
+    m_writer.join();
+
+    if (sync_error)
+    {
+        std::rethrow_exception(sync_error);
+    }
+
+    if (m_error)
+    {
+        std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+}
+
+AsyncWriteStreambuf::int_type AsyncWriteStreambuf::overflow(int_type ch)
+{
+    this->enqueue_current();
+
+    if (ch != traits_type::eof())
+    {
+        *this->pptr() = traits_type::to_char_type(ch);
+        this->pbump(1);
+    }
+
+    return ch;
+}
+
+std::streamsize AsyncWriteStreambuf::xsputn(const char* data, std::streamsize count)
+{
+    std::streamsize written = 0;
+
+    while (written < count)
+    {
+        if (this->pptr() == this->epptr())
+        {
+            this->enqueue_current();
+        }
+
+        const auto chunk = std::min<std::streamsize>(count - written, this->epptr() - this->pptr());
+        std::memcpy(this->pptr(), data + written, chunk);
+        this->pbump(static_cast<int>(chunk));
+        written += chunk;
+    }
+
+    return written;
+}
+
+int AsyncWriteStreambuf::sync()
+{
+    this->enqueue_current();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_work_done.wait(lock, [this]() {
+        return (m_pending.empty() && !m_writing) || m_error;
+    });
+
+    if (m_error)
+    {
+        std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+
+    m_sink.flush();
+
+    return 0;
+}
+
+void AsyncWriteStreambuf::enqueue_current()
+{
+    const auto used = static_cast<std::size_t>(this->pptr() - this->pbase());
+
+    if (used == 0)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    {
+        // Backpressure: block until the writer thread has drained below the bound. Time spent here is the
+        // upstream stalling on the disk, surface it on the gauge
+        ScopedBlockedTimer blocked(m_gauge);
+        m_work_done.wait(lock, [this]() {
+            return m_pending.size() < m_max_pending || m_error;
+        });
+    }
+
+    if (m_error)
+    {
+        std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+
+    m_pending.push_back(Buffer{std::move(m_current), used});
+    m_gauge.enqueue();
+
+    if (!m_free_buffers.empty())
+    {
+        m_current = std::move(m_free_buffers.back());
+        m_free_buffers.pop_back();
+    }
+    else
+    {
+        m_current = std::string();
+        m_current.resize(m_buffer_size);
+    }
+
+    this->setp(m_current.data(), m_current.data() + m_buffer_size);
+
+    m_work_ready.notify_one();
+}
+
+void AsyncWriteStreambuf::worker_loop()
+{
+    for (;;)
+    {
+        Buffer buffer;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_work_ready.wait(lock, [this]() {
+                return !m_pending.empty() || m_closed;
+            });
+
+            if (m_pending.empty())
+            {
+                return;
+            }
+
+            buffer = std::move(m_pending.front());
+            m_pending.pop_front();
+            m_gauge.dequeue();
+            m_writing = true;
+        }
+
+        try
+        {
+            m_sink.write(buffer.data.data(), static_cast<std::streamsize>(buffer.size));
+        } catch (...)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (!m_error)
+            {
+                m_error = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_writing = false;
+            m_free_buffers.push_back(std::move(buffer.data));
+            m_work_done.notify_all();
+        }
+    }
+}
+
+// ************ ZstdCompressStreambuf *********************** //
+ZstdCompressStreambuf::ZstdCompressStreambuf(
+    std::ostream& sink, int level, std::size_t num_threads, std::size_t buffer_size, std::size_t max_pending) :
+  m_sink(sink),
+  m_level(level),
+  m_buffer_size(buffer_size),
+  m_max_pending(max_pending),
+  m_gauge(EdgeGaugeRegistry::instance().get_or_create("WriteToFileStage.zstd_queue"))
+{
+    CHECK_GT(num_threads, 0);
+    CHECK_GT(m_buffer_size, 0);
+    CHECK_GT(m_max_pending, 0);
+
+    m_current.resize(m_buffer_size);
+    this->setp(m_current.data(), m_current.data() + m_buffer_size);
+
+    m_workers.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i)
+    {
+        m_workers.emplace_back([this]() {
+            this->worker_loop();
+        });
+    }
+}
+
+ZstdCompressStreambuf::~ZstdCompressStreambuf()
+{
+    try
+    {
+        this->close();
+    } catch (const std::exception& e)
+    {
+        LOG(ERROR) << "Error closing ZstdCompressStreambuf: " << e.what();
+    }
+}
+
+void ZstdCompressStreambuf::close()
+{
+    if (m_workers.empty())
+    {
+        return;
+    }
+
+    std::exception_ptr sync_error;
+
+    try
+    {
+        this->sync();
+    } catch (...)
+    {
+        sync_error = std::current_exception();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_closed = true;
+        m_work_ready.notify_all();
+    }
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+
+    m_workers.clear();
+
+    if (sync_error)
+    {
+        std::rethrow_exception(sync_error);
+    }
+
+    if (m_error)
+    {
+        std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+}
+
+ZstdCompressStreambuf::int_type ZstdCompressStreambuf::overflow(int_type ch)
+{
+    this->enqueue_current();
+
+    if (ch != traits_type::eof())
+    {
+        *this->pptr() = traits_type::to_char_type(ch);
+        this->pbump(1);
+    }
+
+    return ch;
+}
+
+std::streamsize ZstdCompressStreambuf::xsputn(const char* data, std::streamsize count)
+{
+    std::streamsize written = 0;
+
+    while (written < count)
+    {
+        if (this->pptr() == this->epptr())
+        {
+            this->enqueue_current();
+        }
+
+        const auto chunk = std::min<std::streamsize>(count - written, this->epptr() - this->pptr());
+        std::memcpy(this->pptr(), data + written, chunk);
+        this->pbump(static_cast<int>(chunk));
+        written += chunk;
+    }
+
+    return written;
+}
+
+int ZstdCompressStreambuf::sync()
+{
+    this->enqueue_current();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_work_done.wait(lock, [this]() {
+        return m_next_write == m_next_sequence || m_error;
+    });
+
+    if (m_error)
+    {
+        std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+
+    m_sink.flush();
+
+    return 0;
+}
+
+void ZstdCompressStreambuf::enqueue_current()
+{
+    const auto used = static_cast<std::size_t>(this->pptr() - this->pbase());
+
+    if (used == 0)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    {
+        // Backpressure: block until the workers have drained below the bound. Time spent here is the upstream
+        // stalling on compression throughput, surface it on the gauge
+        ScopedBlockedTimer blocked(m_gauge);
+        m_work_done.wait(lock, [this]() {
+            return m_pending.size() < m_max_pending || m_error;
+        });
+    }
+
+    if (m_error)
+    {
+        std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+
+    m_pending.push_back(Job{std::move(m_current), used, m_next_sequence++});
+    m_gauge.enqueue();
+
+    if (!m_free_buffers.empty())
+    {
+        m_current = std::move(m_free_buffers.back());
+        m_free_buffers.pop_back();
+    }
+    else
+    {
+        m_current = std::string();
+        m_current.resize(m_buffer_size);
+    }
+
+    this->setp(m_current.data(), m_current.data() + m_buffer_size);
+
+    m_work_ready.notify_one();
+}
+
+void ZstdCompressStreambuf::worker_loop()
+{
+    // One compression context per worker, its internal tables are reused across frames
+    const std::unique_ptr<ZSTD_CCtx, std::size_t (*)(ZSTD_CCtx*)> cctx(ZSTD_createCCtx(), &ZSTD_freeCCtx);
+
+    std::string frame;
+
+    for (;;)
+    {
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_work_ready.wait(lock, [this]() {
+                return !m_pending.empty() || m_closed;
+            });
+
+            if (m_pending.empty())
+            {
+                return;
+            }
+
+            job = std::move(m_pending.front());
+            m_pending.pop_front();
+            m_gauge.dequeue();
+        }
+
+        frame.resize(ZSTD_compressBound(job.size));
+        const auto frame_size =
+            ZSTD_compressCCtx(cctx.get(), frame.data(), frame.size(), job.data.data(), job.size, m_level);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // Frames must land in fill order for the concatenation to decompress as one stream, wait our turn
+        m_work_done.wait(lock, [this, &job]() {
+            return m_next_write == job.sequence;
+        });
+
+        if (!m_error)
+        {
+            try
+            {
+                if (ZSTD_isError(frame_size) != 0)
+                {
+                    throw std::runtime_error(std::string("zstd compression failed: ") +
+                                             ZSTD_getErrorName(frame_size));
+                }
+
+                m_sink.write(frame.data(), static_cast<std::streamsize>(frame_size));
+            } catch (...)
+            {
+                m_error = std::current_exception();
+            }
+        }
+
+        // Advance even on error, a stuck sequence would deadlock the other workers
+        ++m_next_write;
+        m_free_buffers.push_back(std::move(job.data));
+        m_work_done.notify_all();
+    }
+}
+
 // ************ WriteToFileStage **************************** //
-WriteToFileStage::WriteToFileStage(
-    const std::string& filename, std::ios::openmode mode, FileTypes file_type, bool include_index_col, bool flush) :
+WriteToFileStage::WriteToFileStage(const std::string& filename,
+                                   std::ios::openmode mode,
+                                   FileTypes file_type,
+                                   bool include_index_col,
+                                   bool flush,
+                                   std::size_t max_file_size,
+                                   std::chrono::seconds rotate_period,
+                                   bool use_o_direct) :
   PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
   m_is_first(true),
   m_include_index_col(include_index_col),
-  m_flush(flush)
+  m_flush(flush),
+  m_filename(filename)
 {
     if (file_type == FileTypes::Auto)
     {
         file_type = determine_file_type(filename);
     }
 
+    const bool rotating = max_file_size > 0 || rotate_period.count() > 0 || use_o_direct;
+
+    // A '.zst' filename requests inline compression, the content format comes from the inner extension
+    const bool compress = std::filesystem::path(filename).extension() == ".zst";
+
     switch (file_type)
     {
     case FileTypes::JSON: {
@@ -66,38 +768,168 @@ WriteToFileStage::WriteToFileStage(
         m_write_func = [this](auto&& PH1) { write_parquet(std::forward<decltype(PH1)>(PH1)); };
         break;
     }
+    case FileTypes::ARROW: {
+        // The file-format footer is written on close, an existing file cannot be appended to
+        if ((mode & std::ios::app) != 0)
+        {
+            throw std::invalid_argument("Append mode ('a') is not supported for Arrow IPC files");
+        }
+
+        if (rotating)
+        {
+            throw std::invalid_argument("File rotation is not supported for Arrow IPC output");
+        }
+
+        if (compress)
+        {
+            throw std::invalid_argument("zstd compression is not supported for Arrow IPC output");
+        }
+
+        m_write_func = [this](auto&& PH1) { write_arrow(std::forward<decltype(PH1)>(PH1)); };
+
+        // The Arrow writer opens the file itself once the first message fixes the schema
+        return;
+    }
     case FileTypes::Auto:
     default:
         throw std::runtime_error(
             MORPHEUS_CONCAT_STR("Unknown extension for file: '" << filename << "'. File type: " << file_type));
     }
 
-    // Enable throwing exceptions in case something fails.
-    m_fstream.exceptions(std::fstream::failbit | std::fstream::badbit);
+    if (rotating)
+    {
+        // Rotation renames each finished part into place, appending to a prior run has no meaning here
+        if ((mode & std::ios::app) != 0)
+        {
+            throw std::invalid_argument("Append mode ('a') is not supported with file rotation");
+        }
 
-    m_fstream.open(filename, mode);
+        m_rotating_sink   = std::make_unique<RotatingFileSink>(filename, max_file_size, rotate_period, use_o_direct);
+        m_rotating_stream = std::make_unique<std::ostream>(m_rotating_sink.get());
+
+        // Rethrow the sink's errors instead of latching them into badbit
+        m_rotating_stream->exceptions(std::ostream::failbit | std::ostream::badbit);
+    }
+    else
+    {
+        // Enable throwing exceptions in case something fails.
+        m_fstream.exceptions(std::fstream::failbit | std::fstream::badbit);
+
+        m_fstream.open(filename, mode);
+    }
+
+    if (compress)
+    {
+        // The compression workers both compress and write, stacking the async writer underneath would only add a
+        // copy. Appending concatenated zstd frames to an existing .zst file stays decompressable, so 'a' mode works
+        m_zstd_buf    = std::make_unique<ZstdCompressStreambuf>(rotating ? *m_rotating_stream : m_fstream);
+        m_zstd_stream = std::make_unique<std::ostream>(m_zstd_buf.get());
+        m_out_stream  = m_zstd_stream.get();
+    }
+    else
+    {
+        // Serialization fills one buffer while the background thread writes the previous one, a disk hiccup is
+        // absorbed by the bounded queue instead of stalling the message handler
+        m_async_buf    = std::make_unique<AsyncWriteStreambuf>(rotating ? *m_rotating_stream : m_fstream);
+        m_async_stream = std::make_unique<std::ostream>(m_async_buf.get());
+        m_out_stream   = m_async_stream.get();
+    }
 }
 
 void WriteToFileStage::write_json(WriteToFileStage::sink_type_t& msg)
 {
-    // Call df_to_json passing our fstream
-    df_to_json(msg->get_info(), m_fstream, m_include_index_col, m_flush);
+    // Large enough to amortize the per-chunk writer setup, small enough to bound the transient host string
+    constexpr cudf::size_type JsonRowsPerChunk{65536};
+
+    // Stream fixed-size row chunks through the reused buffer instead of materializing the whole batch as one string
+    df_to_json_chunked(msg->get_info(), *m_out_stream, JsonRowsPerChunk, m_json_buffer, m_include_index_col, m_flush);
 }
 
 void WriteToFileStage::write_csv(WriteToFileStage::sink_type_t& msg)
 {
-    // Call df_to_csv passing our fstream
-    df_to_csv(msg->get_info(), m_fstream, m_is_first, m_include_index_col, m_flush);
+    // Call df_to_csv passing our double-buffered stream
+    df_to_csv(msg->get_info(), *m_out_stream, m_is_first, m_include_index_col, m_flush);
 }
 
 void WriteToFileStage::write_parquet(WriteToFileStage::sink_type_t& msg)
 {
-    // Call df_to_csv passing our fstream
-    df_to_parquet(msg->get_info(), m_fstream, m_is_first, m_include_index_col, m_flush);
+    // Call df_to_csv passing our double-buffered stream
+    df_to_parquet(msg->get_info(), *m_out_stream, m_is_first, m_include_index_col, m_flush);
+}
+
+void WriteToFileStage::write_arrow(WriteToFileStage::sink_type_t& msg)
+{
+    auto arrow_table = df_to_arrow(msg->get_info(), m_include_index_col);
+
+    if (!m_arrow_writer)
+    {
+        auto sink = arrow::io::FileOutputStream::Open(m_filename);
+
+        if (!sink.ok())
+        {
+            throw std::runtime_error("Failed to open Arrow IPC file '" + m_filename + "': " + sink.status().ToString());
+        }
+
+        m_arrow_sink = sink.ValueUnsafe();
+
+        auto writer = arrow::ipc::MakeFileWriter(m_arrow_sink, arrow_table->schema());
+
+        if (!writer.ok())
+        {
+            throw std::runtime_error("Failed to create Arrow IPC writer: " + writer.status().ToString());
+        }
+
+        m_arrow_writer = writer.ValueUnsafe();
+    }
+
+    auto status = m_arrow_writer->WriteTable(*arrow_table);
+
+    if (!status.ok())
+    {
+        throw std::runtime_error("Failed to write Arrow IPC batch: " + status.ToString());
+    }
 }
 
 void WriteToFileStage::close()
 {
+    if (m_arrow_writer)
+    {
+        // Finishing the writer emits the IPC footer which readers need to memory-map the file
+        auto status = m_arrow_writer->Close();
+
+        m_arrow_writer.reset();
+        m_arrow_sink.reset();
+
+        if (!status.ok())
+        {
+            throw std::runtime_error("Failed to finish Arrow IPC file: " + status.ToString());
+        }
+    }
+
+    if (m_async_buf)
+    {
+        // Drain the writer thread before the file closes underneath it
+        m_async_buf->close();
+        m_async_stream.reset();
+        m_async_buf.reset();
+    }
+
+    if (m_zstd_buf)
+    {
+        // Compress and write everything still queued before the file closes underneath the workers
+        m_zstd_buf->close();
+        m_zstd_stream.reset();
+        m_zstd_buf.reset();
+    }
+
+    if (m_rotating_sink)
+    {
+        // Finish the last part and rename it into place
+        m_rotating_sink->close();
+        m_rotating_stream.reset();
+        m_rotating_sink.reset();
+    }
+
     if (m_fstream.is_open())
     {
         m_fstream.close();
@@ -111,6 +943,18 @@ WriteToFileStage::subscribe_fn_t WriteToFileStage::build_operator()
             [this, &output](sink_type_t msg) {
                 this->m_write_func(msg);
                 m_is_first = false;
+
+                if (m_rotating_sink && m_rotating_sink->should_rotate())
+                {
+                    // Drain the async writer (or compression pool) so the finished part holds every byte written to
+                    // it before the rename. Rolling over between messages keeps each part a whole number of records
+                    m_out_stream->flush();
+                    m_rotating_sink->rotate();
+
+                    // Re-emit the CSV header at the top of the new part
+                    m_is_first = true;
+                }
+
                 output.on_next(std::move(msg));
             },
             [&](std::exception_ptr error_ptr) {
@@ -132,7 +976,10 @@ std::shared_ptr<mrc::segment::Object<WriteToFileStage>> WriteToFileStageInterfac
     const std::string& mode,
     FileTypes file_type,
     bool include_index_col,
-    bool flush)
+    bool flush,
+    std::size_t max_file_size,
+    int rotate_period_s,
+    bool use_o_direct)
 {
     std::ios::openmode fsmode = std::ios::out;
 
@@ -168,8 +1015,15 @@ std::shared_ptr<mrc::segment::Object<WriteToFileStage>> WriteToFileStageInterfac
         throw std::runtime_error(std::string("Unsupported file mode. Must choose either 'w' or 'a'. Mode: ") + mode);
     }
 
-    auto stage =
-        builder.construct_object<WriteToFileStage>(name, filename, fsmode, file_type, include_index_col, flush);
+    auto stage = builder.construct_object<WriteToFileStage>(name,
+                                                            filename,
+                                                            fsmode,
+                                                            file_type,
+                                                            include_index_col,
+                                                            flush,
+                                                            max_file_size,
+                                                            std::chrono::seconds(rotate_period_s),
+                                                            use_o_direct);
 
     return stage;
 }
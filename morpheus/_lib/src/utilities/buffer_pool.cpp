@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/buffer_pool.hpp"
+
+#include "morpheus/utilities/pinned_memory.hpp"  // for PinnedMemory
+
+#include <rmm/mr/device/per_device_resource.hpp>  // for get_current_device_resource
+
+#include <mutex>
+#include <utility>
+
+namespace morpheus {
+
+/****** Component public implementations *******************/
+/****** BufferPool*****************************************/
+BufferPool::BufferPool(std::size_t max_buffers_per_size, cuda::mr::async_resource_ref<cuda::mr::device_accessible> mr) :
+  m_max_buffers_per_size(max_buffers_per_size),
+  m_mr(mr)
+{}
+
+std::shared_ptr<BufferPool> BufferPool::create(std::size_t max_buffers_per_size)
+{
+    return std::shared_ptr<BufferPool>(new BufferPool(max_buffers_per_size, rmm::mr::get_current_device_resource()));
+}
+
+std::shared_ptr<BufferPool> BufferPool::create_pinned(std::size_t max_buffers_per_size)
+{
+    return std::shared_ptr<BufferPool>(new BufferPool(max_buffers_per_size, PinnedMemory::resource()));
+}
+
+std::shared_ptr<rmm::device_buffer> BufferPool::acquire(std::size_t size_bytes, rmm::cuda_stream_view stream)
+{
+    std::unique_ptr<rmm::device_buffer> buffer;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto found = m_free_buffers.find(size_bytes);
+        if (found != m_free_buffers.end() && !found->second.empty())
+        {
+            buffer = std::move(found->second.back());
+            found->second.pop_back();
+        }
+    }
+
+    if (buffer)
+    {
+        // Hand the recycled buffer out on the caller's stream. Contents are stale, callers overwrite them anyway
+        buffer->set_stream(stream);
+    }
+    else
+    {
+        buffer = std::make_unique<rmm::device_buffer>(size_bytes, stream, m_mr);
+    }
+
+    // Return the buffer here when the last reference drops. Only a weak reference to the pool is captured so a
+    // buffer outliving its stage simply frees through RMM
+    std::weak_ptr<BufferPool> weak_self = this->shared_from_this();
+
+    return {buffer.release(), [weak_self](rmm::device_buffer* raw_buffer) {
+                std::unique_ptr<rmm::device_buffer> owned(raw_buffer);
+
+                if (auto self = weak_self.lock())
+                {
+                    self->release(std::move(owned));
+                }
+            }};
+}
+
+std::size_t BufferPool::pooled_bytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::size_t total = 0;
+    for (const auto& [size, bucket] : m_free_buffers)
+    {
+        total += size * bucket.size();
+    }
+
+    return total;
+}
+
+void BufferPool::release(std::unique_ptr<rmm::device_buffer> buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& bucket = m_free_buffers[buffer->size()];
+
+    if (bucket.size() < m_max_buffers_per_size)
+    {
+        bucket.push_back(std::move(buffer));
+    }
+
+    // Otherwise drop it, the unique_ptr frees the excess buffer through RMM
+}
+}  // namespace morpheus
@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/cuda_graph.hpp"
+
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
+
+namespace morpheus {
+
+/****** Component public implementations *******************/
+/****** CudaGraphCache*************************************/
+CudaGraphCache::CudaGraphCache(std::size_t max_graphs) : m_max_graphs(max_graphs) {}
+
+CudaGraphCache::~CudaGraphCache()
+{
+    for (auto& [key, exec] : m_graphs)
+    {
+        if (exec != nullptr)
+        {
+            cudaGraphExecDestroy(exec);
+        }
+    }
+}
+
+void CudaGraphCache::launch(const std::string& key, rmm::cuda_stream_view stream, const std::function<void()>& work)
+{
+    auto found = m_graphs.find(key);
+
+    if (found == m_graphs.end())
+    {
+        // First sighting: run uncaptured as a warm-up so one-time lazy initialization inside the kernels happens
+        // outside capture. Keys beyond the cache bound keep running uncaptured rather than churning graphs
+        if (m_graphs.size() < m_max_graphs)
+        {
+            m_graphs.emplace(key, nullptr);
+        }
+
+        work();
+        return;
+    }
+
+    if (found->second == nullptr)
+    {
+        // Warmed up, capture this run. Thread-local mode leaves the streams of other fibers untouched. The work is
+        // only recorded here, the launch below executes it
+        cudaGraph_t graph = nullptr;
+
+        MRC_CHECK_CUDA(cudaStreamBeginCapture(stream.value(), cudaStreamCaptureModeThreadLocal));
+
+        try
+        {
+            work();
+        } catch (...)
+        {
+            // Abandon the capture and let the batch fail, the key stays warmed so a later batch retries
+            cudaStreamEndCapture(stream.value(), &graph);
+            if (graph != nullptr)
+            {
+                cudaGraphDestroy(graph);
+            }
+            throw;
+        }
+
+        MRC_CHECK_CUDA(cudaStreamEndCapture(stream.value(), &graph));
+
+        cudaGraphExec_t exec = nullptr;
+        MRC_CHECK_CUDA(cudaGraphInstantiate(&exec, graph, 0));
+        MRC_CHECK_CUDA(cudaGraphDestroy(graph));
+
+        found->second = exec;
+    }
+
+    MRC_CHECK_CUDA(cudaGraphLaunch(found->second, stream.value()));
+}
+
+}  // namespace morpheus
@@ -25,10 +25,14 @@
 #include <pybind11/gil.h>
 #include <pybind11/pybind11.h>
 
-#include <cstdlib>  // for getenv
+#include <cstddef>     // for size_t
+#include <cstdlib>     // for getenv
+#include <functional>  // for reference_wrapper
 #include <memory>
+#include <atomic>   // for atomic
 #include <ostream>  // Needed for logging
 #include <utility>  // for move
+#include <vector>   // for vector
 /*
  * **************This needs to come last.********************
  * A note to posterity: We only ever want to have a single place where cudf_helpers_api.h is included in any
@@ -41,16 +45,39 @@ namespace morpheus {
 void CudfHelper::load()
 {
     // Avoid loading cudf_helpers if we are in a sphinx build
-    if (std::getenv("MORPHEUS_IN_SPHINX_BUILD") == nullptr)
+    if (std::getenv("MORPHEUS_IN_SPHINX_BUILD") != nullptr)
     {
-        if (import_morpheus___lib__cudf_helpers() != 0)
-        {
-            pybind11::error_already_set ex;
+        return;
+    }
+
+    // Importing the helpers pulls in cudf itself, which costs seconds of cold start. The conversion entry points
+    // below load on first use, so short-lived processes that never touch a DataFrame skip the import entirely.
+    static std::atomic<bool> loaded{false};
 
-            LOG(ERROR) << "Could not load cudf_helpers library: " << ex.what();
-            throw ex;
-        }
+    if (loaded.load(std::memory_order_acquire))
+    {
+        return;
     }
+
+    // The GIL itself serializes first-use loaders. Taking it inside a once-block instead would deadlock: a thread
+    // inside the block waiting for the GIL against a GIL holder waiting on the once-flag. Losing the race here is
+    // harmless, python caches the module so a duplicate import is a no-op.
+    pybind11::gil_scoped_acquire gil;
+
+    if (loaded.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    if (import_morpheus___lib__cudf_helpers() != 0)
+    {
+        pybind11::error_already_set ex;
+
+        LOG(ERROR) << "Could not load cudf_helpers library: " << ex.what();
+        throw ex;
+    }
+
+    loaded.store(true, std::memory_order_release);
 }
 
 pybind11::object proxy_table_from_table_with_metadata(cudf::io::table_with_metadata&& table, int index_col_count)
@@ -66,25 +93,61 @@ morpheus::TableInfoData proxy_table_info_data_from_table(pybind11::object table)
 
 pybind11::object CudfHelper::table_from_table_with_metadata(cudf::io::table_with_metadata&& table, int index_col_count)
 {
+    load();
+
     return proxy_table_from_table_with_metadata(std::move(table), index_col_count);
 }
 
 pybind11::object CudfHelper::table_from_table_info(const TableInfoBase& table_info)
 {
+    load();
+
     // Get the table info data from the table_into
     auto table_info_data = table_info.get_data();
 
-    auto py_object_parent = table_info.get_parent()->get_py_object();
-
-    // Need to guarantee that we have the gil here
+    // Need to guarantee that we have the gil here, fetching the parent object increfs it
     pybind11::gil_scoped_acquire gil;
 
+    auto py_object_parent = table_info.get_parent()->get_py_object();
+
     return pybind11::reinterpret_steal<pybind11::object>(
         (PyObject*)make_table_from_table_info_data(std::move(table_info_data), py_object_parent.ptr()));
 }
 
+std::vector<pybind11::object> CudfHelper::tables_from_table_info(
+    const std::vector<std::reference_wrapper<const TableInfoBase>>& table_infos)
+{
+    load();
+
+    // Snapshot the view data before touching Python, these only read C++ state
+    std::vector<TableInfoData> table_data;
+    table_data.reserve(table_infos.size());
+    for (const auto& table_info : table_infos)
+    {
+        table_data.emplace_back(table_info.get().get_data());
+    }
+
+    std::vector<pybind11::object> tables;
+    tables.reserve(table_infos.size());
+
+    // A single acquisition covers every conversion
+    pybind11::gil_scoped_acquire gil;
+
+    for (std::size_t i = 0; i < table_infos.size(); ++i)
+    {
+        auto py_object_parent = table_infos[i].get().get_parent()->get_py_object();
+
+        tables.emplace_back(pybind11::reinterpret_steal<pybind11::object>(
+            (PyObject*)make_table_from_table_info_data(std::move(table_data[i]), py_object_parent.ptr())));
+    }
+
+    return tables;
+}
+
 TableInfoData CudfHelper::table_info_data_from_table(pybind11::object table)
 {
+    load();
+
     return proxy_table_info_data_from_table(std::move(table));
 }
 
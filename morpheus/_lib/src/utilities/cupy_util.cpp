@@ -17,133 +17,356 @@
 
 #include "morpheus/utilities/cupy_util.hpp"
 
-#include "morpheus/objects/dtype.hpp"   // for DType
-#include "morpheus/objects/tensor.hpp"  // for Tensor
-#include "morpheus/types.hpp"           // for TensorIndex
+#include "morpheus/objects/dev_mem_info.hpp"       // for DevMemInfo
+#include "morpheus/objects/dtype.hpp"              // for DType
+#include "morpheus/objects/memory_descriptor.hpp"  // for MemoryDescriptor
+#include "morpheus/objects/rmm_tensor.hpp"         // for RMMTensor
+#include "morpheus/objects/tensor_object.hpp"      // for ITensor
+#include "morpheus/types.hpp"                      // for TensorIndex
+#include "morpheus/utilities/matx_util.hpp"        // for MatxUtil
 #include "morpheus/utilities/tensor_util.hpp"
 
 #include <cuda_runtime.h>
+#include <dlpack/dlpack.h>        // for DLManagedTensor, DLTensor
 #include <glog/logging.h>         // for COMPACT_GOOGLE_LOG_FATAL, DCHECK, LogMessageFatal
+#include <mrc/cuda/common.hpp>    // for MRC_CHECK_CUDA
 #include <pybind11/functional.h>  // IWYU pragma: keep
 #include <pybind11/gil.h>         // IWYU pragma: keep
 #include <pybind11/pybind11.h>
 #include <pybind11/pytypes.h>
-#include <pybind11/stl.h>            // IWYU pragma: keep
-#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
-#include <rmm/device_buffer.hpp>     // for device_buffer
-
-#include <cstdint>  // for uintptr_t
-#include <memory>   // for make_shared
-#include <optional>
+#include <pybind11/stl.h>                         // IWYU pragma: keep
+#include <rmm/cuda_stream_view.hpp>               // for cuda_stream_per_thread
+#include <rmm/device_buffer.hpp>                  // for device_buffer
+#include <rmm/mr/device/per_device_resource.hpp>  // for get_current_device_resource
+
+#include <algorithm>   // for transform
+#include <cstdint>     // for int64_t, uint8_t
+#include <functional>  // for multiplies, plus
+#include <iterator>    // for back_inserter
+#include <memory>      // for make_shared
+#include <numeric>     // for transform_reduce
 #include <ostream>
-#include <string>   // for string
-#include <utility>  // for move
+#include <string>   // for string, to_string
+#include <utility>  // for move, swap
 #include <vector>   // for vector
 
 namespace morpheus {
 
 namespace py = pybind11;
 
-pybind11::module_ CupyUtil::get_cp()
+namespace {
+
+// Name the DLPack protocol requires on an unconsumed capsule; consumers rename it to "used_dltensor"
+constexpr const char* DLTensorCapsuleName = "dltensor";
+
+DLDataType dtype_to_dlpack(const DType& dtype)
 {
-    DCHECK(PyGILState_Check() != 0);
-    return pybind11::cast<pybind11::module_>(pybind11::module_::import("cupy"));
+    DLDataType dl_dtype{};
+    dl_dtype.bits  = static_cast<uint8_t>(dtype.item_size() * 8);
+    dl_dtype.lanes = 1;
+
+    switch (dtype.type_char())
+    {
+    case 'i':
+        dl_dtype.code = kDLInt;
+        break;
+    case 'u':
+        dl_dtype.code = kDLUInt;
+        break;
+    case 'f':
+        dl_dtype.code = kDLFloat;
+        break;
+    case '?':
+        dl_dtype.code = kDLBool;
+        break;
+    default:
+        CHECK(false) << "Type char '" << dtype.type_char() << "' cannot be exchanged over DLPack";
+    }
+
+    return dl_dtype;
 }
 
-bool CupyUtil::is_cupy_array(pybind11::object test_obj)
+DType dtype_from_dlpack(const DLDataType& dl_dtype)
 {
-    return py::isinstance(test_obj, CupyUtil::get_cp().attr("ndarray"));
+    CHECK_EQ(dl_dtype.lanes, 1) << "Vectorized DLPack types are not supported";
+
+    char type_char = '\0';
+    switch (dl_dtype.code)
+    {
+    case kDLInt:
+        type_char = 'i';
+        break;
+    case kDLUInt:
+        type_char = 'u';
+        break;
+    case kDLFloat:
+        type_char = 'f';
+        break;
+    case kDLBool:
+        return DType(TypeId::BOOL8);
+    default:
+        CHECK(false) << "DLPack type code " << dl_dtype.code << " is not supported";
+    }
+
+    return DType::from_numpy(std::string{'<', type_char} + std::to_string(dl_dtype.bits / 8));
 }
 
-pybind11::object CupyUtil::tensor_to_cupy(const TensorObject& tensor)
+// Owns a consumed DLManagedTensor, releasing the producer's reference (under the GIL, the deleter decrefs the
+// CuPy array) once the last tensor view sharing it is destroyed
+struct DLPackHolder
 {
-    // These steps follow the cupy._convert_object_with_cuda_array_interface function shown here:
-    // https://github.com/cupy/cupy/blob/a5b24f91d4d77fa03e6a4dd2ac954ff9a04e21f4/cupy/core/core.pyx#L2478-L2514
-    auto cp      = CupyUtil::get_cp();
-    auto cuda    = cp.attr("cuda");
-    auto ndarray = cp.attr("ndarray");
+    DLPackHolder(DLManagedTensor* managed) : managed(managed) {}
 
-    auto py_tensor = pybind11::cast(tensor);
+    ~DLPackHolder()
+    {
+        if (managed != nullptr && managed->deleter != nullptr)
+        {
+            py::gil_scoped_acquire gil;
+            managed->deleter(managed);
+        }
+    }
 
-    auto ptr    = (uintptr_t)tensor.data();
-    auto nbytes = tensor.bytes();
-    auto owner  = py_tensor;
-    int dev_id  = -1;
+    DLManagedTensor* managed;
+};
 
-    pybind11::list shape_list;
-    pybind11::list stride_list;
+/**
+ * @brief Tensor backed by memory borrowed over DLPack, typically a CuPy array. Shares the holder across views so
+ * the producer's memory outlives every slice taken from it; operations that materialize new memory return plain
+ * `RMMTensor`s.
+ */
+class DLPackTensor final : public ITensor, public std::enable_shared_from_this<DLPackTensor>
+{
+  public:
+    DLPackTensor(std::shared_ptr<DLPackHolder> holder, DType dtype, ShapeType shape, ShapeType stride,
+                 TensorSize offset = 0) :
+      m_holder(std::move(holder)),
+      m_md(std::make_shared<MemoryDescriptor>(rmm::cuda_stream_per_thread, rmm::mr::get_current_device_resource())),
+      m_dtype(std::move(dtype)),
+      m_shape(std::move(shape)),
+      m_stride(std::move(stride)),
+      m_offset(offset)
+    {}
+
+    void* data() const override
+    {
+        const auto& dl_tensor = m_holder->managed->dl_tensor;
+        return static_cast<uint8_t*>(dl_tensor.data) + dl_tensor.byte_offset + m_offset * m_dtype.item_size();
+    }
 
-    for (auto& idx : tensor.get_shape())
+    TensorSize bytes() const override
     {
-        shape_list.append(idx);
+        return this->count() * m_dtype.item_size();
     }
 
-    for (auto& idx : tensor.get_stride())
+    std::shared_ptr<MemoryDescriptor> get_memory() const override
     {
-        stride_list.append(idx * tensor.dtype_size());
+        return m_md;
     }
 
-    pybind11::object mem    = cuda.attr("UnownedMemory")(ptr, nbytes, owner, dev_id);
-    pybind11::object dtype  = cp.attr("dtype")(tensor.get_numpy_typestr());
-    pybind11::object memptr = cuda.attr("MemoryPointer")(mem, 0);
+    RankType rank() const override
+    {
+        return m_shape.size();
+    }
 
-    // TODO(MDD): Sync on stream
-    return ndarray(
-        pybind11::cast<pybind11::tuple>(shape_list), dtype, memptr, pybind11::cast<pybind11::tuple>(stride_list));
-}
+    TensorSize count() const override
+    {
+        return TensorUtils::get_elem_count(m_shape);
+    }
 
-TensorObject CupyUtil::cupy_to_tensor(pybind11::object cupy_array)
-{
-    // Convert inputs from cupy to Tensor
-    pybind11::dict arr_interface = cupy_array.attr("__cuda_array_interface__");
+    DType dtype() const override
+    {
+        return m_dtype;
+    }
 
-    pybind11::tuple shape_tup = arr_interface["shape"];
+    TensorIndex shape(TensorIndex idx) const override
+    {
+        return m_shape.at(idx);
+    }
 
-    auto shape = shape_tup.cast<ShapeType>();
+    TensorIndex stride(TensorIndex idx) const override
+    {
+        return m_stride.at(idx);
+    }
 
-    auto typestr = arr_interface["typestr"].cast<std::string>();
+    intptr_t stream() const override
+    {
+        return (intptr_t)m_md->cuda_stream.value();
+    }
 
-    pybind11::tuple data_tup = arr_interface["data"];
+    bool is_compact() const override
+    {
+        return TensorUtils::has_contiguous_stride(m_shape, m_stride);
+    }
 
-    auto data_ptr = data_tup[0].cast<uintptr_t>();
+    std::shared_ptr<ITensor> slice(const ShapeType& min_dims, const ShapeType& max_dims) const override
+    {
+        auto offset = std::transform_reduce(
+            m_stride.begin(), m_stride.end(), min_dims.begin(), m_offset, std::plus<>(), std::multiplies<>());
 
-    ShapeType strides{};
+        ShapeType shape;
+        std::transform(max_dims.begin(), max_dims.end(), min_dims.begin(), std::back_inserter(shape), std::minus<>());
 
-    if (arr_interface.contains("strides") && !arr_interface["strides"].is_none())
+        return std::make_shared<DLPackTensor>(m_holder, m_dtype, std::move(shape), m_stride, offset);
+    }
+
+    std::shared_ptr<ITensor> reshape(const ShapeType& dims) const override
     {
-        pybind11::tuple strides_tup = arr_interface["strides"];
+        DCHECK_EQ(TensorUtils::get_elem_count(dims), this->count()) << "Reshape must preserve the element count";
+        DCHECK(is_compact()) << "Reshape of a non-compact tensor is not expressible as a view, deep_copy first";
+
+        // Zero-copy: only the shape and stride change
+        ShapeType stride;
+        TensorUtils::set_contiguous_stride(dims, stride);
 
-        strides = strides_tup.cast<ShapeType>();
+        return std::make_shared<DLPackTensor>(m_holder, m_dtype, dims, std::move(stride), m_offset);
     }
 
-    auto dtype = DType::from_numpy(typestr);
+    std::shared_ptr<ITensor> swap_axes(TensorIndex axis1, TensorIndex axis2) const override
+    {
+        // Pure stride manipulation, the data is never touched
+        auto shape  = m_shape;
+        auto stride = m_stride;
+        std::swap(shape[axis1], shape[axis2]);
+        std::swap(stride[axis1], stride[axis2]);
+
+        return std::make_shared<DLPackTensor>(m_holder, m_dtype, std::move(shape), std::move(stride), m_offset);
+    }
 
-    //  Get the size from the shape and dtype
-    auto size = TensorUtils::get_elem_count(shape) * dtype.item_size();
+    std::shared_ptr<ITensor> deep_copy() const override
+    {
+        // Materialize into owned memory with a compact layout, compacting any stride in the process
+        auto buffer = std::make_shared<rmm::device_buffer>(this->bytes(), m_md->cuda_stream, m_md->memory_resource);
 
-    // Finally, handle the stream
-    auto stream_value = arr_interface["stream"].cast<std::optional<intptr_t>>();
+        TensorObject self{m_md, std::const_pointer_cast<DLPackTensor>(this->shared_from_this())};
+        TensorUtils::copy_compact(self, buffer->data(), cudaMemcpyDeviceToDevice);
 
-    // Always create with stream per thread. Only need to check the stream for synchronization purposes
-    // See https://numba.readthedocs.io/en/latest/cuda/cuda_array_interface.html#synchronization
-    if (stream_value.has_value())
+        return std::make_shared<RMMTensor>(std::move(buffer), 0, m_dtype, m_shape);
+    }
+
+    std::shared_ptr<ITensor> copy_rows(const std::vector<RangeType>& selected_rows,
+                                       TensorIndex num_rows) const override
     {
-        DCHECK_NE(*stream_value, 0) << "Invalid for stream to be 0";
+        return this->deep_copy()->copy_rows(selected_rows, num_rows);
+    }
 
-        auto stream_view = rmm::cuda_stream_view(reinterpret_cast<cudaStream_t>(*stream_value));
+    std::shared_ptr<ITensor> as_type(DType new_dtype) const override
+    {
+        auto new_buffer =
+            MatxUtil::cast(DevMemInfo{this->data(), m_dtype, m_md, m_shape, m_stride}, new_dtype.type_id());
 
-        // Make sure to sync on this
-        stream_view.synchronize();
+        return std::make_shared<RMMTensor>(std::move(new_buffer), 0, std::move(new_dtype), m_shape, m_stride);
     }
 
-    auto tensor =
-        Tensor::create(std::make_shared<rmm::device_buffer>((void const*)data_ptr, size, rmm::cuda_stream_per_thread),
-                       DType::from_numpy(typestr),
-                       shape,
-                       strides,
-                       0);
+  private:
+    std::shared_ptr<DLPackHolder> m_holder;
+    std::shared_ptr<MemoryDescriptor> m_md;
+    DType m_dtype;
+    ShapeType m_shape;
+    ShapeType m_stride;
+    TensorSize m_offset;  // In elements
+};
+
+// Context behind an exported capsule: keeps the tensor's storage alive and owns the shape/stride arrays the
+// DLTensor points into
+struct DLPackExportContext
+{
+    std::shared_ptr<ITensor> tensor;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    DLManagedTensor managed{};
+};
+
+}  // namespace
+
+pybind11::module_ CupyUtil::get_cp()
+{
+    DCHECK(PyGILState_Check() != 0);
+    return pybind11::cast<pybind11::module_>(pybind11::module_::import("cupy"));
+}
+
+bool CupyUtil::is_cupy_array(pybind11::object test_obj)
+{
+    return py::isinstance(test_obj, CupyUtil::get_cp().attr("ndarray"));
+}
+
+pybind11::object CupyUtil::tensor_to_cupy(const TensorObject& tensor)
+{
+    // Hand the tensor over as a DLPack capsule: one Python call replaces the UnownedMemory/MemoryPointer/ndarray
+    // construction chain, and CuPy adopts the memory without a copy. The export context keeps the underlying
+    // storage alive until CuPy releases the managed tensor.
+    auto* ctx   = new DLPackExportContext();
+    ctx->tensor = tensor.get_tensor();
+
+    const auto shape  = tensor.get_shape();
+    const auto stride = tensor.get_stride();
+    ctx->shape.assign(shape.begin(), shape.end());
+    ctx->strides.assign(stride.begin(), stride.end());
+
+    int device_id = 0;
+    MRC_CHECK_CUDA(cudaGetDevice(&device_id));
+
+    auto& dl_tensor       = ctx->managed.dl_tensor;
+    dl_tensor.data        = tensor.data();
+    dl_tensor.device      = {kDLCUDA, device_id};
+    dl_tensor.ndim        = static_cast<int32_t>(ctx->shape.size());
+    dl_tensor.dtype       = dtype_to_dlpack(tensor.dtype());
+    dl_tensor.shape       = ctx->shape.data();
+    dl_tensor.strides     = ctx->strides.data();
+    dl_tensor.byte_offset = 0;
+
+    ctx->managed.manager_ctx = ctx;
+    ctx->managed.deleter     = [](DLManagedTensor* managed) {
+        delete static_cast<DLPackExportContext*>(managed->manager_ctx);
+    };
+
+    // If CuPy consumes the capsule it renames it and the deleter fires when CuPy is done; otherwise the capsule
+    // destructor still fires it
+    py::capsule capsule(&ctx->managed, DLTensorCapsuleName, [](PyObject* obj) {
+        if (PyCapsule_IsValid(obj, DLTensorCapsuleName) != 0)
+        {
+            auto* managed = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(obj, DLTensorCapsuleName));
+            managed->deleter(managed);
+        }
+    });
+
+    return CupyUtil::get_cp().attr("fromDlpack")(capsule);
+}
+
+TensorObject CupyUtil::cupy_to_tensor(pybind11::object cupy_array)
+{
+    // Take ownership of the array's memory through a DLPack capsule instead of parsing
+    // `__cuda_array_interface__` and copying the bytes into a fresh device_buffer. The managed tensor keeps the
+    // CuPy array alive for as long as any view of the resulting tensor exists.
+    py::capsule capsule = cupy_array.attr("toDlpack")();
+
+    auto* managed = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule.ptr(), DLTensorCapsuleName));
+    CHECK(managed != nullptr) << "Expected a '" << DLTensorCapsuleName << "' capsule from CuPy";
+
+    // Mark the capsule consumed so its destructor does not also fire the deleter
+    PyCapsule_SetName(capsule.ptr(), "used_dltensor");
+
+    const auto& dl_tensor = managed->dl_tensor;
+    auto dtype            = dtype_from_dlpack(dl_tensor.dtype);
+
+    ShapeType shape(dl_tensor.shape, dl_tensor.shape + dl_tensor.ndim);
+
+    ShapeType strides;
+    if (dl_tensor.strides != nullptr)
+    {
+        strides.assign(dl_tensor.strides, dl_tensor.strides + dl_tensor.ndim);
+    }
+    else
+    {
+        TensorUtils::set_contiguous_stride(shape, strides);
+    }
+
+    // The legacy capsule exchange carries no stream, the producer's work is ordered on CuPy's current stream.
+    // Synchronize it once, matching the synchronization the array-interface path performed.
+    CupyUtil::get_cp().attr("cuda").attr("get_current_stream")().attr("synchronize")();
+
+    auto holder = std::make_shared<DLPackHolder>(managed);
 
-    return tensor;
+    return {std::make_shared<DLPackTensor>(std::move(holder), std::move(dtype), std::move(shape), std::move(strides))};
 }
 
 TensorMap CupyUtil::cupy_to_tensors(const py_tensor_map_t& cupy_tensors)
@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/device_util.hpp"
+
+#include <cuda_runtime.h>       // for cudaSetDevice, cudaDeviceCanAccessPeer, cudaDeviceEnablePeerAccess
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
+
+#include <mutex>    // for mutex, lock_guard
+#include <set>      // for set
+#include <utility>  // for pair
+
+namespace {
+
+// Ordered (from, to) device pairs peer access has already been requested for
+std::set<std::pair<int, int>> g_peer_enabled_pairs;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::mutex g_peer_mutex;                             // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+// Enables access from the current device to `peer_device` if the hardware supports it
+void enable_one_direction(int current_device, int peer_device)
+{
+    int can_access = 0;
+    MRC_CHECK_CUDA(cudaDeviceCanAccessPeer(&can_access, current_device, peer_device));
+
+    if (can_access == 0)
+    {
+        return;
+    }
+
+    auto status = cudaDeviceEnablePeerAccess(peer_device, 0);
+    if (status == cudaErrorPeerAccessAlreadyEnabled)
+    {
+        // Someone else (another library in the process) beat us to it, clear the sticky error
+        cudaGetLastError();
+        return;
+    }
+
+    MRC_CHECK_CUDA(status);
+}
+
+}  // namespace
+
+namespace morpheus {
+
+DeviceScope::DeviceScope(int device_id)
+{
+    MRC_CHECK_CUDA(cudaGetDevice(&m_previous_device));
+    if (device_id != m_previous_device)
+    {
+        MRC_CHECK_CUDA(cudaSetDevice(device_id));
+    }
+}
+
+DeviceScope::~DeviceScope()
+{
+    // Restoring is best-effort: throwing from a destructor during unwind would terminate
+    cudaSetDevice(m_previous_device);
+}
+
+int DeviceUtil::current_device()
+{
+    int device_id = 0;
+    MRC_CHECK_CUDA(cudaGetDevice(&device_id));
+    return device_id;
+}
+
+void DeviceUtil::ensure_peer_access(int device_a, int device_b)
+{
+    if (device_a == device_b)
+    {
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock(g_peer_mutex);
+    if (!g_peer_enabled_pairs.insert({device_a, device_b}).second)
+    {
+        return;
+    }
+
+    g_peer_enabled_pairs.insert({device_b, device_a});
+
+    // cudaDeviceEnablePeerAccess is directional and applies to the current device, flip to each side in turn
+    {
+        DeviceScope scope{device_a};
+        enable_one_direction(device_a, device_b);
+    }
+    {
+        DeviceScope scope{device_b};
+        enable_one_direction(device_b, device_a);
+    }
+}
+
+}  // namespace morpheus
@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/edge_gauges.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace morpheus {
+
+void EdgeGauge::enqueue() noexcept
+{
+    const auto depth = m_depth.fetch_add(1, std::memory_order_relaxed) + 1;
+    m_enqueued.fetch_add(1, std::memory_order_relaxed);
+
+    // Racing producers may briefly publish a stale maximum, the mark converges on the next enqueue at that depth
+    auto high_water = m_high_water.load(std::memory_order_relaxed);
+    while (static_cast<std::uint64_t>(depth) > high_water &&
+           !m_high_water.compare_exchange_weak(
+               high_water, static_cast<std::uint64_t>(depth), std::memory_order_relaxed))
+    {}
+}
+
+void EdgeGauge::dequeue() noexcept
+{
+    m_depth.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void EdgeGauge::add_blocked_ns(std::uint64_t nanoseconds) noexcept
+{
+    m_blocked_ns.fetch_add(nanoseconds, std::memory_order_relaxed);
+}
+
+void EdgeGauge::reset() noexcept
+{
+    m_high_water.store(0, std::memory_order_relaxed);
+    m_enqueued.store(0, std::memory_order_relaxed);
+    m_blocked_ns.store(0, std::memory_order_relaxed);
+}
+
+std::map<std::string, double> EdgeGauge::stats() const
+{
+    return {{"depth", static_cast<double>(m_depth.load(std::memory_order_relaxed))},
+            {"high_water", static_cast<double>(m_high_water.load(std::memory_order_relaxed))},
+            {"enqueued", static_cast<double>(m_enqueued.load(std::memory_order_relaxed))},
+            {"blocked_ms", static_cast<double>(m_blocked_ns.load(std::memory_order_relaxed)) / 1.0e6}};
+}
+
+EdgeGaugeRegistry& EdgeGaugeRegistry::instance()
+{
+    static EdgeGaugeRegistry registry;
+
+    return registry;
+}
+
+EdgeGauge& EdgeGaugeRegistry::get_or_create(const std::string& name)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    auto& gauge = m_gauges[name];
+    if (!gauge)
+    {
+        gauge = std::make_unique<EdgeGauge>();
+    }
+
+    return *gauge;
+}
+
+std::map<std::string, std::map<std::string, double>> EdgeGaugeRegistry::all_stats() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    std::map<std::string, std::map<std::string, double>> stats;
+    for (const auto& [name, gauge] : m_gauges)
+    {
+        stats[name] = gauge->stats();
+    }
+
+    return stats;
+}
+
+void EdgeGaugeRegistry::reset_all()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    for (auto& [name, gauge] : m_gauges)
+    {
+        gauge->reset();
+    }
+}
+
+}  // namespace morpheus
@@ -0,0 +1,220 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/gpu_sampler.hpp"
+
+#include <glog/logging.h>
+#include <nvml.h>
+
+#include <algorithm>  // for max
+#include <chrono>
+#include <mutex>
+#include <thread>   // for this_thread::sleep_for
+#include <utility>  // for move
+
+namespace {
+
+// NVML reports PCIe throughput in KB/s
+constexpr double KBPerMB = 1024.0;
+
+std::int64_t steady_now_ms()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+}  // namespace
+
+namespace morpheus {
+
+GpuUtilizationSampler& GpuUtilizationSampler::instance()
+{
+    static GpuUtilizationSampler sampler;
+
+    return sampler;
+}
+
+bool GpuUtilizationSampler::start(std::chrono::milliseconds interval, unsigned int device_index, std::size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_running)
+    {
+        return true;
+    }
+
+    auto status = nvmlInit_v2();
+    if (status != NVML_SUCCESS)
+    {
+        LOG(WARNING) << "GPU utilization sampling disabled, NVML failed to initialize: " << nvmlErrorString(status);
+
+        return false;
+    }
+
+    nvmlDevice_t device{};
+    status = nvmlDeviceGetHandleByIndex_v2(device_index, &device);
+    if (status != NVML_SUCCESS)
+    {
+        LOG(WARNING) << "GPU utilization sampling disabled, no NVML handle for device " << device_index << ": "
+                     << nvmlErrorString(status);
+        nvmlShutdown();
+
+        return false;
+    }
+
+    m_samples.clear();
+    m_capacity       = std::max<std::size_t>(capacity, 1);
+    m_running        = true;
+    m_stop_requested = false;
+    m_sampler        = std::thread(&GpuUtilizationSampler::sampler_main, this, device_index, interval);
+
+    return true;
+}
+
+void GpuUtilizationSampler::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_running)
+        {
+            return;
+        }
+
+        m_stop_requested = true;
+    }
+
+    m_sampler.join();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running = false;
+
+    nvmlShutdown();
+}
+
+bool GpuUtilizationSampler::running() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_running;
+}
+
+std::vector<GpuUtilizationSampler::Sample> GpuUtilizationSampler::samples() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return {m_samples.begin(), m_samples.end()};
+}
+
+std::map<std::string, double> GpuUtilizationSampler::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::map<std::string, double> stats{{"sample_count", 0.0},
+                                        {"sm_mean_percent", 0.0},
+                                        {"sm_peak_percent", 0.0},
+                                        {"memory_mean_percent", 0.0},
+                                        {"memory_peak_percent", 0.0},
+                                        {"pcie_rx_mean_mbs", 0.0},
+                                        {"pcie_rx_peak_mbs", 0.0},
+                                        {"pcie_tx_mean_mbs", 0.0},
+                                        {"pcie_tx_peak_mbs", 0.0}};
+
+    if (m_samples.empty())
+    {
+        return stats;
+    }
+
+    for (const auto& sample : m_samples)
+    {
+        stats["sm_mean_percent"] += sample.sm_percent;
+        stats["memory_mean_percent"] += sample.memory_percent;
+        stats["pcie_rx_mean_mbs"] += sample.pcie_rx_mbs;
+        stats["pcie_tx_mean_mbs"] += sample.pcie_tx_mbs;
+
+        stats["sm_peak_percent"]     = std::max(stats["sm_peak_percent"], sample.sm_percent);
+        stats["memory_peak_percent"] = std::max(stats["memory_peak_percent"], sample.memory_percent);
+        stats["pcie_rx_peak_mbs"]    = std::max(stats["pcie_rx_peak_mbs"], sample.pcie_rx_mbs);
+        stats["pcie_tx_peak_mbs"]    = std::max(stats["pcie_tx_peak_mbs"], sample.pcie_tx_mbs);
+    }
+
+    const auto count = static_cast<double>(m_samples.size());
+
+    stats["sample_count"] = count;
+    stats["sm_mean_percent"] /= count;
+    stats["memory_mean_percent"] /= count;
+    stats["pcie_rx_mean_mbs"] /= count;
+    stats["pcie_tx_mean_mbs"] /= count;
+
+    return stats;
+}
+
+void GpuUtilizationSampler::sampler_main(unsigned int device_index, std::chrono::milliseconds interval)
+{
+    nvmlDevice_t device{};
+    if (nvmlDeviceGetHandleByIndex_v2(device_index, &device) != NVML_SUCCESS)
+    {
+        return;
+    }
+
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stop_requested)
+            {
+                return;
+            }
+        }
+
+        Sample sample{steady_now_ms(), 0.0, 0.0, 0.0, 0.0};
+
+        nvmlUtilization_t utilization{};
+        if (nvmlDeviceGetUtilizationRates(device, &utilization) == NVML_SUCCESS)
+        {
+            sample.sm_percent     = static_cast<double>(utilization.gpu);
+            sample.memory_percent = static_cast<double>(utilization.memory);
+        }
+
+        // Each PCIe read blocks inside NVML for its ~20ms measurement window, which is why this runs on a
+        // dedicated thread rather than in the pipeline's stats scrape
+        unsigned int throughput_kbs = 0;
+        if (nvmlDeviceGetPcieThroughput(device, NVML_PCIE_UTIL_RX_BYTES, &throughput_kbs) == NVML_SUCCESS)
+        {
+            sample.pcie_rx_mbs = static_cast<double>(throughput_kbs) / KBPerMB;
+        }
+
+        if (nvmlDeviceGetPcieThroughput(device, NVML_PCIE_UTIL_TX_BYTES, &throughput_kbs) == NVML_SUCCESS)
+        {
+            sample.pcie_tx_mbs = static_cast<double>(throughput_kbs) / KBPerMB;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_samples.push_back(std::move(sample));
+            while (m_samples.size() > m_capacity)
+            {
+                m_samples.pop_front();
+            }
+        }
+
+        std::this_thread::sleep_for(interval);
+    }
+}
+
+}  // namespace morpheus
@@ -36,24 +36,37 @@
 #include <boost/beast/core/string_type.hpp>   // for string_view
 #include <boost/beast/core/tcp_stream.hpp>    // for tcp_stream
 #include <boost/beast/http.hpp>               // for read_async, request, response, verb, write_async
+#include <boost/beast/http/buffer_body.hpp>   // for buffer_body
 #include <boost/beast/http/error.hpp>         // for error, error::end_of_stream
 #include <boost/beast/http/field.hpp>         // for field, field::content_type
 #include <boost/beast/http/message.hpp>       // for message, response, request
 #include <boost/beast/http/parser.hpp>        // for request_parser, parser
+#include <boost/beast/http/serializer.hpp>    // for response_serializer
 #include <boost/beast/http/status.hpp>        // for status, status::not_found
 #include <boost/beast/http/string_body.hpp>   // for string_body, basic_string_body, basic_string_body<>::value_type
 #include <boost/beast/http/verb.hpp>          // for verb, operator<<, verb::unknown
+#include <boost/beast/websocket.hpp>          // for websocket::stream, is_upgrade, permessage_deflate
 #include <boost/utility/string_view.hpp>      // for basic_string_view, operator<<, operator==
 #include <glog/logging.h>                     // for CHECK and LOG
+#include <pthread.h>                          // for pthread_self, pthread_setaffinity_np
 #include <pybind11/cast.h>                    // for cast
 #include <pybind11/gil.h>
 #include <pybind11/pybind11.h>  // IWYU pragma: keep
 #include <pybind11/pytypes.h>
 
+#include <sched.h>  // for cpu_set_t, CPU_SET, CPU_ZERO
+#include <zlib.h>   // for inflateInit2, inflate, inflateEnd
+#include <zstd.h>   // for ZSTD_createDCtx, ZSTD_decompressStream
+
+#include <algorithm>    // for max
 #include <array>        // for array (indirectly used by the wrapped python callback function)
 #include <exception>    // for exception
+#include <memory>       // for unique_ptr
+#include <optional>     // for optional
 #include <ostream>      // needed for glog
 #include <stdexcept>    // for runtime_error, length_error
+#include <string>       // for string
+#include <thread>       // for thread::hardware_concurrency
 #include <type_traits>  // indirectly used by pybind11 casting
 #include <utility>      // for move
 
@@ -70,6 +83,266 @@ namespace net   = boost::asio;   // from <boost/asio.hpp>
 using tcp = boost::asio::ip::tcp;  // NOLINT(readability-identifier-naming)
 using namespace std::literals::chrono_literals;
 
+// How long an established keep-alive connection may sit idle between requests. The per-request timeout only
+// applies to the first request; afterwards the connection is known good and collectors are encouraged to hold
+// one multiplexing connection open instead of re-connecting per burst
+constexpr auto KeepAliveIdleTimeout = 5min;
+
+// Pin the calling thread to a core so each reuse-port acceptor keeps its cache-hot CPU
+void set_thread_affinity(unsigned core)
+{
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(core % std::thread::hardware_concurrency(), &cpu_set);
+
+    auto rc = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (rc != 0)
+    {
+        LOG(WARNING) << "Failed to set CPU affinity for HTTP server thread: " << rc;
+    }
+}
+
+// Inflate a gzip (or raw zlib/deflate) encoded body in bounded chunks. The decompressed size is capped at
+// `max_size` so an over-compressed body cannot balloon past the limit the parser enforced on the wire bytes
+std::string gzip_decompress(const std::string& body, std::size_t max_size)
+{
+    z_stream strm{};
+
+    // 15+32 enables automatic gzip/zlib header detection
+    if (inflateInit2(&strm, 15 + 32) != Z_OK)
+    {
+        throw std::runtime_error("Failed to initialize zlib inflate state");
+    }
+
+    const std::unique_ptr<z_stream, int (*)(z_stream*)> cleanup(&strm, &inflateEnd);
+
+    strm.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(body.data()));
+    strm.avail_in = body.size();
+
+    std::string decompressed;
+    std::array<char, 1 << 16> chunk;
+
+    int rc = Z_OK;
+    while (rc != Z_STREAM_END)
+    {
+        strm.next_out  = reinterpret_cast<Bytef*>(chunk.data());
+        strm.avail_out = chunk.size();
+
+        rc = inflate(&strm, Z_NO_FLUSH);
+        if (rc != Z_OK && rc != Z_STREAM_END)
+        {
+            // Truncated input surfaces as Z_BUF_ERROR, corrupt input as Z_DATA_ERROR
+            throw std::runtime_error("Invalid or truncated gzip body");
+        }
+
+        decompressed.append(chunk.data(), chunk.size() - strm.avail_out);
+        if (decompressed.size() > max_size)
+        {
+            throw std::length_error("Decompressed body exceeds the maximum payload size");
+        }
+    }
+
+    return decompressed;
+}
+
+// Streaming zstd decompression counterpart of `gzip_decompress`, same size cap
+std::string zstd_decompress(const std::string& body, std::size_t max_size)
+{
+    const std::unique_ptr<ZSTD_DCtx, std::size_t (*)(ZSTD_DCtx*)> dctx(ZSTD_createDCtx(), &ZSTD_freeDCtx);
+    if (!dctx)
+    {
+        throw std::runtime_error("Failed to create zstd decompression context");
+    }
+
+    ZSTD_inBuffer input{body.data(), body.size(), 0};
+
+    std::string decompressed;
+    std::array<char, 1 << 16> chunk;
+
+    std::size_t rc = 1;
+    while (input.pos < input.size)
+    {
+        ZSTD_outBuffer output{chunk.data(), chunk.size(), 0};
+
+        rc = ZSTD_decompressStream(dctx.get(), &output, &input);
+        if (ZSTD_isError(rc) != 0)
+        {
+            throw std::runtime_error(std::string("Invalid zstd body: ") + ZSTD_getErrorName(rc));
+        }
+
+        decompressed.append(chunk.data(), output.pos);
+        if (decompressed.size() > max_size)
+        {
+            throw std::length_error("Decompressed body exceeds the maximum payload size");
+        }
+    }
+
+    if (rc != 0)
+    {
+        throw std::runtime_error("Truncated zstd body");
+    }
+
+    return decompressed;
+}
+
+// Decode a Content-Encoding request header before the body reaches the parse function. Identity bodies pass
+// through untouched, unsupported encodings are rejected
+std::string decode_body(const beast::string_view encoding, std::string&& body, std::size_t max_size)
+{
+    if (encoding.empty() || encoding == "identity")
+    {
+        return std::move(body);
+    }
+
+    if (encoding == "gzip" || encoding == "deflate")
+    {
+        return gzip_decompress(body, max_size);
+    }
+
+    if (encoding == "zstd")
+    {
+        return zstd_decompress(body, max_size);
+    }
+
+    throw std::runtime_error("Unsupported Content-Encoding: " + std::string(encoding));
+}
+
+namespace websocket = beast::websocket;  // from <boost/beast/websocket.hpp>
+
+// Serves one agent which upgraded its connection to a WebSocket and now streams record batches continuously, one
+// batch per message. Each message is handed to the same parse function as a POST body, so the source's
+// accumulation logic is shared between the two ingestion modes; the protocol's own framing replaces per-request
+// HTTP overhead. Accepted batches are not acknowledged individually, a rejected batch (parse status >= 400) is
+// reported back to the agent in a text frame while the stream stays up. Created by `Session` when it sees an
+// upgrade request on the configured endpoint, taking ownership of the socket.
+class WebSocketSession : public std::enable_shared_from_this<WebSocketSession>
+{
+  public:
+    WebSocketSession(beast::tcp_stream&& stream,
+                     std::shared_ptr<morpheus::payload_parse_fn_t> payload_parse_fn,
+                     std::size_t max_payload_size) :
+      m_ws{std::move(stream)},
+      m_payload_parse_fn{std::move(payload_parse_fn)},
+      m_max_payload_size{max_payload_size}
+    {}
+
+    ~WebSocketSession() = default;
+
+    void run(http::request<http::string_body>&& request)
+    {
+        m_ws.read_message_max(m_max_payload_size);
+
+        // Agents may negotiate per-message compression, the WebSocket counterpart of Content-Encoding
+        websocket::permessage_deflate pmd;
+        pmd.server_enable = true;
+        m_ws.set_option(pmd);
+
+        // The suggested server timeout pings idle peers instead of expiring them, which is what a long-lived
+        // streaming connection needs; the stream-level expiry the HTTP session armed must be turned off
+        beast::get_lowest_layer(m_ws).expires_never();
+        m_ws.set_option(websocket::stream_base::timeout::suggested(beast::role_type::server));
+
+        m_ws.async_accept(request, beast::bind_front_handler(&WebSocketSession::on_accept, shared_from_this()));
+    }
+
+  private:
+    void on_accept(beast::error_code ec)
+    {
+        if (ec)
+        {
+            LOG(ERROR) << "Error accepting websocket connection: " << ec.message();
+            return;
+        }
+
+        do_read();
+    }
+
+    void do_read()
+    {
+        m_ws.async_read(m_buffer, beast::bind_front_handler(&WebSocketSession::on_read, shared_from_this()));
+    }
+
+    void on_read(beast::error_code ec, std::size_t bytes_transferred)
+    {
+        if (ec == websocket::error::closed)
+        {
+            return;  // Agent closed the stream cleanly
+        }
+
+        if (ec)
+        {
+            LOG(ERROR) << "Error reading websocket message: " << ec.message();
+            return;
+        }
+
+        auto body = beast::buffers_to_string(m_buffer.data());
+        m_buffer.consume(m_buffer.size());
+
+        unsigned status = 500;
+        std::string response_body;
+        morpheus::on_complete_cb_fn_t on_complete_cb{nullptr};
+
+        try
+        {
+            auto parse_status = (*m_payload_parse_fn)(std::move(body));
+
+            status         = std::get<0>(parse_status);
+            response_body  = std::get<2>(parse_status);
+            on_complete_cb = std::get<3>(parse_status);
+        } catch (const std::exception& e)
+        {
+            LOG(ERROR) << "Caught exception while parsing websocket message: " << e.what();
+            response_body = e.what();
+        }
+
+        if (on_complete_cb)
+        {
+            // There is no per-batch response write to wait on, the batch is done once parsed
+            try
+            {
+                on_complete_cb(ec);
+            } catch (const std::exception& e)
+            {
+                LOG(ERROR) << "Caught exception while calling on_complete callback: " << e.what();
+            }
+        }
+
+        if (status >= 400)
+        {
+            // Tell the agent which batch was rejected; the stream itself stays up. The write must complete
+            // before the next read is issued, beast forbids interleaving them
+            LOG(WARNING) << "Rejecting websocket message with status " << status << ": " << response_body;
+
+            m_reject_message = std::move(response_body);
+            m_ws.text(true);
+            m_ws.async_write(net::buffer(m_reject_message),
+                             beast::bind_front_handler(&WebSocketSession::on_write, shared_from_this()));
+            return;
+        }
+
+        do_read();
+    }
+
+    void on_write(beast::error_code ec, std::size_t bytes_transferred)
+    {
+        m_reject_message.clear();
+
+        if (ec)
+        {
+            LOG(ERROR) << "Error writing websocket message: " << ec.message();
+            return;
+        }
+
+        do_read();
+    }
+
+    websocket::stream<beast::tcp_stream> m_ws;
+    beast::flat_buffer m_buffer;
+    std::shared_ptr<morpheus::payload_parse_fn_t> m_payload_parse_fn;
+    std::size_t m_max_payload_size;
+    std::string m_reject_message;
+};
+
 class Session : public std::enable_shared_from_this<Session>
 {
   public:
@@ -100,7 +373,11 @@ class Session : public std::enable_shared_from_this<Session>
     {
         m_parser = std::make_unique<http::request_parser<http::string_body>>();
         m_parser->body_limit(m_max_payload_size);
-        m_stream.expires_after(m_timeout);
+
+        // A connection that already served a request gets the long idle expiry so it survives the gap until
+        // the collector's next POST; closing it here would force a reconnect per burst
+        m_stream.expires_after(m_requests_served > 0 ? std::max<std::chrono::seconds>(m_timeout, KeepAliveIdleTimeout)
+                                                     : m_timeout);
 
         http::async_read(
             m_stream, m_buffer, *m_parser, beast::bind_front_handler(&Session::on_read, shared_from_this()));
@@ -127,20 +404,61 @@ class Session : public std::enable_shared_from_this<Session>
     void handle_request(http::request<http::string_body>&& request)
     {
         DLOG(INFO) << "Received request: " << request.method() << " : " << request.target();
-        m_response = std::make_unique<http::response<http::string_body>>();
+
+        if (websocket::is_upgrade(request) && request.target() == m_url_endpoint)
+        {
+            // The agent holds this one connection open and streams record batches as WebSocket messages from
+            // here on. The HTTP session ends here, ownership of the socket moves to the WebSocket session
+            std::make_shared<WebSocketSession>(std::move(m_stream), m_payload_parse_fn, m_max_payload_size)
+                ->run(std::move(request));
+            return;
+        }
 
         if (request.target() == m_url_endpoint && (request.method() == m_method))
         {
-            std::string body{request.body()};
-            auto parse_status = (*m_payload_parse_fn)(body);
+            // Decode any Content-Encoding here on the session's worker thread before the parse function runs,
+            // the accept path never touches the body. Identity bodies move through without a copy
+            std::optional<std::string> body;
+            try
+            {
+                body = decode_body(
+                    request[http::field::content_encoding], std::move(request.body()), m_max_payload_size);
+            } catch (const std::exception& e)
+            {
+                LOG(WARNING) << "Rejecting request with undecodable body: " << e.what();
+
+                m_response = std::make_unique<http::response<http::string_body>>();
+                m_response->result(http::status::bad_request);
+                m_response->set(http::field::content_type, "text/plain");
+                m_response->body() = e.what();
+            }
+
+            if (body)
+            {
+                // Move the body into the parse function, handing it ownership of the buffer
+                auto parse_status = (*m_payload_parse_fn)(std::move(*body));
+
+                m_on_complete_cb = std::get<3>(parse_status);
 
-            m_response->result(std::get<0>(parse_status));
-            m_response->set(http::field::content_type, std::get<1>(parse_status));
-            m_response->body() = std::get<2>(parse_status);
-            m_on_complete_cb   = std::get<3>(parse_status);
+                if (std::get<4>(parse_status))
+                {
+                    // Streamed body: write the response with chunked transfer encoding, pulling one chunk at a
+                    // time from the supplier so large bodies never materialize fully in host memory
+                    return stream_response(request.keep_alive(),
+                                           std::get<0>(parse_status),
+                                           std::get<1>(parse_status),
+                                           std::move(std::get<4>(parse_status)));
+                }
+
+                m_response = std::make_unique<http::response<http::string_body>>();
+                m_response->result(std::get<0>(parse_status));
+                m_response->set(http::field::content_type, std::get<1>(parse_status));
+                m_response->body() = std::get<2>(parse_status);
+            }
         }
         else
         {
+            m_response = std::make_unique<http::response<http::string_body>>();
             m_response->result(http::status::not_found);
             m_response->set(http::field::content_type, "text/plain");
             m_response->body() = "not found";
@@ -188,6 +506,8 @@ class Session : public std::enable_shared_from_this<Session>
         m_parser.reset(nullptr);
         m_response.reset(nullptr);
 
+        ++m_requests_served;
+
         if (close)
         {
             return do_close();
@@ -196,6 +516,90 @@ class Session : public std::enable_shared_from_this<Session>
         do_read();
     }
 
+    void stream_response(bool keep_alive,
+                         unsigned status,
+                         const std::string& content_type,
+                         morpheus::chunk_supplier_fn_t&& chunk_supplier)
+    {
+        m_chunk_supplier = std::move(chunk_supplier);
+
+        m_streaming_response = std::make_unique<http::response<http::buffer_body>>();
+        m_streaming_response->result(status);
+        m_streaming_response->set(http::field::content_type, content_type);
+        m_streaming_response->keep_alive(keep_alive);
+        m_streaming_response->chunked(true);
+        m_streaming_response->body().data = nullptr;
+        m_streaming_response->body().more = true;
+
+        m_serializer = std::make_unique<http::response_serializer<http::buffer_body>>(*m_streaming_response);
+
+        http::async_write_header(
+            m_stream, *m_serializer, beast::bind_front_handler(&Session::on_header_write, shared_from_this()));
+    }
+
+    void on_header_write(beast::error_code ec, std::size_t bytes_transferred)
+    {
+        if (ec)
+        {
+            LOG(ERROR) << "Error writing response header: " << ec.message();
+            return finish_stream(ec);
+        }
+
+        do_write_chunk();
+    }
+
+    void do_write_chunk()
+    {
+        try
+        {
+            m_current_chunk = m_chunk_supplier();
+        } catch (const std::exception& e)
+        {
+            LOG(ERROR) << "Caught exception while producing response chunk: " << e.what();
+            m_current_chunk.clear();
+        }
+
+        const bool last_chunk = m_current_chunk.empty();
+
+        m_streaming_response->body().data = last_chunk ? nullptr : m_current_chunk.data();
+        m_streaming_response->body().size = m_current_chunk.size();
+        m_streaming_response->body().more = !last_chunk;
+
+        http::async_write(
+            m_stream,
+            *m_serializer,
+            beast::bind_front_handler(&Session::on_chunk_write, shared_from_this(), last_chunk));
+    }
+
+    void on_chunk_write(bool last_chunk, beast::error_code ec, std::size_t bytes_transferred)
+    {
+        if (ec == http::error::need_buffer)
+        {
+            // Not an error: the serializer consumed the chunk and wants the next one
+            return do_write_chunk();
+        }
+
+        if (ec)
+        {
+            LOG(ERROR) << "Error writing response chunk: " << ec.message();
+        }
+
+        finish_stream(ec);
+    }
+
+    void finish_stream(beast::error_code ec)
+    {
+        const bool close = m_streaming_response->need_eof();
+
+        m_chunk_supplier = nullptr;
+        m_current_chunk.clear();
+        m_serializer.reset(nullptr);
+        m_streaming_response.reset(nullptr);
+
+        // Hands off to the same completion path as buffered responses: on_complete callback, then keep-alive
+        on_write(close, ec, 0);
+    }
+
     void do_close()
     {
         beast::error_code ec;
@@ -214,6 +618,13 @@ class Session : public std::enable_shared_from_this<Session>
     std::unique_ptr<http::request_parser<http::string_body>> m_parser;
     std::unique_ptr<http::response<http::string_body>> m_response;
     morpheus::on_complete_cb_fn_t m_on_complete_cb;
+    std::size_t m_requests_served{0};
+
+    // Streamed-response state, only populated while writing a chunked response
+    morpheus::chunk_supplier_fn_t m_chunk_supplier;
+    std::string m_current_chunk;
+    std::unique_ptr<http::response<http::buffer_body>> m_streaming_response;
+    std::unique_ptr<http::response_serializer<http::buffer_body>> m_serializer;
 };
 
 }  // namespace
@@ -227,7 +638,8 @@ HttpServer::HttpServer(payload_parse_fn_t payload_parse_fn,
                        std::string method,
                        unsigned short num_threads,
                        std::size_t max_payload_size,
-                       std::chrono::seconds request_timeout) :
+                       std::chrono::seconds request_timeout,
+                       bool reuse_port) :
   m_payload_parse_fn(std::make_shared<payload_parse_fn_t>(std::move(payload_parse_fn))),
   m_bind_address(std::move(bind_address)),
   m_port(port),
@@ -236,8 +648,7 @@ HttpServer::HttpServer(payload_parse_fn_t payload_parse_fn,
   m_num_threads(num_threads),
   m_request_timeout(request_timeout),
   m_max_payload_size(max_payload_size),
-  m_io_context{m_num_threads},
-  m_listener{nullptr},
+  m_reuse_port{reuse_port},
   m_is_running{false}
 {
     if (m_method == http::verb::unknown)
@@ -266,19 +677,14 @@ void HttpServer::start_listener(std::binary_semaphore& listener_semaphore, std::
         << "start_listener must be called from the first thread in "
            "m_listener_threads";
 
-    m_listener = std::make_shared<Listener>(m_io_context,
-                                            m_payload_parse_fn,
-                                            m_bind_address,
-                                            m_port,
-                                            m_endpoint,
-                                            m_method,
-                                            m_max_payload_size,
-                                            m_request_timeout);
-    m_listener->run();
+    auto& ioc = *m_io_contexts.front();
+
+    m_listeners.emplace_back(std::make_shared<Listener>(
+        ioc, m_payload_parse_fn, m_bind_address, m_port, m_endpoint, m_method, m_max_payload_size, m_request_timeout));
+    m_listeners.front()->run();
 
     for (auto i = 1; i < m_num_threads; ++i)
     {
-        net::io_context& ioc = m_io_context;
         m_listener_threads.emplace_back([&ioc]() {
             ioc.run();
         });
@@ -286,7 +692,7 @@ void HttpServer::start_listener(std::binary_semaphore& listener_semaphore, std::
 
     m_is_running = true;
     started_semaphore.release();
-    m_io_context.run();
+    ioc.run();
 }
 
 void HttpServer::start()
@@ -299,6 +705,37 @@ void HttpServer::start()
                    << " threads";
         m_listener_threads.reserve(m_num_threads);
 
+        if (m_reuse_port)
+        {
+            // One single-threaded io_context and SO_REUSEPORT acceptor per worker, each pinned to a CPU; the
+            // kernel spreads incoming connections across the acceptors so the accept path scales with cores
+            for (unsigned short i = 0; i < m_num_threads; ++i)
+            {
+                auto& ioc = *m_io_contexts.emplace_back(std::make_unique<net::io_context>(1));
+
+                m_listeners.emplace_back(std::make_shared<Listener>(ioc,
+                                                                    m_payload_parse_fn,
+                                                                    m_bind_address,
+                                                                    m_port,
+                                                                    m_endpoint,
+                                                                    m_method,
+                                                                    m_max_payload_size,
+                                                                    m_request_timeout,
+                                                                    true));
+                m_listeners.back()->run();
+
+                m_listener_threads.emplace_back([&ioc, i]() {
+                    set_thread_affinity(i);
+                    ioc.run();
+                });
+            }
+
+            m_is_running = true;
+            return;
+        }
+
+        m_io_contexts.emplace_back(std::make_unique<net::io_context>(m_num_threads));
+
         std::binary_semaphore listener_semaphore{0};
         std::binary_semaphore started_semaphore{0};
         m_listener_threads.emplace_back(
@@ -314,10 +751,17 @@ void HttpServer::start()
 
 void HttpServer::stop()
 {
-    m_io_context.stop();
-    while (!m_io_context.stopped())
+    for (auto& ioc : m_io_contexts)
     {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        ioc->stop();
+    }
+
+    for (auto& ioc : m_io_contexts)
+    {
+        while (!ioc->stopped())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
     }
 
     for (auto& t : m_listener_threads)
@@ -327,13 +771,15 @@ void HttpServer::stop()
 
     m_listener_threads.clear();
 
-    if (m_listener)
+    // io contexts stopped, so we can stop the listeners
+    for (auto& listener : m_listeners)
     {
-        // io context stopped, so we can stop the listener
-        m_listener->stop();
-        m_listener.reset();
+        listener->stop();
     }
 
+    m_listeners.clear();
+    m_io_contexts.clear();
+
     m_is_running = false;
 }
 
@@ -370,7 +816,7 @@ std::shared_ptr<HttpServer> HttpServerInterfaceProxy::init(py::function py_parse
                                                            int64_t request_timeout)
 {
     auto wrapped_parse_fn               = PyFuncWrapper(std::move(py_parse_fn));
-    payload_parse_fn_t payload_parse_fn = [wrapped_parse_fn = std::move(wrapped_parse_fn)](const std::string& payload) {
+    payload_parse_fn_t payload_parse_fn = [wrapped_parse_fn = std::move(wrapped_parse_fn)](std::string&& payload) {
         py::gil_scoped_acquire gil;
         auto py_payload = py::str(payload);
         auto py_result  = wrapped_parse_fn.operator()<py::tuple, py::str>(py_payload);
@@ -397,7 +843,8 @@ std::shared_ptr<HttpServer> HttpServerInterfaceProxy::init(py::function py_parse
         return std::make_tuple(py::cast<unsigned>(py_result[0]),
                                py::cast<std::string>(py_result[1]),
                                py::cast<std::string>(py_result[2]),
-                               std::move(cb_fn));
+                               std::move(cb_fn),
+                               chunk_supplier_fn_t{nullptr});
     };
 
     return std::make_shared<HttpServer>(std::move(payload_parse_fn),
@@ -450,7 +897,8 @@ Listener::Listener(net::io_context& io_context,
                    const std::string& endpoint,
                    http::verb method,
                    std::size_t max_payload_size,
-                   std::chrono::seconds request_timeout) :
+                   std::chrono::seconds request_timeout,
+                   bool reuse_port) :
   m_io_context{io_context},
   m_tcp_endpoint{net::ip::make_address(bind_address), port},
   m_acceptor{std::make_unique<tcp::acceptor>(net::make_strand(m_io_context))},
@@ -463,6 +911,16 @@ Listener::Listener(net::io_context& io_context,
 {
     m_acceptor->open(m_tcp_endpoint.protocol());
     m_acceptor->set_option(net::socket_base::reuse_address(true));
+
+    if (reuse_port)
+    {
+#ifdef SO_REUSEPORT
+        m_acceptor->set_option(net::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>(true));
+#else
+        throw std::runtime_error("SO_REUSEPORT is not supported on this platform");
+#endif
+    }
+
     m_acceptor->bind(m_tcp_endpoint);
     m_acceptor->listen(net::socket_base::max_listen_connections);
 }
@@ -501,6 +959,14 @@ void Listener::on_accept(beast::error_code ec, tcp::socket socket)
     }
     else
     {
+        // Collector POSTs are small writes on persistent connections, Nagle only adds delayed-ACK stalls
+        beast::error_code option_ec;
+        socket.set_option(tcp::no_delay(true), option_ec);
+        if (option_ec)
+        {
+            LOG(WARNING) << "Failed to set TCP_NODELAY: " << option_ec.message();
+        }
+
         std::make_shared<Session>(
             std::move(socket), m_payload_parse_fn, m_url_endpoint, m_method, m_max_payload_size, m_request_timeout)
             ->run();
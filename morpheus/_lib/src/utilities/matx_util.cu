@@ -18,11 +18,20 @@
 #include "morpheus/types.hpp"  // For TensorIndex, TensorSize
 #include "morpheus/utilities/matx_util.hpp"
 
+#include "morpheus/utilities/nvtx.hpp"  // for MORPHEUS_NVTX_RANGE
+
 #include <boost/numeric/conversion/cast.hpp>  // for numeric_cast
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <matx.h>
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
 #include <mrc/cuda/sync.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 
 #include <array>
 #include <cstddef>  // for size_t
@@ -74,6 +83,50 @@ struct MatxUtil__MatxCast
     }
 };
 
+// ************ MatxUtil__MatxPackColumn**************//
+/**
+ * @brief Casts a 1D input and writes it as one column of a row-major 2D output in a single pass. Replaces the
+ * cast-copy-transpose sequence previously used to pack cudf feature columns into an inference input tensor.
+ */
+struct MatxUtil__MatxPackColumn
+{
+    TensorIndex element_count;
+    TensorIndex num_cols;
+    TensorIndex col_idx;
+    rmm::cuda_stream_view stream;
+
+    /**
+     * TODO(Documentation)
+     */
+    template <typename InputT,
+              typename OutputT,
+              std::enable_if_t<!cudf::is_numeric<InputT>() || !cudf::is_numeric<OutputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data)
+    {
+        throw std::invalid_argument("Unsupported conversion");
+    }
+
+    /**
+     * TODO(Documentation)
+     */
+    template <typename InputT,
+              typename OutputT,
+              std::enable_if_t<cudf::is_numeric<InputT>() && cudf::is_numeric<OutputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data)
+    {
+        tensorShape_1d shape({element_count});
+
+        // View the output column as a strided 1D tensor starting at col_idx
+        matx::DefaultDescriptor<1> output_desc{{element_count}, {num_cols}};
+
+        auto input_tensor  = matx::make_tensor<InputT>(static_cast<InputT*>(input_data), shape);
+        auto output_tensor = matx::make_tensor<OutputT, matx::DefaultDescriptor<1>>(
+            static_cast<OutputT*>(output_data) + col_idx, std::move(output_desc));
+
+        (output_tensor = input_tensor).run(stream.value());
+    }
+};
+
 // ************ MatxUtil__MatxCreateSegIds**************//
 /**
  * TODO(Documentation)
@@ -149,6 +202,39 @@ struct MatxUtil__MatxOffsetSegIds
     }
 };
 
+// ************ MatxUtil__MatxGatherRows**************//
+/**
+ * @brief Gathers rows of a 2D input into the row order given by an index vector. Indices may repeat, which is used
+ * to expand deduplicated rows back to their original order.
+ */
+struct MatxUtil__MatxGatherRows
+{
+    TensorIndex input_rows;
+    TensorIndex output_rows;
+    TensorIndex cols;
+    rmm::cuda_stream_view stream;
+
+    template <typename InputT, std::enable_if_t<!cudf::is_numeric<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* indices_data, void* output_data)
+    {
+        throw std::invalid_argument("Unsupported conversion");
+    }
+
+    template <typename InputT, std::enable_if_t<cudf::is_numeric<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* indices_data, void* output_data)
+    {
+        tensorShape_2d input_shape({input_rows, cols});
+        tensorShape_1d indices_shape({output_rows});
+        tensorShape_2d output_shape({output_rows, cols});
+
+        auto input_tensor   = matx::make_tensor<InputT>(static_cast<InputT*>(input_data), input_shape);
+        auto indices_tensor = matx::make_tensor<TensorIndex>(static_cast<TensorIndex*>(indices_data), indices_shape);
+        auto output_tensor  = matx::make_tensor<InputT>(static_cast<InputT*>(output_data), output_shape);
+
+        (output_tensor = matx::remap<0>(input_tensor, indices_tensor)).run(stream.value());
+    }
+};
+
 // ************ MatxUtil__MatxLogits**************//
 /**
  * TODO(Documentation)
@@ -183,6 +269,38 @@ struct MatxUtil__MatxLogits
     }
 };
 
+// ************ MatxUtil__MatxSoftmax**************//
+/**
+ * Row-wise softmax over a 2D tensor, a single fused expression with no intermediate buffers.
+ */
+struct MatxUtil__MatxSoftmax
+{
+    TensorIndex rows;
+    TensorIndex cols;
+    rmm::cuda_stream_view stream;
+
+    template <typename InputT, std::enable_if_t<!cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data, const ShapeType& stride)
+    {
+        throw std::invalid_argument("Unsupported conversion");
+    }
+
+    template <typename InputT, std::enable_if_t<cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data, const ShapeType& stride)
+    {
+        matx::DefaultDescriptor<2> input_desc{{rows, cols}, {stride[0], stride[1]}};
+
+        // Input & Output have the same shape & stride. The make_tensor API requires a move for the descriptor
+        // so we need to take a copy of it here.
+        matx::DefaultDescriptor<2> output_desc = input_desc;
+
+        auto input_tensor  = matx::make_tensor<InputT>(static_cast<InputT*>(input_data), std::move(input_desc));
+        auto output_tensor = matx::make_tensor<InputT>(static_cast<InputT*>(output_data), std::move(output_desc));
+
+        (output_tensor = matx::softmax(input_tensor, {1})).run(stream.value());
+    }
+};
+
 // ************ MatxUtil__MatxTranspose**************//
 /**
  * TODO(Documentation)
@@ -295,6 +413,148 @@ struct MatxUtil__MatxThreshold
     }
 };
 
+// ************ MatxUtil__MatxLogitsThreshold**************//
+/**
+ * Applies the sigmoid and the threshold comparison in one expression, avoiding the intermediate logits buffer and
+ * the second read/write pass that running MatxUtil__MatxLogits and MatxUtil__MatxThreshold separately would cost.
+ */
+struct MatxUtil__MatxLogitsThreshold
+{
+    TensorIndex rows;
+    TensorIndex cols;
+    bool by_row;
+    rmm::cuda_stream_view stream;
+
+    template <typename InputT, std::enable_if_t<!cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* mask_data, void* scores_data, double threshold, const ShapeType& stride)
+    {
+        throw std::invalid_argument("Unsupported conversion");
+    }
+
+    template <typename InputT, std::enable_if_t<cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* mask_data, void* scores_data, double threshold, const ShapeType& stride)
+    {
+        matx::DefaultDescriptor<2> input_desc{{rows, cols}, {stride[0], stride[1]}};
+
+        auto input_tensor = matx::make_tensor<InputT>(static_cast<InputT*>(input_data), std::move(input_desc));
+
+        auto sigmoid = (InputT)1 / ((InputT)1 + matx::exp((InputT)-1 * input_tensor));
+
+        if (scores_data != nullptr)
+        {
+            // Scores share the input's layout, same as MatxUtil__MatxLogits
+            matx::DefaultDescriptor<2> scores_desc{{rows, cols}, {stride[0], stride[1]}};
+
+            auto scores_tensor = matx::make_tensor<InputT>(static_cast<InputT*>(scores_data), std::move(scores_desc));
+
+            (scores_tensor = sigmoid).run(stream.value());
+        }
+
+        if (by_row)
+        {
+            // Output is always 1 column
+            tensorShape_1d output_shape({rows});
+
+            auto mask_tensor = matx::make_tensor<bool>(static_cast<bool*>(mask_data), output_shape);
+
+            (mask_tensor = matx::rmax(sigmoid, {1}) > (InputT)threshold).run(stream.value());
+        }
+        else
+        {
+            matx::DefaultDescriptor<2> mask_desc{{rows, cols}, {stride[0], stride[1]}};
+
+            auto mask_tensor = matx::make_tensor<bool>(static_cast<bool*>(mask_data), std::move(mask_desc));
+
+            (mask_tensor = sigmoid > (InputT)threshold).run(stream.value());
+        }
+    }
+};
+
+// ************ MatxUtil__MatxElementwiseChain**************//
+/**
+ * Materializes an `ElementwiseChain` in one expression: pre-affine, optional sigmoid, post-affine, then either a
+ * typed store or the threshold comparison. Every combination runs as a single generated kernel with no intermediate
+ * buffer.
+ */
+struct MatxUtil__MatxElementwiseChain
+{
+    TensorIndex rows;
+    TensorIndex cols;
+    double pre_scale;
+    double pre_offset;
+    bool sigmoid;
+    double post_scale;
+    double post_offset;
+    bool has_threshold;
+    double threshold;
+    bool by_row;
+    rmm::cuda_stream_view stream;
+
+    template <typename InputT,
+              typename OutputT,
+              std::enable_if_t<!cudf::is_floating_point<InputT>() || !cudf::is_numeric<OutputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data, const ShapeType& stride)
+    {
+        throw std::invalid_argument("Unsupported conversion");
+    }
+
+    template <typename InputT,
+              typename OutputT,
+              std::enable_if_t<cudf::is_floating_point<InputT>() && cudf::is_numeric<OutputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data, const ShapeType& stride)
+    {
+        matx::DefaultDescriptor<2> input_desc{{rows, cols}, {stride[0], stride[1]}};
+
+        auto input_tensor = matx::make_tensor<InputT>(static_cast<InputT*>(input_data), std::move(input_desc));
+
+        auto pre = (InputT)pre_scale * input_tensor + (InputT)pre_offset;
+
+        if (sigmoid)
+        {
+            this->store<InputT, OutputT>((InputT)1 / ((InputT)1 + matx::exp((InputT)-1 * pre)), output_data);
+        }
+        else
+        {
+            this->store<InputT, OutputT>(pre, output_data);
+        }
+    }
+
+  private:
+    template <typename InputT, typename OutputT, typename ExprT>
+    void store(ExprT expr, void* output_data)
+    {
+        auto adjusted = (InputT)post_scale * expr + (InputT)post_offset;
+
+        if (has_threshold)
+        {
+            if (by_row)
+            {
+                tensorShape_1d output_shape({rows});
+
+                auto output_tensor = matx::make_tensor<bool>(static_cast<bool*>(output_data), output_shape);
+
+                (output_tensor = matx::rmax(adjusted, {1}) > (InputT)threshold).run(stream.value());
+            }
+            else
+            {
+                tensorShape_2d output_shape({rows, cols});
+
+                auto output_tensor = matx::make_tensor<bool>(static_cast<bool*>(output_data), output_shape);
+
+                (output_tensor = adjusted > (InputT)threshold).run(stream.value());
+            }
+        }
+        else
+        {
+            tensorShape_2d output_shape({rows, cols});
+
+            auto output_tensor = matx::make_tensor<OutputT>(static_cast<OutputT*>(output_data), output_shape);
+
+            (output_tensor = adjusted).run(stream.value());
+        }
+    }
+};
+
 struct MatxUtil__MatxReduceMax
 {
     matx::index_t num_input_rows;
@@ -363,96 +623,934 @@ struct MatxUtil__MatxReduceMax
         (output_slice = matx::rmax(input_slice.Permute({1, 0}))).run(stream.value());
     }
 };
-}  // namespace
-
-namespace morpheus {
-// Component public implementations
-// ************ MatxUtil************************* //
-std::shared_ptr<rmm::device_buffer> MatxUtil::cast(const DevMemInfo& input, TypeId output_type)
+// ************ MatxUtil__SlidingWindowReduce ************** //
+/**
+ * Computes every sliding window in one pass: each block covers a tile of rows in one column, stages the tile
+ * plus the `window - 1` halo rows before it in shared memory, and each thread reduces its window from the tile.
+ * Every input element is read from global memory once per block instead of once per window it appears in. When
+ * the halo would not fit in shared memory (`tiled == false`) the windows are reduced from global memory
+ * directly, which still fuses the launches even though the rereads remain.
+ */
+template <typename InputT>
+__global__ void sliding_window_reduce_kernel(const InputT* input,
+                                             InputT* output,
+                                             TensorIndex num_rows,
+                                             TensorIndex stride0,
+                                             TensorIndex stride1,
+                                             TensorIndex out_stride0,
+                                             TensorIndex out_stride1,
+                                             const TensorIndex* segment_offsets,
+                                             TensorIndex num_segments,
+                                             TensorIndex window,
+                                             WindowReduceOp op,
+                                             bool tiled)
 {
-    auto output_dtype = DType(output_type);
+    extern __shared__ char smem_raw[];
+    auto* tile = reinterpret_cast<InputT*>(smem_raw);
 
-    // Create the output
-    auto output = input.make_new_buffer(output_dtype.item_size() * input.count());
+    const auto col        = static_cast<TensorIndex>(blockIdx.y);
+    const auto tile_start = static_cast<TensorIndex>(blockIdx.x) * static_cast<TensorIndex>(blockDim.x);
+    const auto halo       = window - 1;
+    const auto load_start = tile_start - halo;
 
-    cudf::double_type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
-                                 cudf::data_type{output_dtype.cudf_type_id()},
-                                 MatxUtil__MatxCast{boost::numeric_cast<TensorIndex>(input.count()), output->stream()},
-                                 input.data(),
-                                 output->data());
+    if (tiled)
+    {
+        const auto load_count = static_cast<TensorIndex>(blockDim.x) + halo;
 
-    mrc::enqueue_stream_sync_event(output->stream()).get();
+        for (auto i = static_cast<TensorIndex>(threadIdx.x); i < load_count;
+             i += static_cast<TensorIndex>(blockDim.x))
+        {
+            const auto row = load_start + i;
 
-    return output;
-}
+            tile[i] = (row >= 0 && row < num_rows) ? input[row * stride0 + col * stride1] : InputT{};
+        }
 
-std::shared_ptr<rmm::device_buffer> MatxUtil::create_seq_ids(TensorIndex row_count,
-                                                             TensorIndex fea_len,
-                                                             TypeId output_type,
-                                                             std::shared_ptr<MemoryDescriptor> md,
-                                                             TensorIndex start_idx)
-{
-    auto output_dtype = DType(output_type);
+        __syncthreads();
+    }
 
-    // Now create the output
-    auto output = std::make_shared<rmm::device_buffer>(
-        output_dtype.item_size() * row_count * 3, md->cuda_stream, md->memory_resource);
+    const auto row = tile_start + static_cast<TensorIndex>(threadIdx.x);
 
-    cudf::type_dispatcher(cudf::data_type{output_dtype.cudf_type_id()},
-                          MatxUtil__MatxCreateSegIds{start_idx, row_count, fea_len, output->stream()},
-                          output->data());
+    if (row >= num_rows)
+    {
+        return;
+    }
 
-    return output;
-}
+    // Locate the row's segment: the largest boundary at or below the row
+    TensorIndex lo = 0;
+    TensorIndex hi = num_segments - 1;
 
-void MatxUtil::offset_seq_ids(const DevMemInfo& input, TensorIndex offset)
-{
-    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
-                          MatxUtil__MatxOffsetSegIds{offset, input.shape(0), rmm::cuda_stream_per_thread},
-                          input.data());
+    while (lo < hi)
+    {
+        const auto mid = (lo + hi + 1) / 2;
 
-    mrc::enqueue_stream_sync_event(rmm::cuda_stream_per_thread).get();
-}
+        if (segment_offsets[mid] <= row)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
 
-std::shared_ptr<rmm::device_buffer> MatxUtil::logits(const DevMemInfo& input)
-{
-    // Create the output
-    auto output = input.make_new_buffer(input.bytes());
+    const auto seg_start = segment_offsets[lo];
+    const auto win_start = seg_start > row - halo ? seg_start : row - halo;
 
-    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
-                          MatxUtil__MatxLogits{boost::numeric_cast<TensorIndex>(input.count()), output->stream()},
-                          input.data(),
-                          output->data());
+    auto load = [&](TensorIndex r) {
+        return tiled ? tile[r - load_start] : input[r * stride0 + col * stride1];
+    };
 
-    return output;
-}
+    auto acc = load(win_start);
 
-std::shared_ptr<rmm::device_buffer> MatxUtil::transpose(const DevMemInfo& input)
-{
-    // Now create the output
-    auto output = input.make_new_buffer(input.bytes());
+    for (auto r = win_start + 1; r <= row; ++r)
+    {
+        const auto value = load(r);
 
-    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
-                          MatxUtil__MatxTranspose{output->stream(), input.shape(0), input.shape(1)},
-                          input.data(),
-                          output->data());
+        acc = (op == WindowReduceOp::MAX) ? (acc < value ? value : acc) : acc + value;
+    }
 
-    return output;
+    if (op == WindowReduceOp::MEAN)
+    {
+        acc /= static_cast<InputT>(row - win_start + 1);
+    }
+
+    output[row * out_stride0 + col * out_stride1] = acc;
 }
 
-std::shared_ptr<rmm::device_buffer> MatxUtil::threshold(const DevMemInfo& input, double thresh_val, bool by_row)
+/**
+ * Host-side dispatch for the sliding window reduction, floating point only like the segmented max above.
+ */
+struct MatxUtil__SlidingWindowReduce
 {
-    const auto rows        = input.shape(0);
-    const auto cols        = input.shape(1);
-    TensorSize output_size = sizeof(bool) * rows;
-    if (!by_row)
+    TensorIndex num_rows;
+    TensorIndex num_cols;
+    std::vector<TensorIndex> input_stride;
+    const TensorIndex* segment_offsets;  // device pointer
+    TensorIndex num_segments;
+    TensorIndex window;
+    WindowReduceOp op;
+    rmm::cuda_stream_view stream;
+
+    template <typename InputT, std::enable_if_t<!cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data)
     {
-        output_size *= cols;
+        throw std::invalid_argument("Unsupported conversion");
     }
 
-    // Now create the output array of bools
-    auto output = input.make_new_buffer(output_size);
-
+    template <typename InputT, std::enable_if_t<cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data)
+    {
+        constexpr uint32_t BlockSize     = 128;
+        constexpr std::size_t MaxSmemTile = 48 * 1024;
+
+        // The output is freshly allocated and dense, in the same major order as the input
+        TensorIndex out_stride[2] = {input_stride[0], input_stride[1]};
+        if (out_stride[0] == 1)
+        {
+            out_stride[1] = num_rows;
+        }
+        else
+        {
+            out_stride[0] = num_cols;
+        }
+
+        const auto tile_bytes = (BlockSize + window - 1) * sizeof(InputT);
+        const auto tiled      = tile_bytes <= MaxSmemTile;
+
+        const dim3 grid((num_rows + BlockSize - 1) / BlockSize, num_cols);
+
+        sliding_window_reduce_kernel<InputT>
+            <<<grid, BlockSize, tiled ? tile_bytes : 0, stream.value()>>>(static_cast<const InputT*>(input_data),
+                                                                          static_cast<InputT*>(output_data),
+                                                                          num_rows,
+                                                                          input_stride[0],
+                                                                          input_stride[1],
+                                                                          out_stride[0],
+                                                                          out_stride[1],
+                                                                          segment_offsets,
+                                                                          num_segments,
+                                                                          window,
+                                                                          op,
+                                                                          tiled);
+
+        MRC_CHECK_CUDA(cudaPeekAtLastError());
+    }
+};
+// ************ MatxUtil__MeanPoolNormalize ************** //
+/**
+ * Fused mean-pool + L2-normalize, one block per pooled output row. Each thread mean-pools a strided subset of
+ * the columns, writing the pooled value while accumulating its square; the block then reduces the per-thread
+ * partials into the row norm and the same threads rescale their columns, so the un-normalized intermediate
+ * never round-trips through global memory.
+ */
+template <typename InputT>
+__global__ void mean_pool_normalize_kernel(const InputT* input,
+                                           InputT* output,
+                                           TensorIndex num_cols,
+                                           TensorIndex stride0,
+                                           TensorIndex stride1,
+                                           TensorIndex pool_size)
+{
+    extern __shared__ unsigned char pool_smem[];
+    auto* partial = reinterpret_cast<InputT*>(pool_smem);
+
+    const auto out_row   = static_cast<TensorIndex>(blockIdx.x);
+    const auto first_row = out_row * pool_size;
+
+    InputT sum_sq = InputT(0.0);
+
+    for (TensorIndex col = threadIdx.x; col < num_cols; col += blockDim.x)
+    {
+        InputT sum = InputT(0.0);
+
+        for (TensorIndex r = 0; r < pool_size; ++r)
+        {
+            sum += input[(first_row + r) * stride0 + col * stride1];
+        }
+
+        const auto pooled = sum / static_cast<InputT>(pool_size);
+
+        output[out_row * num_cols + col] = pooled;
+        sum_sq += pooled * pooled;
+    }
+
+    partial[threadIdx.x] = sum_sq;
+    __syncthreads();
+
+    for (unsigned int offset = blockDim.x / 2; offset > 0; offset /= 2)
+    {
+        if (threadIdx.x < offset)
+        {
+            partial[threadIdx.x] += partial[threadIdx.x + offset];
+        }
+        __syncthreads();
+    }
+
+    // All-zero rows pass through unscaled rather than dividing by a zero norm
+    const InputT norm  = sqrt(partial[0]);
+    const InputT scale = norm > InputT(0.0) ? InputT(1.0) / norm : InputT(1.0);
+
+    for (TensorIndex col = threadIdx.x; col < num_cols; col += blockDim.x)
+    {
+        output[out_row * num_cols + col] *= scale;
+    }
+}
+
+/**
+ * Host-side dispatch for the fused pooling, floating point only like the other reductions here.
+ */
+struct MatxUtil__MeanPoolNormalize
+{
+    TensorIndex num_pooled_rows;
+    TensorIndex num_cols;
+    std::vector<TensorIndex> input_stride;
+    TensorIndex pool_size;
+    rmm::cuda_stream_view stream;
+
+    template <typename InputT, std::enable_if_t<!cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data)
+    {
+        throw std::invalid_argument("Unsupported conversion");
+    }
+
+    template <typename InputT, std::enable_if_t<cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* output_data)
+    {
+        constexpr uint32_t BlockSize = 256;
+
+        mean_pool_normalize_kernel<InputT><<<num_pooled_rows, BlockSize, BlockSize * sizeof(InputT), stream.value()>>>(
+            static_cast<const InputT*>(input_data),
+            static_cast<InputT*>(output_data),
+            num_cols,
+            input_stride[0],
+            input_stride[1],
+            pool_size);
+
+        MRC_CHECK_CUDA(cudaPeekAtLastError());
+    }
+};
+// ************ MatxUtil__ThresholdScatter ************** //
+/**
+ * Device-side body of the fused threshold-and-scatter: each work item thresholds one (row, label) pair and
+ * writes the boolean straight into that label's destination column.
+ */
+template <typename InputT>
+struct MatxUtil__ThresholdScatterOp
+{
+    const InputT* input;
+    InputT threshold;
+    const TensorIndex* col_indices;
+    bool* const* outputs;
+    TensorIndex num_labels;
+    TensorIndex row_stride;
+    TensorIndex col_stride;
+
+    __device__ void operator()(TensorSize flat_idx) const
+    {
+        const auto row   = static_cast<TensorIndex>(flat_idx / num_labels);
+        const auto label = static_cast<TensorIndex>(flat_idx % num_labels);
+
+        outputs[label][row] = input[row * row_stride + col_indices[label] * col_stride] > threshold;
+    }
+};
+
+/**
+ * Type dispatch wrapper launching MatxUtil__ThresholdScatterOp over rows * labels work items.
+ */
+struct MatxUtil__MatxThresholdScatter
+{
+    TensorIndex rows;
+    TensorIndex num_labels;
+    rmm::cuda_stream_view stream;
+
+    template <typename InputT, std::enable_if_t<!cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data,
+                    double threshold,
+                    const TensorIndex* col_indices,
+                    bool* const* outputs,
+                    const ShapeType& stride)
+    {
+        throw std::invalid_argument("Unsupported conversion");
+    }
+
+    template <typename InputT, std::enable_if_t<cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data,
+                    double threshold,
+                    const TensorIndex* col_indices,
+                    bool* const* outputs,
+                    const ShapeType& stride)
+    {
+        auto op = MatxUtil__ThresholdScatterOp<InputT>{static_cast<const InputT*>(input_data),
+                                                       static_cast<InputT>(threshold),
+                                                       col_indices,
+                                                       outputs,
+                                                       num_labels,
+                                                       stride[0],
+                                                       stride[1]};
+
+        thrust::for_each_n(rmm::exec_policy(stream),
+                           thrust::counting_iterator<TensorSize>(0),
+                           static_cast<TensorSize>(rows) * num_labels,
+                           op);
+    }
+};
+
+// ************ MatxUtil__ScatterColumns ************** //
+/**
+ * Device-side body of the column scatter: each work item copies one (row, label) element into that label's
+ * destination column.
+ */
+template <typename InputT>
+struct MatxUtil__ScatterColumnsOp
+{
+    const InputT* input;
+    const TensorIndex* col_indices;
+    InputT* const* outputs;
+    TensorIndex num_labels;
+    TensorIndex row_stride;
+    TensorIndex col_stride;
+
+    __device__ void operator()(TensorSize flat_idx) const
+    {
+        const auto row   = static_cast<TensorIndex>(flat_idx / num_labels);
+        const auto label = static_cast<TensorIndex>(flat_idx % num_labels);
+
+        outputs[label][row] = input[row * row_stride + col_indices[label] * col_stride];
+    }
+};
+
+/**
+ * Type dispatch wrapper launching MatxUtil__ScatterColumnsOp over rows * labels work items.
+ */
+struct MatxUtil__MatxScatterColumns
+{
+    TensorIndex rows;
+    TensorIndex num_labels;
+    rmm::cuda_stream_view stream;
+
+    template <typename InputT, std::enable_if_t<!cudf::is_numeric<InputT>()>* = nullptr>
+    void operator()(void* input_data, const TensorIndex* col_indices, void* const* outputs, const ShapeType& stride)
+    {
+        throw std::invalid_argument("Unsupported conversion");
+    }
+
+    template <typename InputT, std::enable_if_t<cudf::is_numeric<InputT>()>* = nullptr>
+    void operator()(void* input_data, const TensorIndex* col_indices, void* const* outputs, const ShapeType& stride)
+    {
+        auto op = MatxUtil__ScatterColumnsOp<InputT>{static_cast<const InputT*>(input_data),
+                                                     col_indices,
+                                                     reinterpret_cast<InputT* const*>(outputs),
+                                                     num_labels,
+                                                     stride[0],
+                                                     stride[1]};
+
+        thrust::for_each_n(rmm::exec_policy(stream),
+                           thrust::counting_iterator<TensorSize>(0),
+                           static_cast<TensorSize>(rows) * num_labels,
+                           op);
+    }
+};
+
+// ************ MatxUtil__RowArgmax ************** //
+/**
+ * Device-side body of the row argmax: each work item scans one row and writes the winning value and column.
+ * Model outputs have at most a few dozen classes, so a sequential scan per row beats a two-pass reduction.
+ */
+template <typename InputT>
+struct MatxUtil__RowArgmaxOp
+{
+    const InputT* input;
+    InputT* max_values;
+    int64_t* max_indices;
+    TensorIndex cols;
+    TensorIndex row_stride;
+    TensorIndex col_stride;
+
+    __device__ void operator()(TensorIndex row) const
+    {
+        const auto* row_data = input + row * row_stride;
+
+        InputT best_value    = row_data[0];
+        TensorIndex best_col = 0;
+
+        for (TensorIndex col = 1; col < cols; ++col)
+        {
+            const auto value = row_data[col * col_stride];
+            if (value > best_value)
+            {
+                best_value = value;
+                best_col   = col;
+            }
+        }
+
+        max_values[row]  = best_value;
+        max_indices[row] = best_col;
+    }
+};
+
+/**
+ * Type dispatch wrapper launching MatxUtil__RowArgmaxOp over the input's rows.
+ */
+struct MatxUtil__MatxRowArgmax
+{
+    TensorIndex rows;
+    TensorIndex cols;
+    rmm::cuda_stream_view stream;
+
+    template <typename InputT, std::enable_if_t<!cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* max_values, void* max_indices, const ShapeType& stride)
+    {
+        throw std::invalid_argument("Unsupported conversion");
+    }
+
+    template <typename InputT, std::enable_if_t<cudf::is_floating_point<InputT>()>* = nullptr>
+    void operator()(void* input_data, void* max_values, void* max_indices, const ShapeType& stride)
+    {
+        auto op = MatxUtil__RowArgmaxOp<InputT>{static_cast<const InputT*>(input_data),
+                                                static_cast<InputT*>(max_values),
+                                                static_cast<int64_t*>(max_indices),
+                                                cols,
+                                                stride[0],
+                                                stride[1]};
+
+        thrust::for_each_n(rmm::exec_policy(stream), thrust::counting_iterator<TensorIndex>(0), rows, op);
+    }
+};
+
+// ************ MatxUtil__RangeBounds ************** //
+/**
+ * Predicates marking the first and last row of each contiguous run of true values in a row mask; used to
+ * run-length encode the mask into ranges on the device.
+ */
+struct MatxUtil__RangeStart
+{
+    const bool* mask;
+
+    __device__ bool operator()(TensorIndex idx) const
+    {
+        return mask[idx] && (idx == 0 || !mask[idx - 1]);
+    }
+};
+
+struct MatxUtil__RangeStop
+{
+    const bool* mask;
+    TensorIndex num_rows;
+
+    __device__ bool operator()(TensorIndex idx) const
+    {
+        return mask[idx] && (idx == num_rows - 1 || !mask[idx + 1]);
+    }
+};
+
+}  // namespace
+
+namespace morpheus {
+// Component public implementations
+// ************ MatxUtil************************* //
+/****** ElementwiseChain ***********************************/
+ElementwiseChain& ElementwiseChain::cast(TypeId output_type)
+{
+    m_output_type = output_type;
+
+    return *this;
+}
+
+ElementwiseChain& ElementwiseChain::scale(double factor)
+{
+    if (m_sigmoid)
+    {
+        m_post_scale *= factor;
+        m_post_offset *= factor;
+    }
+    else
+    {
+        m_pre_scale *= factor;
+        m_pre_offset *= factor;
+    }
+
+    return *this;
+}
+
+ElementwiseChain& ElementwiseChain::add(double addend)
+{
+    if (m_sigmoid)
+    {
+        m_post_offset += addend;
+    }
+    else
+    {
+        m_pre_offset += addend;
+    }
+
+    return *this;
+}
+
+ElementwiseChain& ElementwiseChain::sigmoid()
+{
+    CHECK(!m_sigmoid) << "sigmoid may appear at most once in a chain";
+
+    m_sigmoid = true;
+
+    return *this;
+}
+
+ElementwiseChain& ElementwiseChain::threshold(double thresh_val, bool by_row)
+{
+    m_has_threshold = true;
+    m_threshold     = thresh_val;
+    m_by_row        = by_row;
+
+    return *this;
+}
+
+std::shared_ptr<rmm::device_buffer> ElementwiseChain::run_async(const DevMemInfo& input) const
+{
+    DCHECK(input.shape().size() == 2) << "ElementwiseChain requires a 2D input";
+
+    const auto rows = input.shape(0);
+    const auto cols = input.shape(1);
+
+    auto output_dtype = DType(m_output_type == TypeId::EMPTY ? input.dtype().type_id() : m_output_type);
+
+    TensorSize output_size{};
+    if (m_has_threshold)
+    {
+        output_dtype = DType::create<bool>();
+        output_size  = sizeof(bool) * rows;
+        if (!m_by_row)
+        {
+            output_size *= cols;
+        }
+    }
+    else
+    {
+        output_size = output_dtype.item_size() * input.count();
+    }
+
+    auto output = input.make_new_buffer(output_size);
+
+    cudf::double_type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                                 cudf::data_type{output_dtype.cudf_type_id()},
+                                 MatxUtil__MatxElementwiseChain{rows,
+                                                                cols,
+                                                                m_pre_scale,
+                                                                m_pre_offset,
+                                                                m_sigmoid,
+                                                                m_post_scale,
+                                                                m_post_offset,
+                                                                m_has_threshold,
+                                                                m_threshold,
+                                                                m_by_row,
+                                                                output->stream()},
+                                 input.data(),
+                                 output->data(),
+                                 input.stride());
+
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> ElementwiseChain::run(const DevMemInfo& input) const
+{
+    auto output = this->run_async(input);
+
+    mrc::enqueue_stream_sync_event(output->stream()).get();
+
+    return output;
+}
+
+/****** MatxUtil *******************************************/
+std::shared_ptr<rmm::device_buffer> MatxUtil::cast(const DevMemInfo& input, TypeId output_type)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::cast");
+
+    auto output = cast_async(input, output_type);
+
+    mrc::enqueue_stream_sync_event(output->stream()).get();
+
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::cast_async(const DevMemInfo& input, TypeId output_type)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::cast_async");
+
+    auto output_dtype = DType(output_type);
+
+    // Create the output
+    auto output = input.make_new_buffer(output_dtype.item_size() * input.count());
+
+    cudf::double_type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                                 cudf::data_type{output_dtype.cudf_type_id()},
+                                 MatxUtil__MatxCast{boost::numeric_cast<TensorIndex>(input.count()), output->stream()},
+                                 input.data(),
+                                 output->data());
+
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::cast_fp32_to_fp16(const DevMemInfo& input)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::cast_fp32_to_fp16");
+
+    DCHECK(input.dtype().type_id() == TypeId::FLOAT32) << "cast_fp32_to_fp16 requires a FLOAT32 input";
+
+    auto element_count = boost::numeric_cast<TensorIndex>(input.count());
+
+    auto output = input.make_new_buffer(element_count * sizeof(matx::matxFp16));
+
+    tensorShape_1d shape({element_count});
+
+    auto input_tensor  = matx::make_tensor<float>(static_cast<float*>(input.data()), shape);
+    auto output_tensor = matx::make_tensor<matx::matxFp16>(static_cast<matx::matxFp16*>(output->data()), shape);
+
+    (output_tensor = matx::as_type<matx::matxFp16>(input_tensor)).run(output->stream());
+
+    mrc::enqueue_stream_sync_event(output->stream()).get();
+
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::cast_fp16_to_fp32(const DevMemInfo& input)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::cast_fp16_to_fp32");
+
+    DCHECK(input.dtype().type_id() == TypeId::FLOAT16) << "cast_fp16_to_fp32 requires a FLOAT16 input";
+
+    auto element_count = boost::numeric_cast<TensorIndex>(input.count());
+
+    auto output = input.make_new_buffer(element_count * sizeof(float));
+
+    tensorShape_1d shape({element_count});
+
+    auto input_tensor  = matx::make_tensor<matx::matxFp16>(static_cast<matx::matxFp16*>(input.data()), shape);
+    auto output_tensor = matx::make_tensor<float>(static_cast<float*>(output->data()), shape);
+
+    (output_tensor = matx::as_type<float>(input_tensor)).run(output->stream());
+
+    mrc::enqueue_stream_sync_event(output->stream()).get();
+
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::create_seq_ids(TensorIndex row_count,
+                                                             TensorIndex fea_len,
+                                                             TypeId output_type,
+                                                             std::shared_ptr<MemoryDescriptor> md,
+                                                             TensorIndex start_idx)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::create_seq_ids");
+
+    auto output_dtype = DType(output_type);
+
+    // Now create the output
+    auto output = std::make_shared<rmm::device_buffer>(
+        output_dtype.item_size() * row_count * 3, md->cuda_stream, md->memory_resource);
+
+    cudf::type_dispatcher(cudf::data_type{output_dtype.cudf_type_id()},
+                          MatxUtil__MatxCreateSegIds{start_idx, row_count, fea_len, output->stream()},
+                          output->data());
+
+    return output;
+}
+
+void MatxUtil::pack_column_async(const DevMemInfo& input, const DevMemInfo& output, TensorIndex col_idx)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::pack_column_async");
+
+    cudf::double_type_dispatcher(
+        cudf::data_type{input.dtype().cudf_type_id()},
+        cudf::data_type{output.dtype().cudf_type_id()},
+        MatxUtil__MatxPackColumn{output.shape(0), output.shape(1), col_idx, output.memory()->cuda_stream},
+        input.data(),
+        output.data());
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::gather_rows_async(const DevMemInfo& input, const DevMemInfo& row_indices)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::gather_rows_async");
+
+    const auto cols        = input.shape(1);
+    const auto output_rows = row_indices.shape(0);
+
+    // Create the output
+    auto output = input.make_new_buffer(input.dtype().item_size() * output_rows * cols);
+
+    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                          MatxUtil__MatxGatherRows{input.shape(0), output_rows, cols, output->stream()},
+                          input.data(),
+                          row_indices.data(),
+                          output->data());
+
+    return output;
+}
+
+void MatxUtil::offset_seq_ids(const DevMemInfo& input, TensorIndex offset)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::offset_seq_ids");
+
+    offset_seq_ids_async(input, offset);
+
+    mrc::enqueue_stream_sync_event(input.memory()->cuda_stream).get();
+}
+
+void MatxUtil::offset_seq_ids_async(const DevMemInfo& input, TensorIndex offset)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::offset_seq_ids_async");
+
+    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                          MatxUtil__MatxOffsetSegIds{offset, input.shape(0), input.memory()->cuda_stream},
+                          input.data());
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::logits(const DevMemInfo& input)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::logits");
+
+    // Create the output
+    auto output = input.make_new_buffer(input.bytes());
+
+    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                          MatxUtil__MatxLogits{boost::numeric_cast<TensorIndex>(input.count()), output->stream()},
+                          input.data(),
+                          output->data());
+
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::softmax(const DevMemInfo& input)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::softmax");
+
+    // Create the output
+    auto output = input.make_new_buffer(input.bytes());
+
+    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                          MatxUtil__MatxSoftmax{input.shape(0), input.shape(1), output->stream()},
+                          input.data(),
+                          output->data(),
+                          input.stride());
+
+    return output;
+}
+
+void MatxUtil::row_argmax(const DevMemInfo& input, void* max_values, void* max_indices)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::row_argmax");
+
+    auto stream = input.memory()->cuda_stream;
+
+    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                          MatxUtil__MatxRowArgmax{input.shape(0), input.shape(1), stream},
+                          input.data(),
+                          max_values,
+                          max_indices,
+                          input.stride());
+
+    mrc::enqueue_stream_sync_event(stream).get();
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::transpose(const DevMemInfo& input)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::transpose");
+
+    // Now create the output
+    auto output = input.make_new_buffer(input.bytes());
+
+    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                          MatxUtil__MatxTranspose{output->stream(), input.shape(0), input.shape(1)},
+                          input.data(),
+                          output->data());
+
+    return output;
+}
+
+void MatxUtil::threshold_scatter(const DevMemInfo& input,
+                                 double thresh_val,
+                                 const std::vector<TensorIndex>& column_indices,
+                                 const std::vector<void*>& output_columns)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::threshold_scatter");
+
+    DCHECK(column_indices.size() == output_columns.size());
+
+    const auto rows       = input.shape(0);
+    const auto num_labels = static_cast<TensorIndex>(column_indices.size());
+    auto stream           = input.memory()->cuda_stream;
+
+    rmm::device_uvector<TensorIndex> col_indices_d(column_indices.size(), stream);
+    rmm::device_uvector<bool*> outputs_d(output_columns.size(), stream);
+
+    MRC_CHECK_CUDA(cudaMemcpyAsync(col_indices_d.data(),
+                                   column_indices.data(),
+                                   column_indices.size() * sizeof(TensorIndex),
+                                   cudaMemcpyHostToDevice,
+                                   stream.value()));
+    MRC_CHECK_CUDA(cudaMemcpyAsync(outputs_d.data(),
+                                   output_columns.data(),
+                                   output_columns.size() * sizeof(bool*),
+                                   cudaMemcpyHostToDevice,
+                                   stream.value()));
+
+    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                          MatxUtil__MatxThresholdScatter{rows, num_labels, stream},
+                          input.data(),
+                          thresh_val,
+                          col_indices_d.data(),
+                          outputs_d.data(),
+                          input.stride());
+
+    mrc::enqueue_stream_sync_event(stream).get();
+}
+
+void MatxUtil::scatter_columns(const DevMemInfo& input,
+                               const std::vector<TensorIndex>& column_indices,
+                               const std::vector<void*>& output_columns)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::scatter_columns");
+
+    DCHECK(column_indices.size() == output_columns.size());
+
+    const auto rows       = input.shape(0);
+    const auto num_labels = static_cast<TensorIndex>(column_indices.size());
+    auto stream           = input.memory()->cuda_stream;
+
+    rmm::device_uvector<TensorIndex> col_indices_d(column_indices.size(), stream);
+    rmm::device_uvector<void*> outputs_d(output_columns.size(), stream);
+
+    MRC_CHECK_CUDA(cudaMemcpyAsync(col_indices_d.data(),
+                                   column_indices.data(),
+                                   column_indices.size() * sizeof(TensorIndex),
+                                   cudaMemcpyHostToDevice,
+                                   stream.value()));
+    MRC_CHECK_CUDA(cudaMemcpyAsync(outputs_d.data(),
+                                   output_columns.data(),
+                                   output_columns.size() * sizeof(void*),
+                                   cudaMemcpyHostToDevice,
+                                   stream.value()));
+
+    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                          MatxUtil__MatxScatterColumns{rows, num_labels, stream},
+                          input.data(),
+                          col_indices_d.data(),
+                          outputs_d.data(),
+                          input.stride());
+
+    mrc::enqueue_stream_sync_event(stream).get();
+}
+
+std::vector<RangeType> MatxUtil::mask_to_ranges(const rmm::device_buffer& bool_mask, TensorIndex num_rows)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::mask_to_ranges");
+
+    const auto* mask = static_cast<const bool*>(bool_mask.data());
+    auto stream      = bool_mask.stream();
+
+    rmm::device_uvector<TensorIndex> starts(num_rows, stream);
+    rmm::device_uvector<TensorIndex> stops(num_rows, stream);
+
+    auto row_idx_begin = thrust::counting_iterator<TensorIndex>(0);
+    auto row_idx_end   = row_idx_begin + num_rows;
+
+    auto starts_end = thrust::copy_if(
+        rmm::exec_policy(stream), row_idx_begin, row_idx_end, starts.begin(), MatxUtil__RangeStart{mask});
+    auto stops_end = thrust::copy_if(
+        rmm::exec_policy(stream), row_idx_begin, row_idx_end, stops.begin(), MatxUtil__RangeStop{mask, num_rows});
+
+    const auto num_ranges = static_cast<std::size_t>(thrust::distance(starts.begin(), starts_end));
+    DCHECK(num_ranges == static_cast<std::size_t>(thrust::distance(stops.begin(), stops_end)));
+
+    // Only the compacted range bounds cross to the host, not the full mask
+    std::vector<TensorIndex> host_starts(num_ranges);
+    std::vector<TensorIndex> host_stops(num_ranges);
+
+    MRC_CHECK_CUDA(cudaMemcpyAsync(host_starts.data(),
+                                   starts.data(),
+                                   num_ranges * sizeof(TensorIndex),
+                                   cudaMemcpyDeviceToHost,
+                                   stream.value()));
+    MRC_CHECK_CUDA(cudaMemcpyAsync(
+        host_stops.data(), stops.data(), num_ranges * sizeof(TensorIndex), cudaMemcpyDeviceToHost, stream.value()));
+    MRC_CHECK_CUDA(cudaStreamSynchronize(stream.value()));
+
+    std::vector<RangeType> ranges;
+    ranges.reserve(num_ranges);
+
+    for (std::size_t i = 0; i < num_ranges; ++i)
+    {
+        // The stop predicate marks the last true row, ranges are half-open
+        ranges.emplace_back(host_starts[i], host_stops[i] + 1);
+    }
+
+    return ranges;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::threshold(const DevMemInfo& input, double thresh_val, bool by_row)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::threshold");
+
+    auto output = threshold_async(input, thresh_val, by_row);
+
+    mrc::enqueue_stream_sync_event(output->stream()).get();
+
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::threshold_async(const DevMemInfo& input, double thresh_val, bool by_row)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::threshold_async");
+
+    const auto rows        = input.shape(0);
+    const auto cols        = input.shape(1);
+    TensorSize output_size = sizeof(bool) * rows;
+    if (!by_row)
+    {
+        output_size *= cols;
+    }
+
+    // Now create the output array of bools
+    auto output = input.make_new_buffer(output_size);
+
     cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
                           MatxUtil__MatxThreshold{rows, cols, by_row, output->stream()},
                           input.data(),
@@ -460,16 +1558,80 @@ std::shared_ptr<rmm::device_buffer> MatxUtil::threshold(const DevMemInfo& input,
                           thresh_val,
                           input.stride());
 
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::logits_threshold(const DevMemInfo& input,
+                                                               double thresh_val,
+                                                               bool by_row,
+                                                               std::shared_ptr<rmm::device_buffer>* scores)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::logits_threshold");
+
+    auto output = logits_threshold_async(input, thresh_val, by_row, scores);
+
     mrc::enqueue_stream_sync_event(output->stream()).get();
 
     return output;
 }
 
+std::shared_ptr<rmm::device_buffer> MatxUtil::logits_threshold_async(const DevMemInfo& input,
+                                                                     double thresh_val,
+                                                                     bool by_row,
+                                                                     std::shared_ptr<rmm::device_buffer>* scores)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::logits_threshold_async");
+
+    const auto rows        = input.shape(0);
+    const auto cols        = input.shape(1);
+    TensorSize output_size = sizeof(bool) * rows;
+    if (!by_row)
+    {
+        output_size *= cols;
+    }
+
+    // Now create the output array of bools
+    auto output = input.make_new_buffer(output_size);
+
+    std::shared_ptr<rmm::device_buffer> scores_buffer;
+    if (scores != nullptr)
+    {
+        scores_buffer = input.make_new_buffer(input.bytes());
+        *scores       = scores_buffer;
+    }
+
+    cudf::type_dispatcher(cudf::data_type{input.dtype().cudf_type_id()},
+                          MatxUtil__MatxLogitsThreshold{rows, cols, by_row, output->stream()},
+                          input.data(),
+                          output->data(),
+                          scores_buffer ? scores_buffer->data() : nullptr,
+                          thresh_val,
+                          input.stride());
+
+    return output;
+}
+
 std::shared_ptr<rmm::device_buffer> MatxUtil::reduce_max(const DevMemInfo& input,
                                                          const ShapeType& seq_ids,
                                                          TensorIndex seq_id_offset,
                                                          const ShapeType& output_shape)
 {
+    MORPHEUS_NVTX_RANGE("MatxUtil::reduce_max");
+
+    auto output = reduce_max_async(input, seq_ids, seq_id_offset, output_shape);
+
+    mrc::enqueue_stream_sync_event(output->stream()).get();
+
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::reduce_max_async(const DevMemInfo& input,
+                                                               const ShapeType& seq_ids,
+                                                               TensorIndex seq_id_offset,
+                                                               const ShapeType& output_shape)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::reduce_max_async");
+
     const auto& dtype   = input.dtype();
     auto cudf_type      = cudf::data_type{dtype.cudf_type_id()};
     auto num_input_rows = input.shape(0);
@@ -488,7 +1650,101 @@ std::shared_ptr<rmm::device_buffer> MatxUtil::reduce_max(const DevMemInfo& input
 
     cudf::type_dispatcher(cudf_type, matx_reduce_max, input.data(), output->data());
 
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::sliding_window_reduce(const DevMemInfo& input,
+                                                                    const ShapeType& segment_offsets,
+                                                                    TensorIndex window,
+                                                                    WindowReduceOp op)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::sliding_window_reduce");
+
+    auto output = sliding_window_reduce_async(input, segment_offsets, window, op);
+
     mrc::enqueue_stream_sync_event(output->stream()).get();
+
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::sliding_window_reduce_async(const DevMemInfo& input,
+                                                                          const ShapeType& segment_offsets,
+                                                                          TensorIndex window,
+                                                                          WindowReduceOp op)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::sliding_window_reduce_async");
+
+    if (window < 1)
+    {
+        throw std::invalid_argument("window must be at least 1");
+    }
+
+    const auto& dtype = input.dtype();
+    auto num_rows     = input.shape(0);
+
+    DCHECK(segment_offsets.size() >= 2) << "segment_offsets must hold at least one segment";
+    DCHECK(segment_offsets.front() == 0 && segment_offsets.back() == num_rows)
+        << "segment_offsets must start at 0 and end at the row count";
+
+    // One output per input row, so the output buffer matches the input's size
+    auto output = input.make_new_buffer(dtype.item_size() * input.count());
+
+    // The boundaries are looked up per thread, stage them on the output's stream; the stream-ordered
+    // deallocation keeps them alive past the kernel
+    auto offsets_d = rmm::device_uvector<TensorIndex>(segment_offsets.size(), output->stream());
+
+    MRC_CHECK_CUDA(cudaMemcpyAsync(offsets_d.data(),
+                                   segment_offsets.data(),
+                                   segment_offsets.size() * sizeof(TensorIndex),
+                                   cudaMemcpyHostToDevice,
+                                   output->stream()));
+
+    MatxUtil__SlidingWindowReduce sliding_reduce{num_rows,
+                                                 input.shape(1),
+                                                 input.stride(),
+                                                 offsets_d.data(),
+                                                 static_cast<TensorIndex>(segment_offsets.size() - 1),
+                                                 window,
+                                                 op,
+                                                 output->stream()};
+
+    cudf::type_dispatcher(cudf::data_type{dtype.cudf_type_id()}, sliding_reduce, input.data(), output->data());
+
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::mean_pool_normalize(const DevMemInfo& input, TensorIndex pool_size)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::mean_pool_normalize");
+
+    auto output = mean_pool_normalize_async(input, pool_size);
+
+    mrc::enqueue_stream_sync_event(output->stream()).get();
+
+    return output;
+}
+
+std::shared_ptr<rmm::device_buffer> MatxUtil::mean_pool_normalize_async(const DevMemInfo& input, TensorIndex pool_size)
+{
+    MORPHEUS_NVTX_RANGE("MatxUtil::mean_pool_normalize_async");
+
+    const auto num_rows = input.shape(0);
+
+    if (pool_size < 1 || num_rows % pool_size != 0)
+    {
+        throw std::invalid_argument("pool_size must be positive and divide the row count evenly");
+    }
+
+    const auto& dtype     = input.dtype();
+    const auto num_pooled = num_rows / pool_size;
+
+    // The pooled output is dense row-major
+    auto output = input.make_new_buffer(dtype.item_size() * num_pooled * input.shape(1));
+
+    MatxUtil__MeanPoolNormalize pool_normalize{num_pooled, input.shape(1), input.stride(), pool_size, output->stream()};
+
+    cudf::type_dispatcher(cudf::data_type{dtype.cudf_type_id()}, pool_normalize, input.data(), output->data());
+
     return output;
 }
 }  // namespace morpheus
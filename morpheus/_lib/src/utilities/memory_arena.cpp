@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/memory_arena.hpp"
+
+#include <rmm/mr/device/per_device_resource.hpp>  // for get_current_device_resource
+
+#include <limits>    // for numeric_limits
+#include <optional>  // for optional, nullopt
+#include <utility>   // for move
+
+namespace morpheus {
+
+MemoryArena::MemoryArena(std::string name, std::size_t budget_bytes) :
+  m_name(std::move(name)),
+  m_budget_bytes(budget_bytes)
+{
+    // The arena sizes itself from the budget when one is given, so the whole allotment is carved out of the
+    // shared resource up front and later bursts never contend with the other pipelines' allocations
+    auto arena_size = budget_bytes > 0 ? std::optional<std::size_t>{budget_bytes} : std::nullopt;
+
+    m_arena = std::make_unique<arena_resource_t>(rmm::mr::get_current_device_resource(), arena_size);
+
+    auto limit = budget_bytes > 0 ? budget_bytes : std::numeric_limits<std::size_t>::max();
+
+    m_limited = std::make_unique<limited_resource_t>(m_arena.get(), limit);
+    m_tracked = std::make_unique<tracked_resource_t>(m_limited.get());
+}
+
+rmm::mr::device_memory_resource* MemoryArena::resource()
+{
+    return m_tracked.get();
+}
+
+std::shared_ptr<MemoryDescriptor> MemoryArena::make_descriptor(rmm::cuda_stream_view stream) const
+{
+    return std::make_shared<MemoryDescriptor>(stream, m_tracked.get());
+}
+
+const std::string& MemoryArena::name() const
+{
+    return m_name;
+}
+
+std::size_t MemoryArena::budget_bytes() const
+{
+    return m_budget_bytes;
+}
+
+std::map<std::string, double> MemoryArena::stats() const
+{
+    auto bytes       = m_tracked->get_bytes_counter();
+    auto allocations = m_tracked->get_allocations_counter();
+
+    return {{"current_bytes", static_cast<double>(bytes.value)},
+            {"peak_bytes", static_cast<double>(bytes.peak)},
+            {"total_bytes", static_cast<double>(bytes.total)},
+            {"allocation_count", static_cast<double>(allocations.total)},
+            {"budget_bytes", static_cast<double>(m_budget_bytes)}};
+}
+
+MemoryArenaRegistry& MemoryArenaRegistry::instance()
+{
+    static MemoryArenaRegistry registry;
+
+    return registry;
+}
+
+std::shared_ptr<MemoryArena> MemoryArenaRegistry::get_or_create(const std::string& name, std::size_t budget_bytes)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    auto found = m_arenas.find(name);
+    if (found == m_arenas.end())
+    {
+        found = m_arenas.emplace(name, std::make_shared<MemoryArena>(name, budget_bytes)).first;
+    }
+
+    return found->second;
+}
+
+std::map<std::string, std::map<std::string, double>> MemoryArenaRegistry::all_stats() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    std::map<std::string, std::map<std::string, double>> stats;
+    for (const auto& [name, arena] : m_arenas)
+    {
+        stats[name] = arena->stats();
+    }
+
+    return stats;
+}
+
+}  // namespace morpheus
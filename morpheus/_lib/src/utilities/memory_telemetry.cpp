@@ -0,0 +1,205 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/memory_telemetry.hpp"
+
+#include <boost/fiber/fss.hpp>  // for fiber_specific_ptr
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>  // for get/set_current_device_resource
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>  // for mutex, lock_guard, once_flag, call_once
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+// The calling fiber's active counters; a plain thread counts as one fiber
+boost::fibers::fiber_specific_ptr<morpheus::StageMemoryCounters*>& active_counters()
+{
+    static boost::fibers::fiber_specific_ptr<morpheus::StageMemoryCounters*> active;
+
+    return active;
+}
+
+/**
+ * Adaptor forwarding to the wrapped resource while charging each allocation to the fiber's active stage
+ * counters. The pointer-to-owner map lets deallocations debit the allocating stage even when another stage (or
+ * no stage) frees; the map mutex is only contended at RMM-allocation granularity, which the pool adaptors above
+ * this resource already keep off the per-message path.
+ */
+class StageTrackingResource final : public rmm::mr::device_memory_resource
+{
+  public:
+    explicit StageTrackingResource(rmm::mr::device_memory_resource* upstream) : m_upstream(upstream) {}
+
+  private:
+    void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+    {
+        auto* ptr = m_upstream->allocate(bytes, stream);
+
+        auto& counters = morpheus::StageMemoryRegistry::active();
+        counters.record_alloc(bytes);
+
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_owners[ptr] = &counters;
+        }
+
+        return ptr;
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+    {
+        morpheus::StageMemoryCounters* owner = nullptr;
+
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            auto found = m_owners.find(ptr);
+            if (found != m_owners.end())
+            {
+                owner = found->second;
+                m_owners.erase(found);
+            }
+        }
+
+        if (owner != nullptr)
+        {
+            owner->record_dealloc(bytes);
+        }
+
+        m_upstream->deallocate(ptr, bytes, stream);
+    }
+
+    bool do_is_equal(const rmm::mr::device_memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    rmm::mr::device_memory_resource* m_upstream;
+    std::mutex m_mutex;
+    std::unordered_map<void*, morpheus::StageMemoryCounters*> m_owners;
+};
+
+}  // namespace
+
+namespace morpheus {
+
+void StageMemoryCounters::record_alloc(std::size_t bytes) noexcept
+{
+    const auto current = m_current_bytes.fetch_add(static_cast<std::int64_t>(bytes), std::memory_order_relaxed) +
+                         static_cast<std::int64_t>(bytes);
+
+    // Lock-free running max
+    auto peak = m_peak_bytes.load(std::memory_order_relaxed);
+    while (current > peak && !m_peak_bytes.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {}
+
+    m_total_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    m_allocation_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void StageMemoryCounters::record_dealloc(std::size_t bytes) noexcept
+{
+    m_current_bytes.fetch_sub(static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+}
+
+std::map<std::string, double> StageMemoryCounters::stats() const
+{
+    return {{"current_bytes", static_cast<double>(m_current_bytes.load(std::memory_order_relaxed))},
+            {"peak_bytes", static_cast<double>(m_peak_bytes.load(std::memory_order_relaxed))},
+            {"total_bytes", static_cast<double>(m_total_bytes.load(std::memory_order_relaxed))},
+            {"allocation_count", static_cast<double>(m_allocation_count.load(std::memory_order_relaxed))}};
+}
+
+StageMemoryRegistry& StageMemoryRegistry::instance()
+{
+    static StageMemoryRegistry registry;
+
+    return registry;
+}
+
+StageMemoryCounters& StageMemoryRegistry::get_or_create(const std::string& name)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    auto& counters = m_counters[name];
+    if (!counters)
+    {
+        counters = std::make_unique<StageMemoryCounters>();
+    }
+
+    return *counters;
+}
+
+std::map<std::string, std::map<std::string, double>> StageMemoryRegistry::all_stats() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    std::map<std::string, std::map<std::string, double>> stats;
+    for (const auto& [name, counters] : m_counters)
+    {
+        stats[name] = counters->stats();
+    }
+
+    return stats;
+}
+
+StageMemoryCounters& StageMemoryRegistry::untagged()
+{
+    return get_or_create("(untagged)");
+}
+
+StageMemoryCounters& StageMemoryRegistry::active()
+{
+    auto* holder = active_counters().get();
+    if (holder != nullptr && *holder != nullptr)
+    {
+        return **holder;
+    }
+
+    return instance().untagged();
+}
+
+StageMemoryCounters* StageMemoryRegistry::exchange_active(StageMemoryCounters* counters)
+{
+    auto* holder = active_counters().get();
+    if (holder == nullptr)
+    {
+        active_counters().reset(new StageMemoryCounters*(counters));
+        return nullptr;
+    }
+
+    auto* previous = *holder;
+    *holder        = counters;
+
+    return previous;
+}
+
+void install_memory_telemetry()
+{
+    static std::once_flag installed;
+
+    std::call_once(installed, [] {
+        static StageTrackingResource resource(rmm::mr::get_current_device_resource());
+        rmm::mr::set_current_device_resource(&resource);
+    });
+}
+
+}  // namespace morpheus
@@ -0,0 +1,251 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/metrics_exporter.hpp"
+
+#include "morpheus/utilities/edge_gauges.hpp"       // for EdgeGaugeRegistry
+#include "morpheus/utilities/gpu_sampler.hpp"       // for GpuUtilizationSampler
+#include "morpheus/utilities/memory_arena.hpp"      // for MemoryArenaRegistry
+#include "morpheus/utilities/memory_telemetry.hpp"  // for StageMemoryRegistry
+#include "morpheus/utilities/stage_latency.hpp"     // for LatencyRegistry
+
+#include <pybind11/gil.h>  // for gil_scoped_release
+
+#include <chrono>   // for seconds
+#include <cstdio>   // for snprintf
+#include <map>      // for map
+#include <memory>   // for make_unique
+#include <string>   // for string
+#include <tuple>    // for make_tuple
+#include <utility>  // for move
+
+namespace {
+
+using stats_map_t = std::map<std::string, std::map<std::string, double>>;
+
+// Prometheus label values escape backslash, double-quote and newline. Appending char-wise avoids building an
+// intermediate escaped string
+void append_label_value(std::string& out, const std::string& value)
+{
+    for (char c : value)
+    {
+        if (c == '\\' || c == '"')
+        {
+            out.push_back('\\');
+            out.push_back(c);
+        }
+        else if (c == '\n')
+        {
+            out.append("\\n");
+        }
+        else
+        {
+            out.push_back(c);
+        }
+    }
+}
+
+void append_number(std::string& out, double value)
+{
+    char buffer[64];  // NOLINT(modernize-avoid-c-arrays)
+    auto len = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+    out.append(buffer, len);
+}
+
+void append_sample(std::string& out,
+                   const char* family,
+                   const char* label,
+                   const std::string& label_value,
+                   const std::map<std::string, double>& stats)
+{
+    for (const auto& [stat, value] : stats)
+    {
+        out.append(family);
+        out.push_back('{');
+        out.append(label);
+        out.append("=\"");
+        append_label_value(out, label_value);
+        out.append("\",stat=\"");
+        append_label_value(out, stat);
+        out.append("\"} ");
+        append_number(out, value);
+        out.push_back('\n');
+    }
+}
+
+void append_family(std::string& out, const char* family, const char* help, const char* label, const stats_map_t& stats)
+{
+    if (stats.empty())
+    {
+        return;
+    }
+
+    out.append("# HELP ");
+    out.append(family);
+    out.push_back(' ');
+    out.append(help);
+    out.append("\n# TYPE ");
+    out.append(family);
+    out.append(" gauge\n");
+
+    for (const auto& [name, entry_stats] : stats)
+    {
+        append_sample(out, family, label, name, entry_stats);
+    }
+}
+
+}  // namespace
+
+namespace morpheus {
+
+MetricsExporter::MetricsExporter(std::string bind_address,
+                                 unsigned short port,
+                                 std::string endpoint,
+                                 unsigned short num_threads)
+{
+    payload_parse_fn_t parse_fn = [this](std::string&& /* body, empty for GET */) {
+        return std::make_tuple(200u,
+                               std::string("text/plain; version=0.0.4"),
+                               this->render(),
+                               on_complete_cb_fn_t{nullptr},
+                               chunk_supplier_fn_t{nullptr});
+    };
+
+    m_server = std::make_unique<HttpServer>(std::move(parse_fn),
+                                            std::move(bind_address),
+                                            port,
+                                            std::move(endpoint),
+                                            "GET",
+                                            num_threads,
+                                            DefaultMaxPayloadSize,
+                                            std::chrono::seconds(30));
+}
+
+void MetricsExporter::start()
+{
+    m_server->start();
+}
+
+void MetricsExporter::stop()
+{
+    m_server->stop();
+}
+
+bool MetricsExporter::is_running() const
+{
+    return m_server->is_running();
+}
+
+std::string MetricsExporter::render()
+{
+    std::string out;
+
+    // Reserving at the previous scrape's high-water mark keeps the append loop below allocation-free. The registry
+    // snapshots and this one response buffer are the only allocations a scrape makes
+    out.reserve(m_high_water.load(std::memory_order_relaxed));
+
+    append_family(out,
+                  "morpheus_stage_latency",
+                  "Per-stage batch latency summary, microseconds except the count stat.",
+                  "stage",
+                  LatencyRegistry::instance().all_stats());
+
+    append_family(out,
+                  "morpheus_edge_queue",
+                  "Per-edge queue depth, high-water mark, enqueue count and blocked time.",
+                  "edge",
+                  EdgeGaugeRegistry::instance().all_stats());
+
+    append_family(out,
+                  "morpheus_stage_memory",
+                  "Per-stage device memory usage in bytes, empty unless memory telemetry is installed.",
+                  "stage",
+                  StageMemoryRegistry::instance().all_stats());
+
+    append_family(out,
+                  "morpheus_memory_arena",
+                  "Per-arena device memory usage in bytes against the configured budget.",
+                  "arena",
+                  MemoryArenaRegistry::instance().all_stats());
+
+    auto gpu_stats = GpuUtilizationSampler::instance().stats();
+    if (!gpu_stats.empty())
+    {
+        out.append("# HELP morpheus_gpu GPU utilization summary, empty unless the sampler is running.\n");
+        out.append("# TYPE morpheus_gpu gauge\n");
+
+        for (const auto& [stat, value] : gpu_stats)
+        {
+            out.append("morpheus_gpu{stat=\"");
+            append_label_value(out, stat);
+            out.append("\"} ");
+            append_number(out, value);
+            out.push_back('\n');
+        }
+    }
+
+    auto high_water = m_high_water.load(std::memory_order_relaxed);
+    while (out.size() > high_water && !m_high_water.compare_exchange_weak(high_water, out.size())) {}
+
+    return out;
+}
+
+/****** MetricsExporterInterfaceProxy *************************/
+std::shared_ptr<MetricsExporter> MetricsExporterInterfaceProxy::init(std::string bind_address,
+                                                                     unsigned short port,
+                                                                     std::string endpoint,
+                                                                     unsigned short num_threads)
+{
+    return std::make_shared<MetricsExporter>(std::move(bind_address), port, std::move(endpoint), num_threads);
+}
+
+void MetricsExporterInterfaceProxy::start(MetricsExporter& self)
+{
+    self.start();
+}
+
+void MetricsExporterInterfaceProxy::stop(MetricsExporter& self)
+{
+    self.stop();
+}
+
+bool MetricsExporterInterfaceProxy::is_running(const MetricsExporter& self)
+{
+    return self.is_running();
+}
+
+std::string MetricsExporterInterfaceProxy::render(MetricsExporter& self)
+{
+    pybind11::gil_scoped_release release;
+    return self.render();
+}
+
+MetricsExporter& MetricsExporterInterfaceProxy::enter(MetricsExporter& self)
+{
+    self.start();
+    return self;
+}
+
+void MetricsExporterInterfaceProxy::exit(MetricsExporter& self,
+                                         const pybind11::object& type,
+                                         const pybind11::object& value,
+                                         const pybind11::object& traceback)
+{
+    self.stop();
+}
+
+}  // namespace morpheus
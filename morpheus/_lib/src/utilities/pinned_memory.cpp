@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/pinned_memory.hpp"
+
+#include <rmm/mr/device/pool_memory_resource.hpp>  // for pool_memory_resource
+#include <rmm/mr/pinned_host_memory_resource.hpp>
+
+#include <sched.h>  // for getcpu
+
+#include <cstdlib>  // for getenv, strtoull
+#include <map>
+#include <memory>
+#include <mutex>  // for mutex, lock_guard
+
+namespace {
+
+using pinned_pool_t = rmm::mr::pool_memory_resource<rmm::mr::pinned_host_memory_resource>;
+
+std::size_t pool_initial_bytes()
+{
+    // Staging buffers recycle, so the steady-state footprint is stable; the pool grows past the initial span when
+    // a pipeline needs more
+    constexpr std::size_t DefaultMiB = 64;
+
+    const auto* value = std::getenv("MORPHEUS_PINNED_POOL_SIZE");
+
+    return (value != nullptr ? std::strtoull(value, nullptr, 10) : DefaultMiB) << 20;
+}
+
+unsigned int current_numa_node()
+{
+    unsigned int cpu  = 0;
+    unsigned int node = 0;
+
+    if (getcpu(&cpu, &node) != 0)
+    {
+        return 0;
+    }
+
+    return node;
+}
+
+pinned_pool_t& node_pool(unsigned int node)
+{
+    // Stateless wrapper around cudaHostAlloc/cudaFreeHost, safe to share across the pools
+    static rmm::mr::pinned_host_memory_resource upstream{};
+
+    static std::mutex mutex;
+    static std::map<unsigned int, std::unique_ptr<pinned_pool_t>> pools;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto found = pools.find(node);
+    if (found == pools.end())
+    {
+        // cudaHostAlloc faults and pins the pages at allocation time, so a pool created here by a thread running
+        // on this node is physically node-local
+        found = pools.emplace(node, std::make_unique<pinned_pool_t>(&upstream, pool_initial_bytes())).first;
+    }
+
+    return *found->second;
+}
+
+}  // namespace
+
+namespace morpheus {
+
+/****** Component public implementations *******************/
+/****** PinnedMemory***************************************/
+cuda::mr::async_resource_ref<cuda::mr::device_accessible> PinnedMemory::resource()
+{
+    return node_pool(current_numa_node());
+}
+
+std::shared_ptr<rmm::device_buffer> PinnedMemory::make_buffer(std::size_t size_bytes, rmm::cuda_stream_view stream)
+{
+    return std::make_shared<rmm::device_buffer>(size_bytes, stream, PinnedMemory::resource());
+}
+}  // namespace morpheus
@@ -0,0 +1,180 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/stage_latency.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>  // for bit_width
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // for hash
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>  // for pair
+
+namespace {
+
+// Bucket i holds samples in [2^i, 2^(i+1)) nanoseconds, with 0 folded into bucket 0
+std::size_t bucket_index(std::uint64_t nanoseconds) noexcept
+{
+    return nanoseconds == 0 ? 0 : static_cast<std::size_t>(std::bit_width(nanoseconds)) - 1;
+}
+
+double bucket_upper_bound_us(std::size_t index) noexcept
+{
+    return static_cast<double>(2ULL << index) / 1000.0;
+}
+
+// Arithmetic midpoint of the bucket's range, used for the mean estimate
+double bucket_midpoint_us(std::size_t index) noexcept
+{
+    return static_cast<double>((1ULL << index) + (index > 0 ? (1ULL << (index - 1)) : 0)) / 1000.0;
+}
+
+std::size_t local_shard() noexcept
+{
+    return std::hash<std::thread::id>{}(std::this_thread::get_id()) & (morpheus::LatencyHistogram::ShardCount - 1);
+}
+
+}  // namespace
+
+namespace morpheus {
+
+void LatencyHistogram::record(std::uint64_t nanoseconds) noexcept
+{
+    m_shards[local_shard()].buckets[bucket_index(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::reset() noexcept
+{
+    for (auto& shard : m_shards)
+    {
+        for (auto& bucket : shard.buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+std::map<std::string, double> LatencyHistogram::stats() const
+{
+    std::array<std::uint64_t, BucketCount> totals{};
+    std::uint64_t count = 0;
+    for (const auto& shard : m_shards)
+    {
+        for (std::size_t i = 0; i < BucketCount; ++i)
+        {
+            const auto bucket_count = shard.buckets[i].load(std::memory_order_relaxed);
+            totals[i] += bucket_count;
+            count += bucket_count;
+        }
+    }
+
+    std::map<std::string, double> stats{
+        {"count", static_cast<double>(count)},
+        {"mean_us", 0.0},
+        {"p50_us", 0.0},
+        {"p95_us", 0.0},
+        {"p99_us", 0.0},
+        {"max_us", 0.0}};
+
+    if (count == 0)
+    {
+        return stats;
+    }
+
+    double weighted_sum = 0.0;
+    for (std::size_t i = 0; i < BucketCount; ++i)
+    {
+        if (totals[i] > 0)
+        {
+            weighted_sum += static_cast<double>(totals[i]) * bucket_midpoint_us(i);
+            stats["max_us"] = bucket_upper_bound_us(i);
+        }
+    }
+
+    stats["mean_us"] = weighted_sum / static_cast<double>(count);
+
+    const std::array<std::pair<const char*, double>, 3> percentiles{
+        {{"p50_us", 0.50}, {"p95_us", 0.95}, {"p99_us", 0.99}}};
+
+    for (const auto& [key, fraction] : percentiles)
+    {
+        const auto target        = static_cast<std::uint64_t>(fraction * static_cast<double>(count));
+        std::uint64_t cumulative = 0;
+        for (std::size_t i = 0; i < BucketCount; ++i)
+        {
+            cumulative += totals[i];
+            if (cumulative > target)
+            {
+                stats[key] = bucket_upper_bound_us(i);
+                break;
+            }
+        }
+    }
+
+    return stats;
+}
+
+LatencyRegistry& LatencyRegistry::instance()
+{
+    static LatencyRegistry registry;
+
+    return registry;
+}
+
+LatencyHistogram& LatencyRegistry::get_or_create(const std::string& name)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    auto& histogram = m_histograms[name];
+    if (!histogram)
+    {
+        histogram = std::make_unique<LatencyHistogram>();
+    }
+
+    return *histogram;
+}
+
+std::map<std::string, std::map<std::string, double>> LatencyRegistry::all_stats() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    std::map<std::string, std::map<std::string, double>> stats;
+    for (const auto& [name, histogram] : m_histograms)
+    {
+        stats[name] = histogram->stats();
+    }
+
+    return stats;
+}
+
+void LatencyRegistry::reset_all()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    for (auto& [name, histogram] : m_histograms)
+    {
+        histogram->reset();
+    }
+}
+
+}  // namespace morpheus
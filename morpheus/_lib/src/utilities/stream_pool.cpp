@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "morpheus/utilities/stream_pool.hpp"
+
+#include <boost/fiber/fss.hpp>  // for fiber_specific_ptr
+
+#include <atomic>
+#include <cstddef>
+
+namespace morpheus {
+
+StreamPool::StreamPool() : m_pool(PoolSize) {}
+
+StreamPool& StreamPool::instance()
+{
+    static StreamPool pool;
+
+    return pool;
+}
+
+rmm::cuda_stream_view StreamPool::stream_for_fiber()
+{
+    // Round-robin assignment cached per fiber; a plain thread counts as one fiber
+    static boost::fibers::fiber_specific_ptr<std::size_t> assigned_index;
+    static std::atomic<std::size_t> next_index{0};
+
+    if (assigned_index.get() == nullptr)
+    {
+        assigned_index.reset(new std::size_t(next_index.fetch_add(1, std::memory_order_relaxed) % PoolSize));
+    }
+
+    return m_pool.get_stream(*assigned_index);
+}
+
+rmm::cuda_stream_view StreamPool::get_stream()
+{
+    return instance().stream_for_fiber();
+}
+
+}  // namespace morpheus
@@ -17,18 +17,42 @@
 
 #include "morpheus/utilities/table_util.hpp"
 
+#include <cudf/concatenate.hpp>  // for concatenate
 #include <cudf/io/csv.hpp>
 #include <cudf/io/json.hpp>
+#include <cudf/table/table_view.hpp>  // for table_view
 #include <glog/logging.h>
 #include <pybind11/pybind11.h>
 
 #include <filesystem>
 #include <ostream>    // needed for logging
 #include <stdexcept>  // for runtime_error
+#include <utility>    // for move
+#include <vector>     // for vector
 
 namespace fs = std::filesystem;
 namespace py = pybind11;
 
+namespace {
+// Every table must line up with the first one column-for-column before they can be concatenated
+void check_schema_match(const cudf::io::table_with_metadata& base, const cudf::io::table_with_metadata& other)
+{
+    const auto base_view  = base.tbl->view();
+    const auto other_view = other.tbl->view();
+
+    CHECK_EQ(base_view.num_columns(), other_view.num_columns())
+        << "Tables to concatenate have mismatched column counts";
+
+    for (cudf::size_type i = 0; i < base_view.num_columns(); ++i)
+    {
+        CHECK(base_view.column(i).type() == other_view.column(i).type())
+            << "Tables to concatenate have mismatched types for column " << i;
+        CHECK(base.metadata.schema_info[i].name == other.metadata.schema_info[i].name)
+            << "Tables to concatenate have mismatched names for column " << i;
+    }
+}
+}  // namespace
+
 cudf::io::table_with_metadata morpheus::CuDFTableUtil::load_table(const std::string& filename)
 {
     auto file_path = fs::path(filename);
@@ -52,3 +76,55 @@ cudf::io::table_with_metadata morpheus::CuDFTableUtil::load_table(const std::str
         throw std::runtime_error("Unknown extension");
     }
 }
+
+cudf::io::table_with_metadata morpheus::CuDFTableUtil::concat_tables(
+    std::vector<cudf::io::table_with_metadata>&& tables)
+{
+    CHECK(!tables.empty()) << "Cannot concatenate an empty set of tables";
+
+    if (tables.size() == 1)
+    {
+        return std::move(tables.front());
+    }
+
+    std::vector<cudf::table_view> views;
+    views.reserve(tables.size());
+
+    for (const auto& table : tables)
+    {
+        check_schema_match(tables.front(), table);
+        views.emplace_back(table.tbl->view());
+    }
+
+    return {cudf::concatenate(views), std::move(tables.front().metadata)};
+}
+
+std::vector<cudf::io::table_with_metadata> morpheus::CuDFTableUtil::concat_tables(
+    std::vector<cudf::io::table_with_metadata>&& tables, cudf::size_type target_rows)
+{
+    CHECK_GT(target_rows, 0) << "Target row count must be positive";
+
+    std::vector<cudf::io::table_with_metadata> output;
+    std::vector<cudf::io::table_with_metadata> batch;
+    cudf::size_type batch_rows = 0;
+
+    for (auto& table : tables)
+    {
+        batch_rows += table.tbl->num_rows();
+        batch.emplace_back(std::move(table));
+
+        if (batch_rows >= target_rows)
+        {
+            output.emplace_back(concat_tables(std::move(batch)));
+            batch.clear();
+            batch_rows = 0;
+        }
+    }
+
+    if (!batch.empty())
+    {
+        output.emplace_back(concat_tables(std::move(batch)));
+    }
+
+    return output;
+}
@@ -17,14 +17,28 @@
 
 #include "morpheus/utilities/tensor_util.hpp"
 
-#include <glog/logging.h>              // for DCHECK_EQ
+#include "morpheus/objects/dtype.hpp"              // for DType
+#include "morpheus/objects/memory_descriptor.hpp"  // for MemoryDescriptor
+#include "morpheus/objects/tensor.hpp"             // for Tensor
+#include "morpheus/utilities/device_util.hpp"      // for DeviceScope, DeviceUtil
+
+#include <cuda_runtime.h>              // for cudaMemcpy, cudaMemcpy2D, cudaMemcpy2DAsync, cudaMemcpyAsync
+#include <cudf/types.hpp>              // for type_id
+#include <glog/logging.h>              // for CHECK, DCHECK_EQ
+#include <mrc/cuda/common.hpp>         // for MRC_CHECK_CUDA
 #include <mrc/utils/sort_indexes.hpp>  // for sort_indexes
+#include <rmm/cuda_stream_view.hpp>    // for cuda_stream_default
+#include <rmm/device_buffer.hpp>       // for device_buffer
                                        // clang-format off
 // prevent from moving this into the third-party section
 #include <experimental/iterator>  // for make_ostream_joiner
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t
+#include <memory>       // for make_shared, shared_ptr
 #include <ostream>      // for operator<<, ostream, stringstream
 #include <string>       // for char_traits, string
 #include <type_traits>  // for decay_t
+#include <utility>      // for move
 #include <vector>       // for vector
 
 namespace morpheus {
@@ -42,6 +56,114 @@ std::string TensorUtils::shape_to_string(const ShapeType& shape)
     return ss.str();
 }
 
+void TensorUtils::copy_to_column(const cudf::column_view& cv, const TensorObject& tensor)
+{
+    const auto table_type_id  = cv.type().id();
+    const auto tensor_type    = DType(tensor.dtype());
+    const auto tensor_type_id = tensor_type.cudf_type_id();
+    const auto row_stride     = tensor.stride(0);
+
+    CHECK(tensor.count() == cv.size() &&
+          (table_type_id == tensor_type_id ||
+           (table_type_id == cudf::type_id::BOOL8 && tensor_type_id == cudf::type_id::UINT8)));
+
+    const auto item_size = tensor.dtype().item_size();
+
+    // Dont use cv.data<>() here since that does not account for the size of each element
+    auto data_start = const_cast<uint8_t*>(cv.head<uint8_t>()) + cv.offset() * item_size;
+
+    if (row_stride == 1)
+    {
+        // column major just use cudaMemcpy
+        MRC_CHECK_CUDA(cudaMemcpy(data_start, tensor.data(), tensor.bytes(), cudaMemcpyDeviceToDevice));
+    }
+    else
+    {
+        MRC_CHECK_CUDA(cudaMemcpy2D(
+            data_start, item_size, tensor.data(), row_stride * item_size, item_size, cv.size(), cudaMemcpyDeviceToDevice));
+    }
+}
+
+namespace {
+
+// Shared by the sync and async compacting copies: describes the single 2D transfer that moves `tensor`
+struct Copy2DArgs
+{
+    const void* src;
+    std::size_t src_pitch;
+    std::size_t width;
+    std::size_t height;
+};
+
+Copy2DArgs strided_copy_args(const TensorObject& tensor)
+{
+    const auto shape     = tensor.get_shape();
+    const auto stride    = TensorUtils::get_element_stride(tensor.get_stride());
+    const auto item_size = tensor.dtype_size();
+
+    CHECK(shape.size() == 2 && stride[1] == 1)
+        << "Compacting copies only support compact tensors and 2D row-strided tensors. shape="
+        << TensorUtils::shape_to_string(shape)
+        << " stride=" << TensorUtils::shape_to_string(stride);
+
+    return {tensor.data(),
+            static_cast<std::size_t>(stride[0]) * item_size,
+            static_cast<std::size_t>(shape[1]) * item_size,
+            static_cast<std::size_t>(shape[0])};
+}
+}  // namespace
+
+void TensorUtils::copy_compact(const TensorObject& tensor, void* dst, cudaMemcpyKind kind)
+{
+    if (tensor.is_compact())
+    {
+        MRC_CHECK_CUDA(cudaMemcpy(dst, tensor.data(), tensor.bytes(), kind));
+        return;
+    }
+
+    const auto args = strided_copy_args(tensor);
+    MRC_CHECK_CUDA(cudaMemcpy2D(dst, args.width, args.src, args.src_pitch, args.width, args.height, kind));
+}
+
+void TensorUtils::copy_compact_async(const TensorObject& tensor, void* dst, cudaMemcpyKind kind, cudaStream_t stream)
+{
+    if (tensor.is_compact())
+    {
+        MRC_CHECK_CUDA(cudaMemcpyAsync(dst, tensor.data(), tensor.bytes(), kind, stream));
+        return;
+    }
+
+    const auto args = strided_copy_args(tensor);
+    MRC_CHECK_CUDA(
+        cudaMemcpy2DAsync(dst, args.width, args.src, args.src_pitch, args.width, args.height, kind, stream));
+}
+
+TensorObject TensorUtils::copy_to_device(const TensorObject& tensor, int device_id)
+{
+    const auto src_device = tensor.get_memory()->device_id;
+
+    if (src_device == device_id)
+    {
+        return tensor;
+    }
+
+    DeviceUtil::ensure_peer_access(src_device, device_id);
+
+    // Allocate and build the result with the target device current so RMM picks its per-device resource and the
+    // new MemoryDescriptor records the right affinity
+    DeviceScope scope{device_id};
+
+    auto buffer = std::make_shared<rmm::device_buffer>(tensor.bytes(), rmm::cuda_stream_default);
+
+    // cudaMemcpyDefault lets unified addressing resolve the source and destination devices; with peer access
+    // enabled the transfer moves directly between the two, otherwise the runtime stages it through the host
+    copy_compact(tensor, buffer->data(), cudaMemcpyDefault);
+
+    ShapeType shape = tensor.get_shape();
+
+    return Tensor::create(std::move(buffer), DType(tensor.dtype()), std::move(shape), {});
+}
+
 void TensorUtils::set_contiguous_stride(const ShapeType& shape, ShapeType& stride)
 {
     stride.resize(shape.size());
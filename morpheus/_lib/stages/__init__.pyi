@@ -15,28 +15,45 @@ import mrc.core.segment
 __all__ = [
     "AddClassificationsStage",
     "AddScoresStage",
+    "DedupeStage",
     "DeserializeControlMessageStage",
     "DeserializeMultiMessageStage",
+    "DirectorySourceStage",
+    "EnrichmentStage",
     "FileSourceStage",
     "FilterDetectionsStage",
     "FilterSource",
+    "GroupbyWindowStage",
     "HttpServerSourceStage",
     "InferenceClientStage",
+    "IpcSinkStage",
+    "IpcSourceStage",
+    "KafkaSinkStage",
     "KafkaSourceStage",
+    "MockInferenceClientStage",
+    "MonitorMessageMetaStage",
+    "MonitorMultiMessageStage",
     "PreallocateMessageMetaStage",
     "PreallocateMultiMessageStage",
+    "PrefilterStage",
     "PreprocessFILStage",
     "PreprocessNLPStage",
+    "RegexExtractStage",
     "SerializeStage",
+    "TriggerMessageMetaStage",
+    "TriggerMultiMessageStage",
     "WriteToFileStage"
 ]
 
 
 class AddClassificationsStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, idx2label: typing.Dict[int, str], threshold: float) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, idx2label: typing.Dict[int, str], threshold: float, softmax: bool = False, argmax_score_column: str = '', argmax_index_column: str = '') -> None: ...
     pass
 class AddScoresStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, idx2label: typing.Dict[int, str]) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, idx2label: typing.Dict[int, str], softmax: bool = False, argmax_score_column: str = '', argmax_index_column: str = '') -> None: ...
+    pass
+class DedupeStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, key_columns: typing.List[str], window_size: int = 0) -> None: ...
     pass
 class DeserializeControlMessageStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, batch_size: int, ensure_sliceable_index: bool = True, task_type: object = None, task_payload: object = None) -> None: ...
@@ -44,23 +61,52 @@ class DeserializeControlMessageStage(mrc.core.segment.SegmentObject):
 class DeserializeMultiMessageStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, batch_size: int, ensure_sliceable_index: bool = True) -> None: ...
     pass
+class DirectorySourceStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, directory: str, num_threads: int = 4, queue_size: int = 8, process_existing: bool = True, delete_files: bool = False, stop_after: int = 0, file_type: morpheus._lib.common.FileTypes = FileTypes.Auto, columns: typing.List[str] = [], schema: typing.Dict[str, morpheus._lib.common.TypeId] = {}) -> None: ...
+    pass
+class EnrichmentStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, filename: str, key_columns: typing.List[str], columns: typing.List[str] = [], file_type: morpheus._lib.common.FileTypes = FileTypes.Auto, reload_interval_s: float = 0.0) -> None: ...
+    pass
 class FileSourceStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, filename: str, repeat: int, parser_kwargs: dict) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, filename: str, repeat: int, parser_kwargs: dict, columns: typing.List[str] = [], schema: typing.Dict[str, morpheus._lib.common.TypeId] = {}, sort_by: str = '', chunk_size_bytes: int = 0) -> None: ...
     pass
 class FilterDetectionsStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, threshold: float, copy: bool, filter_source: morpheus._lib.common.FilterSource, field_name: str = 'probs') -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, threshold: float, copy: bool, filter_source: morpheus._lib.common.FilterSource, field_name: str = 'probs', mask_column: str = '') -> None: ...
+    pass
+class GroupbyWindowStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, group_columns: typing.List[str], timestamp_column: str, window: int, aggregations: typing.List[typing.Tuple[str, str, str]]) -> None: ...
     pass
 class HttpServerSourceStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, bind_address: str = '127.0.0.1', port: int = 8080, endpoint: str = '/message', method: str = 'POST', accept_status: int = 201, sleep_time: float = 0.10000000149011612, queue_timeout: int = 5, max_queue_size: int = 1024, num_server_threads: int = 1, max_payload_size: int = 10485760, request_timeout: int = 30, lines: bool = False, stop_after: int = 0) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, bind_address: str = '127.0.0.1', port: int = 8080, endpoint: str = '/message', method: str = 'POST', accept_status: int = 201, sleep_time: float = 0.10000000149011612, queue_timeout: int = 5, max_queue_size: int = 1024, num_server_threads: int = 1, max_payload_size: int = 10485760, request_timeout: int = 30, lines: bool = False, stop_after: int = 0, reuse_port: bool = False, schema: typing.Dict[str, morpheus._lib.common.TypeId] = {}) -> None: ...
     pass
 class InferenceClientStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, model_name: str, server_url: str, force_convert_inputs: bool, use_shared_memory: bool, needs_logits: bool, inout_mapping: typing.Dict[str, str] = {}) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, model_name: str, server_url: str, force_convert_inputs: bool, use_shared_memory: bool, needs_logits: bool, inout_mapping: typing.Dict[str, str] = {}, max_in_flight: int = 1, hedge_quantile: float = 0.0, warmup_rows: int = 0) -> None: ...
+    pass
+class IpcSinkStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, shm_name: str, shm_size: int = 1048576) -> None: ...
+    pass
+class IpcSourceStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, shm_name: str, shm_size: int = 1048576, poll_interval_us: int = 100) -> None: ...
+    pass
+class KafkaSinkStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, topic: str, config: typing.Dict[str, str], file_type: morpheus._lib.common.FileTypes = FileTypes.JSON, include_index_col: bool = True, max_queue_retries: int = 10) -> None: ...
     pass
 class KafkaSourceStage(mrc.core.segment.SegmentObject):
     @typing.overload
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, max_batch_size: int, topic: str, batch_timeout_ms: int, config: typing.Dict[str, str], disable_commits: bool = False, disable_pre_filtering: bool = False, stop_after: int = 0, async_commits: bool = True, oauth_callback: typing.Optional[function] = None) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, max_batch_size: int, topic: str, batch_timeout_ms: int, config: typing.Dict[str, str], disable_commits: bool = False, disable_pre_filtering: bool = False, stop_after: int = 0, async_commits: bool = True, consumer_pool_size: int = 1, payload_compression: str = 'none', payload_format: str = 'json', oauth_callback: typing.Optional[function] = None, columns: typing.List[str] = [], header_filter: typing.Dict[str, str] = {}, key_filter: typing.List[str] = [], schema: typing.Dict[str, morpheus._lib.common.TypeId] = {}, sort_by: str = '') -> None: ...
     @typing.overload
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, max_batch_size: int, topics: typing.List[str], batch_timeout_ms: int, config: typing.Dict[str, str], disable_commits: bool = False, disable_pre_filtering: bool = False, stop_after: int = 0, async_commits: bool = True, oauth_callback: typing.Optional[function] = None) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, max_batch_size: int, topics: typing.List[str], batch_timeout_ms: int, config: typing.Dict[str, str], disable_commits: bool = False, disable_pre_filtering: bool = False, stop_after: int = 0, async_commits: bool = True, consumer_pool_size: int = 1, payload_compression: str = 'none', payload_format: str = 'json', oauth_callback: typing.Optional[function] = None, columns: typing.List[str] = [], header_filter: typing.Dict[str, str] = {}, key_filter: typing.List[str] = [], schema: typing.Dict[str, morpheus._lib.common.TypeId] = {}, sort_by: str = '') -> None: ...
+    pass
+class MockInferenceClientStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, outputs: typing.Dict[str, int], latency_mean_ms: float = 0.0, latency_stddev_ms: float = 0.0, distribution: str = 'lognormal', seed: int = 0) -> None: ...
+    pass
+class MonitorMessageMetaStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, description: str = '') -> None: ...
+    def get_stats(self) -> typing.Dict[str, float]: ...
+    pass
+class MonitorMultiMessageStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, description: str = '') -> None: ...
+    def get_stats(self) -> typing.Dict[str, float]: ...
     pass
 class PreallocateMessageMetaStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, needed_columns: typing.List[typing.Tuple[str, morpheus._lib.common.TypeId]]) -> None: ...
@@ -68,16 +114,28 @@ class PreallocateMessageMetaStage(mrc.core.segment.SegmentObject):
 class PreallocateMultiMessageStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, needed_columns: typing.List[typing.Tuple[str, morpheus._lib.common.TypeId]]) -> None: ...
     pass
+class PrefilterStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, predicates: typing.List[typing.Tuple[str, str, str]], combine: str = 'all') -> None: ...
+    pass
 class PreprocessFILStage(mrc.core.segment.SegmentObject):
     def __init__(self, builder: mrc.core.segment.Builder, name: str, features: typing.List[str]) -> None: ...
     pass
 class PreprocessNLPStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, vocab_hash_file: str, sequence_length: int, truncation: bool, do_lower_case: bool, add_special_token: bool, stride: int, column: str) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, vocab_hash_file: str, sequence_length: int, truncation: bool, do_lower_case: bool, add_special_token: bool, stride: int, column: str, chunk_size: int = 0, dedupe: bool = False, warmup_rows: int = 0) -> None: ...
+    pass
+class RegexExtractStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, input_column: str, extractions: typing.List[typing.Tuple[str, str, morpheus._lib.common.TypeId]]) -> None: ...
     pass
 class SerializeStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, include: typing.List[str], exclude: typing.List[str], fixed_columns: bool = True) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, include: typing.List[str], exclude: typing.List[str], fixed_columns: bool = True, filter_mask_column: str = '') -> None: ...
+    pass
+class TriggerMessageMetaStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, max_batch_size: int, max_latency_ms: int) -> None: ...
+    pass
+class TriggerMultiMessageStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, max_batch_size: int, max_latency_ms: int) -> None: ...
     pass
 class WriteToFileStage(mrc.core.segment.SegmentObject):
-    def __init__(self, builder: mrc.core.segment.Builder, name: str, filename: str, mode: str = 'w', file_type: morpheus._lib.common.FileTypes = FileTypes.Auto, include_index_col: bool = True, flush: bool = False) -> None: ...
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, filename: str, mode: str = 'w', file_type: morpheus._lib.common.FileTypes = FileTypes.Auto, include_index_col: bool = True, flush: bool = False, max_file_size: int = 0, rotate_period_s: int = 0, use_o_direct: bool = False) -> None: ...
     pass
 __version__ = '24.3.0'
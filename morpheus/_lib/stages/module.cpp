@@ -18,21 +18,33 @@
 #include "morpheus/messages/control.hpp"  // for ControlMessage
 #include "morpheus/messages/meta.hpp"
 #include "morpheus/messages/multi.hpp"
+#include "morpheus/objects/dtype.hpp"       // for TableSchema
 #include "morpheus/objects/file_types.hpp"  // for FileTypes
 #include "morpheus/stages/add_classification.hpp"
 #include "morpheus/stages/add_scores.hpp"
+#include "morpheus/stages/dedupe.hpp"
 #include "morpheus/stages/deserialize.hpp"
+#include "morpheus/stages/directory_source.hpp"
+#include "morpheus/stages/enrichment.hpp"
 #include "morpheus/stages/file_source.hpp"
 #include "morpheus/stages/filter_detection.hpp"
+#include "morpheus/stages/groupby_window.hpp"
 #include "morpheus/stages/http_server_source_stage.hpp"
+#include "morpheus/stages/ipc_sink.hpp"
+#include "morpheus/stages/ipc_source.hpp"
+#include "morpheus/stages/kafka_sink.hpp"
 #include "morpheus/stages/kafka_source.hpp"
+#include "morpheus/stages/mock_inference.hpp"
+#include "morpheus/stages/monitor.hpp"
 #include "morpheus/stages/preallocate.hpp"
+#include "morpheus/stages/prefilter.hpp"
 #include "morpheus/stages/preprocess_fil.hpp"
 #include "morpheus/stages/preprocess_nlp.hpp"
+#include "morpheus/stages/regex_extract.hpp"
 #include "morpheus/stages/serialize.hpp"
+#include "morpheus/stages/trigger.hpp"
 #include "morpheus/stages/triton_inference.hpp"
 #include "morpheus/stages/write_to_file.hpp"
-#include "morpheus/utilities/cudf_util.hpp"
 #include "morpheus/utilities/http_server.hpp"  // for DefaultMaxPayloadSize
 #include "morpheus/version.hpp"
 
@@ -44,7 +56,9 @@
 #include <pymrc/utils.hpp>      // for pymrc::import
 #include <rxcpp/rx.hpp>
 
+#include <map>  // for map
 #include <memory>
+#include <vector>
 #include <sstream>
 
 namespace morpheus {
@@ -60,9 +74,6 @@ PYBIND11_MODULE(stages, _module)
 
         )pbdoc";
 
-    // Load the cudf helpers
-    CudfHelper::load();
-
     // Make sure to load mrc.core.segment to get ObjectProperties
     mrc::pymrc::import(_module, "mrc.core.segment");
 
@@ -76,14 +87,32 @@ PYBIND11_MODULE(stages, _module)
              py::arg("builder"),
              py::arg("name"),
              py::arg("idx2label"),
-             py::arg("threshold"));
+             py::arg("threshold"),
+             py::arg("softmax")             = false,
+             py::arg("argmax_score_column") = "",
+             py::arg("argmax_index_column") = "");
 
     py::class_<mrc::segment::Object<AddScoresStage>,
                mrc::segment::ObjectProperties,
                std::shared_ptr<mrc::segment::Object<AddScoresStage>>>(
         _module, "AddScoresStage", py::multiple_inheritance())
-        .def(
-            py::init<>(&AddScoresStageInterfaceProxy::init), py::arg("builder"), py::arg("name"), py::arg("idx2label"));
+        .def(py::init<>(&AddScoresStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("idx2label"),
+             py::arg("softmax")             = false,
+             py::arg("argmax_score_column") = "",
+             py::arg("argmax_index_column") = "");
+
+    py::class_<mrc::segment::Object<DedupeStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<DedupeStage>>>(
+        _module, "DedupeStage", py::multiple_inheritance())
+        .def(py::init<>(&DedupeStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("key_columns"),
+             py::arg("window_size") = 0);
 
     py::class_<mrc::segment::Object<DeserializeStage<MultiMessage>>,
                mrc::segment::ObjectProperties,
@@ -107,6 +136,36 @@ PYBIND11_MODULE(stages, _module)
              py::arg("task_type")              = py::none(),
              py::arg("task_payload")           = py::none());
 
+    py::class_<mrc::segment::Object<DirectorySourceStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<DirectorySourceStage>>>(
+        _module, "DirectorySourceStage", py::multiple_inheritance())
+        .def(py::init<>(&DirectorySourceStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("directory"),
+             py::arg("num_threads")      = 4,
+             py::arg("queue_size")       = 8,
+             py::arg("process_existing") = true,
+             py::arg("delete_files")     = false,
+             py::arg("stop_after")       = 0,
+             py::arg("file_type")        = FileTypes::Auto,
+             py::arg("columns")          = std::vector<std::string>(),
+             py::arg("schema")           = TableSchema());
+
+    py::class_<mrc::segment::Object<EnrichmentStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<EnrichmentStage>>>(
+        _module, "EnrichmentStage", py::multiple_inheritance())
+        .def(py::init<>(&EnrichmentStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("filename"),
+             py::arg("key_columns"),
+             py::arg("columns")           = std::vector<std::string>(),
+             py::arg("file_type")         = FileTypes::Auto,
+             py::arg("reload_interval_s") = 0.0F);
+
     py::class_<mrc::segment::Object<FileSourceStage>,
                mrc::segment::ObjectProperties,
                std::shared_ptr<mrc::segment::Object<FileSourceStage>>>(
@@ -116,7 +175,11 @@ PYBIND11_MODULE(stages, _module)
              py::arg("name"),
              py::arg("filename"),
              py::arg("repeat"),
-             py::arg("parser_kwargs"));
+             py::arg("parser_kwargs"),
+             py::arg("columns")          = std::vector<std::string>(),
+             py::arg("schema")           = TableSchema(),
+             py::arg("sort_by")          = std::string(),
+             py::arg("chunk_size_bytes") = 0);
 
     py::class_<mrc::segment::Object<FilterDetectionsStage>,
                mrc::segment::ObjectProperties,
@@ -128,7 +191,20 @@ PYBIND11_MODULE(stages, _module)
              py::arg("threshold"),
              py::arg("copy"),
              py::arg("filter_source"),
-             py::arg("field_name") = "probs");
+             py::arg("field_name")  = "probs",
+             py::arg("mask_column") = "");
+
+    py::class_<mrc::segment::Object<GroupbyWindowStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<GroupbyWindowStage>>>(
+        _module, "GroupbyWindowStage", py::multiple_inheritance())
+        .def(py::init<>(&GroupbyWindowStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("group_columns"),
+             py::arg("timestamp_column"),
+             py::arg("window"),
+             py::arg("aggregations"));
 
     py::class_<mrc::segment::Object<InferenceClientStage>,
                mrc::segment::ObjectProperties,
@@ -142,7 +218,31 @@ PYBIND11_MODULE(stages, _module)
              py::arg("force_convert_inputs"),
              py::arg("use_shared_memory"),
              py::arg("needs_logits"),
-             py::arg("inout_mapping") = py::dict());
+             py::arg("inout_mapping") = py::dict(),
+             py::arg("max_in_flight") = 1,
+             py::arg("hedge_quantile") = 0.0,
+             py::arg("warmup_rows") = 0);
+
+    py::class_<mrc::segment::Object<IpcSinkStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<IpcSinkStage>>>(
+        _module, "IpcSinkStage", py::multiple_inheritance())
+        .def(py::init<>(&IpcSinkStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("shm_name"),
+             py::arg("shm_size") = 1024 * 1024);
+
+    py::class_<mrc::segment::Object<IpcSourceStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<IpcSourceStage>>>(
+        _module, "IpcSourceStage", py::multiple_inheritance())
+        .def(py::init<>(&IpcSourceStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("shm_name"),
+             py::arg("shm_size")         = 1024 * 1024,
+             py::arg("poll_interval_us") = 100);
 
     py::class_<mrc::segment::Object<KafkaSourceStage>,
                mrc::segment::ObjectProperties,
@@ -159,7 +259,15 @@ PYBIND11_MODULE(stages, _module)
              py::arg("disable_pre_filtering") = false,
              py::arg("stop_after")            = 0,
              py::arg("async_commits")         = true,
-             py::arg("oauth_callback")        = py::none())
+             py::arg("consumer_pool_size")    = 1,
+             py::arg("payload_compression")   = "none",
+             py::arg("payload_format")        = "json",
+             py::arg("oauth_callback")        = py::none(),
+             py::arg("columns")               = std::vector<std::string>(),
+             py::arg("header_filter")         = std::map<std::string, std::string>(),
+             py::arg("key_filter")            = std::vector<std::string>(),
+             py::arg("schema")                = TableSchema(),
+             py::arg("sort_by")               = std::string())
         .def(py::init<>(&KafkaSourceStageInterfaceProxy::init_with_multiple_topics),
              py::arg("builder"),
              py::arg("name"),
@@ -171,7 +279,81 @@ PYBIND11_MODULE(stages, _module)
              py::arg("disable_pre_filtering") = false,
              py::arg("stop_after")            = 0,
              py::arg("async_commits")         = true,
-             py::arg("oauth_callback")        = py::none());
+             py::arg("consumer_pool_size")    = 1,
+             py::arg("payload_compression")   = "none",
+             py::arg("payload_format")        = "json",
+             py::arg("oauth_callback")        = py::none(),
+             py::arg("columns")               = std::vector<std::string>(),
+             py::arg("header_filter")         = std::map<std::string, std::string>(),
+             py::arg("key_filter")            = std::vector<std::string>(),
+             py::arg("schema")                = TableSchema(),
+             py::arg("sort_by")               = std::string());
+
+    py::class_<mrc::segment::Object<KafkaSinkStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<KafkaSinkStage>>>(
+        _module, "KafkaSinkStage", py::multiple_inheritance())
+        .def(py::init<>(&KafkaSinkStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("topic"),
+             py::arg("config"),
+             py::arg("file_type")         = FileTypes::JSON,
+             py::arg("include_index_col") = true,
+             py::arg("max_queue_retries") = 10);
+
+    py::class_<mrc::segment::Object<MockInferenceClientStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<MockInferenceClientStage>>>(
+        _module, "MockInferenceClientStage", py::multiple_inheritance())
+        .def(py::init<>(&MockInferenceClientStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("outputs"),
+             py::arg("latency_mean_ms")   = 0.0,
+             py::arg("latency_stddev_ms") = 0.0,
+             py::arg("distribution")      = "lognormal",
+             py::arg("seed")              = 0);
+
+    py::class_<mrc::segment::Object<MonitorStage<MessageMeta>>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<MonitorStage<MessageMeta>>>>(
+        _module, "MonitorMessageMetaStage", py::multiple_inheritance())
+        .def(py::init<>(&MonitorStageInterfaceProxy<MessageMeta>::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("description") = "")
+        .def("get_stats", &MonitorStageInterfaceProxy<MessageMeta>::get_stats);
+
+    py::class_<mrc::segment::Object<MonitorStage<MultiMessage>>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<MonitorStage<MultiMessage>>>>(
+        _module, "MonitorMultiMessageStage", py::multiple_inheritance())
+        .def(py::init<>(&MonitorStageInterfaceProxy<MultiMessage>::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("description") = "")
+        .def("get_stats", &MonitorStageInterfaceProxy<MultiMessage>::get_stats);
+
+    py::class_<mrc::segment::Object<TriggerStage<MessageMeta>>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<TriggerStage<MessageMeta>>>>(
+        _module, "TriggerMessageMetaStage", py::multiple_inheritance())
+        .def(py::init<>(&TriggerStageInterfaceProxy<MessageMeta>::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("max_batch_size"),
+             py::arg("max_latency_ms"));
+
+    py::class_<mrc::segment::Object<TriggerStage<MultiMessage>>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<TriggerStage<MultiMessage>>>>(
+        _module, "TriggerMultiMessageStage", py::multiple_inheritance())
+        .def(py::init<>(&TriggerStageInterfaceProxy<MultiMessage>::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("max_batch_size"),
+             py::arg("max_latency_ms"));
 
     py::class_<mrc::segment::Object<PreallocateStage<MessageMeta>>,
                mrc::segment::ObjectProperties,
@@ -191,6 +373,16 @@ PYBIND11_MODULE(stages, _module)
              py::arg("name"),
              py::arg("needed_columns"));
 
+    py::class_<mrc::segment::Object<PrefilterStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<PrefilterStage>>>(
+        _module, "PrefilterStage", py::multiple_inheritance())
+        .def(py::init<>(&PrefilterStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("predicates"),
+             py::arg("combine") = "all");
+
     py::class_<mrc::segment::Object<PreprocessFILStage>,
                mrc::segment::ObjectProperties,
                std::shared_ptr<mrc::segment::Object<PreprocessFILStage>>>(
@@ -213,7 +405,20 @@ PYBIND11_MODULE(stages, _module)
              py::arg("do_lower_case"),
              py::arg("add_special_token"),
              py::arg("stride"),
-             py::arg("column"));
+             py::arg("column"),
+             py::arg("chunk_size")  = 0,
+             py::arg("dedupe")      = false,
+             py::arg("warmup_rows") = 0);
+
+    py::class_<mrc::segment::Object<RegexExtractStage>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<mrc::segment::Object<RegexExtractStage>>>(
+        _module, "RegexExtractStage", py::multiple_inheritance())
+        .def(py::init<>(&RegexExtractStageInterfaceProxy::init),
+             py::arg("builder"),
+             py::arg("name"),
+             py::arg("input_column"),
+             py::arg("extractions"));
 
     py::class_<mrc::segment::Object<HttpServerSourceStage>,
                mrc::segment::ObjectProperties,
@@ -234,7 +439,9 @@ PYBIND11_MODULE(stages, _module)
              py::arg("max_payload_size")   = DefaultMaxPayloadSize,
              py::arg("request_timeout")    = 30,
              py::arg("lines")              = false,
-             py::arg("stop_after")         = 0);
+             py::arg("stop_after")         = 0,
+             py::arg("reuse_port")         = false,
+             py::arg("schema")             = TableSchema());
 
     py::class_<mrc::segment::Object<SerializeStage>,
                mrc::segment::ObjectProperties,
@@ -245,7 +452,8 @@ PYBIND11_MODULE(stages, _module)
              py::arg("name"),
              py::arg("include"),
              py::arg("exclude"),
-             py::arg("fixed_columns") = true);
+             py::arg("fixed_columns")      = true,
+             py::arg("filter_mask_column") = "");
 
     py::class_<mrc::segment::Object<WriteToFileStage>,
                mrc::segment::ObjectProperties,
@@ -258,7 +466,10 @@ PYBIND11_MODULE(stages, _module)
              py::arg("mode")              = "w",
              py::arg("file_type")         = FileTypes::Auto,
              py::arg("include_index_col") = true,
-             py::arg("flush")             = false);
+             py::arg("flush")             = false,
+             py::arg("max_file_size")     = 0,
+             py::arg("rotate_period_s")   = 0,
+             py::arg("use_o_direct")      = false);
 
     _module.attr("__version__") =
         MRC_CONCAT_STR(morpheus_VERSION_MAJOR << "." << morpheus_VERSION_MINOR << "." << morpheus_VERSION_PATCH);
@@ -0,0 +1,14 @@
+from __future__ import annotations
+import morpheus._lib.tensorrt
+import typing
+import morpheus._lib.messages
+import mrc.core.segment
+
+__all__ = [
+    "TensorRTInferenceStage"
+]
+
+
+class TensorRTInferenceStage(mrc.core.segment.SegmentObject):
+    def __init__(self, builder: mrc.core.segment.Builder, name: str, engine_path: str, needs_logits: bool) -> None: ...
+    pass
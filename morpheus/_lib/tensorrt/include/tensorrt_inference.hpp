@@ -0,0 +1,97 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "morpheus/messages/multi_inference.hpp"
+#include "morpheus/messages/multi_response.hpp"
+
+#include <mrc/segment/builder.hpp>
+#include <pymrc/node.hpp>
+
+#include <memory>
+#include <string>
+
+namespace nvinfer1 {
+class ICudaEngine;
+class IRuntime;
+}  // namespace nvinfer1
+
+namespace morpheus {
+
+#pragma GCC visibility push(default)
+
+/**
+ * @brief Run inference in-process through a TensorRT engine, as a drop-in alternative to `InferenceClientStage`.
+ *
+ * The engine executes directly on the message's device tensors, so there is no serialization, no network hop and
+ * no extra copy into a server-owned buffer. This is the right trade for small models where the round trip to Triton
+ * costs more than the inference itself; for large models Triton's dynamic batching and multi-GPU scheduling usually
+ * win.
+ *
+ * Input tensors are matched to engine bindings by name, the same convention `InferenceClientStage` uses for Triton
+ * model inputs.
+ */
+class TensorRTInferenceStage
+  : public mrc::pymrc::PythonNode<std::shared_ptr<MultiInferenceMessage>, std::shared_ptr<MultiResponseMessage>>
+{
+  public:
+    using base_t =
+        mrc::pymrc::PythonNode<std::shared_ptr<MultiInferenceMessage>, std::shared_ptr<MultiResponseMessage>>;
+    using typename base_t::sink_type_t;
+    using typename base_t::source_type_t;
+    using typename base_t::subscribe_fn_t;
+
+    /**
+     * @brief Construct a new TensorRT Inference Stage object
+     *
+     * @param engine_path : Path to a serialized TensorRT engine file built for this machine's GPU.
+     * @param needs_logits : Determines if logits are required.
+     */
+    TensorRTInferenceStage(std::string engine_path, bool needs_logits);
+
+    ~TensorRTInferenceStage() override;
+
+  private:
+    subscribe_fn_t build_operator();
+
+    std::string m_engine_path;
+    bool m_needs_logits{true};
+
+    // The runtime must outlive the engine it deserialized
+    std::shared_ptr<nvinfer1::IRuntime> m_runtime;
+    std::shared_ptr<nvinfer1::ICudaEngine> m_engine;
+};
+
+/****** TensorRTInferenceStageInterfaceProxy****************/
+/**
+ * @brief Interface proxy, used to insulate python bindings.
+ */
+struct TensorRTInferenceStageInterfaceProxy
+{
+    /**
+     * @brief Create and initialize a TensorRTInferenceStage, and return the result.
+     */
+    static std::shared_ptr<mrc::segment::Object<TensorRTInferenceStage>> init(mrc::segment::Builder& builder,
+                                                                              const std::string& name,
+                                                                              std::string engine_path,
+                                                                              bool needs_logits);
+};
+
+#pragma GCC visibility pop
+
+}  // namespace morpheus
@@ -0,0 +1,276 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_inference.hpp"
+
+#include "morpheus/messages/memory/response_memory.hpp"
+#include "morpheus/objects/dev_mem_info.hpp"   // for DevMemInfo
+#include "morpheus/objects/dtype.hpp"          // for DType, TypeId
+#include "morpheus/objects/tensor.hpp"         // for Tensor::create
+#include "morpheus/objects/tensor_object.hpp"  // for TensorObject
+#include "morpheus/types.hpp"                  // for TensorIndex, TensorMap
+#include "morpheus/utilities/matx_util.hpp"    // for MatxUtil::logits
+#include "morpheus/utilities/string_util.hpp"  // for MORPHEUS_CONCAT_STR
+#include "morpheus/utilities/tensor_util.hpp"  // for get_elem_count
+
+#include <NvInfer.h>
+#include <cuda_runtime.h>
+#include <glog/logging.h>
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
+#include <mrc/segment/builder.hpp>
+#include <mrc/segment/object.hpp>
+#include <rmm/cuda_stream.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>  // for min
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>  // for runtime_error
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace morpheus;
+using buffer_map_t = std::map<std::string, std::shared_ptr<rmm::device_buffer>>;
+
+/**
+ * @brief Forward TensorRT diagnostics into glog at matching severities.
+ */
+class TrtLogger : public nvinfer1::ILogger  // NOLINT
+{
+  public:
+    void log(Severity severity, const char* msg) noexcept override
+    {
+        switch (severity)
+        {
+        case Severity::kINTERNAL_ERROR:
+        case Severity::kERROR:
+            LOG(ERROR) << "TensorRT: " << msg;
+            break;
+        case Severity::kWARNING:
+            LOG(WARNING) << "TensorRT: " << msg;
+            break;
+        default:
+            VLOG(10) << "TensorRT: " << msg;
+            break;
+        }
+    }
+
+    static TrtLogger& instance()
+    {
+        static TrtLogger logger;
+        return logger;
+    }
+};
+
+DType dtype_from_trt(nvinfer1::DataType trt_type)
+{
+    switch (trt_type)
+    {
+    case nvinfer1::DataType::kFLOAT:
+        return DType(TypeId::FLOAT32);
+    case nvinfer1::DataType::kINT32:
+        return DType(TypeId::INT32);
+    case nvinfer1::DataType::kINT8:
+        return DType(TypeId::INT8);
+    case nvinfer1::DataType::kBOOL:
+        return DType(TypeId::BOOL8);
+    default:
+        throw std::runtime_error("Unsupported TensorRT binding data type");
+    }
+}
+
+}  // namespace
+
+namespace morpheus {
+
+// Component public implementations
+// ************ TensorRTInferenceStage ************************* //
+TensorRTInferenceStage::TensorRTInferenceStage(std::string engine_path, bool needs_logits) :
+  PythonNode(base_t::op_factory_from_sub_fn(build_operator())),
+  m_engine_path(std::move(engine_path)),
+  m_needs_logits(needs_logits)
+{
+    std::ifstream engine_file(m_engine_path, std::ios::binary | std::ios::ate);
+    if (!engine_file)
+    {
+        throw std::runtime_error(MORPHEUS_CONCAT_STR("Unable to open TensorRT engine file: " << m_engine_path));
+    }
+
+    auto size = engine_file.tellg();
+    engine_file.seekg(0, std::ios::beg);
+
+    std::vector<char> engine_data(size);
+    engine_file.read(engine_data.data(), size);
+
+    m_runtime.reset(nvinfer1::createInferRuntime(TrtLogger::instance()));
+    CHECK(m_runtime) << "Failed to create TensorRT runtime";
+
+    m_engine.reset(m_runtime->deserializeCudaEngine(engine_data.data(), engine_data.size()));
+    if (!m_engine)
+    {
+        throw std::runtime_error(
+            MORPHEUS_CONCAT_STR("Failed to deserialize TensorRT engine from: " << m_engine_path));
+    }
+}
+
+TensorRTInferenceStage::~TensorRTInferenceStage() = default;
+
+TensorRTInferenceStage::subscribe_fn_t TensorRTInferenceStage::build_operator()
+{
+    return [this](rxcpp::observable<sink_type_t> input, rxcpp::subscriber<source_type_t> output) {
+        // Execution contexts are not thread safe, so each subscription owns its own
+        std::shared_ptr<nvinfer1::IExecutionContext> context{m_engine->createExecutionContext()};
+        CHECK(context) << "Failed to create TensorRT execution context";
+
+        auto stream = std::make_shared<rmm::cuda_stream>();
+
+        // The largest batch the engine's first optimization profile accepts
+        TensorIndex max_batch_size =
+            m_engine->getProfileDimensions(0, 0, nvinfer1::OptProfileSelector::kMAX).d[0];
+
+        return input.subscribe(rxcpp::make_observer<sink_type_t>(
+            [this, &output, context, stream, max_batch_size](sink_type_t x) {
+                if (x->mess_count != x->count)
+                {
+                    // Chunked pre-processor output needs the seq_ids reduction that InferenceClientStage performs
+                    throw std::runtime_error(
+                        "TensorRTInferenceStage does not support chunked inputs (count != mess_count)");
+                }
+
+                TensorMap output_tensors;
+                buffer_map_t output_buffers;
+
+                // Output buffers cover the full message, mini-batches below write into row offsets
+                for (int32_t i = 0; i < m_engine->getNbBindings(); ++i)
+                {
+                    if (m_engine->bindingIsInput(i))
+                    {
+                        continue;
+                    }
+
+                    auto dims  = m_engine->getBindingDimensions(i);
+                    auto dtype = dtype_from_trt(m_engine->getBindingDataType(i));
+
+                    ShapeType total_shape{x->count, dims.nbDims > 1 ? dims.d[1] : 1};
+                    auto elem_count = TensorUtils::get_elem_count(total_shape);
+
+                    auto output_buffer = std::make_shared<rmm::device_buffer>(elem_count * dtype.item_size(),
+                                                                              rmm::cuda_stream_per_thread);
+
+                    std::string name                = m_engine->getBindingName(i);
+                    output_buffers[name]            = output_buffer;
+                    ShapeType stride{total_shape[1], 1};
+                    output_tensors[name].swap(Tensor::create(std::move(output_buffer), dtype, total_shape, stride, 0));
+                }
+
+                for (TensorIndex start = 0; start < x->count; start += max_batch_size)
+                {
+                    TensorIndex stop = std::min(start + max_batch_size, x->count);
+
+                    sink_type_t mini_batch_input = x->get_slice(start, stop);
+
+                    std::vector<void*> bindings(m_engine->getNbBindings());
+
+                    // Keep the converted input tensors alive until the enqueue has been synchronized
+                    std::vector<TensorObject> saved_inputs;
+
+                    for (int32_t i = 0; i < m_engine->getNbBindings(); ++i)
+                    {
+                        std::string name = m_engine->getBindingName(i);
+
+                        if (m_engine->bindingIsInput(i))
+                        {
+                            DCHECK(mini_batch_input->memory->has_tensor(name))
+                                << "Engine input '" << name << "' not found in InferenceMemory";
+
+                            auto const& inp_tensor = mini_batch_input->get_input(name);
+
+                            // Convert to the binding's type. Make shallow if necessary
+                            auto& final_tensor = saved_inputs.emplace_back(
+                                inp_tensor.as_type(dtype_from_trt(m_engine->getBindingDataType(i))));
+
+                            auto dims = m_engine->getBindingDimensions(i);
+                            dims.d[0] = stop - start;
+                            context->setBindingDimensions(i, dims);
+
+                            bindings[i] = final_tensor.data();
+                        }
+                        else
+                        {
+                            auto& output_tensor = output_tensors[name];
+                            bindings[i] = static_cast<uint8_t*>(output_tensor.data()) +
+                                          start * output_tensor.bytes() / output_tensor.shape(0);
+                        }
+                    }
+
+                    if (!context->enqueueV2(bindings.data(), stream->value(), nullptr))
+                    {
+                        throw std::runtime_error("TensorRT enqueue failed");
+                    }
+
+                    // Inputs are only borrowed for the duration of the enqueue
+                    MRC_CHECK_CUDA(cudaStreamSynchronize(stream->value()));
+                }
+
+                // If we need to do logits, do that here
+                if (m_needs_logits)
+                {
+                    TensorMap logit_outputs;
+
+                    for (const auto& out : output_tensors)
+                    {
+                        auto& input_tensor = out.second;
+
+                        auto shape  = input_tensor.get_shape();
+                        auto stride = input_tensor.get_stride();
+
+                        auto& buffer = output_buffers[out.first];
+
+                        auto logit_buffer = MatxUtil::logits(DevMemInfo{buffer, input_tensor.dtype(), shape, stride});
+
+                        output_buffers[out.first] = logit_buffer;
+
+                        logit_outputs[out.first].swap(
+                            Tensor::create(std::move(logit_buffer), input_tensor.dtype(), shape, stride, 0));
+                    }
+
+                    output_tensors = std::move(logit_outputs);
+                }
+
+                auto response_mem = std::make_shared<ResponseMemory>(x->mess_count, std::move(output_tensors));
+                auto response     = std::make_shared<MultiResponseMessage>(
+                    x->meta, x->mess_offset, x->mess_count, std::move(response_mem), 0, response_mem->count);
+
+                output.on_next(std::move(response));
+            },
+            [&](std::exception_ptr error_ptr) { output.on_error(error_ptr); },
+            [&]() { output.on_completed(); }));
+    };
+}
+
+// ************ TensorRTInferenceStageInterfaceProxy ********* //
+std::shared_ptr<mrc::segment::Object<TensorRTInferenceStage>> TensorRTInferenceStageInterfaceProxy::init(
+    mrc::segment::Builder& builder, const std::string& name, std::string engine_path, bool needs_logits)
+{
+    return builder.construct_object<TensorRTInferenceStage>(name, std::move(engine_path), needs_logits);
+}
+
+}  // namespace morpheus
@@ -20,6 +20,7 @@
 
 #include "morpheus/io/data_loader.hpp"
 #include "morpheus/io/loaders/file.hpp"
+#include "morpheus/io/loaders/lambda.hpp"
 #include "morpheus/io/loaders/payload.hpp"
 #include "morpheus/messages/control.hpp"
 
@@ -28,6 +29,7 @@
 #include <pybind11/cast.h>
 #include <unistd.h>
 
+#include <cstddef>
 #include <cstdlib>
 #include <fstream>
 #include <memory>
@@ -122,6 +124,52 @@ TEST_F(TestDataLoader, PayloadLoaderTest)
     EXPECT_EQ(mm, mm2);
 }
 
+/**
+ * @brief Check that a batch of control messages reaches a batched loader in a single invocation, in order.
+ */
+TEST_F(TestDataLoader, BatchLoadTest)
+{
+    auto data_loader = DataLoader();
+
+    std::size_t invocations = 0;
+    data_loader.add_loader(
+        "batched_lambda",
+        std::make_shared<LambdaLoader>(LambdaLoader::lambda_load_batch_t(
+            [&invocations](std::vector<std::shared_ptr<ControlMessage>> messages, std::vector<nlohmann::json> tasks) {
+                ++invocations;
+                for (std::size_t i = 0; i < messages.size(); ++i)
+                {
+                    messages[i]->set_metadata("batch_index", nlohmann::json(i));
+                }
+
+                return messages;
+            })));
+
+    nlohmann::json message_config;
+    message_config["tasks"] = {{{"type", "load"}, {"properties", {{"loader_id", "batched_lambda"}}}}};
+
+    std::vector<std::shared_ptr<ControlMessage>> batch;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        batch.push_back(std::make_shared<ControlMessage>(message_config));
+    }
+
+    auto loaded = data_loader.load_batch(std::move(batch));
+
+    EXPECT_EQ(invocations, 1);
+    ASSERT_EQ(loaded.size(), 4);
+    for (std::size_t i = 0; i < loaded.size(); ++i)
+    {
+        EXPECT_EQ(loaded[i]->get_metadata("batch_index").get<std::size_t>(), i);
+    }
+
+    // A batched loader still serves the single-message path, as a batch of one
+    auto msg = std::make_shared<ControlMessage>(message_config);
+    EXPECT_NO_THROW(data_loader.load(msg));
+    EXPECT_EQ(invocations, 2);
+    EXPECT_EQ(msg->get_metadata("batch_index").get<std::size_t>(), 0);
+}
+
 /**
  * @brief Check that we can send a control message, with a raw data payload and load it correctly.
  */
@@ -21,6 +21,8 @@
 #include "morpheus/llm/llm_engine.hpp"
 #include "morpheus/llm/llm_lambda_node.hpp"
 #include "morpheus/llm/llm_task.hpp"
+#include "morpheus/llm/llm_task_handler.hpp"
+#include "morpheus/messages/control.hpp"
 #include "morpheus/types.hpp"
 
 #include <gtest/gtest.h>
@@ -28,16 +30,65 @@
 #include <mrc/coroutines/event.hpp>
 #include <mrc/coroutines/sync_wait.hpp>
 #include <mrc/coroutines/task.hpp>
+#include <nlohmann/json.hpp>
 
 #include <atomic>
 #include <coroutine>
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 using namespace morpheus;
 using namespace morpheus::test;
 using namespace mrc;
 
+namespace {
+
+// Task handler parked on an external gate; recording the completion order makes handler overlap observable
+class GatedTaskHandler : public llm::LLMTaskHandler
+{
+  public:
+    GatedTaskHandler(coroutines::Event& gate,
+                     std::vector<std::string>& completion_order,
+                     std::string name,
+                     bool claims) :
+      m_gate(gate),
+      m_completion_order(completion_order),
+      m_name(std::move(name)),
+      m_claims(claims)
+    {}
+
+    std::vector<std::string> get_input_names() const override
+    {
+        return {};
+    }
+
+    Task<return_t> try_handle(std::shared_ptr<llm::LLMContext> context) override
+    {
+        co_await m_gate;
+
+        m_completion_order.push_back(m_name);
+
+        if (!m_claims)
+        {
+            co_return std::nullopt;
+        }
+
+        co_return std::vector<std::shared_ptr<ControlMessage>>{std::make_shared<ControlMessage>()};
+    }
+
+  private:
+    coroutines::Event& m_gate;
+    std::vector<std::string>& m_completion_order;
+    std::string m_name;
+    bool m_claims;
+};
+
+}  // namespace
+
 TEST_CLASS(LLMEngine);
 
 TEST_F(TestLLMEngine, AsyncTest)
@@ -90,3 +141,43 @@ TEST_F(TestLLMEngine, AsyncTest)
     EXPECT_EQ(out_context->view_outputs()["start"], 123);
     EXPECT_EQ(out_context->view_outputs()["test"], 124);
 }
+
+TEST_F(TestLLMEngine, ConcurrentTaskHandlers)
+{
+    coroutines::Event first_gate{};
+    coroutines::Event second_gate{};
+
+    std::vector<std::string> completion_order;
+
+    llm::LLMEngine engine;
+
+    engine.add_task_handler({}, std::make_shared<GatedTaskHandler>(first_gate, completion_order, "decliner", false));
+    engine.add_task_handler({}, std::make_shared<GatedTaskHandler>(second_gate, completion_order, "claimer", true));
+
+    nlohmann::json msg_config;
+    msg_config["tasks"] = {
+        {{"type", "llm_engine"},
+         {"properties", {{"task_type", "template"}, {"task_dict", nlohmann::json::object()}}}}};
+
+    auto message = std::make_shared<ControlMessage>(msg_config);
+
+    auto run_task = engine.run(message);
+
+    run_task.resume();
+
+    // Both handlers are parked on their gates, neither has completed yet
+    EXPECT_FALSE(run_task.is_ready());
+    EXPECT_TRUE(completion_order.empty());
+
+    // Release the second handler first, it can only finish ahead of the first if both are in flight
+    second_gate.set();
+    first_gate.set();
+
+    auto outputs = coroutines::sync_wait(run_task);
+
+    EXPECT_EQ(outputs.size(), 1);
+
+    ASSERT_EQ(completion_order.size(), 2);
+    EXPECT_EQ(completion_order[0], "claimer");
+    EXPECT_EQ(completion_order[1], "decliner");
+}
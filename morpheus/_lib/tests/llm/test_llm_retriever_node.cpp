@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/llm/input_map.hpp"
+#include "morpheus/llm/llm_context.hpp"
+#include "morpheus/llm/llm_retriever_node.hpp"
+#include "morpheus/llm/llm_task.hpp"
+#include "morpheus/types.hpp"
+
+#include <gtest/gtest.h>
+#include <mrc/coroutines/sync_wait.hpp>
+#include <nlohmann/json.hpp>
+
+#include <coroutine>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace morpheus;
+using namespace morpheus::test;
+using namespace mrc;
+
+TEST_CLASS(LLMRetrieverNode);
+
+namespace {
+
+// Four 2-d corpus embeddings along with their document payloads
+auto make_test_node(TensorIndex k)
+{
+    std::vector<float> embeddings{1.0F, 0.0F, 0.0F, 1.0F, 0.7F, 0.7F, -1.0F, 0.0F};
+    std::vector<nlohmann::json> documents{"doc_a", "doc_b", "doc_c", "doc_d"};
+
+    return std::make_shared<llm::LLMRetrieverNode>(embeddings, std::move(documents), 2, k);
+}
+
+// Builds a child context whose "query" input resolves to the given value
+auto make_query_context(nlohmann::json query)
+{
+    auto parent_ctx = std::make_shared<llm::LLMContext>(llm::LLMTask{}, nullptr);
+    parent_ctx->set_output("embedding", std::move(query));
+
+    return parent_ctx->push("retrieve", llm::input_mappings_t{{"/embedding", "query"}});
+}
+
+}  // namespace
+
+TEST_F(TestLLMRetrieverNode, InvalidConstruction)
+{
+    std::vector<float> embeddings{1.0F, 0.0F};
+    std::vector<nlohmann::json> documents{"doc_a", "doc_b"};
+
+    // Two documents but only one 2-d embedding
+    EXPECT_THROW(llm::LLMRetrieverNode(embeddings, std::move(documents), 2, 1), std::invalid_argument);
+}
+
+TEST_F(TestLLMRetrieverNode, SingleQuery)
+{
+    auto node    = make_test_node(2);
+    auto context = make_query_context({1.0F, 0.1F});
+
+    auto out_context = coroutines::sync_wait(node->execute(context));
+
+    const auto& outputs = out_context->all_outputs();
+    ASSERT_EQ(outputs["documents"], nlohmann::json({"doc_a", "doc_c"}));
+    ASSERT_EQ(outputs["scores"].size(), 2);
+    ASSERT_FLOAT_EQ(outputs["scores"][0].get<float>(), 1.0F);
+    ASSERT_FLOAT_EQ(outputs["scores"][1].get<float>(), 0.77F);
+}
+
+TEST_F(TestLLMRetrieverNode, BatchQuery)
+{
+    auto node    = make_test_node(1);
+    auto context = make_query_context({{1.0F, 0.1F}, {-1.0F, 0.0F}});
+
+    auto out_context = coroutines::sync_wait(node->execute(context));
+
+    const auto& outputs = out_context->all_outputs();
+    ASSERT_EQ(outputs["documents"], nlohmann::json({{"doc_a"}, {"doc_d"}}));
+    ASSERT_FLOAT_EQ(outputs["scores"][0][0].get<float>(), 1.0F);
+    ASSERT_FLOAT_EQ(outputs["scores"][1][0].get<float>(), 1.0F);
+}
+
+TEST_F(TestLLMRetrieverNode, KClampedToCorpus)
+{
+    auto node    = make_test_node(10);
+    auto context = make_query_context({0.0F, 1.0F});
+
+    auto out_context = coroutines::sync_wait(node->execute(context));
+
+    // Only four corpus rows exist, the best match first
+    const auto& outputs = out_context->all_outputs();
+    ASSERT_EQ(outputs["documents"].size(), 4);
+    ASSERT_EQ(outputs["documents"][0], "doc_b");
+}
+
+TEST_F(TestLLMRetrieverNode, WrongQueryDimension)
+{
+    auto node    = make_test_node(1);
+    auto context = make_query_context({1.0F, 0.0F, 0.0F});
+
+    EXPECT_THROW(coroutines::sync_wait(node->execute(context)), std::invalid_argument);
+}
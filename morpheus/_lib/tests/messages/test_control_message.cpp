@@ -191,6 +191,51 @@ TEST_F(TestControlMessage, TaskTest)
     ASSERT_EQ(msg_train.has_task("custom"), false);
 }
 
+TEST_F(TestControlMessage, TaskPriorityOrdering)
+{
+    auto msg = ControlMessage();
+
+    msg.add_task("load", {{"loader_id", "bulk_a"}, {"priority", "bulk"}});
+    msg.add_task("load", {{"loader_id", "bulk_b"}, {"priority", "bulk"}});
+    msg.add_task("load", {{"loader_id", "default"}});
+    msg.add_task("load", {{"loader_id", "alert"}, {"priority", "realtime"}});
+    msg.add_task("load", {{"loader_id", "numeric"}, {"priority", 5}});
+
+    // Lower priority values dequeue first, ties dequeue FIFO, missing priority is "normal"
+    EXPECT_EQ("alert", msg.remove_task("load").at("loader_id").get<std::string>());
+    EXPECT_EQ("numeric", msg.remove_task("load").at("loader_id").get<std::string>());
+    EXPECT_EQ("default", msg.remove_task("load").at("loader_id").get<std::string>());
+    EXPECT_EQ("bulk_a", msg.remove_task("load").at("loader_id").get<std::string>());
+    EXPECT_EQ("bulk_b", msg.remove_task("load").at("loader_id").get<std::string>());
+
+    EXPECT_FALSE(msg.has_task("load"));
+}
+
+TEST_F(TestControlMessage, RemoveTasksDrainsInDequeueOrder)
+{
+    auto msg = ControlMessage();
+
+    msg.add_task("load", {{"loader_id", "bulk"}, {"priority", "bulk"}});
+    msg.add_task("load", {{"loader_id", "default"}});
+    msg.add_task("load", {{"loader_id", "alert"}, {"priority", "realtime"}});
+    msg.add_task("other", {{"loader_id", "unrelated"}});
+
+    auto tasks = msg.remove_tasks("load");
+
+    ASSERT_EQ(tasks.size(), 3);
+    EXPECT_EQ("alert", tasks[0].at("loader_id").get<std::string>());
+    EXPECT_EQ("default", tasks[1].at("loader_id").get<std::string>());
+    EXPECT_EQ("bulk", tasks[2].at("loader_id").get<std::string>());
+
+    // Only the requested type is drained
+    EXPECT_FALSE(msg.has_task("load"));
+    EXPECT_TRUE(msg.has_task("other"));
+
+    // Draining an empty or unknown type yields an empty array rather than throwing
+    EXPECT_TRUE(msg.remove_tasks("load").empty());
+    EXPECT_TRUE(msg.remove_tasks("never_added").empty());
+}
+
 TEST_F(TestControlMessage, PayloadTest)
 {
     auto msg = ControlMessage();
@@ -210,6 +255,29 @@ TEST_F(TestControlMessage, PayloadTest)
     ASSERT_EQ(msg.payload(), data_payload);
 }
 
+TEST_F(TestControlMessage, TaskPayloadSlicing)
+{
+    auto msg = ControlMessage();
+
+    EXPECT_THROW(msg.payload_slice(0, 2), std::runtime_error);
+
+    auto payload = create_mock_msg_meta({"col1", "col2", "col3"}, {"int32", "float32", "string"}, 5);
+    msg.payload(payload);
+
+    // Views share the payload's table, no rows are materialized
+    auto slice = msg.payload_slice(1, 3);
+    EXPECT_EQ(2, slice->count());
+
+    auto task_view = msg.task_payload({{"loader_id", "payload"}, {"payload_range", {1, 4}}});
+    EXPECT_EQ(3, task_view->count());
+
+    auto narrowed = msg.task_payload({{"loader_id", "payload"}, {"payload_columns", {"col1", "col2"}}});
+    EXPECT_EQ(2, narrowed->get_info().get_column_names().size());
+
+    // Tasks without a scope operate on the payload itself
+    EXPECT_EQ(payload, msg.task_payload({{"loader_id", "payload"}}));
+}
+
 TEST_F(TestControlMessage, SetAndGetTimestamp)
 {
     auto msg = ControlMessage();
@@ -284,6 +352,21 @@ TEST_F(TestControlMessage, UpdateTimestamp)
     EXPECT_EQ(later, result.value());
 }
 
+TEST_F(TestControlMessage, StampCurrentTimestamp)
+{
+    auto msg = ControlMessage();
+
+    auto before = clock_type_t::now();
+    msg.set_timestamp("group1::key1");
+    auto after = clock_type_t::now();
+
+    auto result = msg.get_timestamp("group1::key1", false);
+    ASSERT_TRUE(result.has_value());
+
+    EXPECT_LE(before, result.value());
+    EXPECT_GE(after, result.value());
+}
+
 // Test setting and getting Ten:sorMemory
 TEST_F(TestControlMessage, SetAndGetTensorMemory)
 {
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_utils/common.hpp"  // IWYU pragma: associated
+#include "test_messages.hpp"
+
+#include "morpheus/messages/control.hpp"
+#include "morpheus/messages/convert.hpp"
+#include "morpheus/messages/memory/tensor_memory.hpp"
+#include "morpheus/messages/multi.hpp"
+#include "morpheus/messages/multi_tensor.hpp"
+#include "morpheus/objects/dtype.hpp"
+#include "morpheus/objects/tensor.hpp"
+#include "morpheus/types.hpp"  // for TensorMap
+
+#include <gtest/gtest.h>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+using namespace morpheus;
+using namespace morpheus::test;
+
+TEST_F(TestMessageConvert, RoundTripWithoutTensors)
+{
+    auto meta  = create_mock_msg_meta({"col1", "col2"}, {"int32", "float32"}, 5);
+    auto multi = std::make_shared<MultiMessage>(meta);
+
+    auto control = to_control_message(multi);
+
+    // Whole-table messages hand the payload across without a wrapper view
+    EXPECT_EQ(meta, control->payload());
+
+    auto round_trip = to_multi_message(control);
+    EXPECT_EQ(meta, round_trip->meta);
+    EXPECT_EQ(5, round_trip->mess_count);
+
+    EXPECT_THROW(to_multi_message(std::make_shared<ControlMessage>()), std::runtime_error);
+}
+
+TEST_F(TestMessageConvert, SlicedMultiMessage)
+{
+    auto meta  = create_mock_msg_meta({"col1", "col2"}, {"int32", "float32"}, 5);
+    auto multi = std::make_shared<MultiMessage>(meta, 1, 3);
+
+    auto control = to_control_message(multi);
+
+    // Partial ranges become zero-copy views preserving the offset & count
+    EXPECT_NE(meta, control->payload());
+    EXPECT_EQ(3, control->payload()->count());
+}
+
+TEST_F(TestMessageConvert, TensorMessage)
+{
+    auto meta = create_mock_msg_meta({"col1"}, {"int32"}, 4);
+
+    auto buffer = std::make_shared<rmm::device_buffer>(4 * 2 * sizeof(float), rmm::cuda_stream_per_thread);
+
+    TensorMap tensors;
+    tensors.insert(std::pair{"probs", Tensor::create(buffer, DType::create<float>(), {4, 2}, {2, 1})});
+
+    auto memory = std::make_shared<TensorMemory>(4, std::move(tensors));
+    auto multi  = std::make_shared<MultiTensorMessage>(meta, 0, 4, memory, 1, 2);
+
+    auto control = to_control_message(multi);
+
+    // Partial tensor ranges are narrowed with views, full ranges share the memory block itself
+    ASSERT_NE(nullptr, control->tensors());
+    EXPECT_EQ(2, control->tensors()->count);
+    EXPECT_EQ(2, control->tensors()->get_tensors().at("probs").get_shape()[0]);
+
+    auto round_trip     = to_multi_message(control);
+    auto tensor_message = std::dynamic_pointer_cast<MultiTensorMessage>(round_trip);
+    ASSERT_NE(nullptr, tensor_message);
+    EXPECT_EQ(control->tensors(), tensor_message->memory);
+}
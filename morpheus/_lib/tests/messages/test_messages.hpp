@@ -22,4 +22,5 @@
 namespace morpheus::test {
 
 using TestControlMessage = TestWithPythonInterpreter;  // NOLINT
+using TestMessageConvert = TestWithPythonInterpreter;  // NOLINT
 }  // namespace morpheus::test
\ No newline at end of file
@@ -19,11 +19,20 @@
 
 #include "morpheus/io/deserializers.hpp"
 
+#include <cuda_runtime.h>               // for cudaMemcpy, cudaMemcpyDeviceToHost
+#include <cudf/column/column_view.hpp>  // for column_view
 #include <cudf/io/csv.hpp>
 #include <cudf/io/types.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>  // for table_view
+#include <cudf/types.hpp>             // for type_id
 #include <gtest/gtest.h>
+#include <mrc/cuda/common.hpp>  // for MRC_CHECK_CUDA
 
+#include <cstdint>  // for int64_t
+#include <exception>
 #include <filesystem>
+#include <stdexcept>  // for runtime_error
 #include <string>
 #include <vector>
 
@@ -103,3 +112,89 @@ TEST_F(TestDeserializers, GetIndexColCountValidNameInvalidType)
 
     EXPECT_EQ(get_index_col_count(table), 0);
 }
+
+TEST_F(TestDeserializers, SortTableByColumn)
+{
+    const std::string csv_data{
+        "user,value\n"
+        "b,0\n"
+        "a,1\n"
+        "b,2\n"
+        "a,3\n"};
+
+    auto options = cudf::io::csv_reader_options::builder(cudf::io::source_info{csv_data.c_str(), csv_data.size()});
+    auto table   = cudf::io::read_csv(options.build());
+
+    sort_table_by_column(table, "user");
+
+    auto view = table.tbl->view();
+    ASSERT_EQ(view.num_rows(), 4);
+
+    // The stable sort groups the keys while keeping arrival order within each key
+    std::vector<int64_t> values(view.num_rows());
+    MRC_CHECK_CUDA(cudaMemcpy(
+        values.data(), view.column(1).data<int64_t>(), values.size() * sizeof(int64_t), cudaMemcpyDeviceToHost));
+
+    EXPECT_EQ(values, (std::vector<int64_t>{1, 3, 0, 2}));
+
+    // An empty key name leaves the table unchanged, an unknown one throws
+    EXPECT_NO_THROW(sort_table_by_column(table, ""));
+    EXPECT_THROW(sort_table_by_column(table, "missing"), std::runtime_error);
+}
+
+TEST_F(TestDeserializers, LoadJsonLinesHost)
+{
+    const std::string json_lines{
+        "{\"a\": 1, \"b\": 1.5, \"c\": \"x\", \"d\": true}\n"
+        "{\"a\": 2.5, \"c\": \"y\"}\n"};
+
+    auto table = load_json_lines_host(json_lines);
+
+    EXPECT_EQ(get_column_names_from_table(table), (std::vector<std::string>{"a", "b", "c", "d"}));
+    EXPECT_EQ(table.tbl->num_rows(), 2);
+
+    auto view = table.tbl->view();
+
+    EXPECT_EQ(view.column(0).type().id(), cudf::type_id::FLOAT64);  // the 2.5 widens the column past int64
+    EXPECT_EQ(view.column(1).type().id(), cudf::type_id::FLOAT64);
+    EXPECT_EQ(view.column(2).type().id(), cudf::type_id::STRING);
+    EXPECT_EQ(view.column(3).type().id(), cudf::type_id::BOOL8);
+
+    // Keys missing from a line land as nulls
+    EXPECT_EQ(view.column(1).null_count(), 1);
+    EXPECT_EQ(view.column(3).null_count(), 1);
+
+    EXPECT_THROW(load_json_lines_host("not json\n"), std::exception);
+}
+
+TEST_F(TestDeserializers, ChunkedTableReader)
+{
+    auto input_file = test::get_morpheus_root() / "tests/tests_data/filter_probs.csv";
+
+    auto full = load_table_from_file(input_file);
+
+    // A chunk size far below the file size forces several byte ranges
+    ChunkedTableReader reader{input_file, FileTypes::Auto, std::nullopt, {}, {}, 32};
+
+    cudf::size_type total_rows = 0;
+    std::size_t num_chunks     = 0;
+
+    while (reader.has_next())
+    {
+        auto chunk = reader.next();
+
+        // Every non-empty chunk agrees on the header schema
+        if (chunk.tbl->num_rows() > 0)
+        {
+            EXPECT_EQ(get_column_names_from_table(chunk), get_column_names_from_table(full));
+        }
+
+        total_rows += chunk.tbl->num_rows();
+        ++num_chunks;
+    }
+
+    EXPECT_GT(num_chunks, 1);
+    EXPECT_EQ(total_rows, full.tbl->num_rows());
+
+    EXPECT_THROW(ChunkedTableReader(input_file, FileTypes::Auto, std::nullopt, {}, {}, 0), std::invalid_argument);
+}
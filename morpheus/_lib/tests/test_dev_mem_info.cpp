@@ -20,7 +20,8 @@
 #include "morpheus/objects/dev_mem_info.hpp"
 #include "morpheus/objects/dtype.hpp"  // for DType
 #include "morpheus/objects/memory_descriptor.hpp"
-#include "morpheus/types.hpp"  // for ShapeType, TensorIndex
+#include "morpheus/types.hpp"                  // for ShapeType, TensorIndex
+#include "morpheus/utilities/device_util.hpp"  // for DeviceUtil
 
 #include <gtest/gtest.h>  // for AssertionResult, SuiteApiResolver, TestInfo, EXPECT_TRUE, Message, TEST_F, Test, TestFactoryImpl, TestPartResult
 #include <rmm/cuda_stream_view.hpp>
@@ -88,6 +89,7 @@ TEST_F(TestDevMemInfo, RmmBufferConstructor)
     EXPECT_EQ(dm.memory()->cuda_stream, rmm::cuda_stream_legacy);
     EXPECT_EQ(dm.memory()->memory_resource,
               static_cast<cuda::mr::async_resource_ref<cuda::mr::device_accessible>>(mem_resource.get()));
+    EXPECT_EQ(dm.device_id(), DeviceUtil::current_device());
 }
 
 TEST_F(TestDevMemInfo, VoidPtrConstructor)
@@ -125,6 +127,7 @@ TEST_F(TestDevMemInfo, VoidPtrConstructor)
     EXPECT_EQ(dm.memory()->cuda_stream, rmm::cuda_stream_legacy);
     EXPECT_EQ(dm.memory()->memory_resource,
               static_cast<cuda::mr::async_resource_ref<cuda::mr::device_accessible>>(mem_resource.get()));
+    EXPECT_EQ(dm.device_id(), DeviceUtil::current_device());
 }
 
 TEST_F(TestDevMemInfo, MakeNewBuffer)
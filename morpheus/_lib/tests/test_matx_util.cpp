@@ -34,6 +34,8 @@
 #include <rmm/cuda_stream_view.hpp>  // for cuda_stream_per_thread
 #include <rmm/device_buffer.hpp>
 
+#include <cmath>    // for sqrt
+#include <cstddef>  // for size_t
 #include <cstdint>  // for int64_t, uint8_t
 #include <memory>   // for shared_ptr, make_shared, unique_ptr
 #include <vector>
@@ -66,6 +68,73 @@ TEST_F(TestMatxUtil, ReduceMax1d)
     EXPECT_EQ(output, expected_output);
 }
 
+TEST_F(TestMatxUtil, SlidingWindowReduce1d)
+{
+    // Test mimics example from the method's docstring; two entities of 4 and 2 rows, windows of 2 ending at
+    // each row and clamped at the segment start
+    std::vector<float> input{1, 3, 2, 5, 4, 9};
+    ShapeType segment_offsets{0, 4, 6};
+    TensorIndex window = 2;
+
+    std::vector<float> expected_max{1, 3, 3, 5, 4, 9};
+    std::vector<float> expected_sum{1, 4, 5, 7, 4, 13};
+    std::vector<float> expected_mean{1, 2, 2.5, 3.5, 4, 6.5};
+
+    DType dtype(TypeId::FLOAT32);
+
+    auto input_buffer =
+        std::make_shared<rmm::device_buffer>(input.size() * dtype.item_size(), rmm::cuda_stream_per_thread);
+
+    MRC_CHECK_CUDA(cudaMemcpy(input_buffer->data(), input.data(), input_buffer->size(), cudaMemcpyHostToDevice));
+
+    DevMemInfo dm{input_buffer, dtype, {static_cast<TensorIndex>(input.size()), 1}, {1, 0}};
+
+    auto check = [&](WindowReduceOp op, const std::vector<float>& expected) {
+        auto output_buffer = MatxUtil::sliding_window_reduce(dm, segment_offsets, window, op);
+
+        std::vector<float> output(input.size());
+        MRC_CHECK_CUDA(cudaMemcpy(output.data(), output_buffer->data(), output_buffer->size(), cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(output, expected);
+    };
+
+    check(WindowReduceOp::MAX, expected_max);
+    check(WindowReduceOp::SUM, expected_sum);
+    check(WindowReduceOp::MEAN, expected_mean);
+}
+
+TEST_F(TestMatxUtil, MeanPoolNormalize)
+{
+    // Two sequences of two 2-d token vectors each; the second sequence pools to all zeros and must pass
+    // through unscaled
+    std::vector<float> input{1, 0, 0, 1, 1, 2, -1, -2};
+    const TensorIndex pool_size = 2;
+
+    // First row pools to (0.5, 0.5), normalized to (1/sqrt(2), 1/sqrt(2))
+    const float inv_sqrt2 = 1.0F / std::sqrt(2.0F);
+    std::vector<float> expected{inv_sqrt2, inv_sqrt2, 0, 0};
+
+    DType dtype(TypeId::FLOAT32);
+
+    auto input_buffer =
+        std::make_shared<rmm::device_buffer>(input.size() * dtype.item_size(), rmm::cuda_stream_per_thread);
+
+    MRC_CHECK_CUDA(cudaMemcpy(input_buffer->data(), input.data(), input_buffer->size(), cudaMemcpyHostToDevice));
+
+    DevMemInfo dm{input_buffer, dtype, {4, 2}, {2, 1}};
+
+    auto output_buffer = MatxUtil::mean_pool_normalize(dm, pool_size);
+    EXPECT_EQ(output_buffer->size(), expected.size() * dtype.item_size());
+
+    std::vector<float> output(expected.size());
+    MRC_CHECK_CUDA(cudaMemcpy(output.data(), output_buffer->data(), output_buffer->size(), cudaMemcpyDeviceToHost));
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_FLOAT_EQ(output[i], expected[i]);
+    }
+}
+
 TEST_F(TestMatxUtil, ReduceMax2dRowMajor)
 {
     // clang-format off
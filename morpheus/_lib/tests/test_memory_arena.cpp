@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "./test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/utilities/memory_arena.hpp"
+
+#include <gtest/gtest.h>
+#include <rmm/cuda_stream_view.hpp>  // for cuda_stream_default
+#include <rmm/device_buffer.hpp>
+
+#include <cstddef>    // for size_t
+#include <exception>  // for exception
+
+using namespace morpheus;
+
+TEST_CLASS(MemoryArena);
+
+TEST_F(TestMemoryArena, RegistryReturnsSameArena)
+{
+    auto arena = MemoryArenaRegistry::instance().get_or_create("test_registry", 1 << 20);
+
+    // The budget only applies on first creation, later callers share the existing arena
+    EXPECT_EQ(MemoryArenaRegistry::instance().get_or_create("test_registry", 1 << 30), arena);
+    EXPECT_EQ(arena->name(), "test_registry");
+    EXPECT_EQ(arena->budget_bytes(), 1 << 20);
+}
+
+TEST_F(TestMemoryArena, StatsTrackHighWater)
+{
+    constexpr std::size_t AllocSize = 256 * 1024;
+
+    auto arena = MemoryArenaRegistry::instance().get_or_create("test_stats", 1 << 20);
+    auto md    = arena->make_descriptor(rmm::cuda_stream_default);
+
+    {
+        rmm::device_buffer buffer(AllocSize, md->cuda_stream, md->memory_resource);
+
+        auto stats = arena->stats();
+        EXPECT_GE(stats["current_bytes"], AllocSize);
+        EXPECT_GE(stats["peak_bytes"], AllocSize);
+        EXPECT_EQ(stats["budget_bytes"], 1 << 20);
+    }
+
+    // The buffer is released, the high-water mark stays
+    auto stats = arena->stats();
+    EXPECT_EQ(stats["current_bytes"], 0);
+    EXPECT_GE(stats["peak_bytes"], AllocSize);
+}
+
+TEST_F(TestMemoryArena, BudgetIsEnforced)
+{
+    auto arena = MemoryArenaRegistry::instance().get_or_create("test_budget", 1 << 20);
+    auto md    = arena->make_descriptor(rmm::cuda_stream_default);
+
+    // An over-budget allocation fails inside this arena without touching the shared resource
+    EXPECT_THROW(rmm::device_buffer(2 << 20, md->cuda_stream, md->memory_resource), std::exception);
+
+    // The arena stays usable afterwards
+    EXPECT_NO_THROW(rmm::device_buffer(1024, md->cuda_stream, md->memory_resource));
+}
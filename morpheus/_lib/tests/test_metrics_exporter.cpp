@@ -0,0 +1,58 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "./test_utils/common.hpp"  // IWYU pragma: associated
+
+#include "morpheus/utilities/metrics_exporter.hpp"
+#include "morpheus/utilities/stage_latency.hpp"  // for LatencyRegistry
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace morpheus;
+
+TEST_CLASS(MetricsExporter);
+
+TEST_F(TestMetricsExporter, RenderStageLatency)
+{
+    LatencyRegistry::instance().reset_all();
+    LatencyRegistry::instance().get_or_create("test_stage").record(5'000'000);  // 5ms
+
+    MetricsExporter exporter;
+    auto body = exporter.render();
+
+    EXPECT_NE(body.find("# TYPE morpheus_stage_latency gauge\n"), std::string::npos);
+    EXPECT_NE(body.find("morpheus_stage_latency{stage=\"test_stage\",stat=\"count\"} 1\n"), std::string::npos);
+    EXPECT_NE(body.find("morpheus_stage_latency{stage=\"test_stage\",stat=\"p50_us\"} "), std::string::npos);
+
+    // Registries nothing has recorded into stay out of the exposition entirely
+    EXPECT_EQ(body.find("morpheus_memory_arena"), std::string::npos);
+    EXPECT_EQ(body.find("morpheus_gpu"), std::string::npos);
+}
+
+TEST_F(TestMetricsExporter, RenderEscapesLabels)
+{
+    LatencyRegistry::instance().reset_all();
+    LatencyRegistry::instance().get_or_create("odd\"stage\\name").record(1000);
+
+    MetricsExporter exporter;
+    auto body = exporter.render();
+
+    EXPECT_NE(body.find("morpheus_stage_latency{stage=\"odd\\\"stage\\\\name\",stat=\"count\"} 1\n"),
+              std::string::npos);
+}
@@ -32,8 +32,10 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <array>    // for array
 #include <cstddef>  // for size_t
 #include <memory>   // shared_ptr
+#include <numeric>  // for iota
 #include <string>   // for allocator, operator==, basic_string, string
 #include <vector>   // for vector
 // IWYU pragma: no_include "morpheus/utilities/string_util.hpp"
@@ -155,6 +157,33 @@ TEST_F(TestTensor, Create)
         static_cast<cuda::mr::async_resource_ref<cuda::mr::device_accessible>>(rmm::mr::get_current_device_resource()));
 }
 
+TEST_F(TestTensor, ReadElements)
+{
+    std::vector<float> host_data(20);
+    std::iota(host_data.begin(), host_data.end(), 0.0F);
+
+    const auto dtype = DType::create<float>();
+    auto buffer =
+        std::make_shared<rmm::device_buffer>(host_data.size() * dtype.item_size(), rmm::cuda_stream_per_thread);
+
+    MRC_CHECK_CUDA(cudaMemcpy(buffer->data(), host_data.data(), buffer->size(), cudaMemcpyHostToDevice));
+
+    // Row-major 4x5 tensor
+    auto tensor = Tensor::create(buffer, dtype, {4, 5}, {5, 1});
+
+    std::vector<std::array<TensorIndex, 2>> indices{{0, 0}, {1, 3}, {3, 4}, {2, 2}};
+
+    auto values = tensor.read_elements<float>(indices);
+
+    ASSERT_EQ(values.size(), indices.size());
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        EXPECT_EQ(values[i], host_data[indices[i][0] * 5 + indices[i][1]]);
+    }
+
+    EXPECT_TRUE((tensor.read_elements<float, 2>({})).empty());
+}
+
 TEST_F(TestTensor, UtilsValidateShapeAndStride)
 {
     // validate shape and stride works off element count without knowledge
@@ -179,3 +208,31 @@ TEST_F(TestTensor, UtilsValidateShapeAndStride)
 
     EXPECT_EQ(stride, ShapeType({320 * 320, 320, 1}));
 }
+
+TEST_F(TestTensor, UtilsCopyCompact)
+{
+    // 4x4 row-major matrix holding 0..15
+    std::vector<float> host_vec(16);
+    std::iota(host_vec.begin(), host_vec.end(), 0.0F);
+
+    const auto dtype = DType::create<float>();
+    auto buffer =
+        std::make_shared<rmm::device_buffer>(host_vec.size() * dtype.item_size(), rmm::cuda_stream_per_thread);
+    MRC_CHECK_CUDA(cudaMemcpy(buffer->data(), host_vec.data(), buffer->size(), cudaMemcpyHostToDevice));
+
+    // Compact tensors take the flat copy path
+    auto full_tensor = Tensor::create(buffer, dtype, {4, 4}, {4, 1});
+    EXPECT_TRUE(full_tensor.is_compact());
+
+    std::vector<float> full_out(16);
+    TensorUtils::copy_compact(full_tensor, full_out.data(), cudaMemcpyDeviceToHost);
+    EXPECT_EQ(full_out, host_vec);
+
+    // The first two columns of each row form a row-strided view, compacted with a single 2D copy
+    auto sliced_tensor = Tensor::create(buffer, dtype, {4, 2}, {4, 1});
+    EXPECT_FALSE(sliced_tensor.is_compact());
+
+    std::vector<float> sliced_out(8);
+    TensorUtils::copy_compact(sliced_tensor, sliced_out.data(), cudaMemcpyDeviceToHost);
+    EXPECT_EQ(sliced_out, std::vector<float>({0, 1, 4, 5, 8, 9, 12, 13}));
+}
@@ -0,0 +1,82 @@
+# Copyright (c) 2021-2024, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import logging
+
+import mrc
+
+from morpheus.cli import register_stage
+from morpheus.config import Config
+from morpheus.config import PipelineModes
+from morpheus.messages import MessageMeta
+from morpheus.pipeline.pass_thru_type_mixin import PassThruTypeMixin
+from morpheus.pipeline.single_port_stage import SinglePortStage
+
+logger = logging.getLogger(__name__)
+
+
+@register_stage("to-pcap", modes=[PipelineModes.NLP])
+class DocaPcapSinkStage(PassThruTypeMixin, SinglePortStage):
+    """
+    Archives the packet tables emitted by `DocaSourceStage` to a pcapng file, writing the captured bytes
+    straight from device memory to storage via cuFile (GPUDirect Storage) when available.
+
+    The stage forwards every message unchanged, so it can sit on the analytic path without consuming it.
+    Messages without the packet schema (such as flow table snapshots) pass through unarchived. When GPUDirect
+    Storage is unavailable the packet bytes are staged through host memory instead.
+
+    Parameters
+    ----------
+    c : `morpheus.config.Config`
+        Pipeline configuration instance.
+    filename : str
+        The pcapng file to create. An existing file is truncated.
+    """
+
+    def __init__(self, c: Config, filename: str):
+
+        super().__init__(c)
+
+        # Attempt to import the C++ stage on creation
+        try:
+            # pylint: disable=c-extension-no-member
+            import morpheus._lib.doca as _doca
+
+            self._doca_pcap_sink_class = _doca.DocaPcapSinkStage
+        except ImportError as ex:
+            raise NotImplementedError(("The Morpheus DOCA components could not be imported. "
+                                       "Ensure the DOCA components have been built and installed. Error message: ") +
+                                      ex.msg) from ex
+
+        self._filename = filename
+
+    @property
+    def name(self) -> str:
+        return "to-pcap"
+
+    def accepted_types(self) -> tuple:
+        return (MessageMeta, )
+
+    def supports_cpp_node(self):
+        return True
+
+    def _build_single(self, builder: mrc.Builder, input_node: mrc.SegmentObject) -> mrc.SegmentObject:
+
+        if self._build_cpp_node():
+            node = self._doca_pcap_sink_class(builder, self.unique_name, self._filename)
+            builder.make_edge(input_node, node)
+
+            return node
+
+        raise NotImplementedError("Does not support Python nodes")
@@ -40,6 +40,20 @@ class DocaSourceStage(PreallocatorMixin, SingleOutputSource):
         The PCI Address of the NIC from which to recieve packets
     gpu_pci_address : str
         The PCI Address of the GPU which will receive packets
+    rx_queue_count : int
+        Number of receive queues to RSS-distribute packets across, each drained by its own GPU kernel. Line-rate
+        capture on 100Gbps links requires at least 4 queues.
+    persistent_kernel : bool
+        When True each queue is drained by a single long-running kernel that polls the NIC in device code,
+        avoiding the per-burst kernel launch latency. Useful when traffic arrives in small bursts.
+    flow_table_snapshot_interval : int
+        When greater than 0, the receive kernels maintain a GPU-resident flow table keyed by the packet 5-tuple
+        and a snapshot of the per-flow statistics is emitted as an additional message every N packet tables.
+        0 disables flow accounting.
+    snap_length : int
+        When greater than 0, only the first N payload bytes of each packet are copied into the emitted table;
+        header fields are parsed either way. Useful for netflow-style pipelines that only need L2-L4 headers.
+        Flows marked with `flag_flow` keep their full payloads. 0 captures every payload in full.
     """
 
     def __init__(
@@ -47,6 +61,10 @@ class DocaSourceStage(PreallocatorMixin, SingleOutputSource):
         c: Config,
         nic_pci_address: str,
         gpu_pci_address: str,
+        rx_queue_count: int = 1,
+        persistent_kernel: bool = False,
+        flow_table_snapshot_interval: int = 0,
+        snap_length: int = 0,
     ):
 
         super().__init__(c)
@@ -67,6 +85,11 @@ class DocaSourceStage(PreallocatorMixin, SingleOutputSource):
         self._max_concurrent = c.num_threads
         self._nic_pci_address = nic_pci_address
         self._gpu_pci_address = gpu_pci_address
+        self._rx_queue_count = rx_queue_count
+        self._persistent_kernel = persistent_kernel
+        self._flow_table_snapshot_interval = flow_table_snapshot_interval
+        self._snap_length = snap_length
+        self._doca_source_node = None
 
     @property
     def name(self) -> str:
@@ -83,9 +106,40 @@ class DocaSourceStage(PreallocatorMixin, SingleOutputSource):
     def supports_cpp_node(self):
         return True
 
+    def get_capture_stats(self) -> dict:
+        """
+        Return the device-side capture counters (packets, payload bytes, bursts, full bursts, semaphore-full
+        and host-stall events) accumulated by the receive kernels, cumulative since capture start. Safe to poll
+        at any time; does not touch the GPU hot path.
+        """
+        if self._doca_source_node is None:
+            raise RuntimeError("Capture stats are only available after the pipeline has been built")
+
+        return self._doca_source_node.get_capture_stats()
+
+    def flag_flow(self, src_ip: str, dst_ip: str, src_port: int, dst_port: int):
+        """
+        Mark a flow for full-payload capture, exempting it from `snap_length`. The tuple uses the values the
+        flow snapshots report; a flow can be flagged before its first packet arrives. Requires
+        `flow_table_snapshot_interval` to be greater than 0.
+        """
+        if self._doca_source_node is None:
+            raise RuntimeError("Flows can only be flagged after the pipeline has been built")
+
+        self._doca_source_node.flag_flow(src_ip, dst_ip, src_port, dst_port)
+
     def _build_source(self, builder: mrc.Builder) -> mrc.SegmentObject:
 
         if self._build_cpp_node():
-            return self._doca_source_class(builder, self.unique_name, self._nic_pci_address, self._gpu_pci_address)
+            self._doca_source_node = self._doca_source_class(builder,
+                                                             self.unique_name,
+                                                             self._nic_pci_address,
+                                                             self._gpu_pci_address,
+                                                             self._rx_queue_count,
+                                                             self._persistent_kernel,
+                                                             self._flow_table_snapshot_interval,
+                                                             self._snap_length)
+
+            return self._doca_source_node
 
         raise NotImplementedError("Does not support Python nodes")
@@ -77,6 +77,9 @@ class HttpServerSourceStage(PreallocatorMixin, SingleOutputSource):
         expect each request to be a JSON object per line.
     stop_after : int, default 0
         Stops ingesting after emitting `stop_after` records (rows in the dataframe). Useful for testing. Disabled if `0`
+    reuse_port : bool, default False
+        When True, each server thread runs its own SO_REUSEPORT acceptor pinned to a CPU so the kernel spreads
+        incoming connections across threads. Useful at high connection rates. Requires Linux and C++ mode.
     """
 
     def __init__(self,
@@ -93,7 +96,8 @@ class HttpServerSourceStage(PreallocatorMixin, SingleOutputSource):
                  max_payload_size: int = 10,
                  request_timeout_secs: int = 30,
                  lines: bool = False,
-                 stop_after: int = 0):
+                 stop_after: int = 0,
+                 reuse_port: bool = False):
         super().__init__(config)
         self._bind_address = bind_address
         self._port = port
@@ -108,6 +112,7 @@ class HttpServerSourceStage(PreallocatorMixin, SingleOutputSource):
         self._request_timeout_secs = request_timeout_secs
         self._lines = lines
         self._stop_after = stop_after
+        self._reuse_port = reuse_port
 
         # These are only used when C++ mode is disabled
         self._queue = None
@@ -222,7 +227,8 @@ class HttpServerSourceStage(PreallocatorMixin, SingleOutputSource):
                                                  max_payload_size=self._max_payload_size_bytes,
                                                  request_timeout=self._request_timeout_secs,
                                                  lines=self._lines,
-                                                 stop_after=self._stop_after)
+                                                 stop_after=self._stop_after,
+                                                 reuse_port=self._reuse_port)
         else:
             node = builder.make_source(self.unique_name, self._generate_frames())
 